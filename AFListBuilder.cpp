@@ -0,0 +1,250 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This is the code file for the AF list builder.
+ * See the header file for better function documentation.
+ */
+
+#include "AFListBuilder.h"
+
+#include <string.h>
+
+static byte countBits(const uint8_t bits[], byte size) {
+    byte count = 0;
+
+    for(byte i = 0; i < size; i++)
+        for(uint8_t b = bits[i]; b; b &= b - 1)
+            count++;
+
+    return count;
+};
+
+static bool isFMCode(byte code) {
+    return code && code < RDS_AF_FM_CODES;
+};
+
+AFListBuilder::AFListBuilder(TRDSAFList lists[], word capacity,
+                             TAFListCallback callback, void *context) {
+    _lists = lists;
+    _capacity = capacity;
+    registerCallback(callback, context);
+    reset();
+};
+
+void AFListBuilder::registerCallback(TAFListCallback callback, void *context) {
+    _callback = callback;
+    _context = context;
+};
+
+void AFListBuilder::reset(void) {
+    _count = 0;
+    tune(0x0000);
+};
+
+void AFListBuilder::tune(word programIdentifier) {
+    _programIdentifier = programIdentifier;
+    _countCode = 0;
+    _method = RDS_AF_METHOD_UNKNOWN;
+    _current = RDS_AF_LIST_NONE;
+    _lfmfNext = false;
+};
+
+const TRDSAFList *AFListBuilder::getList(word index) {
+    return index < _count ? &_lists[index] : NULL;
+};
+
+word AFListBuilder::findList(word programIdentifier, byte tunedFrequency) {
+    for(word i = 0; i < _count; i++)
+        if(_lists[i].programIdentifier == programIdentifier &&
+           _lists[i].tunedFrequency == tunedFrequency)
+            return i;
+
+    return RDS_AF_LIST_NONE;
+};
+
+word AFListBuilder::addList(byte method, byte tunedFrequency) {
+    word index = findList(_programIdentifier, tunedFrequency);
+
+    if(index != RDS_AF_LIST_NONE || _count >= _capacity)
+        return index;
+    index = _count++;
+    memset(&_lists[index], 0x00, sizeof(_lists[index]));
+    _lists[index].programIdentifier = _programIdentifier;
+    _lists[index].method = method;
+    _lists[index].tunedFrequency = tunedFrequency;
+
+    return index;
+};
+
+void AFListBuilder::openList(byte method) {
+    TRDSAFList *list;
+
+    _method = method;
+    _current = addList(method,
+                       method == RDS_AF_METHOD_B ? _head : 0);
+    if(_current == RDS_AF_LIST_NONE)
+        return;
+    list = &_lists[_current];
+    if(list->count != _countCode) {
+        memset(list->frequencies, 0x00, sizeof(list->frequencies));
+        memset(list->regional, 0x00, sizeof(list->regional));
+        memset(list->lfmf, 0x00, sizeof(list->lfmf));
+        list->count = _countCode;
+        list->complete = false;
+    };
+};
+
+void AFListBuilder::addCode(byte code, bool lfmf, bool regional) {
+    TRDSAFList *list;
+    uint8_t *bits, *other;
+    uint8_t mask = 0x01 << (code & 0x07);
+    byte expected, received;
+
+    if(_current == RDS_AF_LIST_NONE)
+        return;
+    list = &_lists[_current];
+    bits = lfmf ? list->lfmf : (regional ? list->regional : list->frequencies);
+    if(bits[code >> 3] & mask)
+        return;
+
+    //In method B, the tuned frequency comes with each AF, so the list holds
+    //half of the count (the tuned frequency itself left out).
+    expected = list->method == RDS_AF_METHOD_B ? (list->count - 1) / 2 :
+                                                 list->count;
+    //A method B AF moving between same programme and regional variant is
+    //still the same AF.
+    other = list->method == RDS_AF_METHOD_B ?
+            (regional ? list->frequencies : list->regional) : NULL;
+    if(other && (other[code >> 3] & mask))
+        other[code >> 3] &= ~mask;
+    else if(countBits(list->frequencies, RDS_AF_FM_BITMAP_SIZE) +
+            countBits(list->regional, RDS_AF_FM_BITMAP_SIZE) +
+            countBits(list->lfmf, RDS_AF_LFMF_BITMAP_SIZE) >= expected) {
+        //One more than announced: the list changed since it was last seen.
+        memset(list->frequencies, 0x00, sizeof(list->frequencies));
+        memset(list->regional, 0x00, sizeof(list->regional));
+        memset(list->lfmf, 0x00, sizeof(list->lfmf));
+        list->complete = false;
+    };
+    bits[code >> 3] |= mask;
+
+    received = countBits(list->frequencies, RDS_AF_FM_BITMAP_SIZE) +
+               countBits(list->regional, RDS_AF_FM_BITMAP_SIZE) +
+               countBits(list->lfmf, RDS_AF_LFMF_BITMAP_SIZE);
+    if(received == expected) {
+        list->complete = true;
+        if(_callback)
+            _callback(_context, list);
+    };
+};
+
+void AFListBuilder::processAFPair(word afPair) {
+    byte codes[2] = {(byte)(afPair >> 8), (byte)(afPair & 0xFF)};
+
+    if(!_programIdentifier)
+        return;
+
+    if(codes[0] == RDS_AF_NODATA) {
+        //An empty method A list.
+        _countCode = 0;
+        _head = 0;
+        openList(RDS_AF_METHOD_A);
+        if(_current != RDS_AF_LIST_NONE && !_lists[_current].complete) {
+            _lists[_current].complete = true;
+            if(_callback)
+                _callback(_context, &_lists[_current]);
+        };
+        _current = RDS_AF_LIST_NONE;
+        return;
+    };
+    if(codes[0] >= RDS_AF_FOLLOWS_FM_FIRST &&
+       codes[0] <= RDS_AF_FOLLOWS_FM_LAST) {
+        _countCode = codes[0] - RDS_AF_NODATA;
+        _head = codes[1];
+        _method = RDS_AF_METHOD_UNKNOWN;
+        _current = RDS_AF_LIST_NONE;
+        _lfmfNext = false;
+        //A lone frequency, or an LF/MF one, can only be a method A list.
+        if(_countCode == 1 && isFMCode(_head)) {
+            openList(RDS_AF_METHOD_A);
+            addCode(_head, false, false);
+        } else if(_head == RDS_AF_FOLLOWS_AM) {
+            openList(RDS_AF_METHOD_A);
+            _lfmfNext = true;
+        };
+        return;
+    };
+    if(!_countCode)
+        //Joined in the middle of a list.
+        return;
+
+    if(_method == RDS_AF_METHOD_UNKNOWN) {
+        if(!isFMCode(_head))
+            return;
+        //Method A never repeats a frequency, method B repeats the tuned one.
+        if(codes[0] == _head || codes[1] == _head)
+            openList(RDS_AF_METHOD_B);
+        else {
+            openList(RDS_AF_METHOD_A);
+            addCode(_head, false, false);
+        };
+    };
+
+    if(_method == RDS_AF_METHOD_B) {
+        byte af = codes[0] == _head ? codes[1] : codes[0];
+
+        if((codes[0] == _head || codes[1] == _head) && isFMCode(af) &&
+           af != _head)
+            addCode(af, false, codes[0] > codes[1]);
+        return;
+    };
+
+    for(byte i = 0; i < 2; i++)
+        if(_lfmfNext) {
+            _lfmfNext = false;
+            if(codes[i] && codes[i] < RDS_AF_LFMF_CODES)
+                addCode(codes[i], true, false);
+        } else if(codes[i] == RDS_AF_FOLLOWS_AM)
+            _lfmfNext = true;
+        else if(isFMCode(codes[i]))
+            addCode(codes[i], false, false);
+        //Fillers and unassigned codes carry nothing.
+};
+
+byte AFListBuilder::getFrequencies(const TRDSAFList *list, word frequencies[],
+                                   byte max, byte kind) {
+    const uint8_t *bits;
+    word codes;
+    byte count = 0;
+
+    if(!list)
+        return 0;
+    switch(kind) {
+        case 0:
+            bits = list->frequencies;
+            codes = RDS_AF_FM_CODES;
+            break;
+        case 1:
+            bits = list->regional;
+            codes = RDS_AF_FM_CODES;
+            break;
+        default:
+            bits = list->lfmf;
+            codes = RDS_AF_LFMF_CODES;
+    };
+
+    for(word code = 1; code < codes; code++)
+        if(bits[code >> 3] & (0x01 << (code & 0x07))) {
+            if(count < max)
+                frequencies[count] = _translator.decodeAFFrequency(code,
+                                                                   kind < 2);
+            count++;
+        };
+
+    return count;
+};
@@ -0,0 +1,176 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This file contains the AF list builder, which assembles the Alternative
+ * Frequency lists of Group 0A (both method A and method B) into compact
+ * frequency bitmaps.
+ */
+
+#ifndef _AFLISTBUILDER_H_INCLUDED
+#define _AFLISTBUILDER_H_INCLUDED
+
+#include "RDSDecoder.h"
+
+//Index value meaning "no such list"
+#define RDS_AF_LIST_NONE 0xFFFF
+
+// Values for TRDSAFList.method
+#define RDS_AF_METHOD_A 0x0
+#define RDS_AF_METHOD_B 0x1
+#define RDS_AF_METHOD_UNKNOWN 0xFF
+
+//One AF list: the whole method A list of a station, or one method B list,
+//which belongs to the transmitter on its tuned frequency. Bit n of a bitmap
+//stands for AF code n.
+typedef struct {
+    word programIdentifier;
+    byte method;
+    //Method B only: the AF code of the frequency the list belongs to.
+    byte tunedFrequency;
+    //Number of frequencies announced, and whether they are all in.
+    byte count;
+    bool complete;
+    uint8_t frequencies[RDS_AF_FM_BITMAP_SIZE];
+    //Method B only: frequencies carrying regional variants.
+    uint8_t regional[RDS_AF_FM_BITMAP_SIZE];
+    uint8_t lfmf[RDS_AF_LFMF_BITMAP_SIZE];
+} TRDSAFList;
+
+//AF List Builder callback prototype.
+//The first parameter is the context pointer given at registration time, the
+//second points to a list that just became complete, which happens again
+//whenever the list changes.
+typedef void (*TAFListCallback)(void *, const TRDSAFList *);
+
+class AFListBuilder
+{
+    public:
+        /*
+        * Description:
+        *   Constructor, sets up the builder over caller-provided storage.
+        * Parameters:
+        *   lists - an array of capacity TRDSAFList structs.
+        *   capacity - number of elements in lists, less than
+        *              RDS_AF_LIST_NONE.
+        *   callback - the function to call when a list is complete.
+        *   context - an opaque pointer handed back to the callback.
+        */
+        AFListBuilder(TRDSAFList lists[], word capacity,
+                      TAFListCallback callback = NULL, void *context = NULL);
+
+        /*
+        * Description:
+        *   Registers the callback that will receive complete lists. Using
+        *   NULL for the first parameter removes the current callback, if any.
+        */
+        void registerCallback(TAFListCallback callback = NULL,
+                              void *context = NULL);
+
+        /*
+        * Description:
+        *   Tells the builder which station is being received, call it
+        *   whenever the receiver is tuned and the PI is known.
+        */
+        void tune(word programIdentifier);
+
+        /*
+        * Description:
+        *   Feeds one pair of AF codes of the current station, with the third
+        *   argument of an RDS_CALLBACK_AF callback. A list starts with a
+        *   count code and is taken to be a method B one if the following
+        *   pairs all hold the frequency given next to the count. In method B,
+        *   an ascending pair is an AF carrying the same programme and a
+        *   descending one an AF carrying a regional variant. Fillers are
+        *   skipped, RDS_AF_FOLLOWS_AM introduces an LF/MF code and
+        *   RDS_AF_NODATA empties the method A list. Pairs seen before the
+        *   first count code of a station are ignored.
+        */
+        void processAFPair(word afPair);
+
+        /*
+        * Description:
+        *   Return the number of lists known and the lists themselves, by
+        *   index, NULL for invalid indexes.
+        */
+        word getListCount(void) { return _count; }
+        const TRDSAFList *getList(word index);
+
+        /*
+        * Description:
+        *   Finds the method A list of a station (tunedFrequency 0) or one of
+        *   its method B lists.
+        * Returns:
+        *   the index, RDS_AF_LIST_NONE if not known.
+        */
+        word findList(word programIdentifier, byte tunedFrequency = 0);
+
+        /*
+        * Description:
+        *   Converts the frequencies of a list to their values, as returned by
+        *   RDSTranslator::decodeAFFrequency().
+        * Parameters:
+        *   list - pointer to the list.
+        *   frequencies - an array of max words receiving the values, in
+        *                 ascending order.
+        *   max - number of elements in frequencies.
+        *   kind - 0 for FM (same programme), 1 for FM regional variants, 2
+        *          for LF/MF.
+        * Returns:
+        *   the number of frequencies of that kind in the list, which may be
+        *   more than max (only max are stored then).
+        */
+        byte getFrequencies(const TRDSAFList *list, word frequencies[],
+                            byte max, byte kind = 0);
+
+        /*
+        * Description:
+        *   Forgets all the lists.
+        */
+        void reset(void);
+
+    private:
+        RDSTranslator _translator;
+        TRDSAFList *_lists;
+        word _capacity;
+        word _count;
+        TAFListCallback _callback;
+        void *_context;
+        word _programIdentifier;
+        //The list being received: what came with its count code (0 if none
+        //yet), then its method and index once known.
+        byte _countCode;
+        byte _head;
+        byte _method;
+        word _current;
+        bool _lfmfNext;
+
+        /*
+        * Description:
+        *   Finds or adds a list, returns RDS_AF_LIST_NONE if it is not known
+        *   and there is no room left.
+        */
+        word addList(byte method, byte tunedFrequency);
+
+        /*
+        * Description:
+        *   Settles the method of the list being received and finds its
+        *   storage, emptying it if its count changed.
+        */
+        void openList(byte method);
+
+        /*
+        * Description:
+        *   Stores one code in the list being received. A code that was not
+        *   there in a list already holding all its frequencies means the list
+        *   changed: it is emptied first. The callback is invoked when the
+        *   list becomes complete.
+        */
+        void addCode(byte code, bool lfmf, bool regional);
+};
+
+#endif
@@ -0,0 +1,157 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This is the code file for the DAB cross-referencing ODA decoder.
+ * See the header file for better function documentation.
+ */
+
+#include "DABCrossReference.h"
+#include "RDSDecoder-private.h"
+
+#include <string.h>
+
+DABCrossReference::DABCrossReference(TRDSDABEnsemble ensembles[],
+                                     byte ensembleCapacity,
+                                     TRDSDABService services[],
+                                     byte serviceCapacity,
+                                     TDABCallback callback, void *context) {
+    _ensembles = ensembles;
+    _ensembleCapacity = ensembleCapacity;
+    _services = services;
+    _serviceCapacity = serviceCapacity;
+    _programIdentifier = 0x0000;
+    registerCallback(callback, context);
+    reset();
+};
+
+void DABCrossReference::registerCallback(TDABCallback callback,
+                                         void *context) {
+    _callback = callback;
+    _context = context;
+};
+
+void DABCrossReference::tune(word programIdentifier) {
+    _programIdentifier = programIdentifier;
+};
+
+void DABCrossReference::reset(void) {
+    _ensembleCount = 0;
+    _serviceCount = 0;
+    _dropped = 0;
+};
+
+const TRDSDABEnsemble *DABCrossReference::getEnsemble(byte index) {
+    return index < _ensembleCount ? &_ensembles[index] : NULL;
+};
+
+const TRDSDABService *DABCrossReference::getService(byte index) {
+    return index < _serviceCount ? &_services[index] : NULL;
+};
+
+const TRDSDABService *DABCrossReference::findService(word programIdentifier,
+                                                     word serviceIdentifier) {
+    for(byte i = 0; i < _serviceCount; i++)
+        if(_services[i].programIdentifier == programIdentifier &&
+           _services[i].serviceIdentifier == serviceIdentifier)
+            return &_services[i];
+
+    return NULL;
+};
+
+TRDSDABService *DABCrossReference::addService(word serviceIdentifier) {
+    TRDSDABService *service;
+
+    service = (TRDSDABService *)findService(_programIdentifier,
+                                            serviceIdentifier);
+    if(service)
+        return service;
+    if(_serviceCount == _serviceCapacity) {
+        _dropped++;
+        return NULL;
+    };
+    service = &_services[_serviceCount++];
+    memset(service, 0x00, sizeof(*service));
+    service->programIdentifier = _programIdentifier;
+    service->serviceIdentifier = serviceIdentifier;
+
+    return service;
+};
+
+void DABCrossReference::handleODA(void *context, byte address, bool group,
+                                  word blockC, word blockD) {
+    //The Group 3A message of this application carries nothing.
+    if(group)
+        ((DABCrossReference *)context)->decodeDABGroup(address, blockC,
+                                                       blockD);
+};
+
+void DABCrossReference::decodeDABGroup(byte address, word blockC,
+                                       word blockD) {
+    TRDSDABEnsemble *ensemble = NULL;
+    TRDSDABService *service;
+    TRDSLinkageInformation linkage;
+    uint32_t frequency;
+    byte mode;
+
+    if(!_programIdentifier)
+        return;
+
+    if(!(address & RDS_DAB_ES)) {
+        frequency = (((uint32_t)(address & RDS_DAB_FREQUENCY_MASK) <<
+                      RDS_DAB_FREQUENCY_SHL) | blockC) *
+                    RDS_DAB_FREQUENCY_STEP;
+        mode = (address & RDS_DAB_MODE_MASK) >> RDS_DAB_MODE_SHR;
+        for(byte i = 0; i < _ensembleCount; i++)
+            if(_ensembles[i].programIdentifier == _programIdentifier &&
+               _ensembles[i].ensembleIdentifier == blockD &&
+               _ensembles[i].frequency == frequency) {
+                ensemble = &_ensembles[i];
+                break;
+            };
+        if(ensemble) {
+            if(ensemble->mode == mode)
+                return;
+        } else if(_ensembleCount == _ensembleCapacity) {
+            _dropped++;
+            return;
+        } else {
+            ensemble = &_ensembles[_ensembleCount++];
+            ensemble->programIdentifier = _programIdentifier;
+            ensemble->ensembleIdentifier = blockD;
+            ensemble->frequency = frequency;
+        };
+        ensemble->mode = mode;
+        if(_callback)
+            _callback(_context, ensemble, NULL);
+        return;
+    };
+
+    switch(address & RDS_DAB_VARIANT_MASK) {
+        case RDS_DAB_VARIANT_ENSEMBLE:
+            service = addService(blockD);
+            if(!service || service->ensembleIdentifier == blockC)
+                return;
+            service->ensembleIdentifier = blockC;
+            break;
+        case RDS_DAB_VARIANT_LINKAGE:
+            service = addService(blockD);
+            RDSTranslator().unpackLinkageInformation(blockC, &linkage);
+            if(!service || (service->hasLinkage &&
+                            !memcmp(&service->linkageInformation, &linkage,
+                                    sizeof(linkage))))
+                return;
+            service->hasLinkage = true;
+            service->linkageInformation = linkage;
+            break;
+        default:
+            //Reserved for future use.
+            return;
+    };
+    if(_callback)
+        _callback(_context, NULL, service);
+};
@@ -0,0 +1,158 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This file contains the DAB cross-referencing ODA decoder, which collects
+ * the DAB ensembles and services (EN 301 700) announced by FM stations.
+ */
+
+#ifndef _DABCROSSREFERENCE_H_INCLUDED
+#define _DABCROSSREFERENCE_H_INCLUDED
+
+#include "RDSDecoder.h"
+
+#define RDS_AID_DAB 0x0093
+
+// Values for TRDSDABEnsemble.mode
+#define RDS_DAB_MODE_UNSPECIFIED 0x0
+#define RDS_DAB_MODE_I 0x1
+#define RDS_DAB_MODE_II_III 0x2
+#define RDS_DAB_MODE_IV 0x3
+
+//A DAB ensemble carrying (some of) the programmes of an FM station.
+typedef struct {
+    word programIdentifier;
+    word ensembleIdentifier;
+    //Frequency in kHz.
+    uint32_t frequency;
+    byte mode;
+} TRDSDABEnsemble;
+
+//A DAB service carrying the programme of an FM station; ensembleIdentifier
+//is 0 until the ensemble it is in has been announced.
+typedef struct {
+    word programIdentifier;
+    word serviceIdentifier;
+    word ensembleIdentifier;
+    bool hasLinkage;
+    TRDSLinkageInformation linkageInformation;
+} TRDSDABService;
+
+//DAB Cross Reference callback prototype.
+//The first parameter is the context pointer given at registration time, one
+//of the other two points to an ensemble or service that was just added or
+//whose mapping changed, the other one is NULL.
+typedef void (*TDABCallback)(void *, const TRDSDABEnsemble *,
+                             const TRDSDABService *);
+
+class DABCrossReference
+{
+    public:
+        /*
+        * Description:
+        *   Constructor, sets up empty tables over caller-provided storage.
+        * Parameters:
+        *   ensembles - an array of ensembleCapacity TRDSDABEnsemble structs.
+        *   ensembleCapacity - number of elements in ensembles.
+        *   services - an array of serviceCapacity TRDSDABService structs.
+        *   serviceCapacity - number of elements in services.
+        *   callback - the function to call on mapping changes.
+        *   context - an opaque pointer handed back to the callback.
+        */
+        DABCrossReference(TRDSDABEnsemble ensembles[], byte ensembleCapacity,
+                          TRDSDABService services[], byte serviceCapacity,
+                          TDABCallback callback = NULL, void *context = NULL);
+
+        /*
+        * Description:
+        *   Registers the callback that will receive mapping changes. Using
+        *   NULL for the first parameter removes the current callback, if any.
+        */
+        void registerCallback(TDABCallback callback = NULL,
+                              void *context = NULL);
+
+        /*
+        * Description:
+        *   Tells which FM station the groups are from, call it whenever the
+        *   receiver is tuned and the PI is known.
+        */
+        void tune(word programIdentifier);
+
+        /*
+        * Description:
+        *   ODA handler to register for RDS_AID_DAB, with a pointer to the
+        *   DABCrossReference object as the context:
+        *   decoder.registerODAHandler(RDS_AID_DAB,
+        *                              DABCrossReference::handleODA, &xref);
+        */
+        static void handleODA(void *context, byte address, bool group,
+                              word blockC, word blockD);
+
+        /*
+        * Description:
+        *   Decodes one group of the application: either an ensemble (E/S
+        *   flag clear: mode and frequency in blocks B and C, EId in block D)
+        *   or a service (E/S flag set: EId or linkage information in block C
+        *   according to the variant in block B, SId in block D).
+        * Parameters:
+        *   address - the 5 bit address code in block B.
+        *   blockC, blockD - blocks C and D of the group.
+        */
+        void decodeDABGroup(byte address, word blockC, word blockD);
+
+        /*
+        * Description:
+        *   Return the number of ensembles and services known and the entries
+        *   themselves, by index, NULL for invalid indexes.
+        */
+        byte getEnsembleCount(void) { return _ensembleCount; }
+        const TRDSDABEnsemble *getEnsemble(byte index);
+        byte getServiceCount(void) { return _serviceCount; }
+        const TRDSDABService *getService(byte index);
+
+        /*
+        * Description:
+        *   Looks up a DAB service announced by an FM station.
+        * Returns:
+        *   a pointer to the service, NULL if not known.
+        */
+        const TRDSDABService *findService(word programIdentifier,
+                                          word serviceIdentifier);
+
+        /*
+        * Description:
+        *   Returns the number of entries ignored for lack of room.
+        */
+        word getDropped(void) { return _dropped; }
+
+        /*
+        * Description:
+        *   Forgets all ensembles and services.
+        */
+        void reset(void);
+
+    private:
+        TRDSDABEnsemble *_ensembles;
+        byte _ensembleCapacity, _ensembleCount;
+        TRDSDABService *_services;
+        byte _serviceCapacity, _serviceCount;
+        word _dropped;
+        word _programIdentifier;
+        TDABCallback _callback;
+        void *_context;
+
+        /*
+        * Description:
+        *   Finds the service of the current station with the given SId,
+        *   adding it if needed.
+        * Returns:
+        *   a pointer to the service, NULL if there is no room left.
+        */
+        TRDSDABService *addService(word serviceIdentifier);
+};
+
+#endif
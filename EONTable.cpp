@@ -0,0 +1,208 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This is the code file for the EON table.
+ * See the header file for better function documentation.
+ */
+
+#include "EONTable.h"
+#include "RDSDecoder-private.h"
+
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+# define lowByte(x) (uint8_t)((x) & 0xFF)
+# define highByte(x) (uint8_t)(((x) >> 8) & 0xFF)
+#endif
+
+EONTable::EONTable(TRDSEONEntry entries[], byte capacity, byte locale,
+                   TEONCallback callback, void *context) :
+    _translator(locale) {
+    _entries = entries;
+    _capacity = capacity;
+    registerCallback(callback, context);
+    reset();
+};
+
+void EONTable::registerCallback(TEONCallback callback, void *context) {
+    _callback = callback;
+    _context = context;
+};
+
+void EONTable::reset(void) {
+    memset(_entries, 0x00, sizeof(_entries[0]) * _capacity);
+    _count = 0;
+    _dropped = 0;
+};
+
+byte EONTable::findSlot(word programIdentifier, bool add) {
+    byte slot;
+
+    if(!(_capacity && programIdentifier))
+        return _capacity;
+    //PIs of one broadcaster tend to share all but the low bits, the
+    //multiplication spreads them before the modulo.
+    slot = (word)(programIdentifier * 40503U) % _capacity;
+    for(byte i = 0; i < _capacity; i++) {
+        word PI = _entries[slot].network.programIdentifier;
+
+        if(PI == programIdentifier)
+            return slot;
+        if(!PI) {
+            //Entries are never removed, so the first empty slot ends the
+            //probe sequence.
+            if(!add)
+                return _capacity;
+            memset(_entries[slot].network.programService, ' ',
+                   sizeof(_entries[slot].network.programService) - 1);
+            _entries[slot].network.programIdentifier = programIdentifier;
+            _count++;
+            return slot;
+        };
+        if(++slot == _capacity)
+            slot = 0;
+    };
+    if(add)
+        _dropped++;
+
+    return _capacity;
+};
+
+const TRDSEONEntry *EONTable::find(word programIdentifier) {
+    byte slot = findSlot(programIdentifier, false);
+
+    return slot < _capacity ? &_entries[slot] : NULL;
+};
+
+const TRDSEONEntry *EONTable::getEntry(byte slot) {
+    if(slot >= _capacity || !_entries[slot].network.programIdentifier)
+        return NULL;
+
+    return &_entries[slot];
+};
+
+void EONTable::addAFPair(TRDSEONEntry *entry, word afPair) {
+    byte codes[2] = {highByte(afPair), lowByte(afPair)};
+    byte received = 0;
+
+    if(codes[0] == RDS_AF_NODATA) {
+        entry->alternativeFrequencyCount = 0;
+        memset(entry->alternativeFrequencies, 0x00,
+               sizeof(entry->alternativeFrequencies));
+        return;
+    };
+    if(codes[0] >= RDS_AF_FOLLOWS_FM_FIRST &&
+       codes[0] <= RDS_AF_FOLLOWS_FM_LAST) {
+        //A new count starts the list over, as does finding more frequencies
+        //than the count announced (the list changed).
+        for(byte i = 0; i < sizeof(entry->alternativeFrequencies); i++)
+            for(uint8_t b = entry->alternativeFrequencies[i]; b; b &= b - 1)
+                received++;
+        if(entry->alternativeFrequencyCount != codes[0] - RDS_AF_NODATA ||
+           received > entry->alternativeFrequencyCount)
+            memset(entry->alternativeFrequencies, 0x00,
+                   sizeof(entry->alternativeFrequencies));
+        entry->alternativeFrequencyCount = codes[0] - RDS_AF_NODATA;
+        codes[0] = RDS_AF_FILLER;
+    } else if(codes[0] == RDS_AF_FOLLOWS_AM)
+        //Only FM frequencies are kept.
+        return;
+
+    for(byte i = 0; i < 2; i++)
+        if(codes[i] && codes[i] < RDS_AF_FM_CODES)
+            entry->alternativeFrequencies[codes[i] >> 3] |=
+                0x01 << (codes[i] & 0x07);
+};
+
+void EONTable::addMapping(TRDSEONEntry *entry, byte mapping,
+                          word frequencies) {
+    byte i;
+
+    for(i = 0; i < entry->mappedFrequencyCount; i++)
+        if(entry->mappedFrequencies[i].tunedFrequency ==
+           highByte(frequencies) &&
+           entry->mappedFrequencies[i].mapping == mapping)
+            break;
+    if(i == RDS_EON_MAPPED_MAX)
+        return;
+    if(i == entry->mappedFrequencyCount)
+        entry->mappedFrequencyCount++;
+    entry->mappedFrequencies[i].tunedFrequency = highByte(frequencies);
+    entry->mappedFrequencies[i].mappedFrequency = lowByte(frequencies);
+    entry->mappedFrequencies[i].mapping = mapping;
+};
+
+void EONTable::handleEON(void *context, word *block) {
+    if(block)
+        ((EONTable *)context)->decodeEONGroup(block);
+    else
+        ((EONTable *)context)->reset();
+};
+
+void EONTable::decodeEONGroup(word block[]) {
+    byte grouptype = lowByte((block[1] & RDS_TYPE_MASK) >> RDS_TYPE_SHR);
+    byte slot, variant;
+    TRDSEONEntry *entry;
+    bool TA;
+
+    if(grouptype != RDS_GROUP_14A && grouptype != RDS_GROUP_14B)
+        return;
+    slot = findSlot(block[3], true);
+    if(slot == _capacity)
+        return;
+    entry = &_entries[slot];
+    TA = entry->network.TA;
+    entry->network.TP = block[1] & RDS_EON_TP;
+
+    if(grouptype == RDS_GROUP_14B) {
+        entry->network.TA = block[1] & RDS_EON_TA_B;
+        entry->network.PTY = _translator.mapShortPTY(
+            (block[1] & RDS_EON_PTY_B_MASK) >> RDS_EON_PTY_B_SHR);
+    } else {
+        variant = block[1] & RDS_EON_MASK;
+        switch(variant) {
+            case RDS_EON_TYPE_PS_SA0:
+            case RDS_EON_TYPE_PS_SA1:
+            case RDS_EON_TYPE_PS_SA2:
+            case RDS_EON_TYPE_PS_SA3:
+                entry->network.programService[variant * 2] =
+                    highByte(block[2]);
+                entry->network.programService[variant * 2 + 1] =
+                    lowByte(block[2]);
+                entry->programServiceSegments |= 0x01 << variant;
+                break;
+            case RDS_EON_TYPE_AF:
+                addAFPair(entry, block[2]);
+                break;
+            case RDS_EON_TYPE_MF_FM0:
+            case RDS_EON_TYPE_MF_FM1:
+            case RDS_EON_TYPE_MF_FM2:
+            case RDS_EON_TYPE_MF_FM3:
+                addMapping(entry, variant - RDS_EON_TYPE_AF, block[2]);
+                break;
+            case RDS_EON_TYPE_MF_AM:
+                addMapping(entry, RDS_EON_MAPPED_AM, block[2]);
+                break;
+            case RDS_EON_TYPE_LINKAGE:
+                _translator.unpackLinkageInformation(
+                    block[2], &entry->network.linkageInformation);
+                break;
+            case RDS_EON_TYPE_PTYTA:
+                entry->network.PTY = (block[2] & RDS_EON_PTY_A_MASK) >>
+                    RDS_EON_PTY_A_SHR;
+                entry->network.TA = block[2] & RDS_EON_TA_A;
+                break;
+            case RDS_EON_TYPE_PIN:
+                entry->network.programItemNumber = block[2];
+                break;
+        };
+    };
+
+    if(entry->network.TA != TA && _callback)
+        _callback(_context, entry);
+};
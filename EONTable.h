@@ -0,0 +1,151 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This file contains the EON table, which keeps what Groups 14A and 14B tell
+ * about each of the Other Networks announced by the tuned station.
+ */
+
+#ifndef _EONTABLE_H_INCLUDED
+#define _EONTABLE_H_INCLUDED
+
+#include "RDSDecoder.h"
+
+//Number of frequency mappings kept per Other Network.
+#define RDS_EON_MAPPED_MAX 8
+//Value of TRDSEONMappedFrequency.mapping for a mapped LF/MF frequency, the
+//mapped FM frequencies having 1 through 4.
+#define RDS_EON_MAPPED_AM 0x00
+
+typedef struct {
+    byte tunedFrequency;
+    byte mappedFrequency;
+    byte mapping;
+} TRDSEONMappedFrequency;
+
+typedef struct {
+    //PI, TP, TA, PTY, PS, PIN and linkage information of the Other Network;
+    //programIdentifier is 0 for unused entries.
+    TRDSEON network;
+    //Bit n is set once PS segment n has been received.
+    byte programServiceSegments;
+    //The method A AF list of variant 4, as a bitmap of AF codes, and the
+    //number of frequencies it announced.
+    byte alternativeFrequencyCount;
+    uint8_t alternativeFrequencies[RDS_AF_FM_BITMAP_SIZE];
+    //The frequencies of the Other Network to tune to from the tuned network,
+    //from variants 5 through 9.
+    byte mappedFrequencyCount;
+    TRDSEONMappedFrequency mappedFrequencies[RDS_EON_MAPPED_MAX];
+} TRDSEONEntry;
+
+//EON Table callback prototype.
+//The first parameter is the context pointer given at registration time, the
+//second points to an Other Network whose TA flag just changed, which is how
+//traffic announcements on other networks are signalled.
+typedef void (*TEONCallback)(void *, const TRDSEONEntry *);
+
+class EONTable
+{
+    public:
+        /*
+        * Description:
+        *   Constructor, sets up an empty table over caller-provided storage.
+        * Parameters:
+        *   entries - an array of capacity TRDSEONEntry structs. As entries
+        *             are hashed by PI, a few more than the number of Other
+        *             Networks expected keep lookups short.
+        *   capacity - number of elements in entries.
+        *   locale - locale used to map the short PTY codes of Group 14B.
+        *   callback - the function to call on TA changes.
+        *   context - an opaque pointer handed back to the callback.
+        */
+        EONTable(TRDSEONEntry entries[], byte capacity,
+                 byte locale = RDS_LOCALE_EU, TEONCallback callback = NULL,
+                 void *context = NULL);
+
+        /*
+        * Description:
+        *   Registers the callback that will receive TA changes. Using NULL
+        *   for the first parameter removes the current callback, if any.
+        */
+        void registerCallback(TEONCallback callback = NULL,
+                              void *context = NULL);
+
+        /*
+        * Description:
+        *   Updates the entry of the Other Network a Group 14A or 14B is
+        *   about, adding it if needed; other groups are ignored.
+        * Parameters:
+        *   block - the four blocks of the group.
+        */
+        void decodeEONGroup(word block[]);
+
+        /*
+        * Description:
+        *   EON handler to register with a pointer to the EONTable object as
+        *   the context, so that the table is fed and reset by the decoder:
+        *   decoder.registerEONHandler(EONTable::handleEON, &table);
+        */
+        static void handleEON(void *context, word *block);
+
+        /*
+        * Description:
+        *   Looks an Other Network up by PI.
+        * Returns:
+        *   a pointer to its entry, NULL if not known.
+        */
+        const TRDSEONEntry *find(word programIdentifier);
+
+        /*
+        * Description:
+        *   Return the number of Other Networks known and the entries by slot
+        *   (0 through capacity - 1), NULL for unused or invalid slots.
+        */
+        byte getCount(void) { return _count; }
+        const TRDSEONEntry *getEntry(byte slot);
+
+        /*
+        * Description:
+        *   Returns the number of Other Networks ignored for lack of room.
+        */
+        word getDropped(void) { return _dropped; }
+
+        /*
+        * Description:
+        *   Forgets all Other Networks, use when switching to a new station.
+        */
+        void reset(void);
+
+    private:
+        RDSTranslator _translator;
+        TRDSEONEntry *_entries;
+        byte _capacity;
+        byte _count;
+        word _dropped;
+        TEONCallback _callback;
+        void *_context;
+
+        /*
+        * Description:
+        *   Finds the slot of an Other Network by open addressing with linear
+        *   probing, adding it if asked to and there is room left.
+        * Returns:
+        *   the slot, or capacity if not found.
+        */
+        byte findSlot(word programIdentifier, bool add);
+
+        /*
+        * Description:
+        *   Stores one pair of AF codes of variant 4, or one frequency mapping
+        *   of variants 5 through 9.
+        */
+        void addAFPair(TRDSEONEntry *entry, word afPair);
+        void addMapping(TRDSEONEntry *entry, byte mapping, word frequencies);
+};
+
+#endif
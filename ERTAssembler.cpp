@@ -0,0 +1,224 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This is the code file for the eRT assembler.
+ * See the header file for better function documentation.
+ */
+
+#include "ERTAssembler.h"
+
+#if defined(__i386__) || defined(__x86_64__)
+
+#include <string.h>
+
+#define ERT_END 0x0D
+#define ERT_NO_END RDS_ERT_SEGMENTS
+#define ERT_REPLACEMENT 0xFFFD
+
+//Appends one code point to text as UTF-8, mapping the eRT control codes:
+//line feed and end of headline break the line, 0x1F is a soft hyphen and the
+//other controls are dropped. Returns the new length, unchanged if there is no
+//room left.
+static size_t appendCodePoint(char *text, size_t length, uint32_t c) {
+    byte size;
+
+    if(c == 0x0A || c == 0x0B)
+        c = '\n';
+    else if(c == 0x1F)
+        c = 0xAD;
+    else if(c < 0x20 || c == 0x7F)
+        return length;
+
+    size = c < 0x80 ? 1 : c < 0x800 ? 2 : c < 0x10000 ? 3 : 4;
+    if(length + size > RDS_ERT_TEXT_MAX)
+        return length;
+    switch(size) {
+        case 1:
+            text[length] = c;
+            break;
+        case 2:
+            text[length] = 0xC0 | (c >> 6);
+            text[length + 1] = 0x80 | (c & 0x3F);
+            break;
+        case 3:
+            text[length] = 0xE0 | (c >> 12);
+            text[length + 1] = 0x80 | ((c >> 6) & 0x3F);
+            text[length + 2] = 0x80 | (c & 0x3F);
+            break;
+        case 4:
+            text[length] = 0xF0 | (c >> 18);
+            text[length + 1] = 0x80 | ((c >> 12) & 0x3F);
+            text[length + 2] = 0x80 | ((c >> 6) & 0x3F);
+            text[length + 3] = 0x80 | (c & 0x3F);
+            break;
+    };
+
+    return length + size;
+};
+
+//Decodes one UTF-8 sequence of at most size bytes, stores the code point
+//(U+FFFD for invalid sequences) and returns the number of bytes consumed.
+static byte decodeUTF8(const uint8_t *s, size_t size, uint32_t *c) {
+    byte length, i;
+    uint32_t value;
+
+    if(s[0] < 0x80) {
+        *c = s[0];
+        return 1;
+    } else if((s[0] & 0xE0) == 0xC0) {
+        length = 2;
+        value = s[0] & 0x1F;
+    } else if((s[0] & 0xF0) == 0xE0) {
+        length = 3;
+        value = s[0] & 0x0F;
+    } else if((s[0] & 0xF8) == 0xF0) {
+        length = 4;
+        value = s[0] & 0x07;
+    } else {
+        *c = ERT_REPLACEMENT;
+        return 1;
+    };
+
+    for(i = 1; i < length; i++) {
+        if(i >= size || (s[i] & 0xC0) != 0x80) {
+            *c = ERT_REPLACEMENT;
+            return i;
+        };
+        value = (value << 6) | (s[i] & 0x3F);
+    };
+    //Overlong forms, surrogates and values past Unicode are not characters.
+    if((length == 2 && value < 0x80) || (length == 3 && value < 0x800) ||
+       (length == 4 && value < 0x10000) || value > 0x10FFFF ||
+       (value >= 0xD800 && value <= 0xDFFF))
+        value = ERT_REPLACEMENT;
+    *c = value;
+
+    return length;
+};
+
+ERTAssembler::ERTAssembler(TERTCallback callback, void *context) {
+    registerCallback(callback, context);
+    reset();
+};
+
+void ERTAssembler::registerCallback(TERTCallback callback, void *context) {
+    _callback = callback;
+    _context = context;
+};
+
+void ERTAssembler::restart(void) {
+    memset(_buffer, 0x00, sizeof(_buffer));
+    _received = 0;
+    _end = ERT_NO_END;
+};
+
+void ERTAssembler::reset(void) {
+    memset(&_format, 0x00, sizeof(_format));
+    restart();
+    _text[0] = '\0';
+    _length = 0;
+    _published = false;
+};
+
+void ERTAssembler::processERTMessage3(word eRTMessage) {
+    RDSTranslator translator;
+    TRDSERTMessage3 format;
+
+    translator.unpackERTMessage3(eRTMessage, &format);
+    if(format.utf8 != _format.utf8 ||
+       format.characterTable != _format.characterTable)
+        restart();
+    _format = format;
+};
+
+void ERTAssembler::decodeERTGroup(byte address, word eRTbits1,
+                                  word eRTbits2) {
+    uint8_t segment[RDS_ERT_SEGMENT_SIZE] = {
+        (uint8_t)(eRTbits1 >> 8), (uint8_t)eRTbits1,
+        (uint8_t)(eRTbits2 >> 8), (uint8_t)eRTbits2};
+    uint8_t *slot;
+    TRDSERTText complete;
+    char text[RDS_ERT_TEXT_MAX + 1];
+    size_t length;
+    uint32_t needed;
+
+    address &= RDS_ERT_SEGMENTS - 1;
+    slot = &_buffer[address * RDS_ERT_SEGMENT_SIZE];
+    if((_received & (1UL << address)) &&
+       memcmp(slot, segment, RDS_ERT_SEGMENT_SIZE))
+        restart();
+    memcpy(slot, segment, RDS_ERT_SEGMENT_SIZE);
+    _received |= 1UL << address;
+
+    //UCS-2 ends at the character 0x000D, UTF-8 at the byte 0x0D.
+    for(byte i = 0; i < RDS_ERT_SEGMENT_SIZE && address < _end;
+        i += _format.utf8 ? 1 : 2)
+        if(_format.utf8 ? segment[i] == ERT_END :
+                          segment[i] == 0 && segment[i + 1] == ERT_END)
+            _end = address;
+
+    needed = _end >= RDS_ERT_SEGMENTS - 1 ? 0xFFFFFFFFUL :
+                                            (1UL << (_end + 1)) - 1;
+    if((_received & needed) != needed)
+        return;
+
+    length = normalize(text);
+    if(_published && length == _length && !memcmp(text, _text, length))
+        return;
+    memcpy(_text, text, length + 1);
+    _length = length;
+    _published = true;
+
+    if(_callback && getText(&complete))
+        _callback(_context, &complete);
+};
+
+size_t ERTAssembler::normalize(char *text) {
+    size_t size = (_end == ERT_NO_END ? RDS_ERT_SEGMENTS : _end + 1) *
+                  RDS_ERT_SEGMENT_SIZE;
+    size_t length = 0, i = 0;
+    uint32_t c;
+
+    while(i < size) {
+        if(_format.utf8) {
+            if(_buffer[i] == ERT_END)
+                break;
+            i += decodeUTF8(&_buffer[i], size - i, &c);
+        } else {
+            c = ((uint32_t)_buffer[i] << 8) | _buffer[i + 1];
+            if(c == ERT_END)
+                break;
+            //UCS-2 has no surrogate pairs.
+            if(c >= 0xD800 && c <= 0xDFFF)
+                c = ERT_REPLACEMENT;
+            i += 2;
+        };
+        //Unused room after the text is padded with NULs.
+        if(c)
+            length = appendCodePoint(text, length, c);
+    };
+    while(length && (text[length - 1] == ' ' || text[length - 1] == '\n'))
+        length--;
+    text[length] = '\0';
+
+    return length;
+};
+
+bool ERTAssembler::getText(TRDSERTText *text) {
+    if(!(text && _published))
+        return false;
+
+    text->text = _text;
+    text->length = _length;
+    text->rtl = _format.rtl;
+    text->characterTable = _format.characterTable;
+
+    return true;
+};
+
+#endif
@@ -0,0 +1,130 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This file contains the eRT assembler, which collects the segments of an
+ * Enhanced RadioText message and publishes it as normalized UTF-8 once it is
+ * complete. As the RDS_CALLBACK_ERT documentation explains, this is too much
+ * for an MCU, so it is only available on hosts.
+ */
+
+#ifndef _ERTASSEMBLER_H_INCLUDED
+#define _ERTASSEMBLER_H_INCLUDED
+
+#include "RDSDecoder.h"
+
+#if defined(__i386__) || defined(__x86_64__)
+
+//An eRT message is up to 32 segments of 4 bytes each: 64 UCS-2 characters or
+//128 bytes of UTF-8.
+#define RDS_ERT_SEGMENTS 32
+#define RDS_ERT_SEGMENT_SIZE 4
+#define RDS_ERT_BUFFER_SIZE (RDS_ERT_SEGMENTS * RDS_ERT_SEGMENT_SIZE)
+//Longest normalized text: 64 UCS-2 characters take at most 3 bytes each.
+#define RDS_ERT_TEXT_MAX 192
+
+typedef struct {
+    //Normalized UTF-8, NUL-terminated.
+    const char *text;
+    size_t length;
+    //From Group 3A: text direction and character table (0 is the default).
+    bool rtl;
+    byte characterTable;
+} TRDSERTText;
+
+//eRT Assembler callback prototype.
+//The first parameter is the context pointer given at registration time, the
+//second points to the complete text, which is only valid for the duration
+//of the call.
+typedef void (*TERTCallback)(void *, const TRDSERTText *);
+
+class ERTAssembler
+{
+    public:
+        /*
+        * Description:
+        *   Default constructor, optionally registers the callback that will
+        *   receive complete texts.
+        */
+        ERTAssembler(TERTCallback callback = NULL, void *context = NULL);
+
+        /*
+        * Description:
+        *   Registers the callback that will receive complete texts. Using
+        *   NULL for the first parameter removes the current callback, if any.
+        */
+        void registerCallback(TERTCallback callback = NULL,
+                              void *context = NULL);
+
+        /*
+        * Description:
+        *   Feeds the Group 3A eRT message, as received by the RDS_CALLBACK_AID
+        *   callback for the AID of eRT. A change of encoding drops the
+        *   segments received so far.
+        * Parameters:
+        *   eRTMessage - a word containing block C of group 3A.
+        */
+        void processERTMessage3(word eRTMessage);
+
+        /*
+        * Description:
+        *   Feeds one eRT segment, with the arguments of an RDS_CALLBACK_ERT
+        *   callback. A segment that differs from the one already received at
+        *   the same address starts a new message. The callback is invoked
+        *   once all the segments up to the end of the message (carriage
+        *   return or the 32nd segment) are in, if the text differs from the
+        *   one last published.
+        * Parameters:
+        *   address - the 5 bit segment address.
+        *   eRTbits1, eRTbits2 - the two halves of the segment.
+        */
+        void decodeERTGroup(byte address, word eRTbits1, word eRTbits2);
+
+        /*
+        * Description:
+        *   Fills text with the last complete text published.
+        * Returns:
+        *   true if there is one, false otherwise.
+        */
+        bool getText(TRDSERTText *text);
+
+        /*
+        * Description:
+        *   Drops the segments and the last published text, use when
+        *   switching to a new station.
+        */
+        void reset(void);
+
+    private:
+        TERTCallback _callback;
+        void *_context;
+        TRDSERTMessage3 _format;
+        uint8_t _buffer[RDS_ERT_BUFFER_SIZE];
+        uint32_t _received;
+        byte _end;
+        char _text[RDS_ERT_TEXT_MAX + 1];
+        size_t _length;
+        bool _published;
+
+        /*
+        * Description:
+        *   Drops the segments received so far.
+        */
+        void restart(void);
+
+        /*
+        * Description:
+        *   Converts the buffer up to the end of the message into normalized
+        *   UTF-8 in text (RDS_ERT_TEXT_MAX + 1 bytes).
+        * Returns:
+        *   the length of the text.
+        */
+        size_t normalize(char *text);
+};
+
+#endif
+#endif
@@ -0,0 +1,76 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This is the code file for the pager address filter.
+ * See the header file for better function documentation.
+ */
+
+#include "PagerAddressFilter.h"
+
+#include <string.h>
+
+PagerAddressFilter::PagerAddressFilter(uint8_t bits[], uint32_t size) {
+    _bits = bits;
+    _size = size;
+    clear();
+};
+
+void PagerAddressFilter::clear(void) {
+    if(_bits)
+        memset(_bits, 0x00, _size);
+    memset(_groups, 0x00, sizeof(_groups));
+};
+
+uint32_t PagerAddressFilter::bitIndex(byte groupCode, word individualCode) {
+    uint32_t key = ((uint32_t)groupCode << 16) | individualCode;
+
+    if(_size >= RDS_PAGING_FILTER_EXACT_SIZE)
+        return key;
+    //Multiplicative hashing spreads the (mostly BCD, hence clustered)
+    //addresses over the smaller bitset. Only the high bits of the product
+    //depend on every bit of the address, so it is scaled down to the number
+    //of bits rather than reduced modulo it.
+    key *= 2654435761UL;
+    return (uint32_t)(((uint64_t)key * (_size * 8)) >> 32);
+};
+
+void PagerAddressFilter::add(byte groupCode, word individualCode) {
+    uint32_t index;
+
+    if(!(_bits && _size))
+        return;
+    index = bitIndex(groupCode, individualCode);
+    _bits[index >> 3] |= 0x01 << (index & 0x07);
+};
+
+void PagerAddressFilter::addGroup(byte groupCode) {
+    _groups[groupCode >> 3] |= 0x01 << (groupCode & 0x07);
+};
+
+bool PagerAddressFilter::matches(byte groupCode, word individualCode) {
+    uint32_t index;
+
+    if(_groups[groupCode >> 3] & (0x01 << (groupCode & 0x07)))
+        return true;
+    if(!(_bits && _size))
+        return false;
+    index = bitIndex(groupCode, individualCode);
+
+    return (bool)(_bits[index >> 3] & (0x01 << (index & 0x07)));
+};
+
+bool PagerAddressFilter::matchesHeader(word blockC, word blockD,
+                                       TRDSPage *header) {
+    TRDSPage unpacked;
+
+    if(!header)
+        header = &unpacked;
+    _translator.unpackPageHeader(blockC, blockD, header);
+
+    return matches(header->groupCode, header->individualCode);
+};
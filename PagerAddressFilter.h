@@ -0,0 +1,87 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This file contains the pager address filter, which tells from the header
+ * of a page alone whether it is addressed to one of a set of receivers.
+ */
+
+#ifndef _PAGERADDRESSFILTER_H_INCLUDED
+#define _PAGERADDRESSFILTER_H_INCLUDED
+
+#include "RDSDecoder.h"
+
+//Number of distinct addresses: an 8 bit group code and a 16 bit individual
+//code (their BCD forms, 00-99 and 0000-9999, are a subset).
+#define RDS_PAGING_FILTER_KEYS (1UL << 24)
+//Size in bytes of a bitset holding all of them exactly (2 MiB).
+#define RDS_PAGING_FILTER_EXACT_SIZE (RDS_PAGING_FILTER_KEYS / 8)
+
+class PagerAddressFilter
+{
+    public:
+        /*
+        * Description:
+        *   Constructor, sets up an empty filter over a caller-provided bitset.
+        *   With RDS_PAGING_FILTER_EXACT_SIZE bytes the filter is exact; a
+        *   smaller bitset holds the addresses hashed, so a page may match
+        *   because it collides with a subscribed address (but a subscribed
+        *   address always matches).
+        * Parameters:
+        *   bits - an array of size bytes holding the bitset.
+        *   size - number of bytes in bits, non-zero.
+        */
+        PagerAddressFilter(uint8_t bits[], uint32_t size);
+
+        /*
+        * Description:
+        *   Subscribe to the pages of one receiver, or to all the pages of a
+        *   group of receivers. Codes are as unpacked in TRDSPage.
+        */
+        void add(byte groupCode, word individualCode);
+        void addGroup(byte groupCode);
+
+        /*
+        * Description:
+        *   Tells whether a receiver or group is subscribed to.
+        */
+        bool matches(byte groupCode, word individualCode);
+
+        /*
+        * Description:
+        *   Checks the header of a page, i.e. blocks C and D of its first
+        *   Group 7A, so that pages for other receivers can be skipped before
+        *   the rest of their groups are collected and decoded.
+        * Parameters:
+        *   blockC, blockD - blocks C and D of the first group of the page.
+        *   header - pointer to a TRDSPage struct that will receive the
+        *            unpacked header, may be NULL.
+        * Returns:
+        *   true if the page is addressed to a subscribed receiver or group.
+        */
+        bool matchesHeader(word blockC, word blockD, TRDSPage *header = NULL);
+
+        /*
+        * Description:
+        *   Unsubscribes from everything.
+        */
+        void clear(void);
+
+    private:
+        RDSTranslator _translator;
+        uint8_t *_bits;
+        uint32_t _size;
+        uint8_t _groups[256 / 8];
+
+        /*
+        * Description:
+        *   Maps an address to its bit index in _bits.
+        */
+        uint32_t bitIndex(byte groupCode, word individualCode);
+};
+
+#endif
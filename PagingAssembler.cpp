@@ -0,0 +1,174 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This is the code file for the paging reassembly engine.
+ * See the header file for better function documentation.
+ */
+
+#include "PagingAssembler.h"
+#include "RDSDecoder-private.h"
+
+PagingAssembler::PagingAssembler(TRDSRawData groups[], byte capacity,
+                                 char *text, size_t textSize,
+                                 TPagingCallback callback, void *context) {
+    _groups = groups;
+    _capacity = capacity;
+    _text = text;
+    _textSize = textSize;
+    _dropped = 0;
+    _invalid = 0;
+    _filter = NULL;
+    _notificationCallback = NULL;
+    registerCallback(callback, context);
+    reset();
+};
+
+void PagingAssembler::registerCallback(TPagingCallback callback,
+                                       void *context) {
+    _callback = callback;
+    _context = context;
+};
+
+void PagingAssembler::registerNotificationCallback(
+    TPagingNotificationCallback callback) {
+    _notificationCallback = callback;
+};
+
+void PagingAssembler::reset(void) {
+    _count = 0;
+    _expected = 0;
+    _next = RDS_PAGING_SEGMENT_NOMESSAGE;
+    _ab = false;
+};
+
+void PagingAssembler::dropPage(void) {
+    if(_count)
+        _dropped++;
+    _count = 0;
+};
+
+void PagingAssembler::dropInvalidPage(void) {
+    TRDSPage page;
+
+    if(_callback) {
+        //Only for the address, what was collected is not worth decoding.
+        _translator.unpackRDSPage(_groups, _count, &page, NULL, 0);
+        page.pageType = RDS_PAGING_INVALID;
+        page.pageMessage = NULL;
+        _callback(_context, &page);
+    };
+    _invalid++;
+    dropPage();
+};
+
+byte PagingAssembler::nextSegment(byte segment) {
+    switch(segment) {
+        case RDS_PAGING_SEGMENT_FUNCTION_1:
+        case RDS_PAGING_SEGMENT_10DIGIT_1:
+            return RDS_PAGING_SEGMENT_10DIGIT_2;
+        case RDS_PAGING_SEGMENT_18DIGIT_1:
+        case RDS_PAGING_SEGMENT_15DIGIT_1:
+            return RDS_PAGING_SEGMENT_18DIGIT_2;
+        case RDS_PAGING_SEGMENT_18DIGIT_2:
+            return RDS_PAGING_SEGMENT_18DIGIT_3;
+        case RDS_PAGING_SEGMENT_ALPHA_1:
+        case RDS_PAGING_SEGMENT_ALPHA_2:
+        case RDS_PAGING_SEGMENT_ALPHA_3:
+        case RDS_PAGING_SEGMENT_ALPHA_4:
+        case RDS_PAGING_SEGMENT_ALPHA_5:
+        case RDS_PAGING_SEGMENT_ALPHA_6:
+            return segment + 1;
+        case RDS_PAGING_SEGMENT_ALPHA_7:
+            //Long pages cycle through the same six codes.
+            return RDS_PAGING_SEGMENT_ALPHA_2;
+        default:
+            return RDS_PAGING_SEGMENT_NOMESSAGE;
+    };
+};
+
+void PagingAssembler::emitPage(void) {
+    TRDSPage page;
+
+    if(_callback) {
+        _translator.unpackRDSPage(_groups, _count, &page, _text, _textSize);
+        _callback(_context, &page);
+    };
+    _count = 0;
+};
+
+void PagingAssembler::decodePagingGroup(byte pagingBits, word blockC,
+                                        word blockD) {
+    bool ab = (bool)(pagingBits & RDS_PAGING_AB);
+    byte segment = pagingBits & RDS_PAGING_SEGMENT_MASK;
+    byte expected = 0;
+    bool first = true;
+
+    if(ab != _ab) {
+        //The flag flips between pages: whatever was in progress is over.
+        dropPage();
+        _ab = ab;
+    };
+
+    switch(segment) {
+        case RDS_PAGING_SEGMENT_NOMESSAGE:
+            expected = 1;
+            break;
+        case RDS_PAGING_SEGMENT_FUNCTION_1:
+        case RDS_PAGING_SEGMENT_10DIGIT_1:
+            expected = 2;
+            break;
+        case RDS_PAGING_SEGMENT_18DIGIT_1:
+        case RDS_PAGING_SEGMENT_15DIGIT_1:
+            expected = 3;
+            break;
+        case RDS_PAGING_SEGMENT_ALPHA_1:
+            break;
+        default:
+            first = false;
+    };
+
+    if(first) {
+        dropPage();
+        //Not for us: the rest of the page is ignored as if its start was
+        //missed.
+        if(_filter && !_filter->matchesHeader(blockC, blockD))
+            return;
+        _expected = expected;
+    } else if(!_count)
+        //The start of this page was missed.
+        return;
+    else if(segment != _next &&
+            !(segment == RDS_PAGING_SEGMENT_ALPHA_LAST && !_expected)) {
+        dropInvalidPage();
+        return;
+    };
+    if(_count >= _capacity) {
+        dropPage();
+        return;
+    };
+
+    _groups[_count].fiveBits = pagingBits;
+    _groups[_count].blockC = blockC;
+    _groups[_count].blockD = blockD;
+    _count++;
+    _next = nextSegment(segment);
+
+    if(_expected ? _count == _expected :
+                   segment == RDS_PAGING_SEGMENT_ALPHA_LAST)
+        emitPage();
+};
+
+void PagingAssembler::decodeEnhancedPagingGroup(byte ePbits1, word ePbits2,
+                                                word ePbits3) {
+    TRDSPagingMessage13 unpacked;
+
+    if(!_notificationCallback)
+        return;
+    _translator.unpackPagingMessage13(ePbits1, ePbits2, ePbits3, &unpacked);
+    _notificationCallback(_context, &unpacked);
+};
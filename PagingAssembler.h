@@ -0,0 +1,160 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This file contains the paging reassembly engine, which collects the Group
+ * 7A segments of each page and hands out decoded pages.
+ */
+
+#ifndef _PAGINGASSEMBLER_H_INCLUDED
+#define _PAGINGASSEMBLER_H_INCLUDED
+
+#include "RDSDecoder.h"
+#include "PagerAddressFilter.h"
+
+//Paging Assembler callback prototypes.
+//The first parameter is the context pointer given at registration time, the
+//second points to the decoded page (whose pageMessage is in the text buffer
+//given at construction time) or to the unpacked Group 13A enhanced paging
+//information, which are only valid for the duration of the call.
+typedef void (*TPagingCallback)(void *, const TRDSPage *);
+typedef void (*TPagingNotificationCallback)(void *,
+                                            const TRDSPagingMessage13 *);
+
+class PagingAssembler
+{
+    public:
+        /*
+        * Description:
+        *   Constructor, sets up the assembler over caller-provided storage
+        *   which is reused for every page, so nothing is ever allocated.
+        * Parameters:
+        *   groups - an array of capacity TRDSRawData structs which will hold
+        *            the groups of the page being received. An 80 character
+        *            alphanumeric page takes 21 groups, 22 if international.
+        *   capacity - number of elements in groups; longer pages are dropped.
+        *   text - a character buffer that will receive the page messages.
+        *   textSize - size of text, longer messages are truncated.
+        *   callback - the function to call for every complete page, and for
+        *              every page whose segments came out of sequence, with
+        *              pageType RDS_PAGING_INVALID and only the address.
+        *   context - an opaque pointer handed back to the callbacks.
+        */
+        PagingAssembler(TRDSRawData groups[], byte capacity, char *text,
+                        size_t textSize, TPagingCallback callback = NULL,
+                        void *context = NULL);
+
+        /*
+        * Description:
+        *   Register the callbacks that will receive complete pages and
+        *   enhanced paging information. Using NULL removes the current
+        *   callback, if any.
+        */
+        void registerCallback(TPagingCallback callback = NULL,
+                              void *context = NULL);
+        void registerNotificationCallback(
+            TPagingNotificationCallback callback = NULL);
+
+        /*
+        * Description:
+        *   Sets the filter deciding from their first group which pages are
+        *   wanted, the others being skipped without collecting them. Using
+        *   NULL (the default) accepts all pages.
+        */
+        void setFilter(PagerAddressFilter *filter = NULL) { _filter = filter; }
+
+        /*
+        * Description:
+        *   Feeds one Group 7A, with the arguments of an RDS_CALLBACK_P7
+        *   callback. A page starts with one of the first segment codes and
+        *   ends once all the segments of its type are in: 2 groups for
+        *   function and 10 digit pages, 3 for 15 and 18 digit pages and up to
+        *   the last segment code for alphanumeric (and enhanced) pages. A
+        *   flip of the Paging A/B flag or a new first segment before that
+        *   means groups were lost: the incomplete page is dropped. A segment
+        *   other than the next one of the page (the second and third digit
+        *   segment codes, or the alphanumeric ones cycling through
+        *   RDS_PAGING_SEGMENT_ALPHA_2 to RDS_PAGING_SEGMENT_ALPHA_7) drops
+        *   it too, and is reported as an invalid page.
+        * Parameters:
+        *   pagingBits - the Paging A/B flag and segment address.
+        *   blockC, blockD - blocks C and D of the group.
+        */
+        void decodePagingGroup(byte pagingBits, word blockC, word blockD);
+
+        /*
+        * Description:
+        *   Feeds one Group 13A, with the arguments of an RDS_CALLBACK_P13
+        *   callback. It carries no page text, only the enhanced paging
+        *   information, which goes to the notification callback.
+        */
+        void decodeEnhancedPagingGroup(byte ePbits1, word ePbits2,
+                                       word ePbits3);
+
+        /*
+        * Description:
+        *   Return the number of incomplete or too long pages dropped and,
+        *   among those, of the ones reported as invalid.
+        */
+        word getDropped(void) { return _dropped; }
+        word getInvalid(void) { return _invalid; }
+
+        /*
+        * Description:
+        *   Drops the page being received, use when switching to a new
+        *   station.
+        */
+        void reset(void);
+
+    private:
+        RDSTranslator _translator;
+        TRDSRawData *_groups;
+        byte _capacity;
+        byte _count;
+        //Number of groups the page takes, 0 if it ends at the last segment.
+        byte _expected;
+        //The segment code the next group of the page must have.
+        byte _next;
+        bool _ab;
+        char *_text;
+        size_t _textSize;
+        word _dropped;
+        word _invalid;
+        PagerAddressFilter *_filter;
+        TPagingCallback _callback;
+        TPagingNotificationCallback _notificationCallback;
+        void *_context;
+
+        /*
+        * Description:
+        *   Decodes the page collected and hands it to the callback.
+        */
+        void emitPage(void);
+
+        /*
+        * Description:
+        *   Forgets the page being received, counting it as dropped if it was
+        *   started.
+        */
+        void dropPage(void);
+
+        /*
+        * Description:
+        *   Reports the page being received as invalid to the callback, then
+        *   drops it.
+        */
+        void dropInvalidPage(void);
+
+        /*
+        * Description:
+        *   Returns the segment code that follows the given one within a
+        *   page, RDS_PAGING_SEGMENT_NOMESSAGE if none may.
+        */
+        static byte nextSegment(byte segment);
+};
+
+#endif
@@ -82,6 +82,21 @@
 #define RDS_AID_IRDS 0xC563
 #define RDS_AID_TMC 0xCD46 // 0xCD47 also seen in the wild
 #define RDS_ODA_GROUP_MASK 0x1F
+#define RDS_ODA_GROUP_NONE 0x00
+#define RDS_ODA_GROUP_FAULT 0x1F
+#define RDS_ODA_ROUTE_NONE 0xFF
+#define RDS_ODA_ROUTE_CALLBACK 0x80
+
+//Define DAB cross-referencing ODA (AID 0x0093) decoding masks
+#define RDS_DAB_ES word(0x0010)
+#define RDS_DAB_MODE_MASK word(0x000C)
+#define RDS_DAB_MODE_SHR 2
+#define RDS_DAB_FREQUENCY_MASK word(0x0003)
+#define RDS_DAB_FREQUENCY_SHL 16
+#define RDS_DAB_FREQUENCY_STEP 16
+#define RDS_DAB_VARIANT_MASK word(0x000F)
+#define RDS_DAB_VARIANT_ENSEMBLE 0x0
+#define RDS_DAB_VARIANT_LINKAGE 0x1
 
 //Define RDS TMC Message (group 3A) decoding masks
 #define RDS_TMC_MESSAGE_VARIANT_MASK 0xC000
@@ -216,6 +231,10 @@
 #define RDS_EON_TYPE_PTYTA 0x0D
 #define RDS_EON_TYPE_PIN 0x0E
 #define RDS_EON_TYPE_INHOUSE 0x0F
+#define RDS_LINKAGE_LA word(0x8000)
+#define RDS_LINKAGE_EG word(0x4000)
+#define RDS_LINKAGE_ILS word(0x2000)
+#define RDS_LINKAGE_LSN_MASK word(0x0FFF)
 
 //Define RDS Enhanced Paging (group 13A) values and decoding masks
 #define RDS_PAGING_CS_MASK word(0x0018)
@@ -36,6 +36,7 @@
 #  define PROGMEM
 #  define PGM_P const char *
 #  define strncpy_P strncpy
+#  define memcpy_P memcpy
 #  define snprintf_P snprintf
 #  define lowByte(x) (uint8_t)((x) & 0xFF)
 #  define highByte(x) (uint8_t)(((x) >> 8) & 0xFF)
@@ -52,13 +53,93 @@ void RDSDecoder::registerCallback(byte type, TRDSCallback callback){
         _callbacks[type] = callback;
 };
 
-void RDSDecoder::decodeRDSGroup(word block[]){
+void RDSDecoder::registerEONHandler(TRDSEONHandler handler, void *context){
+    _eonHandler = handler;
+    _eonContext = context;
+};
+
+bool RDSDecoder::registerODAHandler(word AID, TRDSODAHandler handler,
+                                    void *context, byte stream){
+    byte slot = RDS_ODA_HANDLERS;
+
+    if (stream >= RDS_STREAMS)
+        return false;
+    for(byte i = 0; i < RDS_ODA_HANDLERS; i++)
+        if (_odaHandlers[i].handler && _odaHandlers[i].AID == AID &&
+            _odaHandlers[i].stream == stream) {
+            slot = i;
+            break;
+        } else if (!_odaHandlers[i].handler && slot == RDS_ODA_HANDLERS)
+            slot = i;
+    if (slot == RDS_ODA_HANDLERS)
+        return handler == NULL;
+
+    if (!handler)
+        //Its group types carry nothing we know of until announced again.
+        for(byte i = 0; i < sizeof(_odaRoutes[stream]); i++)
+            if (_odaRoutes[stream][i] == slot)
+                _odaRoutes[stream][i] = RDS_ODA_ROUTE_NONE;
+    _odaHandlers[slot].AID = AID;
+    _odaHandlers[slot].stream = stream;
+    _odaHandlers[slot].handler = handler;
+    _odaHandlers[slot].context = context;
+
+    return true;
+};
+
+void RDSDecoder::announceODA(word block[], byte stream, byte route){
+    byte group = block[1] & RDS_ODA_GROUP_MASK;
+
+    for(byte i = 0; i < RDS_ODA_HANDLERS; i++)
+        if (_odaHandlers[i].handler && _odaHandlers[i].AID == block[3] &&
+            _odaHandlers[i].stream == stream) {
+            route = i;
+            _odaHandlers[i].handler(_odaHandlers[i].context, group, false,
+                                    block[2], block[3]);
+            break;
+        };
+    //Remember which application the group type carries, so that its groups
+    //are dispatched without looking at the AIDs again.
+    if (route != RDS_ODA_ROUTE_NONE && group != RDS_ODA_GROUP_NONE &&
+        group != RDS_ODA_GROUP_FAULT)
+        _odaRoutes[stream][group] = route;
+};
+
+void RDSDecoder::dispatchODA(word block[], byte stream, byte grouptype){
+    byte route = _odaRoutes[stream][grouptype];
+
+    if (route == RDS_ODA_ROUTE_NONE)
+        return;
+    if (route & RDS_ODA_ROUTE_CALLBACK) {
+        if (_callbacks[route & ~RDS_ODA_ROUTE_CALLBACK])
+            _callbacks[route & ~RDS_ODA_ROUTE_CALLBACK](
+                block[1] & RDS_ODA_GROUP_MASK, true, block[2], block[3]);
+    } else
+        _odaHandlers[route].handler(_odaHandlers[route].context,
+                                    block[1] & RDS_ODA_GROUP_MASK, true,
+                                    block[2], block[3]);
+};
+
+void RDSDecoder::decodeRDSGroup(word block[], byte stream){
     byte grouptype;
     word fourchars[2];
     bool pagingCallback = false;
+    byte route;
 
-    _status.programIdentifier = block[0];
+    if (stream >= RDS_STREAMS)
+        return;
     grouptype = lowByte((block[1] & RDS_TYPE_MASK) >> RDS_TYPE_SHR);
+    if (stream) {
+        //The upper RDS2 streams only carry ODAs, of the station tuned in on
+        //stream 0: block A and the basic tuning fields are left alone.
+        if (grouptype == RDS_GROUP_3A)
+            announceODA(block, stream, RDS_ODA_ROUTE_NONE);
+        else
+            dispatchODA(block, stream, grouptype);
+        return;
+    };
+
+    _status.programIdentifier = block[0];
     _status.TP = (bool)(block[1] & RDS_TP);
     _status.PTY = lowByte((block[1] & RDS_PTY_MASK) >> RDS_PTY_SHR);
 
@@ -154,6 +235,7 @@ void RDSDecoder::decodeRDSGroup(word block[]){
             strncpy(&_status.radioText[RTA * RTAW], (char *)fourchars, RTAW);
             break;
         case RDS_GROUP_3A:
+            route = RDS_ODA_ROUTE_NONE;
             switch(block[3]){
                 case RDS_AID_DEFAULT:
                     if ((block[1] & RDS_ODA_GROUP_MASK) == RDS_GROUP_8A) {
@@ -161,15 +243,18 @@ void RDSDecoder::decodeRDSGroup(word block[]){
                       //explicit mapping of TMC's AID to Group 8A.
                       _status.TMC.carriedInGroup = RDS_GROUP_8A;
                       _status.TMC.message = block[2];
+                      route = RDS_CALLBACK_TMC | RDS_ODA_ROUTE_CALLBACK;
                     };
                     break;
                 case RDS_AID_ERT:
                     _status.ERT.carriedInGroup = block[1] & RDS_ODA_GROUP_MASK;
                     _status.ERT.message = block[2];
+                    route = RDS_CALLBACK_ERT | RDS_ODA_ROUTE_CALLBACK;
                     break;
                 case RDS_AID_RTPLUS:
                     _status.RTP.carriedInGroup = block[1] & RDS_ODA_GROUP_MASK;
                     _status.RTP.message = block[2];
+                    route = RDS_CALLBACK_RTP | RDS_ODA_ROUTE_CALLBACK;
                     break;
                 case RDS_AID_IRDS:
                     _status.IRDS.carriedInGroup = block[1] & RDS_ODA_GROUP_MASK;
@@ -178,8 +263,10 @@ void RDSDecoder::decodeRDSGroup(word block[]){
                 case RDS_AID_TMC:
                     _status.TMC.carriedInGroup = block[1] & RDS_ODA_GROUP_MASK;
                     _status.TMC.message = block[2];
+                    route = RDS_CALLBACK_TMC | RDS_ODA_ROUTE_CALLBACK;
                     break;
             };
+            announceODA(block, 0, route);
             if (_callbacks[RDS_CALLBACK_AID])
                 _callbacks[RDS_CALLBACK_AID](block[1] & RDS_ODA_GROUP_MASK,
                                              true, block[2], block[3]);
@@ -199,21 +286,7 @@ void RDSDecoder::decodeRDSGroup(word block[]){
         case RDS_GROUP_12A:
         case RDS_GROUP_12B:
         case RDS_GROUP_13B:
-            if(grouptype == _status.TMC.carriedInGroup)
-                if (_callbacks[RDS_CALLBACK_TMC])
-                    _callbacks[RDS_CALLBACK_TMC](
-                        block[1] & RDS_ODA_GROUP_MASK, true, block[2],
-                        block[3]);
-            else if(grouptype == _status.RTP.carriedInGroup)
-                if (_callbacks[RDS_CALLBACK_RTP])
-                    _callbacks[RDS_CALLBACK_RTP](
-                        block[1] & RDS_ODA_GROUP_MASK, true, block[2],
-                        block[3]);
-            else if(grouptype == _status.ERT.carriedInGroup)
-                if (_callbacks[RDS_CALLBACK_ERT])
-                    _callbacks[RDS_CALLBACK_ERT](
-                        block[1] & RDS_ODA_GROUP_MASK, true, block[2],
-                        block[3]);
+            dispatchODA(block, 0, grouptype);
             break;
         case RDS_GROUP_4A:
             unsigned long MJD, CT, ys;
@@ -279,6 +352,21 @@ void RDSDecoder::decodeRDSGroup(word block[]){
                     block[1] & RDS_ODA_GROUP_MASK, true, block[2], block[3]);
             break;
         case RDS_GROUP_14A:
+        case RDS_GROUP_14B:
+            if (_eonHandler)
+                _eonHandler(_eonContext, block);
+            if (block[3] != _status.EON.programIdentifier) {
+                //Another network: don't mix its data with the previous one's.
+                memset(&_status.EON, 0x00, sizeof(_status.EON));
+                _status.EON.programIdentifier = block[3];
+            };
+            _status.EON.TP = block[1] & RDS_EON_TP;
+            if (grouptype == RDS_GROUP_14B) {
+                _status.EON.TA = block[1] & RDS_EON_TA_B;
+                _status.EON.PTY = RDSTranslator(_locale).mapShortPTY(
+                    (block[1] & RDS_EON_PTY_B_MASK) >> RDS_EON_PTY_B_SHR);
+                break;
+            };
             switch(block[1] & RDS_EON_MASK){
                 case RDS_EON_TYPE_PS_SA0:
                 case RDS_EON_TYPE_PS_SA1:
@@ -306,8 +394,8 @@ void RDSDecoder::decodeRDSGroup(word block[]){
                         _callbacks[RDS_CALLBACK_EON](3, true, block[2], 0x00);
                     break;
                 case RDS_EON_TYPE_LINKAGE:
-                    memcpy(&_status.EON.linkageInformation, &block[2],
-                           sizeof(_status.EON.linkageInformation));
+                    RDSTranslator(_locale).unpackLinkageInformation(
+                        block[2], &_status.EON.linkageInformation);
                     break;
                 case RDS_EON_TYPE_PTYTA:
                     _status.EON.PTY = (block[2] & RDS_EON_PTY_A_MASK) >>
@@ -318,13 +406,6 @@ void RDSDecoder::decodeRDSGroup(word block[]){
                     _status.EON.programItemNumber = block[2];
                     break;
             };
-        case RDS_GROUP_14B:
-            _status.EON.TP = block[1] & RDS_EON_TP;
-            _status.EON.programIdentifier = block[3];
-            if (grouptype == RDS_GROUP_14B)
-                _status.EON.TA = block[1] & RDS_EON_TA_B;
-                _status.EON.PTY = mapShortPTY(
-                    (block[1] & RDS_EON_PTY_B_MASK) >> RDS_EON_PTY_B_SHR);
             break;
         case RDS_GROUP_15A:
             //Withdrawn and currently unallocated, ignore
@@ -355,6 +436,9 @@ void RDSDecoder::resetRDS(void){
     _rdstextab = false;
     _rdsptynab = false;
     _havect = false;
+    memset(_odaRoutes, RDS_ODA_ROUTE_NONE, sizeof(_odaRoutes));
+    if (_eonHandler)
+        _eonHandler(_eonContext, NULL);
 }
 
 const char PROGMEM RDS2LCD_S[] = "\xE1\xE0\xE9\xE8\xED\xEE\xF3\xF2\xFA\xF9\xD1"
@@ -414,13 +498,13 @@ void RDSDecoder::makePrintable(char* str){
 
 RDSDecoder::RDSDecoder(byte locale) {
     _locale = locale;
+    _eonHandler = NULL;
+    _eonContext = NULL;
+    memset(_odaHandlers, 0x00, sizeof(_odaHandlers));
     resetRDS();
 }
 
-byte RDSDecoder::mapShortPTY(byte shortPTY) {
-    if(!shortPTY)
-        return 0; // PTY of None/Undefined
-
+byte RDSTranslator::mapShortPTY(byte shortPTY) {
     switch(shortPTY) {
         case RDS_EON_PTY_B_NEWS:
             return 1; // PTY of News
@@ -432,6 +516,8 @@ byte RDSDecoder::mapShortPTY(byte shortPTY) {
             return 31; // PTY of Alarm
             break;
     };
+
+    return 0; // PTY of None/Undefined
 };
 
 const char PTY2Text_S_None[] PROGMEM = "None";
@@ -686,6 +772,18 @@ int16_t RDSTranslator::decodeTZValue(int8_t tz) {
     return (tz / 2) * 60 + (tz % 2) * 30;
 };
 
+void RDSTranslator::unpackLinkageInformation(
+    word linkage, TRDSLinkageInformation *unpacked) {
+    if(!unpacked) return;
+    //Clears the unused bit too, so that unpacked structs compare equal.
+    else memset(unpacked, 0x00, sizeof(TRDSLinkageInformation));
+
+    unpacked->linkageActuator = (bool)(linkage & RDS_LINKAGE_LA);
+    unpacked->extendedGeneric = (bool)(linkage & RDS_LINKAGE_EG);
+    unpacked->internationalLinkageSet = (bool)(linkage & RDS_LINKAGE_ILS);
+    unpacked->linkageSet = linkage & RDS_LINKAGE_LSN_MASK;
+};
+
 void RDSTranslator::unpackTMCMessage3(word tmcMessage,
                                       TRDSTMCMessage3 *unpacked) {
     if(!unpacked) return;
@@ -884,50 +982,57 @@ void RDSTranslator::glueTMCContainerSlices(uint32_t slices[4]) {
     slices[3] <<= 16;
 };
 
+//Argument size of each TMC label, ISO 14819-1 §5.5.1. Label 15 has an
+//undefined size, which makes it the end of the container.
+const uint8_t TMCLabelSize_S[16] PROGMEM = {3, 3, 5, 5, 5, 8, 8, 8, 8, 11, 16,
+                                            16, 16, 16, 0, 0};
+
+//Converts a container read pointer to the number of bits already read.
+static byte getContainerPosition(const TRDSTMCContainerIndex *fp) {
+    if(fp->sliceIndex == 6)
+        return 128;
+    if(!(fp->bitIndex || fp->sliceIndex))
+        return 0;
+
+    return ((fp->sliceIndex - 1) << 5) + 31 - fp->bitIndex;
+};
+
+static void setContainerPosition(TRDSTMCContainerIndex *fp, byte position) {
+    if(position >= 128)
+        //Simulate EOF.
+        fp->sliceIndex = 6;
+    else {
+        fp->sliceIndex = (position >> 5) + 1;
+        fp->bitIndex = 31 - (position & 0x1F);
+    };
+};
+
+//Returns size (at most 32) bits starting at position (less than 128), past the
+//end of the container zeros are read, which matches its padding.
+static uint32_t peekContainer(const uint32_t slices[4], byte position,
+                              byte size) {
+    byte slice = position >> 5;
+    uint64_t window = ((uint64_t)slices[slice] << 32) |
+                      (slice < 3 ? slices[slice + 1] : 0);
+
+    //Two shifts so that a size of zero does not shift by 64.
+    return ((window << (position & 0x1F)) >> (63 - size)) >> 1;
+};
+
 word RDSTranslator::readFromTMCContainer(const uint32_t slices[4],
                                          TRDSTMCContainerIndex *fp, byte size) {
+    byte position;
+    word result;
+
     if(!fp || size > 16)
         return 0x0000;
     //Enforce order of evaluation
     if(fp->sliceIndex == 6)
         return 0x0000;
-    if(!(fp->bitIndex || fp->sliceIndex)) {
-        //First call, set pointer to start of container
-        fp->bitIndex = 31;
-        fp->sliceIndex = 1;
-    };
 
-    uint16_t result = 0x0000;
-
-    if(size > fp->bitIndex + 1) {
-        //Split fetch
-        result = slices[fp->sliceIndex - 1] & ((1U << fp->bitIndex) - 1);
-        result <<= size - (fp->bitIndex + 1);
-        if(fp->sliceIndex < 4) {
-            fp->sliceIndex++;
-            result |= (((1U << (size - fp->bitIndex)) - 1) <<
-                      (31 - (size - fp->bitIndex) + 1)) &
-                      slices[fp->sliceIndex - 1];
-            fp->bitIndex = 31 - (size - fp->bitIndex);
-        } else
-            //Simulate EOF.
-            fp->sliceIndex = 6;
-    } else {
-        //Single fetch
-        result = slices[fp->sliceIndex - 1] >> (fp->bitIndex - size + 1);
-        result &= (1U << size) - 1;
-        if(size == fp->bitIndex + 1) {
-            if(fp->sliceIndex < 4) {
-                //We read the last bit from the slice, moving on to the next.
-                fp->bitIndex = 31;
-                fp->sliceIndex++;
-            } else {
-                //Simulate EOF.
-                fp->sliceIndex = 6;
-            };
-        } else
-            fp->bitIndex -= size;
-    };
+    position = getContainerPosition(fp);
+    result = peekContainer(slices, position, size);
+    setContainerPosition(fp, position + size);
 
     return result;
 };
@@ -935,203 +1040,501 @@ word RDSTranslator::readFromTMCContainer(const uint32_t slices[4],
 bool RDSTranslator::readNextTMCLabel(const uint32_t slices[4],
                                      TRDSTMCContainerIndex *fp,
                                      TRDSTMCLabel *label) {
-    if(!(fp || label))
+    byte position, size;
+    uint32_t bits;
+
+    if(!(fp && label))
         return false;
     //Enforce order of evaluation
     if(fp->sliceIndex == 6)
         //Container at EOF.
         return false;
 
-    label->type = readFromTMCContainer(slices, fp, 4);
-    switch(label->type) {
-      case RDS_TMC_LABEL_RESERVED2:
+    //Fetch the label and the largest possible argument at once.
+    position = getContainerPosition(fp);
+    bits = peekContainer(slices, position, 20);
+    label->type = bits >> 16;
+    size = pgm_read_byte(&TMCLabelSize_S[label->type]);
+    label->value = (bits & 0xFFFF) >> (16 - size);
+    if(label->type == RDS_TMC_LABEL_RESERVED2)
         //Label 15 has an undefined size so nothing can exist beyond it: fake
         //EOF status.
         fp->sliceIndex = 6;
-        break;
-      case RDS_TMC_LABEL_SEPARATOR:
-        //Label 14 has a size of zero.
-        break;
-      case RDS_TMC_LABEL_DURATION:
-      case RDS_TMC_LABEL_CONTROL:
-        label->value = readFromTMCContainer(slices, fp, 3);
-        if(label->type == RDS_TMC_LABEL_DURATION && !label->value) {
-            //Label 0 cannot have an argument of 0, if we see that (i.e. 7
-            //consecutive zero bits), the end of the container was where the
-            //last read ended.
-            fp->sliceIndex = 6;
-            return false;
-        };
-        break;
-      case RDS_TMC_LABEL_LENGTH:
-      case RDS_TMC_LABEL_SPEED:
-      case RDS_TMC_LABEL_QUANTIFIER_5:
-        label->value = readFromTMCContainer(slices, fp, 5);
-        break;
-      case RDS_TMC_LABEL_QUANTIFIER_8:
-      case RDS_TMC_LABEL_SUPPLEMENTARY:
-      case RDS_TMC_LABEL_START:
-      case RDS_TMC_LABEL_STOP:
-        label->value = readFromTMCContainer(slices, fp, 8);
-        break;
-      case RDS_TMC_LABEL_ADDITIONAL:
-        label->value = readFromTMCContainer(slices, fp, 11);
-        break;
-      case RDS_TMC_LABEL_DIVERSION:
-      case RDS_TMC_LABEL_DESTINATION:
-      case RDS_TMC_LABEL_RESERVED1:
-      case RDS_TMC_LABEL_XREF:
-        label->value = readFromTMCContainer(slices, fp, 16);
-        break;
+    else
+        setContainerPosition(fp, position + 4 + size);
+    if(label->type == RDS_TMC_LABEL_DURATION && !label->value) {
+        //Label 0 cannot have an argument of 0, if we see that (i.e. 7
+        //consecutive zero bits), the end of the container was where the
+        //last read ended.
+        fp->sliceIndex = 6;
+        return false;
     };
 
     return true;
 };
 
-const char QuantifierText_S_0[] PROGMEM = "%" PRIu8;
-const char QuantifierText_S_1[] PROGMEM = "%" PRIu16;
-const char QuantifierText_S_2[] PROGMEM = "less than %" PRIu16 " meters";
-const char QuantifierText_S_3[] PROGMEM = "%" PRIu8 "%%";
-const char QuantifierText_S_4[] PROGMEM = "of up to %" PRIu8 " km/h";
-const char QuantifierText_S_5[] PROGMEM = "of up to %" PRIu8 " %s";
-const char QuantifierText_S_6[] PROGMEM = "%" PRIi8 " degrees Celsius";
-const char QuantifierText_S_7[] PROGMEM = "%02" PRIu8 ":%02" PRIu8;
-const char QuantifierText_S_8[] PROGMEM = "%2.1f tonnes";
-const char QuantifierText_S_9[] PROGMEM = "%2.1f meters";
-const char QuantifierText_S_A[] PROGMEM = "of up to %" PRIu8 " millimeters";
-const char QuantifierText_S_B[] PROGMEM = "%3.1f MHz";
-const char QuantifierText_S_C[] PROGMEM = "%" PRIu16 " kHz";
-
-PGM_P const QuantifierText_S[13] PROGMEM = {
-    QuantifierText_S_0,
-    QuantifierText_S_1,
-    QuantifierText_S_2,
-    QuantifierText_S_3,
-    QuantifierText_S_4,
-    QuantifierText_S_5,
-    QuantifierText_S_6,
-    QuantifierText_S_7,
-    QuantifierText_S_8,
-    QuantifierText_S_9,
-    QuantifierText_S_A,
-    QuantifierText_S_B,
-    QuantifierText_S_C
+byte RDSTranslator::decodeAllTMCLabels(const uint32_t slices[4],
+                                       TRDSTMCLabel labels[], byte max) {
+    byte count = 0, position = 0;
+
+    if(!(slices && labels))
+        return 0;
+
+    //The whole container lives in one 128-bit shift register, every label is
+    //then one peek at its top 20 bits and one shift.
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 bits = ((unsigned __int128)slices[0] << 96) |
+                             ((unsigned __int128)slices[1] << 64) |
+                             ((uint64_t)slices[2] << 32) | slices[3];
+#else
+    uint64_t high = ((uint64_t)slices[0] << 32) | slices[1];
+    uint64_t low = ((uint64_t)slices[2] << 32) | slices[3];
+#endif
+
+    while(count < max && position < 128) {
+#if defined(__SIZEOF_INT128__)
+        uint32_t peek = bits >> (128 - 20);
+#else
+        uint32_t peek = high >> (64 - 20);
+#endif
+        byte type = peek >> 16;
+        byte size = pgm_read_byte(&TMCLabelSize_S[type]);
+        word value = (peek & 0xFFFF) >> (16 - size);
+
+        if(type == RDS_TMC_LABEL_RESERVED2 ||
+           (type == RDS_TMC_LABEL_DURATION && !value))
+            //Label 15 or the zero padding: end of container.
+            break;
+        labels[count].type = type;
+        labels[count].value = value;
+        count++;
+
+        size += 4;
+        position += size;
+#if defined(__SIZEOF_INT128__)
+        bits <<= size;
+#else
+        high = (high << size) | (low >> (64 - size));
+        low <<= size;
+#endif
+    };
+
+    return count;
+};
+
+static void flashBlockFetcher(const void *source, void *destination,
+                              size_t size) {
+    memcpy_P(destination, source, size);
+};
+
+const char QuantifierText_S_LessThan[] PROGMEM = "less than ";
+const char QuantifierText_S_UpTo[] PROGMEM = "of up to ";
+const char QuantifierText_S_Meters[] PROGMEM = " meters";
+const char QuantifierText_S_Percent[] PROGMEM = "%";
+const char QuantifierText_S_KMH[] PROGMEM = " km/h";
+const char QuantifierText_S_Minutes[] PROGMEM = " minutes";
+const char QuantifierText_S_Hours[] PROGMEM = " hours";
+const char QuantifierText_S_Celsius[] PROGMEM = " degrees Celsius";
+const char QuantifierText_S_Tonnes[] PROGMEM = " tonnes";
+const char QuantifierText_S_Millimeters[] PROGMEM = " millimeters";
+const char QuantifierText_S_MHz[] PROGMEM = " MHz";
+const char QuantifierText_S_kHz[] PROGMEM = " kHz";
+const char QuantifierText_S_DecimalPoint[] PROGMEM = ".";
+
+//Indexed by RDS_TMC_QTEXT_*
+PGM_P const QuantifierTexts[RDS_TMC_QTEXTS] PROGMEM = {
+    QuantifierText_S_LessThan, QuantifierText_S_UpTo, QuantifierText_S_Meters,
+    QuantifierText_S_Percent, QuantifierText_S_KMH, QuantifierText_S_Minutes,
+    QuantifierText_S_Hours, QuantifierText_S_Celsius, QuantifierText_S_Tonnes,
+    QuantifierText_S_Millimeters, QuantifierText_S_MHz, QuantifierText_S_kHz,
+    QuantifierText_S_DecimalPoint
+};
+
+//No text around the quantifier value.
+#define QTEXT_NONE 0xFF
+
+//Appends at most count characters to the string of the given length held in
+//buf, truncating and terminating like snprintf() would. Returns the new
+//length.
+static size_t appendText(char *buf, size_t size, size_t length,
+                         const char *text, size_t count) {
+    if(length + 1 >= size)
+        return length;
+    if(count > size - 1 - length)
+        count = size - 1 - length;
+    memcpy(&buf[length], text, count);
+    buf[length + count] = '\0';
+
+    return length + count;
+};
+
+static size_t appendText_P(char *buf, size_t size, size_t length, PGM_P text) {
+    char c;
+
+    while(length + 1 < size && (c = (char)pgm_read_byte(text++)))
+        buf[length++] = c;
+    if(size)
+        buf[length < size ? length : size - 1] = '\0';
+
+    return length;
+};
+
+//Appends a decimal number with at least minDigits digits.
+static size_t appendNumber(char *buf, size_t size, size_t length,
+                           int32_t value, byte minDigits) {
+    char digits[12];
+    byte count = 0;
+    uint32_t magnitude = value < 0 ? -(uint32_t)value : value;
+
+    do {
+        digits[count++] = '0' + magnitude % 10;
+        magnitude /= 10;
+    } while(magnitude || count < minDigits);
+    if(value < 0)
+        digits[count++] = '-';
+    while(count && length + 1 < size)
+        buf[length++] = digits[--count];
+    if(size)
+        buf[length < size ? length : size - 1] = '\0';
+
+    return length;
+};
+
+//Appends one of the RDS_TMC_QTEXT_* texts, from texts if given there.
+static size_t appendQuantifierText(char *buf, size_t size, size_t length,
+                                   byte text, const char *const texts[]) {
+    if(text == QTEXT_NONE)
+        return length;
+    if(texts && texts[text])
+        return appendText(buf, size, length, texts[text],
+                          strlen(texts[text]));
+
+    return appendText_P(buf, size, length,
+                        (PGM_P)pgm_read_ptr(&QuantifierTexts[text]));
+};
+
+//Does the actual work for decodeQuantifier() and renderTMCEvent(), returns
+//the length of the text generated or 0 if the label does not fit the type.
+static size_t formatQuantifier(byte qType, const TRDSTMCLabel *label,
+                               char *buf, size_t size, word frequency,
+                               const char *const texts[]) {
+    byte prefix = QTEXT_NONE, suffix = QTEXT_NONE;
+    int32_t value = 0;
+    bool tenths = false;
+    size_t length;
+
+    if(!(label && buf && size))
+        return 0;
+    if(qType > RDS_TMC_QUANTIFIER_LAST)
+        return 0;
+    if(!(label->type == RDS_TMC_LABEL_QUANTIFIER_5 ||
+         label->type == RDS_TMC_LABEL_QUANTIFIER_8))
+        return 0;
+    //Quantifier types 0 through 5 take a 5 bit quantifier, the rest 8 bits.
+    if((label->type == RDS_TMC_LABEL_QUANTIFIER_5) !=
+       (qType <= RDS_TMC_QUANTIFIER_UPTO_MINUTES))
+        return 0;
+
+    buf[0] = '\0';
+    switch(qType) {
+        case RDS_TMC_QUANTIFIER_SMALL_NUMBER:
+            if(label->value <= 28)
+                value = (label->value ? label->value : 36);
+            else
+                value = 28 + (label->value - 28) * 2;
+            break;
+        case RDS_TMC_QUANTIFIER_NUMBER:
+            if(label->value <= 4)
+                value = (label->value ? label->value : 1000);
+            else if(label->value <= 14)
+                value = (label->value - 4) * 10;
+            else
+                value = 100 + (label->value - 14) * 50;
+            break;
+        case RDS_TMC_QUANTIFIER_LESSTHAN_METERS:
+            prefix = RDS_TMC_QTEXT_LESSTHAN;
+            suffix = RDS_TMC_QTEXT_METERS;
+            value = label->value * 10;
+            break;
+        case RDS_TMC_QUANTIFIER_PERCENT:
+            suffix = RDS_TMC_QTEXT_PERCENT;
+            value = (byte)((label->value - 1) * 5);
+            break;
+        case RDS_TMC_QUANTIFIER_UPTO_KMH:
+            prefix = RDS_TMC_QTEXT_UPTO;
+            suffix = RDS_TMC_QTEXT_KMH;
+            value = (label->value ? label->value * 5 : 160);
+            break;
+        case RDS_TMC_QUANTIFIER_UPTO_MINUTES:
+            prefix = RDS_TMC_QTEXT_UPTO;
+            if(label->value > 0 && label->value <= 10) {
+                suffix = RDS_TMC_QTEXT_MINUTES;
+                value = label->value * 5;
+            } else {
+                suffix = RDS_TMC_QTEXT_HOURS;
+                if(label->value <= 22)
+                    value = (label->value ? label->value - 10 : 72);
+                else
+                    value = 12 + (label->value - 22) * 6;
+            };
+            break;
+        case RDS_TMC_QUANTIFIER_DEGREES_CELSIUS:
+            suffix = RDS_TMC_QTEXT_CELSIUS;
+            value = label->value - 51;
+            break;
+        case RDS_TMC_QUANTIFIER_TIME:
+            //Ten minute steps starting with 1 for 00:00.
+            value = label->value ? label->value - 1 : 0;
+            length = appendNumber(buf, size, 0, value / 6, 2);
+            length = appendText(buf, size, length, ":", 1);
+            return appendNumber(buf, size, length, (value % 6) * 10, 2);
+        case RDS_TMC_QUANTIFIER_TONNES:
+        case RDS_TMC_QUANTIFIER_METERS:
+            suffix = (qType == RDS_TMC_QUANTIFIER_TONNES) ?
+                     RDS_TMC_QTEXT_TONNES : RDS_TMC_QTEXT_METERS;
+            //In tenths
+            if(label->value <= 100)
+                value = label->value;
+            else
+                value = 100 + (label->value - 100) * 5;
+            tenths = true;
+            break;
+        case RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS:
+            prefix = RDS_TMC_QTEXT_UPTO;
+            suffix = RDS_TMC_QTEXT_MILLIMETERS;
+            value = label->value;
+            break;
+        case RDS_TMC_QUANTIFIER_MHZ:
+            suffix = RDS_TMC_QTEXT_MHZ;
+            //In tens of kHz, rounded to one decimal.
+            value = (frequency + 5) / 10;
+            tenths = true;
+            break;
+        case RDS_TMC_QUANTIFIER_KHZ:
+            suffix = RDS_TMC_QTEXT_KHZ;
+            value = frequency;
+            break;
+    };
+
+    length = appendQuantifierText(buf, size, 0, prefix, texts);
+    if(tenths) {
+        length = appendNumber(buf, size, length, value / 10, 1);
+        length = appendQuantifierText(buf, size, length,
+                                      RDS_TMC_QTEXT_DECIMAL_POINT, texts);
+        length = appendNumber(buf, size, length, value % 10, 1);
+    } else
+        length = appendNumber(buf, size, length, value, 1);
+    return appendQuantifierText(buf, size, length, suffix, texts);
 };
 
 void RDSTranslator::decodeQuantifier(byte qType, TRDSTMCLabel *label, char *buf,
-                                     size_t size) {
-  if(!(label && buf))
-      return;
-  if(qType > RDS_TMC_QUANTIFIER_LAST)
-      return;
-  if(!(label->type == RDS_TMC_LABEL_QUANTIFIER_5 ||
-       label->type == RDS_TMC_LABEL_QUANTIFIER_8))
-      return;
-  if(label->type == RDS_TMC_LABEL_QUANTIFIER_5 &&
-     !(qType == RDS_TMC_QUANTIFIER_SMALL_NUMBER ||
-       qType == RDS_TMC_QUANTIFIER_NUMBER ||
-       qType == RDS_TMC_QUANTIFIER_LESSTHAN_METERS ||
-       qType == RDS_TMC_QUANTIFIER_PERCENT ||
-       qType == RDS_TMC_QUANTIFIER_UPTO_KMH ||
-       qType == RDS_TMC_QUANTIFIER_UPTO_MINUTES))
-      return;
-  if(label->type == RDS_TMC_LABEL_QUANTIFIER_8 &&
-    !(qType == RDS_TMC_QUANTIFIER_DEGREES_CELSIUS ||
-      qType == RDS_TMC_QUANTIFIER_TIME ||
-      qType == RDS_TMC_QUANTIFIER_TONNES ||
-      qType == RDS_TMC_QUANTIFIER_METERS ||
-      qType == RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS ||
-      qType == RDS_TMC_QUANTIFIER_MHZ ||
-      qType == RDS_TMC_QUANTIFIER_KHZ))
-      return;
-
-  byte aByte1, aByte2;
-  word aWord;
-  int8_t aSChar;
-  float aFloat;
-  switch(qType) {
-      case RDS_TMC_QUANTIFIER_SMALL_NUMBER:
-          if(label->value <= 28)
-              aByte1 = (label->value ? label->value : 36);
-          else
-              aByte1 = 28 + (label->value - 28) * 2;
-          snprintf_P(buf, size, (PGM_P)(pgm_read_ptr(&QuantifierText_S[qType])),
-                     aByte1);
-          break;
-      case RDS_TMC_QUANTIFIER_NUMBER:
-          if(label->value <= 4)
-              aWord = (label->value ? label->value : 1000);
-          else if(label->value > 4 && label->value <= 14)
-              aWord = (label->value - 4) * 10;
-          else if(label->value > 14)
-              aWord = 100 + (label->value - 14) * 50;
-          snprintf_P(buf, size, (PGM_P)(pgm_read_ptr(&QuantifierText_S[qType])),
-                     aWord);
-          break;
-      case RDS_TMC_QUANTIFIER_LESSTHAN_METERS:
-          aWord = label->value * 10;
-          snprintf_P(buf, size, (PGM_P)(pgm_read_ptr(&QuantifierText_S[qType])),
-                     aWord);
-          break;
-      case RDS_TMC_QUANTIFIER_PERCENT:
-          aByte1 = (label->value - 1) * 5;
-          snprintf_P(buf, size, (PGM_P)(pgm_read_ptr(&QuantifierText_S[qType])),
-                     aByte1);
-          break;
-      case RDS_TMC_QUANTIFIER_UPTO_KMH:
-          aByte1 = (label->value ? label->value * 5 : 160);
-          snprintf_P(buf, size, (PGM_P)(pgm_read_ptr(&QuantifierText_S[qType])),
-                     aByte1);
-          break;
-      case RDS_TMC_QUANTIFIER_UPTO_MINUTES:
-          if(label->value > 0 && label->value <= 10) {
-              aByte1 = label->value * 5;
-              snprintf_P(buf, size,
-                         (PGM_P)(pgm_read_ptr(&QuantifierText_S[qType])),
-                         aByte1, "minutes");
-          } else {
-              if(label->value <= 22)
-                  aByte1 = (label->value ? label->value - 10 : 72);
-              else
-                  aByte1 = 12 + (label->value - 22) * 6;
-              snprintf_P(buf, size,
-                         (PGM_P)(pgm_read_ptr(&QuantifierText_S[qType])),
-                         aByte1, "hours");
-          };
-          break;
-      case RDS_TMC_QUANTIFIER_DEGREES_CELSIUS:
-          aSChar = (int8_t)label->value - 51;
-          snprintf_P(buf, size, (PGM_P)(pgm_read_ptr(&QuantifierText_S[qType])),
-                     aSChar);
-          break;
-      case RDS_TMC_QUANTIFIER_TIME:
-          aByte1 = label->value / 6;
-          aByte2 = (label->value % 6 - 1) * 10;
-          snprintf_P(buf, size, (PGM_P)(pgm_read_ptr(&QuantifierText_S[qType])),
-                     aByte1, aByte2);
-          break;
-      case RDS_TMC_QUANTIFIER_TONNES:
-      case RDS_TMC_QUANTIFIER_METERS:
-          if(label->value <= 100)
-              aFloat = label->value * 0.1;
-          else
-              aFloat = 10.0 + (label->value - 100) * 0.5;
-          snprintf_P(buf, size, (PGM_P)(pgm_read_ptr(&QuantifierText_S[qType])),
-                     aFloat);
-          break;
-      case RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS:
-          aByte1 = label->value;
-          snprintf_P(buf, size, (PGM_P)(pgm_read_ptr(&QuantifierText_S[qType])),
-                     aByte1);
-          break;
-      case RDS_TMC_QUANTIFIER_MHZ:
-      case RDS_TMC_QUANTIFIER_KHZ:
-        aWord = decodeAFFrequency(label->value,
-                                  qType == RDS_TMC_QUANTIFIER_MHZ);
-        snprintf_P(buf, size, (PGM_P)(pgm_read_ptr(&QuantifierText_S[qType])),
-                   (qType == RDS_TMC_QUANTIFIER_KHZ ? aWord : aWord / 100.0));
-        break;
-  };
+                                     size_t size, const char *const texts[]) {
+    if(!(label && buf))
+        return;
+
+    formatQuantifier(qType, label, buf, size,
+                     (qType == RDS_TMC_QUANTIFIER_MHZ ||
+                      qType == RDS_TMC_QUANTIFIER_KHZ) ?
+                     decodeAFFrequency(label->value,
+                                       qType == RDS_TMC_QUANTIFIER_MHZ) : 0,
+                     texts);
+};
+
+size_t RDSTranslator::renderTMCEventText(const char *text, byte groupStart,
+                                         byte substitution, byte groupEnd,
+                                         bool elideSpace,
+                                         const char *quantifier, char *buf,
+                                         size_t size) {
+    size_t length = 0, textLength;
+
+    if(!(text && buf && size))
+        return 0;
+    buf[0] = '\0';
+    textLength = strlen(text);
+    if(substitution == RDS_TMC_EVENT_NO_GROUP || substitution >= textLength ||
+       groupStart >= substitution || groupEnd <= substitution + 2 ||
+       groupEnd > textLength)
+        return appendText(buf, size, 0, text, textLength);
+
+    if(quantifier && *quantifier) {
+        //Keep the group, without its parentheses.
+        length = appendText(buf, size, length, text, groupStart);
+        length = appendText(buf, size, length, &text[groupStart + 1],
+                            substitution - groupStart - 1);
+        length = appendText(buf, size, length, quantifier,
+                            strlen(quantifier));
+        length = appendText(buf, size, length, &text[substitution + 2],
+                            groupEnd - 1 - substitution - 2);
+    } else {
+        //Leave the group out, with one of the spaces around it.
+        if(elideSpace && groupStart)
+            groupStart--;
+        else if(elideSpace)
+            groupEnd++;
+        length = appendText(buf, size, length, text, groupStart);
+    };
+
+    return appendText(buf, size, length, &text[groupEnd],
+                      textLength - groupEnd);
+};
+
+//Expands a string from the compressed tables, see gentables.py.
+static size_t expandText(const char *packed, char *buf, size_t size) {
+    size_t length = 0;
+
+    if(!(packed && buf && size))
+        return 0;
+#if defined(WITH_RDS_TMC_COMPRESSED_STRINGS)
+    //Each token stands for a pair of symbols which may be tokens themselves,
+    //the generator tells how deep that goes.
+    byte stack[RDS_TMC_DICTIONARY_DEPTH + 1];
+
+    for(; *packed && length + 1 < size; packed++) {
+        byte top = 0;
+
+        stack[top++] = (byte)*packed;
+        while(top && length + 1 < size) {
+            byte symbol = stack[--top];
+
+            if(symbol < RDS_TMC_DICTIONARY_FIRST)
+                buf[length++] = symbol;
+            else if(symbol - RDS_TMC_DICTIONARY_FIRST <
+                    (int)(sizeof(ISO14819_2_Dictionary) /
+                          sizeof(ISO14819_2_Dictionary[0]))) {
+                symbol -= RDS_TMC_DICTIONARY_FIRST;
+                stack[top++] = pgm_read_byte(&ISO14819_2_Dictionary[symbol][1]);
+                stack[top++] = pgm_read_byte(&ISO14819_2_Dictionary[symbol][0]);
+            };
+        };
+    };
+#else
+    while(*packed && length + 1 < size)
+        buf[length++] = *packed++;
+#endif
+    buf[length] = '\0';
+
+    return length;
+};
+
+//Reads an event or supplementary information string into text, which has room
+//for RDS_TMC_EVENT_TEXT_MAX characters, expanding it if needed. Strings in an
+//external EEPROM can only be read through a fetcher.
+static bool fetchText(const char *source, bool external,
+                      TBlockFetcher stringFetcher, char *text) {
+#if defined(WITH_RDS_TMC_COMPRESSED_STRINGS)
+    char raw[RDS_TMC_EVENT_TEXT_MAX + 1];
+#else
+    char *raw = text;
+#endif
+
+    if(stringFetcher) {
+        //Read no further than the terminating NUL, in aligned blocks so that
+        //a slow or cached fetcher sees as few pages as possible.
+        size_t length = 0;
+
+        while(length < RDS_TMC_EVENT_TEXT_MAX) {
+            size_t block = RDS_TMC_STRING_FETCH_BLOCK -
+                           ((uintptr_t)source + length) %
+                           RDS_TMC_STRING_FETCH_BLOCK;
+
+            if(block > RDS_TMC_EVENT_TEXT_MAX - length)
+                block = RDS_TMC_EVENT_TEXT_MAX - length;
+            stringFetcher(source + length, &raw[length], block);
+            if(memchr(&raw[length], '\0', block))
+                break;
+            length += block;
+        };
+    } else if(external)
+        return false;
+    else
+        strncpy_P(raw, source, RDS_TMC_EVENT_TEXT_MAX);
+    raw[RDS_TMC_EVENT_TEXT_MAX] = '\0';
+#if defined(WITH_RDS_TMC_COMPRESSED_STRINGS)
+    expandText(raw, text, RDS_TMC_EVENT_TEXT_MAX + 1);
+#endif
+
+    return true;
+};
+
+size_t RDSTranslator::expandTMCText(const char *packed, char *buf,
+                                    size_t size) {
+    return expandText(packed, buf, size);
+};
+
+size_t RDSTranslator::renderTMCEvent(word event, const TRDSTMCLabel labels[],
+                                     byte count, char *buf, size_t size,
+                                     TBlockFetcher stringFetcher) {
+    if(!(buf && size))
+        return 0;
+    buf[0] = '\0';
+#if defined(WITH_RDS_TMC_EVENTS) && defined(WITH_RDS_TMC_EVENT_STRING_POINTERS)
+    byte record[sizeof(TRDSTMCEventListEntry)];
+    const TRDSTMCEventListEntry *entry = (TRDSTMCEventListEntry *)record;
+    char text[RDS_TMC_EVENT_TEXT_MAX + 1], quantifier[32];
+
+    if(!locateMessageRecord(ISO14819_2_Events, sizeof(TRDSTMCEventListEntry),
+                            sizeof(ISO14819_2_Events) /
+                            sizeof(ISO14819_2_Events[0]), 0, true, 0x0FFF,
+                            event, record, flashBlockFetcher))
+        return 0;
+
+# if defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+    if(!fetchText(entry->description, true, stringFetcher, text))
+# else
+    if(!fetchText(entry->description, false, stringFetcher, text))
+# endif
+        return 0;
+
+    quantifier[0] = '\0';
+    if(entry->substitution != RDS_TMC_EVENT_NO_GROUP && labels)
+        for(byte i = 0; i < count; i++)
+            if(formatQuantifier(entry->quantifier, &labels[i], quantifier,
+                                sizeof(quantifier),
+                                (entry->quantifier == RDS_TMC_QUANTIFIER_MHZ ||
+                                 entry->quantifier == RDS_TMC_QUANTIFIER_KHZ) ?
+                                decodeAFFrequency(labels[i].value,
+                                                  entry->quantifier ==
+                                                  RDS_TMC_QUANTIFIER_MHZ) : 0,
+                                NULL))
+                break;
+
+    return renderTMCEventText(text, entry->groupStart, entry->substitution,
+                              entry->groupEnd, entry->elideSpace, quantifier,
+                              buf, size);
+#else
+    return 0;
+#endif
+};
+
+size_t RDSTranslator::renderTMCSupplementary(byte code, char *buf,
+                                             size_t size,
+                                             TBlockFetcher stringFetcher) {
+    if(!(buf && size))
+        return 0;
+    buf[0] = '\0';
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY)
+    byte record[sizeof(TRDSTMCSupplementaryEntry)];
+    const TRDSTMCSupplementaryEntry *entry =
+        (TRDSTMCSupplementaryEntry *)record;
+    char text[RDS_TMC_EVENT_TEXT_MAX + 1];
+
+    if(!locateMessageRecord(ISO14819_2_Supplementary,
+                            sizeof(TRDSTMCSupplementaryEntry),
+                            sizeof(ISO14819_2_Supplementary) /
+                            sizeof(ISO14819_2_Supplementary[0]), 0, false,
+                            0xFF, code, record, flashBlockFetcher))
+        return 0;
+# if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+    if(!fetchText(entry->description, true, stringFetcher, text))
+# else
+    if(!fetchText(entry->description, false, stringFetcher, text))
+# endif
+        return 0;
+
+    return appendText(buf, size, 0, text, strlen(text));
+#else
+    return 0;
+#endif
 };
 
 void RDSTranslator::adjustTMCContainerForFLT(uint32_t slices[4], word *maybeFLT,
@@ -1147,15 +1550,17 @@ void RDSTranslator::adjustTMCContainerForFLT(uint32_t slices[4], word *maybeFLT,
 
     unpackTMCFLT(*maybeFLT, unpacked);
     *maybeFLT = (slices[0] & 0xFFFF0000) >> 16;
-    for(byte i = 0; i < 4; i++) {
+    for(byte i = 0; i < 3; i++) {
       slices[i] <<= 16;
       slices[i] |= (slices[i + 1] & 0xFFFF0000) >> 16;
     }
+    slices[3] <<= 16;
 };
 
 bool RDSTranslator::locateMessageRecord(const void *table, size_t recSize,
                                         size_t tableSize, size_t idOffset,
-                                        bool wordId, word key, void *record,
+                                        bool wordId, word idMask, word key,
+                                        void *record,
                                         TBlockFetcher blockFetcher) {
     if(!(table && record && blockFetcher && key))
         return false;
@@ -1171,7 +1576,7 @@ bool RDSTranslator::locateMessageRecord(const void *table, size_t recSize,
     do {
         blockFetcher((byte *)table + recNo * recSize + idOffset, &curId,
                      wordId ? sizeof(word) : sizeof(byte));
-        if(curId == key) {
+        if((curId & idMask) == key) {
             blockFetcher((byte *)table + recNo * recSize, record, recSize);
             return true;
         };
@@ -1180,6 +1585,37 @@ bool RDSTranslator::locateMessageRecord(const void *table, size_t recSize,
     return false;
 };
 
+bool RDSTranslator::getTMCEventInfo(word event, TRDSTMCEventInfo *info) {
+    if(!info)
+        return false;
+#if defined(WITH_RDS_TMC_EVENTS)
+    //TRDSTMCEventListEntry has a const member so it cannot be declared
+    //without an initializer, hence the raw buffer.
+    byte record[sizeof(TRDSTMCEventListEntry)];
+    const TRDSTMCEventListEntry *entry = (TRDSTMCEventListEntry *)record;
+
+    //The 12-bit code shares its word with the quantifier.
+    if(!locateMessageRecord(ISO14819_2_Events, sizeof(TRDSTMCEventListEntry),
+                            sizeof(ISO14819_2_Events) /
+                            sizeof(ISO14819_2_Events[0]), 0, true, 0x0FFF,
+                            event, record, flashBlockFetcher))
+        return false;
+
+    info->code = entry->code;
+    info->quantifier = entry->quantifier;
+    info->nature = entry->nature;
+    info->urgency = entry->urgency;
+    info->longerLasting = entry->longerLasting;
+    info->silentDuration = entry->silentDuration;
+    info->bidirectional = entry->bidirectional;
+    info->updateClass = entry->updateClass;
+
+    return true;
+#else
+    return false;
+#endif
+};
+
 void RDSTranslator::unpackRTPlusMessage3(word rTPMessage,
                                          TRDSRTPlusMessage3 *unpacked) {
     if(!unpacked)
@@ -1241,74 +1677,104 @@ void RDSTranslator::unpackPagingMessage13(byte ePbits1, word ePbits2,
                                     ePbits3;
 };
 
+//Appends count characters to a page message, storing what fits in buf (if
+//any). length counts all the characters generated, stored or not.
+static void appendPage(char *buf, size_t size, size_t *length,
+                       const char *text, size_t count) {
+    if(buf)
+        appendText(buf, size, *length, text, count);
+    *length += count;
+};
+
 void RDSTranslator::unpackRDSPage(TRDSRawData page[], byte size,
                                   TRDSPage *unpacked) {
-    char *pmtp;
+    size_t length = unpackRDSPage(page, size, unpacked, NULL, 0);
+
+    if(!unpacked || unpacked->pageType == RDS_PAGING_NOMESSAGE ||
+       unpacked->pageType == RDS_PAGING_INVALID)
+        return;
+    //Second pass, now that the length of the message is known.
+    unpackRDSPage(page, size, unpacked,
+                  (char *)calloc(length + 1, sizeof(char)), length + 1);
+};
+
+size_t RDSTranslator::unpackRDSPage(TRDSRawData page[], byte size,
+                                    TRDSPage *unpacked, char *buf,
+                                    size_t bufSize) {
+    char chars[8];
     word twochars;
     bool enhanced;
-    byte startAt;
+    byte startAt, segment;
+    size_t length = 0;
 
-    if(!unpacked)
-        return;
+    if(!(unpacked && page && size))
+        return 0;
+    if(buf && bufSize)
+        buf[0] = '\0';
+    else
+        buf = NULL;
+    //Until proven otherwise.
+    unpacked->pageType = RDS_PAGING_INVALID;
+    unpacked->pageMessage = NULL;
     enhanced = unpackPageHeader(page[0].blockC, page[0].blockD, unpacked);
-    switch(page[0].fiveBits & RDS_PAGING_SEGMENT_MASK) {
+    segment = page[0].fiveBits & RDS_PAGING_SEGMENT_MASK;
+    switch(segment) {
         case RDS_PAGING_SEGMENT_NOMESSAGE:
             unpacked->pageType = RDS_PAGING_NOMESSAGE;
-            unpacked->pageMessage = NULL;
-            break;
+            return 0;
         case RDS_PAGING_SEGMENT_FUNCTION_1:
+            if(size < 2)
+                return 0;
             unpacked->pageType = RDS_PAGING_FUNCTION;
             unpacked->countryCode = (
                 (lowByte(page[0].blockD) & 0xF0) >> 4) * 100 +
                 (lowByte(page[0].blockD) & 0x0F) * 10 +
-                (highByte(page[1].blockC) & 0xF0) >> 4;
-            unpacked->pageMessage = (char *)calloc(4 + 1, sizeof(char));
-            unpacked->pageMessage[0] = highByte(page[1].blockC) & 0x0F;
-            unpacked->pageMessage[1] = lowByte(page[1].blockC);
+                ((highByte(page[1].blockC) & 0xF0) >> 4);
+            chars[0] = highByte(page[1].blockC) & 0x0F;
+            chars[1] = lowByte(page[1].blockC);
             twochars = swab(page[1].blockD);
-            strncpy(&unpacked->pageMessage[2], (char *)&twochars, 2);
+            memcpy(&chars[2], &twochars, 2);
+            appendPage(buf, bufSize, &length, chars, 4);
             break;
         case RDS_PAGING_SEGMENT_10DIGIT_1:
         case RDS_PAGING_SEGMENT_18DIGIT_1:
+            if(size < (segment == RDS_PAGING_SEGMENT_10DIGIT_1 ? 2 : 3))
+                return 0;
             unpacked->pageType = RDS_PAGING_DIGIT;
-            unpacked->pageMessage = (char *)calloc(
-                (page[0].fiveBits & RDS_PAGING_SEGMENT_MASK ==
-                 RDS_PAGING_SEGMENT_10DIGIT_1 ? 10 : 18) + 1, sizeof(char));
-            BCD2Char((byte)lowByte(page[0].blockD), unpacked->pageMessage);
-            pmtp = unpacked->pageMessage + 2;
-            BCD2Char(page[1].blockC, page[1].blockD, pmtp);
-            if(page[0].fiveBits & RDS_PAGING_SEGMENT_MASK ==
-               RDS_PAGING_SEGMENT_18DIGIT_1) {
-                pmtp += 4;
-                BCD2Char(page[2].blockC, page[2].blockD, pmtp);
+            BCD2Char((byte)lowByte(page[0].blockD), chars);
+            appendPage(buf, bufSize, &length, chars, 2);
+            BCD2Char(page[1].blockC, page[1].blockD, chars);
+            appendPage(buf, bufSize, &length, chars, 8);
+            if(segment == RDS_PAGING_SEGMENT_18DIGIT_1) {
+                BCD2Char(page[2].blockC, page[2].blockD, chars);
+                appendPage(buf, bufSize, &length, chars, 8);
             };
             break;
         case RDS_PAGING_SEGMENT_15DIGIT_1:
+            if(size < 3)
+                return 0;
             unpacked->pageType = RDS_PAGING_DIGIT;
             unpacked->countryCode = (
                 (lowByte(page[0].blockD) & 0xF0) >> 4) * 100 +
                 (lowByte(page[0].blockD) & 0x0F) * 10 +
-                (highByte(page[1].blockC) & 0xF0) >> 4;
-            unpacked->pageMessage = (char *)calloc(15 + 1, sizeof(char));
-            unpacked->pageMessage[0] = (
-                (highByte(page[1].blockC) & 0x0F) == 0xA ? ' ' :
-                (highByte(page[1].blockC) & 0x0F) + '0');
-            pmtp = unpacked->pageMessage + 1;
-            BCD2Char((byte)lowByte(page[1].blockC), pmtp);
-            pmtp += 2;
-            BCD2Char(page[1].blockD, pmtp);
-            pmtp += 4;
-            BCD2Char(page[2].blockC, page[2].blockD, pmtp);
+                ((highByte(page[1].blockC) & 0xF0) >> 4);
+            chars[0] = (highByte(page[1].blockC) & 0x0F) == 0xA ? ' ' :
+                       (highByte(page[1].blockC) & 0x0F) + '0';
+            BCD2Char((byte)lowByte(page[1].blockC), &chars[1]);
+            appendPage(buf, bufSize, &length, chars, 3);
+            BCD2Char(page[1].blockD, chars);
+            appendPage(buf, bufSize, &length, chars, 4);
+            BCD2Char(page[2].blockC, page[2].blockD, chars);
+            appendPage(buf, bufSize, &length, chars, 8);
             break;
         case RDS_PAGING_SEGMENT_ALPHA_1:
             //This could be an alphanumeric page in basic paging or any kind of
             //page in enhanced paging.
+            unpacked->pageType = RDS_PAGING_ALPHA;
+            startAt = 1;
             if(enhanced) {
                 switch((page[0].blockD & RDS_PAGING_ENHANCED_TYPE_MASK) >>
                         RDS_PAGING_ENHANCED_TYPE_SHR) {
-                    case RDS_PAGING_ENHANCED_TYPE_ALPHA:
-                        unpacked->pageType = RDS_PAGING_ALPHA;
-                        break;
                     case RDS_PAGING_ENHANCED_TYPE_DIGIT:
                         unpacked->pageType = RDS_PAGING_DIGIT;
                         break;
@@ -1317,76 +1783,47 @@ void RDSTranslator::unpackRDSPage(TRDSRawData page[], byte size,
                         break;
                 }
                 if((bool)(page[0].blockD & RDS_PAGING_CONTROL_INTERNATIONAL)) {
+                    if(size < 2) {
+                        unpacked->pageType = RDS_PAGING_INVALID;
+                        return 0;
+                    };
                     unpacked->countryCode = (
                         (highByte(page[1].blockC) & 0xF0) >> 4) * 100 +
                         (highByte(page[1].blockC) & 0x0F) * 10 +
-                        (lowByte(page[1].blockC) & 0xF0) >> 4;
-                    switch(unpacked->pageType) {
-                        case RDS_PAGING_ALPHA:
+                        ((lowByte(page[1].blockC) & 0xF0) >> 4);
+                    if(unpacked->pageType == RDS_PAGING_DIGIT) {
+                        BCD2Char(page[1].blockD, chars);
+                        appendPage(buf, bufSize, &length, chars, 4);
+                    } else {
                         //Function messages are hex (i.e. binary) encoded,
                         //therefore exactly the same handling as characters.
-                        case RDS_PAGING_FUNCTION:
-                            unpacked->pageMessage = (char *)calloc((size - 2) *
-                                                    4 + 2 + 1, sizeof(char));
-                            twochars = swab(page[1].blockD);
-                            strncpy(
-                                unpacked->pageMessage, (char *)&twochars, 2);
-                            pmtp = unpacked->pageMessage + 2;
-                            break;
-                        case RDS_PAGING_DIGIT:
-                            unpacked->pageMessage = (char *)calloc((size - 2) *
-                                                    8 + 4 + 1, sizeof(char));
-                            BCD2Char(page[1].blockD, unpacked->pageMessage);
-                            pmtp = unpacked->pageMessage + 4;
-                            break;
-                    }
+                        twochars = swab(page[1].blockD);
+                        appendPage(buf, bufSize, &length, (char *)&twochars,
+                                   2);
+                    };
                     startAt = 2;
-                } else {
-                    switch(unpacked->pageType) {
-                        case RDS_PAGING_ALPHA:
-                        case RDS_PAGING_FUNCTION:
-                            unpacked->pageMessage = (char *)calloc((size - 1) *
-                                                    4 + 1, sizeof(char));
-                            break;
-                        case RDS_PAGING_DIGIT:
-                            unpacked->pageMessage = (char *)calloc((size - 1) *
-                                                    8 + 1, sizeof(char));
-                            break;
-                    }
-                    pmtp = unpacked->pageMessage;
-                    startAt = 1;
-                }
-            } else {
-                //Alphanumeric message in basic paging.
-                unpacked->pageType = RDS_PAGING_ALPHA;
-                unpacked->pageMessage = (char *)calloc((size - 1) * 4 + 1,
-                                                       sizeof(char));
-                pmtp = unpacked->pageMessage;
-                startAt = 1;
-            }
+                };
+            };
 
             for(byte i = startAt; i < size; i++) {
-                switch(unpacked->pageType) {
-                    case RDS_PAGING_ALPHA:
-                    case RDS_PAGING_FUNCTION:
-                        twochars = swab(page[i].blockC);
-                        strncpy(pmtp, (char *)&twochars, 2);
-                        pmtp += 2;
-                        twochars = swab(page[i].blockD);
-                        strncpy(pmtp, (char *)&twochars, 2);
-                        pmtp += 2;
-                        break;
-                    case RDS_PAGING_DIGIT:
-                        BCD2Char(page[i].blockC, page[i].blockD, pmtp);
-                        pmtp += 8;
-                        break;
-                }
+                if(unpacked->pageType == RDS_PAGING_DIGIT) {
+                    BCD2Char(page[i].blockC, page[i].blockD, chars);
+                    appendPage(buf, bufSize, &length, chars, 8);
+                } else {
+                    twochars = swab(page[i].blockC);
+                    appendPage(buf, bufSize, &length, (char *)&twochars, 2);
+                    twochars = swab(page[i].blockD);
+                    appendPage(buf, bufSize, &length, (char *)&twochars, 2);
+                };
             };
             break;
         default:
             //Invalid Group 7A sequence.
-            return;
+            return 0;
     };
+    unpacked->pageMessage = buf;
+
+    return length;
 };
 
 bool RDSTranslator::unpackPageHeader(word block3, word block4,
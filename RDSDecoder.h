@@ -56,6 +56,13 @@
 #define RDS_AF_NODATA 0xE0
 #define RDS_AF_FOLLOWS_FM_FIRST 0xE1
 #define RDS_AF_FOLLOWS_AM 0xFA
+#define RDS_AF_FOLLOWS_FM_LAST 0xF9
+//AF codes are 1-204 for FM and 1-135 for LF/MF (LF up to 15), bitmaps of
+//them have bit n standing for code n.
+#define RDS_AF_FM_CODES 205
+#define RDS_AF_LFMF_CODES 136
+#define RDS_AF_FM_BITMAP_SIZE ((RDS_AF_FM_CODES + 7) / 8)
+#define RDS_AF_LFMF_BITMAP_SIZE ((RDS_AF_LFMF_CODES + 7) / 8)
 #define RDS_TMC_EAG_TEST_CLEAR 0x0
 #define RDS_TMC_EAG_TEST_STATIC 0x1
 #define RDS_TMC_EAG_TEST_DYNAMIC 0x3
@@ -91,6 +98,31 @@
 #define RDS_TMC_L1_DIVERSION 0x05
 #define RDS_TMC_L1_EXTENT_ADD8 0x06
 #define RDS_TMC_L1_EXTENT_ADD16 0x07
+
+//Longest ISO 14819-2 event text, without the terminating NUL.
+#define RDS_TMC_EVENT_TEXT_MAX 127
+//Substitution offset of ISO 14819-2 event texts without a quantifier group.
+#define RDS_TMC_EVENT_NO_GROUP 0xFF
+//Strings are read through a stringFetcher in blocks ending on multiples of
+//this many bytes, until the terminating NUL is found.
+#define RDS_TMC_STRING_FETCH_BLOCK 32
+
+//Indexes of the texts RDSTranslator::decodeQuantifier() puts around the
+//quantifier values, which can be given in other languages.
+#define RDS_TMC_QTEXT_LESSTHAN 0
+#define RDS_TMC_QTEXT_UPTO 1
+#define RDS_TMC_QTEXT_METERS 2
+#define RDS_TMC_QTEXT_PERCENT 3
+#define RDS_TMC_QTEXT_KMH 4
+#define RDS_TMC_QTEXT_MINUTES 5
+#define RDS_TMC_QTEXT_HOURS 6
+#define RDS_TMC_QTEXT_CELSIUS 7
+#define RDS_TMC_QTEXT_TONNES 8
+#define RDS_TMC_QTEXT_MILLIMETERS 9
+#define RDS_TMC_QTEXT_MHZ 10
+#define RDS_TMC_QTEXT_KHZ 11
+#define RDS_TMC_QTEXT_DECIMAL_POINT 12
+#define RDS_TMC_QTEXTS 13
 #define RDS_RTP_CLASS_DUMMY 0
 #define RDS_RTP_CLASS_ITEM_TITLE 1
 #define RDS_RTP_CLASS_ITEM_ALBUM 2
@@ -159,6 +191,7 @@
 #define RDS_PAGING_FUNCTION 0x1
 #define RDS_PAGING_DIGIT 0x2
 #define RDS_PAGING_ALPHA 0x3
+#define RDS_PAGING_INVALID 0x4
 
 //RDS Decoder callback types
 #define RDS_CALLBACK_AF 0x00
@@ -174,6 +207,20 @@
 #define RDS_CALLBACK_P13 0x0A
 #define RDS_CALLBACK_LAST RDS_CALLBACK_P13
 
+//Number of ODA handlers that can be registered
+#if !defined(RDS_ODA_HANDLERS)
+# define RDS_ODA_HANDLERS 4
+#endif
+//Number of RDS2 streams decoded: the basic one (0) and, on hosts, the three
+//upper ones on the 66.5, 71.25 and 76kHz subcarriers (1-3)
+#if !defined(RDS_STREAMS)
+# if defined(__i386__) || defined(__x86_64__)
+#  define RDS_STREAMS 4
+# else
+#  define RDS_STREAMS 1
+# endif
+#endif
+
 //This holds time of day as received via RDS. Mimicking struct tm from
 //<time.h> for familiarity.
 //NOTE: RDS does not provide seconds, only guarantees that the minute update
@@ -325,6 +372,17 @@ typedef struct {
     uint16_t value;
 } TRDSTMCLabel;
 
+typedef struct {
+    word code;
+    byte quantifier;
+    byte nature;
+    byte urgency;
+    bool longerLasting;
+    bool silentDuration;
+    bool bidirectional;
+    byte updateClass;
+} TRDSTMCEventInfo;
+
 typedef struct __attribute__ ((__packed__)) {
     uint8_t itemToggle:1;
     uint8_t itemRunning:1;
@@ -465,6 +523,21 @@ typedef struct {
 //    paging transmitted in group 13A.
 typedef void (*TRDSCallback)(byte, bool, word, word);
 
+//ODA handler prototype.
+//The first parameter is the context pointer given at registration time. For
+//the groups the application is carried in, the second parameter is the 5 bit
+//address code in block B, the third is true and the last two contain blocks C
+//and D. For the Group 3A announcing the application, the second parameter is
+//the group type it is carried in (as in RDS_CALLBACK_AID), the third is false
+//and the last two contain the application message and AID.
+typedef void (*TRDSODAHandler)(void *, byte, bool, word, word);
+
+//EON handler prototype.
+//The first parameter is the context pointer given at registration time, the
+//second points to the four blocks of a Group 14A or 14B, or is NULL when the
+//decoder is reset.
+typedef void (*TRDSEONHandler)(void *, word *);
+
 class RDSDecoder
 {
     public:
@@ -483,11 +556,38 @@ class RDSDecoder
         */
         void registerCallback(byte type, TRDSCallback callback = NULL);
 
+        /*
+        * Description:
+        *   Registers the handler of an Open Data Application. Once a Group 3A
+        *   maps the AID to a group type, every group of that type goes to the
+        *   handler, which takes precedence over RDS_CALLBACK_TMC,
+        *   RDS_CALLBACK_RTP and RDS_CALLBACK_ERT for their AIDs. Using NULL
+        *   for the second parameter removes the handler of the AID, if any.
+        * Parameters:
+        *   AID - the Application Identification.
+        *   handler - the function to call.
+        *   context - an opaque pointer handed back to the handler.
+        *   stream - the RDS2 stream whose announcements and groups the
+        *            handler is for, each stream keeping its own mapping.
+        * Returns:
+        *   false if RDS_ODA_HANDLERS handlers are already registered or the
+        *   stream is not below RDS_STREAMS.
+        */
+        bool registerODAHandler(word AID, TRDSODAHandler handler = NULL,
+                                void *context = NULL, byte stream = 0);
+
         /*
         * Description:
         *   Decodes one RDS group and updates internal data structures.
+        * Parameters:
+        *   block - the four blocks of the group.
+        *   stream - the RDS2 stream the group was received on. Groups of
+        *            streams 1 and up only go to the ODA handlers registered
+        *            for that stream, as announced by the Group 3A of that
+        *            stream; the station data and callbacks come from stream
+        *            0 alone. Groups of streams RDS_STREAMS and up are ignored.
         */
-        void decodeRDSGroup(word block[]);
+        void decodeRDSGroup(word block[], byte stream = 0);
 
         /*
         * Description:
@@ -508,10 +608,22 @@ class RDSDecoder
         */
         bool getRDSTime(TRDSTime* rdstime = NULL);
 
+        /*
+        * Description:
+        *   Registers the handler that Groups 14A and 14B are also fed to,
+        *   e.g. an EONTable keeping every Other Network apart where
+        *   TRDSData.EON only holds the last one seen:
+        *   decoder.registerEONHandler(EONTable::handleEON, &table);
+        *   Using NULL for the first parameter removes the current handler,
+        *   if any.
+        */
+        void registerEONHandler(TRDSEONHandler handler = NULL,
+                                void *context = NULL);
+
         /*
         * Description:
         *   Resets internal data structures, use when switching to a new
-        *   station.
+        *   station. The EON handler, if any, is told to reset too.
         */
         void resetRDS(void);
 
@@ -521,6 +633,18 @@ class RDSDecoder
         bool _rdstextab, _rdsptynab, _havect;
         TRDSCallback _callbacks[RDS_CALLBACK_LAST + 1];
         byte _locale;
+        TRDSEONHandler _eonHandler;
+        void *_eonContext;
+        struct {
+            word AID;
+            byte stream;
+            TRDSODAHandler handler;
+            void *context;
+        } _odaHandlers[RDS_ODA_HANDLERS];
+        //What each group type of each stream carries, as mapped by Group 3A:
+        //an index in _odaHandlers, RDS_CALLBACK_* | RDS_ODA_ROUTE_CALLBACK or
+        //RDS_ODA_ROUTE_NONE.
+        byte _odaRoutes[RDS_STREAMS][32];
 
         /*
         * Description:
@@ -537,14 +661,17 @@ class RDSDecoder
 
         /*
         * Description:
-        *   Maps a short PTY(ON) code as sent in Group 14B to a PTY value,
-        *   obeying the current locale.
-        * Parameters:
-        *   shortPTY - the short PTY(ON) to map (decode)
-        * Returns:
-        *   mapped PTY code, according to the current locale.
+        *   Maps the group type announced by a Group 3A of the given stream to
+        *   the registered handler of its AID, if any, or else to route.
         */
-        byte mapShortPTY(byte shortPTY);
+        void announceODA(word block[], byte stream, byte route);
+
+        /*
+        * Description:
+        *   Hands an ODA group of the given stream to whatever its group type
+        *   was mapped to.
+        */
+        void dispatchODA(word block[], byte stream, byte grouptype);
 
         /*
         * Description:
@@ -577,6 +704,17 @@ class RDSTranslator
         */
         void getTextForPTY(byte PTY, char* text, byte textsize);
 
+        /*
+        * Description:
+        *   Maps a short PTY(ON) code as sent in Group 14B to a PTY value,
+        *   obeying the current locale.
+        * Parameters:
+        *   shortPTY - the short PTY(ON) to map (decode)
+        * Returns:
+        *   mapped PTY code, according to the current locale.
+        */
+        byte mapShortPTY(byte shortPTY);
+
         /*
         * Description:
         *   Decodes the station callsign out of the PI using the method
@@ -658,6 +796,19 @@ class RDSTranslator
         */
         void unpackTMCMessage3(word tmcMessage, TRDSTMCMessage3 *unpacked);
 
+        /*
+        * Description:
+        *   Unpacks linkage information (LA, EG, ILS and LSN, as sent in Group
+        *   14A variant 12 and in the DAB cross-referencing ODA) into a
+        *   TRDSLinkageInformation struct.
+        * Parameters:
+        *   linkage - a word containing the linkage information.
+        *   unpacked - pointer to a TRDSLinkageInformation struct that will
+        *              receive the unpacked data.
+        */
+        void unpackLinkageInformation(word linkage,
+                                      TRDSLinkageInformation *unpacked);
+
         /*
         * Description:
         *   Decrypts a TMC location table index according to ISO 14819-6 §9.4.
@@ -758,6 +909,24 @@ class RDSTranslator
         bool readNextTMCLabel(const uint32_t slices[4],
                               TRDSTMCContainerIndex *fp, TRDSTMCLabel *label);
 
+        /*
+        * Description:
+        *   Decodes all the labels in the bit container in one pass, which is
+        *   faster than calling readNextTMCLabel() repeatedly.
+        * Parameters:
+        *   slices - an array of 4 uint32_t containing the TMC message bit
+        *            container.
+        *   labels - an array of max TRDSTMCLabel structs that will receive the
+        *            labels read.
+        *   max - the number of elements in labels.
+        * Returns:
+        *   the number of labels stored in labels. Decoding stops at the end of
+        *   the container, at its zero padding or at Label 15, which is not
+        *   stored.
+        */
+        byte decodeAllTMCLabels(const uint32_t slices[4],
+                                TRDSTMCLabel labels[], byte max);
+
         /*
         * Description:
         *   Given an expected quantifier type and the corresponding label which
@@ -771,9 +940,116 @@ class RDSTranslator
         *   buf - a pointer to a character string buffer that will receive the
         *         human readable representation.
         *   size - the size of the buffer provided.
+        *   texts - an array of RDS_TMC_QTEXTS strings to use instead of the
+        *           built-in English ones, indexed by the RDS_TMC_QTEXT_*
+        *           constants (e.g. " km/h" or "of up to "). NULL entries, or
+        *           NULL for the array, stand for the built-in ones.
         */
         void decodeQuantifier(byte qType, TRDSTMCLabel *label, char *buf,
-                              size_t size);
+                              size_t size, const char *const texts[] = NULL);
+
+        /*
+        * Description:
+        *   Looks up the ISO 14819-2 properties (quantifier type, nature,
+        *   urgency, duration type, directionality and update class) of an
+        *   event in the built-in event list.
+        * Parameters:
+        *   event - a word containing the event code.
+        *   info - pointer to a TRDSTMCEventInfo struct that will receive the
+        *          event properties.
+        * Returns:
+        *   true if the event was found and info filled, false otherwise
+        *   (including when the event list was not compiled in).
+        */
+        bool getTMCEventInfo(word event, TRDSTMCEventInfo *info);
+
+        /*
+        * Description:
+        *   Renders the ISO 14819-2 text of an event, with its quantifier (if
+        *   any) substituted in. The substitution point was found when the
+        *   tables were generated, so this only copies text and formats the
+        *   quantifier, no parsing or printf-style formatting is involved.
+        *   Events with an optional quantifier group render without the
+        *   group when no quantifier label is given.
+        * Parameters:
+        *   event - a word containing the event code.
+        *   labels - an array of count labels of the message, e.g.
+        *            TRDSTMCDecodedMessage.labels; the first quantifier label
+        *            fitting the event's quantifier type is used. May be NULL.
+        *   count - number of elements in labels.
+        *   buf - a pointer to a character string buffer that will receive the
+        *         text, always NUL-terminated and truncated if needed.
+        *   size - the size of the buffer provided.
+        *   stringFetcher - pointer to a function used to read the event
+        *                   string, mandatory if the strings are stored in an
+        *                   external EEPROM, in which case the source is the
+        *                   EEPROM address. It is asked for consecutive
+        *                   blocks of at most RDS_TMC_STRING_FETCH_BLOCK bytes,
+        *                   aligned to that size, until one of them holds the
+        *                   terminating NUL.
+        * Returns:
+        *   the length of the text in buf, 0 if the event is unknown or the
+        *   event strings were not compiled in.
+        */
+        size_t renderTMCEvent(word event, const TRDSTMCLabel labels[],
+                              byte count, char *buf, size_t size,
+                              TBlockFetcher stringFetcher = NULL);
+
+        /*
+        * Description:
+        *   The text processing half of renderTMCEvent(), for event text
+        *   already in RAM (e.g. from other language tables).
+        * Parameters:
+        *   text - the event text, containing %s where the quantifier goes.
+        *   groupStart, substitution, groupEnd, elideSpace - the pre-parsed
+        *                   quantifier group, see TRDSTMCEventListEntry.
+        *                   substitution is RDS_TMC_EVENT_NO_GROUP if the text
+        *                   has no quantifier group.
+        *   quantifier - the rendered quantifier, NULL or empty if none.
+        *   buf - a pointer to a character string buffer that will receive the
+        *         text, always NUL-terminated and truncated if needed.
+        *   size - the size of the buffer provided.
+        * Returns:
+        *   the length of the text in buf.
+        */
+        size_t renderTMCEventText(const char *text, byte groupStart,
+                                  byte substitution, byte groupEnd,
+                                  bool elideSpace, const char *quantifier,
+                                  char *buf, size_t size);
+
+        /*
+        * Description:
+        *   Fetches the ISO 14819-2 supplementary information text for a code.
+        * Parameters:
+        *   code - the supplementary information code (label 6 value).
+        *   buf - a pointer to a character string buffer that will receive the
+        *         text, always NUL-terminated and truncated if needed.
+        *   size - the size of the buffer provided.
+        *   stringFetcher - as for renderTMCEvent().
+        * Returns:
+        *   the length of the text in buf, 0 if the code is unknown or the
+        *   supplementary information strings were not compiled in.
+        */
+        size_t renderTMCSupplementary(byte code, char *buf, size_t size,
+                                      TBlockFetcher stringFetcher = NULL);
+
+        /*
+        * Description:
+        *   Expands a string read from the compressed string tables (see
+        *   WITH_RDS_TMC_COMPRESSED_STRINGS), for callers that fetch the
+        *   strings on their own. The expansion streams one input byte at a
+        *   time with a stack of a few bytes, so it never needs the whole
+        *   expanded string in memory other than buf. Without
+        *   WITH_RDS_TMC_COMPRESSED_STRINGS this just copies.
+        * Parameters:
+        *   packed - the compressed, NUL-terminated string.
+        *   buf - a pointer to a character string buffer that will receive the
+        *         text, always NUL-terminated and truncated if needed.
+        *   size - the size of the buffer provided.
+        * Returns:
+        *   the length of the text in buf.
+        */
+        size_t expandTMCText(const char *packed, char *buf, size_t size);
 
         /*
         * Description:
@@ -843,47 +1119,36 @@ class RDSTranslator
         *          contiguous page).
         *   size - the number of Group 7A messages this page was made up of.
         *   unpacked - pointer to a TRDSPage struct that will receive the
-        *              unpacked and re-assembled data.
+        *              unpacked and re-assembled data. Its pageType is
+        *              RDS_PAGING_NOMESSAGE if the page holds no message and
+        *              RDS_PAGING_INVALID if it is not a valid sequence,
+        *              pageMessage being NULL in both cases.
         */
         void unpackRDSPage(TRDSRawData page[], byte size, TRDSPage *unpacked);
 
-    private:
-        byte _locale;
-
         /*
         * Description:
-        *   Reads from a TMC multi-group message bit container.
+        *   As above, but the string representation of the message goes to a
+        *   caller-provided buffer instead of the heap, pageMessage pointing
+        *   to buf if the page contained a message.
         * Parameters:
-        *   slices - an array of 4 uint32_t containing the TMC message bit
-        *            container.
-        *   fp - a pointer to a TRDSTMCContainerIndex struct holding the current
-        *        read pointer for the container. On the first invocation (for a
-        *        new container), zero out the struct to signal that reading
-        *        should start from the beginning of the container; on subsequent
-        *        invocations, pass the same struct to advance from the last read
-        *        location.
-        *   size - a nibble containing the number of bits to read from the
-        *          container.
+        *   page, size, unpacked - as above.
+        *   buf - a pointer to a character buffer that will receive the message,
+        *         always NUL-terminated and truncated if needed. May be NULL to
+        *         only find out the length.
+        *   bufSize - the size of the buffer provided.
         * Returns:
-        *   The bits read from the container, LSB-aligned to a word.
-        */
-        word readFromTMCContainer(const uint32_t slices[4],
-                                  TRDSTMCContainerIndex *fp, byte size);
-
-        /*
-        * Description:
-        *   Unpacks a TMC FLT code into a TRDSTMCFLT struct.
-        * Parameters:
-        *   flt - a word containing the FLT code.
-        *   unpacked - pointer to a TRDSTMCFLT struc that will receive the
-        *              unpacked data.
+        *   the length of the message, which may be bufSize or more if it was
+        *   truncated; 0 if there is none.
         */
-        void unpackTMCFLT(word flt, TRDSTMCFLT *unpacked);
+        size_t unpackRDSPage(TRDSRawData page[], byte size, TRDSPage *unpacked,
+                             char *buf, size_t bufSize);
 
         /*
         * Description:
         *   Finds a record by id in an array. Used to lookup event message or
-        *   supplementary information records. The array is assumed to be sorted
+        *   supplementary information records, either in the built-in tables
+        *   or in ones loaded at run time. The array is assumed to be sorted
         *   ascendingly by id and to start at id == 1.
         * Parameters:
         *   table - pointer to the start of the contiguous sorted array.
@@ -891,6 +1156,9 @@ class RDSTranslator
         *   tableSize - size in records of the array.
         *   idOffset - offset in bytes to the id field in each record.
         *   wordId - true if the id is a word, false if it's a byte.
+        *   idMask - mask applied to the id read from the array before
+        *            comparing it, for ids which are bitfields sharing their
+        *            word with other fields.
         *   key - the id to look for.
         *   record - pointer to a buffer at least recSize bytes long that will
         *   receive the target record if found.
@@ -902,7 +1170,7 @@ class RDSTranslator
         */
         bool locateMessageRecord(const void *table, size_t recSize,
                                  size_t tableSize, size_t idOffset, bool wordId,
-                                 word key, void *record,
+                                 word idMask, word key, void *record,
                                  TBlockFetcher blockFetcher);
 
         /*
@@ -927,6 +1195,39 @@ class RDSTranslator
         */
         bool unpackPageHeader(word block3, word block4, TRDSPage *unpacked);
 
+    private:
+        byte _locale;
+
+        /*
+        * Description:
+        *   Reads from a TMC multi-group message bit container.
+        * Parameters:
+        *   slices - an array of 4 uint32_t containing the TMC message bit
+        *            container.
+        *   fp - a pointer to a TRDSTMCContainerIndex struct holding the current
+        *        read pointer for the container. On the first invocation (for a
+        *        new container), zero out the struct to signal that reading
+        *        should start from the beginning of the container; on subsequent
+        *        invocations, pass the same struct to advance from the last read
+        *        location.
+        *   size - a nibble containing the number of bits to read from the
+        *          container.
+        * Returns:
+        *   The bits read from the container, LSB-aligned to a word.
+        */
+        word readFromTMCContainer(const uint32_t slices[4],
+                                  TRDSTMCContainerIndex *fp, byte size);
+
+        /*
+        * Description:
+        *   Unpacks a TMC FLT code into a TRDSTMCFLT struct.
+        * Parameters:
+        *   flt - a word containing the FLT code.
+        *   unpacked - pointer to a TRDSTMCFLT struc that will receive the
+        *              unpacked data.
+        */
+        void unpackTMCFLT(word flt, TRDSTMCFLT *unpacked);
+
         /*
         * Description:
         *   Decodes BCD-encoded nibbles to their ASCII equivalents.
@@ -0,0 +1,211 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This is the code file for the RT+ processor.
+ * See the header file for better function documentation.
+ */
+
+#include "RTPlusProcessor.h"
+
+#include <string.h>
+
+//Moves past count characters of text, which are single bytes in RT and UTF-8
+//sequences in eRT (RT+ markers count characters, not bytes). Returns NULL if
+//text ends before that.
+static const char *skipCharacters(const char *text, byte count, bool utf8) {
+    while(count) {
+        if(!*text)
+            return NULL;
+        text++;
+        if(utf8)
+            while((*text & 0xC0) == 0x80)
+                text++;
+        count--;
+    };
+
+    return text;
+};
+
+RTPlusProcessor::RTPlusProcessor(TRDSRTPlusStation stations[], byte capacity,
+                                 TRTPlusCallback callback, void *context) {
+    _stations = stations;
+    _capacity = capacity < RDS_RTP_NONE ? capacity : RDS_RTP_NONE;
+    registerCallback(callback, context);
+    reset();
+};
+
+void RTPlusProcessor::registerCallback(TRTPlusCallback callback,
+                                       void *context) {
+    _callback = callback;
+    _context = context;
+};
+
+void RTPlusProcessor::reset(void) {
+    _count = 0;
+    _last = RDS_RTP_NONE;
+};
+
+byte RTPlusProcessor::findStation(word programIdentifier, bool add) {
+    //Groups come in bursts from the same station, try the last one first.
+    if(_last < _count && _stations[_last].programIdentifier ==
+                         programIdentifier)
+        return _last;
+    for(byte i = 0; i < _count; i++)
+        if(_stations[i].programIdentifier == programIdentifier)
+            return _last = i;
+    if(!add || _count >= _capacity)
+        return RDS_RTP_NONE;
+
+    memset(&_stations[_count], 0x00, sizeof(_stations[_count]));
+    _stations[_count].programIdentifier = programIdentifier;
+
+    return _last = _count++;
+};
+
+void RTPlusProcessor::processRTPlusMessage3(word programIdentifier,
+                                            word rTPMessage) {
+    TRDSRTPlusMessage3 unpacked;
+    byte index = findStation(programIdentifier, true);
+
+    if(index == RDS_RTP_NONE)
+        return;
+    _translator.unpackRTPlusMessage3(rTPMessage, &unpacked);
+    if(_stations[index].eRT != (bool)unpacked.eRT) {
+        //The tags now refer to the other text, the one we have is useless.
+        _stations[index].eRT = unpacked.eRT;
+        _stations[index].text[0] = '\0';
+    };
+};
+
+void RTPlusProcessor::processText(word programIdentifier, const char *text,
+                                  bool eRT) {
+    byte index = findStation(programIdentifier, true);
+
+    if(index == RDS_RTP_NONE || !text || _stations[index].eRT != eRT)
+        return;
+    strncpy(_stations[index].text, text, RDS_RTP_TEXT_MAX);
+    _stations[index].text[RDS_RTP_TEXT_MAX] = '\0';
+};
+
+bool RTPlusProcessor::clearItem(TRDSRTPlusStation *station) {
+    bool cleared = false;
+
+    for(byte i = 0; i < RDS_RTP_FIELDS; i++)
+        if(station->fields[i].contentType != RDS_RTP_CLASS_DUMMY &&
+           station->fields[i].contentType <= RDS_RTP_CLASS_ITEM_GENRE) {
+            station->fields[i].contentType = RDS_RTP_CLASS_DUMMY;
+            cleared = true;
+        };
+
+    return cleared;
+};
+
+bool RTPlusProcessor::applyTag(TRDSRTPlusStation *station, byte contentType,
+                               byte start, byte length) {
+    const char *first, *last;
+    TRDSRTPlusField *field = NULL;
+    char text[RDS_RTP_TEXT_MAX + 1];
+    size_t size;
+
+    if(contentType == RDS_RTP_CLASS_DUMMY)
+        return false;
+    if(contentType <= RDS_RTP_CLASS_ITEM_GENRE && !station->itemRunning)
+        return false;
+
+    //The length marker is the number of characters after the first one.
+    first = skipCharacters(station->text, start, station->eRT);
+    last = first ? skipCharacters(first, length + 1, station->eRT) : NULL;
+    if(!last)
+        return false;
+    while(first < last && *first == ' ')
+        first++;
+    while(last > first && last[-1] == ' ')
+        last--;
+    if(first == last)
+        return false;
+    size = last - first;
+    memcpy(text, first, size);
+    text[size] = '\0';
+
+    for(byte i = 0; i < RDS_RTP_FIELDS && !field; i++)
+        if(station->fields[i].contentType == contentType)
+            field = &station->fields[i];
+    for(byte i = 0; i < RDS_RTP_FIELDS && !field; i++)
+        if(station->fields[i].contentType == RDS_RTP_CLASS_DUMMY)
+            field = &station->fields[i];
+    if(!field) {
+        //All in use by other classes: recycle them in turn.
+        field = &station->fields[station->nextField];
+        station->nextField = (station->nextField + 1) % RDS_RTP_FIELDS;
+    } else if(field->contentType == contentType &&
+              !strcmp(field->text, text))
+        return false;
+
+    field->contentType = contentType;
+    memcpy(field->text, text, size + 1);
+
+    return true;
+};
+
+void RTPlusProcessor::processRTPlusGroup(word programIdentifier,
+                                         byte rTPbits1, word rTPbits2,
+                                         word rTPbits3) {
+    TRDSRTPlusMessage11 unpacked;
+    TRDSRTPlusStation *station;
+    byte index = findStation(programIdentifier, true);
+    bool changed = false;
+
+    if(index == RDS_RTP_NONE)
+        return;
+    station = &_stations[index];
+    _translator.unpackRTPlusMessage11(rTPbits1, rTPbits2, rTPbits3,
+                                      &unpacked);
+
+    if(!station->toggled || station->itemToggle != (bool)unpacked.itemToggle) {
+        //A new item started, whatever was known about the old one is stale.
+        changed = clearItem(station) || station->toggled;
+        station->toggled = true;
+        station->itemToggle = unpacked.itemToggle;
+    };
+    if(station->itemRunning != (bool)unpacked.itemRunning) {
+        station->itemRunning = unpacked.itemRunning;
+        if(!station->itemRunning)
+            clearItem(station);
+        changed = true;
+    };
+    if(station->text[0]) {
+        if(applyTag(station, unpacked.contentType1, unpacked.startMarker1,
+                    unpacked.lengthMarker1))
+            changed = true;
+        if(applyTag(station, unpacked.contentType2, unpacked.startMarker2,
+                    unpacked.lengthMarker2))
+            changed = true;
+    };
+
+    if(changed && _callback)
+        _callback(_context, station);
+};
+
+const TRDSRTPlusStation *RTPlusProcessor::getStation(word programIdentifier) {
+    byte index = findStation(programIdentifier, false);
+
+    return index == RDS_RTP_NONE ? NULL : &_stations[index];
+};
+
+const char *RTPlusProcessor::getField(word programIdentifier,
+                                      byte contentType) {
+    const TRDSRTPlusStation *station = getStation(programIdentifier);
+
+    if(!station || contentType == RDS_RTP_CLASS_DUMMY)
+        return NULL;
+    for(byte i = 0; i < RDS_RTP_FIELDS; i++)
+        if(station->fields[i].contentType == contentType)
+            return station->fields[i].text;
+
+    return NULL;
+};
@@ -0,0 +1,163 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This file contains the RT+ processor, which applies RadioText Plus tags to
+ * the RadioText (or eRT) they refer to and keeps the current item of each
+ * station.
+ */
+
+#ifndef _RTPLUSPROCESSOR_H_INCLUDED
+#define _RTPLUSPROCESSOR_H_INCLUDED
+
+#include "RDSDecoder.h"
+
+//Index value meaning "no such station"
+#define RDS_RTP_NONE 0xFF
+//Longest text tags refer to: RT is 64 characters, eRT 128 bytes of UTF-8.
+#define RDS_RTP_TEXT_MAX 128
+//Number of tagged fields remembered per station
+#define RDS_RTP_FIELDS 4
+
+typedef struct {
+    //One of RDS_RTP_CLASS_*, RDS_RTP_CLASS_DUMMY for an unused field.
+    byte contentType;
+    //UTF-8 when taken from eRT.
+    char text[RDS_RTP_TEXT_MAX + 1];
+} TRDSRTPlusField;
+
+typedef struct {
+    word programIdentifier;
+    //From Group 3A: whether the tags refer to eRT instead of RT.
+    bool eRT;
+    //Item toggle and running bits of the last Group 11A seen; toggled is
+    //false until the first one.
+    bool toggled;
+    bool itemToggle;
+    bool itemRunning;
+    char text[RDS_RTP_TEXT_MAX + 1];
+    byte nextField;
+    TRDSRTPlusField fields[RDS_RTP_FIELDS];
+} TRDSRTPlusStation;
+
+//RT+ Processor callback prototype.
+//The first parameter is the context pointer given at registration time, the
+//second points to the station whose item changed (the toggle bit flipped,
+//the running bit changed or a field got a new text).
+typedef void (*TRTPlusCallback)(void *, const TRDSRTPlusStation *);
+
+class RTPlusProcessor
+{
+    public:
+        /*
+        * Description:
+        *   Constructor, sets up the processor over caller-provided storage.
+        * Parameters:
+        *   stations - an array of capacity TRDSRTPlusStation structs.
+        *   capacity - number of elements in stations, at most 255.
+        *   callback - the function to call when the item of a station
+        *              changes, see registerCallback().
+        *   context - an opaque pointer handed back to the callback.
+        */
+        RTPlusProcessor(TRDSRTPlusStation stations[], byte capacity,
+                        TRTPlusCallback callback = NULL,
+                        void *context = NULL);
+
+        /*
+        * Description:
+        *   Registers the callback that will receive item changes. Using NULL
+        *   for the first parameter removes the current callback, if any.
+        */
+        void registerCallback(TRTPlusCallback callback = NULL,
+                              void *context = NULL);
+
+        /*
+        * Description:
+        *   Feeds the Group 3A RT+ message of a station, as received by the
+        *   RDS_CALLBACK_AID callback for the AID of RT+, which tells whether
+        *   the tags refer to RT or eRT.
+        */
+        void processRTPlusMessage3(word programIdentifier, word rTPMessage);
+
+        /*
+        * Description:
+        *   Feeds a complete RadioText or eRT of a station, e.g. the radioText
+        *   member of TRDSData when RDS_CALLBACK_RT signals that it is about
+        *   to be replaced. Text of the other kind than the one the station
+        *   tags is ignored.
+        * Parameters:
+        *   programIdentifier - the PI of the station.
+        *   text - the text, NUL-terminated, UTF-8 for eRT.
+        *   eRT - true if text is eRT.
+        */
+        void processText(word programIdentifier, const char *text,
+                         bool eRT = false);
+
+        /*
+        * Description:
+        *   Feeds a Group 11A RT+ message of a station, with the arguments
+        *   of an RDS_CALLBACK_RTP callback. Both tags are applied to the
+        *   last text fed; tags pointing past its end or at blanks only are
+        *   ignored, as they refer to a text not completely received yet.
+        * Parameters:
+        *   programIdentifier - the PI of the station.
+        *   rTPbits1, rTPbits2, rTPbits3 - as for
+        *                   RDSTranslator::unpackRTPlusMessage11().
+        */
+        void processRTPlusGroup(word programIdentifier, byte rTPbits1,
+                                word rTPbits2, word rTPbits3);
+
+        /*
+        * Description:
+        *   Return the station record of a PI, NULL if not known, and the text
+        *   of one of its fields by content type, NULL if not known (this
+        *   includes item fields while no item is running).
+        */
+        const TRDSRTPlusStation *getStation(word programIdentifier);
+        const char *getField(word programIdentifier, byte contentType);
+
+        /*
+        * Description:
+        *   Forgets all the stations.
+        */
+        void reset(void);
+
+    private:
+        RDSTranslator _translator;
+        TRDSRTPlusStation *_stations;
+        byte _capacity;
+        byte _count;
+        byte _last;
+        TRTPlusCallback _callback;
+        void *_context;
+
+        /*
+        * Description:
+        *   Finds a station by PI, adding it if asked to and there is room.
+        *   Returns RDS_RTP_NONE if not found.
+        */
+        byte findStation(word programIdentifier, bool add);
+
+        /*
+        * Description:
+        *   Forgets the fields of the item classes (title through genre).
+        * Returns:
+        *   true if there were any.
+        */
+        bool clearItem(TRDSRTPlusStation *station);
+
+        /*
+        * Description:
+        *   Applies one tag to the text of a station.
+        * Returns:
+        *   true if a field changed.
+        */
+        bool applyTag(TRDSRTPlusStation *station, byte contentType,
+                      byte start, byte length);
+};
+
+#endif
@@ -0,0 +1,141 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This is the code file for the TMC multi-group message reassembly engine.
+ * See the header file for better function documentation.
+ */
+
+#include "TMCAssembler.h"
+
+#include <string.h>
+
+TMCAssembler::TMCAssembler(TTMCMessageCallback callback, void *context) {
+    registerCallback(callback, context);
+    reset();
+}
+
+void TMCAssembler::registerCallback(TTMCMessageCallback callback,
+                                    void *context) {
+    _callback = callback;
+    _context = context;
+};
+
+void TMCAssembler::reset(void) {
+    memset(_slots, 0x00, sizeof(_slots));
+};
+
+void TMCAssembler::decodeTMCGroup(byte tmcXbits, word tmcYbits,
+                                  word tmcZbits) {
+    TRDSTMCMessage8 unpacked;
+    TRDSTMCAssemblySlot *slot;
+
+    memset(&unpacked, 0x00, sizeof(unpacked));
+    _translator.unpackTMCMessage8(tmcXbits, tmcYbits, tmcZbits, &unpacked);
+    if(unpacked.systemMessage)
+        return;
+
+    if(unpacked.single) {
+        TRDSTMCDecodedMessage message;
+
+        if(!_callback)
+            return;
+        memset(&message, 0x00, sizeof(message));
+        message.single = true;
+        message.duration = unpacked.duration;
+        message.diversion = unpacked.diversion;
+        message.direction = unpacked.direction;
+        message.extent = unpacked.extent;
+        message.event = unpacked.event;
+        message.location = unpacked.location;
+        _callback(_context, &message);
+        return;
+    };
+
+    //CI of zero is the encryption administration group, not a message.
+    if(!unpacked.continuationIndicator)
+        return;
+    slot = &_slots[unpacked.continuationIndicator - 1];
+
+    if(unpacked.first) {
+        //A first group always (re)starts the message, even if a previous one
+        //with the same CI never completed.
+        memset(slot, 0x00, sizeof(*slot));
+        slot->received = 1;
+        slot->direction = unpacked.direction;
+        slot->extent = unpacked.extent;
+        slot->event = unpacked.event;
+        slot->location = unpacked.location;
+        return;
+    };
+
+    if(unpacked.second) {
+        if(slot->received != 1) {
+            //Second group without a first one, or a repeat of the second
+            //group in the middle of the sequence: start over.
+            slot->received = 0;
+            return;
+        };
+    } else if(slot->received < 2 || slot->received > 4 ||
+              unpacked.sequence != slot->sequence - 1) {
+        //Missed a group: the message cannot be completed anymore.
+        slot->received = 0;
+        return;
+    };
+
+    slot->slices[slot->received - 1] = unpacked.data;
+    slot->sequence = unpacked.sequence;
+    slot->received++;
+    if(!unpacked.sequence) {
+        emitMultiGroup(slot);
+        slot->received = 0;
+    };
+};
+
+void TMCAssembler::emitMultiGroup(TRDSTMCAssemblySlot *slot) {
+    TRDSTMCDecodedMessage message;
+    uint32_t container[4];
+
+    if(!_callback)
+        return;
+
+    memset(&message, 0x00, sizeof(message));
+    message.direction = slot->direction;
+    message.extent = slot->extent;
+    message.event = slot->event;
+    message.location = slot->location;
+
+    memcpy(container, slot->slices, sizeof(container));
+    _translator.glueTMCContainerSlices(container);
+    _translator.adjustTMCContainerForFLT(container, &message.location,
+                                         &message.foreignTable);
+    message.foreignLocation = (message.foreignTable.magic != 0);
+
+    message.labelCount = _translator.decodeAllTMCLabels(container,
+                                                        message.labels,
+                                                        RDS_TMC_LABELS_MAX);
+    for(byte i = 0; i < message.labelCount; i++) {
+        const TRDSTMCLabel *label = &message.labels[i];
+
+        switch(label->type) {
+            case RDS_TMC_LABEL_DURATION:
+                message.duration = label->value;
+                break;
+            case RDS_TMC_LABEL_CONTROL:
+                message.controls |= (0x1 << label->value);
+                if(label->value == RDS_TMC_L1_DIVERSION)
+                    message.diversion = true;
+                else if(label->value == RDS_TMC_L1_EXTENT_ADD8)
+                    message.extent += 8;
+                else if(label->value == RDS_TMC_L1_EXTENT_ADD16)
+                    message.extent += 16;
+                break;
+        };
+    };
+
+    _callback(_context, &message);
+};
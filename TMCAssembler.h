@@ -0,0 +1,120 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This file contains the TMC multi-group message reassembly engine.
+ */
+
+#ifndef _TMCASSEMBLER_H_INCLUDED
+#define _TMCASSEMBLER_H_INCLUDED
+
+#include "RDSDecoder.h"
+
+//A multi-group message has at most 4 subsequent groups of 28 bits each, the
+//smallest label (Label 14) takes 4 bits: this bounds the label count.
+#define RDS_TMC_LABELS_MAX 28
+//Continuity indexes 1 through 7 identify multi-group messages in progress,
+//zero is reserved for the encryption administration group.
+#define RDS_TMC_CI_SLOTS 7
+
+//This holds one complete TMC message, as reassembled from one single group
+//or from all the groups of a multi-group message. Fields carried in labels
+//(duration, diversion and extent increments) have already been applied.
+typedef struct {
+    bool single;
+    bool diversion;
+    bool direction;
+    byte duration;
+    byte extent;
+    word event;
+    word location;
+    byte controls;
+    bool foreignLocation;
+    TRDSTMCFLT foreignTable;
+    byte labelCount;
+    TRDSTMCLabel labels[RDS_TMC_LABELS_MAX];
+} TRDSTMCDecodedMessage;
+
+typedef struct {
+    byte received;
+    byte sequence;
+    bool direction;
+    byte extent;
+    word event;
+    word location;
+    uint32_t slices[4];
+} TRDSTMCAssemblySlot;
+
+//TMC Assembler callback prototype.
+//The first parameter is the context pointer given at registration time, the
+//second points to the reassembled message which is only valid for the
+//duration of the call.
+typedef void (*TTMCMessageCallback)(void *, const TRDSTMCDecodedMessage *);
+
+class TMCAssembler
+{
+    public:
+        /*
+        * Description:
+        *   Default constructor, optionally registers the callback that will
+        *   receive complete messages.
+        */
+        TMCAssembler(TTMCMessageCallback callback = NULL,
+                     void *context = NULL);
+
+        /*
+        * Description:
+        *   Registers the callback that will receive complete messages. Using
+        *   NULL for the first parameter removes the current callback, if any.
+        * Parameters:
+        *   callback - the function to call for every complete message.
+        *   context - an opaque pointer handed back as the first argument of
+        *             every callback invocation, use it to tell services apart
+        *             when running one assembler per TMC service.
+        */
+        void registerCallback(TTMCMessageCallback callback = NULL,
+                              void *context = NULL);
+
+        /*
+        * Description:
+        *   Feeds one TMC group into the assembler. The arguments are exactly
+        *   the ones passed to an RDS_CALLBACK_TMC callback, so it can be
+        *   called straight from there. Single-group messages are emitted
+        *   immediately, multi-group messages once their last group (GSI of
+        *   zero) has been received in sequence. System and encryption
+        *   administration messages are ignored.
+        * Parameters:
+        *   tmcXbits - a byte containing bits X4-X0 of the TMC message.
+        *   tmcYbits - a word containing bits Y15-Y0 of the TMC message.
+        *   tmcZbits - a word containing bits Z15-Z0 of the TMC message.
+        */
+        void decodeTMCGroup(byte tmcXbits, word tmcYbits, word tmcZbits);
+
+        /*
+        * Description:
+        *   Drops all partially assembled messages, use when switching to a new
+        *   station.
+        */
+        void reset(void);
+
+    private:
+        RDSTranslator _translator;
+        TRDSTMCAssemblySlot _slots[RDS_TMC_CI_SLOTS];
+        TTMCMessageCallback _callback;
+        void *_context;
+
+        /*
+        * Description:
+        *   Decodes the container of a fully received multi-group message and
+        *   hands the result to the callback.
+        * Parameters:
+        *   slot - pointer to the TRDSTMCAssemblySlot holding the message.
+        */
+        void emitMultiGroup(TRDSTMCAssemblySlot *slot);
+};
+
+#endif
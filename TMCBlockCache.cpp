@@ -0,0 +1,94 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This is the code file for the TMC block cache.
+ * See the header file for better function documentation.
+ */
+
+#include "TMCBlockCache.h"
+
+#include <string.h>
+
+TMCBlockCache::TMCBlockCache(TRDSTMCCachePage pages[], word capacity) {
+    _pages = pages;
+    _sets = capacity / RDS_TMC_CACHE_WAYS;
+    reset();
+};
+
+void TMCBlockCache::reset(void) {
+    //lastUsed == 0 marks unused pages, as the clock starts at 1.
+    memset(_pages, 0x00,
+           sizeof(TRDSTMCCachePage) * _sets * RDS_TMC_CACHE_WAYS);
+    _clock = 0;
+    _hits = 0;
+    _misses = 0;
+};
+
+TRDSTMCCachePage *TMCBlockCache::lookup(TBlockFetcher fetcher,
+                                        uintptr_t page) {
+    //Multiplicative hashing of the page number, with the fetcher mixed in so
+    //that the same addresses of different fetchers spread too.
+    uint32_t hash = (uint32_t)((page / RDS_TMC_CACHE_PAGE_SIZE) ^
+                               (uintptr_t)fetcher) * 0x9E3779B1UL;
+    TRDSTMCCachePage *set = &_pages[(hash >> 16) % _sets * RDS_TMC_CACHE_WAYS];
+    TRDSTMCCachePage *victim = &set[0];
+    uint32_t oldest = 0;
+
+    //Zero is reserved for unused pages, skip it when wrapping around.
+    if(!++_clock)
+        _clock++;
+    for(byte i = 0; i < RDS_TMC_CACHE_WAYS; i++) {
+        //Unused pages count as infinitely old.
+        uint32_t age = set[i].lastUsed ? _clock - set[i].lastUsed : 0xFFFFFFFF;
+
+        if(set[i].lastUsed && set[i].page == page &&
+           set[i].fetcher == fetcher) {
+            set[i].lastUsed = _clock;
+            _hits++;
+            return &set[i];
+        };
+        if(age > oldest) {
+            oldest = age;
+            victim = &set[i];
+        };
+    };
+
+    fetcher((const void *)page, victim->data, RDS_TMC_CACHE_PAGE_SIZE);
+    victim->fetcher = fetcher;
+    victim->page = page;
+    victim->lastUsed = _clock;
+    _misses++;
+
+    return victim;
+};
+
+void TMCBlockCache::fetch(TBlockFetcher fetcher, const void *source,
+                          void *destination, size_t size) {
+    uintptr_t address = (uintptr_t)source;
+    byte *out = (byte *)destination;
+
+    if(!fetcher)
+        return;
+    if(!_sets) {
+        fetcher(source, destination, size);
+        return;
+    };
+
+    while(size) {
+        uintptr_t page = address & ~(uintptr_t)(RDS_TMC_CACHE_PAGE_SIZE - 1);
+        size_t offset = address - page;
+        size_t count = RDS_TMC_CACHE_PAGE_SIZE - offset;
+
+        if(count > size)
+            count = size;
+        memcpy(out, &lookup(fetcher, page)->data[offset], count);
+        out += count;
+        address += count;
+        size -= count;
+    };
+};
@@ -0,0 +1,99 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This file contains the TMC block cache, which keeps recently read pages of
+ * slow storage (e.g. an external SPI EEPROM or flash, or a table image on a
+ * network filesystem) in RAM in front of one or more TBlockFetcher functions.
+ */
+
+#ifndef _TMCBLOCKCACHE_H_INCLUDED
+#define _TMCBLOCKCACHE_H_INCLUDED
+
+#include "RDSDecoder.h"
+
+//Size in bytes of a cached page, a power of two. Reads from the backing
+//fetcher are always whole, aligned pages. String reads come in blocks of the
+//same size, so each one takes a single page.
+#define RDS_TMC_CACHE_PAGE_SIZE RDS_TMC_STRING_FETCH_BLOCK
+//Number of pages sharing one set; the least recently used one is evicted when
+//a new page maps to a full set.
+#define RDS_TMC_CACHE_WAYS 4
+
+typedef struct {
+    TBlockFetcher fetcher;
+    uintptr_t page;
+    uint32_t lastUsed;
+    byte data[RDS_TMC_CACHE_PAGE_SIZE];
+} TRDSTMCCachePage;
+
+/* Defines a TBlockFetcher named name that reads through cache (a
+ * TMCBlockCache) from fetcher, for use wherever a TBlockFetcher is expected.
+ * TBlockFetcher has no context argument, hence one such function per backing
+ * fetcher.
+ */
+#define RDS_TMC_CACHED_FETCHER(name, cache, fetcher) \
+    static void name(const void *source, void *destination, size_t size) { \
+        (cache).fetch((fetcher), source, destination, size); \
+    }
+
+class TMCBlockCache
+{
+    public:
+        /*
+        * Description:
+        *   Constructor, sets up the cache over caller-provided storage.
+        * Parameters:
+        *   pages - an array of capacity TRDSTMCCachePage structs.
+        *   capacity - number of elements in pages, rounded down to a multiple
+        *              of RDS_TMC_CACHE_WAYS.
+        */
+        TMCBlockCache(TRDSTMCCachePage pages[], word capacity);
+
+        /*
+        * Description:
+        *   Reads a block through the cache. Pages missing from the cache are
+        *   read whole from fetcher, so it must tolerate being asked for up
+        *   to RDS_TMC_CACHE_PAGE_SIZE - 1 bytes past the end of its data.
+        *   Several fetchers (i.e. address spaces) may share one cache.
+        * Parameters:
+        *   fetcher - the backing fetcher.
+        *   source, destination, size - as for any TBlockFetcher.
+        */
+        void fetch(TBlockFetcher fetcher, const void *source, void *destination,
+                   size_t size);
+
+        /*
+        * Description:
+        *   Return the number of page lookups that hit and missed the cache
+        *   so far.
+        */
+        uint32_t getHits(void) { return _hits; }
+        uint32_t getMisses(void) { return _misses; }
+
+        /*
+        * Description:
+        *   Drops all the cached pages (e.g. after the backing storage was
+        *   rewritten) and zeroes the counters.
+        */
+        void reset(void);
+
+    private:
+        TRDSTMCCachePage *_pages;
+        word _sets;
+        uint32_t _clock;
+        uint32_t _hits;
+        uint32_t _misses;
+
+        /*
+        * Description:
+        *   Returns the cached copy of a page, reading it in if needed.
+        */
+        TRDSTMCCachePage *lookup(TBlockFetcher fetcher, uintptr_t page);
+};
+
+#endif
@@ -0,0 +1,136 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This is the code file for the TMC duplicate message filter.
+ * See the header file for better function documentation.
+ */
+
+#include "TMCDeduplicator.h"
+
+#include <string.h>
+
+TMCDeduplicator::TMCDeduplicator(TRDSTMCDedupEntry entries[], word capacity,
+                                 uint32_t window) {
+    _entries = entries;
+    _buckets = capacity / RDS_TMC_DEDUP_WAYS;
+    _window = window;
+    reset();
+};
+
+void TMCDeduplicator::reset(void) {
+    memset(_entries, 0x00,
+           sizeof(TRDSTMCDedupEntry) * _buckets * RDS_TMC_DEDUP_WAYS);
+    _forwarded = 0;
+    _suppressed = 0;
+};
+
+//One FNV-1a round per byte of value.
+static uint64_t mix(uint64_t hash, uint32_t value, byte bytes) {
+    while(bytes--) {
+        hash = (hash ^ (value & 0xFF)) * 0x100000001B3ULL;
+        value >>= 8;
+    };
+
+    return hash;
+};
+
+uint64_t TMCDeduplicator::makeKey(byte serviceIdentifier,
+                                  byte locationTableNumber,
+                                  const TRDSTMCDecodedMessage *message) {
+    uint64_t hash = 0xCBF29CE484222325ULL;
+
+    //Fields one at a time, the padding in between is undefined.
+    hash = mix(hash, serviceIdentifier, 1);
+    hash = mix(hash, locationTableNumber, 1);
+    hash = mix(hash, message->single | (message->diversion << 1) |
+                     (message->direction << 2) |
+                     (message->foreignLocation << 3), 1);
+    hash = mix(hash, message->duration, 1);
+    hash = mix(hash, message->extent, 1);
+    hash = mix(hash, message->event, 2);
+    hash = mix(hash, message->location, 2);
+    hash = mix(hash, message->controls, 1);
+    if(message->foreignLocation)
+        hash = mix(hash, (message->foreignTable.country << 6) |
+                         message->foreignTable.locationTableNumber, 2);
+    hash = mix(hash, message->labelCount, 1);
+    for(byte i = 0; i < message->labelCount && i < RDS_TMC_LABELS_MAX; i++) {
+        hash = mix(hash, message->labels[i].type, 1);
+        hash = mix(hash, message->labels[i].value, 2);
+    };
+
+    //Bit 63 set guarantees a non-zero key.
+    return hash | (1ULL << 63);
+};
+
+TRDSTMCDedupEntry *TMCDeduplicator::bucketFor(uint64_t key) {
+    //Multiplicative hashing, the high half has the best mixed bits.
+    uint32_t hash = (key * 0x9E3779B97F4A7C15ULL) >> 32;
+
+    return &_entries[(hash % _buckets) * RDS_TMC_DEDUP_WAYS];
+};
+
+bool TMCDeduplicator::accept(byte serviceIdentifier, byte locationTableNumber,
+                             const TRDSTMCDecodedMessage *message,
+                             uint32_t now) {
+    uint64_t key;
+    TRDSTMCDedupEntry *bucket, *victim;
+    uint32_t oldest = 0;
+
+    if(!(_buckets && message))
+        return true;
+
+    key = makeKey(serviceIdentifier, locationTableNumber, message);
+    bucket = bucketFor(key);
+    victim = &bucket[0];
+    for(byte i = 0; i < RDS_TMC_DEDUP_WAYS; i++) {
+        //Unused entries count as infinitely old.
+        uint32_t age = bucket[i].key ? now - bucket[i].firstSeen : 0xFFFFFFFF;
+
+        if(bucket[i].key == key) {
+            if(now - bucket[i].firstSeen < _window) {
+                if(bucket[i].repeats < 0xFFFF)
+                    bucket[i].repeats++;
+                _suppressed++;
+                return false;
+            };
+            //Window passed: forward again and restart it.
+            victim = &bucket[i];
+            break;
+        };
+        if(age > oldest) {
+            oldest = age;
+            victim = &bucket[i];
+        };
+    };
+
+    victim->key = key;
+    victim->firstSeen = now;
+    victim->repeats = 0;
+    _forwarded++;
+
+    return true;
+};
+
+word TMCDeduplicator::getRepeats(byte serviceIdentifier,
+                                 byte locationTableNumber,
+                                 const TRDSTMCDecodedMessage *message) {
+    uint64_t key;
+    TRDSTMCDedupEntry *bucket;
+
+    if(!(_buckets && message))
+        return 0;
+
+    key = makeKey(serviceIdentifier, locationTableNumber, message);
+    bucket = bucketFor(key);
+    for(byte i = 0; i < RDS_TMC_DEDUP_WAYS; i++)
+        if(bucket[i].key == key)
+            return bucket[i].repeats;
+
+    return 0;
+};
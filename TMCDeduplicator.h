@@ -0,0 +1,114 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This file contains the TMC duplicate message filter, which drops the
+ * repeats of TMC messages received from the same service on the same or on
+ * different transmitters.
+ */
+
+#ifndef _TMCDEDUPLICATOR_H_INCLUDED
+#define _TMCDEDUPLICATOR_H_INCLUDED
+
+#include "RDSDecoder.h"
+#include "TMCAssembler.h"
+
+//Number of entries sharing one hash bucket; the oldest one is evicted when a
+//new message hashes to a full bucket.
+#define RDS_TMC_DEDUP_WAYS 4
+
+typedef struct {
+    uint64_t key;
+    uint32_t firstSeen;
+    word repeats;
+} TRDSTMCDedupEntry;
+
+class TMCDeduplicator
+{
+    public:
+        /*
+        * Description:
+        *   Constructor, sets up the filter over caller-provided storage.
+        * Parameters:
+        *   entries - an array of capacity TRDSTMCDedupEntry structs. Its size
+        *             bounds the number of distinct messages remembered within
+        *             one window.
+        *   capacity - number of elements in entries, rounded down to a
+        *              multiple of RDS_TMC_DEDUP_WAYS.
+        *   window - for how long after forwarding a message its copies are
+        *            suppressed, in the same unit as the now argument of
+        *            accept(). The window is not extended by the copies
+        *            themselves, so that a cyclically repeated message is
+        *            forwarded again once per window and downstream expiry
+        *            keeps being refreshed.
+        */
+        TMCDeduplicator(TRDSTMCDedupEntry entries[], word capacity,
+                        uint32_t window);
+
+        /*
+        * Description:
+        *   Decides whether a TMC message is seen for the first time within
+        *   the window. Call it from the TMCAssembler callback, so that
+        *   multi-group messages are accepted or rejected as a whole: a copy
+        *   whose groups were not all received never reaches the filter and
+        *   the next complete copy is forwarded.
+        * Parameters:
+        *   serviceIdentifier - the SID of the TMC service (from group 3A).
+        *   locationTableNumber - the LTN of the TMC service (from group 3A).
+        *   message - pointer to the assembled message.
+        *   now - current time, any monotonic unit (e.g. seconds).
+        * Returns:
+        *   true if the message should be forwarded, false if it is a repeat.
+        */
+        bool accept(byte serviceIdentifier, byte locationTableNumber,
+                    const TRDSTMCDecodedMessage *message, uint32_t now);
+
+        /*
+        * Description:
+        *   Returns the number of repeats suppressed for the given message
+        *   since it was last forwarded, or 0 if it is not remembered anymore.
+        */
+        word getRepeats(byte serviceIdentifier, byte locationTableNumber,
+                        const TRDSTMCDecodedMessage *message);
+
+        /*
+        * Description:
+        *   Return the total number of messages forwarded and suppressed so
+        *   far.
+        */
+        uint32_t getForwarded(void) { return _forwarded; }
+        uint32_t getSuppressed(void) { return _suppressed; }
+
+        /*
+        * Description:
+        *   Forgets all the messages seen so far and zeroes the counters.
+        */
+        void reset(void);
+
+    private:
+        TRDSTMCDedupEntry *_entries;
+        word _buckets;
+        uint32_t _window;
+        uint32_t _forwarded;
+        uint32_t _suppressed;
+
+        /*
+        * Description:
+        *   Hashes the service and every field of a message into a key. Zero
+        *   is never returned, as it marks unused entries.
+        */
+        uint64_t makeKey(byte serviceIdentifier, byte locationTableNumber,
+                         const TRDSTMCDecodedMessage *message);
+
+        /*
+        * Description:
+        *   Returns the first entry of the bucket a key belongs to.
+        */
+        TRDSTMCDedupEntry *bucketFor(uint64_t key);
+};
+
+#endif
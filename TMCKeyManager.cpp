@@ -0,0 +1,146 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This is the code file for the encrypted TMC key manager.
+ * See the header file for better function documentation.
+ */
+
+#include "TMCKeyManager.h"
+
+#include <string.h>
+
+#if defined(__GNUC__)
+# if defined(__AVR__)
+#  include <avr/pgmspace.h>
+# elif defined(__i386__) || defined(__x86_64__)
+#  define pgm_read_word(x) (uint16_t)(*x)
+# endif
+#endif
+
+#if defined(__SSE2__)
+# include <emmintrin.h>
+#endif
+
+TMCKeyManager::TMCKeyManager(TRDSTMCServiceKey services[], byte capacity) {
+    _services = services;
+    _capacity = capacity;
+    _count = 0;
+};
+
+TRDSTMCServiceKey *TMCKeyManager::findService(byte serviceIdentifier) {
+    for(byte i = 0; i < _count; i++)
+        if(_services[i].serviceIdentifier == serviceIdentifier)
+            return &_services[i];
+
+    return NULL;
+};
+
+bool TMCKeyManager::addService(byte serviceIdentifier, const word keys[],
+                               bool in_flash) {
+    TRDSTMCServiceKey *service = findService(serviceIdentifier);
+
+    if(!keys)
+        return false;
+    if(!service) {
+        if(_count >= _capacity)
+            return false;
+        service = &_services[_count++];
+    };
+
+    memset(service, 0x00, sizeof(*service));
+    service->keys = keys;
+    service->inFlash = in_flash;
+    service->serviceIdentifier = serviceIdentifier;
+    service->encId = RDS_TMC_KEY_NO_ENCID;
+
+    return true;
+};
+
+bool TMCKeyManager::processGroup(byte tmcXbits, word tmcYbits,
+                                 word tmcZbits) {
+    TRDSTMCMessage8 unpacked;
+    TRDSTMCServiceKey *service;
+    word key;
+
+    _translator.unpackTMCMessage8(tmcXbits, tmcYbits, tmcZbits, &unpacked);
+    //The encryption administration group is a multi-group message with CI 0.
+    if(unpacked.systemMessage || unpacked.single ||
+       unpacked.continuationIndicator ||
+       unpacked.encVariantCode != RDS_TMC_MESSAGE_ENC_VARIANT_EAG)
+        return false;
+    service = findService(unpacked.encServiceIdentifier);
+    if(!service)
+        return false;
+
+    service->test = unpacked.test;
+    if(service->encId == unpacked.encId &&
+       service->locationTableNumber == unpacked.encLocationTableNumber)
+        //Same parameters as last time, nothing to look up.
+        return true;
+
+    service->encId = unpacked.encId;
+    service->locationTableNumber = unpacked.encLocationTableNumber;
+    key = service->inFlash ? pgm_read_word(&service->keys[service->encId]) :
+                             service->keys[service->encId];
+    service->xorValue = key >> 8;
+    service->start = (key & 0x00F0) >> 4;
+    service->rol = key & 0x000F;
+
+    return true;
+};
+
+const TRDSTMCServiceKey *TMCKeyManager::getServiceKey(byte serviceIdentifier) {
+    TRDSTMCServiceKey *service = findService(serviceIdentifier);
+
+    return (service && service->encId != RDS_TMC_KEY_NO_ENCID) ? service :
+                                                                 NULL;
+};
+
+bool TMCKeyManager::decryptLocations(byte serviceIdentifier, word locations[],
+                                     size_t count) {
+    const TRDSTMCServiceKey *service = getServiceKey(serviceIdentifier);
+
+    if(!(service && locations))
+        return false;
+    decryptLocations(service->xorValue, service->start, service->rol,
+                     locations, count);
+
+    return true;
+};
+
+void TMCKeyManager::decryptLocations(byte xorValue, byte start, byte rol,
+                                     word locations[], size_t count) {
+    word mask = word(xorValue) << start;
+    size_t i = 0;
+
+    rol &= 0x0F;
+#if defined(__SSE2__)
+    const __m128i xorMask = _mm_set1_epi16((short)mask);
+    const __m128i left = _mm_cvtsi32_si128(rol);
+    const __m128i right = _mm_cvtsi32_si128(16 - rol);
+
+    for(; i + 8 <= count; i += 8) {
+        __m128i block = _mm_loadu_si128((const __m128i *)&locations[i]);
+
+        block = _mm_xor_si128(block, xorMask);
+        block = _mm_or_si128(_mm_sll_epi16(block, left),
+                             _mm_srl_epi16(block, right));
+        _mm_storeu_si128((__m128i *)&locations[i], block);
+    };
+#endif
+    for(; i < count; i++) {
+        word result = mask ^ locations[i];
+
+        locations[i] = (result >> (16 - rol)) | (result << rol);
+    };
+};
+
+void TMCKeyManager::reset(void) {
+    for(byte i = 0; i < _count; i++)
+        _services[i].encId = RDS_TMC_KEY_NO_ENCID;
+};
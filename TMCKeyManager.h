@@ -0,0 +1,129 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This file contains the encrypted TMC (ISO 14819-6) key manager, which
+ * follows the encryption administration groups of the licensed services and
+ * decrypts their location codes.
+ */
+
+#ifndef _TMCKEYMANAGER_H_INCLUDED
+#define _TMCKEYMANAGER_H_INCLUDED
+
+#include "RDSDecoder.h"
+
+//TRDSTMCServiceKey.encId value meaning "no encryption administration group
+//seen yet"
+#define RDS_TMC_KEY_NO_ENCID 0xFF
+
+typedef struct {
+    //The Service Key: 32 words of packed decryption parameters, in the order
+    //given in ISO 14819-6 Table 4, indexed by encId.
+    const word *keys;
+    bool inFlash;
+    byte serviceIdentifier;
+    //From the latest encryption administration group of the service.
+    byte test;
+    byte locationTableNumber;
+    byte encId;
+    //Decoded from keys[encId].
+    byte xorValue;
+    byte start;
+    byte rol;
+} TRDSTMCServiceKey;
+
+class TMCKeyManager
+{
+    public:
+        /*
+        * Description:
+        *   Constructor, sets up the key manager over caller-provided storage.
+        * Parameters:
+        *   services - an array of capacity TRDSTMCServiceKey structs, one
+        *              per licensed service.
+        *   capacity - number of elements in services.
+        */
+        TMCKeyManager(TRDSTMCServiceKey services[], byte capacity);
+
+        /*
+        * Description:
+        *   Registers the Service Key of a licensed service, replacing the one
+        *   already registered for the same SID, if any.
+        * Parameters:
+        *   serviceIdentifier - the SID of the service.
+        *   keys - the Service Key, an array of 32 words as for
+        *          RDSTranslator::decryptLocation().
+        *   in_flash - true if keys is in Flash as opposed to RAM.
+        * Returns:
+        *   true on success, false if there is no room left.
+        */
+        bool addService(byte serviceIdentifier, const word keys[],
+                        bool in_flash = false);
+
+        /*
+        * Description:
+        *   Feeds a TMC group, as received by the RDS_CALLBACK_TMC callback.
+        *   Encryption administration groups (Group 8A, CI 0) of registered
+        *   services select the decryption parameters used for the messages
+        *   that follow; anything else is ignored. The parameters are only
+        *   looked up again when SID, LTNBE or encId change.
+        * Returns:
+        *   true if the group was an encryption administration group of a
+        *   registered service, false otherwise.
+        */
+        bool processGroup(byte tmcXbits, word tmcYbits, word tmcZbits);
+
+        /*
+        * Description:
+        *   Returns the current key state of a service, or NULL if the service
+        *   is not registered or no encryption administration group of it was
+        *   seen yet. locationTableNumber is the LTNBE, the LTN to use for
+        *   the decrypted locations.
+        */
+        const TRDSTMCServiceKey *getServiceKey(byte serviceIdentifier);
+
+        /*
+        * Description:
+        *   Decrypts the location codes of a service in place, see
+        *   decryptLocations() below.
+        * Returns:
+        *   true if they were decrypted, false if there is no key for the
+        *   service yet (in which case they are left alone).
+        */
+        bool decryptLocations(byte serviceIdentifier, word locations[],
+                              size_t count);
+
+        /*
+        * Description:
+        *   Decrypts an array of location codes in place, according to
+        *   ISO 14819-6 §9.4 like RDSTranslator::decryptLocation(), eight at
+        *   a time where SSE2 is available.
+        */
+        static void decryptLocations(byte xorValue, byte start, byte rol,
+                                     word locations[], size_t count);
+
+        /*
+        * Description:
+        *   Forgets the encryption administration groups seen so far, keeping
+        *   the registered services.
+        */
+        void reset(void);
+
+    private:
+        RDSTranslator _translator;
+        TRDSTMCServiceKey *_services;
+        byte _capacity;
+        byte _count;
+
+        /*
+        * Description:
+        *   Returns the entry of a registered service, NULL if none.
+        */
+        TRDSTMCServiceKey *findService(byte serviceIdentifier);
+};
+
+#endif
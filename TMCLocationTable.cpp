@@ -0,0 +1,976 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This is the code file for the ISO 14819-3 location table database.
+ * See the header file for better function documentation.
+ */
+
+#include "TMCLocationTable.h"
+
+#if defined(__i386__) || defined(__x86_64__)
+
+#include <ctype.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define EXCHANGE_LINE_MAX 4096
+#define EXCHANGE_FIELDS_MAX 64
+#define EXCHANGE_PATH_MAX 1024
+
+typedef struct {
+    FILE *file;
+    char delimiter;
+    char header[EXCHANGE_LINE_MAX];
+    char *columns[EXCHANGE_FIELDS_MAX];
+    byte columnCount;
+    char line[EXCHANGE_LINE_MAX];
+    char *fields[EXCHANGE_FIELDS_MAX];
+    byte fieldCount;
+} TExchangeFile;
+
+typedef struct {
+    uint8_t countryId;
+    uint16_t nameId;
+    uint32_t sequence;
+    uint32_t string;
+} TExchangeName;
+
+//Everything being compiled, grown with realloc() as the files are read.
+typedef struct {
+    TRDSTMCLocationCountry *countries;
+    uint32_t countryCount, countryCapacity;
+    TExchangeName *names;
+    uint32_t nameCount, nameCapacity;
+    TRDSTMCLocation *records;
+    uint32_t recordCount, recordCapacity;
+    TRDSTMCLocationTableInfo *tables;
+    uint32_t tableCount, tableCapacity;
+    uint32_t *index;
+    uint32_t indexCount;
+    uint32_t *chains;
+    TRDSTMCLocationRun *runs;
+    uint32_t chainCount;
+    char *strings;
+    uint32_t stringsSize, stringsCapacity;
+} TExchangeImage;
+
+//Makes room for one more element in a growable array.
+static bool grow(void **array, uint32_t *capacity, uint32_t count,
+                 size_t size) {
+    void *grown;
+
+    if(count < *capacity)
+        return true;
+    grown = realloc(*array, (*capacity ? *capacity * 2 : 256) * size);
+    if(!grown)
+        return false;
+    *array = grown;
+    *capacity = *capacity ? *capacity * 2 : 256;
+
+    return true;
+};
+
+//Splits a line in place, honouring (and removing) double quotes as written by
+//CSV exporters. Returns the number of fields found.
+static byte splitLine(char *line, char delimiter, char *fields[]) {
+    byte count = 0;
+    char *in = line, *out;
+
+    line[strcspn(line, "\r\n")] = '\0';
+    if(!*line)
+        return 0;
+    while(count < EXCHANGE_FIELDS_MAX) {
+        bool quoted = (*in == '"');
+
+        fields[count++] = out = in;
+        if(quoted)
+            in++;
+        while(*in) {
+            if(quoted && *in == '"') {
+                if(in[1] == '"')
+                    in++;
+                else {
+                    quoted = false;
+                    in++;
+                    continue;
+                };
+            } else if(!quoted && *in == delimiter)
+                break;
+            *out++ = *in++;
+        };
+        if(!*in) {
+            *out = '\0';
+            break;
+        };
+        *out = '\0';
+        in++;
+    };
+
+    return count;
+};
+
+//Opens an exchange file and reads its header row. Both the upper case name
+//from the standard and its lower case variant are tried.
+static bool openExchange(const char *directory, const char *name,
+                         TExchangeFile *exchange) {
+    char path[EXCHANGE_PATH_MAX];
+    char *header;
+
+    snprintf(path, sizeof(path), "%s/%s", directory, name);
+    exchange->file = fopen(path, "r");
+    if(!exchange->file) {
+        for(char *p = path + strlen(directory) + 1; *p; p++)
+            *p = tolower(*p);
+        exchange->file = fopen(path, "r");
+    };
+    if(!exchange->file)
+        return false;
+
+    if(!fgets(exchange->header, sizeof(exchange->header), exchange->file)) {
+        fclose(exchange->file);
+        return false;
+    };
+    header = exchange->header;
+    //Skip a UTF-8 BOM, some exporters add one.
+    if(!strncmp(header, "\xEF\xBB\xBF", 3))
+        header += 3;
+    exchange->delimiter = strchr(header, ';') ? ';' : ',';
+    exchange->columnCount = splitLine(header, exchange->delimiter,
+                                      exchange->columns);
+    for(byte i = 0; i < exchange->columnCount; i++)
+        for(char *p = exchange->columns[i]; *p; p++)
+            *p = toupper(*p);
+    exchange->fieldCount = 0;
+
+    return true;
+};
+
+//Returns the index of the named column, or -1 if the file does not have it.
+static int column(const TExchangeFile *exchange, const char *name) {
+    for(byte i = 0; i < exchange->columnCount; i++)
+        if(!strcmp(exchange->columns[i], name))
+            return i;
+
+    return -1;
+};
+
+//Reads the next non-empty row, returns false at the end of the file.
+static bool nextRow(TExchangeFile *exchange) {
+    while(fgets(exchange->line, sizeof(exchange->line), exchange->file)) {
+        exchange->fieldCount = splitLine(exchange->line, exchange->delimiter,
+                                         exchange->fields);
+        if(exchange->fieldCount)
+            return true;
+    };
+
+    return false;
+};
+
+static const char *field(const TExchangeFile *exchange, int index) {
+    return (index >= 0 && index < exchange->fieldCount) ?
+           exchange->fields[index] : "";
+};
+
+static long number(const TExchangeFile *exchange, int index, int base = 10) {
+    return strtol(field(exchange, index), NULL, base);
+};
+
+//Appends a string to the pool, returns its offset (0 for empty strings).
+static uint32_t addString(TExchangeImage *image, const char *string) {
+    uint32_t length = strlen(string), offset;
+
+    if(!length)
+        return 0;
+    while(image->stringsSize + length + 1 > image->stringsCapacity) {
+        char *grown = (char *)realloc(image->strings,
+                                      image->stringsCapacity * 2);
+
+        if(!grown)
+            return 0;
+        image->strings = grown;
+        image->stringsCapacity *= 2;
+    };
+    offset = image->stringsSize;
+    memcpy(&image->strings[offset], string, length + 1);
+    image->stringsSize += length + 1;
+
+    return offset;
+};
+
+static int compareNames(const void *a, const void *b) {
+    const TExchangeName *x = (const TExchangeName *)a;
+    const TExchangeName *y = (const TExchangeName *)b;
+
+    if(x->countryId != y->countryId)
+        return x->countryId - y->countryId;
+    if(x->nameId != y->nameId)
+        return x->nameId - y->nameId;
+    return (x->sequence > y->sequence) - (x->sequence < y->sequence);
+};
+
+static int compareLocations(const void *a, const void *b) {
+    const TRDSTMCLocation *x = (const TRDSTMCLocation *)a;
+    const TRDSTMCLocation *y = (const TRDSTMCLocation *)b;
+
+    if(x->countryId != y->countryId)
+        return x->countryId - y->countryId;
+    if(x->tableCode != y->tableCode)
+        return x->tableCode - y->tableCode;
+    return x->code - y->code;
+};
+
+//Resolves a name ID to a string pool offset.
+static uint32_t findName(const TExchangeImage *image, uint8_t countryId,
+                         uint16_t nameId) {
+    uint32_t low = 0, high = image->nameCount;
+
+    if(!nameId)
+        return 0;
+    while(low < high) {
+        uint32_t middle = (low + high) / 2;
+        const TExchangeName *name = &image->names[middle];
+
+        if(name->countryId < countryId ||
+           (name->countryId == countryId && name->nameId < nameId))
+            low = middle + 1;
+        else
+            high = middle;
+    };
+    if(low < image->nameCount && image->names[low].countryId == countryId &&
+       image->names[low].nameId == nameId)
+        return image->names[low].string;
+
+    return 0;
+};
+
+//The O(1) lookup shared by the compiler and the mapped database: one dense
+//array of record indexes per table, addressed by code - firstCode.
+static uint32_t findRecord(const TRDSTMCLocationTableInfo *tables,
+                           uint32_t tableCount, const uint32_t *index,
+                           const TRDSTMCLocationTableInfo **hint,
+                           uint8_t countryId, uint8_t tableCode,
+                           uint16_t code) {
+    const TRDSTMCLocationTableInfo *table = hint ? *hint : NULL;
+
+    if(!(table && table->countryId == countryId &&
+         table->tableCode == tableCode)) {
+        table = NULL;
+        for(uint32_t i = 0; i < tableCount; i++)
+            if(tables[i].countryId == countryId &&
+               tables[i].tableCode == tableCode) {
+                table = &tables[i];
+                break;
+            };
+        if(!table)
+            return RDS_TMC_LT_NONE;
+        if(hint)
+            *hint = table;
+    };
+    if(code < table->firstCode ||
+       (uint32_t)(code - table->firstCode) >= table->codeSpan)
+        return RDS_TMC_LT_NONE;
+
+    return index[table->index + code - table->firstCode];
+};
+
+static bool readCountries(const char *directory, TExchangeImage *image) {
+    TExchangeFile exchange;
+    int cid, ecc, ccd;
+
+    if(!openExchange(directory, "COUNTRIES.DAT", &exchange))
+        //Optional, FLT and ECC resolution just won't work without it.
+        return true;
+    cid = column(&exchange, "CID");
+    ecc = column(&exchange, "ECC");
+    ccd = column(&exchange, "CCD");
+    while(nextRow(&exchange)) {
+        TRDSTMCLocationCountry *country;
+
+        if(!grow((void **)&image->countries, &image->countryCapacity,
+                 image->countryCount, sizeof(TRDSTMCLocationCountry)))
+            break;
+        country = &image->countries[image->countryCount++];
+        country->countryId = number(&exchange, cid);
+        country->extendedCountryCode = number(&exchange, ecc, 16);
+        country->countryCode = number(&exchange, ccd, 16);
+        country->reserved = 0;
+    };
+    fclose(exchange.file);
+
+    return true;
+};
+
+static bool readNames(const char *directory, TExchangeImage *image) {
+    TExchangeFile exchange;
+    int cid, nid, name;
+    uint32_t kept = 0;
+
+    if(!openExchange(directory, "NAMES.DAT", &exchange))
+        return true;
+    cid = column(&exchange, "CID");
+    nid = column(&exchange, "NID");
+    name = column(&exchange, "NAME");
+    while(nextRow(&exchange)) {
+        TExchangeName *entry;
+
+        if(!grow((void **)&image->names, &image->nameCapacity,
+                 image->nameCount, sizeof(TExchangeName)))
+            break;
+        entry = &image->names[image->nameCount];
+        entry->countryId = number(&exchange, cid);
+        entry->nameId = number(&exchange, nid);
+        entry->sequence = image->nameCount++;
+        entry->string = addString(image, field(&exchange, name));
+    };
+    fclose(exchange.file);
+
+    //Keep the first language listed for each name ID.
+    qsort(image->names, image->nameCount, sizeof(TExchangeName),
+          compareNames);
+    for(uint32_t i = 0; i < image->nameCount; i++)
+        if(!kept || image->names[kept - 1].countryId !=
+                    image->names[i].countryId ||
+           image->names[kept - 1].nameId != image->names[i].nameId)
+            image->names[kept++] = image->names[i];
+    image->nameCount = kept;
+
+    return true;
+};
+
+//Reads one of the files that define locations (areas, roads, segments and
+//points), which share most of their columns.
+static bool readLocations(const char *directory, const char *name,
+                          char defaultClass, TExchangeImage *image) {
+    TExchangeFile exchange;
+    int cid, tabcd, lcd, cls, tcd, stcd, roadLcd, segLcd, roadNumber, rnid,
+        nid, n1id, n2id, x, y;
+
+    if(!openExchange(directory, name, &exchange))
+        return false;
+    cid = column(&exchange, "CID");
+    tabcd = column(&exchange, "TABCD");
+    lcd = column(&exchange, "LCD");
+    cls = column(&exchange, "CLASS");
+    tcd = column(&exchange, "TCD");
+    stcd = column(&exchange, "STCD");
+    roadLcd = column(&exchange, "ROA_LCD");
+    segLcd = column(&exchange, "SEG_LCD");
+    roadNumber = column(&exchange, "ROADNUMBER");
+    rnid = column(&exchange, "RNID");
+    nid = column(&exchange, "NID");
+    n1id = column(&exchange, "N1ID");
+    n2id = column(&exchange, "N2ID");
+    x = column(&exchange, "XCOORD");
+    y = column(&exchange, "YCOORD");
+    while(nextRow(&exchange)) {
+        TRDSTMCLocation *location;
+
+        if(!grow((void **)&image->records, &image->recordCapacity,
+                 image->recordCount, sizeof(TRDSTMCLocation)))
+            break;
+        location = &image->records[image->recordCount];
+        memset(location, 0x00, sizeof(TRDSTMCLocation));
+        location->code = number(&exchange, lcd);
+        if(!location->code)
+            //Location code 0 is reserved.
+            continue;
+        location->countryId = number(&exchange, cid);
+        location->tableCode = number(&exchange, tabcd);
+        location->locationClass = (cls >= 0 && *field(&exchange, cls)) ?
+                                  toupper(*field(&exchange, cls)) :
+                                  defaultClass;
+        location->typeCode = number(&exchange, tcd);
+        location->subtypeCode = number(&exchange, stcd);
+        location->road = number(&exchange, roadLcd);
+        location->segment = number(&exchange, segLcd);
+        location->longitude = number(&exchange, x);
+        location->latitude = number(&exchange, y);
+        location->positiveIndex = RDS_TMC_LT_NONE;
+        location->negativeIndex = RDS_TMC_LT_NONE;
+        location->roadNumber = addString(image, field(&exchange, roadNumber));
+        location->roadName = findName(image, location->countryId,
+                                      number(&exchange, rnid));
+        location->name1 = findName(image, location->countryId,
+                                   number(&exchange, n1id >= 0 ? n1id : nid));
+        location->name2 = findName(image, location->countryId,
+                                   number(&exchange, n2id));
+        image->recordCount++;
+    };
+    fclose(exchange.file);
+
+    return true;
+};
+
+//Sorts the records and builds the per-table dense indexes.
+static bool buildIndex(TExchangeImage *image) {
+    uint32_t kept = 0;
+
+    qsort(image->records, image->recordCount, sizeof(TRDSTMCLocation),
+          compareLocations);
+    //Drop duplicates, e.g. a location listed both as a segment and a road.
+    for(uint32_t i = 0; i < image->recordCount; i++)
+        if(!kept || compareLocations(&image->records[kept - 1],
+                                     &image->records[i]))
+            image->records[kept++] = image->records[i];
+    image->recordCount = kept;
+
+    image->indexCount = 0;
+    for(uint32_t first = 0; first < image->recordCount; ) {
+        TRDSTMCLocationTableInfo *table;
+        uint32_t last = first;
+
+        while(last + 1 < image->recordCount &&
+              image->records[last + 1].countryId ==
+              image->records[first].countryId &&
+              image->records[last + 1].tableCode ==
+              image->records[first].tableCode)
+            last++;
+        if(!grow((void **)&image->tables, &image->tableCapacity,
+                 image->tableCount, sizeof(TRDSTMCLocationTableInfo)))
+            return false;
+        table = &image->tables[image->tableCount++];
+        table->countryId = image->records[first].countryId;
+        table->tableCode = image->records[first].tableCode;
+        table->firstCode = image->records[first].code;
+        table->codeSpan = image->records[last].code - table->firstCode + 1;
+        table->index = image->indexCount;
+        image->indexCount += table->codeSpan;
+        first = last + 1;
+    };
+
+    image->index = (uint32_t *)malloc(
+        (image->indexCount ? image->indexCount : 1) * sizeof(uint32_t));
+    if(!image->index)
+        return false;
+    memset(image->index, 0xFF, image->indexCount * sizeof(uint32_t));
+    for(uint32_t i = 0, t = 0; i < image->recordCount; i++) {
+        const TRDSTMCLocation *location = &image->records[i];
+
+        while(image->tables[t].countryId != location->countryId ||
+              image->tables[t].tableCode != location->tableCode)
+            t++;
+        image->index[image->tables[t].index + location->code -
+                     image->tables[t].firstCode] = i;
+    };
+
+    return true;
+};
+
+//Applies POFFSETS.DAT or SOFFSETS.DAT to the (already indexed) records.
+static void readOffsets(const char *directory, const char *name,
+                        TExchangeImage *image) {
+    TExchangeFile exchange;
+    const TRDSTMCLocationTableInfo *hint = NULL;
+    int cid, tabcd, lcd, negative, positive;
+
+    if(!openExchange(directory, name, &exchange))
+        return;
+    cid = column(&exchange, "CID");
+    tabcd = column(&exchange, "TABCD");
+    lcd = column(&exchange, "LCD");
+    negative = column(&exchange, "NEG_OFF_LCD");
+    positive = column(&exchange, "POS_OFF_LCD");
+    while(nextRow(&exchange)) {
+        uint32_t record = findRecord(image->tables, image->tableCount,
+                                     image->index, &hint,
+                                     number(&exchange, cid),
+                                     number(&exchange, tabcd),
+                                     number(&exchange, lcd));
+
+        if(record == RDS_TMC_LT_NONE)
+            continue;
+        image->records[record].negativeOffset = number(&exchange, negative);
+        image->records[record].positiveOffset = number(&exchange, positive);
+    };
+    fclose(exchange.file);
+};
+
+//Resolves offsets to record indexes and lets segments and points inherit the
+//road number and name of the road they belong to.
+static void linkRecords(TExchangeImage *image) {
+    const TRDSTMCLocationTableInfo *hint = NULL;
+
+    for(uint32_t i = 0; i < image->recordCount; i++) {
+        TRDSTMCLocation *location = &image->records[i];
+
+        if(location->positiveOffset)
+            location->positiveIndex = findRecord(
+                image->tables, image->tableCount, image->index, &hint,
+                location->countryId, location->tableCode,
+                location->positiveOffset);
+        if(location->negativeOffset)
+            location->negativeIndex = findRecord(
+                image->tables, image->tableCount, image->index, &hint,
+                location->countryId, location->tableCode,
+                location->negativeOffset);
+    };
+
+    //Two passes so that points can inherit from segments that inherited from
+    //their road.
+    for(byte pass = 0; pass < 2; pass++)
+        for(uint32_t i = 0; i < image->recordCount; i++) {
+            TRDSTMCLocation *location = &image->records[i];
+            word parents[2] = {location->segment, location->road};
+
+            for(byte p = 0; p < 2; p++) {
+                uint32_t record;
+
+                if(!parents[p] || (location->roadNumber && location->roadName))
+                    continue;
+                record = findRecord(image->tables, image->tableCount,
+                                    image->index, &hint, location->countryId,
+                                    location->tableCode, parents[p]);
+                if(record == RDS_TMC_LT_NONE)
+                    continue;
+                if(!location->roadNumber)
+                    location->roadNumber = image->records[record].roadNumber;
+                if(!location->roadName)
+                    location->roadName = image->records[record].roadName;
+            };
+        };
+};
+
+//Appends the positive offset chain starting at a record to the chains,
+//followed by a separator. Nothing is appended if the record is already placed.
+//Returns false if the chains would outgrow capacity elements.
+static bool placeChain(TExchangeImage *image, uint32_t record,
+                       bool placed[], uint32_t capacity) {
+    if(placed[record])
+        return true;
+    while(record < image->recordCount && !placed[record]) {
+        //Leave room for the separator.
+        if(image->chainCount + 1 >= capacity)
+            return false;
+        placed[record] = true;
+        image->records[record].chain = image->chainCount;
+        image->chains[image->chainCount++] = record;
+        record = image->records[record].positiveIndex;
+    };
+    image->chains[image->chainCount++] = RDS_TMC_LT_NONE;
+
+    return true;
+};
+
+//Lays out the offset chains contiguously and computes, for every element,
+//how far each direction can be followed by just moving along the layout.
+static bool buildChains(TExchangeImage *image) {
+    //Every chain holds at least one record and ends with one separator.
+    uint32_t capacity = image->recordCount * 2 + 1;
+    bool *placed, ok = true;
+
+    image->chainCount = 0;
+    image->chains = (uint32_t *)malloc(capacity * sizeof(uint32_t));
+    image->runs = (TRDSTMCLocationRun *)malloc(
+        capacity * sizeof(TRDSTMCLocationRun));
+    placed = (bool *)calloc(image->recordCount + 1, sizeof(bool));
+    if(!(image->chains && image->runs && placed)) {
+        free(placed);
+        return false;
+    };
+
+    //Start chains at their heads first, so that each road comes out in one
+    //piece. Whatever is left over is part of a ring.
+    for(uint32_t i = 0; ok && i < image->recordCount; i++) {
+        uint32_t previous = image->records[i].negativeIndex;
+
+        if(previous >= image->recordCount ||
+           image->records[previous].positiveIndex != i)
+            ok = placeChain(image, i, placed, capacity);
+    };
+    for(uint32_t i = 0; ok && i < image->recordCount; i++)
+        ok = placeChain(image, i, placed, capacity);
+    free(placed);
+    if(!ok)
+        return false;
+
+    for(uint32_t p = image->chainCount; p-- > 0; ) {
+        uint32_t record = image->chains[p];
+
+        image->runs[p].positive = 0;
+        if(record != RDS_TMC_LT_NONE && p + 1 < image->chainCount &&
+           image->chains[p + 1] != RDS_TMC_LT_NONE &&
+           image->records[record].positiveIndex == image->chains[p + 1])
+            image->runs[p].positive = (image->runs[p + 1].positive < 0xFF) ?
+                                      image->runs[p + 1].positive + 1 : 0xFF;
+    };
+    for(uint32_t p = 0; p < image->chainCount; p++) {
+        uint32_t record = image->chains[p];
+
+        image->runs[p].negative = 0;
+        if(record != RDS_TMC_LT_NONE && p > 0 &&
+           image->chains[p - 1] != RDS_TMC_LT_NONE &&
+           image->records[record].negativeIndex == image->chains[p - 1])
+            image->runs[p].negative = (image->runs[p - 1].negative < 0xFF) ?
+                                      image->runs[p - 1].negative + 1 : 0xFF;
+    };
+
+    return true;
+};
+
+static uint32_t align4(uint32_t offset) {
+    return (offset + 3) & ~3UL;
+};
+
+static bool writeImage(const char *path, TExchangeImage *image) {
+    TRDSTMCLocationImageHeader header;
+    FILE *file;
+    static const uint32_t padding = 0;
+    bool ok;
+
+    memset(&header, 0x00, sizeof(header));
+    memcpy(header.magic, RDS_TMC_LT_IMAGE_MAGIC, sizeof(header.magic));
+    header.version = RDS_TMC_LT_IMAGE_VERSION;
+    header.countryCount = image->countryCount;
+    header.countries = sizeof(header);
+    header.tableCount = image->tableCount;
+    header.tables = header.countries +
+                    image->countryCount * sizeof(TRDSTMCLocationCountry);
+    header.recordCount = image->recordCount;
+    header.records = header.tables +
+                     image->tableCount * sizeof(TRDSTMCLocationTableInfo);
+    header.indexCount = image->indexCount;
+    header.index = header.records +
+                   image->recordCount * sizeof(TRDSTMCLocation);
+    header.chainCount = image->chainCount;
+    header.chains = header.index + image->indexCount * sizeof(uint32_t);
+    header.runs = header.chains + image->chainCount * sizeof(uint32_t);
+    header.stringsSize = image->stringsSize;
+    header.strings = header.runs +
+                     image->chainCount * sizeof(TRDSTMCLocationRun);
+    header.size = align4(header.strings + image->stringsSize);
+
+    file = fopen(path, "wb");
+    if(!file)
+        return false;
+    ok = fwrite(&header, sizeof(header), 1, file) == 1;
+    ok = ok && fwrite(image->countries, sizeof(TRDSTMCLocationCountry),
+                      image->countryCount, file) == image->countryCount;
+    ok = ok && fwrite(image->tables, sizeof(TRDSTMCLocationTableInfo),
+                      image->tableCount, file) == image->tableCount;
+    ok = ok && fwrite(image->records, sizeof(TRDSTMCLocation),
+                      image->recordCount, file) == image->recordCount;
+    ok = ok && fwrite(image->index, sizeof(uint32_t), image->indexCount,
+                      file) == image->indexCount;
+    ok = ok && fwrite(image->chains, sizeof(uint32_t), image->chainCount,
+                      file) == image->chainCount;
+    ok = ok && fwrite(image->runs, sizeof(TRDSTMCLocationRun),
+                      image->chainCount, file) == image->chainCount;
+    ok = ok && fwrite(image->strings, 1, image->stringsSize, file) ==
+               image->stringsSize;
+    ok = ok && fwrite(&padding, 1, header.size - header.strings -
+                      image->stringsSize, file) ==
+               header.size - header.strings - image->stringsSize;
+
+    return (fclose(file) == 0) && ok;
+};
+
+bool TMCLocationTable::compile(const char *directory, const char *image) {
+    TExchangeImage compiled;
+    bool ok;
+
+    memset(&compiled, 0x00, sizeof(compiled));
+    compiled.stringsCapacity = 4096;
+    compiled.strings = (char *)malloc(compiled.stringsCapacity);
+    if(!compiled.strings)
+        return false;
+    //Offset 0 is the empty string.
+    compiled.strings[0] = '\0';
+    compiled.stringsSize = 1;
+
+    ok = readCountries(directory, &compiled) &&
+         readNames(directory, &compiled);
+    if(ok) {
+        readLocations(directory, "ADMINISTRATIVEAREA.DAT",
+                      RDS_TMC_LT_CLASS_AREA, &compiled);
+        readLocations(directory, "OTHERAREAS.DAT", RDS_TMC_LT_CLASS_AREA,
+                      &compiled);
+        readLocations(directory, "ROADS.DAT", RDS_TMC_LT_CLASS_LINE,
+                      &compiled);
+        readLocations(directory, "SEGMENTS.DAT", RDS_TMC_LT_CLASS_LINE,
+                      &compiled);
+        ok = readLocations(directory, "POINTS.DAT", RDS_TMC_LT_CLASS_POINT,
+                           &compiled);
+    };
+    ok = ok && buildIndex(&compiled);
+    if(ok) {
+        readOffsets(directory, "POFFSETS.DAT", &compiled);
+        readOffsets(directory, "SOFFSETS.DAT", &compiled);
+        linkRecords(&compiled);
+        ok = buildChains(&compiled) && writeImage(image, &compiled);
+    };
+
+    free(compiled.countries);
+    free(compiled.names);
+    free(compiled.records);
+    free(compiled.tables);
+    free(compiled.index);
+    free(compiled.chains);
+    free(compiled.runs);
+    free(compiled.strings);
+
+    return ok;
+};
+
+TMCLocationTable::TMCLocationTable(void) {
+    _image = NULL;
+    _size = 0;
+    _header = NULL;
+    _lastTable = NULL;
+};
+
+TMCLocationTable::~TMCLocationTable(void) {
+    unmap();
+};
+
+//Checks what lookups and extent expansion trust in a mapped image: the index
+//slices of the tables, the record indexes in the chains and the runs, which
+//must only span records of one chain.
+static bool checkImage(const byte *image,
+                       const TRDSTMCLocationImageHeader *header) {
+    const TRDSTMCLocationTableInfo *tables =
+        (const TRDSTMCLocationTableInfo *)(image + header->tables);
+    const uint32_t *chains = (const uint32_t *)(image + header->chains);
+    const TRDSTMCLocationRun *runs =
+        (const TRDSTMCLocationRun *)(image + header->runs);
+    const char *strings = (const char *)(image + header->strings);
+
+    if(strings[header->stringsSize - 1] != '\0')
+        return false;
+    for(uint32_t i = 0; i < header->tableCount; i++)
+        if(tables[i].index + (uint64_t)tables[i].codeSpan > header->indexCount)
+            return false;
+    for(uint32_t p = 0; p < header->chainCount; p++) {
+        uint32_t next = p + 1, previous = p - 1;
+
+        if(chains[p] != RDS_TMC_LT_NONE && chains[p] >= header->recordCount)
+            return false;
+        //A run covers its neighbour and that one's run (they saturate).
+        if(runs[p].positive &&
+           (chains[p] == RDS_TMC_LT_NONE || next >= header->chainCount ||
+            chains[next] == RDS_TMC_LT_NONE ||
+            runs[p].positive != (runs[next].positive < 0xFF ?
+                                 runs[next].positive + 1 : 0xFF)))
+            return false;
+        if(runs[p].negative &&
+           (chains[p] == RDS_TMC_LT_NONE || !p ||
+            chains[previous] == RDS_TMC_LT_NONE ||
+            runs[p].negative != (runs[previous].negative < 0xFF ?
+                                 runs[previous].negative + 1 : 0xFF)))
+            return false;
+    };
+
+    return true;
+};
+
+bool TMCLocationTable::map(const char *image) {
+    struct stat status;
+    const TRDSTMCLocationImageHeader *header;
+    void *mapped;
+    int fd;
+
+    unmap();
+    fd = open(image, O_RDONLY);
+    if(fd < 0)
+        return false;
+    if(fstat(fd, &status) ||
+       (size_t)status.st_size < sizeof(TRDSTMCLocationImageHeader)) {
+        close(fd);
+        return false;
+    };
+    mapped = mmap(NULL, status.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if(mapped == MAP_FAILED)
+        return false;
+
+    header = (const TRDSTMCLocationImageHeader *)mapped;
+    if(memcmp(header->magic, RDS_TMC_LT_IMAGE_MAGIC, sizeof(header->magic)) ||
+       header->version != RDS_TMC_LT_IMAGE_VERSION ||
+       header->size != (uint64_t)status.st_size ||
+       header->countries + (uint64_t)header->countryCount *
+       sizeof(TRDSTMCLocationCountry) > header->size ||
+       header->tables + (uint64_t)header->tableCount *
+       sizeof(TRDSTMCLocationTableInfo) > header->size ||
+       header->records + (uint64_t)header->recordCount *
+       sizeof(TRDSTMCLocation) > header->size ||
+       header->index + (uint64_t)header->indexCount * sizeof(uint32_t) >
+       header->size ||
+       header->chains + (uint64_t)header->chainCount * sizeof(uint32_t) >
+       header->size ||
+       header->runs + (uint64_t)header->chainCount *
+       sizeof(TRDSTMCLocationRun) > header->size ||
+       !header->stringsSize ||
+       header->strings + (uint64_t)header->stringsSize > header->size ||
+       !checkImage((const byte *)mapped, header)) {
+        munmap(mapped, status.st_size);
+        return false;
+    };
+
+    _image = (const byte *)mapped;
+    _size = status.st_size;
+    _header = header;
+    _countries = (const TRDSTMCLocationCountry *)(_image + header->countries);
+    _tables = (const TRDSTMCLocationTableInfo *)(_image + header->tables);
+    _records = (const TRDSTMCLocation *)(_image + header->records);
+    _index = (const uint32_t *)(_image + header->index);
+    _chains = (const uint32_t *)(_image + header->chains);
+    _runs = (const TRDSTMCLocationRun *)(_image + header->runs);
+    _strings = (const char *)(_image + header->strings);
+    _lastTable = NULL;
+
+    return true;
+};
+
+void TMCLocationTable::unmap(void) {
+    if(_image)
+        munmap((void *)_image, _size);
+    _image = NULL;
+    _size = 0;
+    _header = NULL;
+    _lastTable = NULL;
+};
+
+const TRDSTMCLocation *TMCLocationTable::lookup(byte countryId,
+                                                byte tableCode, word code) {
+    if(!_header)
+        return NULL;
+
+    return getLocation(findRecord(_tables, _header->tableCount, _index,
+                                  &_lastTable, countryId, tableCode, code));
+};
+
+const TRDSTMCLocation *TMCLocationTable::resolve(
+    byte extendedCountryCode, byte countryCode, byte locationTableNumber,
+    const TRDSTMCDecodedMessage *message) {
+    byte countryId;
+
+    if(!(_header && message))
+        return NULL;
+
+    if(message->foreignLocation) {
+        //The ECC of the foreign country is not transmitted, it only holds if
+        //the country code did not change.
+        if(message->foreignTable.country != countryCode)
+            extendedCountryCode = 0;
+        countryCode = message->foreignTable.country;
+        locationTableNumber = message->foreignTable.locationTableNumber;
+    };
+
+    countryId = getCountryId(extendedCountryCode, countryCode);
+    if(!countryId)
+        //No COUNTRIES.DAT was compiled in, go by the table number alone.
+        for(uint32_t i = 0; i < _header->tableCount; i++)
+            if(_tables[i].tableCode == locationTableNumber) {
+                countryId = _tables[i].countryId;
+                break;
+            };
+
+    return lookup(countryId, locationTableNumber, message->location);
+};
+
+byte TMCLocationTable::expandExtent(const TRDSTMCLocation *primary,
+                                   bool direction, byte extent,
+                                   uint32_t indexes[], byte max) {
+    uint32_t record = getIndex(primary);
+    byte count = 0;
+
+    if(record == RDS_TMC_LT_NONE || !max)
+        return 0;
+
+    indexes[count++] = record;
+    while(extent && count < max) {
+        uint32_t position = _records[record].chain;
+        byte run;
+
+        if(position >= _header->chainCount)
+            break;
+        run = direction ? _runs[position].positive : _runs[position].negative;
+        if(run) {
+            if(run > extent)
+                run = extent;
+            if(run > max - count)
+                run = max - count;
+            if(direction)
+                memcpy(&indexes[count], &_chains[position + 1],
+                       run * sizeof(uint32_t));
+            else
+                for(byte i = 1; i <= run; i++)
+                    indexes[count + i - 1] = _chains[position - i];
+            count += run;
+            extent -= run;
+            record = indexes[count - 1];
+        } else {
+            //Chain break, take one step the slow way.
+            record = direction ? _records[record].positiveIndex :
+                                 _records[record].negativeIndex;
+            if(record >= _header->recordCount)
+                break;
+            indexes[count++] = record;
+            extent--;
+        };
+    };
+
+    return count;
+};
+
+byte TMCLocationTable::expandMessage(byte extendedCountryCode,
+                                    byte countryCode,
+                                    byte locationTableNumber,
+                                    const TRDSTMCDecodedMessage *message,
+                                    uint32_t indexes[], byte max) {
+    const TRDSTMCLocation *primary = resolve(extendedCountryCode, countryCode,
+                                             locationTableNumber, message);
+
+    if(!primary)
+        return 0;
+
+    return expandExtent(primary, message->direction, message->extent & 0x1F,
+                        indexes, max);
+};
+
+const TRDSTMCLocation *TMCLocationTable::getLocation(uint32_t index) {
+    if(!_header || index >= _header->recordCount)
+        return NULL;
+
+    return &_records[index];
+};
+
+uint32_t TMCLocationTable::getIndex(const TRDSTMCLocation *location) {
+    if(!(_header && location) || location < _records ||
+       location >= _records + _header->recordCount)
+        return RDS_TMC_LT_NONE;
+
+    return location - _records;
+};
+
+const char *TMCLocationTable::getString(uint32_t reference) {
+    if(!_header || reference >= _header->stringsSize)
+        return "";
+
+    return &_strings[reference];
+};
+
+byte TMCLocationTable::getCountryId(byte extendedCountryCode,
+                                    byte countryCode) {
+    if(!_header)
+        return 0;
+
+    for(uint32_t i = 0; i < _header->countryCount; i++)
+        if(_countries[i].countryCode == countryCode &&
+           (!extendedCountryCode ||
+            _countries[i].extendedCountryCode == extendedCountryCode))
+            return _countries[i].countryId;
+
+    return 0;
+};
+
+#endif
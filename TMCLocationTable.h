@@ -0,0 +1,265 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This file contains the ISO 14819-3 location table database, which resolves
+ * TMC location codes to roads, names and coordinates. The location tables are
+ * compiled once from their TMC Exchange Format (or CSV export) files into a
+ * binary image that is then memory-mapped, so this is only available on hosts
+ * with a filesystem and mmap().
+ */
+
+#ifndef _TMCLOCATIONTABLE_H_INCLUDED
+#define _TMCLOCATIONTABLE_H_INCLUDED
+
+#include "RDSDecoder.h"
+#include "TMCAssembler.h"
+
+#if defined(__i386__) || defined(__x86_64__)
+
+#define RDS_TMC_LT_IMAGE_MAGIC "RDSTMCLT"
+#define RDS_TMC_LT_IMAGE_VERSION 2
+//Record index value meaning "no such location"
+#define RDS_TMC_LT_NONE 0xFFFFFFFFUL
+
+// Values for TRDSTMCLocation.locationClass
+#define RDS_TMC_LT_CLASS_AREA 'A'
+#define RDS_TMC_LT_CLASS_LINE 'L'
+#define RDS_TMC_LT_CLASS_POINT 'P'
+
+//All the offsets below are in bytes from the start of the image, except for
+//the string references which are offsets into the string pool. The string at
+//offset 0 in the pool is always the empty string.
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t size;
+    uint32_t countryCount;
+    uint32_t countries;
+    uint32_t tableCount;
+    uint32_t tables;
+    uint32_t recordCount;
+    uint32_t records;
+    uint32_t indexCount;
+    uint32_t index;
+    uint32_t chainCount;
+    uint32_t chains;
+    uint32_t runs;
+    uint32_t stringsSize;
+    uint32_t strings;
+} TRDSTMCLocationImageHeader;
+
+typedef struct {
+    uint8_t countryId;
+    uint8_t extendedCountryCode;
+    uint8_t countryCode;
+    uint8_t reserved;
+} TRDSTMCLocationCountry;
+
+typedef struct {
+    uint8_t countryId;
+    uint8_t tableCode;
+    uint16_t firstCode;
+    uint32_t codeSpan;
+    uint32_t index;
+} TRDSTMCLocationTableInfo;
+
+//The offset chains are stored as runs of record indexes in positive offset
+//order, separated by RDS_TMC_LT_NONE. Each chain element has a matching run
+//entry telling how many of the following (positive) or preceding (negative)
+//elements are really its offsets, so an extent is expanded by copying a slice.
+typedef struct {
+    uint8_t positive;
+    uint8_t negative;
+} TRDSTMCLocationRun;
+
+typedef struct {
+    uint16_t code;
+    uint8_t countryId;
+    uint8_t tableCode;
+    char locationClass;
+    uint8_t typeCode;
+    uint8_t subtypeCode;
+    uint8_t reserved;
+    uint16_t positiveOffset;
+    uint16_t negativeOffset;
+    uint16_t road;
+    uint16_t segment;
+    int32_t longitude;
+    int32_t latitude;
+    uint32_t positiveIndex;
+    uint32_t negativeIndex;
+    uint32_t chain;
+    uint32_t roadNumber;
+    uint32_t roadName;
+    uint32_t name1;
+    uint32_t name2;
+} TRDSTMCLocation;
+
+class TMCLocationTable
+{
+    public:
+        /*
+        * Description:
+        *   Default constructor, creates an empty (unmapped) database.
+        */
+        TMCLocationTable(void);
+        ~TMCLocationTable(void);
+
+        /*
+        * Description:
+        *   Compiles the location tables found in a directory into a binary
+        *   image. The directory is expected to contain the TMC Exchange Format
+        *   files (semicolon separated, header row first) or CSV exports of
+        *   them with the same column names. POINTS.DAT is mandatory;
+        *   COUNTRIES.DAT, NAMES.DAT, ADMINISTRATIVEAREA.DAT, OTHERAREAS.DAT,
+        *   ROADS.DAT, SEGMENTS.DAT, POFFSETS.DAT and SOFFSETS.DAT are used if
+        *   present. Names are taken in the first language listed for each
+        *   name ID. This is meant to be run once, offline or whenever the
+        *   tables change, not at every startup.
+        * Parameters:
+        *   directory - path of the directory holding the exchange files.
+        *   image - path of the binary image file to write.
+        * Returns:
+        *   true on success, false if POINTS.DAT could not be read or the
+        *   image could not be written.
+        */
+        static bool compile(const char *directory, const char *image);
+
+        /*
+        * Description:
+        *   Memory-maps a binary image produced by compile(), replacing any
+        *   image previously mapped. The image is shared read-only, so all the
+        *   processes using it on one host share one page cache copy.
+        * Returns:
+        *   true if the image was mapped and looks valid, false otherwise.
+        */
+        bool map(const char *image);
+
+        /*
+        * Description:
+        *   Unmaps the current image, if any.
+        */
+        void unmap(void);
+
+        /*
+        * Description:
+        *   Finds a location in constant time.
+        * Parameters:
+        *   countryId - the CID of the location table.
+        *   tableCode - the TABCD (i.e. the LTN) of the location table.
+        *   code - the location code (LCD).
+        * Returns:
+        *   pointer to the location record inside the mapped image or NULL if
+        *   there is no such location.
+        */
+        const TRDSTMCLocation *lookup(byte countryId, byte tableCode,
+                                      word code);
+
+        /*
+        * Description:
+        *   Resolves the primary location of a decoded TMC message, honouring a
+        *   FLT (foreign location table reference) if the message has one.
+        * Parameters:
+        *   extendedCountryCode - the ECC of the station the message was
+        *                         received from (from group 1A).
+        *   countryCode - the country code of the station the message was
+        *                 received from (the high nibble of its PI).
+        *   locationTableNumber - the LTN of the TMC service (from group 3A).
+        *   message - pointer to the decoded message.
+        * Returns:
+        *   pointer to the location record inside the mapped image or NULL if
+        *   the location (or its table) is not known.
+        */
+        const TRDSTMCLocation *resolve(byte extendedCountryCode,
+                                       byte countryCode,
+                                       byte locationTableNumber,
+                                       const TRDSTMCDecodedMessage *message);
+
+        /*
+        * Description:
+        *   Expands the extent of a message into the list of locations it
+        *   covers, starting with the primary location. Following ISO 14819-1,
+        *   the extent runs from the primary location backwards along the
+        *   queue: along negative offsets for direction 0 and along positive
+        *   offsets for direction 1. The precomputed offset chains are copied
+        *   in slices; offsets are only followed one by one where a chain
+        *   breaks (e.g. where two roads join).
+        * Parameters:
+        *   primary - the primary location, as returned by lookup() or
+        *             resolve().
+        *   direction - the direction bit of the message.
+        *   extent - the extent of the message, 0 through 31.
+        *   indexes - an array of max elements receiving the record indexes
+        *             of the covered locations, for use with getLocation().
+        *   max - number of elements in indexes, extent + 1 is enough.
+        * Returns:
+        *   the number of locations stored in indexes, which is less than
+        *   extent + 1 if the location table ends earlier.
+        */
+        byte expandExtent(const TRDSTMCLocation *primary, bool direction,
+                          byte extent, uint32_t indexes[], byte max);
+
+        /*
+        * Description:
+        *   Resolves the primary location of a decoded TMC message (see
+        *   resolve()) and expands its extent (see expandExtent()).
+        * Returns:
+        *   the number of locations stored in indexes, 0 if the primary
+        *   location is not known.
+        */
+        byte expandMessage(byte extendedCountryCode, byte countryCode,
+                           byte locationTableNumber,
+                           const TRDSTMCDecodedMessage *message,
+                           uint32_t indexes[], byte max);
+
+        /*
+        * Description:
+        *   Returns the location record at the given index, as found in the
+        *   positiveIndex and negativeIndex fields, or NULL if out of range.
+        */
+        const TRDSTMCLocation *getLocation(uint32_t index);
+
+        /*
+        * Description:
+        *   Returns the index of a location record, for use with getLocation().
+        */
+        uint32_t getIndex(const TRDSTMCLocation *location);
+
+        /*
+        * Description:
+        *   Returns a string (road number or name) referenced by a location
+        *   record. Never returns NULL, missing strings are empty.
+        */
+        const char *getString(uint32_t reference);
+
+        /*
+        * Description:
+        *   Maps a country code and ECC pair to the CID used by the location
+        *   tables, as listed in COUNTRIES.DAT. If the ECC is not known
+        *   (zero), the first country with a matching country code is used.
+        * Returns:
+        *   the CID, or 0 if no such country is known.
+        */
+        byte getCountryId(byte extendedCountryCode, byte countryCode);
+
+    private:
+        const byte *_image;
+        size_t _size;
+        const TRDSTMCLocationImageHeader *_header;
+        const TRDSTMCLocationCountry *_countries;
+        const TRDSTMCLocationTableInfo *_tables;
+        const TRDSTMCLocation *_records;
+        const uint32_t *_index;
+        const uint32_t *_chains;
+        const TRDSTMCLocationRun *_runs;
+        const char *_strings;
+        const TRDSTMCLocationTableInfo *_lastTable;
+};
+
+#endif
+#endif
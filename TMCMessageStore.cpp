@@ -0,0 +1,340 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This is the code file for the TMC message store.
+ * See the header file for better function documentation.
+ */
+
+#include "TMCMessageStore.h"
+#include "rds-decoder.h"
+
+#include <string.h>
+
+#define MINUTES_PER_DAY 1440UL
+
+//Converts a day count since 1970-01-01 to a civil date (proleptic Gregorian),
+//only month and year are of interest here.
+static void civilFromDays(uint32_t days, uint16_t *year, uint8_t *month) {
+    uint32_t z = days + 719468UL;
+    uint32_t era = z / 146097UL;
+    uint32_t doe = z - era * 146097UL;
+    uint32_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    uint32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    uint32_t mp = (5 * doy + 2) / 153;
+
+    *month = mp < 10 ? mp + 3 : mp - 9;
+    *year = yoe + era * 400 + (*month <= 2 ? 1 : 0);
+};
+
+//Converts the first day of a civil month back to a day count since 1970-01-01.
+static uint32_t daysFromCivil(uint16_t year, uint8_t month) {
+    uint32_t y = year - (month <= 2 ? 1 : 0);
+    uint32_t era = y / 400;
+    uint32_t yoe = y - era * 400;
+    uint32_t doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5;
+    uint32_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+
+    return era * 146097UL + doe - 719468UL;
+};
+
+TMCMessageStore::TMCMessageStore(TRDSTMCStoreEntry entries[], word capacity,
+                                 word buckets[], word bucketCount) {
+    _entries = entries;
+    _capacity = (capacity < RDS_TMC_STORE_NIL) ? capacity :
+                                                 RDS_TMC_STORE_NIL - 1;
+    _buckets = buckets;
+    _bucketCount = bucketCount;
+    _now = 0;
+    registerCallback();
+    clear();
+};
+
+void TMCMessageStore::registerCallback(TTMCStoreCallback callback,
+                                       void *context) {
+    _callback = callback;
+    _context = context;
+};
+
+void TMCMessageStore::clear(void) {
+    for(word i = 0; i < _capacity; i++)
+        _entries[i].chainNext = (i + 1 < _capacity) ? i + 1 :
+                                                      RDS_TMC_STORE_NIL;
+    _free = _capacity ? 0 : RDS_TMC_STORE_NIL;
+    for(word i = 0; i < _bucketCount; i++)
+        _buckets[i] = RDS_TMC_STORE_NIL;
+    for(byte l = 0; l < RDS_TMC_STORE_WHEEL_LEVELS; l++)
+        for(byte s = 0; s < RDS_TMC_STORE_WHEEL_SLOTS; s++)
+            _wheel[l][s] = RDS_TMC_STORE_NIL;
+    _count = 0;
+};
+
+word TMCMessageStore::bucketFor(byte locationTableNumber, word location,
+                                bool direction) {
+    uint32_t hash = ((uint32_t)locationTableNumber << 17) |
+                    ((uint32_t)location << 1) | (direction ? 1 : 0);
+
+    //Multiplicative (Fibonacci) hashing spreads the sequential location
+    //codes of one road across the whole index.
+    hash *= 2654435761UL;
+    return (hash >> 8) % _bucketCount;
+};
+
+uint32_t TMCMessageStore::expiryFor(byte duration, bool longerLasting) {
+    uint32_t day = _now / MINUTES_PER_DAY;
+    uint32_t midnight = (day + 1) * MINUTES_PER_DAY;
+    byte persistence;
+    uint16_t year;
+    uint8_t month;
+
+    duration &= 0x07;
+    persistence = longerLasting ? RDS_TMC_D2LongerlastingPersistence[duration]
+                                : RDS_TMC_D2DynamicPersistence[duration];
+    if(persistence < 0xFE)
+        return _now + persistence;
+    else if(persistence == 0xFE)
+        //Until midnight
+        return midnight;
+
+    //Longer lasting durations 3 through 7, calendar based.
+    switch(duration) {
+        case 3:
+            //Until the end of tomorrow
+            return midnight + MINUTES_PER_DAY;
+        case 4:
+        case 5:
+            //Until the end of this (next) week, weeks end on Sunday and
+            //1970-01-01 was a Thursday.
+            return (day + 7 - (day + 3) % 7 + (duration == 5 ? 7 : 0)) *
+                   MINUTES_PER_DAY;
+        default:
+            //Until the end of this (next) month
+            civilFromDays(day, &year, &month);
+            month += (duration == 7) ? 2 : 1;
+            if(month > 12) {
+                month -= 12;
+                year++;
+            };
+            return daysFromCivil(year, month) * MINUTES_PER_DAY;
+    };
+};
+
+void TMCMessageStore::schedule(word index) {
+    TRDSTMCStoreEntry *entry = &_entries[index];
+    uint32_t delta = (entry->expires > _now) ? entry->expires - _now : 0;
+    byte level = 0;
+
+    while(level < RDS_TMC_STORE_WHEEL_LEVELS - 1 &&
+          (delta >> (RDS_TMC_STORE_WHEEL_SHIFT * (level + 1))))
+        level++;
+    entry->wheelLevel = level;
+    entry->wheelSlot = ((delta ? entry->expires : _now) >>
+                        (RDS_TMC_STORE_WHEEL_SHIFT * level)) &
+                       (RDS_TMC_STORE_WHEEL_SLOTS - 1);
+    entry->wheelPrev = RDS_TMC_STORE_NIL;
+    entry->wheelNext = _wheel[level][entry->wheelSlot];
+    if(entry->wheelNext != RDS_TMC_STORE_NIL)
+        _entries[entry->wheelNext].wheelPrev = index;
+    _wheel[level][entry->wheelSlot] = index;
+};
+
+void TMCMessageStore::unschedule(word index) {
+    TRDSTMCStoreEntry *entry = &_entries[index];
+
+    if(entry->wheelPrev != RDS_TMC_STORE_NIL)
+        _entries[entry->wheelPrev].wheelNext = entry->wheelNext;
+    else
+        _wheel[entry->wheelLevel][entry->wheelSlot] = entry->wheelNext;
+    if(entry->wheelNext != RDS_TMC_STORE_NIL)
+        _entries[entry->wheelNext].wheelPrev = entry->wheelPrev;
+};
+
+void TMCMessageStore::release(word index, byte reason) {
+    TRDSTMCStoreEntry *entry = &_entries[index];
+    word *link = &_buckets[bucketFor(entry->locationTableNumber,
+                                     entry->message.location,
+                                     entry->message.direction)];
+
+    unschedule(index);
+    while(*link != index)
+        link = &_entries[*link].chainNext;
+    *link = entry->chainNext;
+
+    if(_callback)
+        _callback(_context, entry, reason);
+
+    entry->chainNext = _free;
+    _free = index;
+    _count--;
+};
+
+void TMCMessageStore::cancel(byte locationTableNumber, word location,
+                             bool direction, byte extent, byte updateClass) {
+    word index = _buckets[bucketFor(locationTableNumber, location, direction)];
+
+    while(index != RDS_TMC_STORE_NIL) {
+        TRDSTMCStoreEntry *entry = &_entries[index];
+        word next = entry->chainNext;
+
+        if(entry->locationTableNumber == locationTableNumber &&
+           entry->message.location == location &&
+           entry->message.direction == direction &&
+           entry->message.extent == extent &&
+           (updateClass == RDS_TMC_UPDATE_CLASS_MANAGEMENT ||
+            entry->updateClass == updateClass))
+            release(index, RDS_TMC_STORE_CANCELLED);
+        index = next;
+    };
+};
+
+void TMCMessageStore::setTime(uint32_t now) {
+    word pending = RDS_TMC_STORE_NIL;
+
+    if(now <= _now)
+        return;
+    if(!_count) {
+        //Nothing to expire, no need to walk the wheel.
+        _now = now;
+        return;
+    };
+    if(now - _now >= RDS_TMC_STORE_WHEEL_SLOTS) {
+        //Stepping through a long gap would take one iteration per minute:
+        //take everything off the wheel once instead, expiring what is due
+        //and scheduling the rest again against the new time.
+        _now = now;
+        for(byte l = 0; l < RDS_TMC_STORE_WHEEL_LEVELS; l++)
+            for(byte s = 0; s < RDS_TMC_STORE_WHEEL_SLOTS; s++)
+                while(_wheel[l][s] != RDS_TMC_STORE_NIL) {
+                    word index = _wheel[l][s];
+
+                    if(_entries[index].expires <= _now)
+                        release(index, RDS_TMC_STORE_EXPIRED);
+                    else {
+                        unschedule(index);
+                        _entries[index].wheelNext = pending;
+                        pending = index;
+                    };
+                };
+        while(pending != RDS_TMC_STORE_NIL) {
+            word next = _entries[pending].wheelNext;
+
+            schedule(pending);
+            pending = next;
+        };
+        return;
+    };
+
+    while(_now < now) {
+        _now++;
+        //Cascade higher levels down whenever the lower one wraps around.
+        for(byte level = 1; level < RDS_TMC_STORE_WHEEL_LEVELS; level++) {
+            if(_now & ((1UL << (RDS_TMC_STORE_WHEEL_SHIFT * level)) - 1))
+                break;
+
+            byte slot = (_now >> (RDS_TMC_STORE_WHEEL_SHIFT * level)) &
+                        (RDS_TMC_STORE_WHEEL_SLOTS - 1);
+            word index = _wheel[level][slot];
+
+            _wheel[level][slot] = RDS_TMC_STORE_NIL;
+            while(index != RDS_TMC_STORE_NIL) {
+                word next = _entries[index].wheelNext;
+
+                schedule(index);
+                index = next;
+            };
+        };
+
+        byte slot = _now & (RDS_TMC_STORE_WHEEL_SLOTS - 1);
+        while(_wheel[0][slot] != RDS_TMC_STORE_NIL)
+            release(_wheel[0][slot], RDS_TMC_STORE_EXPIRED);
+    };
+};
+
+const TRDSTMCStoreEntry *TMCMessageStore::find(byte locationTableNumber,
+                                               word location, bool direction,
+                                               byte updateClass) {
+    word index = _buckets[bucketFor(locationTableNumber, location, direction)];
+
+    while(index != RDS_TMC_STORE_NIL) {
+        TRDSTMCStoreEntry *entry = &_entries[index];
+
+        if(entry->locationTableNumber == locationTableNumber &&
+           entry->message.location == location &&
+           entry->message.direction == direction &&
+           entry->updateClass == updateClass)
+            return entry;
+        index = entry->chainNext;
+    };
+
+    return NULL;
+};
+
+bool TMCMessageStore::update(byte locationTableNumber,
+                             const TRDSTMCDecodedMessage *message) {
+    TRDSTMCEventInfo info;
+    TRDSTMCStoreEntry *entry;
+    word index;
+    bool longerLasting, replaced;
+
+    //Persistence is relative to the clock, which has to be set first.
+    if(!(message && _now))
+        return false;
+    if(!_translator.getTMCEventInfo(message->event, &info))
+        return false;
+
+    //Every update class has its own "message cancelled" event, the only
+    //silent events without a duration; the management class one, as well as
+    //"nothing to report", cancels all classes.
+    if((info.nature == RDS_TMC_NATURE_SILENT && !info.silentDuration) ||
+       message->event == RDS_TMC_EVENT_NOTHING_TO_REPORT) {
+        cancel(locationTableNumber, message->location, message->direction,
+               message->extent, info.updateClass);
+        return true;
+    };
+    if(info.updateClass == RDS_TMC_UPDATE_CLASS_MANAGEMENT)
+        //Null and test messages carry nothing worth storing.
+        return true;
+
+    longerLasting = info.longerLasting;
+    if(message->controls & (0x1 << RDS_TMC_L1_DURATION_INV))
+        longerLasting = !longerLasting;
+
+    entry = (TRDSTMCStoreEntry *)find(locationTableNumber, message->location,
+                                      message->direction, info.updateClass);
+    replaced = (entry != NULL);
+    if(replaced) {
+        index = entry - _entries;
+        unschedule(index);
+    } else {
+        word *bucket;
+
+        if(_free == RDS_TMC_STORE_NIL)
+            return false;
+        index = _free;
+        entry = &_entries[index];
+        _free = entry->chainNext;
+        _count++;
+
+        bucket = &_buckets[bucketFor(locationTableNumber, message->location,
+                                     message->direction)];
+        entry->chainNext = *bucket;
+        *bucket = index;
+        entry->locationTableNumber = locationTableNumber;
+        entry->updateClass = info.updateClass;
+    };
+
+    entry->message = *message;
+    entry->received = _now;
+    entry->expires = expiryFor(message->duration, longerLasting);
+    schedule(index);
+
+    if(_callback)
+        _callback(_context, entry, replaced ? RDS_TMC_STORE_REPLACED :
+                                              RDS_TMC_STORE_ADDED);
+
+    return true;
+};
@@ -0,0 +1,210 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This file contains the TMC message store, which keeps the currently valid
+ * set of decoded TMC messages and expires them according to their duration.
+ */
+
+#ifndef _TMCMESSAGESTORE_H_INCLUDED
+#define _TMCMESSAGESTORE_H_INCLUDED
+
+#include "RDSDecoder.h"
+#include "TMCAssembler.h"
+
+//Index value used as "no entry" in all the store's linked lists.
+#define RDS_TMC_STORE_NIL 0xFFFF
+
+//Timing wheel geometry: 4 levels of 64 slots each, the first one having a
+//resolution of one minute, which covers about 32 years of persistence.
+#define RDS_TMC_STORE_WHEEL_LEVELS 4
+#define RDS_TMC_STORE_WHEEL_SHIFT 6
+#define RDS_TMC_STORE_WHEEL_SLOTS (1 << RDS_TMC_STORE_WHEEL_SHIFT)
+
+//Update class of the message management events (cancellation, null message,
+//nothing to report, test message) in ISO 14819-2.
+#define RDS_TMC_UPDATE_CLASS_MANAGEMENT 31
+#define RDS_TMC_EVENT_MESSAGE_CANCELLED 2040
+#define RDS_TMC_EVENT_NOTHING_TO_REPORT 2041
+#if !defined(RDS_TMC_NATURE_SILENT)
+# define RDS_TMC_NATURE_SILENT 0x2
+#endif
+
+// Values for the reason argument of TTMCStoreCallback
+#define RDS_TMC_STORE_ADDED 0x0
+#define RDS_TMC_STORE_REPLACED 0x1
+#define RDS_TMC_STORE_CANCELLED 0x2
+#define RDS_TMC_STORE_EXPIRED 0x3
+
+typedef struct {
+    word chainNext;
+    word wheelNext;
+    word wheelPrev;
+    byte wheelLevel;
+    byte wheelSlot;
+    byte locationTableNumber;
+    byte updateClass;
+    uint32_t received;
+    uint32_t expires;
+    TRDSTMCDecodedMessage message;
+} TRDSTMCStoreEntry;
+
+//TMC Message Store callback prototype.
+//The first parameter is the context pointer given at registration time, the
+//second points to the affected entry and the third is one of the
+//RDS_TMC_STORE_* reasons. For RDS_TMC_STORE_REPLACED the entry already
+//contains the new message. For RDS_TMC_STORE_CANCELLED and
+//RDS_TMC_STORE_EXPIRED, the entry is released right after the call returns.
+typedef void (*TTMCStoreCallback)(void *, const TRDSTMCStoreEntry *, byte);
+
+class TMCMessageStore
+{
+    public:
+        /*
+        * Description:
+        *   Constructor, sets up the store over caller-provided storage so that
+        *   its size can be chosen to fit anything from an MCU to a server.
+        * Parameters:
+        *   entries - an array of capacity TRDSTMCStoreEntry structs which
+        *             will hold the messages.
+        *   capacity - number of elements in entries, at most
+        *              RDS_TMC_STORE_NIL - 1.
+        *   buckets - an array of bucketCount words used as the hash index,
+        *             about as many buckets as entries is a good choice.
+        *   bucketCount - number of elements in buckets, non-zero.
+        */
+        TMCMessageStore(TRDSTMCStoreEntry entries[], word capacity,
+                        word buckets[], word bucketCount);
+
+        /*
+        * Description:
+        *   Registers the callback that is notified of every change to the set
+        *   of stored messages. Using NULL for the first parameter removes the
+        *   current callback, if any.
+        */
+        void registerCallback(TTMCStoreCallback callback = NULL,
+                              void *context = NULL);
+
+        /*
+        * Description:
+        *   Advances the store's clock, expiring every message whose
+        *   persistence ran out in the meantime. Only the wheel slots between
+        *   the previous and the new time are visited; a gap of a whole turn
+        *   of the first wheel level (64 minutes) or more takes every message
+        *   off the wheel once and schedules the survivors again instead, so
+        *   no call costs more than the wheel size plus the number of
+        *   messages.
+        *   Call it before the first update().
+        * Parameters:
+        *   now - the current local time in minutes since 1970-01-01 00:00,
+        *         which is what the "until midnight", "end of week" and "end of
+        *         month" persistence values are computed against. The clock
+        *         never goes backwards, earlier values are ignored.
+        */
+        void setTime(uint32_t now);
+
+        /*
+        * Description:
+        *   Applies a decoded message to the store according to the ISO 14819-1
+        *   update rules: a message replaces any previous one with the same
+        *   location table, location, direction and update class; the
+        *   "message cancelled" event of an update class deletes the messages
+        *   of that class with the same location table, location, direction
+        *   and extent, while the management class "message cancelled" and
+        *   "nothing to report" events delete them regardless of class.
+        * Parameters:
+        *   locationTableNumber - the LTN the message refers to (from group
+        *                         3A or from the FLT in the message).
+        *   message - pointer to the decoded message.
+        * Returns:
+        *   true if the message was stored or acted upon, false if the event is
+        *   unknown, the store is full or setTime() was never called.
+        */
+        bool update(byte locationTableNumber,
+                    const TRDSTMCDecodedMessage *message);
+
+        /*
+        * Description:
+        *   Finds the stored message for the given key.
+        * Returns:
+        *   pointer to the entry, or NULL if there is no such message.
+        */
+        const TRDSTMCStoreEntry *find(byte locationTableNumber, word location,
+                                      bool direction, byte updateClass);
+
+        /*
+        * Description:
+        *   Returns the number of messages currently stored.
+        */
+        word count(void) { return _count; }
+
+        /*
+        * Description:
+        *   Deletes all stored messages without notifying the callback.
+        */
+        void clear(void);
+
+    private:
+        RDSTranslator _translator;
+        TRDSTMCStoreEntry *_entries;
+        word _capacity;
+        word *_buckets;
+        word _bucketCount;
+        word _free;
+        word _count;
+        uint32_t _now;
+        word _wheel[RDS_TMC_STORE_WHEEL_LEVELS][RDS_TMC_STORE_WHEEL_SLOTS];
+        TTMCStoreCallback _callback;
+        void *_context;
+
+        /*
+        * Description:
+        *   Computes the hash bucket for a message key. The update class is
+        *   deliberately left out so that all the messages for one location and
+        *   direction share a chain, which is what cancellation needs.
+        */
+        word bucketFor(byte locationTableNumber, word location,
+                       bool direction);
+
+        /*
+        * Description:
+        *   Computes the expiry time of a message according to
+        *   the duration and persistence table of ISO 14819-1, relative to the
+        *   store's clock.
+        */
+        uint32_t expiryFor(byte duration, bool longerLasting);
+
+        /*
+        * Description:
+        *   Links an entry into the timing wheel slot matching its expiry time.
+        */
+        void schedule(word index);
+
+        /*
+        * Description:
+        *   Unlinks an entry from whatever timing wheel slot it is in.
+        */
+        void unschedule(word index);
+
+        /*
+        * Description:
+        *   Unlinks an entry from the wheel and the hash index, notifies the
+        *   callback and returns the entry to the free list.
+        */
+        void release(word index, byte reason);
+
+        /*
+        * Description:
+        *   Deletes the messages of the given update class at the given
+        *   location, direction and extent, of all classes for
+        *   RDS_TMC_UPDATE_CLASS_MANAGEMENT.
+        */
+        void cancel(byte locationTableNumber, word location, bool direction,
+                    byte extent, byte updateClass);
+};
+
+#endif
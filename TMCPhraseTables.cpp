@@ -0,0 +1,237 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This is the code file for the run-time loadable TMC phrase tables.
+ * See the header file for better function documentation.
+ */
+
+#include "TMCPhraseTables.h"
+
+#if defined(__i386__) || defined(__x86_64__)
+
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+TMCPhraseTables::TMCPhraseTables(void) {
+    _file = NULL;
+    _size = 0;
+    _header = NULL;
+};
+
+TMCPhraseTables::~TMCPhraseTables(void) {
+    unmap();
+};
+
+bool TMCPhraseTables::map(const char *file) {
+    struct stat status;
+    const TRDSTMCPhraseHeader *header;
+    const TRDSTMCPhraseLanguage *languages;
+    void *mapped;
+    int fd;
+    bool valid;
+
+    unmap();
+    fd = open(file, O_RDONLY);
+    if(fd < 0)
+        return false;
+    if(fstat(fd, &status) ||
+       (size_t)status.st_size < sizeof(TRDSTMCPhraseHeader)) {
+        close(fd);
+        return false;
+    };
+    mapped = mmap(NULL, status.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if(mapped == MAP_FAILED)
+        return false;
+
+    header = (const TRDSTMCPhraseHeader *)mapped;
+    valid = !memcmp(header->magic, RDS_TMC_PHRASE_MAGIC,
+                    sizeof(header->magic)) &&
+            header->version == RDS_TMC_PHRASE_VERSION &&
+            header->size == (uint64_t)status.st_size &&
+            header->languageCount &&
+            header->languageCount < RDS_TMC_PHRASE_NO_LANGUAGE &&
+            header->eventCount && header->eventCount <= 0x10000 &&
+            header->supplementaryCount <= 0x100 &&
+            header->properties + (uint64_t)header->eventCount *
+            sizeof(TRDSTMCPhraseProperties) <= header->size &&
+            header->languages + (uint64_t)header->languageCount *
+            sizeof(TRDSTMCPhraseLanguage) <= header->size &&
+            header->strings < header->size &&
+            ((const char *)mapped)[header->size - 1] == '\0';
+    //Every language's tables have to be inside the file as well, and its
+    //code NUL-terminated (gentables.py takes at most three characters).
+    languages = (const TRDSTMCPhraseLanguage *)((const byte *)mapped +
+                                                header->languages);
+    for(uint32_t i = 0; valid && i < header->languageCount; i++)
+        valid = memchr(languages[i].code, '\0', sizeof(languages[i].code)) &&
+                languages[i].events + (uint64_t)header->eventCount *
+                sizeof(TRDSTMCPhrase) <= header->size &&
+                languages[i].supplementary +
+                (uint64_t)header->supplementaryCount *
+                sizeof(TRDSTMCPhrase) <= header->size &&
+                languages[i].quantifiers + (uint64_t)RDS_TMC_QTEXTS *
+                sizeof(uint32_t) <= header->size;
+    if(!valid) {
+        munmap(mapped, status.st_size);
+        return false;
+    };
+
+    _file = (const byte *)mapped;
+    _size = status.st_size;
+    _header = header;
+    _properties = (const TRDSTMCPhraseProperties *)(_file +
+                                                    header->properties);
+    _languages = languages;
+    _strings = (const char *)(_file + header->strings);
+
+    return true;
+};
+
+void TMCPhraseTables::unmap(void) {
+    if(_file)
+        munmap((void *)_file, _size);
+    _file = NULL;
+    _size = 0;
+    _header = NULL;
+};
+
+byte TMCPhraseTables::getLanguageCount(void) {
+    return _header ? _header->languageCount : 0;
+};
+
+const char *TMCPhraseTables::getLanguageCode(byte language) {
+    if(!_header || language >= _header->languageCount)
+        return NULL;
+
+    return _languages[language].code;
+};
+
+byte TMCPhraseTables::findLanguage(const char *code) {
+    if(!(_header && code))
+        return RDS_TMC_PHRASE_NO_LANGUAGE;
+
+    for(byte i = 0; i < _header->languageCount; i++)
+        if(!strncmp(_languages[i].code, code, sizeof(_languages[i].code)))
+            return i;
+
+    return RDS_TMC_PHRASE_NO_LANGUAGE;
+};
+
+bool TMCPhraseTables::getEventInfo(word event, TRDSTMCEventInfo *info) {
+    const TRDSTMCPhraseProperties *properties;
+
+    if(!(_header && info) || event >= _header->eventCount)
+        return false;
+    properties = &_properties[event];
+    if(!(properties->flags & RDS_TMC_PHRASE_PRESENT))
+        return false;
+
+    info->code = event;
+    info->quantifier = properties->quantifier;
+    info->nature = properties->nature;
+    info->urgency = properties->urgency;
+    info->longerLasting = properties->flags & RDS_TMC_PHRASE_LONGER_LASTING;
+    info->silentDuration = properties->flags & RDS_TMC_PHRASE_SILENT_DURATION;
+    info->bidirectional = properties->flags & RDS_TMC_PHRASE_BIDIRECTIONAL;
+    info->updateClass = properties->updateClass;
+
+    return true;
+};
+
+const TRDSTMCPhrase *TMCPhraseTables::getPhrase(byte language, word code,
+                                                bool supplementary) {
+    const TRDSTMCPhrase *phrase;
+
+    if(!_header)
+        return NULL;
+    if(code >= (supplementary ? _header->supplementaryCount :
+                                _header->eventCount))
+        return NULL;
+    if(language >= _header->languageCount)
+        language = 0;
+
+    phrase = (const TRDSTMCPhrase *)(_file +
+                                     (supplementary ?
+                                      _languages[language].supplementary :
+                                      _languages[language].events)) + code;
+    if(!phrase->text && language)
+        return getPhrase(0, code, supplementary);
+
+    return (phrase->text && _header->strings + phrase->text < _header->size) ?
+           phrase : NULL;
+};
+
+const char *TMCPhraseTables::getEventText(byte language, word event) {
+    const TRDSTMCPhrase *phrase = getPhrase(language, event, false);
+
+    return phrase ? &_strings[phrase->text] : NULL;
+};
+
+const char *TMCPhraseTables::getSupplementaryText(byte language, byte code) {
+    const TRDSTMCPhrase *phrase = getPhrase(language, code, true);
+
+    return phrase ? &_strings[phrase->text] : NULL;
+};
+
+const char *TMCPhraseTables::getQuantifierText(byte language, byte text) {
+    const uint32_t *texts;
+
+    if(!_header || text >= RDS_TMC_QTEXTS)
+        return NULL;
+    if(language >= _header->languageCount)
+        language = 0;
+
+    texts = _languages[language].quantifiers ?
+            (const uint32_t *)(_file + _languages[language].quantifiers) :
+            NULL;
+    if(!(texts && texts[text]))
+        return language ? getQuantifierText(0, text) : NULL;
+
+    return (_header->strings + texts[text] < _header->size) ?
+           &_strings[texts[text]] : NULL;
+};
+
+size_t TMCPhraseTables::renderEvent(byte language, word event,
+                                    const TRDSTMCLabel labels[], byte count,
+                                    char *buf, size_t size) {
+    const TRDSTMCPhrase *phrase = getPhrase(language, event, false);
+    TRDSTMCEventInfo info;
+    const char *texts[RDS_TMC_QTEXTS];
+    char quantifier[32];
+
+    if(!(buf && size))
+        return 0;
+    buf[0] = '\0';
+    if(!phrase)
+        return 0;
+
+    quantifier[0] = '\0';
+    if(phrase->substitution != RDS_TMC_EVENT_NO_GROUP && labels &&
+       getEventInfo(event, &info)) {
+        for(byte i = 0; i < RDS_TMC_QTEXTS; i++)
+            texts[i] = getQuantifierText(language, i);
+        for(byte i = 0; i < count && !quantifier[0]; i++) {
+            TRDSTMCLabel label = labels[i];
+
+            _translator.decodeQuantifier(info.quantifier, &label, quantifier,
+                                         sizeof(quantifier), texts);
+        };
+    };
+
+    return _translator.renderTMCEventText(&_strings[phrase->text],
+                                          phrase->groupStart,
+                                          phrase->substitution,
+                                          phrase->groupEnd, phrase->elideSpace,
+                                          quantifier, buf, size);
+};
+
+#endif
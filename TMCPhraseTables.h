@@ -0,0 +1,206 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This file contains the run-time loadable TMC phrase tables, which hold the
+ * ISO 14819-2 event and supplementary information texts in several languages
+ * next to one copy of the language independent event properties. The tables
+ * are generated by "gentables.py phrases" and memory-mapped, so this is only
+ * available on hosts with a filesystem and mmap().
+ */
+
+#ifndef _TMCPHRASETABLES_H_INCLUDED
+#define _TMCPHRASETABLES_H_INCLUDED
+
+#include "RDSDecoder.h"
+
+#if defined(__i386__) || defined(__x86_64__)
+
+#define RDS_TMC_PHRASE_MAGIC "RDSTMCPT"
+#define RDS_TMC_PHRASE_VERSION 2
+//Language index value meaning "no such language"
+#define RDS_TMC_PHRASE_NO_LANGUAGE 0xFF
+
+// Values for TRDSTMCPhraseProperties.flags
+#define RDS_TMC_PHRASE_LONGER_LASTING 0x01
+#define RDS_TMC_PHRASE_SILENT_DURATION 0x02
+#define RDS_TMC_PHRASE_BIDIRECTIONAL 0x04
+#define RDS_TMC_PHRASE_PRESENT 0x80
+
+//File layout: the header, then eventCount TRDSTMCPhraseProperties indexed by
+//event code, then languageCount TRDSTMCPhraseLanguage, then for each language
+//eventCount and supplementaryCount TRDSTMCPhrase indexed by code and, if the
+//language has them, RDS_TMC_QTEXTS uint32_t quantifier texts indexed by
+//RDS_TMC_QTEXT_*, then the string pool. All offsets are in bytes from the
+//start of the file, except for TRDSTMCPhrase.text and the quantifier texts
+//which are relative to the string pool (0 meaning that the language has no
+//text for that code). TRDSTMCPhraseLanguage.quantifiers is 0 if the language
+//has no quantifier texts at all. Everything is little endian.
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t size;
+    uint32_t languageCount;
+    uint32_t eventCount;
+    uint32_t supplementaryCount;
+    uint32_t properties;
+    uint32_t languages;
+    uint32_t strings;
+} TRDSTMCPhraseHeader;
+
+typedef struct {
+    uint8_t quantifier;
+    uint8_t nature;
+    uint8_t urgency;
+    uint8_t flags;
+    uint8_t updateClass;
+    uint8_t reserved;
+} TRDSTMCPhraseProperties;
+
+typedef struct {
+    char code[4];
+    uint32_t events;
+    uint32_t supplementary;
+    uint32_t quantifiers;
+} TRDSTMCPhraseLanguage;
+
+typedef struct {
+    uint32_t text;
+    uint8_t groupStart;
+    uint8_t substitution;
+    uint8_t groupEnd;
+    uint8_t elideSpace;
+} TRDSTMCPhrase;
+
+class TMCPhraseTables
+{
+    public:
+        /*
+        * Description:
+        *   Default constructor, creates an empty (unmapped) set of tables.
+        */
+        TMCPhraseTables(void);
+        ~TMCPhraseTables(void);
+
+        /*
+        * Description:
+        *   Memory-maps a phrase table file, replacing any file previously
+        *   mapped.
+        * Returns:
+        *   true if the file was mapped and looks valid, false otherwise.
+        */
+        bool map(const char *file);
+
+        /*
+        * Description:
+        *   Unmaps the current file, if any.
+        */
+        void unmap(void);
+
+        /*
+        * Description:
+        *   Returns the number of languages in the mapped file.
+        */
+        byte getLanguageCount(void);
+
+        /*
+        * Description:
+        *   Returns the code (as given to gentables.py, e.g. "en") of a
+        *   language, or NULL if there is no such language. It points into
+        *   the mapped file and is valid until the file is unmapped.
+        */
+        const char *getLanguageCode(byte language);
+
+        /*
+        * Description:
+        *   Finds a language by its code.
+        * Returns:
+        *   the language index, RDS_TMC_PHRASE_NO_LANGUAGE if not found.
+        */
+        byte findLanguage(const char *code);
+
+        /*
+        * Description:
+        *   Looks up the language independent properties of an event, the
+        *   same way RDSTranslator::getTMCEventInfo() does for the built-in
+        *   event list.
+        * Returns:
+        *   true if the event was found and info filled, false otherwise.
+        */
+        bool getEventInfo(word event, TRDSTMCEventInfo *info);
+
+        /*
+        * Description:
+        *   Returns the raw text of an event in a language, in constant time.
+        *   The text still contains %s where the quantifier goes. If the
+        *   language has no text for the event, the first language's is used.
+        * Returns:
+        *   a pointer into the mapped file, NULL if there is no text at all.
+        */
+        const char *getEventText(byte language, word event);
+
+        /*
+        * Description:
+        *   Renders the text of an event in a language, with its quantifier
+        *   (if any) substituted in, like RDSTranslator::renderTMCEvent() does
+        *   for the built-in event list. The quantifier is rendered by
+        *   RDSTranslator::decodeQuantifier() with the language's quantifier
+        *   texts, see getQuantifierText().
+        * Parameters:
+        *   language - the language index.
+        *   event - a word containing the event code.
+        *   labels - an array of count labels of the message. May be NULL.
+        *   count - number of elements in labels.
+        *   buf - a pointer to a character string buffer that will receive the
+        *         text, always NUL-terminated and truncated if needed.
+        *   size - the size of the buffer provided.
+        * Returns:
+        *   the length of the text in buf, 0 if there is no text.
+        */
+        size_t renderEvent(byte language, word event, const TRDSTMCLabel labels[],
+                           byte count, char *buf, size_t size);
+
+        /*
+        * Description:
+        *   Returns the supplementary information text for a code in a
+        *   language, falling back to the first language like getEventText().
+        * Returns:
+        *   a pointer into the mapped file, NULL if there is no text at all.
+        */
+        const char *getSupplementaryText(byte language, byte code);
+
+        /*
+        * Description:
+        *   Returns one of the texts put around a quantifier value (one of
+        *   RDS_TMC_QTEXT_*) in a language, falling back to the first language
+        *   like getEventText().
+        * Returns:
+        *   a pointer into the mapped file, NULL if there is no such text and
+        *   the built-in English one should be used.
+        */
+        const char *getQuantifierText(byte language, byte text);
+
+    private:
+        RDSTranslator _translator;
+        const byte *_file;
+        size_t _size;
+        const TRDSTMCPhraseHeader *_header;
+        const TRDSTMCPhraseProperties *_properties;
+        const TRDSTMCPhraseLanguage *_languages;
+        const char *_strings;
+
+        /*
+        * Description:
+        *   Returns the phrase for an event (or supplementary information
+        *   code) in a language, falling back to the first language.
+        */
+        const TRDSTMCPhrase *getPhrase(byte language, word code,
+                                       bool supplementary);
+};
+
+#endif
+#endif
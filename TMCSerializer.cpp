@@ -0,0 +1,298 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This is the code file for the TMC message serializer.
+ * See the header file for better function documentation.
+ */
+
+#include "TMCSerializer.h"
+
+#include <string.h>
+
+#if defined(__GNUC__)
+# if defined(__AVR__)
+#  include <avr/pgmspace.h>
+# elif defined(__i386__) || defined(__x86_64__)
+#  define PSTR(s) (s)
+#  define PGM_P const char *
+#  define pgm_read_byte(x) (uint8_t)(*x)
+# endif
+#endif
+
+TMCSerializer::TMCSerializer(char *buf, size_t size, TTMCSerializerSink sink,
+                             void *context) {
+    _buf = buf;
+    _size = size;
+    _used = 0;
+    _total = 0;
+    _sink = sink;
+    _context = context;
+    setText(false);
+};
+
+void TMCSerializer::setText(bool withText, TBlockFetcher eventFetcher,
+                            TBlockFetcher supplementaryFetcher) {
+    _withText = withText;
+    _eventFetcher = eventFetcher;
+    _supplementaryFetcher = supplementaryFetcher;
+};
+
+void TMCSerializer::flush(void) {
+    if(_sink && _used)
+        _sink(_context, _buf, _used);
+    _used = 0;
+};
+
+void TMCSerializer::put(const char *text, size_t length) {
+    _total += length;
+    while(length) {
+        //One byte is always kept for the terminating NUL.
+        size_t room = _size - 1 - _used;
+
+        if(!room) {
+            if(!_sink)
+                return;
+            flush();
+            continue;
+        };
+        if(room > length)
+            room = length;
+        memcpy(&_buf[_used], text, room);
+        _used += room;
+        text += room;
+        length -= room;
+    };
+};
+
+void TMCSerializer::putString(PGM_P text) {
+    char c;
+
+    while((c = pgm_read_byte(text++)))
+        put(&c, 1);
+};
+
+void TMCSerializer::putEscaped(const char *text, byte format) {
+    static const char hex[] = "0123456789abcdef";
+
+    for(; *text; text++) {
+        char c = *text;
+
+        if(format == RDS_TMC_SERIALIZE_JSON) {
+            if(c == '"' || c == '\\') {
+                put("\\", 1);
+                put(&c, 1);
+            } else if((byte)c < 0x20) {
+                char escape[6] = {'\\', 'u', '0', '0', hex[(byte)c >> 4],
+                                  hex[c & 0x0F]};
+
+                put(escape, sizeof(escape));
+            } else
+                put(&c, 1);
+        } else switch(c) {
+            case '&':
+                putString(PSTR("&amp;"));
+                break;
+            case '<':
+                putString(PSTR("&lt;"));
+                break;
+            case '>':
+                putString(PSTR("&gt;"));
+                break;
+            case '"':
+                putString(PSTR("&quot;"));
+                break;
+            default:
+                put(&c, 1);
+        };
+    };
+};
+
+void TMCSerializer::putNumber(uint32_t value) {
+    char digits[10];
+    byte i = sizeof(digits);
+
+    do {
+        digits[--i] = '0' + value % 10;
+        value /= 10;
+    } while(value);
+    put(&digits[i], sizeof(digits) - i);
+};
+
+void TMCSerializer::renderLabel(const TRDSTMCLabel *label, word event,
+                                char *buf, size_t size) {
+    TRDSTMCEventInfo info;
+    TRDSTMCLabel quantifier;
+
+    buf[0] = '\0';
+    switch(label->type) {
+        case RDS_TMC_LABEL_QUANTIFIER_5:
+        case RDS_TMC_LABEL_QUANTIFIER_8:
+            if(!_translator.getTMCEventInfo(event, &info))
+                break;
+            //decodeQuantifier() leaves buf alone if the label does not fit.
+            quantifier = *label;
+            _translator.decodeQuantifier(info.quantifier, &quantifier, buf,
+                                         size);
+            break;
+        case RDS_TMC_LABEL_SUPPLEMENTARY:
+            _translator.renderTMCSupplementary(label->value, buf, size,
+                                               _supplementaryFetcher);
+            break;
+    };
+};
+
+void TMCSerializer::writeJSON(const TRDSTMCDecodedMessage *message,
+                              byte countryCode, byte locationTableNumber) {
+    char text[RDS_TMC_SERIALIZE_TEXT_MAX];
+    word event = message->event;
+
+    putString(PSTR("{\"event\":"));
+    putNumber(message->event);
+    putString(PSTR(",\"location\":"));
+    putNumber(message->location);
+    putString(PSTR(",\"country\":"));
+    putNumber(countryCode);
+    putString(PSTR(",\"ltn\":"));
+    putNumber(locationTableNumber);
+    putString(message->foreignLocation ? PSTR(",\"foreign\":true") :
+                                         PSTR(",\"foreign\":false"));
+    putString(PSTR(",\"direction\":"));
+    putNumber(message->direction);
+    putString(PSTR(",\"extent\":"));
+    putNumber(message->extent);
+    putString(PSTR(",\"duration\":"));
+    putNumber(message->duration);
+    putString(message->diversion ? PSTR(",\"diversion\":true") :
+                                   PSTR(",\"diversion\":false"));
+    putString(PSTR(",\"controls\":"));
+    putNumber(message->controls);
+    putString(message->single ? PSTR(",\"single\":true") :
+                                PSTR(",\"single\":false"));
+    if(_withText &&
+       _translator.renderTMCEvent(message->event, message->labels,
+                                  message->labelCount, text, sizeof(text),
+                                  _eventFetcher)) {
+        putString(PSTR(",\"text\":\""));
+        putEscaped(text, RDS_TMC_SERIALIZE_JSON);
+        putString(PSTR("\""));
+    };
+
+    putString(PSTR(",\"labels\":["));
+    for(byte i = 0; i < message->labelCount; i++) {
+        const TRDSTMCLabel *label = &message->labels[i];
+
+        if(i)
+            putString(PSTR(","));
+        putString(PSTR("{\"label\":"));
+        putNumber(label->type);
+        putString(PSTR(",\"value\":"));
+        putNumber(label->value);
+        if(_withText) {
+            renderLabel(label, event, text, sizeof(text));
+            if(text[0]) {
+                putString(PSTR(",\"text\":\""));
+                putEscaped(text, RDS_TMC_SERIALIZE_JSON);
+                putString(PSTR("\""));
+            };
+        };
+        putString(PSTR("}"));
+        //Quantifiers after an additional event belong to that event.
+        if(label->type == RDS_TMC_LABEL_ADDITIONAL)
+            event = label->value;
+    };
+    putString(PSTR("]}"));
+};
+
+void TMCSerializer::writeDATEX(const TRDSTMCDecodedMessage *message,
+                               byte countryCode, byte locationTableNumber) {
+    static const char hex[] = "0123456789ABCDEF";
+    char text[RDS_TMC_SERIALIZE_TEXT_MAX];
+    word event = message->event;
+
+    //Alert-C country codes are written as the hex digit of the PI nibble.
+    putString(PSTR("<situationRecord><groupOfLocations><alertCPoint>"
+                   "<alertCLocationCountryCode>"));
+    put(&hex[countryCode & 0x0F], 1);
+    putString(PSTR("</alertCLocationCountryCode><alertCLocationTableNumber>"));
+    putNumber(locationTableNumber);
+    putString(PSTR("</alertCLocationTableNumber><alertCDirection>"
+                   "<alertCDirectionCoded>"));
+    putString(message->direction ? PSTR("negative") : PSTR("positive"));
+    putString(PSTR("</alertCDirectionCoded></alertCDirection>"
+                   "<alertCMethod2PrimaryPointLocation><alertCLocation>"
+                   "<specificLocation>"));
+    putNumber(message->location);
+    putString(PSTR("</specificLocation></alertCLocation>"
+                   "</alertCMethod2PrimaryPointLocation></alertCPoint>"
+                   "<alertCExtent>"));
+    putNumber(message->extent);
+    putString(PSTR("</alertCExtent></groupOfLocations><alertCEvent>"
+                   "<eventCode>"));
+    putNumber(message->event);
+    putString(PSTR("</eventCode><durationCode>"));
+    putNumber(message->duration);
+    putString(PSTR("</durationCode><diversionAdvised>"));
+    putString(message->diversion ? PSTR("true") : PSTR("false"));
+    putString(PSTR("</diversionAdvised><controls>"));
+    putNumber(message->controls);
+    putString(PSTR("</controls>"));
+
+    for(byte i = 0; i < message->labelCount; i++) {
+        const TRDSTMCLabel *label = &message->labels[i];
+
+        putString(PSTR("<label type=\""));
+        putNumber(label->type);
+        putString(PSTR("\" value=\""));
+        putNumber(label->value);
+        if(_withText)
+            renderLabel(label, event, text, sizeof(text));
+        if(_withText && text[0]) {
+            putString(PSTR("\">"));
+            putEscaped(text, RDS_TMC_SERIALIZE_DATEX);
+            putString(PSTR("</label>"));
+        } else
+            putString(PSTR("\"/>"));
+        if(label->type == RDS_TMC_LABEL_ADDITIONAL)
+            event = label->value;
+    };
+    putString(PSTR("</alertCEvent>"));
+
+    if(_withText &&
+       _translator.renderTMCEvent(message->event, message->labels,
+                                  message->labelCount, text, sizeof(text),
+                                  _eventFetcher)) {
+        putString(PSTR("<generalPublicComment><comment>"));
+        putEscaped(text, RDS_TMC_SERIALIZE_DATEX);
+        putString(PSTR("</comment></generalPublicComment>"));
+    };
+    putString(PSTR("</situationRecord>"));
+};
+
+size_t TMCSerializer::serialize(const TRDSTMCDecodedMessage *message,
+                                byte countryCode, byte locationTableNumber,
+                                byte format) {
+    if(!(message && _buf && _size > 1))
+        return 0;
+    _used = 0;
+    _total = 0;
+
+    if(message->foreignLocation) {
+        countryCode = message->foreignTable.country;
+        locationTableNumber = message->foreignTable.locationTableNumber;
+    };
+    if(format == RDS_TMC_SERIALIZE_DATEX)
+        writeDATEX(message, countryCode, locationTableNumber);
+    else
+        writeJSON(message, countryCode, locationTableNumber);
+
+    if(_sink)
+        flush();
+    _buf[_used] = '\0';
+
+    return _total;
+};
@@ -0,0 +1,129 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This file contains the TMC message serializer, which writes reassembled
+ * TMC messages out as compact JSON or DATEX II-style XML without allocating.
+ */
+
+#ifndef _TMCSERIALIZER_H_INCLUDED
+#define _TMCSERIALIZER_H_INCLUDED
+
+#include "RDSDecoder.h"
+#include "TMCAssembler.h"
+
+// Values for the format argument of TMCSerializer::serialize()
+#define RDS_TMC_SERIALIZE_JSON 0x0
+#define RDS_TMC_SERIALIZE_DATEX 0x1
+
+//Longest rendered text, an event text with its quantifier substituted in.
+#define RDS_TMC_SERIALIZE_TEXT_MAX (RDS_TMC_EVENT_TEXT_MAX + 32)
+
+//TMC Serializer sink prototype.
+//The first parameter is the context pointer given at construction time, the
+//second points to the next chunk of output and the third is its length. The
+//chunk is not NUL-terminated and is only valid for the duration of the call.
+typedef void (*TTMCSerializerSink)(void *, const char *, size_t);
+
+class TMCSerializer
+{
+    public:
+        /*
+        * Description:
+        *   Constructor, sets up the serializer over a caller-provided buffer.
+        * Parameters:
+        *   buf - a pointer to a character buffer that receives the output.
+        *   size - the size of the buffer provided, at least 2.
+        *   sink - without one, the output is written to buf, NUL-terminated
+        *          and truncated if needed. With one, buf is only used as
+        *          staging and handed to sink every time it fills up, so
+        *          documents of any length can be written.
+        *   context - an opaque pointer handed back as the first argument of
+        *             every sink invocation.
+        */
+        TMCSerializer(char *buf, size_t size, TTMCSerializerSink sink = NULL,
+                      void *context = NULL);
+
+        /*
+        * Description:
+        *   Chooses whether the ISO 14819-2 texts of the event, quantifiers
+        *   and supplementary information are written along with the codes.
+        *   This needs the corresponding tables compiled in and about
+        *   2 * RDS_TMC_SERIALIZE_TEXT_MAX bytes of stack. Off by default.
+        * Parameters:
+        *   withText - true to write the texts.
+        *   eventFetcher, supplementaryFetcher - as the stringFetcher argument
+        *                 of RDSTranslator::renderTMCEvent() and
+        *                 RDSTranslator::renderTMCSupplementary().
+        */
+        void setText(bool withText, TBlockFetcher eventFetcher = NULL,
+                     TBlockFetcher supplementaryFetcher = NULL);
+
+        /*
+        * Description:
+        *   Writes one message as a complete document: a JSON object or a
+        *   DATEX II-style situationRecord element using the Alert-C location
+        *   referencing elements. The labels are written in the order they
+        *   were received, as they qualify the event preceding them.
+        * Parameters:
+        *   message - pointer to the message, as handed to a TMC Assembler
+        *             or TMC Message Store callback.
+        *   countryCode - the country code (PI high nibble) of the service.
+        *   locationTableNumber - the LTN of the service. Both are ignored
+        *             for messages referring to a foreign location table.
+        *   format - one of the RDS_TMC_SERIALIZE_* values.
+        * Returns:
+        *   the length of the document. Without a sink, a value of size or
+        *   more means the output in buf was truncated.
+        */
+        size_t serialize(const TRDSTMCDecodedMessage *message,
+                         byte countryCode, byte locationTableNumber,
+                         byte format);
+
+    private:
+        RDSTranslator _translator;
+        char *_buf;
+        size_t _size;
+        size_t _used;
+        size_t _total;
+        TTMCSerializerSink _sink;
+        void *_context;
+        bool _withText;
+        TBlockFetcher _eventFetcher;
+        TBlockFetcher _supplementaryFetcher;
+
+        /*
+        * Description:
+        *   Low level output: raw text, escaped text (for the given format)
+        *   and unsigned decimal numbers.
+        */
+        void put(const char *text, size_t length);
+        void putString(const char *text);
+        void putEscaped(const char *text, byte format);
+        void putNumber(uint32_t value);
+        void flush(void);
+
+        /*
+        * Description:
+        *   The two document formats.
+        */
+        void writeJSON(const TRDSTMCDecodedMessage *message, byte countryCode,
+                       byte locationTableNumber);
+        void writeDATEX(const TRDSTMCDecodedMessage *message,
+                        byte countryCode, byte locationTableNumber);
+
+        /*
+        * Description:
+        *   Renders the text of a label into buf (empty if it has none):
+        *   quantifiers in the type of the event they follow, supplementary
+        *   information from its table.
+        */
+        void renderLabel(const TRDSTMCLabel *label, word event, char *buf,
+                         size_t size);
+};
+
+#endif
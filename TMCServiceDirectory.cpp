@@ -0,0 +1,265 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This is the code file for the TMC service directory.
+ * See the header file for better function documentation.
+ */
+
+#include "TMCServiceDirectory.h"
+#include "RDSDecoder-private.h"
+
+#include <string.h>
+
+TMCServiceDirectory::TMCServiceDirectory(TRDSTMCServiceInfo services[],
+                                         byte serviceCapacity,
+                                         TRDSTMCStationInfo stations[],
+                                         byte stationCapacity) {
+    _services = services;
+    _serviceCapacity = serviceCapacity < RDS_TMC_DIR_NONE ? serviceCapacity :
+                                                            RDS_TMC_DIR_NONE;
+    _stations = stations;
+    _stationCapacity = stationCapacity < RDS_TMC_DIR_NONE ? stationCapacity :
+                                                            RDS_TMC_DIR_NONE;
+    reset();
+};
+
+void TMCServiceDirectory::reset(void) {
+    _serviceCount = 0;
+    _stationCount = 0;
+    _current = RDS_TMC_DIR_NONE;
+    _extendedCountryCode = 0;
+};
+
+byte TMCServiceDirectory::findStation(word programIdentifier) {
+    for(byte i = 0; i < _stationCount; i++)
+        if(_stations[i].programIdentifier == programIdentifier)
+            return i;
+
+    return RDS_TMC_DIR_NONE;
+};
+
+byte TMCServiceDirectory::findService(byte countryCode,
+                                      byte locationTableNumber,
+                                      byte serviceIdentifier) {
+    for(byte i = 0; i < _serviceCount; i++)
+        if(_services[i].countryCode == countryCode &&
+           _services[i].locationTableNumber == locationTableNumber &&
+           _services[i].serviceIdentifier == serviceIdentifier)
+            return i;
+
+    return RDS_TMC_DIR_NONE;
+};
+
+byte TMCServiceDirectory::addStation(word programIdentifier) {
+    byte index = findStation(programIdentifier);
+
+    if(index != RDS_TMC_DIR_NONE || _stationCount >= _stationCapacity)
+        return index;
+
+    index = _stationCount++;
+    memset(&_stations[index], 0x00, sizeof(_stations[index]));
+    _stations[index].programIdentifier = programIdentifier;
+    _stations[index].service = RDS_TMC_DIR_NONE;
+
+    return index;
+};
+
+byte TMCServiceDirectory::addService(byte countryCode,
+                                     byte locationTableNumber,
+                                     byte serviceIdentifier) {
+    byte index = findService(countryCode, locationTableNumber,
+                             serviceIdentifier);
+
+    if(index != RDS_TMC_DIR_NONE || _serviceCount >= _serviceCapacity)
+        return index;
+
+    index = _serviceCount++;
+    memset(&_services[index], 0x00, sizeof(_services[index]));
+    _services[index].countryCode = countryCode;
+    _services[index].locationTableNumber = locationTableNumber;
+    _services[index].serviceIdentifier = serviceIdentifier;
+
+    return index;
+};
+
+void TMCServiceDirectory::addFrequency(byte station, byte frequency) {
+    TRDSTMCStationInfo *entry;
+
+    //AF codes 1 through 204 are VHF frequencies, the rest are special codes.
+    if(station == RDS_TMC_DIR_NONE || !frequency || frequency > 204)
+        return;
+    entry = &_stations[station];
+    for(byte i = 0; i < entry->frequencyCount; i++)
+        if(entry->frequencies[i] == frequency)
+            return;
+    if(entry->frequencyCount < RDS_TMC_DIR_FREQUENCIES)
+        entry->frequencies[entry->frequencyCount++] = frequency;
+};
+
+void TMCServiceDirectory::linkToCurrent(byte station) {
+    if(station == RDS_TMC_DIR_NONE || _current == RDS_TMC_DIR_NONE)
+        return;
+    if(_stations[station].service == RDS_TMC_DIR_NONE)
+        _stations[station].service = _stations[_current].service;
+};
+
+void TMCServiceDirectory::tune(word programIdentifier, byte frequency) {
+    //The ECC and the Group 3A variants heard before belong to the previous
+    //visit, possibly to another station.
+    _extendedCountryCode = 0;
+    _current = addStation(programIdentifier);
+    if(_current == RDS_TMC_DIR_NONE)
+        return;
+    _stations[_current].pending = 0;
+    _stations[_current].received = true;
+    addFrequency(_current, frequency);
+};
+
+void TMCServiceDirectory::processIdentification(byte extendedCountryCode,
+                                                word tmcIdentification) {
+    if(_current == RDS_TMC_DIR_NONE)
+        return;
+    _extendedCountryCode = extendedCountryCode;
+    _stations[_current].tmcIdentification = tmcIdentification;
+    if(_stations[_current].service != RDS_TMC_DIR_NONE)
+        _services[_stations[_current].service].extendedCountryCode =
+            extendedCountryCode;
+};
+
+void TMCServiceDirectory::processTMCMessage3(word tmcMessage) {
+    TRDSTMCStationInfo *station;
+    TRDSTMCServiceInfo *service;
+    TRDSTMCMessage3 ltn, sid;
+    byte variant = (tmcMessage & RDS_TMC_MESSAGE_VARIANT_MASK) >>
+                   RDS_TMC_MESSAGE_VARIANT_SHR;
+    byte index;
+
+    if(_current == RDS_TMC_DIR_NONE || variant > RDS_TMC_MESSAGE_VARIANT_SID)
+        return;
+    station = &_stations[_current];
+    station->tmcMessage[variant] = tmcMessage;
+    station->pending |= 0x01 << variant;
+    if(station->pending != 0x03)
+        return;
+
+    _translator.unpackTMCMessage3(station->tmcMessage[0], &ltn);
+    _translator.unpackTMCMessage3(station->tmcMessage[1], &sid);
+    index = addService((station->programIdentifier & RDS_PI_COUNTRY_MASK) >>
+                       RDS_PI_COUNTRY_SHR, ltn.locationTableNumber,
+                       sid.serviceIdentifier);
+    station->service = index;
+    if(index == RDS_TMC_DIR_NONE)
+        return;
+
+    service = &_services[index];
+    if(_extendedCountryCode)
+        service->extendedCountryCode = _extendedCountryCode;
+    service->alternateFrequencyIndicator = ltn.alternateFrequencyIndicator;
+    service->mode = ltn.mode;
+    service->scope = (ltn.international ? RDS_TMC_DIR_SCOPE_INTERNATIONAL : 0) |
+                     (ltn.national ? RDS_TMC_DIR_SCOPE_NATIONAL : 0) |
+                     (ltn.regional ? RDS_TMC_DIR_SCOPE_REGIONAL : 0) |
+                     (ltn.urban ? RDS_TMC_DIR_SCOPE_URBAN : 0);
+    service->gapParameter = sid.gapParameter;
+    service->activityTime = sid.activityTime;
+    service->windowTime = sid.windowTime;
+    service->delayTime = sid.delayTime;
+};
+
+void TMCServiceDirectory::processTMCGroup(byte tmcXbits, word tmcYbits,
+                                          word tmcZbits) {
+    TRDSTMCMessage8 unpacked;
+    byte station, service;
+
+    if(_current == RDS_TMC_DIR_NONE)
+        return;
+    _translator.unpackTMCMessage8(tmcXbits, tmcYbits, tmcZbits, &unpacked);
+    if(!unpacked.systemMessage)
+        return;
+
+    switch(unpacked.variantCode) {
+        case RDS_TMC_MESSAGE_VARIANT_SPN_A:
+        case RDS_TMC_MESSAGE_VARIANT_SPN_B:
+            service = _stations[_current].service;
+            if(service == RDS_TMC_DIR_NONE)
+                break;
+            memcpy(&_services[service].providerName[
+                       unpacked.variantCode == RDS_TMC_MESSAGE_VARIANT_SPN_A ?
+                       0 : 4], unpacked.serviceProviderName, 4);
+            _services[service].providerName[8] = '\0';
+            break;
+        case RDS_TMC_MESSAGE_VARIANT_EON_AF:
+            station = addStation(unpacked.programIdentifier2);
+            addFrequency(station, unpacked.alternativeFrequency[0]);
+            addFrequency(station, unpacked.alternativeFrequency[1]);
+            linkToCurrent(station);
+            break;
+        case RDS_TMC_MESSAGE_VARIANT_EON_TM:
+            addFrequency(_current, unpacked.tuningFrequency);
+            station = addStation(unpacked.programIdentifier2);
+            addFrequency(station, unpacked.mappedFrequency);
+            linkToCurrent(station);
+            break;
+        case RDS_TMC_MESSAGE_VARIANT_EON_PI:
+            linkToCurrent(addStation(unpacked.programIdentifier1));
+            linkToCurrent(addStation(unpacked.programIdentifier2));
+            break;
+        case RDS_TMC_MESSAGE_VARIANT_EON_EX:
+            //The other network carries a service of its own.
+            station = addStation(unpacked.programIdentifier2);
+            if(station == RDS_TMC_DIR_NONE)
+                break;
+            service = addService(
+                (unpacked.programIdentifier2 & RDS_PI_COUNTRY_MASK) >>
+                RDS_PI_COUNTRY_SHR, unpacked.locationTableNumber,
+                unpacked.serviceIdentifier);
+            _stations[station].service = service;
+            if(service == RDS_TMC_DIR_NONE)
+                break;
+            _services[service].scope =
+                (unpacked.international ? RDS_TMC_DIR_SCOPE_INTERNATIONAL : 0) |
+                (unpacked.national ? RDS_TMC_DIR_SCOPE_NATIONAL : 0) |
+                (unpacked.regional ? RDS_TMC_DIR_SCOPE_REGIONAL : 0) |
+                (unpacked.urban ? RDS_TMC_DIR_SCOPE_URBAN : 0);
+            break;
+    };
+};
+
+const TRDSTMCServiceInfo *TMCServiceDirectory::getService(byte index) {
+    return index < _serviceCount ? &_services[index] : NULL;
+};
+
+const TRDSTMCStationInfo *TMCServiceDirectory::getStation(byte index) {
+    return index < _stationCount ? &_stations[index] : NULL;
+};
+
+byte TMCServiceDirectory::getStationsForService(byte service, byte stations[],
+                                                byte max) {
+    byte count = 0;
+
+    if(service >= _serviceCount)
+        return 0;
+    for(byte i = 0; i < _stationCount; i++)
+        if(_stations[i].service == service) {
+            if(stations && count < max)
+                stations[count] = i;
+            count++;
+        };
+
+    return count;
+};
+
+bool TMCServiceDirectory::sameService(word programIdentifier1,
+                                      word programIdentifier2) {
+    byte first = findStation(programIdentifier1);
+    byte second = findStation(programIdentifier2);
+
+    return first != RDS_TMC_DIR_NONE && second != RDS_TMC_DIR_NONE &&
+           _stations[first].service != RDS_TMC_DIR_NONE &&
+           _stations[first].service == _stations[second].service;
+};
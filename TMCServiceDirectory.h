@@ -0,0 +1,199 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This file contains the TMC service directory, which records which TMC
+ * services exist and which transmitters (tuned to or announced by other
+ * network information) carry each of them.
+ */
+
+#ifndef _TMCSERVICEDIRECTORY_H_INCLUDED
+#define _TMCSERVICEDIRECTORY_H_INCLUDED
+
+#include "RDSDecoder.h"
+
+//Index value meaning "no such service or station"
+#define RDS_TMC_DIR_NONE 0xFF
+//Number of AF codes remembered per station
+#define RDS_TMC_DIR_FREQUENCIES 8
+
+// Bits of TRDSTMCServiceInfo.scope
+#define RDS_TMC_DIR_SCOPE_INTERNATIONAL 0x08
+#define RDS_TMC_DIR_SCOPE_NATIONAL 0x04
+#define RDS_TMC_DIR_SCOPE_REGIONAL 0x02
+#define RDS_TMC_DIR_SCOPE_URBAN 0x01
+
+//A TMC service is identified by the country code (PI high nibble), the LTN
+//and the SID. The rest is as last received from a station carrying it.
+typedef struct {
+    byte countryCode;
+    byte extendedCountryCode;
+    byte locationTableNumber;
+    byte serviceIdentifier;
+    byte scope;
+    bool alternateFrequencyIndicator;
+    bool mode;
+    byte gapParameter;
+    byte activityTime;
+    byte windowTime;
+    byte delayTime;
+    char providerName[9];
+} TRDSTMCServiceInfo;
+
+typedef struct {
+    word programIdentifier;
+    //Index of the service carried, RDS_TMC_DIR_NONE while not known.
+    byte service;
+    //True once the station was tuned to, false while only announced by others.
+    bool received;
+    word tmcIdentification;
+    byte frequencyCount;
+    byte frequencies[RDS_TMC_DIR_FREQUENCIES];
+    //Group 3A variants 0 and 1 as last received, until both are in.
+    byte pending;
+    word tmcMessage[2];
+} TRDSTMCStationInfo;
+
+class TMCServiceDirectory
+{
+    public:
+        /*
+        * Description:
+        *   Constructor, sets up the directory over caller-provided storage.
+        * Parameters:
+        *   services - an array of serviceCapacity TRDSTMCServiceInfo structs.
+        *   serviceCapacity - number of elements in services, at most 255.
+        *   stations - an array of stationCapacity TRDSTMCStationInfo structs.
+        *   stationCapacity - number of elements in stations, at most 255.
+        */
+        TMCServiceDirectory(TRDSTMCServiceInfo services[],
+                            byte serviceCapacity,
+                            TRDSTMCStationInfo stations[],
+                            byte stationCapacity);
+
+        /*
+        * Description:
+        *   Tells the directory which station is being received, call it
+        *   whenever the receiver is tuned and the PI is known. Everything
+        *   processed afterwards is attributed to this station, which has to
+        *   send its ECC and both Group 3A variants again.
+        * Parameters:
+        *   programIdentifier - the PI of the station.
+        *   frequency - the AF code of the frequency tuned to, 0 if unknown.
+        */
+        void tune(word programIdentifier, byte frequency = 0);
+
+        /*
+        * Description:
+        *   Feeds the ECC and TMC identification of the current station, as
+        *   found in TRDSData after Group 1A variants 0 and 1 were received.
+        */
+        void processIdentification(byte extendedCountryCode,
+                                   word tmcIdentification);
+
+        /*
+        * Description:
+        *   Feeds a Group 3A TMC message (variant 0 or 1), as received by the
+        *   RDS_CALLBACK_AID callback for the AID of TMC. Once both variants
+        *   are in, the current station is linked to its service.
+        * Parameters:
+        *   tmcMessage - a word containing block C of group 3A.
+        */
+        void processTMCMessage3(word tmcMessage);
+
+        /*
+        * Description:
+        *   Feeds a TMC group, as received by the RDS_CALLBACK_TMC callback.
+        *   Only system messages are used: the service provider name and the
+        *   other network information, which adds the announced stations
+        *   along with their frequencies and services.
+        */
+        void processTMCGroup(byte tmcXbits, word tmcYbits, word tmcZbits);
+
+        /*
+        * Description:
+        *   Return the number of services and stations known and the entries
+        *   themselves, by index. getService() and getStation() return NULL
+        *   for invalid indexes.
+        */
+        byte getServiceCount(void) { return _serviceCount; }
+        const TRDSTMCServiceInfo *getService(byte index);
+        byte getStationCount(void) { return _stationCount; }
+        const TRDSTMCStationInfo *getStation(byte index);
+
+        /*
+        * Description:
+        *   Find a service by its identity and a station by its PI.
+        * Returns:
+        *   the index, RDS_TMC_DIR_NONE if not known.
+        */
+        byte findService(byte countryCode, byte locationTableNumber,
+                         byte serviceIdentifier);
+        byte findStation(word programIdentifier);
+
+        /*
+        * Description:
+        *   Lists the stations carrying a service.
+        * Parameters:
+        *   service - the service index.
+        *   stations - an array of max elements receiving station indexes.
+        *   max - number of elements in stations.
+        * Returns:
+        *   the number of stations carrying the service, which may be more
+        *   than max (only max are stored then).
+        */
+        byte getStationsForService(byte service, byte stations[], byte max);
+
+        /*
+        * Description:
+        *   Tells whether two stations are known to carry the same service, so
+        *   that receiving both would be redundant.
+        */
+        bool sameService(word programIdentifier1, word programIdentifier2);
+
+        /*
+        * Description:
+        *   Forgets everything.
+        */
+        void reset(void);
+
+    private:
+        RDSTranslator _translator;
+        TRDSTMCServiceInfo *_services;
+        byte _serviceCapacity;
+        byte _serviceCount;
+        TRDSTMCStationInfo *_stations;
+        byte _stationCapacity;
+        byte _stationCount;
+        byte _current;
+        byte _extendedCountryCode;
+
+        /*
+        * Description:
+        *   Finds or adds a station or a service, returns RDS_TMC_DIR_NONE if
+        *   it is not known and there is no room left.
+        */
+        byte addStation(word programIdentifier);
+        byte addService(byte countryCode, byte locationTableNumber,
+                        byte serviceIdentifier);
+
+        /*
+        * Description:
+        *   Adds an AF code to the frequencies of a station, unless it is
+        *   already there or not a VHF frequency.
+        */
+        void addFrequency(byte station, byte frequency);
+
+        /*
+        * Description:
+        *   Links a station announced by other network information to the
+        *   service of the current station, unless it has one already.
+        */
+        void linkToCurrent(byte station);
+};
+
+#endif
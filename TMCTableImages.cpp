@@ -0,0 +1,283 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This is the code file for the host backend for the ISO 14819-2 table images.
+ * See the header file for better function documentation.
+ */
+
+#include "TMCTableImages.h"
+
+#if defined(__i386__) || defined(__x86_64__)
+
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+TMCTableImages *TMCTableImages::_current = NULL;
+
+//Maps a whole file read-only, returns NULL if it cannot or if it is empty.
+static const byte *mapFile(const char *file, size_t *size) {
+    struct stat status;
+    void *mapped;
+    int fd;
+
+    fd = open(file, O_RDONLY);
+    if(fd < 0)
+        return NULL;
+    if(fstat(fd, &status) || !status.st_size) {
+        close(fd);
+        return NULL;
+    };
+    mapped = mmap(NULL, status.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if(mapped == MAP_FAILED)
+        return NULL;
+    *size = status.st_size;
+
+    return (const byte *)mapped;
+};
+
+TMCTableImages::TMCTableImages(void) {
+    memset(&_events, 0x00, sizeof(_events));
+    memset(&_supplementary, 0x00, sizeof(_supplementary));
+};
+
+TMCTableImages::~TMCTableImages(void) {
+    unmap();
+};
+
+bool TMCTableImages::mapTable(const char *records, const char *strings,
+                              size_t recordSize, TRDSTMCTableImage *table) {
+    const TRDSTMCRecordsHeader *header;
+
+    table->records = mapFile(records, &table->recordsSize);
+    table->strings = (const char *)mapFile(strings, &table->stringsSize);
+    if(!(table->records && table->strings)) {
+        unmapTable(table);
+        return false;
+    };
+
+    header = (const TRDSTMCRecordsHeader *)table->records;
+    //Every string in the EEPROM image is terminated, so they can be used in
+    //place.
+    if(table->recordsSize < sizeof(TRDSTMCRecordsHeader) ||
+       memcmp(header->magic, RDS_TMC_RECORDS_MAGIC, sizeof(header->magic)) ||
+       header->version != RDS_TMC_RECORDS_VERSION ||
+       header->recordSize != recordSize ||
+       !header->recordCount ||
+       sizeof(TRDSTMCRecordsHeader) + (uint64_t)header->recordCount *
+       recordSize > table->recordsSize ||
+       header->stringsSize != table->stringsSize ||
+       table->strings[table->stringsSize - 1] != '\0') {
+        unmapTable(table);
+        return false;
+    };
+    table->header = header;
+    //Lookups rely on the order and on the descriptions, check them once.
+    for(uint32_t i = 0; i < header->recordCount; i++) {
+        const byte *record = table->records + sizeof(TRDSTMCRecordsHeader) +
+                             (size_t)i * recordSize;
+        uint32_t description = (recordSize == sizeof(TRDSTMCEventRecord)) ?
+            ((const TRDSTMCEventRecord *)record)->description :
+            ((const TRDSTMCSupplementaryRecord *)record)->description;
+
+        if(description >= table->stringsSize ||
+           (i && getRecordCode(table, i - 1) >= getRecordCode(table, i))) {
+            unmapTable(table);
+            return false;
+        };
+    };
+
+    return true;
+};
+
+word TMCTableImages::getRecordCode(const TRDSTMCTableImage *table,
+                                   uint32_t index) {
+    const byte *record = table->records + sizeof(TRDSTMCRecordsHeader) +
+                         (size_t)index * table->header->recordSize;
+
+    if(table->header->recordSize == sizeof(TRDSTMCEventRecord))
+        return ((const TRDSTMCEventRecord *)record)->code;
+    else
+        return ((const TRDSTMCSupplementaryRecord *)record)->code;
+};
+
+const void *TMCTableImages::findRecord(const TRDSTMCTableImage *table,
+                                       word code) {
+    uint32_t low = 0, high, middle;
+    word found;
+
+    if(!table->header)
+        return NULL;
+    high = table->header->recordCount;
+    while(low < high) {
+        middle = low + (high - low) / 2;
+        found = getRecordCode(table, middle);
+        if(found == code)
+            return table->records + sizeof(TRDSTMCRecordsHeader) +
+                   (size_t)middle * table->header->recordSize;
+        if(found < code)
+            low = middle + 1;
+        else
+            high = middle;
+    };
+
+    return NULL;
+};
+
+void TMCTableImages::unmapTable(TRDSTMCTableImage *table) {
+    if(table->records)
+        munmap((void *)table->records, table->recordsSize);
+    if(table->strings)
+        munmap((void *)table->strings, table->stringsSize);
+    memset(table, 0x00, sizeof(*table));
+};
+
+bool TMCTableImages::map(const char *events, const char *eventStrings,
+                         const char *supplementary,
+                         const char *supplementaryStrings) {
+    unmap();
+    if(!mapTable(events, eventStrings, sizeof(TRDSTMCEventRecord), &_events))
+        return false;
+    if(supplementary &&
+       !mapTable(supplementary, supplementaryStrings,
+                 sizeof(TRDSTMCSupplementaryRecord), &_supplementary)) {
+        unmap();
+        return false;
+    };
+    _current = this;
+
+    return true;
+};
+
+void TMCTableImages::unmap(void) {
+    unmapTable(&_events);
+    unmapTable(&_supplementary);
+    if(_current == this)
+        _current = NULL;
+};
+
+bool TMCTableImages::getEventInfo(word event, TRDSTMCEventInfo *info) {
+    const TRDSTMCEventRecord *record;
+
+    record = (const TRDSTMCEventRecord *)findRecord(&_events, event);
+    if(!(record && info))
+        return false;
+
+    info->code = record->code;
+    info->quantifier = record->quantifier;
+    info->nature = record->nature;
+    info->urgency = record->urgency;
+    info->longerLasting = record->flags & RDS_TMC_RECORD_LONGER_LASTING;
+    info->silentDuration = record->flags & RDS_TMC_RECORD_SILENT_DURATION;
+    info->bidirectional = record->flags & RDS_TMC_RECORD_BIDIRECTIONAL;
+    info->updateClass = record->updateClass;
+
+    return true;
+};
+
+const char *TMCTableImages::getEventText(word event) {
+    const TRDSTMCEventRecord *record;
+
+    record = (const TRDSTMCEventRecord *)findRecord(&_events, event);
+
+    return record ? &_events.strings[record->description] : NULL;
+};
+
+const char *TMCTableImages::getSupplementaryText(byte code) {
+    const TRDSTMCSupplementaryRecord *record;
+
+    record = (const TRDSTMCSupplementaryRecord *)findRecord(&_supplementary,
+                                                            code);
+
+    return record ? &_supplementary.strings[record->description] : NULL;
+};
+
+size_t TMCTableImages::renderEvent(word event, const TRDSTMCLabel labels[],
+                                   byte count, char *buf, size_t size) {
+    const TRDSTMCEventRecord *record;
+    char quantifier[32];
+
+    if(!(buf && size))
+        return 0;
+    buf[0] = '\0';
+    record = (const TRDSTMCEventRecord *)findRecord(&_events, event);
+    if(!record)
+        return 0;
+
+    quantifier[0] = '\0';
+    if(record->substitution != RDS_TMC_EVENT_NO_GROUP && labels)
+        for(byte i = 0; i < count && !quantifier[0]; i++) {
+            TRDSTMCLabel label = labels[i];
+
+            _translator.decodeQuantifier(record->quantifier, &label, quantifier,
+                                         sizeof(quantifier));
+        };
+
+    return _translator.renderTMCEventText(&_events.strings[record->description],
+                                          record->groupStart,
+                                          record->substitution,
+                                          record->groupEnd, record->elideSpace,
+                                          quantifier, buf, size);
+};
+
+size_t TMCTableImages::renderSupplementary(byte code, char *buf,
+                                           size_t size) {
+    const char *text = getSupplementaryText(code);
+    size_t length;
+
+    if(!(buf && size))
+        return 0;
+    buf[0] = '\0';
+    if(!text)
+        return 0;
+
+    length = strlen(text);
+    if(length > size - 1)
+        length = size - 1;
+    memcpy(buf, text, length);
+    buf[length] = '\0';
+
+    return length;
+};
+
+void TMCTableImages::fetchString(const TRDSTMCTableImage *table,
+                                 const void *source, void *destination,
+                                 size_t size) {
+    //The "pointer" is really the EEPROM address.
+    size_t offset = (size_t)source, available = 0;
+
+    if(table->strings && offset < table->stringsSize)
+        available = table->stringsSize - offset;
+    if(available > size)
+        available = size;
+    if(available)
+        memcpy(destination, &table->strings[offset], available);
+    memset((byte *)destination + available, 0x00, size - available);
+};
+
+void TMCTableImages::eventStringFetcher(const void *source, void *destination,
+                                        size_t size) {
+    static const TRDSTMCTableImage none = {NULL, 0, NULL, 0, NULL};
+
+    fetchString(_current ? &_current->_events : &none, source, destination,
+                size);
+};
+
+void TMCTableImages::supplementaryStringFetcher(const void *source,
+                                                void *destination,
+                                                size_t size) {
+    static const TRDSTMCTableImage none = {NULL, 0, NULL, 0, NULL};
+
+    fetchString(_current ? &_current->_supplementary : &none, source,
+                destination, size);
+};
+
+#endif
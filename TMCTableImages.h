@@ -0,0 +1,223 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This file contains the host backend for the ISO 14819-2 table images: it
+ * memory-maps the EEPROM images (iso14819-2-*.eeprom) and the matching records
+ * images (iso14819-2-*.records) written by gentables.py, so that the event and
+ * supplementary information tables can be updated by shipping data files,
+ * without recompiling. Only available on hosts with a filesystem and mmap().
+ */
+
+#ifndef _TMCTABLEIMAGES_H_INCLUDED
+#define _TMCTABLEIMAGES_H_INCLUDED
+
+#include "RDSDecoder.h"
+
+#if defined(__i386__) || defined(__x86_64__)
+
+#define RDS_TMC_RECORDS_MAGIC "RDSTMCRI"
+#define RDS_TMC_RECORDS_VERSION 1
+
+// Values for TRDSTMCEventRecord.flags
+#define RDS_TMC_RECORD_LONGER_LASTING 0x01
+#define RDS_TMC_RECORD_SILENT_DURATION 0x02
+#define RDS_TMC_RECORD_BIDIRECTIONAL 0x04
+
+//A records image is this header followed by recordCount records of
+//recordSize bytes, sorted by code like the built-in tables (each code
+//appearing once), so they are binary searched in place. description is the
+//offset of the string in the EEPROM image, which has to be stringsSize bytes
+//long. Everything is little endian.
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t recordSize;
+    uint32_t recordCount;
+    uint32_t stringsSize;
+} TRDSTMCRecordsHeader;
+
+typedef struct {
+    uint16_t code;
+    uint8_t quantifier;
+    uint8_t nature;
+    uint8_t urgency;
+    uint8_t flags;
+    uint8_t updateClass;
+    uint8_t groupStart;
+    uint8_t substitution;
+    uint8_t groupEnd;
+    uint8_t elideSpace;
+    uint8_t reserved;
+    uint32_t description;
+} TRDSTMCEventRecord;
+
+typedef struct {
+    uint8_t code;
+    uint8_t reserved[3];
+    uint32_t description;
+} TRDSTMCSupplementaryRecord;
+
+typedef struct {
+    const byte *records;
+    size_t recordsSize;
+    const char *strings;
+    size_t stringsSize;
+    const TRDSTMCRecordsHeader *header;
+} TRDSTMCTableImage;
+
+class TMCTableImages
+{
+    public:
+        /*
+        * Description:
+        *   Default constructor, creates an empty (unmapped) set of tables.
+        */
+        TMCTableImages(void);
+        ~TMCTableImages(void);
+
+        /*
+        * Description:
+        *   Memory-maps the table images, replacing any previously mapped.
+        *   The images are shared read-only, so all the processes using them
+        *   on one host share one page cache copy. The tables mapped last
+        *   become the ones served by the string fetchers below.
+        * Parameters:
+        *   events - path of the event list records image.
+        *   eventStrings - path of the event list EEPROM image.
+        *   supplementary - path of the supplementary information records
+        *                   image, may be NULL.
+        *   supplementaryStrings - path of the supplementary information
+        *                          EEPROM image, may be NULL.
+        * Returns:
+        *   true if all the given images were mapped and look valid, false
+        *   otherwise (in which case nothing is mapped).
+        */
+        bool map(const char *events, const char *eventStrings,
+                 const char *supplementary = NULL,
+                 const char *supplementaryStrings = NULL);
+
+        /*
+        * Description:
+        *   Unmaps the current images, if any.
+        */
+        void unmap(void);
+
+        /*
+        * Description:
+        *   Looks up the properties of an event, like
+        *   RDSTranslator::getTMCEventInfo() does in the built-in event list.
+        * Returns:
+        *   true if the event was found and info filled, false otherwise.
+        */
+        bool getEventInfo(word event, TRDSTMCEventInfo *info);
+
+        /*
+        * Description:
+        *   Returns the raw text of an event, still containing the %s where the
+        *   quantifier goes, or NULL if there is no such event. The pointer is
+        *   into the mapped image, nothing is copied.
+        */
+        const char *getEventText(word event);
+
+        /*
+        * Description:
+        *   Returns the text of a supplementary information code, or NULL if
+        *   there is no such code. The pointer is into the mapped image.
+        */
+        const char *getSupplementaryText(byte code);
+
+        /*
+        * Description:
+        *   Renders the text of an event with its quantifier (if any)
+        *   substituted in, like RDSTranslator::renderTMCEvent() does with the
+        *   built-in event list.
+        * Parameters:
+        *   event - a word containing the event code.
+        *   labels - an array of count labels of the message. May be NULL.
+        *   count - number of elements in labels.
+        *   buf - a pointer to a character string buffer that will receive the
+        *         text, always NUL-terminated and truncated if needed.
+        *   size - the size of the buffer provided.
+        * Returns:
+        *   the length of the text in buf, 0 if there is no such event.
+        */
+        size_t renderEvent(word event, const TRDSTMCLabel labels[], byte count,
+                           char *buf, size_t size);
+
+        /*
+        * Description:
+        *   Renders the text of a supplementary information code, like
+        *   RDSTranslator::renderTMCSupplementary() does.
+        * Returns:
+        *   the length of the text in buf, 0 if there is no such code.
+        */
+        size_t renderSupplementary(byte code, char *buf, size_t size);
+
+        /*
+        * Description:
+        *   TBlockFetcher compatible functions reading from the event list and
+        *   supplementary information EEPROM images mapped last, for use as
+        *   the stringFetcher of RDSTranslator::renderTMCEvent() and
+        *   RDSTranslator::renderTMCSupplementary() in a host build with
+        *   WITH_RDS_TMC_ALLIN_EEPROM. The source is the EEPROM address; reads
+        *   past the end of the image are filled with zeroes. NOTE: having no
+        *   context, they serve the images of whichever TMCTableImages object
+        *   called map() last, process-wide: mapping or unmapping while
+        *   another thread renders through them is not safe.
+        */
+        static void eventStringFetcher(const void *source, void *destination,
+                                       size_t size);
+        static void supplementaryStringFetcher(const void *source,
+                                               void *destination, size_t size);
+
+    private:
+        static TMCTableImages *_current;
+        RDSTranslator _translator;
+        TRDSTMCTableImage _events;
+        TRDSTMCTableImage _supplementary;
+
+        /*
+        * Description:
+        *   Maps one records image and its EEPROM image into table.
+        */
+        static bool mapTable(const char *records, const char *strings,
+                             size_t recordSize, TRDSTMCTableImage *table);
+
+        /*
+        * Description:
+        *   Unmaps one records image and its EEPROM image.
+        */
+        static void unmapTable(TRDSTMCTableImage *table);
+
+        /*
+        * Description:
+        *   Returns the code of a record, by index.
+        */
+        static word getRecordCode(const TRDSTMCTableImage *table,
+                                  uint32_t index);
+
+        /*
+        * Description:
+        *   Binary searches a records image for a code.
+        * Returns:
+        *   a pointer to the record in the mapped image, NULL if not found.
+        */
+        static const void *findRecord(const TRDSTMCTableImage *table,
+                                      word code);
+
+        /*
+        * Description:
+        *   Reads from an EEPROM image like a TBlockFetcher would.
+        */
+        static void fetchString(const TRDSTMCTableImage *table,
+                                const void *source, void *destination,
+                                size_t size);
+};
+
+#endif
+#endif
@@ -0,0 +1,121 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This is the code file for the TMC time window predictor.
+ * See the header file for better function documentation.
+ */
+
+#include "TMCWindowPredictor.h"
+#include "RDSDecoder-private.h"
+
+#include <string.h>
+
+TMCWindowPredictor::TMCWindowPredictor(TRDSTMCWindowStation stations[],
+                                       byte capacity) {
+    _stations = stations;
+    _capacity = capacity < RDS_TMC_WINDOW_NONE ? capacity :
+                                                 RDS_TMC_WINDOW_NONE;
+    reset();
+};
+
+void TMCWindowPredictor::reset(void) {
+    _count = 0;
+    _minuteOffset = 0;
+};
+
+byte TMCWindowPredictor::findStation(word programIdentifier, bool add) {
+    for(byte i = 0; i < _count; i++)
+        if(_stations[i].programIdentifier == programIdentifier)
+            return i;
+    if(!add || _count >= _capacity)
+        return RDS_TMC_WINDOW_NONE;
+
+    memset(&_stations[_count], 0x00, sizeof(_stations[_count]));
+    _stations[_count].programIdentifier = programIdentifier;
+
+    return _count++;
+};
+
+void TMCWindowPredictor::processTMCMessage3(word programIdentifier,
+                                            word tmcMessage) {
+    TRDSTMCMessage3 unpacked;
+    byte index = findStation(programIdentifier, true);
+
+    if(index == RDS_TMC_WINDOW_NONE)
+        return;
+    _translator.unpackTMCMessage3(tmcMessage, &unpacked);
+    switch(unpacked.variantCode) {
+        case RDS_TMC_MESSAGE_VARIANT_LTN:
+            _stations[index].mode = unpacked.mode;
+            break;
+        case RDS_TMC_MESSAGE_VARIANT_SID:
+            _stations[index].timing = true;
+            _stations[index].activityTime = unpacked.activityTime;
+            _stations[index].windowTime = unpacked.windowTime;
+            _stations[index].delayTime = unpacked.delayTime;
+            break;
+    };
+};
+
+void TMCWindowPredictor::synchronize(uint32_t now) {
+    _minuteOffset = now % RDS_TMC_WINDOW_CYCLE;
+};
+
+bool TMCWindowPredictor::getNextWindow(word programIdentifier, uint32_t now,
+                                       TRDSTMCWindow *window) {
+    byte index = findStation(programIdentifier, false);
+    const TRDSTMCWindowStation *station;
+    byte activity, period, second, start;
+    uint32_t minute;
+
+    if(index == RDS_TMC_WINDOW_NONE || !window)
+        return false;
+    station = &_stations[index];
+    if(!(station->mode && station->timing))
+        return false;
+
+    //Ta is 4 << code, Tw is 1 << code and Td is the code itself, in seconds.
+    activity = 4 << station->activityTime;
+    period = activity + (1 << station->windowTime);
+    second = (now + RDS_TMC_WINDOW_CYCLE - _minuteOffset) %
+             RDS_TMC_WINDOW_CYCLE;
+    minute = now - second;
+
+    if(second < station->delayTime) {
+        start = station->delayTime;
+    } else {
+        start = station->delayTime +
+                (second - station->delayTime) / period * period;
+        if(second >= start + activity)
+            start += period;
+    };
+    if(start >= RDS_TMC_WINDOW_CYCLE) {
+        //No more windows this minute, the next one is Td into the next.
+        minute += RDS_TMC_WINDOW_CYCLE;
+        start = station->delayTime;
+    };
+
+    window->start = minute + start;
+    window->end = window->start + activity;
+    //The cycle restarts on the minute, cutting short the last window.
+    if(window->end > minute + RDS_TMC_WINDOW_CYCLE)
+        window->end = minute + RDS_TMC_WINDOW_CYCLE;
+    if(window->start < now)
+        window->start = now;
+
+    return true;
+};
+
+bool TMCWindowPredictor::isActive(word programIdentifier, uint32_t now) {
+    TRDSTMCWindow window;
+
+    if(!getNextWindow(programIdentifier, now, &window))
+        return true;
+
+    return window.start <= now;
+};
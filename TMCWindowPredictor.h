@@ -0,0 +1,121 @@
+/* Arduino RDS/RBDS (IEC 62016/NRSC-4-B) Decoding Library
+ * See the README file for author and licensing information. In case it's
+ * missing from your distribution, use the one here as the authoritative
+ * version: https://github.com/csdexter/RDSDecoder/blob/master/README
+ *
+ * This library is for decoding RDS/RBDS data streams (groups).
+ * See the example sketches to learn how to use the library in your code.
+ *
+ * This file contains the TMC time window predictor, which tells when the
+ * stations of services in enhanced mode (mode 1) transmit TMC, so that a
+ * scanning receiver can visit other stations in between.
+ */
+
+#ifndef _TMCWINDOWPREDICTOR_H_INCLUDED
+#define _TMCWINDOWPREDICTOR_H_INCLUDED
+
+#include "RDSDecoder.h"
+
+//Index value meaning "no such station"
+#define RDS_TMC_WINDOW_NONE 0xFF
+
+//Enhanced mode timing repeats every minute, starting on the minute as given
+//by CT (Group 4A).
+#define RDS_TMC_WINDOW_CYCLE 60
+
+typedef struct {
+    word programIdentifier;
+    //Group 3A variant 0 mode bit and variant 1 timing codes, as received.
+    bool mode;
+    bool timing;
+    byte activityTime;
+    byte windowTime;
+    byte delayTime;
+} TRDSTMCWindowStation;
+
+typedef struct {
+    uint32_t start;
+    uint32_t end;
+} TRDSTMCWindow;
+
+class TMCWindowPredictor
+{
+    public:
+        /*
+        * Description:
+        *   Constructor, sets up the predictor over caller-provided storage.
+        * Parameters:
+        *   stations - an array of capacity TRDSTMCWindowStation structs.
+        *   capacity - number of elements in stations, at most 255.
+        */
+        TMCWindowPredictor(TRDSTMCWindowStation stations[], byte capacity);
+
+        /*
+        * Description:
+        *   Feeds a Group 3A TMC message (variant 0 or 1) of a station, as
+        *   received by the RDS_CALLBACK_AID callback for the AID of TMC.
+        * Parameters:
+        *   programIdentifier - the PI of the station.
+        *   tmcMessage - a word containing block C of group 3A.
+        */
+        void processTMCMessage3(word programIdentifier, word tmcMessage);
+
+        /*
+        * Description:
+        *   Aligns the predictions to the minute: call it when a CT group
+        *   (4A) is received, as those are sent on the minute.
+        * Parameters:
+        *   now - current time in seconds, any monotonic clock that is also
+        *         used for the predictions below.
+        */
+        void synchronize(uint32_t now);
+
+        /*
+        * Description:
+        *   Computes the current or next TMC window of a station in enhanced
+        *   mode. Following ISO 14819-1 enhanced mode timing, every minute
+        *   the station transmits TMC for Ta seconds (activity time: 4, 8, 16
+        *   or 32) starting Td seconds (delay time: 0 through 3) past the
+        *   minute, then leaves a Tw second (window time: 1, 2, 4 or 8) gap,
+        *   and repeats this for the rest of the minute.
+        * Parameters:
+        *   programIdentifier - the PI of the station.
+        *   now - current time in seconds, on the synchronize() clock.
+        *   window - pointer to a TRDSTMCWindow struct that will receive the
+        *            window; its start is now if a window is in progress.
+        * Returns:
+        *   true if window was filled, false if the station is not known to
+        *   be in enhanced mode, in which case it may transmit TMC anytime.
+        */
+        bool getNextWindow(word programIdentifier, uint32_t now,
+                           TRDSTMCWindow *window);
+
+        /*
+        * Description:
+        *   Tells whether a station may be transmitting TMC now, i.e. it is in
+        *   a window or not in enhanced mode.
+        */
+        bool isActive(word programIdentifier, uint32_t now);
+
+        /*
+        * Description:
+        *   Forgets all the stations and the minute alignment.
+        */
+        void reset(void);
+
+    private:
+        RDSTranslator _translator;
+        TRDSTMCWindowStation *_stations;
+        byte _capacity;
+        byte _count;
+        byte _minuteOffset;
+
+        /*
+        * Description:
+        *   Finds a station by PI, adding it if asked to and there is room.
+        *   Returns RDS_TMC_WINDOW_NONE if not found.
+        */
+        byte findStation(word programIdentifier, bool add);
+};
+
+#endif
@@ -1,12 +1,14 @@
-#!/usr/bin/python
+#!/usr/bin/env python3
 """
   This will read in CSV-formatted records and generate the equivalent C code as
-  well as raw EEPROM images.
+  well as raw EEPROM images and, for the plain tables, the records images that
+  TMCTableImages maps at run time together with the EEPROM images.
   Used for generating the C code version of the ISO 14819-2 event list and
   supplementary information strings.
 
   Arguments:
-    $1: one of 'events' or 'supplementary'
+    $1: one of 'events', 'supplementary', 'compressed', 'constexpr' or
+        'phrases'
     $2: source file to read in, CSV format, no header row. For both values of
         $1, the field order mimics the one in the standard, as follows:
       'events': event code, event text, event nature, event qualifier, event
@@ -14,6 +16,26 @@
                 class and event text reference phrases.
       'supplementary': supplementary information code, supplementary information
                        text.
+    $3: for 'compressed' only: $2 is then the event list and $3 the
+        supplementary information list, as above. Both tables are compressed
+        with one shared byte pair encoding dictionary (iso14819-2-dictionary.h)
+        into iso14819-2-events-compressed.* and
+        iso14819-2-supplementary-compressed.*, for use with
+        WITH_RDS_TMC_COMPRESSED_STRINGS.
+        For 'constexpr' likewise, both tables go into iso14819-2-constexpr.h as
+        C++17 constexpr arrays, checked with static_assert and with lookups
+        that fold at compile time for known codes.
+    For 'phrases', $2 is the phrase table file to write (see TMCPhraseTables.h)
+    and each further argument is
+    LANGUAGE=EVENTS.csv[,SUPPLEMENTARY.csv[,QUANTIFIERS.csv]], with the same
+    CSV formats as above but UTF-8 encoded. The first language must have all
+    the event columns, the others only need the code and text ones.
+    QUANTIFIERS.csv holds the texts put around quantifier values, one name
+    (from QUANTIFIER_TEXTS below, e.g. UPTO) and text (e.g. "of up to ", with
+    its spaces) per row; missing ones are rendered in English.
+  For events, the position of the optional "(... Q ...)" quantifier group in
+  each string is computed here as well, so that the text can be rendered
+  without parsing it at run time.
   NOTE: this code makes assumptions about (1) the contents of iso14819-2.h and
         (2) the order of inclusion of said header with respect to the generated
         one.
@@ -21,6 +43,7 @@
 
 import csv
 import re
+import struct
 import sys
 
 WORK_TYPES = ['events', 'supplementary']
@@ -45,71 +68,237 @@ URGENCIES = {'': 'NORMAL', 'U': 'URGENT', 'X': 'XURGENT'}
 FIND_Q = re.compile(r'([(][^(]*)(Q)([^)]*[)])')
 REPLACE_Q = r'\1%s\3'
 FIND_BRACE = re.compile(r'[{][^}]*[}]')
+NO_GROUP = 0xFF
+DICTIONARY_FIRST = 0x80
+DICTIONARY_SIZE = 0x80
+NATURE_CODES = {'': 0, 'F': 1, 'S': 2}
+URGENCY_CODES = {'': 0, 'U': 1, 'X': 2}
+PHRASE_MAGIC = b'RDSTMCPT'
+PHRASE_VERSION = 2
+PHRASE_EVENTS = 2048
+PHRASE_SUPPLEMENTARY = 256
+PHRASE_PRESENT = 0x80
+PHRASE_LONGER_LASTING = 0x01
+PHRASE_SILENT_DURATION = 0x02
+PHRASE_BIDIRECTIONAL = 0x04
+RECORDS_MAGIC = b'RDSTMCRI'
+# In RDS_TMC_QTEXT_* order
+QUANTIFIER_TEXTS = ['LESSTHAN', 'UPTO', 'METERS', 'PERCENT', 'KMH', 'MINUTES',
+                    'HOURS', 'CELSIUS', 'TONNES', 'MILLIMETERS', 'MHZ', 'KHZ',
+                    'DECIMAL_POINT']
+RECORDS_VERSION = 1
 
 
 def PostProcessString(s):
   return re.sub(FIND_BRACE, '', re.sub(FIND_Q, REPLACE_Q, s)).strip()
 
 
-def OutputStringPointer(fout, index, offset, worktype):
+def SubstitutionGroup(s, limit=0x7F):
+  """Finds the optional quantifier group in a post-processed event string
+  (bytes) and returns (groupStart, substitution, groupEnd, elideSpace) as
+  byte offsets, see TRDSTMCEventListEntry."""
+  substitution = s.find(b'%s')
+  if substitution < 0:
+    return (NO_GROUP, NO_GROUP, 0, False)
+
+  start = s.rfind(b'(', 0, substitution)
+  end = s.find(b')', substitution) + 1
+  if len(s) > limit or start < 0 or end <= 0:
+    print('Cannot pre-parse event string "%s"!' % s)
+    exit(1)
+  # When the group is left out, one of the spaces around it has to go too.
+  if start > 0:
+    elide = s[start - 1:start] == b' '
+  else:
+    elide = end < len(s) and s[end:end + 1] == b' '
+
+  return (start, substitution, end, elide)
+
+
+def SubstitutionOffsets(s):
+  """Returns the initializer for the groupStart, substitution, groupEnd and
+  elideSpace fields of an event, see TRDSTMCEventListEntry."""
+  start, substitution, end, elide = SubstitutionGroup(
+      PostProcessString(s).encode('latin-1'))
+
+  return ', 0x%02X, 0x%02X, 0x%02X, %d' % (start, substitution, end,
+                                           1 if elide else 0)
+
+
+def OutputStringPointer(fout, index, offset, worktype, extra=''):
   fout.write('#if defined(%sFLASH)\n' % OUTPUT_STRINGS['storage'][worktype])
 
   if worktype == 'events':
-    fout.write(', Event_S_%04X\n' % index)
+    fout.write(', Event_S_%04X%s\n' % (index, extra))
   else:
     fout.write(', Supplementary_S_%02X\n' % index)
 
   fout.write(
-    '#elif defined(%sEEPROM)\n, (const char * const) 0x%04X\n'
-    '#endif\n' % (OUTPUT_STRINGS['storage'][worktype], offset))
+    '#elif defined(%sEEPROM)\n, (const char * const) 0x%04X%s\n'
+    '#endif\n' % (OUTPUT_STRINGS['storage'][worktype], offset, extra))
 
 
-def main(argv):
-  if len(argv) != 3:
-    print ('Invalid calling convention, need exactly two arguments but got '
-           '%d!' % (len(argv) - 1))
-    exit(1)
-  if argv[1] not in WORK_TYPES:
-    print ('Invalid calling convention, argv[1] must be one of %s but got '
-           '"%s"!' % (WORK_TYPES, argv[1]))
-    exit(1)
+def CString(data):
+  """Renders bytes as the body of a C string literal. Octal escapes are used
+  for anything unprintable as they, unlike hex ones, cannot swallow a
+  following digit."""
+  out = []
+  for b in data:
+    if b in (0x22, 0x5C):
+      out.append('\\' + chr(b))
+    elif 0x20 <= b < 0x7F:
+      out.append(chr(b))
+    else:
+      out.append('\\%03o' % b)
+  return ''.join(out)
 
-  if argv[1] == 'events':
-    fname_out = 'iso14819-2-events.h'
-    fname_eeprom = 'iso14819-2-events.eeprom'
-  else:
-    fname_out = 'iso14819-2-supplementary.h'
-    fname_eeprom = 'iso14819-2-supplementary.eeprom'
+
+def TrainDictionary(strings):
+  """Byte pair encoding over the given strings: repeatedly replaces the most
+  frequent pair of adjacent symbols with a new token, 0x80 and up, for as long
+  as that saves space. Returns the list of (left, right) pairs, the token for
+  pair i being DICTIONARY_FIRST + i."""
+  sequences = [list(s.encode('latin-1')) for s in strings]
+  for s in sequences:
+    if max(s + [0]) >= DICTIONARY_FIRST:
+      print('Cannot compress 8-bit string "%s"!' % bytes(s))
+      exit(1)
+  pairs = []
+  while len(pairs) < DICTIONARY_SIZE:
+    counts = {}
+    for s in sequences:
+      for pair in zip(s, s[1:]):
+        counts[pair] = counts.get(pair, 0) + 1
+    if not counts:
+      break
+    # Ties are broken by the pair itself to keep the output reproducible.
+    pair = max(sorted(counts), key=lambda p: counts[p])
+    # Every use saves one byte, the dictionary entry costs two.
+    if counts[pair] <= 2:
+      break
+    token = DICTIONARY_FIRST + len(pairs)
+    pairs.append(pair)
+    for s in sequences:
+      i = 0
+      while i < len(s) - 1:
+        if (s[i], s[i + 1]) == pair:
+          s[i:i + 2] = [token]
+        i += 1
+  return pairs
+
+
+def Compress(pairs, text):
+  """Applies the dictionary in training order, which is how it was built."""
+  s = list(text.encode('latin-1'))
+  for n, pair in enumerate(pairs):
+    i = 0
+    while i < len(s) - 1:
+      if (s[i], s[i + 1]) == pair:
+        s[i:i + 2] = [DICTIONARY_FIRST + n]
+      i += 1
+  return bytes(s)
+
+
+def DictionaryDepth(pairs):
+  """Longest chain of nested tokens, which sizes the decompressor's stack."""
+  depth = {}
+  for n, (left, right) in enumerate(pairs):
+    depth[DICTIONARY_FIRST + n] = 1 + max(depth.get(left, 0),
+                                          depth.get(right, 0))
+  return max(list(depth.values()) + [0])
+
+
+def WriteDictionary(pairs):
+  with open('iso14819-2-dictionary.h', 'w') as fout:
+    fout.write(
+        '/*\n * ISO 14819-2 header file: string compression dictionary\n'
+        ' * DO NOT EDIT: automatically generated by gentables.py from CSV files'
+        '\n */\n\n'
+        '#ifndef _ISO14819_2_DICTIONARY_H_INCLUDED\n'
+        '#define _ISO14819_2_DICTIONARY_H_INCLUDED\n'
+        '#ifdef WITH_RDS_TMC_COMPRESSED_STRINGS\n\n'
+        '#define RDS_TMC_DICTIONARY_FIRST 0x%02X\n'
+        '#define RDS_TMC_DICTIONARY_DEPTH %d\n\n'
+        'const uint8_t ISO14819_2_Dictionary[%d][2] PROGMEM = {\n' % (
+            DICTIONARY_FIRST, DictionaryDepth(pairs), len(pairs)))
+    for left, right in pairs:
+      fout.write('\t{0x%02X, 0x%02X},\n' % (left, right))
+    fout.write('};\n\n#endif\n#endif')
+
+
+def EventFlags(row):
+  """Packs the longer lasting, silent duration and bidirectional properties of
+  an event the way the phrase tables and record images store them."""
+  flags = PHRASE_PRESENT
+  if 'L' in row[4]:
+    flags |= PHRASE_LONGER_LASTING
+  if '(' in row[4] or row[3] == '7':
+    flags |= PHRASE_SILENT_DURATION
+  if row[5] == '2':
+    flags |= PHRASE_BIDIRECTIONAL
+  return flags
+
+
+def WriteRecords(worktype, table, strings, fname):
+  """Writes the records image for one table, see TMCTableImages.h for its
+  layout. strings are the (encoded) strings as written to the EEPROM image."""
+  header = struct.Struct('<8sIIII')
+  record = struct.Struct('<HBBBBBBBBBxI' if worktype == 'events' else '<BxxxI')
+  offset = 0
+
+  with open(fname, 'wb') as fout:
+    fout.write(header.pack(RECORDS_MAGIC, RECORDS_VERSION, record.size,
+                           len(table), sum(len(s) + 1 for s in strings)))
+    for row, data in zip(table, strings):
+      if worktype == 'events':
+        fout.write(record.pack(int(row[0]), int(row[3]), NATURE_CODES[row[2]],
+                               URGENCY_CODES[row[6]], EventFlags(row),
+                               int(row[7]), *SubstitutionGroup(data),
+                               offset))
+      else:
+        fout.write(record.pack(int(row[0]), offset))
+      offset += len(data) + 1
+
+
+def GenerateTable(worktype, table, fname_out, fname_eeprom, encode=None,
+                  fname_records=None):
+  """Writes the header and EEPROM image for one table, with the strings passed
+  through encode (bytes to bytes) if given, and its records image if
+  fname_records is given."""
   eeprom_offset = 0
+  guard = fname_out.upper().replace('-','_').replace('.','_')
 
-  with open(argv[2], 'rb') as fin, open(fname_out, 'w') as fout,\
-      open(fname_eeprom, 'wb') as feeprom:
-    table = list(csv.reader(fin))
+  with open(fname_out, 'w') as fout, open(fname_eeprom, 'wb') as feeprom:
     fout.write(
         '/*\n * ISO 14819-2 header file: %(firstline)s entries\n'
         ' * DO NOT EDIT: automatically generated by gentables.py from CSV files'
         '\n */\n\n'
         '#ifndef _%(fname)s_INCLUDED\n#define _%(fname)s_INCLUDED\n'
         '#ifdef WITH_RDS_TMC_%(worktype)s\n\n' % {
-            'firstline': OUTPUT_STRINGS['firstline'][argv[1]],
-            'fname': fname_out.upper().replace('-','_').replace('.','_'),
-            'worktype': argv[1].upper()})
+            'firstline': OUTPUT_STRINGS['firstline'][worktype],
+            'fname': guard,
+            'worktype': worktype.upper()})
 
-    fout.write('#if defined(%sFLASH)\n' % OUTPUT_STRINGS['storage'][argv[1]])
+    strings = []
     for row in table:
+      text = PostProcessString(row[1])
+      strings.append(encode(text) if encode else text.encode('latin-1'))
+
+    fout.write('#if defined(%sFLASH)\n' % OUTPUT_STRINGS['storage'][worktype])
+    for row, data in zip(table, strings):
       fout.write('const char %s_S_%s[] PROGMEM = "%s";\n' % (
-          'Event' if argv[1] == 'events' else 'Supplementary',
-          '%04X' % int(row[0]) if argv[1] == 'events' else '%02X' % int(row[0]),
-          PostProcessString(row[1])))
-      feeprom.write('%s\x00' % PostProcessString(row[1]))
+          'Event' if worktype == 'events' else 'Supplementary',
+          '%04X' % int(row[0]) if worktype == 'events' else '%02X' % int(row[0]),
+          CString(data)))
+      feeprom.write(data + b'\x00')
     fout.write('#endif\n')
 
     fout.write('\nconst %(varname)s[%(count)d] PROGMEM = {\n' % {
-            'varname': OUTPUT_STRINGS['varname'][argv[1]],
+            'varname': OUTPUT_STRINGS['varname'][worktype],
             'count': len(table)})
 
-    if argv[1] == 'events':
-      for row in table:
+    if worktype == 'events':
+      for row, data in zip(table, strings):
         fout.write('\t{0x%04X, %s, %s, %s, %s, %s, %s, %s\n' % (
             int(row[0]),
             '%s%s' % (QUANTIFIER_PREFIX, QUANTIFIERS[int(row[3])]),
@@ -119,18 +308,333 @@ def main(argv):
             'true' if '(' in row[4] or row[3] == '7' else 'false',
             'true' if row[5] == '2' else 'false',
             row[7]))
-        OutputStringPointer(fout, int(row[0]), eeprom_offset, argv[1])
-        eeprom_offset += len(PostProcessString(row[1])) + 1;
+        OutputStringPointer(fout, int(row[0]), eeprom_offset, worktype,
+                            SubstitutionOffsets(row[1]))
+        eeprom_offset += len(data) + 1;
         fout.write('},\n')
     else:
-      for row in table:
+      for row, data in zip(table, strings):
         fout.write('\t{0x%02X\n' % int(row[0]))
-        OutputStringPointer(fout, int(row[0]), eeprom_offset, argv[1])
-        eeprom_offset += len(PostProcessString(row[1])) + 1;
+        OutputStringPointer(fout, int(row[0]), eeprom_offset, worktype)
+        eeprom_offset += len(data) + 1;
         fout.write('},\n')
 
     fout.write('};\n\n#endif\n#endif')
 
+  if fname_records:
+    WriteRecords(worktype, table, strings, fname_records)
+
+  return eeprom_offset
+
+CONSTEXPR_TYPES = """\
+struct TRDSTMCConstexprEvent {
+  uint16_t code;
+  uint8_t quantifier;
+  uint8_t nature;
+  uint8_t urgency;
+  bool longerLasting;
+  bool silentDuration;
+  bool bidirectional;
+  uint8_t updateClass;
+  uint8_t groupStart;
+  uint8_t substitution;
+  uint8_t groupEnd;
+  bool elideSpace;
+  uint8_t length;
+  uint32_t text;
+};
+
+struct TRDSTMCConstexprSupplementary {
+  uint8_t code;
+  uint8_t length;
+  uint16_t text;
+};
+"""
+
+CONSTEXPR_FUNCTIONS = """\
+/* Binary search, usable in constant expressions: with a known code, the
+ * compiler folds the whole lookup. Returns nullptr for unknown codes.
+ */
+template <typename T, size_t N>
+constexpr const T *ISO14819_2_Find(const T (&table)[N], uint16_t code) {
+  size_t low = 0, high = N;
+
+  while (low < high) {
+    size_t middle = low + (high - low) / 2;
+
+    if (table[middle].code == code)
+      return &table[middle];
+    if (table[middle].code < code)
+      low = middle + 1;
+    else
+      high = middle;
+  }
+
+  return nullptr;
+}
+
+constexpr const TRDSTMCConstexprEvent *findTMCEventConstexpr(uint16_t code) {
+  return ISO14819_2_Find(ISO14819_2_ConstexprEvents, code);
+}
+
+constexpr const TRDSTMCConstexprSupplementary *findTMCSupplementaryConstexpr(
+    uint8_t code) {
+  return ISO14819_2_Find(ISO14819_2_ConstexprSupplementary, code);
+}
+
+/* Event and supplementary information texts, the former still with %s where
+ * the quantifier goes; empty for unknown codes.
+ */
+constexpr std::string_view getTMCEventTextConstexpr(uint16_t code) {
+  const TRDSTMCConstexprEvent *event = findTMCEventConstexpr(code);
+
+  return event ? std::string_view(&ISO14819_2_ConstexprEventText[event->text],
+                                  event->length) : std::string_view();
+}
+
+constexpr std::string_view getTMCSupplementaryTextConstexpr(uint8_t code) {
+  const TRDSTMCConstexprSupplementary *entry =
+      findTMCSupplementaryConstexpr(code);
+
+  return entry ? std::string_view(
+                     &ISO14819_2_ConstexprSupplementaryText[entry->text],
+                     entry->length) : std::string_view();
+}
+
+/* The TMC label carrying the value of a quantifier type: 4 (5 bit) for types
+ * 0 through 5, 5 (8 bit) for types 6 through 12, 0 for invalid types.
+ */
+constexpr uint8_t getTMCQuantifierLabelConstexpr(uint8_t quantifier) {
+  return quantifier <= 5 ? 4 : (quantifier <= 12 ? 5 : 0);
+}
+
+template <typename T, size_t N>
+constexpr bool ISO14819_2_IsSorted(const T (&table)[N]) {
+  for (size_t i = 1; i < N; i++)
+    if (!(table[i - 1].code < table[i].code))
+      return false;
+
+  return true;
+}
+
+constexpr bool ISO14819_2_GroupsValid(void) {
+  for (const TRDSTMCConstexprEvent &event : ISO14819_2_ConstexprEvents) {
+    std::string_view text = getTMCEventTextConstexpr(event.code);
+    size_t found = text.find("%s");
+
+    if (event.substitution == 0xFF) {
+      if (found != std::string_view::npos)
+        return false;
+      continue;
+    }
+    if (found != event.substitution ||
+        !(event.groupStart < event.substitution &&
+          event.substitution < event.groupEnd &&
+          event.groupEnd <= event.length) ||
+        text[event.groupStart] != '(' || text[event.groupEnd - 1] != ')' ||
+        !getTMCQuantifierLabelConstexpr(event.quantifier))
+      return false;
+  }
+
+  return true;
+}
+
+static_assert(ISO14819_2_IsSorted(ISO14819_2_ConstexprEvents),
+              "event codes must be unique and sorted");
+static_assert(ISO14819_2_IsSorted(ISO14819_2_ConstexprSupplementary),
+              "supplementary information codes must be unique and sorted");
+static_assert(ISO14819_2_GroupsValid(),
+              "quantifier groups must match their texts and have a valid "
+              "quantifier type");
+"""
+
+
+def WriteConstexpr(events, supplementary, fname):
+  """Writes the C++17 constexpr version of both tables: the strings go in one
+  pool per table and are referenced by offset, so there is nothing to
+  relocate, and the lookups fold at compile time for known codes."""
+  with open(fname, 'w') as fout:
+    fout.write(
+        '/*\n * ISO 14819-2 header file: C++17 constexpr event list and '
+        'supplementary\n * information entries\n'
+        ' * DO NOT EDIT: automatically generated by gentables.py from CSV files'
+        '\n */\n\n'
+        '#ifndef _ISO14819_2_CONSTEXPR_H_INCLUDED\n'
+        '#define _ISO14819_2_CONSTEXPR_H_INCLUDED\n'
+        '#if __cplusplus >= 201703L\n\n'
+        '#include <stddef.h>\n#include <stdint.h>\n#include <string_view>\n\n')
+    fout.write(CONSTEXPR_TYPES)
+
+    for worktype, table in (('events', events),
+                            ('supplementary', supplementary)):
+      name = 'Event' if worktype == 'events' else 'Supplementary'
+      offsets = []
+      offset = 0
+      fout.write('\ninline constexpr char ISO14819_2_Constexpr%sText[] =\n' %
+                 name)
+      for row in table:
+        data = PostProcessString(row[1]).encode('latin-1')
+        fout.write('\t"%s\\000"\n' % CString(data))
+        offsets.append((offset, len(data)))
+        offset += len(data) + 1
+      fout.write(';\n')
+
+      if worktype == 'events':
+        fout.write('\ninline constexpr TRDSTMCConstexprEvent '
+                   'ISO14819_2_ConstexprEvents[%d] = {\n' % len(table))
+        for row, (offset, length) in zip(table, offsets):
+          start, substitution, end, elide = SubstitutionGroup(
+              PostProcessString(row[1]).encode('latin-1'), 0xFF)
+          fout.write('\t{0x%04X, %d, %d, %d, %s, %s, %s, %s, 0x%02X, 0x%02X, '
+                     '0x%02X, %s, %d, %d},\n' % (
+              int(row[0]), int(row[3]), NATURE_CODES[row[2]],
+              URGENCY_CODES[row[6]],
+              'true' if 'L' in row[4] else 'false',
+              'true' if '(' in row[4] or row[3] == '7' else 'false',
+              'true' if row[5] == '2' else 'false',
+              row[7], start, substitution, end,
+              'true' if elide else 'false', length, offset))
+      else:
+        fout.write('\ninline constexpr TRDSTMCConstexprSupplementary '
+                   'ISO14819_2_ConstexprSupplementary[%d] = {\n' % len(table))
+        for row, (offset, length) in zip(table, offsets):
+          fout.write('\t{0x%02X, %d, %d},\n' % (int(row[0]), length, offset))
+      fout.write('};\n')
+
+    fout.write('\n' + CONSTEXPR_FUNCTIONS)
+    fout.write('\n#endif\n#endif')
+
+
+def ReadTable(fname, encoding='latin-1'):
+  with open(fname, 'r', newline='', encoding=encoding) as fin:
+    return list(csv.reader(fin))
+
+
+def WritePhrases(fname, languages):
+  """Writes a run-time phrase table file, see TMCPhraseTables.h for its
+  layout. languages is a list of (code, events, supplementary, quantifiers)
+  tuples, the first of which also provides the (language independent) event
+  properties."""
+  header = struct.Struct('<8sIIIIIIII')
+  language = struct.Struct('<4sIII')
+  properties = struct.Struct('<BBBBBB')
+  phrase = struct.Struct('<IBBBB')
+  pool = bytearray(b'\x00')
+
+  offset = header.size
+  metadata = bytearray(properties.size * PHRASE_EVENTS)
+  for row in languages[0][1]:
+    properties.pack_into(metadata, int(row[0]) * properties.size,
+                         int(row[3]), NATURE_CODES[row[2]],
+                         URGENCY_CODES[row[6]], EventFlags(row), int(row[7]),
+                         0)
+  metadata_offset = offset
+  offset += len(metadata)
+
+  directory_offset = offset
+  offset += language.size * len(languages)
+  directory = bytearray()
+  tables = bytearray()
+  for code, events, supplementary, quantifiers in languages:
+    directory += language.pack(code.encode('ascii'),
+                               offset + len(tables),
+                               offset + len(tables) +
+                               phrase.size * PHRASE_EVENTS,
+                               offset + len(tables) +
+                               phrase.size * (PHRASE_EVENTS +
+                                              PHRASE_SUPPLEMENTARY)
+                               if quantifiers else 0)
+    for rows, count, grouped in ((events, PHRASE_EVENTS, True),
+                                 (supplementary, PHRASE_SUPPLEMENTARY, False)):
+      table = bytearray(phrase.size * count)
+      for row in rows:
+        text = PostProcessString(row[1]).encode('utf-8')
+        start, substitution, end, elide = (
+            SubstitutionGroup(text, 0xFF) if grouped else
+            (NO_GROUP, NO_GROUP, 0, False))
+        phrase.pack_into(table, int(row[0]) * phrase.size, len(pool), start,
+                         substitution, end, 1 if elide else 0)
+        pool += text + b'\x00'
+      tables += table
+    if quantifiers:
+      table = bytearray(4 * len(QUANTIFIER_TEXTS))
+      for row in quantifiers:
+        if row[0] not in QUANTIFIER_TEXTS:
+          print('Invalid quantifier text name "%s"!' % row[0])
+          exit(1)
+        struct.pack_into('<I', table, 4 * QUANTIFIER_TEXTS.index(row[0]),
+                         len(pool))
+        pool += row[1].encode('utf-8') + b'\x00'
+      tables += table
+  strings_offset = offset + len(tables)
+  size = strings_offset + len(pool)
+
+  with open(fname, 'wb') as fout:
+    fout.write(header.pack(PHRASE_MAGIC, PHRASE_VERSION, size, len(languages),
+                           PHRASE_EVENTS, PHRASE_SUPPLEMENTARY, metadata_offset,
+                           directory_offset, strings_offset))
+    fout.write(metadata)
+    fout.write(directory)
+    fout.write(tables)
+    fout.write(pool)
+
+
+def ReadPhrases(argument):
+  """Parses a LANGUAGE=EVENTS.csv[,SUPPLEMENTARY.csv[,QUANTIFIERS.csv]]
+  argument."""
+  code, _, files = argument.partition('=')
+  files = files.split(',')
+  if not (0 < len(code) < 4 and files[0]):
+    print('Invalid phrase table language "%s"!' % argument)
+    exit(1)
+  return (code, ReadTable(files[0], 'utf-8-sig'),
+          ReadTable(files[1], 'utf-8-sig') if len(files) > 1 else [],
+          ReadTable(files[2], 'utf-8-sig') if len(files) > 2 else [])
+
+
+def main(argv):
+  if len(argv) >= 4 and argv[1] == 'phrases':
+    WritePhrases(argv[2], [ReadPhrases(a) for a in argv[3:]])
+    return
+
+  if len(argv) == 4 and argv[1] == 'constexpr':
+    WriteConstexpr(ReadTable(argv[2]), ReadTable(argv[3]),
+                   'iso14819-2-constexpr.h')
+    return
+
+  if len(argv) == 4 and argv[1] == 'compressed':
+    tables = {'events': ReadTable(argv[2]), 'supplementary': ReadTable(argv[3])}
+    pairs = TrainDictionary([PostProcessString(row[1])
+                             for worktype in WORK_TYPES
+                             for row in tables[worktype]])
+    WriteDictionary(pairs)
+    for worktype in WORK_TYPES:
+      plain = sum(len(PostProcessString(row[1])) + 1
+                  for row in tables[worktype])
+      packed = GenerateTable(
+          worktype, tables[worktype],
+          'iso14819-2-%s-compressed.h' % worktype,
+          'iso14819-2-%s-compressed.eeprom' % worktype,
+          lambda text: Compress(pairs, text))
+      print('%s: %d bytes of strings compressed to %d plus %d of dictionary' %
+            (worktype, plain, packed, 2 * len(pairs)))
+    return
+
+  if len(argv) != 3:
+    print ('Invalid calling convention, need exactly two arguments but got '
+           '%d!' % (len(argv) - 1))
+    exit(1)
+  if argv[1] not in WORK_TYPES:
+    print ('Invalid calling convention, argv[1] must be one of %s but got '
+           '"%s"!' % (WORK_TYPES + ['compressed', 'constexpr', 'phrases'],
+                        argv[1]))
+    exit(1)
+
+  GenerateTable(argv[1], ReadTable(argv[2]),
+                'iso14819-2-%s.h' % argv[1],
+                'iso14819-2-%s.eeprom' % argv[1],
+                fname_records='iso14819-2-%s.records' % argv[1])
+
 
 if __name__ == '__main__':
   main(sys.argv)
\ No newline at end of file
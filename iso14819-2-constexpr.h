@@ -0,0 +1,3716 @@
+/*
+ * ISO 14819-2 header file: C++17 constexpr event list and supplementary
+ * information entries
+ * DO NOT EDIT: automatically generated by gentables.py from CSV files
+ */
+
+#ifndef _ISO14819_2_CONSTEXPR_H_INCLUDED
+#define _ISO14819_2_CONSTEXPR_H_INCLUDED
+#if __cplusplus >= 201703L
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string_view>
+
+struct TRDSTMCConstexprEvent {
+  uint16_t code;
+  uint8_t quantifier;
+  uint8_t nature;
+  uint8_t urgency;
+  bool longerLasting;
+  bool silentDuration;
+  bool bidirectional;
+  uint8_t updateClass;
+  uint8_t groupStart;
+  uint8_t substitution;
+  uint8_t groupEnd;
+  bool elideSpace;
+  uint8_t length;
+  uint32_t text;
+};
+
+struct TRDSTMCConstexprSupplementary {
+  uint8_t code;
+  uint8_t length;
+  uint16_t text;
+};
+
+inline constexpr char ISO14819_2_ConstexprEventText[] =
+	"traffic problem\000"
+	"queuing traffic (with average speeds %s). Danger of stationary traffic\000"
+	"overheight warning system triggered\000"
+	"(%s) accident(s), traffic being directed around accident area\000"
+	"closed, rescue and recovery work in progress\000"
+	"service area overcrowded, drive to another service area\000"
+	"service area, fuel station closed\000"
+	"service area, restaurant closed\000"
+	"bridge closed\000"
+	"tunnel closed\000"
+	"bridge blocked\000"
+	"tunnel blocked\000"
+	"road closed intermittently\000"
+	"fuel station reopened\000"
+	"restaurant reopened\000"
+	"reopening of bridge expected (%s)\000"
+	"smog alert ended\000"
+	"(%s) overtaking lane(s) closed\000"
+	"(%s) overtaking lane(s) blocked\000"
+	"roadworks, (%s) overtaking lane(s) closed\000"
+	"(%s sets of) roadworks on the hard shoulder\000"
+	"(%s sets of) roadworks in the emergency lane\000"
+	"traffic problem expected\000"
+	"traffic congestion expected\000"
+	"normal traffic expected\000"
+	"(%s) object(s) on roadway\000"
+	"(%s) burst pipe(s)\000"
+	"(%s) object(s) on the road. Danger\000"
+	"burst pipe. Danger\000"
+	"traffic congestion, average speed of 10 km/h\000"
+	"traffic congestion, average speed of 20 km/h\000"
+	"traffic congestion, average speed of 30 km/h\000"
+	"traffic congestion, average speed of 40 km/h\000"
+	"traffic congestion, average speed of 50 km/h\000"
+	"traffic congestion, average speed of 60 km/h\000"
+	"traffic congestion, average speed of 70 km/h\000"
+	"heavy traffic has to be expected\000"
+	"traffic congestion has to be expected\000"
+	"(%s sets of) roadworks. Heavy traffic has to be expected\000"
+	"closed ahead. Heavy traffic expected\000"
+	"major event. Heavy traffic has to be expected\000"
+	"sports meeting. Heavy traffic has to be expected\000"
+	"fair. Heavy traffic has to be expected\000"
+	"evacuation. Heavy traffic has to be expected\000"
+	"traffic congestion forecast withdrawn\000"
+	"message cancelled\000"
+	"delays (%s) for cars\000"
+	"stationary traffic\000"
+	"stationary traffic for 1 km\000"
+	"stationary traffic for 2 km\000"
+	"stationary traffic for 4 km\000"
+	"stationary traffic for 6 km\000"
+	"stationary traffic for 10 km\000"
+	"stationary traffic expected\000"
+	"queuing traffic (with average speeds %s)\000"
+	"queuing traffic for 1 km (with average speeds %s)\000"
+	"queuing traffic for 2 km (with average speeds %s)\000"
+	"queuing traffic for 4 km (with average speeds %s)\000"
+	"queuing traffic for 6 km (with average speeds %s)\000"
+	"queuing traffic for 10 km (with average speeds %s)\000"
+	"queuing traffic expected\000"
+	"slow traffic (with average speeds %s)\000"
+	"slow traffic for 1 km (with average speeds %s)\000"
+	"slow traffic for 2 km (with average speeds %s)\000"
+	"slow traffic for 4 km (with average speeds %s)\000"
+	"slow traffic for 6 km (with average speeds %s)\000"
+	"slow traffic for 10 km (with average speeds %s)\000"
+	"slow traffic expected\000"
+	"heavy traffic (with average speeds %s)\000"
+	"heavy traffic expected\000"
+	"traffic flowing freely (with average speeds %s)\000"
+	"traffic building up (with average speeds %s)\000"
+	"no problems to report\000"
+	"traffic congestion cleared\000"
+	"message cancelled\000"
+	"stationary traffic for 3 km\000"
+	"danger of stationary traffic\000"
+	"queuing traffic for 3 km (with average speeds %s)\000"
+	"danger of queuing traffic (with average speeds %s)\000"
+	"long queues (with average speeds %s)\000"
+	"slow traffic for 3 km (with average speeds %s)\000"
+	"traffic easing\000"
+	"traffic congestion (with average speeds %s)\000"
+	"traffic lighter than normal (with average speeds %s)\000"
+	"queuing traffic (with average speeds %s). Approach with care\000"
+	"queuing traffic around a bend in the road\000"
+	"queuing traffic over the crest of a hill\000"
+	"all accidents cleared, no problems to report\000"
+	"traffic heavier than normal (with average speeds %s)\000"
+	"traffic very much heavier than normal (with average speeds %s)\000"
+	"multi vehicle pile up. Delays (%s)\000"
+	"(%s) accident(s)\000"
+	"(%s) serious accident(s)\000"
+	"multi-vehicle accident (involving %s vehicles)\000"
+	"accident involving (a/%s) heavy lorr(y/ies)\000"
+	"(%s) accident(s) involving hazardous materials\000"
+	"(%s) fuel spillage accident(s)\000"
+	"(%s) chemical spillage accident(s)\000"
+	"vehicles slowing to look at (%s) accident(s)\000"
+	"(%s) accident(s) in the opposing lanes\000"
+	"(%s) shed load(s)\000"
+	"(%s) broken down vehicle(s)\000"
+	"(%s) broken down heavy lorr(y/ies)\000"
+	"(%s) vehicle fire(s)\000"
+	"(%s) incident(s)\000"
+	"(%s) accident(s). Stationary traffic\000"
+	"(%s) accident(s). Stationary traffic for 1 km\000"
+	"(%s) accident(s). Stationary traffic for 2 km\000"
+	"(%s) accident(s). Stationary traffic for 4 km\000"
+	"(%s) accident(s). Stationary traffic for 6 km\000"
+	"(%s) accident(s). Stationary traffic for 10 km\000"
+	"(%s) accident(s). Danger of stationary traffic\000"
+	"(%s) accident(s). Queuing traffic\000"
+	"(%s) accident(s). Queuing traffic for 1 km\000"
+	"(%s) accident(s). Queuing traffic for 2 km\000"
+	"(%s) accident(s). Queuing traffic for 4 km\000"
+	"(%s) accident(s). Queuing traffic for 6 km\000"
+	"(%s) accident(s). Queuing traffic for 10 km\000"
+	"(%s) accident(s). Danger of queuing traffic\000"
+	"(%s) accident(s). Slow traffic\000"
+	"(%s) accident(s). Slow traffic for 1 km\000"
+	"(%s) accident(s). Slow traffic for 2 km\000"
+	"(%s) accident(s). Slow traffic for 4 km\000"
+	"(%s) accident(s). Slow traffic for 6 km\000"
+	"(%s) accident(s). Slow traffic for 10 km\000"
+	"(%s) accident(s). Slow traffic expected\000"
+	"(%s) accident(s). Heavy traffic\000"
+	"(%s) accident(s). Heavy traffic expected\000"
+	"(%s) accident(s). Traffic flowing freely\000"
+	"(%s) accident(s). Traffic building up\000"
+	"road closed due to (%s) accident(s)\000"
+	"(%s) accident(s). Right lane blocked\000"
+	"(%s) accident(s). Centre lane blocked\000"
+	"(%s) accident(s). Left lane blocked\000"
+	"(%s) accident(s). Hard shoulder blocked\000"
+	"(%s) accident(s). Two lanes blocked\000"
+	"(%s) accident(s). Three lanes blocked\000"
+	"accident. Delays (%s)\000"
+	"accident. Delays (%s) expected\000"
+	"accident. Long delays (%s)\000"
+	"vehicles slowing to look at (%s) accident(s). Stationary traffic\000"
+	"vehicles slowing to look at (%s) accident(s). Stationary traffic for 1 km\000"
+	"vehicles slowing to look at (%s) accident(s). Stationary traffic for 2 km\000"
+	"vehicles slowing to look at (%s) accident(s). Stationary traffic for 4 km\000"
+	"vehicles slowing to look at (%s) accident(s). Stationary traffic for 6 km\000"
+	"vehicles slowing to look at (%s) accident(s). Stationary traffic for 10 km\000"
+	"vehicles slowing to look at (%s) accident(s). Danger of stationary traffic\000"
+	"vehicles slowing to look at (%s) accident(s). Queuing traffic\000"
+	"vehicles slowing to look at (%s) accident(s). Queuing traffic for 1 km\000"
+	"vehicles slowing to look at (%s) accident(s). Queuing traffic for 2 km\000"
+	"vehicles slowing to look at (%s) accident(s). Queuing traffic for 4 km\000"
+	"vehicles slowing to look at (%s) accident(s). Queuing traffic for 6 km\000"
+	"vehicles slowing to look at (%s) accident(s). Queuing traffic for 10 km\000"
+	"vehicles slowing to look at (%s) accident(s). Danger of queuing traffic\000"
+	"vehicles slowing to look at (%s) accident(s). Slow traffic\000"
+	"vehicles slowing to look at (%s) accident(s). Slow traffic for 1 km\000"
+	"vehicles slowing to look at (%s) accident(s). Slow traffic for 2 km\000"
+	"vehicles slowing to look at (%s) accident(s). Slow traffic for 4 km\000"
+	"vehicles slowing to look at (%s) accident(s). Slow traffic for 6 km\000"
+	"vehicles slowing to look at (%s) accident(s). Slow traffic for 10 km\000"
+	"vehicles slowing to look at (%s) accident(s). Slow traffic expected\000"
+	"vehicles slowing to look at (%s) accident(s). Heavy traffic\000"
+	"vehicles slowing to look at (%s) accident(s). Heavy traffic expected\000"
+	"vehicles slowing to look at (%s) accident(s). Traffic building up\000"
+	"vehicles slowing to look at accident. Delays (%s)\000"
+	"vehicles slowing to look at accident. Delays (%s) expected\000"
+	"vehicles slowing to look at accident. Long delays (%s)\000"
+	"(%s) shed load(s). Stationary traffic\000"
+	"(%s) shed load(s). Stationary traffic for 1 km\000"
+	"(%s) shed load(s). Stationary traffic for 2 km\000"
+	"(%s) shed load(s). Stationary traffic for 4 km\000"
+	"(%s) shed load(s). Stationary traffic for 6 km\000"
+	"(%s) shed load(s). Stationary traffic for 10 km\000"
+	"(%s) shed load(s). Danger of stationary traffic\000"
+	"(%s) shed load(s). Queuing traffic\000"
+	"(%s) shed load(s). Queuing traffic for 1 km\000"
+	"(%s) shed load(s). Queuing traffic for 2 km\000"
+	"(%s) shed load(s). Queuing traffic for 4 km\000"
+	"(%s) shed load(s). Queuing traffic for 6 km\000"
+	"(%s) shed load(s). Queuing traffic for 10 km\000"
+	"(%s) shed load(s). Danger of queuing traffic\000"
+	"(%s) shed load(s). Slow traffic\000"
+	"(%s) shed load(s). Slow traffic for 1 km\000"
+	"(%s) shed load(s). Slow traffic for 2 km\000"
+	"(%s) shed load(s). Slow traffic for 4 km\000"
+	"(%s) shed load(s). Slow traffic for 6 km\000"
+	"(%s) shed load(s). Slow traffic for 10 km\000"
+	"(%s) shed load(s). Slow traffic expected\000"
+	"(%s) shed load(s). Heavy traffic\000"
+	"(%s) shed load(s). Heavy traffic expected\000"
+	"(%s) shed load(s). Traffic flowing freely\000"
+	"(%s) shed load(s). Traffic building up\000"
+	"blocked by (%s) shed load(s)\000"
+	"(%s) shed load(s). Right lane blocked\000"
+	"(%s) shed load(s). Centre lane blocked\000"
+	"(%s) shed load(s). Left lane blocked\000"
+	"(%s) shed load(s). Hard shoulder blocked\000"
+	"(%s) shed load(s). Two lanes blocked\000"
+	"(%s) shed load(s). Three lanes blocked\000"
+	"shed load. Delays (%s)\000"
+	"shed load. Delays (%s) expected\000"
+	"shed load. Long delays (%s)\000"
+	"(%s) broken down vehicle(s). Stationary traffic\000"
+	"(%s) broken down vehicle(s). Danger of stationary traffic\000"
+	"(%s) broken down vehicle(s). Queuing traffic\000"
+	"(%s) broken down vehicle(s). Danger of queuing traffic\000"
+	"(%s) broken down vehicle(s). Slow traffic\000"
+	"(%s) broken down vehicle(s). Slow traffic expected\000"
+	"(%s) broken down vehicle(s). Heavy traffic\000"
+	"(%s) broken down vehicle(s). Heavy traffic expected\000"
+	"(%s) broken down vehicle(s). Traffic flowing freely\000"
+	"(%s) broken down vehicle(s).Traffic building up\000"
+	"blocked by (%s) broken down vehicle(s).\000"
+	"(%s) broken down vehicle(s). Right lane blocked\000"
+	"(%s) broken down vehicle(s). Centre lane blocked\000"
+	"(%s) broken down vehicle(s). Left lane blocked\000"
+	"(%s) broken down vehicle(s). Hard shoulder blocked\000"
+	"(%s) broken down vehicle(s). Two lanes blocked\000"
+	"(%s) broken down vehicle(s). Three lanes blocked\000"
+	"broken down vehicle. Delays (%s)\000"
+	"broken down vehicle. Delays (%s) expected\000"
+	"broken down vehicle. Long delays (%s)\000"
+	"accident cleared\000"
+	"message cancelled\000"
+	"accident involving (a/%s) bus(es)\000"
+	"(%s) oil spillage accident(s)\000"
+	"(%s) overturned vehicle(s)\000"
+	"(%s) overturned heavy lorr(y/ies)\000"
+	"(%s) jackknifed trailer(s)\000"
+	"(%s) jackknifed caravan(s)\000"
+	"(%s) jackknifed articulated lorr(y/ies)\000"
+	"(%s) vehicle(s) spun around\000"
+	"(%s) earlier accident(s)\000"
+	"accident investigation work\000"
+	"(%s) secondary accident(s)\000"
+	"(%s) broken down bus(es)\000"
+	"(%s) overheight vehicle(s)\000"
+	"(%s) accident(s). Stationary traffic for 3 km\000"
+	"(%s) accident(s). Queuing traffic for 3 km\000"
+	"(%s) accident(s). Slow traffic for 3 km\000"
+	"(%s) accident(s) in roadworks area\000"
+	"vehicles slowing to look at (%s) accident(s). Stationary traffic for 3 km\000"
+	"vehicles slowing to look at (%s) accident(s). Queuing traffic for 3 km\000"
+	"vehicles slowing to look at (%s) accident(s). Slow traffic for 3 km\000"
+	"vehicles slowing to look at (%s) accident(s). Danger\000"
+	"(%s) shed load(s). Stationary traffic for 3 km\000"
+	"(%s) shed load(s). Queuing traffic for 3 km\000"
+	"(%s) shed load(s). Slow traffic for 3 km\000"
+	"(%s) shed load(s). Danger\000"
+	"(%s) overturned vehicle(s). Stationary traffic\000"
+	"(%s) overturned vehicle(s). Danger of stationary traffic\000"
+	"(%s) overturned vehicle(s). Queuing traffic\000"
+	"(%s) overturned vehicle(s). Danger of queuing traffic\000"
+	"(%s) overturned vehicle(s). Slow traffic\000"
+	"(%s) overturned vehicle(s). Slow traffic expected\000"
+	"(%s) overturned vehicle(s). Heavy traffic\000"
+	"(%s) overturned vehicle(s). Heavy traffic expected\000"
+	"(%s) overturned vehicle(s). Traffic building up\000"
+	"blocked by (%s) overturned vehicle(s)\000"
+	"(%s) overturned vehicle(s). Right lane blocked\000"
+	"(%s) overturned vehicle(s). Centre lane blocked\000"
+	"(%s) overturned vehicle(s). Left lane blocked\000"
+	"(%s) overturned vehicle(s). Two lanes blocked\000"
+	"(%s) overturned vehicle(s). Three lanes blocked\000"
+	"overturned vehicle. Delays (%s)\000"
+	"overturned vehicle. Delays (%s) expected\000"
+	"overturned vehicle. Long delays (%s)\000"
+	"(%s) overturned vehicle(s). Danger\000"
+	"Stationary traffic due to (%s) earlier accident(s)\000"
+	"Danger of stationary traffic due to (%s) earlier accident(s)\000"
+	"Queuing traffic due to (%s) earlier accident(s)\000"
+	"Danger of queuing traffic due to (%s) earlier accident(s)\000"
+	"Slow traffic due to (%s) earlier accident(s)\000"
+	"Heavy traffic due to (%s) earlier accident(s)\000"
+	"Traffic building up due to (%s) earlier accident(s)\000"
+	"Delays (%s) due to earlier accident\000"
+	"Long delays (%s) due to earlier accident\000"
+	"accident investigation work. Danger\000"
+	"(%s) secondary accident(s). Danger\000"
+	"(%s) broken down vehicle(s). Danger\000"
+	"(%s) broken down heavy lorr(y/ies). Danger\000"
+	"road cleared\000"
+	"incident cleared\000"
+	"rescue and recovery work in progress\000"
+	"message cancelled\000"
+	"closed\000"
+	"blocked\000"
+	"closed for heavy vehicles (over %s)\000"
+	"no through traffic for heavy lorries (over %s)\000"
+	"no through traffic\000"
+	"(%s th) entry slip road closed\000"
+	"(%s th) exit slip road closed\000"
+	"slip roads closed\000"
+	"slip road restrictions\000"
+	"closed ahead. Stationary traffic\000"
+	"closed ahead. Stationary traffic for 1 km\000"
+	"closed ahead. Stationary traffic for 2 km\000"
+	"closed ahead. Stationary traffic for 4 km\000"
+	"closed ahead. Stationary traffic for 6 km\000"
+	"closed ahead. Stationary traffic for 10 km\000"
+	"closed ahead. Danger of stationary traffic\000"
+	"closed ahead. Queuing traffic\000"
+	"closed ahead. Queuing traffic for 1 km\000"
+	"closed ahead. Queuing traffic for 2 km\000"
+	"closed ahead. Queuing traffic for 4 km\000"
+	"closed ahead. Queuing traffic for 6 km\000"
+	"closed ahead. Queuing traffic for 10 km\000"
+	"closed ahead. Danger of queuing traffic\000"
+	"closed ahead. Slow traffic\000"
+	"closed ahead. Slow traffic for 1 km\000"
+	"closed ahead. Slow traffic for 2 km\000"
+	"closed ahead. Slow traffic for 4 km\000"
+	"closed ahead. Slow traffic for 6 km\000"
+	"closed ahead. Slow traffic for 10 km\000"
+	"closed ahead. Slow traffic expected\000"
+	"closed ahead. Heavy traffic\000"
+	"closed ahead. Heavy traffic expected\000"
+	"closed ahead. Traffic flowing freely\000"
+	"closed ahead. Traffic building up\000"
+	"closed ahead. Delays (%s)\000"
+	"closed ahead. Delays (%s) expected\000"
+	"closed ahead. Long delays (%s)\000"
+	"blocked ahead. Stationary traffic\000"
+	"blocked ahead. Stationary traffic for 1 km\000"
+	"blocked ahead. Stationary traffic for 2 km\000"
+	"blocked ahead. Stationary traffic for 4 km\000"
+	"blocked ahead. Stationary traffic for 6 km\000"
+	"blocked ahead. Stationary traffic for 10 km\000"
+	"blocked ahead. Danger of stationary traffic\000"
+	"blocked ahead. Queuing traffic\000"
+	"blocked ahead. Queuing traffic for 1 km\000"
+	"blocked ahead. Queuing traffic for 2 km\000"
+	"blocked ahead. Queuing traffic for 4 km\000"
+	"blocked ahead. Queuing traffic for 6 km\000"
+	"blocked ahead. Queuing traffic for 10 km\000"
+	"blocked ahead. Danger of queuing traffic\000"
+	"blocked ahead. Slow traffic\000"
+	"blocked ahead. Slow traffic for 1 km\000"
+	"blocked ahead. Slow traffic for 2 km\000"
+	"blocked ahead. Slow traffic for 4 km\000"
+	"blocked ahead. Slow traffic for 6 km\000"
+	"blocked ahead. Slow traffic for 10 km\000"
+	"blocked ahead. Slow traffic expected\000"
+	"blocked ahead. Heavy traffic\000"
+	"blocked ahead. Heavy traffic expected\000"
+	"blocked ahead. Traffic flowing freely\000"
+	"blocked ahead. Traffic building up\000"
+	"blocked ahead. Delays (%s)\000"
+	"blocked ahead. Delays (%s) expected\000"
+	"blocked ahead. Long delays (%s)\000"
+	"slip roads reopened\000"
+	"reopened\000"
+	"message cancelled\000"
+	"closed ahead\000"
+	"blocked ahead\000"
+	"(%s) entry slip road(s) closed\000"
+	"(%s th) entry slip road blocked\000"
+	"entry blocked\000"
+	"(%s) exit slip road(s) closed\000"
+	"(%s th) exit slip road blocked\000"
+	"exit blocked\000"
+	"slip roads blocked\000"
+	"connecting carriageway closed\000"
+	"parallel carriageway closed\000"
+	"right-hand parallel carriageway closed\000"
+	"left-hand parallel carriageway closed\000"
+	"express lanes closed\000"
+	"through traffic lanes closed\000"
+	"local lanes closed\000"
+	"connecting carriageway blocked\000"
+	"parallel carriageway blocked\000"
+	"right-hand parallel carriageway blocked\000"
+	"left-hand parallel carriageway blocked\000"
+	"express lanes blocked\000"
+	"through traffic lanes blocked\000"
+	"local lanes blocked\000"
+	"no motor vehicles\000"
+	"restrictions\000"
+	"closed for heavy lorries (over %s)\000"
+	"closed ahead. Stationary traffic for 3 km\000"
+	"closed ahead. Queuing traffic for 3 km\000"
+	"closed ahead. Slow traffic for 3 km\000"
+	"blocked ahead. Stationary traffic for 3 km\000"
+	"blocked ahead. Queuing traffic for 3 km\000"
+	"(%s) lane(s) closed\000"
+	"(%s) right lane(s) closed\000"
+	"(%s) centre lane(s) closed\000"
+	"(%s) left lane(s) closed\000"
+	"hard shoulder closed\000"
+	"two lanes closed\000"
+	"three lanes closed\000"
+	"(%s) right lane(s) blocked\000"
+	"(%s) centre lane(s) blocked\000"
+	"(%s) left lane(s) blocked\000"
+	"hard shoulder blocked\000"
+	"two lanes blocked\000"
+	"three lanes blocked\000"
+	"single alternate line traffic\000"
+	"carriageway reduced (from %s lanes) to one lane\000"
+	"carriageway reduced (from %s lanes) to two lanes\000"
+	"carriageway reduced (from %s lanes) to three lanes\000"
+	"contraflow\000"
+	"narrow lanes\000"
+	"contraflow with narrow lanes\000"
+	"(%s) lane(s) blocked\000"
+	"(%s) lanes closed. Stationary traffic\000"
+	"(%s) lanes closed. Stationary traffic for 1 km\000"
+	"(%s) lanes closed. Stationary traffic for 2 km\000"
+	"(%s) lanes closed. Stationary traffic for 4 km\000"
+	"(%s) lanes closed. Stationary traffic for 6 km\000"
+	"(%s) lanes closed. Stationary traffic for 10 km\000"
+	"(%s) lanes closed. Danger of stationary traffic\000"
+	"(%s) lanes closed. Queuing traffic\000"
+	"(%s) lanes closed. Queuing traffic for 1 km\000"
+	"(%s) lanes closed. Queuing traffic for 2 km\000"
+	"(%s) lanes closed. Queuing traffic for 4 km\000"
+	"(%s) lanes closed. Queuing traffic for 6 km\000"
+	"(%s) lanes closed. Queuing traffic for 10 km\000"
+	"(%s) lanes closed. Danger of queuing traffic\000"
+	"(%s) lanes closed. Slow traffic\000"
+	"(%s) lanes closed. Slow traffic for 1 km\000"
+	"(%s) lanes closed. Slow traffic for 2 km\000"
+	"(%s) lanes closed. Slow traffic for 4 km\000"
+	"(%s) lanes closed. Slow traffic for 6 km\000"
+	"(%s) lanes closed. Slow traffic for 10 km\000"
+	"(%s) lanes closed. Slow traffic expected\000"
+	"(%s) lanes closed. Heavy traffic\000"
+	"(%s) lanes closed. Heavy traffic expected\000"
+	"(%s)lanes closed. Traffic flowing freely\000"
+	"(%s)lanes closed. Traffic building up\000"
+	"carriageway reduced (from %s lanes) to one lane. Stationary traffic\000"
+	"carriageway reduced (from %s lanes) to one lane. Danger of stationary traffic\000"
+	"carriageway reduced (from %s lanes) to one lane. Queuing traffic\000"
+	"carriageway reduced (from %s lanes) to one lane. Danger of queuing traffic\000"
+	"carriageway reduced (from %s lanes) to one lane. Slow traffic\000"
+	"carriageway reduced (from %s lanes) to one lane. Slow traffic expected\000"
+	"carriageway reduced (from %s lanes) to one lane. Heavy traffic\000"
+	"carriageway reduced (from %s lanes) to one lane. Heavy traffic expected\000"
+	"carriageway reduced (from %s lanes) to one lane. Traffic flowing freely\000"
+	"carriageway reduced (from %s lanes) to one lane. Traffic building up\000"
+	"carriageway reduced (from %s lanes) to two lanes. Stationary traffic\000"
+	"carriageway reduced (from %s lanes) to two lanes. Danger of stationary traffic\000"
+	"carriageway reduced (from %s lanes) to two lanes. Queuing traffic\000"
+	"carriageway reduced (from %s lanes) to two lanes. Danger of queuing traffic\000"
+	"carriageway reduced (from %s lanes) to two lanes. Slow traffic\000"
+	"carriageway reduced (from %s lanes) to two lanes. Slow traffic expected\000"
+	"carriageway reduced (from %s lanes) to two lanes. Heavy traffic\000"
+	"carriageway reduced (from %s lanes) to two lanes. Heavy traffic expected\000"
+	"carriageway reduced (from %s lanes) to two lanes. Traffic flowing freely\000"
+	"carriageway reduced (from %s lanes) to two lanes. Traffic building up\000"
+	"carriageway reduced (from %s lanes) to three lanes. Stationary traffic\000"
+	"carriageway reduced (from %s lanes) to three lanes. Danger of stationary traffic\000"
+	"carriageway reduced (from %s lanes) to three lanes. Queuing traffic\000"
+	"carriageway reduced (from %s lanes) to three lanes. Danger of queuing traffic\000"
+	"carriageway reduced (from %s lanes) to three lanes. Slow traffic\000"
+	"carriageway reduced (from %s lanes) to three lanes. Slow traffic expected\000"
+	"carriageway reduced (from %s lanes) to three lanes. Heavy traffic\000"
+	"carriageway reduced (from %s lanes) to three lanes. Heavy traffic expected\000"
+	"carriageway reduced (from %s lanes) to three lanes. Traffic flowing freely\000"
+	"carriageway reduced (from %s lanes) to three lanes. Traffic building up\000"
+	"contraflow. Stationary traffic\000"
+	"contraflow. Stationary traffic for 1 km\000"
+	"contraflow. Stationary traffic for 2 km\000"
+	"contraflow. Stationary traffic for 4 km\000"
+	"contraflow. Stationary traffic for 6 km\000"
+	"contraflow. Stationary traffic for 10 km\000"
+	"contraflow. Danger of stationary traffic\000"
+	"contraflow. Queuing traffic\000"
+	"contraflow. Queuing traffic for 1 km\000"
+	"contraflow. Queuing traffic for 2 km\000"
+	"contraflow. Queuing traffic for 4 km\000"
+	"contraflow. Queuing traffic for 6 km\000"
+	"contraflow. Queuing traffic for 10 km\000"
+	"contraflow. Danger of queuing traffic\000"
+	"contraflow. Slow traffic\000"
+	"contraflow. Slow traffic for 1 km\000"
+	"contraflow. Slow traffic for 2 km\000"
+	"contraflow. Slow traffic for 4 km\000"
+	"contraflow. Slow traffic for 6 km\000"
+	"contraflow. Slow traffic for 10 km\000"
+	"contraflow. Slow traffic expected\000"
+	"contraflow. Heavy traffic\000"
+	"contraflow. Heavy traffic expected\000"
+	"contraflow. Traffic flowing freely\000"
+	"contraflow. Traffic building up\000"
+	"contraflow. Carriageway reduced (from %s lanes) to one lane\000"
+	"contraflow. Carriageway reduced (from %s lanes) to two lanes\000"
+	"contraflow. Carriageway reduced (from %s lanes) to three lanes\000"
+	"narrow lanes. Stationary traffic\000"
+	"narrow lanes. Danger of stationary traffic\000"
+	"narrow lanes. Queuing traffic\000"
+	"narrow lanes. Danger of queuing traffic\000"
+	"narrow lanes. Slow traffic\000"
+	"narrow lanes. Slow traffic expected\000"
+	"narrow lanes. Heavy traffic\000"
+	"narrow lanes. Heavy traffic expected\000"
+	"narrow lanes. Traffic flowing freely\000"
+	"narrow lanes. Traffic building up\000"
+	"contraflow with narrow lanes. Stationary traffic\000"
+	"contraflow with narrow lanes. Stationary traffic. Danger of stationary traffic\000"
+	"contraflow with narrow lanes. Queuing traffic\000"
+	"contraflow with narrow lanes. Danger of queuing traffic\000"
+	"contraflow with narrow lanes. Slow traffic\000"
+	"contraflow with narrow lanes. Slow traffic expected\000"
+	"contraflow with narrow lanes. Heavy traffic\000"
+	"contraflow with narrow lanes. Heavy traffic expected\000"
+	"contraflow with narrow lanes. Traffic flowing freely\000"
+	"contraflow with narrow lanes. Traffic building up\000"
+	"lane closures removed\000"
+	"message cancelled\000"
+	"blocked ahead. Slow traffic for 3 km\000"
+	"no motor vehicles without catalytic converters\000"
+	"no motor vehicles with even-numbered registration plates\000"
+	"no motor vehicles with odd-numbered registration plates\000"
+	"open\000"
+	"road cleared\000"
+	"entry reopened\000"
+	"exit reopened\000"
+	"all carriageways reopened\000"
+	"motor vehicle restrictions lifted\000"
+	"traffic restrictions lifted\000"
+	"emergency lane closed\000"
+	"turning lane closed\000"
+	"crawler lane closed\000"
+	"slow vehicle lane closed\000"
+	"one lane closed\000"
+	"emergency lane blocked\000"
+	"turning lane blocked\000"
+	"crawler lane blocked\000"
+	"slow vehicle lane blocked\000"
+	"one lane blocked\000"
+	"(%s person) carpool lane in operation\000"
+	"(%s person) carpool lane closed\000"
+	"(%s person) carpool lane blocked\000"
+	"carpool restrictions changed (to %s persons per vehicle)\000"
+	"(%s) lanes closed. Stationary traffic for 3 km\000"
+	"(%s) lanes closed. Queuing traffic for 3 km\000"
+	"(%s) lanes closed. Slow traffic for 3 km\000"
+	"contraflow. Stationary traffic for 3 km\000"
+	"contraflow. Queuing traffic for 3 km\000"
+	"contraflow. Slow traffic for 3 km\000"
+	"lane blockages cleared\000"
+	"contraflow removed\000"
+	"(%s person) carpool restrictions lifted\000"
+	"lane restrictions lifted\000"
+	"use of hard shoulder allowed\000"
+	"normal lane regulations restored\000"
+	"all carriageways cleared\000"
+	"carriageway closed\000"
+	"both directions closed\000"
+	"intermittent short term closures\000"
+	"bus lane available for carpools (with at least %s occupants)\000"
+	"message cancelled\000"
+	"message cancelled\000"
+	"(%s) salting vehicles\000"
+	"bus lane blocked\000"
+	"heavy vehicle lane closed\000"
+	"heavy vehicle lane blocked\000"
+	"reopened for through traffic\000"
+	"(%s) snowploughs\000"
+	"(%s sets of) roadworks\000"
+	"(%s sets of) major roadworks\000"
+	"(%s sets of) maintenance work\000"
+	"(%s sections of) resurfacing work\000"
+	"(%s sets of) central reservation work\000"
+	"(%s sets of) road marking work\000"
+	"bridge maintenance work (at %s bridges)\000"
+	"(%s sets of) temporary traffic lights\000"
+	"(%s sections of) blasting work\000"
+	"(%s sets of) roadworks. Stationary traffic\000"
+	"(%s sets of) roadworks. Stationary traffic for 1 km\000"
+	"(%s sets of) roadworks. Stationary traffic for 2 km\000"
+	"(%s sets of) roadworks. Stationary traffic for 4 km\000"
+	"(%s sets of) roadworks. Stationary traffic for 6 km\000"
+	"(%s sets of) roadworks. Stationary traffic for 10 km\000"
+	"(%s sets of) roadworks. Danger of stationary traffic\000"
+	"(%s sets of) roadworks. Queuing traffic\000"
+	"(%s sets of) roadworks. Queuing traffic for 1 km\000"
+	"(%s sets of) roadworks. Queuing traffic for 2 km\000"
+	"(%s sets of) roadworks. Queuing traffic for 4 km\000"
+	"(%s sets of) roadworks. Queuing traffic for 6 km\000"
+	"(%s sets of) roadworks. Queuing traffic for 10 km\000"
+	"(%s sets of) roadworks. Danger of queuing traffic\000"
+	"(%s sets of) roadworks. Slow traffic\000"
+	"(%s sets of) roadworks. Slow traffic for 1 km\000"
+	"(%s sets of) roadworks. Slow traffic for 2 km\000"
+	"(%s sets of) roadworks. Slow traffic for 4 km\000"
+	"(%s sets of) roadworks. Slow traffic for 6 km\000"
+	"(%s sets of) roadworks. Slow traffic for 10 km\000"
+	"(%s sets of) roadworks. Slow traffic expected\000"
+	"(%s sets of) roadworks. Heavy traffic\000"
+	"(%s sets of) roadworks. Heavy traffic expected\000"
+	"(%s sets of) roadworks. Traffic flowing freely\000"
+	"(%s sets of) roadworks. Traffic building up\000"
+	"closed due to (%s sets of) roadworks\000"
+	"(%s sets of) roadworks. Right lane closed\000"
+	"(%s sets of) roadworks. Centre lane closed\000"
+	"(%s sets of) roadworks. Left lane closed\000"
+	"(%s sets of) roadworks. Hard shoulder closed\000"
+	"(%s sets of) roadworks. Two lanes closed\000"
+	"(%s sets of) roadworks. Three lanes closed\000"
+	"(%s sets of) roadworks. Single alternate line traffic\000"
+	"roadworks. Carriageway reduced (from %s lanes) to one lane\000"
+	"roadworks. Carriageway reduced (from %s lanes) to two lanes\000"
+	"roadworks. Carriageway reduced (from %s lanes) to three lanes\000"
+	"(%s sets of) roadworks. Contraflow\000"
+	"roadworks. Delays (%s)\000"
+	"roadworks. Delays (%s) expected\000"
+	"roadworks. Long delays (%s)\000"
+	"(%s sections of) resurfacing work. Stationary traffic\000"
+	"(%s sections of) resurfacing work. Stationary traffic for 1 km\000"
+	"(%s sections of) resurfacing work. Stationary traffic for 2 km\000"
+	"(%s sections of) resurfacing work. Stationary traffic for 4 km\000"
+	"(%s sections of) resurfacing work. Stationary traffic for 6 km\000"
+	"(%s sections of) resurfacing work. Stationary traffic for 10 km\000"
+	"(%s sections of) resurfacing work. Danger of stationary traffic\000"
+	"(%s sections of) resurfacing work. Queuing traffic\000"
+	"(%s sections of) resurfacing work. Queuing traffic for 1 km\000"
+	"(%s sections of) resurfacing work. Queuing traffic for 2 km\000"
+	"(%s sections of) resurfacing work. Queuing traffic for 4 km\000"
+	"(%s sections of) resurfacing work. Queuing traffic for 6 km\000"
+	"(%s sections of) resurfacing work. Queuing traffic for 10 km\000"
+	"(%s sections of) resurfacing work. Danger of queuing traffic\000"
+	"(%s sections of) resurfacing work. Slow traffic\000"
+	"(%s sections of) resurfacing work. Slow traffic for 1 km\000"
+	"(%s sections of) resurfacing work. Slow traffic for 2 km\000"
+	"(%s sections of) resurfacing work. Slow traffic for 4 km\000"
+	"(%s sections of) resurfacing work. Slow traffic for 6 km\000"
+	"(%s sections of) resurfacing work. Slow traffic for 10 km\000"
+	"(%s sections of) resurfacing work. Slow traffic expected\000"
+	"(%s sections of) resurfacing work. Heavy traffic\000"
+	"(%s sections of) resurfacing work. Heavy traffic expected\000"
+	"(%s sections of) resurfacing work. Traffic flowing freely\000"
+	"(%s sections of) resurfacing work. Traffic building up\000"
+	"(%s sections of) resurfacing work. Single alternate line traffic\000"
+	"resurfacing work. Carriageway reduced (from %s lanes) to one lane\000"
+	"resurfacing work. Carriageway reduced (from %s lanes) to two lanes\000"
+	"resurfacing work. Carriageway reduced (from %s lanes) to three lanes\000"
+	"(%s sections of) resurfacing work. Contraflow\000"
+	"resurfacing work. Delays (%s)\000"
+	"resurfacing work. Delays (%s) expected\000"
+	"resurfacing work. Long delays (%s)\000"
+	"(%s sets of) road marking work. Stationary traffic\000"
+	"(%s sets of) road marking work. Danger of stationary traffic\000"
+	"(%s sets of) road marking work. Queuing traffic\000"
+	"(%s sets of) road marking work. Danger of queuing traffic\000"
+	"(%s sets of) road marking work. Slow traffic\000"
+	"(%s sets of) road marking work. Slow traffic expected\000"
+	"(%s sets of) road marking work. Heavy traffic\000"
+	"(%s sets of) road marking work. Heavy traffic expected\000"
+	"(%s sets of) road marking work. Traffic flowing freely\000"
+	"(%s sets of) road marking work. Traffic building up\000"
+	"(%s sets of) road marking work. Right lane closed\000"
+	"(%s sets of) road marking work. Centre lane closed\000"
+	"(%s sets of) road marking work. Left lane closed\000"
+	"(%s sets of) road marking work. Hard shoulder closed\000"
+	"(%s sets of) road marking work. Two lanes closed\000"
+	"(%s sets of) road marking work. Three lanes closed\000"
+	"closed for bridge demolition work (at %s bridges)\000"
+	"roadworks cleared\000"
+	"message cancelled\000"
+	"(%s sets of) long-term roadworks\000"
+	"(%s sets of) construction work\000"
+	"(%s sets of) slow moving maintenance vehicles\000"
+	"bridge demolition work (at %s bridges)\000"
+	"(%s sets of) water main work\000"
+	"(%s sets of) gas main work\000"
+	"(%s sets of) work on buried cables\000"
+	"(%s sets of) work on buried services\000"
+	"new roadworks layout\000"
+	"new road layout\000"
+	"(%s sets of) roadworks. Stationary traffic for 3 km\000"
+	"(%s sets of) roadworks. Queuing traffic for 3 km\000"
+	"(%s sets of) roadworks. Slow traffic for 3 km\000"
+	"(%s sets of) roadworks during the day time\000"
+	"(%s sets of) roadworks during off-peak periods\000"
+	"(%s sets of) roadworks during the night\000"
+	"(%s sections of) resurfacing work. Stationary traffic for 3 km\000"
+	"(%s sections of) resurfacing work. Queuing traffic for 3 km\000"
+	"(%s sections of) resurfacing work. Slow traffic for 3 km\000"
+	"(%s sets of) resurfacing work during the day time\000"
+	"(%s sets of) resurfacing work during off-peak periods\000"
+	"(%s sets of) resurfacing work during the night\000"
+	"(%s sets of) road marking work. Danger\000"
+	"(%s sets of) slow moving maintenance vehicles. Stationary traffic\000"
+	"(%s sets of) slow moving maintenance vehicles. Danger of stationary traffic\000"
+	"(%s sets of) slow moving maintenance vehicles. Queuing traffic\000"
+	"(%s sets of) slow moving maintenance vehicles. Danger of queuing traffic\000"
+	"(%s sets of) slow moving maintenance vehicles. Slow traffic\000"
+	"(%s sets of) slow moving maintenance vehicles. Slow traffic expected\000"
+	"(%s sets of) slow moving maintenance vehicles. Heavy traffic\000"
+	"(%s sets of) slow moving maintenance vehicles. Heavy traffic expected\000"
+	"(%s sets of) slow moving maintenance vehicles. Traffic flowing freely\000"
+	"(%s sets of) slow moving maintenance vehicles. Traffic building up\000"
+	"(%s sets of) slow moving maintenance vehicles. Right lane closed\000"
+	"(%s sets of) slow moving maintenance vehicles. Centre lane closed\000"
+	"(%s sets of) slow moving maintenance vehicles. Left lane closed\000"
+	"(%s sets of) slow moving maintenance vehicles. Two lanes closed\000"
+	"(%s sets of) slow moving maintenance vehicles. Three lanes closed\000"
+	"water main work. Delays (%s)\000"
+	"water main work. Delays (%s) expected\000"
+	"water main work. Long delays (%s)\000"
+	"gas main work. Delays (%s)\000"
+	"gas main work. Delays (%s) expected\000"
+	"gas main work. Long delays (%s)\000"
+	"work on buried cables. Delays (%s)\000"
+	"work on buried cables. Delays (%s) expected\000"
+	"work on buried cables. Long delays (%s)\000"
+	"work on buried services. Delays (%s)\000"
+	"work on buried services. Delays (%s) expected\000"
+	"work on buried services. Long delays (%s)\000"
+	"construction traffic merging\000"
+	"roadwork clearance in progress\000"
+	"maintenance work cleared\000"
+	"road layout unchanged\000"
+	"construction traffic merging. Danger\000"
+	"(%s) unprotected accident area(s)\000"
+	"danger of(%s) unprotected accident area(s)\000"
+	"(%s) unlit vehicle(s) on the road\000"
+	"danger of (%s) unlit vehicle(s) on the road\000"
+	"snow and ice debris\000"
+	"danger of snow and ice debris\000"
+	"people throwing objects onto the road. Danger\000"
+	"obstruction warning withdrawn\000"
+	"clearance work in progress, road free again\000"
+	"flooding expected\000"
+	"(%s) obstruction(s) on roadway\000"
+	"(%s) obstructions on the road. Danger\000"
+	"spillage on the road\000"
+	"storm damage\000"
+	"(%s) fallen trees\000"
+	"(%s) fallen trees. Danger\000"
+	"flooding\000"
+	"flooding. Danger\000"
+	"flash floods\000"
+	"danger of flash floods\000"
+	"avalanches\000"
+	"avalanche risk\000"
+	"rockfalls\000"
+	"landslips\000"
+	"earthquake damage\000"
+	"road surface in poor condition\000"
+	"subsidence\000"
+	"(%s) collapsed sewer(s)\000"
+	"burst water main\000"
+	"gas leak\000"
+	"serious fire\000"
+	"animals on roadway\000"
+	"animals on the road. Danger\000"
+	"clearance work\000"
+	"blocked by storm damage\000"
+	"blocked by (%s) fallen trees\000"
+	"(%s) fallen tree(s). Passable with care\000"
+	"flooding. Stationary traffic\000"
+	"flooding. Danger of stationary traffic\000"
+	"flooding. Queuing traffic\000"
+	"flooding. Danger of queuing traffic\000"
+	"flooding. Slow traffic\000"
+	"flooding. Slow traffic expected\000"
+	"flooding. Heavy traffic\000"
+	"flooding. Heavy traffic expected\000"
+	"flooding. Traffic flowing freely\000"
+	"flooding. Traffic building up\000"
+	"closed due to flooding\000"
+	"flooding. Delays (%s)\000"
+	"flooding. Delays (%s) expected\000"
+	"flooding. Long delays (%s)\000"
+	"flooding. Passable with care\000"
+	"closed due to avalanches\000"
+	"avalanches. Passable with care (above %s hundred metres)\000"
+	"closed due to rockfalls\000"
+	"rockfalls. Passable with care\000"
+	"road closed due to landslips\000"
+	"landslips. Passable with care\000"
+	"closed due to subsidence\000"
+	"subsidence. Single alternate line traffic\000"
+	"subsidence. Carriageway reduced (from %s lanes) to one lane\000"
+	"subsidence. Carriageway reduced (from %s lanes) to two lanes\000"
+	"subsidence. Carriageway reduced (from %s lanes) to three lanes\000"
+	"subsidence. Contraflow in operation\000"
+	"subsidence. Passable with care\000"
+	"closed due to sewer collapse\000"
+	"road closed due to burst water main\000"
+	"burst water main. Delays (%s)\000"
+	"burst water main. Delays (%s) expected\000"
+	"burst water main. Long delays (%s)\000"
+	"closed due to gas leak\000"
+	"gas leak. Delays (%s)\000"
+	"gas leak. Delays (%s) expected\000"
+	"gas leak. Long delays (%s)\000"
+	"closed due to serious fire\000"
+	"serious fire. Delays (%s)\000"
+	"serious fire. Delays (%s) expected\000"
+	"serious fire. Long delays (%s)\000"
+	"closed for clearance work\000"
+	"road free again\000"
+	"message cancelled\000"
+	"storm damage expected\000"
+	"fallen power cables\000"
+	"sewer overflow\000"
+	"ice build-up\000"
+	"mud slide\000"
+	"grass fire\000"
+	"air crash\000"
+	"rail crash\000"
+	"blocked by (%s) obstruction(s) on the road\000"
+	"(%s) obstructions on the road. Passable with care\000"
+	"blocked due to spillage on roadway\000"
+	"spillage on the road. Passable with care\000"
+	"spillage on the road. Danger\000"
+	"storm damage. Passable with care\000"
+	"storm damage. Danger\000"
+	"blocked by fallen power cables\000"
+	"fallen power cables. Passable with care\000"
+	"fallen power cables. Danger\000"
+	"sewer overflow. Danger\000"
+	"flash floods. Danger\000"
+	"avalanches. Danger\000"
+	"closed due to avalanche risk\000"
+	"avalanche risk. Danger\000"
+	"closed due to ice build-up\000"
+	"ice build-up. Passable with care (above %s hundred metres)\000"
+	"ice build-up. Single alternate traffic\000"
+	"rockfalls. Danger\000"
+	"landslips. Danger\000"
+	"earthquake damage. Danger\000"
+	"hazardous driving conditions (above %s hundred metres)\000"
+	"danger of aquaplaning\000"
+	"slippery road (above %s hundred metres)\000"
+	"mud on road\000"
+	"leaves on road\000"
+	"ice (above %s hundred metres)\000"
+	"danger of ice (above %s hundred metres)\000"
+	"black ice (above %s hundred metres)\000"
+	"freezing rain (above %s hundred metres)\000"
+	"wet and icy roads (above %s hundred metres)\000"
+	"slush (above %s hundred metres)\000"
+	"snow on the road (above %s hundred metres)\000"
+	"packed snow (above %s hundred metres)\000"
+	"fresh snow (above %s hundred metres)\000"
+	"deep snow (above %s hundred metres)\000"
+	"snow drifts (above %s hundred metres)\000"
+	"slippery due to spillage on roadway\000"
+	"slippery road (above %s hundred metres) due to snow\000"
+	"slippery road (above %s hundred metres) due to frost\000"
+	"road blocked by snow (above %s hundred metres)\000"
+	"snow on the road. Carriageway reduced (from %s lanes) to one lane\000"
+	"snow on the road. Carriageway reduced (from %s lanes) to two lanes\000"
+	"snow on the road. Carriageway reduced (from %s lanes) to three lanes\000"
+	"conditions of road surface improved\000"
+	"message cancelled\000"
+	"subsidence. Danger\000"
+	"sewer collapse. Delays (%s)\000"
+	"sewer collapse. Delays (%s) expected\000"
+	"sewer collapse. Long delays (%s)\000"
+	"sewer collapse. Danger\000"
+	"burst water main. Danger\000"
+	"gas leak. Danger\000"
+	"serious fire. Danger\000"
+	"clearance work. Danger\000"
+	"impassable (above %s hundred metres)\000"
+	"almost impassable (above %s hundred metres)\000"
+	"extremely hazardous driving conditions (above %s hundred metres)\000"
+	"difficult driving conditions (above %s hundred metres)\000"
+	"passable with care (up to %s hundred metres)\000"
+	"passable (up to %s hundred metres)\000"
+	"surface water hazard\000"
+	"loose sand on road\000"
+	"loose chippings\000"
+	"oil on road\000"
+	"petrol on road\000"
+	"ice expected (above %s hundred metres)\000"
+	"icy patches (above %s hundred metres)\000"
+	"danger of icy patches (above %s hundred metres)\000"
+	"icy patches expected (above %s hundred metres)\000"
+	"danger of black ice (above %s hundred metres)\000"
+	"black ice expected (above %s hundred metres)\000"
+	"freezing rain expected (above %s hundred metres)\000"
+	"snow drifts expected (above %s hundred metres)\000"
+	"slippery due to loose sand on roadway\000"
+	"mud on road. Danger\000"
+	"loose chippings. Danger\000"
+	"oil on road. Danger\000"
+	"petrol on road. Danger\000"
+	"road surface in poor condition. Danger\000"
+	"icy patches (above %s hundred metres) on bridges\000"
+	"danger of icy patches (above %s hundred metres) on bridges\000"
+	"icy patches (above %s hundred metres) on bridges, in shaded areas and on slip roads\000"
+	"impassable for heavy vehicles (over %s)\000"
+	"impassable (above %s hundred metres) for vehicles with trailers\000"
+	"driving conditions improved\000"
+	"rescue and recovery work in progress. Danger\000"
+	"large animals on roadway\000"
+	"herds of animals on roadway\000"
+	"skid hazard reduced\000"
+	"snow cleared\000"
+	"road conditions forecast withdrawn\000"
+	"message cancelled\000"
+	"extremely hazardous driving conditions expected (above %s hundred meters)\000"
+	"freezing rain expected (above %s hundred metres)\000"
+	"danger of road being blocked by snow (above %s hundred metres)\000"
+	"temperature falling rapidly (to %s)\000"
+	"extreme heat (up to %s)\000"
+	"extreme cold (of %s)\000"
+	"less extreme temperatures\000"
+	"current temperature (%s)\000"
+	"house fire\000"
+	"forest fire\000"
+	"vehicle stuck under bridge\000"
+	"volcano eruption warning\000"
+	"heavy snowfall (%s)\000"
+	"heavy snowfall (%s). Visibility reduced to <30 m\000"
+	"heavy snowfall (%s). Visibility reduced to <50 m\000"
+	"snowfall (%s)\000"
+	"snowfall (%s). Visibility reduced to <100 m\000"
+	"hail (visibility reduced to %s)\000"
+	"sleet (visibility reduced to %s)\000"
+	"thunderstorms (visibility reduced to %s)\000"
+	"heavy rain (%s)\000"
+	"heavy rain (%s). Visibility reduced to <30 m\000"
+	"heavy rain (%s). Visibility reduced to <50 m\000"
+	"rain (%s)\000"
+	"rain (%s). Visibility reduced to <100 m\000"
+	"showers (visibility reduced to %s)\000"
+	"heavy frost\000"
+	"frost\000"
+	"(%s probability of) overcast weather\000"
+	"(%s probability of) mostly cloudy\000"
+	"(%s probability of) partly cloudy\000"
+	"(%s probability of) sunny periods\000"
+	"(%s probability of) clear weather\000"
+	"(%s probability of) sunny weather\000"
+	"(%s probability of) mostly dry weather\000"
+	"(%s probability of) dry weather\000"
+	"sunny periods and with (%s probability of) showers\000"
+	"weather situation improved\000"
+	"message cancelled\000"
+	"winter storm (visibility reduced to %s)\000"
+	"(%s probability of) winter storm\000"
+	"blizzard (visibility reduced to %s)\000"
+	"(%s probability of) blizzard\000"
+	"damaging hail (visibility reduced to %s)\000"
+	"(%s probability of) damaging hail\000"
+	"heavy snowfall. Visibility reduced (to %s)\000"
+	"snowfall. Visibility reduced (to %s)\000"
+	"heavy rain. Visibility reduced (to %s)\000"
+	"rain. Visibility reduced (to %s)\000"
+	"severe weather warnings cancelled\000"
+	"message cancelled\000"
+	"weather forecast withdrawn\000"
+	"fog forecast withdrawn\000"
+	"slippery road expected (above %s hundred metres)\000"
+	"(%s probability of) heavy snowfall\000"
+	"(%s probability of) snowfall\000"
+	"(%s probability of) hail\000"
+	"(%s probability of) sleet\000"
+	"(%s probability of) thunderstorms\000"
+	"(%s probability of) heavy rain\000"
+	"(%s probability of) rain\000"
+	"(%s probability of) showers\000"
+	"(%s probability of) heavy frost\000"
+	"(%s probability of) frost\000"
+	"rain changing to snow\000"
+	"snow changing to rain\000"
+	"heavy snowfall (%s) expected\000"
+	"heavy rain (%s) expected\000"
+	"weather expected to improve\000"
+	"blizzard (with visibility reduced to %s) expected\000"
+	"damaging hail (with visibility reduced to %s) expected\000"
+	"reduced visibility (to %s) expected\000"
+	"freezing fog expected (with visibility reduced to %s). Danger of slippery roads\000"
+	"dense fog (with visibility reduced to %s) expected\000"
+	"patchy fog (with visibility reduced to %s) expected\000"
+	"visibility expected to improve\000"
+	"adverse weather warning withdrawn\000"
+	"severe smog\000"
+	"severe exhaust pollution\000"
+	"tornadoes\000"
+	"hurricane force winds (%s)\000"
+	"gales (%s)\000"
+	"storm force winds (%s)\000"
+	"strong winds (%s)\000"
+	"moderate winds (%s)\000"
+	"light winds (%s)\000"
+	"calm weather\000"
+	"gusty winds (%s)\000"
+	"crosswinds (%s)\000"
+	"strong winds (%s) affecting high-sided vehicles\000"
+	"closed for high-sided vehicles due to strong winds (%s)\000"
+	"strong winds easing\000"
+	"message cancelled\000"
+	"restrictions for high-sided vehicles lifted\000"
+	"tornado watch cancelled\000"
+	"tornado warning ended\000"
+	"wind forecast withdrawn\000"
+	"message cancelled\000"
+	"(%s probability of) tornadoes\000"
+	"hurricane force winds (%s)\000"
+	"gales (%s)\000"
+	"storm force winds (%s)\000"
+	"strong winds (%s)\000"
+	"strong wind forecast withdrawn\000"
+	"snowfall and fog (visibility reduced to %s) expected\000"
+	"dense fog (visibility reduced to %s)\000"
+	"dense fog. Visibility reduced to <30 m\000"
+	"dense fog. Visibility reduced to <50 m\000"
+	"fog (visibility reduced to %s)\000"
+	"fog. Visibility reduced to <100 m\000"
+	"(%s probability of) fog\000"
+	"patchy fog (visibility reduced to %s)\000"
+	"freezing fog (visibility reduced to %s)\000"
+	"smoke hazard (visibility reduced to %s)\000"
+	"blowing dust (visibility reduced to %s)\000"
+	"(%s probability of) severe exhaust pollution\000"
+	"snowfall and fog (visibility reduced to %s)\000"
+	"visibility improved\000"
+	"message cancelled\000"
+	"(%s probability of) dense fog\000"
+	"(%s probability of) patchy fog\000"
+	"(%s probability of) freezing fog\000"
+	"visibility reduced (to %s)\000"
+	"visibility reduced to <30 m\000"
+	"visibility reduced to <50 m\000"
+	"visibility reduced to <100 m\000"
+	"white out (visibility reduced to %s)\000"
+	"blowing snow (visibility reduced to %s)\000"
+	"spray hazard (visibility reduced to %s)\000"
+	"low sun glare\000"
+	"sandstorms (visibility reduced to %s)\000"
+	"(%s probability of) sandstorms\000"
+	"(%s probability of) air quality: good\000"
+	"(%s probability of) air quality: fair\000"
+	"(%s probability of) air quality: poor\000"
+	"(%s probability of) air quality: very poor\000"
+	"smog alert\000"
+	"(%s probability of) smog\000"
+	"(%s probability of) pollen count: high\000"
+	"(%s probability of) pollen count: medium\000"
+	"(%s probability of) pollen count: low\000"
+	"freezing fog (visibility reduced to %s). Slippery roads\000"
+	"no motor vehicles due to smog alert\000"
+	"air quality improved\000"
+	"swarms of insects (visibility reduced to %s)\000"
+	"fog clearing\000"
+	"fog forecast withdrawn\000"
+	"maximum temperature (of %s)\000"
+	"hot, (maximum temperature %s)\000"
+	"warm, (maximum temperature %s)\000"
+	"mild, (maximum temperature %s)\000"
+	"cool, (maximum temperature %s)\000"
+	"cold, (maximum temperature %s)\000"
+	"very cold, (maximum temperature %s)\000"
+	"message cancelled\000"
+	"temperature rising (to %s)\000"
+	"temperature falling rapidly (to %s)\000"
+	"temperature (%s)\000"
+	"effective temperature, with wind chill (%s)\000"
+	"extreme heat (up to %s)\000"
+	"extreme cold (of %s)\000"
+	"minimum temperature (of %s)\000"
+	"very warm (minimum temperature %s)\000"
+	"warm (minimum temperature %s)\000"
+	"mild (minimum temperature %s)\000"
+	"cool (minimum temperature %s)\000"
+	"cold (minimum temperature %s)\000"
+	"very cold (minimum temperature %s)\000"
+	"less extreme temperatures expected\000"
+	"emergency training in progress\000"
+	"international sports meeting\000"
+	"match\000"
+	"tournament\000"
+	"athletics meeting\000"
+	"ball game\000"
+	"boxing tournament\000"
+	"bull fight\000"
+	"cricket match\000"
+	"cycle race\000"
+	"football match\000"
+	"golf tournament\000"
+	"marathon\000"
+	"race meeting\000"
+	"rugby match\000"
+	"show jumping\000"
+	"tennis tournament\000"
+	"water sports meeting\000"
+	"winter sports meeting\000"
+	"funfair\000"
+	"trade fair\000"
+	"procession\000"
+	"sightseers obstructing access\000"
+	"people on roadway\000"
+	"children on roadway\000"
+	"cyclists on roadway\000"
+	"strike\000"
+	"security incident\000"
+	"police checkpoint\000"
+	"terrorist incident\000"
+	"gunfire on roadway, danger\000"
+	"civil emergency\000"
+	"air raid, danger\000"
+	"people on roadway. Danger\000"
+	"children on roadway. Danger\000"
+	"cyclists on roadway. Danger\000"
+	"closed due to security incident\000"
+	"security incident. Delays (%s)\000"
+	"security incident. Delays (%s) expected\000"
+	"security incident. Long delays (%s)\000"
+	"police checkpoint. Delays (%s)\000"
+	"police checkpoint. Delays (%s) expected\000"
+	"police checkpoint. Long delays (%s)\000"
+	"security alert withdrawn\000"
+	"sports traffic cleared\000"
+	"evacuation\000"
+	"evacuation. Heavy traffic\000"
+	"traffic disruption cleared\000"
+	"military training in progress\000"
+	"police activity ongoing\000"
+	"medical emergency ongoing\000"
+	"child abduction in progress\000"
+	"major event\000"
+	"sports event meeting\000"
+	"show\000"
+	"festival\000"
+	"exhibition\000"
+	"fair\000"
+	"market\000"
+	"ceremonial event\000"
+	"state occasion\000"
+	"parade\000"
+	"crowd\000"
+	"march\000"
+	"demonstration\000"
+	"public disturbance\000"
+	"security alert\000"
+	"bomb alert\000"
+	"major event. Stationary traffic\000"
+	"major event. Danger of stationary traffic\000"
+	"major event. Queuing traffic\000"
+	"major event. Danger of queuing traffic\000"
+	"major event. Slow traffic\000"
+	"major event. Slow traffic expected\000"
+	"major event. Heavy traffic\000"
+	"major event. Heavy traffic expected\000"
+	"major event. Traffic flowing freely\000"
+	"major event. Traffic building up\000"
+	"closed due to major event\000"
+	"major event. Delays (%s)\000"
+	"major event. Delays (%s) expected\000"
+	"major event. Long delays (%s)\000"
+	"sports meeting. Stationary traffic\000"
+	"sports meeting. Danger of stationary traffic\000"
+	"sports meeting. Queuing traffic\000"
+	"sports meeting. Danger of queuing traffic\000"
+	"sports meeting. Slow traffic\000"
+	"sports meeting. Slow traffic expected\000"
+	"sports meeting. Heavy traffic\000"
+	"sports meeting. Heavy traffic expected\000"
+	"sports meeting. Traffic flowing freely\000"
+	"sports meeting. Traffic building up\000"
+	"closed due to sports meeting\000"
+	"sports meeting. Delays (%s)\000"
+	"sports meeting. Delays (%s) expected\000"
+	"sports meeting. Long delays (%s)\000"
+	"fair. Stationary traffic\000"
+	"fair. Danger of stationary traffic\000"
+	"fair. Queuing traffic\000"
+	"fair. Danger of queuing traffic\000"
+	"fair. Slow traffic\000"
+	"fair. Slow traffic expected\000"
+	"fair. Heavy traffic\000"
+	"fair. Heavy traffic expected\000"
+	"fair. Traffic flowing freely\000"
+	"fair. Traffic building up\000"
+	"closed due to fair\000"
+	"fair. Delays (%s)\000"
+	"fair. Delays (%s) expected\000"
+	"fair. Long delays (%s)\000"
+	"closed due to parade\000"
+	"parade. Delays (%s)\000"
+	"parade. Delays (%s) expected\000"
+	"parade. Long delays (%s)\000"
+	"closed due to strike\000"
+	"strike. Delays (%s)\000"
+	"strike. Delays (%s) expected\000"
+	"strike. Long delays (%s)\000"
+	"closed due to demonstration\000"
+	"demonstration. Delays (%s)\000"
+	"demonstration. Delays (%s) expected\000"
+	"demonstration. Long delays (%s)\000"
+	"security alert. Stationary traffic\000"
+	"security alert. Danger of stationary traffic\000"
+	"security alert. Queuing traffic\000"
+	"security alert. Danger of queuing traffic\000"
+	"security alert. Slow traffic\000"
+	"security alert. Slow traffic expected\000"
+	"security alert. Heavy traffic\000"
+	"security alert. Heavy traffic expected\000"
+	"security alert. Traffic building up\000"
+	"closed due to security alert\000"
+	"security alert. Delays (%s)\000"
+	"security alert. Delays (%s) expected\000"
+	"security alert. Long delays (%s)\000"
+	"traffic has returned to normal\000"
+	"message cancelled\000"
+	"security alert. Traffic flowing freely\000"
+	"air raid warning cancelled\000"
+	"civil emergency cancelled\000"
+	"message cancelled\000"
+	"several major events\000"
+	"information about major event no longer valid\000"
+	"automobile race\000"
+	"baseball game\000"
+	"basketball game\000"
+	"boat race\000"
+	"concert\000"
+	"hockey game\000"
+	"delays (%s)\000"
+	"delays up to 15 minutes\000"
+	"delays up to 30 minutes\000"
+	"delays up to one hour\000"
+	"delays up to two hours\000"
+	"delays of several hours\000"
+	"delays (%s) expected\000"
+	"long delays (%s)\000"
+	"delays (%s) for heavy vehicles\000"
+	"delays up to 15 minutes for heavy lorr(y/ies)\000"
+	"delays up to 30 minutes for heavy lorr(y/ies)\000"
+	"delays up to one hour for heavy lorr(y/ies)\000"
+	"delays up to two hours for heavy lorr(y/ies)\000"
+	"delays of several hours for heavy lorr(y/ies)\000"
+	"service suspended (until %s)\000"
+	"(%s) service withdrawn\000"
+	"(%s) service(s) fully booked\000"
+	"(%s) service(s) fully booked for heavy vehicles\000"
+	"normal services resumed\000"
+	"message cancelled\000"
+	"delays up to 5 minutes\000"
+	"delays up to 10 minutes\000"
+	"delays up to 20 minutes\000"
+	"delays up to 25 minutes\000"
+	"delays up to 40 minutes\000"
+	"delays up to 50 minutes\000"
+	"delays up to 90 minutes\000"
+	"delays up to three hours\000"
+	"delays up to four hours\000"
+	"delays up to five hours\000"
+	"very long delays (%s)\000"
+	"delays of uncertain duration\000"
+	"delayed until further notice\000"
+	"cancellations\000"
+	"park and ride service not operating (until %s)\000"
+	"special public transport services operating (until %s)\000"
+	"normal services not operating (until %s)\000"
+	"rail services not operating (until %s)\000"
+	"bus services not operating (until %s)\000"
+	"shuttle service operating (until %s)\000"
+	"free shuttle service operating (until %s)\000"
+	"delays (%s) for heavy lorr(y/ies)\000"
+	"delays (%s) for buses\000"
+	"(%s) service(s) fully booked for heavy lorr(y/ies)\000"
+	"(%s) service(s) fully booked for buses\000"
+	"next departure (%s) for heavy lorr(y/ies)\000"
+	"next departure (%s) for buses\000"
+	"delays cleared\000"
+	"rapid transit service not operating (until %s)\000"
+	"delays (%s) possible\000"
+	"underground service not operating (until %s)\000"
+	"cancellations expected\000"
+	"long delays expected\000"
+	"very long delays expected\000"
+	"all services fully booked (until %s)\000"
+	"next arrival (%s)\000"
+	"rail services irregular. Delays (%s)\000"
+	"bus services irregular. Delays (%s)\000"
+	"underground services irregular\000"
+	"normal public transport services resumed\000"
+	"ferry service not operating (until %s)\000"
+	"park and ride trip time (%s)\000"
+	"delay expected to be cleared\000"
+	"demonstration by vehicles\000"
+	"delays (%s) have to be expected\000"
+	"delays of several hours have to be expected\000"
+	"closed ahead. Delays (%s) have to be expected\000"
+	"roadworks. Delays (%s) have to be expected\000"
+	"flooding. Delays (%s) have to be expected\000"
+	"major event. Delays (%s) have to be expected\000"
+	"strike. Delays (%s) have to be expected\000"
+	"delays of several hours for heavy lorries have to be expected\000"
+	"long delays have to be expected\000"
+	"very long delays have to be expected\000"
+	"delay forecast withdrawn\000"
+	"message cancelled\000"
+	"current trip time (%s)\000"
+	"expected trip time (%s)\000"
+	"(%s) slow moving maintenance vehicle(s)\000"
+	"(%s) vehicle(s) on wrong carriageway\000"
+	"dangerous vehicle warning cleared\000"
+	"message cancelled\000"
+	"(%s) reckless driver(s)\000"
+	"(%s) prohibited vehicle(s) on the roadway\000"
+	"(%s) emergency vehicles\000"
+	"(%s) high-speed emergency vehicles\000"
+	"high-speed chase (involving %s vehicles)\000"
+	"spillage occurring from moving vehicle\000"
+	"objects falling from moving vehicle\000"
+	"emergency vehicle warning cleared\000"
+	"road cleared\000"
+	"rail services irregular\000"
+	"public transport services not operating\000"
+	"(%s) abnormal load(s), danger\000"
+	"(%s) wide load(s), danger\000"
+	"(%s) long load(s), danger\000"
+	"(%s) slow vehicle(s), danger\000"
+	"(%s) track-laying vehicle(s), danger\000"
+	"(%s) vehicle(s) carrying hazardous materials. Danger\000"
+	"(%s) convoy(s), danger\000"
+	"(%s) military convoy(s), danger\000"
+	"(%s) overheight load(s), danger\000"
+	"abnormal load causing slow traffic. Delays (%s)\000"
+	"convoy causing slow traffic. Delays (%s)\000"
+	"(%s) abnormal load(s)\000"
+	"(%s) wide load(s)\000"
+	"(%s) long load(s)\000"
+	"(%s) slow vehicle(s)\000"
+	"(%s) convoy(s)\000"
+	"abnormal load. Delays (%s)\000"
+	"abnormal load. Delays (%s) expected\000"
+	"abnormal load. Long delays (%s)\000"
+	"convoy causing delays (%s)\000"
+	"convoy. Delays (%s) expected\000"
+	"convoy causing long delays (%s)\000"
+	"exceptional load warning cleared\000"
+	"message cancelled\000"
+	"(%s) track-laying vehicle(s)\000"
+	"(%s) vehicle(s) carrying hazardous materials\000"
+	"(%s) military convoy(s)\000"
+	"(%s) abnormal load(s). No overtaking\000"
+	"Vehicles carrying hazardous materials have to stop at next safe place!\000"
+	"hazardous load warning cleared\000"
+	"convoy cleared\000"
+	"warning cleared\000"
+	"cancellations have to be expected\000"
+	"all services fully booked (until %s)\000"
+	"park and ride service will not be operating (until %s)\000"
+	"normal services will not be operating (until %s)\000"
+	"rail services will not be operating (until %s)\000"
+	"rapid transit service will not be operating (until %s)\000"
+	"underground service will not be operating (until %s)\000"
+	"public transport will be on strike\000"
+	"ferry service will not be operating (until %s)\000"
+	"normal services expected\000"
+	"message cancelled\000"
+	"lane control signs not working\000"
+	"emergency telephones not working\000"
+	"emergency telephone number not working\000"
+	"(%s sets of) traffic lights not working\000"
+	"(%s sets of) traffic lights working incorrectly\000"
+	"level crossing failure\000"
+	"(%s sets of) traffic lights not working. Stationary traffic\000"
+	"(%s sets of) traffic lights not working. Danger of stationary traffic\000"
+	"(%s sets of) traffic lights not working. Queuing traffic\000"
+	"(%s sets of) traffic lights not working. Danger of queuing traffic\000"
+	"(%s sets of) traffic lights not working. Slow traffic\000"
+	"(%s sets of) traffic lights not working. Slow traffic expected\000"
+	"(%s sets of) traffic lights not working. Heavy traffic\000"
+	"(%s sets of) traffic lights not working. Heavy traffic expected\000"
+	"(%s sets of) traffic lights not working. Traffic flowing freely\000"
+	"(%s sets of) traffic lights not working. Traffic building up\000"
+	"traffic lights not working. Delays (%s)\000"
+	"traffic lights not working. Delays (%s) expected\000"
+	"traffic lights not working. Long delays (%s)\000"
+	"level crossing failure. Stationary traffic\000"
+	"level crossing failure. Danger of stationary traffic\000"
+	"level crossing failure. Queuing traffic\000"
+	"level crossing failure. Danger of queuing traffic\000"
+	"level crossing failure. Slow traffic\000"
+	"level crossing failure. Slow traffic expected\000"
+	"level crossing failure. Heavy traffic\000"
+	"level crossing failure. Heavy traffic expected\000"
+	"level crossing failure. Traffic flowing freely\000"
+	"level crossing failure. Traffic building up\000"
+	"level crossing failure. Delays (%s)\000"
+	"level crossing failure. Delays (%s) expected\000"
+	"level crossing failure. Long delays (%s)\000"
+	"electronic signs repaired\000"
+	"emergency call facilities restored\000"
+	"traffic signals repaired\000"
+	"level crossing now working normally\000"
+	"message cancelled\000"
+	"lane control signs working incorrectly\000"
+	"lane control signs operating\000"
+	"variable message signs not working\000"
+	"variable message signs working incorrectly\000"
+	"variable message signs operating\000"
+	"(%s sets of) ramp control signals not working\000"
+	"(%s sets of) ramp control signals working incorrectly\000"
+	"(%s sets of) temporary traffic lights not working\000"
+	"(%s sets of) temporary traffic lights working incorrectly\000"
+	"traffic signal control computer not working\000"
+	"traffic signal timings changed\000"
+	"tunnel ventilation not working\000"
+	"lane control signs not working. Danger\000"
+	"temporary width limit (%s)\000"
+	"temporary width limit lifted\000"
+	"traffic regulations have been changed\000"
+	"less than 50 parking spaces available\000"
+	"no parking information available (until %s)\000"
+	"message cancelled\000"
+	"Snowplough. Delays (%s)\000"
+	"temporary height limit (%s)\000"
+	"temporary height limit lifted\000"
+	"(%s) automatic payment lanes not working\000"
+	"lane control signs working incorrectly. Danger\000"
+	"emergency telephones out of order. Extra police patrols in operation\000"
+	"emergency telephones out of order. In emergency, wait for police patrol\000"
+	"(%s sets of) traffic lights not working. Danger\000"
+	"traffic lights working incorrectly. Delays (%s)\000"
+	"traffic lights working incorrectly. Delays (%s) expected\000"
+	"traffic lights working incorrectly. Long delays (%s)\000"
+	"temporary axle load limit (%s)\000"
+	"temporary gross weight limit (%s)\000"
+	"temporary gross weight limit lifted\000"
+	"temporary axle weight limit lifted\000"
+	"(%s sets of) traffic lights working incorrectly. Danger\000"
+	"temporary traffic lights not working. Delays (%s)\000"
+	"temporary traffic lights not working. Delays (%s) expected\000"
+	"temporary traffic lights not working. Long delays (%s)\000"
+	"(%s sets of) temporary traffic lights not working. Danger\000"
+	"traffic signal control computer not working. Delays (%s)\000"
+	"temporary length limit (%s)\000"
+	"temporary length limit lifted\000"
+	"message cancelled\000"
+	"traffic signal control computer not working. Delays (%s) expected\000"
+	"traffic signal control computer not working. Long delays (%s)\000"
+	"normal parking restrictions lifted\000"
+	"special parking restrictions in force\000"
+	"10% full\000"
+	"20% full\000"
+	"30% full\000"
+	"40% full\000"
+	"50% full\000"
+	"60% full\000"
+	"70% full\000"
+	"80% full\000"
+	"90% full\000"
+	"less than 10 parking spaces available\000"
+	"less than 20 parking spaces available\000"
+	"less than 30 parking spaces available\000"
+	"less than 40 parking spaces available\000"
+	"next departure (%s)\000"
+	"next departure (%s) for heavy vehicles\000"
+	"car park (%s) full\000"
+	"all car parks (%s) full\000"
+	"less than (%s) car parking spaces available\000"
+	"park and ride service operating (until %s)\000"
+	"(null event)\000"
+	"switch your car radio (to %s)\000"
+	"alarm call: important new information on this frequency follows now in normal programme\000"
+	"alarm set: new information will be broadcast between these times in normal programme\000"
+	"message cancelled\000"
+	"switch your car radio (to %s)\000"
+	"no information available (until %s)\000"
+	"this message is for test purposes only (number %s), please ignore\000"
+	"no information available (until %s) due to technical problems\000"
+	"automatic toll system not working, pay manually\000"
+	"full\000"
+	"only a few parking spaces available\000"
+	"(%s) parking spaces available\000"
+	"expect car park to be full\000"
+	"expect no parking spaces available\000"
+	"multi story car parks full\000"
+	"no problems to report with park and ride services\000"
+	"no parking spaces available\000"
+	"no parking (until %s)\000"
+	"special parking restrictions lifted\000"
+	"urgent information will be given (at %s) on normal programme broadcasts\000"
+	"this TMC-service is not active (until %s)\000"
+	"detailed information will be given (at %s) on normal programme broadcasts\000"
+	"detailed information is provided by another TMC service\000"
+	"no park and ride information available (until %s)\000"
+	"park and ride information service resumed\000"
+	"travel information telephone service availiable\000"
+	"additional regional information is provided by another TMC service\000"
+	"additional local information is provided by another TMC service\000"
+	"additional public transport information is provided by another TMC service\000"
+	"national traffic information is provided by another TMC service\000"
+	"this service provides major road information\000"
+	"this service provides regional travel information\000"
+	"this service provides local travel information\000"
+	"no detailed regional information provided by this service\000"
+	"no detailed local information provided by this service\000"
+	"no cross-border information provided by this service\000"
+	"information restricted to this area\000"
+	"no new traffic information available (until %s)\000"
+	"no public transport information available\000"
+	"this TMC-service is being suspended (at %s)\000"
+	"active TMC-service will resume (at %s)\000"
+	"reference to audio programmes no longer valid\000"
+	"reference to other TMC services no longer valid\000"
+	"previous announcement about this or other TMC services no longer valid\000"
+	"allow emergency vehicles to pass in the carpool lane\000"
+	"carpool lane available for all vehicles\000"
+	"police directing traffic via the carpool lane\000"
+	"rail information service not available\000"
+	"rail information service resumed\000"
+	"rapid transit information service not available\000"
+	"rapid transit information service resumed\000"
+	"police directing traffic\000"
+	"buslane available for all vehicles\000"
+	"police directing traffic via the buslane\000"
+	"allow emergency vehicles to pass\000"
+	"overtaking prohibited for heavy vehicles (over %s)\000"
+	"overtaking prohibited\000"
+	"allow emergency vehicles to pass in the heavy vehicle lane\000"
+	"heavy vehicle lane available for all vehicles\000"
+	"police directing traffic via the heavy vehicle lane\000"
+	"overtaking prohibited for heavy lorries (over %s)\000"
+	"drivers of heavy lorries (over %s) are recommended to stop at next safe place\000"
+	"buslane closed\000"
+	"power failure\000"
+	"overtaking restriction lifted\000"
+	"Low Emission Zone restriction in force\000"
+	"car park closed (until %s)\000"
+	"danger of waiting vehicles on roadway\000"
+	"number of parking spaces decreasing\000"
+	"number of parking spaces constant\000"
+	"number of parking spaces increasing\000"
+	"dangerous situation on exit slip road\000"
+	"dangerous situation on entry slip road\000"
+	"closed due to smog alert (until %s)\000"
+	"closed for vehicles with less than three occupants\000"
+	"closed for vehicles with only one occupant\000"
+	"service area busy\000"
+	"service not operating, substitute service available\000"
+	"public transport strike\000"
+	"message cancelled\000"
+	"message cancelled\000"
+	"message cancelled\000"
+	"message cancelled\000"
+	"message cancelled\000"
+	"message cancelled\000"
+	"message cancelled\000"
+	"message cancelled\000"
+	"message cancelled\000"
+	"message cancelled\000"
+	"nothing to report\000"
+	"ice build-up on cable structure\000"
+	"road salted\000"
+	"danger of snow patches\000"
+	"snow patches\000"
+	"Convoy service required due to bad weather\000"
+	"(null message)\000"
+;
+
+inline constexpr TRDSTMCConstexprEvent ISO14819_2_ConstexprEvents[1552] = {
+	{0x0001, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 15, 0},
+	{0x0002, 4, 0, 1, false, false, false, 1, 0x10, 0x25, 0x28, true, 70, 16},
+	{0x000B, 0, 0, 1, false, true, false, 4, 0xFF, 0xFF, 0x00, false, 35, 87},
+	{0x000C, 0, 0, 1, false, false, false, 3, 0x00, 0x01, 0x04, true, 61, 123},
+	{0x0010, 0, 0, 1, false, false, false, 5, 0xFF, 0xFF, 0x00, false, 44, 185},
+	{0x0014, 0, 0, 0, false, false, false, 9, 0xFF, 0xFF, 0x00, false, 55, 230},
+	{0x0016, 0, 0, 0, true, false, false, 9, 0xFF, 0xFF, 0x00, false, 33, 286},
+	{0x0017, 0, 0, 0, true, false, false, 9, 0xFF, 0xFF, 0x00, false, 31, 320},
+	{0x0018, 0, 0, 1, true, false, false, 9, 0xFF, 0xFF, 0x00, false, 13, 352},
+	{0x0019, 0, 0, 1, true, false, false, 9, 0xFF, 0xFF, 0x00, false, 13, 366},
+	{0x001A, 0, 0, 1, false, false, false, 6, 0xFF, 0xFF, 0x00, false, 14, 380},
+	{0x001B, 0, 0, 1, false, false, false, 6, 0xFF, 0xFF, 0x00, false, 14, 395},
+	{0x001C, 0, 0, 1, false, false, false, 9, 0xFF, 0xFF, 0x00, false, 26, 410},
+	{0x0024, 0, 0, 0, false, true, false, 9, 0xFF, 0xFF, 0x00, false, 21, 437},
+	{0x0025, 0, 0, 0, false, true, false, 9, 0xFF, 0xFF, 0x00, false, 19, 459},
+	{0x0027, 7, 1, 0, true, true, true, 39, 0x1D, 0x1E, 0x21, true, 33, 479},
+	{0x0028, 0, 0, 0, true, true, true, 9, 0xFF, 0xFF, 0x00, false, 16, 513},
+	{0x0029, 0, 0, 0, true, false, false, 5, 0x00, 0x01, 0x04, true, 30, 530},
+	{0x002A, 0, 0, 1, false, false, false, 5, 0x00, 0x01, 0x04, true, 31, 561},
+	{0x0033, 0, 0, 0, true, false, false, 5, 0x0B, 0x0C, 0x0F, true, 41, 593},
+	{0x0034, 0, 0, 0, true, false, false, 11, 0x00, 0x01, 0x0C, true, 43, 635},
+	{0x0035, 0, 0, 0, true, false, false, 11, 0x00, 0x01, 0x0C, true, 44, 679},
+	{0x0037, 0, 1, 0, false, false, false, 2, 0xFF, 0xFF, 0x00, false, 24, 724},
+	{0x0038, 0, 1, 1, false, false, false, 2, 0xFF, 0xFF, 0x00, false, 27, 749},
+	{0x0039, 0, 1, 0, false, false, false, 2, 0xFF, 0xFF, 0x00, false, 23, 777},
+	{0x003D, 0, 0, 1, false, false, false, 12, 0x00, 0x01, 0x04, true, 25, 801},
+	{0x003E, 0, 0, 0, false, false, true, 12, 0x00, 0x01, 0x04, true, 18, 827},
+	{0x003F, 0, 0, 1, false, false, false, 12, 0x00, 0x01, 0x04, true, 34, 846},
+	{0x0040, 0, 0, 1, false, false, true, 12, 0xFF, 0xFF, 0x00, false, 18, 881},
+	{0x0046, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 44, 900},
+	{0x0047, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 44, 945},
+	{0x0048, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 44, 990},
+	{0x0049, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 44, 1035},
+	{0x004A, 0, 0, 0, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 44, 1080},
+	{0x004B, 0, 0, 0, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 44, 1125},
+	{0x004C, 0, 0, 0, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 44, 1170},
+	{0x0050, 0, 1, 0, true, false, false, 32, 0xFF, 0xFF, 0x00, false, 32, 1215},
+	{0x0051, 0, 1, 1, true, false, false, 32, 0xFF, 0xFF, 0x00, false, 37, 1248},
+	{0x0052, 0, 1, 0, true, false, false, 32, 0x00, 0x01, 0x0C, true, 56, 1286},
+	{0x0053, 0, 1, 1, true, false, false, 32, 0xFF, 0xFF, 0x00, false, 36, 1343},
+	{0x0054, 0, 1, 0, true, false, false, 32, 0xFF, 0xFF, 0x00, false, 45, 1380},
+	{0x0055, 0, 1, 0, true, false, false, 32, 0xFF, 0xFF, 0x00, false, 48, 1426},
+	{0x0056, 0, 1, 0, true, false, false, 32, 0xFF, 0xFF, 0x00, false, 38, 1475},
+	{0x0057, 0, 1, 0, true, false, false, 32, 0xFF, 0xFF, 0x00, false, 44, 1514},
+	{0x0058, 0, 1, 0, true, true, false, 32, 0xFF, 0xFF, 0x00, false, 37, 1559},
+	{0x0059, 0, 2, 0, false, false, false, 32, 0xFF, 0xFF, 0x00, false, 17, 1597},
+	{0x005B, 5, 0, 0, false, false, false, 20, 0x07, 0x08, 0x0B, true, 20, 1615},
+	{0x0065, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 18, 1636},
+	{0x0066, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 27, 1655},
+	{0x0067, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 27, 1683},
+	{0x0068, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 27, 1711},
+	{0x0069, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 27, 1739},
+	{0x006A, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 28, 1767},
+	{0x006B, 0, 1, 1, false, false, false, 2, 0xFF, 0xFF, 0x00, false, 27, 1796},
+	{0x006C, 4, 0, 1, false, false, false, 1, 0x10, 0x25, 0x28, true, 40, 1824},
+	{0x006D, 4, 0, 1, false, false, false, 1, 0x19, 0x2E, 0x31, true, 49, 1865},
+	{0x006E, 4, 0, 1, false, false, false, 1, 0x19, 0x2E, 0x31, true, 49, 1915},
+	{0x006F, 4, 0, 1, false, false, false, 1, 0x19, 0x2E, 0x31, true, 49, 1965},
+	{0x0070, 4, 0, 1, false, false, false, 1, 0x19, 0x2E, 0x31, true, 49, 2015},
+	{0x0071, 4, 0, 1, false, false, false, 1, 0x1A, 0x2F, 0x32, true, 50, 2065},
+	{0x0072, 0, 1, 1, false, false, false, 2, 0xFF, 0xFF, 0x00, false, 24, 2116},
+	{0x0073, 4, 0, 1, false, false, false, 1, 0x0D, 0x22, 0x25, true, 37, 2141},
+	{0x0074, 4, 0, 1, false, false, false, 1, 0x16, 0x2B, 0x2E, true, 46, 2179},
+	{0x0075, 4, 0, 1, false, false, false, 1, 0x16, 0x2B, 0x2E, true, 46, 2226},
+	{0x0076, 4, 0, 1, false, false, false, 1, 0x16, 0x2B, 0x2E, true, 46, 2273},
+	{0x0077, 4, 0, 1, false, false, false, 1, 0x16, 0x2B, 0x2E, true, 46, 2320},
+	{0x0078, 4, 0, 1, false, false, false, 1, 0x17, 0x2C, 0x2F, true, 47, 2367},
+	{0x0079, 0, 1, 1, false, false, false, 2, 0xFF, 0xFF, 0x00, false, 21, 2415},
+	{0x007A, 4, 0, 0, false, false, false, 1, 0x0E, 0x23, 0x26, true, 38, 2437},
+	{0x007B, 0, 1, 0, false, false, false, 2, 0xFF, 0xFF, 0x00, false, 22, 2476},
+	{0x007C, 4, 0, 0, false, true, false, 1, 0x17, 0x2C, 0x2F, true, 47, 2499},
+	{0x007D, 4, 0, 0, false, false, false, 1, 0x14, 0x29, 0x2C, true, 44, 2547},
+	{0x007E, 0, 0, 0, false, true, false, 1, 0xFF, 0xFF, 0x00, false, 21, 2592},
+	{0x007F, 0, 0, 0, false, true, false, 1, 0xFF, 0xFF, 0x00, false, 26, 2614},
+	{0x0080, 0, 2, 0, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 17, 2641},
+	{0x0081, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 27, 2659},
+	{0x0082, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 28, 2687},
+	{0x0083, 4, 0, 1, false, false, false, 1, 0x19, 0x2E, 0x31, true, 49, 2716},
+	{0x0084, 4, 0, 1, false, false, false, 1, 0x1A, 0x2F, 0x32, true, 50, 2766},
+	{0x0085, 4, 0, 1, false, false, false, 1, 0x0C, 0x21, 0x24, true, 36, 2817},
+	{0x0086, 4, 0, 1, false, false, false, 1, 0x16, 0x2B, 0x2E, true, 46, 2854},
+	{0x0087, 0, 0, 0, false, true, false, 1, 0xFF, 0xFF, 0x00, false, 14, 2901},
+	{0x0088, 4, 0, 0, false, false, false, 1, 0x13, 0x28, 0x2B, true, 43, 2916},
+	{0x0089, 4, 0, 0, false, false, false, 1, 0x1C, 0x31, 0x34, true, 52, 2960},
+	{0x008A, 4, 0, 1, false, false, false, 1, 0x10, 0x25, 0x28, true, 60, 3013},
+	{0x008B, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 41, 3074},
+	{0x008C, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 40, 3116},
+	{0x008D, 0, 0, 0, false, true, false, 3, 0xFF, 0xFF, 0x00, false, 44, 3157},
+	{0x008E, 4, 0, 0, false, false, false, 1, 0x1C, 0x31, 0x34, true, 52, 3202},
+	{0x008F, 4, 0, 0, false, false, false, 1, 0x26, 0x3B, 0x3E, true, 62, 3255},
+	{0x00C8, 5, 0, 1, false, false, false, 20, 0x1E, 0x1F, 0x22, true, 34, 3318},
+	{0x00C9, 0, 0, 0, false, true, false, 3, 0x00, 0x01, 0x04, true, 16, 3353},
+	{0x00CA, 0, 0, 1, false, true, false, 3, 0x00, 0x01, 0x04, true, 24, 3370},
+	{0x00CB, 0, 0, 1, false, true, false, 3, 0x17, 0x22, 0x2E, true, 46, 3395},
+	{0x00CC, 0, 0, 1, false, true, false, 3, 0x13, 0x16, 0x19, true, 43, 3442},
+	{0x00CD, 0, 0, 1, false, true, false, 3, 0x00, 0x01, 0x04, true, 46, 3486},
+	{0x00CE, 0, 0, 1, false, true, false, 3, 0x00, 0x01, 0x04, true, 30, 3533},
+	{0x00CF, 0, 0, 1, false, true, false, 3, 0x00, 0x01, 0x04, true, 34, 3564},
+	{0x00D0, 0, 0, 0, false, true, false, 1, 0x1C, 0x1D, 0x20, true, 44, 3599},
+	{0x00D1, 0, 0, 0, false, true, false, 3, 0x00, 0x01, 0x04, true, 38, 3644},
+	{0x00D2, 0, 0, 0, false, false, false, 12, 0x00, 0x01, 0x04, true, 17, 3683},
+	{0x00D3, 0, 0, 0, false, true, false, 4, 0x00, 0x01, 0x04, true, 27, 3701},
+	{0x00D4, 0, 0, 0, false, true, false, 4, 0x00, 0x01, 0x04, true, 34, 3729},
+	{0x00D5, 0, 0, 0, false, true, false, 3, 0x00, 0x01, 0x04, true, 20, 3764},
+	{0x00D6, 0, 0, 0, false, true, false, 4, 0x00, 0x01, 0x04, true, 16, 3785},
+	{0x00D7, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 36, 3802},
+	{0x00D8, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 45, 3839},
+	{0x00D9, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 45, 3885},
+	{0x00DA, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 45, 3931},
+	{0x00DB, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 45, 3977},
+	{0x00DC, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 46, 4023},
+	{0x00DD, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 46, 4070},
+	{0x00DE, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 33, 4117},
+	{0x00DF, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 42, 4151},
+	{0x00E0, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 42, 4194},
+	{0x00E1, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 42, 4237},
+	{0x00E2, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 42, 4280},
+	{0x00E3, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 43, 4323},
+	{0x00E4, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 43, 4367},
+	{0x00E5, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 30, 4411},
+	{0x00E6, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 39, 4442},
+	{0x00E7, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 39, 4482},
+	{0x00E8, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 39, 4522},
+	{0x00E9, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 39, 4562},
+	{0x00EA, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 40, 4602},
+	{0x00EB, 0, 1, 1, false, false, false, 2, 0x00, 0x01, 0x04, true, 39, 4643},
+	{0x00EC, 0, 0, 0, false, false, false, 1, 0x00, 0x01, 0x04, true, 31, 4683},
+	{0x00ED, 0, 1, 0, false, false, false, 2, 0x00, 0x01, 0x04, true, 40, 4715},
+	{0x00EE, 0, 0, 0, false, true, false, 1, 0x00, 0x01, 0x04, true, 40, 4756},
+	{0x00EF, 0, 0, 0, false, false, false, 1, 0x00, 0x01, 0x04, true, 37, 4797},
+	{0x00F0, 0, 0, 1, false, false, false, 5, 0x13, 0x14, 0x17, true, 35, 4835},
+	{0x00F1, 0, 0, 1, false, false, false, 5, 0x00, 0x01, 0x04, true, 36, 4871},
+	{0x00F2, 0, 0, 1, false, false, false, 5, 0x00, 0x01, 0x04, true, 37, 4908},
+	{0x00F3, 0, 0, 1, false, false, false, 5, 0x00, 0x01, 0x04, true, 35, 4946},
+	{0x00F4, 0, 0, 1, false, false, false, 5, 0x00, 0x01, 0x04, true, 39, 4982},
+	{0x00F5, 0, 0, 1, false, false, false, 5, 0x00, 0x01, 0x04, true, 35, 5022},
+	{0x00F6, 0, 0, 1, false, false, false, 5, 0x00, 0x01, 0x04, true, 37, 5058},
+	{0x00F7, 5, 0, 0, false, false, false, 20, 0x11, 0x12, 0x15, true, 21, 5096},
+	{0x00F8, 5, 1, 0, false, false, false, 20, 0x11, 0x12, 0x15, true, 30, 5118},
+	{0x00F9, 5, 0, 1, false, false, false, 20, 0x16, 0x17, 0x1A, true, 26, 5149},
+	{0x00FA, 0, 0, 1, false, false, false, 1, 0x1C, 0x1D, 0x20, true, 64, 5176},
+	{0x00FB, 0, 0, 1, false, false, false, 1, 0x1C, 0x1D, 0x20, true, 73, 5241},
+	{0x00FC, 0, 0, 1, false, false, false, 1, 0x1C, 0x1D, 0x20, true, 73, 5315},
+	{0x00FD, 0, 0, 1, false, false, false, 1, 0x1C, 0x1D, 0x20, true, 73, 5389},
+	{0x00FE, 0, 0, 1, false, false, false, 1, 0x1C, 0x1D, 0x20, true, 73, 5463},
+	{0x00FF, 0, 0, 1, false, false, false, 1, 0x1C, 0x1D, 0x20, true, 74, 5537},
+	{0x0100, 0, 0, 1, false, false, false, 1, 0x1C, 0x1D, 0x20, true, 74, 5612},
+	{0x0101, 0, 0, 1, false, false, false, 1, 0x1C, 0x1D, 0x20, true, 61, 5687},
+	{0x0102, 0, 0, 1, false, false, false, 1, 0x1C, 0x1D, 0x20, true, 70, 5749},
+	{0x0103, 0, 0, 1, false, false, false, 1, 0x1C, 0x1D, 0x20, true, 70, 5820},
+	{0x0104, 0, 0, 1, false, false, false, 1, 0x1C, 0x1D, 0x20, true, 70, 5891},
+	{0x0105, 0, 0, 1, false, false, false, 1, 0x1C, 0x1D, 0x20, true, 70, 5962},
+	{0x0106, 0, 0, 1, false, false, false, 1, 0x1C, 0x1D, 0x20, true, 71, 6033},
+	{0x0107, 0, 0, 1, false, false, false, 1, 0x1C, 0x1D, 0x20, true, 71, 6105},
+	{0x0108, 0, 0, 1, false, false, false, 1, 0x1C, 0x1D, 0x20, true, 58, 6177},
+	{0x0109, 0, 0, 1, false, false, false, 1, 0x1C, 0x1D, 0x20, true, 67, 6236},
+	{0x010A, 0, 0, 1, false, false, false, 1, 0x1C, 0x1D, 0x20, true, 67, 6304},
+	{0x010B, 0, 0, 1, false, false, false, 1, 0x1C, 0x1D, 0x20, true, 67, 6372},
+	{0x010C, 0, 0, 1, false, false, false, 1, 0x1C, 0x1D, 0x20, true, 67, 6440},
+	{0x010D, 0, 0, 1, false, false, false, 1, 0x1C, 0x1D, 0x20, true, 68, 6508},
+	{0x010E, 0, 1, 1, false, false, false, 2, 0x1C, 0x1D, 0x20, true, 67, 6577},
+	{0x010F, 0, 0, 0, false, false, false, 1, 0x1C, 0x1D, 0x20, true, 59, 6645},
+	{0x0110, 0, 1, 0, false, false, false, 2, 0x1C, 0x1D, 0x20, true, 68, 6705},
+	{0x0112, 0, 0, 0, false, false, false, 1, 0x1C, 0x1D, 0x20, true, 65, 6774},
+	{0x0113, 5, 0, 1, false, false, false, 20, 0x2D, 0x2E, 0x31, true, 49, 6840},
+	{0x0114, 5, 1, 1, false, false, false, 20, 0x2D, 0x2E, 0x31, true, 58, 6890},
+	{0x0115, 5, 0, 1, false, false, false, 20, 0x32, 0x33, 0x36, true, 54, 6949},
+	{0x0116, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 37, 7004},
+	{0x0117, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 46, 7042},
+	{0x0118, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 46, 7089},
+	{0x0119, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 46, 7136},
+	{0x011A, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 46, 7183},
+	{0x011B, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 47, 7230},
+	{0x011C, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 47, 7278},
+	{0x011D, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 34, 7326},
+	{0x011E, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 43, 7361},
+	{0x011F, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 43, 7405},
+	{0x0120, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 43, 7449},
+	{0x0121, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 43, 7493},
+	{0x0122, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 44, 7537},
+	{0x0123, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 44, 7582},
+	{0x0124, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 31, 7627},
+	{0x0125, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 40, 7659},
+	{0x0126, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 40, 7700},
+	{0x0127, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 40, 7741},
+	{0x0128, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 40, 7782},
+	{0x0129, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 41, 7823},
+	{0x012A, 0, 1, 1, false, false, false, 2, 0x00, 0x01, 0x04, true, 40, 7865},
+	{0x012B, 0, 0, 0, false, false, false, 1, 0x00, 0x01, 0x04, true, 32, 7906},
+	{0x012C, 0, 1, 0, false, false, false, 2, 0x00, 0x01, 0x04, true, 41, 7939},
+	{0x012D, 0, 0, 0, false, true, false, 1, 0x00, 0x01, 0x04, true, 41, 7981},
+	{0x012E, 0, 0, 0, false, false, false, 1, 0x00, 0x01, 0x04, true, 38, 8023},
+	{0x012F, 0, 0, 1, false, false, false, 5, 0x0B, 0x0C, 0x0F, true, 28, 8062},
+	{0x0130, 0, 0, 1, false, false, false, 5, 0x00, 0x01, 0x04, true, 37, 8091},
+	{0x0131, 0, 0, 1, false, false, false, 5, 0x00, 0x01, 0x04, true, 38, 8129},
+	{0x0132, 0, 0, 1, false, false, false, 5, 0x00, 0x01, 0x04, true, 36, 8168},
+	{0x0133, 0, 0, 1, false, false, false, 5, 0x00, 0x01, 0x04, true, 40, 8205},
+	{0x0134, 0, 0, 1, false, false, false, 5, 0x00, 0x01, 0x04, true, 36, 8246},
+	{0x0135, 0, 0, 1, false, false, false, 5, 0x00, 0x01, 0x04, true, 38, 8283},
+	{0x0136, 5, 0, 0, false, false, false, 20, 0x12, 0x13, 0x16, true, 22, 8322},
+	{0x0137, 5, 1, 0, false, false, false, 20, 0x12, 0x13, 0x16, true, 31, 8345},
+	{0x0138, 5, 0, 1, false, false, false, 20, 0x17, 0x18, 0x1B, true, 27, 8377},
+	{0x0139, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 47, 8405},
+	{0x013A, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 57, 8453},
+	{0x013B, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 44, 8511},
+	{0x013C, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 54, 8556},
+	{0x013D, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 41, 8611},
+	{0x013E, 0, 1, 1, false, false, false, 2, 0x00, 0x01, 0x04, true, 50, 8653},
+	{0x013F, 0, 0, 0, false, false, false, 1, 0x00, 0x01, 0x04, true, 42, 8704},
+	{0x0140, 0, 1, 0, false, false, false, 2, 0x00, 0x01, 0x04, true, 51, 8747},
+	{0x0141, 0, 0, 0, false, true, false, 1, 0x00, 0x01, 0x04, true, 51, 8799},
+	{0x0142, 0, 0, 0, false, false, false, 1, 0x00, 0x01, 0x04, true, 47, 8851},
+	{0x0143, 0, 0, 1, false, false, false, 5, 0x0B, 0x0C, 0x0F, true, 39, 8899},
+	{0x0144, 0, 0, 1, false, false, false, 5, 0x00, 0x01, 0x04, true, 47, 8939},
+	{0x0145, 0, 0, 1, false, false, false, 5, 0x00, 0x01, 0x04, true, 48, 8987},
+	{0x0146, 0, 0, 1, false, false, false, 5, 0x00, 0x01, 0x04, true, 46, 9036},
+	{0x0147, 0, 0, 1, false, false, false, 5, 0x00, 0x01, 0x04, true, 50, 9083},
+	{0x0148, 0, 0, 1, false, false, false, 5, 0x00, 0x01, 0x04, true, 46, 9134},
+	{0x0149, 0, 0, 1, false, false, false, 5, 0x00, 0x01, 0x04, true, 48, 9181},
+	{0x014A, 5, 0, 0, false, false, false, 20, 0x1C, 0x1D, 0x20, true, 32, 9230},
+	{0x014B, 5, 1, 0, false, false, false, 20, 0x1C, 0x1D, 0x20, true, 41, 9263},
+	{0x014C, 5, 0, 1, false, false, false, 20, 0x21, 0x22, 0x25, true, 37, 9305},
+	{0x014D, 0, 0, 0, false, true, false, 3, 0xFF, 0xFF, 0x00, false, 16, 9343},
+	{0x014E, 0, 2, 0, false, false, false, 3, 0xFF, 0xFF, 0x00, false, 17, 9360},
+	{0x014F, 0, 0, 1, false, true, false, 3, 0x13, 0x16, 0x19, true, 33, 9378},
+	{0x0150, 0, 0, 1, false, true, false, 3, 0x00, 0x01, 0x04, true, 29, 9412},
+	{0x0151, 0, 0, 0, false, true, false, 3, 0x00, 0x01, 0x04, true, 26, 9442},
+	{0x0152, 0, 0, 1, false, true, false, 3, 0x00, 0x01, 0x04, true, 33, 9469},
+	{0x0153, 0, 0, 1, false, true, false, 3, 0x00, 0x01, 0x04, true, 26, 9503},
+	{0x0154, 0, 0, 1, false, true, false, 3, 0x00, 0x01, 0x04, true, 26, 9530},
+	{0x0155, 0, 0, 1, false, true, false, 3, 0x00, 0x01, 0x04, true, 39, 9557},
+	{0x0156, 0, 0, 0, false, true, false, 3, 0x00, 0x01, 0x04, true, 27, 9597},
+	{0x0157, 0, 0, 0, false, true, false, 3, 0x00, 0x01, 0x04, true, 24, 9625},
+	{0x0158, 0, 0, 0, false, false, false, 3, 0xFF, 0xFF, 0x00, false, 27, 9650},
+	{0x0159, 0, 0, 0, false, true, false, 3, 0x00, 0x01, 0x04, true, 26, 9678},
+	{0x015A, 0, 0, 0, false, true, false, 4, 0x00, 0x01, 0x04, true, 24, 9705},
+	{0x015B, 0, 0, 0, false, false, false, 24, 0x00, 0x01, 0x04, true, 26, 9730},
+	{0x015C, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 45, 9757},
+	{0x015D, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 42, 9803},
+	{0x015E, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 39, 9846},
+	{0x015F, 0, 0, 1, false, true, false, 3, 0x00, 0x01, 0x04, true, 34, 9886},
+	{0x0160, 0, 0, 1, false, false, false, 1, 0x1C, 0x1D, 0x20, true, 73, 9921},
+	{0x0161, 0, 0, 1, false, false, false, 1, 0x1C, 0x1D, 0x20, true, 70, 9995},
+	{0x0162, 0, 0, 1, false, false, false, 1, 0x1C, 0x1D, 0x20, true, 67, 10066},
+	{0x0163, 0, 0, 1, false, true, false, 1, 0x1C, 0x1D, 0x20, true, 52, 10134},
+	{0x0164, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 46, 10187},
+	{0x0165, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 43, 10234},
+	{0x0166, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 40, 10278},
+	{0x0167, 0, 0, 1, false, false, false, 12, 0x00, 0x01, 0x04, true, 25, 10319},
+	{0x0168, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 46, 10345},
+	{0x0169, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 56, 10392},
+	{0x016A, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 43, 10449},
+	{0x016B, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 53, 10493},
+	{0x016C, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 40, 10547},
+	{0x016D, 0, 1, 1, false, false, false, 2, 0x00, 0x01, 0x04, true, 49, 10588},
+	{0x016E, 0, 0, 0, false, false, false, 1, 0x00, 0x01, 0x04, true, 41, 10638},
+	{0x016F, 0, 1, 0, false, false, false, 2, 0x00, 0x01, 0x04, true, 50, 10680},
+	{0x0170, 0, 0, 0, false, false, false, 1, 0x00, 0x01, 0x04, true, 47, 10731},
+	{0x0171, 0, 0, 1, false, false, false, 5, 0x0B, 0x0C, 0x0F, true, 37, 10779},
+	{0x0172, 0, 0, 1, false, false, false, 5, 0x00, 0x01, 0x04, true, 46, 10817},
+	{0x0173, 0, 0, 1, false, false, false, 5, 0x00, 0x01, 0x04, true, 47, 10864},
+	{0x0174, 0, 0, 1, false, false, false, 5, 0x00, 0x01, 0x04, true, 45, 10912},
+	{0x0175, 0, 0, 1, false, false, false, 5, 0x00, 0x01, 0x04, true, 45, 10958},
+	{0x0176, 0, 0, 1, false, false, false, 5, 0x00, 0x01, 0x04, true, 47, 11004},
+	{0x0177, 5, 0, 0, false, false, false, 20, 0x1B, 0x1C, 0x1F, true, 31, 11052},
+	{0x0178, 5, 1, 0, false, false, false, 20, 0x1B, 0x1C, 0x1F, true, 40, 11084},
+	{0x0179, 5, 0, 1, false, false, false, 20, 0x20, 0x21, 0x24, true, 36, 11125},
+	{0x017A, 0, 0, 1, false, true, false, 3, 0x00, 0x01, 0x04, true, 34, 11162},
+	{0x017B, 0, 0, 1, false, false, false, 1, 0x1A, 0x1B, 0x1E, true, 50, 11197},
+	{0x017C, 0, 0, 1, false, false, false, 1, 0x24, 0x25, 0x28, true, 60, 11248},
+	{0x017D, 0, 0, 1, false, false, false, 1, 0x17, 0x18, 0x1B, true, 47, 11309},
+	{0x017E, 0, 0, 1, false, false, false, 1, 0x21, 0x22, 0x25, true, 57, 11357},
+	{0x017F, 0, 0, 1, false, false, false, 1, 0x14, 0x15, 0x18, true, 44, 11415},
+	{0x0181, 0, 0, 0, false, false, false, 1, 0x15, 0x16, 0x19, true, 45, 11460},
+	{0x0183, 0, 0, 0, false, false, false, 1, 0x1B, 0x1C, 0x1F, true, 51, 11506},
+	{0x0184, 5, 0, 0, false, false, false, 20, 0x07, 0x08, 0x0B, true, 35, 11558},
+	{0x0186, 5, 0, 1, false, false, false, 20, 0x0C, 0x0D, 0x10, true, 40, 11594},
+	{0x0187, 0, 0, 1, false, false, false, 3, 0xFF, 0xFF, 0x00, false, 35, 11635},
+	{0x0188, 0, 0, 1, false, true, false, 3, 0x00, 0x01, 0x04, true, 34, 11671},
+	{0x0189, 0, 0, 1, false, true, false, 4, 0x00, 0x01, 0x04, true, 35, 11706},
+	{0x018A, 0, 0, 1, false, true, false, 4, 0x00, 0x01, 0x04, true, 42, 11742},
+	{0x018B, 0, 0, 0, false, true, false, 4, 0xFF, 0xFF, 0x00, false, 12, 11785},
+	{0x018C, 0, 0, 0, false, true, false, 4, 0xFF, 0xFF, 0x00, false, 16, 11798},
+	{0x018D, 0, 0, 1, false, false, false, 4, 0xFF, 0xFF, 0x00, false, 36, 11815},
+	{0x018F, 0, 2, 0, false, false, false, 8, 0xFF, 0xFF, 0x00, false, 17, 11852},
+	{0x0191, 0, 0, 1, true, false, false, 5, 0xFF, 0xFF, 0x00, false, 6, 11870},
+	{0x0192, 0, 0, 1, false, false, false, 5, 0xFF, 0xFF, 0x00, false, 7, 11877},
+	{0x0193, 8, 0, 1, true, false, false, 9, 0x1A, 0x20, 0x23, true, 35, 11885},
+	{0x0194, 8, 0, 1, true, false, false, 9, 0x25, 0x2B, 0x2E, true, 46, 11921},
+	{0x0195, 0, 0, 1, true, false, false, 9, 0xFF, 0xFF, 0x00, false, 18, 11968},
+	{0x0196, 0, 0, 1, true, false, false, 8, 0x00, 0x01, 0x07, true, 30, 11987},
+	{0x0197, 0, 0, 1, true, false, false, 7, 0x00, 0x01, 0x07, true, 29, 12018},
+	{0x0198, 0, 0, 1, true, false, false, 7, 0xFF, 0xFF, 0x00, false, 17, 12048},
+	{0x0199, 0, 0, 0, true, false, false, 7, 0xFF, 0xFF, 0x00, false, 22, 12066},
+	{0x019A, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 32, 12089},
+	{0x019B, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 41, 12122},
+	{0x019C, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 41, 12164},
+	{0x019D, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 41, 12206},
+	{0x019E, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 41, 12248},
+	{0x019F, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 42, 12290},
+	{0x01A0, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 42, 12333},
+	{0x01A1, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 29, 12376},
+	{0x01A2, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 38, 12406},
+	{0x01A3, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 38, 12445},
+	{0x01A4, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 38, 12484},
+	{0x01A5, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 38, 12523},
+	{0x01A6, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 39, 12562},
+	{0x01A7, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 39, 12602},
+	{0x01A8, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 26, 12642},
+	{0x01A9, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 35, 12669},
+	{0x01AA, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 35, 12705},
+	{0x01AB, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 35, 12741},
+	{0x01AC, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 35, 12777},
+	{0x01AD, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 36, 12813},
+	{0x01AE, 0, 1, 1, false, false, false, 2, 0xFF, 0xFF, 0x00, false, 35, 12850},
+	{0x01AF, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 27, 12886},
+	{0x01B0, 0, 1, 1, false, false, false, 2, 0xFF, 0xFF, 0x00, false, 36, 12914},
+	{0x01B1, 0, 0, 1, false, true, false, 1, 0xFF, 0xFF, 0x00, false, 36, 12951},
+	{0x01B2, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 33, 12988},
+	{0x01B3, 5, 0, 1, false, false, false, 20, 0x15, 0x16, 0x19, true, 25, 13022},
+	{0x01B4, 5, 1, 1, false, false, false, 20, 0x15, 0x16, 0x19, true, 34, 13048},
+	{0x01B5, 5, 0, 1, false, false, false, 20, 0x1A, 0x1B, 0x1E, true, 30, 13083},
+	{0x01B6, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 33, 13114},
+	{0x01B7, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 42, 13148},
+	{0x01B8, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 42, 13191},
+	{0x01B9, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 42, 13234},
+	{0x01BA, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 42, 13277},
+	{0x01BB, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 43, 13320},
+	{0x01BC, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 43, 13364},
+	{0x01BD, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 30, 13408},
+	{0x01BE, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 39, 13439},
+	{0x01BF, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 39, 13479},
+	{0x01C0, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 39, 13519},
+	{0x01C1, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 39, 13559},
+	{0x01C2, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 40, 13599},
+	{0x01C3, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 40, 13640},
+	{0x01C4, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 27, 13681},
+	{0x01C5, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 36, 13709},
+	{0x01C6, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 36, 13746},
+	{0x01C7, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 36, 13783},
+	{0x01C8, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 36, 13820},
+	{0x01C9, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 37, 13857},
+	{0x01CA, 0, 1, 1, false, false, false, 2, 0xFF, 0xFF, 0x00, false, 36, 13895},
+	{0x01CB, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 28, 13932},
+	{0x01CC, 0, 1, 1, false, false, false, 2, 0xFF, 0xFF, 0x00, false, 37, 13961},
+	{0x01CD, 0, 0, 1, false, true, false, 1, 0xFF, 0xFF, 0x00, false, 37, 13999},
+	{0x01CE, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 34, 14037},
+	{0x01CF, 5, 0, 1, false, false, false, 20, 0x16, 0x17, 0x1A, true, 26, 14072},
+	{0x01D0, 5, 1, 1, false, false, false, 20, 0x16, 0x17, 0x1A, true, 35, 14099},
+	{0x01D1, 5, 0, 1, false, false, false, 20, 0x1B, 0x1C, 0x1F, true, 31, 14135},
+	{0x01D2, 0, 0, 0, true, true, false, 7, 0xFF, 0xFF, 0x00, false, 19, 14167},
+	{0x01D3, 0, 0, 0, false, true, false, 5, 0xFF, 0xFF, 0x00, false, 8, 14187},
+	{0x01D4, 0, 2, 0, false, false, false, 9, 0xFF, 0xFF, 0x00, false, 17, 14196},
+	{0x01D5, 0, 0, 1, true, false, false, 9, 0xFF, 0xFF, 0x00, false, 12, 14214},
+	{0x01D6, 0, 0, 1, false, false, false, 9, 0xFF, 0xFF, 0x00, false, 13, 14227},
+	{0x01D7, 0, 0, 1, true, false, false, 8, 0x00, 0x01, 0x04, true, 30, 14241},
+	{0x01D8, 0, 0, 1, false, false, false, 8, 0x00, 0x01, 0x07, true, 31, 14272},
+	{0x01D9, 0, 0, 1, false, false, false, 8, 0xFF, 0xFF, 0x00, false, 13, 14304},
+	{0x01DA, 0, 0, 1, true, false, false, 7, 0x00, 0x01, 0x04, true, 29, 14318},
+	{0x01DB, 0, 0, 1, false, false, false, 7, 0x00, 0x01, 0x07, true, 30, 14348},
+	{0x01DC, 0, 0, 1, false, false, false, 7, 0xFF, 0xFF, 0x00, false, 12, 14379},
+	{0x01DD, 0, 0, 1, false, false, false, 7, 0xFF, 0xFF, 0x00, false, 18, 14392},
+	{0x01DE, 0, 0, 1, true, false, false, 7, 0xFF, 0xFF, 0x00, false, 29, 14411},
+	{0x01DF, 0, 0, 1, true, false, false, 6, 0xFF, 0xFF, 0x00, false, 27, 14441},
+	{0x01E0, 0, 0, 1, true, false, false, 6, 0xFF, 0xFF, 0x00, false, 38, 14469},
+	{0x01E1, 0, 0, 1, true, false, false, 6, 0xFF, 0xFF, 0x00, false, 37, 14508},
+	{0x01E2, 0, 0, 1, true, false, false, 6, 0xFF, 0xFF, 0x00, false, 20, 14546},
+	{0x01E3, 0, 0, 1, true, false, false, 6, 0xFF, 0xFF, 0x00, false, 28, 14567},
+	{0x01E4, 0, 0, 1, true, false, false, 6, 0xFF, 0xFF, 0x00, false, 18, 14596},
+	{0x01E5, 0, 0, 1, false, false, false, 7, 0xFF, 0xFF, 0x00, false, 30, 14615},
+	{0x01E6, 0, 0, 1, false, false, false, 6, 0xFF, 0xFF, 0x00, false, 28, 14646},
+	{0x01E7, 0, 0, 1, false, false, false, 6, 0xFF, 0xFF, 0x00, false, 39, 14675},
+	{0x01E8, 0, 0, 1, false, false, false, 6, 0xFF, 0xFF, 0x00, false, 38, 14715},
+	{0x01E9, 0, 0, 1, false, false, false, 6, 0xFF, 0xFF, 0x00, false, 21, 14754},
+	{0x01EA, 0, 0, 1, false, false, false, 6, 0xFF, 0xFF, 0x00, false, 29, 14776},
+	{0x01EB, 0, 0, 1, false, false, false, 6, 0xFF, 0xFF, 0x00, false, 19, 14806},
+	{0x01EC, 0, 0, 1, true, false, true, 9, 0xFF, 0xFF, 0x00, false, 17, 14826},
+	{0x01ED, 0, 0, 0, true, false, false, 9, 0xFF, 0xFF, 0x00, false, 12, 14844},
+	{0x01EE, 8, 0, 1, true, false, false, 9, 0x19, 0x1F, 0x22, true, 34, 14857},
+	{0x01EF, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 41, 14892},
+	{0x01F0, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 38, 14934},
+	{0x01F1, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 35, 14973},
+	{0x01F2, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 42, 15009},
+	{0x01F3, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 39, 15052},
+	{0x01F4, 0, 0, 0, true, false, false, 5, 0x00, 0x01, 0x04, true, 19, 15092},
+	{0x01F5, 0, 0, 0, true, false, false, 5, 0x00, 0x01, 0x04, true, 25, 15112},
+	{0x01F6, 0, 0, 0, true, false, false, 5, 0x00, 0x01, 0x04, true, 26, 15138},
+	{0x01F7, 0, 0, 0, true, false, false, 5, 0x00, 0x01, 0x04, true, 24, 15165},
+	{0x01F8, 0, 0, 0, true, false, false, 5, 0xFF, 0xFF, 0x00, false, 20, 15190},
+	{0x01F9, 0, 0, 0, true, false, false, 5, 0xFF, 0xFF, 0x00, false, 16, 15211},
+	{0x01FA, 0, 0, 0, true, false, false, 5, 0xFF, 0xFF, 0x00, false, 18, 15228},
+	{0x01FB, 0, 0, 1, false, false, false, 5, 0x00, 0x01, 0x04, true, 26, 15247},
+	{0x01FC, 0, 0, 1, false, false, false, 5, 0x00, 0x01, 0x04, true, 27, 15274},
+	{0x01FD, 0, 0, 1, false, false, false, 5, 0x00, 0x01, 0x04, true, 25, 15302},
+	{0x01FE, 0, 0, 0, false, false, false, 5, 0xFF, 0xFF, 0x00, false, 21, 15328},
+	{0x01FF, 0, 0, 1, false, false, false, 5, 0xFF, 0xFF, 0x00, false, 17, 15350},
+	{0x0200, 0, 0, 1, false, false, false, 5, 0xFF, 0xFF, 0x00, false, 19, 15368},
+	{0x0201, 0, 0, 0, true, false, true, 5, 0xFF, 0xFF, 0x00, false, 29, 15388},
+	{0x0202, 0, 0, 0, true, false, false, 5, 0x14, 0x1A, 0x23, true, 47, 15418},
+	{0x0203, 0, 0, 0, true, false, false, 5, 0x14, 0x1A, 0x23, true, 48, 15466},
+	{0x0204, 0, 0, 0, true, false, false, 5, 0x14, 0x1A, 0x23, true, 50, 15515},
+	{0x0205, 0, 0, 0, true, false, true, 5, 0xFF, 0xFF, 0x00, false, 10, 15566},
+	{0x0206, 0, 0, 0, true, false, false, 5, 0xFF, 0xFF, 0x00, false, 12, 15577},
+	{0x0207, 0, 0, 0, true, false, true, 5, 0xFF, 0xFF, 0x00, false, 28, 15590},
+	{0x0208, 0, 0, 1, false, false, false, 5, 0x00, 0x01, 0x04, true, 20, 15619},
+	{0x0209, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 37, 15640},
+	{0x020A, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 46, 15678},
+	{0x020B, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 46, 15725},
+	{0x020C, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 46, 15772},
+	{0x020D, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 46, 15819},
+	{0x020E, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 47, 15866},
+	{0x020F, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 47, 15914},
+	{0x0210, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 34, 15962},
+	{0x0211, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 43, 15997},
+	{0x0212, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 43, 16041},
+	{0x0213, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 43, 16085},
+	{0x0214, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 43, 16129},
+	{0x0215, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 44, 16173},
+	{0x0216, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 44, 16218},
+	{0x0217, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 31, 16263},
+	{0x0218, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 40, 16295},
+	{0x0219, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 40, 16336},
+	{0x021A, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 40, 16377},
+	{0x021B, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 40, 16418},
+	{0x021C, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 41, 16459},
+	{0x021D, 0, 1, 1, false, false, false, 2, 0x00, 0x01, 0x04, true, 40, 16501},
+	{0x021E, 0, 0, 0, false, false, false, 1, 0x00, 0x01, 0x04, true, 32, 16542},
+	{0x021F, 0, 1, 0, false, false, false, 2, 0x00, 0x01, 0x04, true, 41, 16575},
+	{0x0220, 0, 0, 0, false, true, false, 1, 0x00, 0x01, 0x04, false, 40, 16617},
+	{0x0221, 0, 0, 0, false, false, false, 1, 0x00, 0x01, 0x04, false, 37, 16658},
+	{0x0222, 0, 0, 1, false, false, false, 1, 0x14, 0x1A, 0x23, true, 67, 16696},
+	{0x0223, 0, 0, 1, false, false, false, 1, 0x14, 0x1A, 0x23, true, 77, 16764},
+	{0x0224, 0, 0, 1, false, false, false, 1, 0x14, 0x1A, 0x23, true, 64, 16842},
+	{0x0225, 0, 0, 1, false, false, false, 1, 0x14, 0x1A, 0x23, true, 74, 16907},
+	{0x0226, 0, 0, 1, false, false, false, 1, 0x14, 0x1A, 0x23, true, 61, 16982},
+	{0x0227, 0, 1, 1, false, false, false, 2, 0x14, 0x1A, 0x23, true, 70, 17044},
+	{0x0228, 0, 0, 0, false, false, false, 1, 0x14, 0x1A, 0x23, true, 62, 17115},
+	{0x0229, 0, 1, 0, false, false, false, 2, 0x14, 0x1A, 0x23, true, 71, 17178},
+	{0x022A, 0, 0, 0, false, true, false, 1, 0x14, 0x1A, 0x23, true, 71, 17250},
+	{0x022B, 0, 0, 0, false, false, false, 1, 0x14, 0x1A, 0x23, true, 68, 17322},
+	{0x022C, 0, 0, 1, false, false, false, 1, 0x14, 0x1A, 0x23, true, 68, 17391},
+	{0x022D, 0, 0, 1, false, false, false, 1, 0x14, 0x1A, 0x23, true, 78, 17460},
+	{0x022E, 0, 0, 1, false, false, false, 1, 0x14, 0x1A, 0x23, true, 65, 17539},
+	{0x022F, 0, 0, 1, false, false, false, 1, 0x14, 0x1A, 0x23, true, 75, 17605},
+	{0x0230, 0, 0, 1, false, false, false, 1, 0x14, 0x1A, 0x23, true, 62, 17681},
+	{0x0231, 0, 1, 1, false, false, false, 2, 0x14, 0x1A, 0x23, true, 71, 17744},
+	{0x0232, 0, 0, 0, false, false, false, 1, 0x14, 0x1A, 0x23, true, 63, 17816},
+	{0x0233, 0, 1, 0, false, false, false, 2, 0x14, 0x1A, 0x23, true, 72, 17880},
+	{0x0234, 0, 0, 0, false, true, false, 1, 0x14, 0x1A, 0x23, true, 72, 17953},
+	{0x0235, 0, 0, 0, false, false, false, 1, 0x14, 0x1A, 0x23, true, 69, 18026},
+	{0x0236, 0, 0, 1, false, false, false, 1, 0x14, 0x1A, 0x23, true, 70, 18096},
+	{0x0237, 0, 0, 1, false, false, false, 1, 0x14, 0x1A, 0x23, true, 80, 18167},
+	{0x0238, 0, 0, 1, false, false, false, 1, 0x14, 0x1A, 0x23, true, 67, 18248},
+	{0x0239, 0, 0, 1, false, false, false, 1, 0x14, 0x1A, 0x23, true, 77, 18316},
+	{0x023A, 0, 0, 1, false, false, false, 1, 0x14, 0x1A, 0x23, true, 64, 18394},
+	{0x023B, 0, 1, 1, false, false, false, 2, 0x14, 0x1A, 0x23, true, 73, 18459},
+	{0x023C, 0, 0, 0, false, false, false, 1, 0x14, 0x1A, 0x23, true, 65, 18533},
+	{0x023D, 0, 1, 0, false, false, false, 2, 0x14, 0x1A, 0x23, true, 74, 18599},
+	{0x023E, 0, 0, 0, false, true, false, 1, 0x14, 0x1A, 0x23, true, 74, 18674},
+	{0x023F, 0, 0, 0, false, false, false, 1, 0x14, 0x1A, 0x23, true, 71, 18749},
+	{0x0240, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 30, 18821},
+	{0x0241, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 39, 18852},
+	{0x0242, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 39, 18892},
+	{0x0243, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 39, 18932},
+	{0x0244, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 39, 18972},
+	{0x0245, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 40, 19012},
+	{0x0246, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 40, 19053},
+	{0x0247, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 27, 19094},
+	{0x0248, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 36, 19122},
+	{0x0249, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 36, 19159},
+	{0x024A, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 36, 19196},
+	{0x024B, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 36, 19233},
+	{0x024C, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 37, 19270},
+	{0x024D, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 37, 19308},
+	{0x024E, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 24, 19346},
+	{0x024F, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 33, 19371},
+	{0x0250, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 33, 19405},
+	{0x0251, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 33, 19439},
+	{0x0252, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 33, 19473},
+	{0x0253, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 34, 19507},
+	{0x0254, 0, 1, 1, false, false, false, 2, 0xFF, 0xFF, 0x00, false, 33, 19542},
+	{0x0255, 0, 0, 0, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 25, 19576},
+	{0x0256, 0, 1, 0, false, false, false, 2, 0xFF, 0xFF, 0x00, false, 34, 19602},
+	{0x0257, 0, 0, 0, false, true, false, 1, 0xFF, 0xFF, 0x00, false, 34, 19637},
+	{0x0258, 0, 0, 0, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 31, 19672},
+	{0x0259, 0, 0, 0, true, false, false, 5, 0x20, 0x26, 0x2F, true, 59, 19704},
+	{0x025A, 0, 0, 0, true, false, false, 5, 0x20, 0x26, 0x2F, true, 60, 19764},
+	{0x025B, 0, 0, 0, true, false, false, 5, 0x20, 0x26, 0x2F, true, 62, 19825},
+	{0x025C, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 32, 19888},
+	{0x025D, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 42, 19921},
+	{0x025E, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 29, 19964},
+	{0x025F, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 39, 19994},
+	{0x0260, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 26, 20034},
+	{0x0261, 0, 1, 1, false, false, false, 2, 0xFF, 0xFF, 0x00, false, 35, 20061},
+	{0x0262, 0, 0, 0, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 27, 20097},
+	{0x0263, 0, 1, 0, false, false, false, 2, 0xFF, 0xFF, 0x00, false, 36, 20125},
+	{0x0264, 0, 0, 0, false, true, false, 1, 0xFF, 0xFF, 0x00, false, 36, 20162},
+	{0x0265, 0, 0, 0, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 33, 20199},
+	{0x0266, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 48, 20233},
+	{0x0267, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 78, 20282},
+	{0x0268, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 45, 20361},
+	{0x0269, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 55, 20407},
+	{0x026A, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 42, 20463},
+	{0x026B, 0, 1, 1, false, false, false, 2, 0xFF, 0xFF, 0x00, false, 51, 20506},
+	{0x026C, 0, 0, 0, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 43, 20558},
+	{0x026D, 0, 1, 0, false, false, false, 2, 0xFF, 0xFF, 0x00, false, 52, 20602},
+	{0x026E, 0, 0, 0, false, true, false, 1, 0xFF, 0xFF, 0x00, false, 52, 20655},
+	{0x026F, 0, 0, 0, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 49, 20708},
+	{0x0270, 0, 0, 0, true, true, false, 5, 0xFF, 0xFF, 0x00, false, 21, 20758},
+	{0x0271, 0, 2, 0, false, false, false, 5, 0xFF, 0xFF, 0x00, false, 17, 20780},
+	{0x0272, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 36, 20798},
+	{0x0273, 0, 0, 1, true, false, true, 9, 0xFF, 0xFF, 0x00, false, 46, 20835},
+	{0x0274, 0, 0, 1, true, false, true, 9, 0xFF, 0xFF, 0x00, false, 56, 20882},
+	{0x0275, 0, 0, 1, true, false, true, 9, 0xFF, 0xFF, 0x00, false, 55, 20939},
+	{0x0276, 0, 0, 0, true, false, false, 5, 0xFF, 0xFF, 0x00, false, 4, 20995},
+	{0x0277, 0, 0, 0, false, true, false, 5, 0xFF, 0xFF, 0x00, false, 12, 21000},
+	{0x0278, 0, 0, 0, true, true, false, 8, 0xFF, 0xFF, 0x00, false, 14, 21013},
+	{0x0279, 0, 0, 0, true, true, false, 7, 0xFF, 0xFF, 0x00, false, 13, 21028},
+	{0x027A, 0, 0, 0, true, true, false, 6, 0xFF, 0xFF, 0x00, false, 25, 21042},
+	{0x027B, 0, 0, 0, true, true, true, 9, 0xFF, 0xFF, 0x00, false, 33, 21068},
+	{0x027C, 0, 0, 0, true, true, true, 9, 0xFF, 0xFF, 0x00, false, 27, 21102},
+	{0x027D, 0, 0, 0, true, false, false, 5, 0xFF, 0xFF, 0x00, false, 21, 21130},
+	{0x027E, 0, 0, 0, true, false, false, 5, 0xFF, 0xFF, 0x00, false, 19, 21152},
+	{0x027F, 0, 0, 0, true, false, false, 5, 0xFF, 0xFF, 0x00, false, 19, 21172},
+	{0x0280, 0, 0, 0, true, false, false, 5, 0xFF, 0xFF, 0x00, false, 24, 21192},
+	{0x0281, 0, 0, 0, true, false, false, 5, 0xFF, 0xFF, 0x00, false, 15, 21217},
+	{0x0282, 0, 0, 0, false, false, false, 5, 0xFF, 0xFF, 0x00, false, 22, 21233},
+	{0x0283, 0, 0, 0, false, false, false, 5, 0xFF, 0xFF, 0x00, false, 20, 21256},
+	{0x0284, 0, 0, 0, false, false, false, 5, 0xFF, 0xFF, 0x00, false, 20, 21277},
+	{0x0285, 0, 0, 0, false, false, false, 5, 0xFF, 0xFF, 0x00, false, 25, 21298},
+	{0x0286, 0, 0, 1, false, false, false, 5, 0xFF, 0xFF, 0x00, false, 16, 21324},
+	{0x0287, 0, 0, 0, true, false, false, 10, 0x00, 0x01, 0x0B, true, 37, 21341},
+	{0x0288, 0, 0, 1, true, false, false, 10, 0x00, 0x01, 0x0B, true, 31, 21379},
+	{0x0289, 0, 0, 1, false, false, false, 10, 0x00, 0x01, 0x0B, true, 32, 21411},
+	{0x028A, 0, 0, 1, true, false, false, 10, 0x1D, 0x21, 0x38, true, 56, 21444},
+	{0x028B, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 46, 21501},
+	{0x028C, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 43, 21548},
+	{0x028D, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x04, true, 40, 21592},
+	{0x028E, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 39, 21633},
+	{0x028F, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 36, 21673},
+	{0x0290, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 33, 21710},
+	{0x0291, 0, 0, 0, false, true, false, 5, 0xFF, 0xFF, 0x00, false, 22, 21744},
+	{0x0292, 0, 0, 0, true, true, false, 5, 0xFF, 0xFF, 0x00, false, 18, 21767},
+	{0x0293, 0, 0, 0, false, false, false, 10, 0x00, 0x01, 0x0B, true, 39, 21786},
+	{0x0294, 0, 0, 0, true, true, false, 9, 0xFF, 0xFF, 0x00, false, 24, 21826},
+	{0x0295, 0, 0, 0, false, false, false, 9, 0xFF, 0xFF, 0x00, false, 28, 21851},
+	{0x0296, 0, 0, 0, false, true, false, 9, 0xFF, 0xFF, 0x00, false, 32, 21880},
+	{0x0297, 0, 0, 0, true, true, false, 6, 0xFF, 0xFF, 0x00, false, 24, 21913},
+	{0x0298, 0, 0, 0, true, false, false, 5, 0xFF, 0xFF, 0x00, false, 18, 21938},
+	{0x0299, 0, 0, 0, true, false, true, 5, 0xFF, 0xFF, 0x00, false, 22, 21957},
+	{0x029A, 0, 0, 1, false, false, true, 5, 0xFF, 0xFF, 0x00, false, 32, 21980},
+	{0x029F, 0, 0, 0, true, false, false, 10, 0x20, 0x2F, 0x3C, true, 60, 22013},
+	{0x02A0, 0, 2, 0, false, false, false, 6, 0xFF, 0xFF, 0x00, false, 17, 22074},
+	{0x02A1, 0, 2, 0, false, false, false, 7, 0xFF, 0xFF, 0x00, false, 17, 22092},
+	{0x02A3, 0, 0, 0, false, false, false, 23, 0x00, 0x01, 0x04, true, 21, 22110},
+	{0x02A4, 0, 0, 1, false, false, false, 6, 0xFF, 0xFF, 0x00, false, 16, 22132},
+	{0x02A6, 0, 0, 0, true, false, false, 5, 0xFF, 0xFF, 0x00, false, 25, 22149},
+	{0x02A7, 0, 0, 1, false, false, false, 5, 0xFF, 0xFF, 0x00, false, 26, 22175},
+	{0x02A8, 0, 0, 0, true, true, false, 9, 0xFF, 0xFF, 0x00, false, 28, 22202},
+	{0x02A9, 0, 1, 1, false, false, false, 23, 0x00, 0x01, 0x04, true, 16, 22231},
+	{0x02BD, 0, 0, 0, true, false, false, 11, 0x00, 0x01, 0x0C, true, 22, 22248},
+	{0x02BE, 0, 0, 0, true, false, false, 11, 0x00, 0x01, 0x0C, true, 28, 22271},
+	{0x02BF, 0, 0, 0, false, false, false, 11, 0x00, 0x01, 0x0C, true, 29, 22300},
+	{0x02C0, 0, 0, 0, true, false, false, 11, 0x00, 0x01, 0x10, true, 33, 22330},
+	{0x02C1, 0, 0, 0, true, false, false, 11, 0x00, 0x01, 0x0C, true, 37, 22364},
+	{0x02C2, 0, 0, 0, false, false, false, 13, 0x00, 0x01, 0x0C, true, 30, 22402},
+	{0x02C3, 0, 0, 0, true, false, false, 11, 0x18, 0x1C, 0x27, true, 39, 22433},
+	{0x02C4, 0, 0, 0, true, false, true, 11, 0x00, 0x01, 0x0C, true, 37, 22473},
+	{0x02C5, 0, 0, 0, true, false, true, 11, 0x00, 0x01, 0x10, true, 30, 22511},
+	{0x02C6, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 42, 22542},
+	{0x02C7, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 51, 22585},
+	{0x02C8, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 51, 22637},
+	{0x02C9, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 51, 22689},
+	{0x02CA, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 51, 22741},
+	{0x02CB, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 52, 22793},
+	{0x02CC, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 52, 22846},
+	{0x02CD, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 39, 22899},
+	{0x02CE, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 48, 22939},
+	{0x02CF, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 48, 22988},
+	{0x02D0, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 48, 23037},
+	{0x02D1, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 48, 23086},
+	{0x02D2, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 49, 23135},
+	{0x02D3, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 49, 23185},
+	{0x02D4, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 36, 23235},
+	{0x02D5, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 45, 23272},
+	{0x02D6, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 45, 23318},
+	{0x02D7, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 45, 23364},
+	{0x02D8, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 45, 23410},
+	{0x02D9, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 46, 23456},
+	{0x02DA, 0, 1, 1, false, false, false, 2, 0x00, 0x01, 0x0C, true, 45, 23503},
+	{0x02DB, 0, 0, 0, false, false, false, 1, 0x00, 0x01, 0x0C, true, 37, 23549},
+	{0x02DC, 0, 1, 0, false, false, false, 2, 0x00, 0x01, 0x0C, true, 46, 23587},
+	{0x02DD, 0, 0, 0, false, true, false, 1, 0x00, 0x01, 0x0C, true, 46, 23634},
+	{0x02DE, 0, 0, 0, false, false, false, 1, 0x00, 0x01, 0x0C, true, 43, 23681},
+	{0x02DF, 0, 0, 1, true, false, false, 5, 0x0E, 0x0F, 0x1A, true, 36, 23725},
+	{0x02E0, 0, 0, 0, true, false, false, 5, 0x00, 0x01, 0x0C, true, 41, 23762},
+	{0x02E1, 0, 0, 0, true, false, false, 5, 0x00, 0x01, 0x0C, true, 42, 23804},
+	{0x02E2, 0, 0, 0, true, false, false, 5, 0x00, 0x01, 0x0C, true, 40, 23847},
+	{0x02E3, 0, 0, 0, true, false, false, 5, 0x00, 0x01, 0x0C, true, 44, 23888},
+	{0x02E4, 0, 0, 0, true, false, false, 5, 0x00, 0x01, 0x0C, true, 40, 23933},
+	{0x02E5, 0, 0, 0, true, false, false, 5, 0x00, 0x01, 0x0C, true, 42, 23974},
+	{0x02E6, 0, 0, 0, true, false, true, 5, 0x00, 0x01, 0x0C, true, 53, 24017},
+	{0x02E7, 0, 0, 0, true, false, false, 5, 0x1F, 0x25, 0x2E, true, 58, 24071},
+	{0x02E8, 0, 0, 0, true, false, false, 5, 0x1F, 0x25, 0x2E, true, 59, 24130},
+	{0x02E9, 0, 0, 0, true, false, false, 5, 0x1F, 0x25, 0x2E, true, 61, 24190},
+	{0x02EA, 0, 0, 0, true, false, true, 5, 0x00, 0x01, 0x0C, true, 34, 24252},
+	{0x02EB, 5, 0, 0, false, false, false, 20, 0x12, 0x13, 0x16, true, 22, 24287},
+	{0x02EC, 5, 1, 0, false, false, false, 20, 0x12, 0x13, 0x16, true, 31, 24310},
+	{0x02ED, 5, 0, 1, false, false, false, 20, 0x17, 0x18, 0x1B, true, 27, 24342},
+	{0x02EE, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x10, true, 53, 24370},
+	{0x02EF, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x10, true, 62, 24424},
+	{0x02F0, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x10, true, 62, 24487},
+	{0x02F1, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x10, true, 62, 24550},
+	{0x02F2, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x10, true, 62, 24613},
+	{0x02F3, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x10, true, 63, 24676},
+	{0x02F4, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x10, true, 63, 24740},
+	{0x02F5, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x10, true, 50, 24804},
+	{0x02F6, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x10, true, 59, 24855},
+	{0x02F7, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x10, true, 59, 24915},
+	{0x02F8, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x10, true, 59, 24975},
+	{0x02F9, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x10, true, 59, 25035},
+	{0x02FA, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x10, true, 60, 25095},
+	{0x02FB, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x10, true, 60, 25156},
+	{0x02FC, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x10, true, 47, 25217},
+	{0x02FD, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x10, true, 56, 25265},
+	{0x02FE, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x10, true, 56, 25322},
+	{0x02FF, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x10, true, 56, 25379},
+	{0x0300, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x10, true, 56, 25436},
+	{0x0301, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x10, true, 57, 25493},
+	{0x0302, 0, 1, 1, false, false, false, 2, 0x00, 0x01, 0x10, true, 56, 25551},
+	{0x0303, 0, 0, 0, false, false, false, 1, 0x00, 0x01, 0x10, true, 48, 25608},
+	{0x0304, 0, 1, 0, false, false, false, 2, 0x00, 0x01, 0x10, true, 57, 25657},
+	{0x0305, 0, 0, 0, false, true, false, 1, 0x00, 0x01, 0x10, true, 57, 25715},
+	{0x0306, 0, 0, 0, false, false, false, 1, 0x00, 0x01, 0x10, true, 54, 25773},
+	{0x0307, 0, 0, 0, true, false, true, 5, 0x00, 0x01, 0x10, true, 64, 25828},
+	{0x0308, 0, 0, 0, true, false, false, 5, 0x26, 0x2C, 0x35, true, 65, 25893},
+	{0x0309, 0, 0, 0, true, false, false, 5, 0x26, 0x2C, 0x35, true, 66, 25959},
+	{0x030A, 0, 0, 0, true, false, false, 5, 0x26, 0x2C, 0x35, true, 68, 26026},
+	{0x030B, 0, 0, 0, true, false, true, 5, 0x00, 0x01, 0x10, true, 45, 26095},
+	{0x030C, 5, 0, 0, false, false, false, 20, 0x19, 0x1A, 0x1D, true, 29, 26141},
+	{0x030D, 5, 1, 0, false, false, false, 20, 0x19, 0x1A, 0x1D, true, 38, 26171},
+	{0x030E, 5, 0, 1, false, false, false, 20, 0x1E, 0x1F, 0x22, true, 34, 26210},
+	{0x030F, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 50, 26245},
+	{0x0310, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 60, 26296},
+	{0x0311, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 47, 26357},
+	{0x0312, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 57, 26405},
+	{0x0313, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 44, 26463},
+	{0x0314, 0, 1, 1, false, false, false, 2, 0x00, 0x01, 0x0C, true, 53, 26508},
+	{0x0315, 0, 0, 0, false, false, false, 1, 0x00, 0x01, 0x0C, true, 45, 26562},
+	{0x0316, 0, 1, 0, false, false, false, 2, 0x00, 0x01, 0x0C, true, 54, 26608},
+	{0x0317, 0, 0, 0, false, true, false, 1, 0x00, 0x01, 0x0C, true, 54, 26663},
+	{0x0318, 0, 0, 0, false, false, false, 1, 0x00, 0x01, 0x0C, true, 51, 26718},
+	{0x0319, 0, 0, 0, false, false, false, 5, 0x00, 0x01, 0x0C, true, 49, 26770},
+	{0x031A, 0, 0, 0, false, false, false, 5, 0x00, 0x01, 0x0C, true, 50, 26820},
+	{0x031B, 0, 0, 0, false, false, false, 5, 0x00, 0x01, 0x0C, true, 48, 26871},
+	{0x031C, 0, 0, 0, false, false, false, 5, 0x00, 0x01, 0x0C, true, 52, 26920},
+	{0x031D, 0, 0, 0, false, false, false, 5, 0x00, 0x01, 0x0C, true, 48, 26973},
+	{0x031E, 0, 0, 0, false, false, false, 5, 0x00, 0x01, 0x0C, true, 50, 27022},
+	{0x031F, 0, 0, 1, true, false, true, 5, 0x22, 0x26, 0x31, true, 49, 27073},
+	{0x0320, 0, 0, 0, true, true, false, 11, 0xFF, 0xFF, 0x00, false, 17, 27123},
+	{0x0321, 0, 2, 0, false, false, false, 11, 0xFF, 0xFF, 0x00, false, 17, 27141},
+	{0x0322, 0, 0, 0, true, false, false, 11, 0x00, 0x01, 0x0C, true, 32, 27159},
+	{0x0323, 0, 0, 0, true, false, false, 11, 0x00, 0x01, 0x0C, true, 30, 27192},
+	{0x0324, 0, 0, 1, false, false, false, 23, 0x00, 0x01, 0x0C, true, 45, 27223},
+	{0x0325, 0, 0, 1, true, false, false, 11, 0x17, 0x1B, 0x26, true, 38, 27269},
+	{0x0326, 0, 0, 0, true, false, true, 11, 0x00, 0x01, 0x0C, true, 28, 27308},
+	{0x0327, 0, 0, 0, true, false, true, 11, 0x00, 0x01, 0x0C, true, 26, 27337},
+	{0x0328, 0, 0, 0, true, false, true, 11, 0x00, 0x01, 0x0C, true, 34, 27364},
+	{0x0329, 0, 0, 0, true, false, true, 11, 0x00, 0x01, 0x0C, true, 36, 27399},
+	{0x032A, 0, 0, 0, true, true, true, 11, 0xFF, 0xFF, 0x00, false, 20, 27436},
+	{0x032B, 0, 0, 0, true, true, true, 11, 0xFF, 0xFF, 0x00, false, 15, 27457},
+	{0x032C, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 51, 27473},
+	{0x032D, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 48, 27525},
+	{0x032E, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 45, 27574},
+	{0x032F, 0, 0, 0, true, false, false, 11, 0x00, 0x01, 0x0C, true, 42, 27620},
+	{0x0330, 0, 0, 0, true, false, false, 11, 0x00, 0x01, 0x0C, true, 46, 27663},
+	{0x0331, 0, 0, 0, true, false, false, 11, 0x00, 0x01, 0x0C, true, 39, 27710},
+	{0x0332, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x10, true, 62, 27750},
+	{0x0333, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x10, true, 59, 27813},
+	{0x0334, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x10, true, 56, 27873},
+	{0x0335, 0, 0, 0, true, false, false, 11, 0x00, 0x01, 0x0C, true, 49, 27930},
+	{0x0336, 0, 0, 0, true, false, false, 11, 0x00, 0x01, 0x0C, true, 53, 27980},
+	{0x0337, 0, 0, 0, true, false, false, 11, 0x00, 0x01, 0x0C, true, 46, 28034},
+	{0x0338, 0, 0, 1, false, false, false, 13, 0x00, 0x01, 0x0C, true, 38, 28081},
+	{0x0339, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 65, 28120},
+	{0x033A, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 75, 28186},
+	{0x033B, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 62, 28262},
+	{0x033C, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 72, 28325},
+	{0x033D, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 59, 28398},
+	{0x033E, 0, 1, 1, false, false, false, 2, 0x00, 0x01, 0x0C, true, 68, 28458},
+	{0x033F, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 60, 28527},
+	{0x0340, 0, 1, 1, false, false, false, 2, 0x00, 0x01, 0x0C, true, 69, 28588},
+	{0x0341, 0, 0, 1, false, true, false, 1, 0x00, 0x01, 0x0C, true, 69, 28658},
+	{0x0342, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 66, 28728},
+	{0x0343, 0, 0, 1, false, false, false, 5, 0x00, 0x01, 0x0C, true, 64, 28795},
+	{0x0344, 0, 0, 1, false, false, false, 5, 0x00, 0x01, 0x0C, true, 65, 28860},
+	{0x0345, 0, 0, 1, false, false, false, 5, 0x00, 0x01, 0x0C, true, 63, 28926},
+	{0x0346, 0, 0, 1, false, false, false, 5, 0x00, 0x01, 0x0C, true, 63, 28990},
+	{0x0347, 0, 0, 1, false, false, false, 5, 0x00, 0x01, 0x0C, true, 65, 29054},
+	{0x0348, 5, 0, 0, false, false, false, 20, 0x18, 0x19, 0x1C, true, 28, 29120},
+	{0x0349, 5, 1, 0, false, false, false, 20, 0x18, 0x19, 0x1C, true, 37, 29149},
+	{0x034A, 5, 0, 1, false, false, false, 20, 0x1D, 0x1E, 0x21, true, 33, 29187},
+	{0x034B, 5, 0, 0, false, false, false, 20, 0x16, 0x17, 0x1A, true, 26, 29221},
+	{0x034C, 5, 1, 0, false, false, false, 20, 0x16, 0x17, 0x1A, true, 35, 29248},
+	{0x034D, 5, 0, 1, false, false, false, 20, 0x1B, 0x1C, 0x1F, true, 31, 29284},
+	{0x034E, 5, 0, 0, false, false, false, 20, 0x1E, 0x1F, 0x22, true, 34, 29316},
+	{0x034F, 5, 1, 0, false, false, false, 20, 0x1E, 0x1F, 0x22, true, 43, 29351},
+	{0x0350, 5, 0, 1, false, false, false, 20, 0x23, 0x24, 0x27, true, 39, 29395},
+	{0x0351, 5, 0, 0, false, false, false, 20, 0x20, 0x21, 0x24, true, 36, 29435},
+	{0x0352, 5, 1, 0, false, false, false, 20, 0x20, 0x21, 0x24, true, 45, 29472},
+	{0x0353, 5, 0, 1, false, false, false, 20, 0x25, 0x26, 0x29, true, 41, 29518},
+	{0x0354, 0, 0, 1, false, false, false, 13, 0xFF, 0xFF, 0x00, false, 28, 29560},
+	{0x0355, 0, 0, 0, true, true, false, 11, 0xFF, 0xFF, 0x00, false, 30, 29589},
+	{0x0356, 0, 0, 0, false, true, false, 11, 0xFF, 0xFF, 0x00, false, 24, 29620},
+	{0x0357, 0, 0, 0, true, true, true, 11, 0xFF, 0xFF, 0x00, false, 21, 29645},
+	{0x0358, 0, 0, 1, false, false, false, 13, 0xFF, 0xFF, 0x00, false, 36, 29667},
+	{0x0359, 0, 0, 0, false, false, false, 13, 0x00, 0x01, 0x04, true, 33, 29704},
+	{0x035A, 0, 0, 1, false, false, false, 13, 0x09, 0x0A, 0x0D, false, 42, 29738},
+	{0x035B, 0, 0, 0, false, false, false, 13, 0x00, 0x01, 0x04, true, 33, 29781},
+	{0x035C, 0, 0, 1, false, false, false, 13, 0x0A, 0x0B, 0x0E, true, 43, 29815},
+	{0x035D, 0, 0, 0, true, false, true, 13, 0xFF, 0xFF, 0x00, false, 19, 29859},
+	{0x035E, 0, 0, 1, true, false, true, 13, 0xFF, 0xFF, 0x00, false, 29, 29879},
+	{0x0381, 0, 0, 2, false, false, true, 13, 0xFF, 0xFF, 0x00, false, 45, 29909},
+	{0x0382, 0, 0, 0, true, true, true, 12, 0xFF, 0xFF, 0x00, false, 29, 29955},
+	{0x0383, 0, 0, 0, false, true, true, 12, 0xFF, 0xFF, 0x00, false, 43, 29985},
+	{0x0384, 0, 1, 1, false, false, true, 12, 0xFF, 0xFF, 0x00, false, 17, 30029},
+	{0x0385, 0, 0, 1, false, false, false, 12, 0x00, 0x01, 0x04, true, 30, 30047},
+	{0x0386, 0, 0, 1, false, false, false, 12, 0x00, 0x01, 0x04, true, 37, 30078},
+	{0x0387, 0, 0, 0, false, true, false, 12, 0xFF, 0xFF, 0x00, false, 20, 30116},
+	{0x0388, 0, 0, 0, false, false, true, 12, 0xFF, 0xFF, 0x00, false, 12, 30137},
+	{0x0389, 0, 0, 0, false, false, false, 12, 0x00, 0x01, 0x04, true, 17, 30150},
+	{0x038A, 0, 0, 1, false, false, false, 12, 0x00, 0x01, 0x04, true, 25, 30168},
+	{0x038B, 0, 0, 0, true, false, true, 12, 0xFF, 0xFF, 0x00, false, 8, 30194},
+	{0x038C, 0, 0, 1, true, false, true, 12, 0xFF, 0xFF, 0x00, false, 16, 30203},
+	{0x038D, 0, 0, 1, false, false, true, 12, 0xFF, 0xFF, 0x00, false, 12, 30220},
+	{0x038E, 0, 0, 1, false, false, true, 12, 0xFF, 0xFF, 0x00, false, 22, 30233},
+	{0x038F, 0, 0, 0, true, false, true, 12, 0xFF, 0xFF, 0x00, false, 10, 30256},
+	{0x0390, 0, 0, 0, true, false, true, 12, 0xFF, 0xFF, 0x00, false, 14, 30267},
+	{0x0391, 0, 0, 0, true, false, true, 12, 0xFF, 0xFF, 0x00, false, 9, 30282},
+	{0x0392, 0, 0, 0, true, false, true, 12, 0xFF, 0xFF, 0x00, false, 9, 30292},
+	{0x0393, 0, 0, 0, true, false, true, 12, 0xFF, 0xFF, 0x00, false, 17, 30302},
+	{0x0394, 0, 0, 0, true, false, true, 14, 0xFF, 0xFF, 0x00, false, 30, 30320},
+	{0x0395, 0, 0, 0, true, false, false, 12, 0xFF, 0xFF, 0x00, false, 10, 30351},
+	{0x0396, 0, 0, 0, true, false, true, 12, 0x00, 0x01, 0x04, true, 23, 30362},
+	{0x0397, 0, 0, 0, false, false, true, 12, 0xFF, 0xFF, 0x00, false, 16, 30386},
+	{0x0398, 0, 0, 0, false, false, true, 12, 0xFF, 0xFF, 0x00, false, 8, 30403},
+	{0x0399, 0, 0, 0, false, false, true, 12, 0xFF, 0xFF, 0x00, false, 12, 30412},
+	{0x039A, 0, 0, 0, false, false, false, 13, 0xFF, 0xFF, 0x00, false, 18, 30425},
+	{0x039B, 0, 0, 1, false, true, true, 13, 0xFF, 0xFF, 0x00, false, 27, 30444},
+	{0x039C, 0, 0, 0, false, false, false, 4, 0xFF, 0xFF, 0x00, false, 14, 30472},
+	{0x039D, 0, 0, 1, false, false, false, 5, 0xFF, 0xFF, 0x00, false, 23, 30487},
+	{0x039E, 0, 0, 1, false, false, false, 5, 0x0B, 0x0C, 0x0F, true, 28, 30511},
+	{0x039F, 0, 0, 1, false, false, false, 12, 0x00, 0x01, 0x04, true, 39, 30540},
+	{0x03A0, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 28, 30580},
+	{0x03A1, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 38, 30609},
+	{0x03A2, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 25, 30648},
+	{0x03A3, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 35, 30674},
+	{0x03A4, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 22, 30710},
+	{0x03A5, 0, 1, 1, false, false, false, 2, 0xFF, 0xFF, 0x00, false, 31, 30733},
+	{0x03A6, 0, 0, 0, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 23, 30765},
+	{0x03A7, 0, 1, 0, false, false, false, 2, 0xFF, 0xFF, 0x00, false, 32, 30789},
+	{0x03A8, 0, 0, 0, false, true, false, 1, 0xFF, 0xFF, 0x00, false, 32, 30822},
+	{0x03A9, 0, 0, 0, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 29, 30855},
+	{0x03AA, 0, 0, 1, true, false, true, 9, 0xFF, 0xFF, 0x00, false, 22, 30885},
+	{0x03AB, 5, 0, 0, false, false, false, 20, 0x11, 0x12, 0x15, true, 21, 30908},
+	{0x03AC, 5, 1, 1, false, false, false, 20, 0x11, 0x12, 0x15, true, 30, 30930},
+	{0x03AD, 5, 0, 1, true, false, false, 20, 0x16, 0x17, 0x1A, true, 26, 30961},
+	{0x03AE, 0, 0, 0, true, false, true, 12, 0xFF, 0xFF, 0x00, false, 28, 30988},
+	{0x03AF, 0, 0, 1, true, false, true, 9, 0xFF, 0xFF, 0x00, false, 24, 31017},
+	{0x03B0, 0, 0, 0, true, false, true, 12, 0x1F, 0x26, 0x38, true, 56, 31042},
+	{0x03B1, 0, 0, 1, true, false, true, 9, 0xFF, 0xFF, 0x00, false, 23, 31099},
+	{0x03B2, 0, 0, 0, true, false, true, 12, 0xFF, 0xFF, 0x00, false, 29, 31123},
+	{0x03B3, 0, 0, 1, true, false, true, 5, 0xFF, 0xFF, 0x00, false, 28, 31153},
+	{0x03B4, 0, 0, 0, true, false, true, 12, 0xFF, 0xFF, 0x00, false, 29, 31182},
+	{0x03B5, 0, 0, 1, true, false, false, 9, 0xFF, 0xFF, 0x00, false, 24, 31212},
+	{0x03B6, 0, 0, 0, true, false, true, 12, 0xFF, 0xFF, 0x00, false, 41, 31237},
+	{0x03B7, 0, 0, 0, true, false, false, 5, 0x20, 0x26, 0x2F, true, 59, 31279},
+	{0x03B8, 0, 0, 0, true, false, false, 5, 0x20, 0x26, 0x2F, true, 60, 31339},
+	{0x03B9, 0, 0, 0, true, false, false, 5, 0x20, 0x26, 0x2F, true, 62, 31400},
+	{0x03BA, 0, 0, 0, true, false, true, 5, 0xFF, 0xFF, 0x00, false, 35, 31463},
+	{0x03BB, 0, 0, 0, true, false, false, 12, 0xFF, 0xFF, 0x00, false, 30, 31499},
+	{0x03BC, 0, 0, 1, true, false, false, 5, 0xFF, 0xFF, 0x00, false, 28, 31530},
+	{0x03BD, 0, 0, 1, false, false, false, 5, 0xFF, 0xFF, 0x00, false, 35, 31559},
+	{0x03BE, 5, 0, 0, false, false, false, 20, 0x19, 0x1A, 0x1D, true, 29, 31595},
+	{0x03BF, 5, 1, 0, false, false, false, 20, 0x19, 0x1A, 0x1D, true, 38, 31625},
+	{0x03C0, 5, 0, 1, false, false, false, 20, 0x1E, 0x1F, 0x22, true, 34, 31664},
+	{0x03C1, 0, 0, 1, false, false, true, 5, 0xFF, 0xFF, 0x00, false, 22, 31699},
+	{0x03C2, 5, 0, 0, false, false, false, 20, 0x11, 0x12, 0x15, true, 21, 31722},
+	{0x03C3, 5, 1, 0, false, false, false, 20, 0x11, 0x12, 0x15, true, 30, 31744},
+	{0x03C4, 5, 0, 1, false, false, false, 20, 0x16, 0x17, 0x1A, true, 26, 31775},
+	{0x03C5, 0, 0, 1, false, false, true, 5, 0xFF, 0xFF, 0x00, false, 26, 31802},
+	{0x03C6, 5, 0, 0, false, false, false, 20, 0x15, 0x16, 0x19, true, 25, 31829},
+	{0x03C7, 5, 1, 1, false, false, false, 20, 0x15, 0x16, 0x19, true, 34, 31855},
+	{0x03C8, 5, 0, 1, false, false, false, 20, 0x1A, 0x1B, 0x1E, true, 30, 31890},
+	{0x03C9, 0, 0, 1, false, false, false, 5, 0xFF, 0xFF, 0x00, false, 25, 31921},
+	{0x03CA, 0, 0, 0, true, true, true, 12, 0xFF, 0xFF, 0x00, false, 15, 31947},
+	{0x03CB, 0, 2, 0, false, false, false, 12, 0xFF, 0xFF, 0x00, false, 17, 31963},
+	{0x03CC, 0, 1, 0, false, false, true, 12, 0xFF, 0xFF, 0x00, false, 21, 31981},
+	{0x03CD, 0, 0, 0, false, false, true, 12, 0xFF, 0xFF, 0x00, false, 19, 32003},
+	{0x03CE, 0, 0, 0, true, false, true, 12, 0xFF, 0xFF, 0x00, false, 14, 32023},
+	{0x03CF, 0, 0, 0, true, false, true, 12, 0xFF, 0xFF, 0x00, false, 12, 32038},
+	{0x03D0, 0, 0, 0, true, false, true, 12, 0xFF, 0xFF, 0x00, false, 9, 32051},
+	{0x03D1, 0, 0, 0, false, false, true, 12, 0xFF, 0xFF, 0x00, false, 10, 32061},
+	{0x03D2, 0, 0, 1, true, false, true, 12, 0xFF, 0xFF, 0x00, false, 9, 32072},
+	{0x03D3, 0, 0, 1, false, false, true, 12, 0xFF, 0xFF, 0x00, false, 10, 32082},
+	{0x03D4, 0, 0, 1, false, false, false, 5, 0x0B, 0x0C, 0x0F, true, 42, 32093},
+	{0x03D5, 0, 0, 1, false, false, false, 12, 0x00, 0x01, 0x04, true, 49, 32136},
+	{0x03D6, 0, 0, 1, false, false, false, 5, 0xFF, 0xFF, 0x00, false, 34, 32186},
+	{0x03D7, 0, 0, 1, false, false, false, 12, 0xFF, 0xFF, 0x00, false, 40, 32221},
+	{0x03D8, 0, 0, 1, false, true, false, 12, 0xFF, 0xFF, 0x00, false, 28, 32262},
+	{0x03D9, 0, 0, 1, false, false, true, 12, 0xFF, 0xFF, 0x00, false, 32, 32291},
+	{0x03DA, 0, 0, 1, false, false, true, 12, 0xFF, 0xFF, 0x00, false, 20, 32324},
+	{0x03DB, 0, 0, 1, false, false, true, 5, 0xFF, 0xFF, 0x00, false, 30, 32345},
+	{0x03DC, 0, 0, 1, false, false, false, 12, 0xFF, 0xFF, 0x00, false, 39, 32376},
+	{0x03DD, 0, 0, 1, false, false, true, 12, 0xFF, 0xFF, 0x00, false, 27, 32416},
+	{0x03DE, 0, 0, 1, true, false, true, 12, 0xFF, 0xFF, 0x00, false, 22, 32444},
+	{0x03DF, 0, 0, 1, false, false, true, 12, 0xFF, 0xFF, 0x00, false, 20, 32467},
+	{0x03E0, 0, 0, 1, true, false, true, 12, 0xFF, 0xFF, 0x00, false, 18, 32488},
+	{0x03E1, 0, 0, 1, true, false, true, 9, 0xFF, 0xFF, 0x00, false, 28, 32507},
+	{0x03E2, 0, 0, 1, true, false, true, 12, 0xFF, 0xFF, 0x00, false, 22, 32536},
+	{0x03E3, 0, 0, 1, true, false, true, 9, 0xFF, 0xFF, 0x00, false, 26, 32559},
+	{0x03E4, 0, 0, 1, true, false, true, 12, 0x21, 0x28, 0x3A, true, 58, 32586},
+	{0x03E5, 0, 0, 1, true, false, true, 12, 0xFF, 0xFF, 0x00, false, 38, 32645},
+	{0x03E6, 0, 0, 1, true, false, true, 12, 0xFF, 0xFF, 0x00, false, 17, 32684},
+	{0x03E7, 0, 0, 1, true, false, true, 12, 0xFF, 0xFF, 0x00, false, 17, 32702},
+	{0x03E8, 0, 0, 1, true, false, true, 12, 0xFF, 0xFF, 0x00, false, 25, 32720},
+	{0x03E9, 0, 0, 1, false, false, true, 14, 0x1D, 0x24, 0x36, true, 54, 32746},
+	{0x03EA, 0, 0, 1, false, false, true, 14, 0xFF, 0xFF, 0x00, false, 21, 32801},
+	{0x03EB, 0, 0, 1, true, false, true, 14, 0x0E, 0x15, 0x27, true, 39, 32823},
+	{0x03EC, 0, 0, 0, true, false, true, 14, 0xFF, 0xFF, 0x00, false, 11, 32863},
+	{0x03ED, 0, 0, 0, true, false, true, 14, 0xFF, 0xFF, 0x00, false, 14, 32875},
+	{0x03EE, 0, 0, 0, true, false, true, 14, 0x04, 0x0B, 0x1D, true, 29, 32890},
+	{0x03EF, 0, 0, 0, true, false, true, 14, 0x0E, 0x15, 0x27, true, 39, 32920},
+	{0x03F0, 0, 0, 1, true, false, true, 14, 0x0A, 0x11, 0x23, true, 35, 32960},
+	{0x03F1, 0, 0, 1, false, false, true, 14, 0x0E, 0x15, 0x27, true, 39, 32996},
+	{0x03F2, 0, 0, 1, true, false, true, 14, 0x12, 0x19, 0x2B, true, 43, 33036},
+	{0x03F3, 0, 0, 0, false, false, true, 14, 0x06, 0x0D, 0x1F, true, 31, 33080},
+	{0x03F4, 0, 0, 0, true, false, true, 14, 0x11, 0x18, 0x2A, true, 42, 33112},
+	{0x03F5, 0, 0, 0, true, false, true, 14, 0x0C, 0x13, 0x25, true, 37, 33155},
+	{0x03F6, 0, 0, 1, true, false, true, 14, 0x0B, 0x12, 0x24, true, 36, 33193},
+	{0x03F7, 0, 0, 0, true, false, true, 14, 0x0A, 0x11, 0x23, true, 35, 33230},
+	{0x03F8, 0, 0, 0, true, false, true, 14, 0x0C, 0x13, 0x25, true, 37, 33266},
+	{0x03F9, 0, 0, 0, true, false, false, 14, 0xFF, 0xFF, 0x00, false, 35, 33304},
+	{0x03FA, 0, 0, 0, true, false, true, 14, 0x0E, 0x15, 0x27, true, 51, 33340},
+	{0x03FB, 0, 0, 1, false, false, true, 14, 0x0E, 0x15, 0x27, true, 52, 33392},
+	{0x03FC, 0, 0, 1, true, false, true, 14, 0x15, 0x1C, 0x2E, true, 46, 33445},
+	{0x03FD, 0, 0, 1, false, false, false, 5, 0x26, 0x2C, 0x35, true, 65, 33492},
+	{0x03FE, 0, 0, 0, false, false, false, 5, 0x26, 0x2C, 0x35, true, 66, 33558},
+	{0x03FF, 0, 0, 0, false, false, false, 5, 0x26, 0x2C, 0x35, true, 68, 33625},
+	{0x0400, 0, 0, 0, false, true, false, 14, 0xFF, 0xFF, 0x00, false, 35, 33694},
+	{0x0401, 0, 2, 0, false, false, false, 14, 0xFF, 0xFF, 0x00, false, 17, 33730},
+	{0x0402, 0, 0, 1, true, false, false, 12, 0xFF, 0xFF, 0x00, false, 18, 33748},
+	{0x0403, 5, 0, 0, false, false, false, 20, 0x17, 0x18, 0x1B, true, 27, 33767},
+	{0x0404, 5, 1, 0, false, false, false, 20, 0x17, 0x18, 0x1B, true, 36, 33795},
+	{0x0405, 5, 0, 1, false, false, false, 20, 0x1C, 0x1D, 0x20, true, 32, 33832},
+	{0x0406, 0, 0, 1, true, false, true, 12, 0xFF, 0xFF, 0x00, false, 22, 33865},
+	{0x0407, 0, 0, 1, false, false, true, 12, 0xFF, 0xFF, 0x00, false, 24, 33888},
+	{0x0408, 0, 0, 1, false, false, true, 12, 0xFF, 0xFF, 0x00, false, 16, 33913},
+	{0x0409, 0, 0, 1, false, false, true, 12, 0xFF, 0xFF, 0x00, false, 20, 33930},
+	{0x040A, 0, 0, 1, false, false, false, 4, 0xFF, 0xFF, 0x00, false, 22, 33951},
+	{0x040B, 0, 0, 1, false, false, true, 14, 0x0B, 0x12, 0x24, true, 36, 33974},
+	{0x040C, 0, 0, 1, false, false, true, 14, 0x12, 0x19, 0x2B, true, 43, 34011},
+	{0x040D, 0, 0, 1, false, false, true, 14, 0x27, 0x2E, 0x40, true, 64, 34055},
+	{0x040E, 0, 0, 1, false, false, true, 14, 0x1D, 0x24, 0x36, true, 54, 34120},
+	{0x040F, 0, 0, 0, false, false, true, 14, 0x13, 0x1A, 0x2C, true, 44, 34175},
+	{0x0410, 0, 0, 0, false, false, true, 14, 0x09, 0x10, 0x22, true, 34, 34220},
+	{0x0411, 0, 0, 0, false, false, true, 14, 0xFF, 0xFF, 0x00, false, 20, 34255},
+	{0x0412, 0, 0, 0, true, false, true, 14, 0xFF, 0xFF, 0x00, false, 18, 34276},
+	{0x0413, 0, 0, 0, true, false, true, 14, 0xFF, 0xFF, 0x00, false, 15, 34295},
+	{0x0414, 0, 0, 0, true, false, false, 14, 0xFF, 0xFF, 0x00, false, 11, 34311},
+	{0x0415, 0, 0, 0, false, false, false, 14, 0xFF, 0xFF, 0x00, false, 14, 34323},
+	{0x0416, 0, 1, 0, true, false, true, 34, 0x0D, 0x14, 0x26, true, 38, 34338},
+	{0x0417, 0, 0, 1, true, false, true, 14, 0x0C, 0x13, 0x25, true, 37, 34377},
+	{0x0418, 0, 0, 1, true, false, true, 14, 0x16, 0x1D, 0x2F, true, 47, 34415},
+	{0x0419, 0, 1, 1, true, false, true, 34, 0x15, 0x1C, 0x2E, true, 46, 34463},
+	{0x041A, 0, 0, 1, true, false, true, 14, 0x14, 0x1B, 0x2D, true, 45, 34510},
+	{0x041B, 0, 1, 1, true, false, true, 34, 0x13, 0x1A, 0x2C, true, 44, 34556},
+	{0x041C, 0, 1, 1, true, false, true, 34, 0x17, 0x1E, 0x30, true, 48, 34601},
+	{0x041D, 0, 1, 0, true, false, true, 34, 0x15, 0x1C, 0x2E, true, 46, 34650},
+	{0x041E, 0, 0, 0, true, false, true, 14, 0xFF, 0xFF, 0x00, false, 37, 34697},
+	{0x041F, 0, 0, 1, true, false, true, 14, 0xFF, 0xFF, 0x00, false, 19, 34735},
+	{0x0420, 0, 0, 1, true, false, true, 14, 0xFF, 0xFF, 0x00, false, 23, 34755},
+	{0x0421, 0, 0, 1, true, false, false, 14, 0xFF, 0xFF, 0x00, false, 19, 34779},
+	{0x0422, 0, 0, 1, false, false, false, 14, 0xFF, 0xFF, 0x00, false, 22, 34799},
+	{0x0423, 0, 0, 1, true, false, true, 14, 0xFF, 0xFF, 0x00, false, 38, 34822},
+	{0x0424, 0, 0, 1, true, false, true, 14, 0x0C, 0x13, 0x25, true, 48, 34861},
+	{0x0425, 0, 0, 1, true, false, true, 14, 0x16, 0x1D, 0x2F, true, 58, 34910},
+	{0x0426, 0, 0, 1, true, false, true, 14, 0x0C, 0x13, 0x25, true, 83, 34969},
+	{0x0427, 8, 0, 1, false, false, true, 14, 0x1E, 0x24, 0x27, true, 39, 35053},
+	{0x0428, 0, 0, 1, false, false, true, 14, 0x0B, 0x12, 0x24, true, 63, 35093},
+	{0x0429, 0, 0, 0, true, true, true, 14, 0xFF, 0xFF, 0x00, false, 27, 35157},
+	{0x042A, 0, 0, 1, false, false, false, 4, 0xFF, 0xFF, 0x00, false, 44, 35185},
+	{0x042B, 0, 0, 0, false, false, true, 13, 0xFF, 0xFF, 0x00, false, 24, 35230},
+	{0x042C, 0, 0, 0, false, false, true, 13, 0xFF, 0xFF, 0x00, false, 27, 35255},
+	{0x042D, 0, 0, 0, true, true, true, 14, 0xFF, 0xFF, 0x00, false, 19, 35283},
+	{0x042E, 0, 0, 0, true, true, true, 14, 0xFF, 0xFF, 0x00, false, 12, 35303},
+	{0x042F, 0, 1, 0, true, true, true, 34, 0xFF, 0xFF, 0x00, false, 34, 35316},
+	{0x0430, 0, 2, 0, false, false, false, 34, 0xFF, 0xFF, 0x00, false, 17, 35351},
+	{0x0431, 0, 1, 1, false, false, true, 14, 0x30, 0x37, 0x49, true, 73, 35369},
+	{0x0432, 0, 1, 1, false, false, true, 14, 0x17, 0x1E, 0x30, true, 48, 35443},
+	{0x0433, 0, 1, 1, true, false, true, 14, 0x25, 0x2C, 0x3E, true, 62, 35492},
+	{0x0437, 6, 0, 0, true, false, true, 15, 0x1C, 0x20, 0x23, true, 35, 35555},
+	{0x0438, 6, 0, 0, true, false, true, 15, 0x0D, 0x14, 0x17, true, 23, 35591},
+	{0x0439, 6, 0, 0, true, false, true, 15, 0x0D, 0x11, 0x14, true, 20, 35615},
+	{0x043A, 0, 0, 0, true, false, true, 15, 0xFF, 0xFF, 0x00, false, 25, 35636},
+	{0x043B, 6, 0, 0, true, false, true, 15, 0x14, 0x15, 0x18, true, 24, 35662},
+	{0x043C, 0, 0, 0, false, false, true, 12, 0xFF, 0xFF, 0x00, false, 10, 35687},
+	{0x043D, 0, 0, 1, true, false, true, 12, 0xFF, 0xFF, 0x00, false, 11, 35698},
+	{0x043E, 0, 0, 0, false, false, true, 12, 0xFF, 0xFF, 0x00, false, 26, 35710},
+	{0x0442, 0, 0, 1, true, false, true, 12, 0xFF, 0xFF, 0x00, false, 24, 35737},
+	{0x044D, 10, 0, 1, false, false, true, 16, 0x0F, 0x10, 0x13, true, 19, 35762},
+	{0x044E, 10, 0, 1, false, false, true, 16, 0x0F, 0x10, 0x13, true, 48, 35782},
+	{0x044F, 10, 0, 1, false, false, true, 16, 0x0F, 0x10, 0x13, true, 48, 35831},
+	{0x0450, 10, 0, 1, false, false, true, 16, 0x09, 0x0A, 0x0D, true, 13, 35880},
+	{0x0451, 10, 0, 0, false, false, true, 16, 0x09, 0x0A, 0x0D, true, 43, 35894},
+	{0x0452, 2, 0, 0, false, false, true, 16, 0x05, 0x1C, 0x1F, true, 31, 35938},
+	{0x0453, 2, 0, 0, false, false, true, 16, 0x06, 0x1D, 0x20, true, 32, 35970},
+	{0x0454, 2, 0, 0, false, false, true, 16, 0x0E, 0x25, 0x28, true, 40, 36003},
+	{0x0455, 10, 0, 0, false, false, true, 16, 0x0B, 0x0C, 0x0F, true, 15, 36044},
+	{0x0456, 10, 0, 1, false, false, true, 16, 0x0B, 0x0C, 0x0F, true, 44, 36060},
+	{0x0457, 10, 0, 0, false, false, true, 16, 0x0B, 0x0C, 0x0F, true, 44, 36105},
+	{0x0458, 10, 0, 0, false, false, true, 16, 0x05, 0x06, 0x09, true, 9, 36150},
+	{0x0459, 10, 0, 0, false, false, true, 16, 0x05, 0x06, 0x09, true, 39, 36160},
+	{0x045A, 2, 0, 0, false, false, true, 16, 0x08, 0x1F, 0x22, true, 34, 36200},
+	{0x045B, 0, 0, 0, true, false, true, 15, 0xFF, 0xFF, 0x00, false, 11, 36235},
+	{0x045C, 0, 0, 0, true, false, true, 15, 0xFF, 0xFF, 0x00, false, 5, 36247},
+	{0x045D, 3, 1, 0, true, false, true, 33, 0x00, 0x01, 0x13, true, 36, 36253},
+	{0x045E, 3, 1, 0, true, false, true, 33, 0x00, 0x01, 0x13, true, 33, 36290},
+	{0x045F, 3, 1, 0, true, false, true, 33, 0x00, 0x01, 0x13, true, 33, 36324},
+	{0x0460, 3, 1, 0, true, false, true, 33, 0x00, 0x01, 0x13, true, 33, 36358},
+	{0x0461, 3, 1, 0, true, false, true, 33, 0x00, 0x01, 0x13, true, 33, 36392},
+	{0x0462, 3, 1, 0, true, false, true, 33, 0x00, 0x01, 0x13, true, 33, 36426},
+	{0x0463, 3, 1, 0, true, false, true, 33, 0x00, 0x01, 0x13, true, 38, 36460},
+	{0x0464, 3, 1, 0, true, false, true, 33, 0x00, 0x01, 0x13, true, 31, 36499},
+	{0x0465, 3, 1, 0, true, false, true, 33, 0x17, 0x18, 0x2A, true, 50, 36531},
+	{0x0466, 0, 0, 0, false, true, true, 16, 0xFF, 0xFF, 0x00, false, 26, 36582},
+	{0x0467, 0, 2, 0, false, false, false, 15, 0xFF, 0xFF, 0x00, false, 17, 36609},
+	{0x0468, 2, 0, 1, false, false, true, 16, 0x0D, 0x24, 0x27, true, 39, 36627},
+	{0x0469, 3, 1, 1, true, false, true, 33, 0x00, 0x01, 0x13, true, 32, 36667},
+	{0x046A, 2, 0, 1, false, false, true, 16, 0x09, 0x20, 0x23, true, 35, 36700},
+	{0x046B, 3, 1, 1, true, false, true, 33, 0x00, 0x01, 0x13, true, 28, 36736},
+	{0x046C, 2, 0, 1, false, false, true, 16, 0x0E, 0x25, 0x28, true, 40, 36765},
+	{0x046D, 3, 1, 1, true, false, true, 33, 0x00, 0x01, 0x13, true, 33, 36806},
+	{0x046E, 2, 0, 1, false, false, true, 16, 0x23, 0x27, 0x2A, true, 42, 36840},
+	{0x046F, 2, 0, 0, false, false, true, 16, 0x1D, 0x21, 0x24, true, 36, 36883},
+	{0x0470, 2, 0, 0, false, false, true, 16, 0x1F, 0x23, 0x26, true, 38, 36920},
+	{0x0471, 2, 0, 0, false, false, true, 16, 0x19, 0x1D, 0x20, true, 32, 36959},
+	{0x0472, 0, 1, 0, true, true, true, 33, 0xFF, 0xFF, 0x00, false, 33, 36992},
+	{0x0473, 0, 2, 0, false, false, false, 33, 0xFF, 0xFF, 0x00, false, 17, 37026},
+	{0x0474, 0, 1, 0, true, true, true, 33, 0xFF, 0xFF, 0x00, false, 26, 37044},
+	{0x0475, 0, 1, 0, true, true, true, 33, 0xFF, 0xFF, 0x00, false, 22, 37071},
+	{0x0477, 0, 1, 0, true, false, true, 34, 0x17, 0x1E, 0x30, true, 48, 37094},
+	{0x047F, 3, 1, 1, true, false, true, 33, 0x00, 0x01, 0x13, true, 34, 37143},
+	{0x0480, 3, 1, 0, true, false, true, 33, 0x00, 0x01, 0x13, true, 28, 37178},
+	{0x0481, 3, 1, 0, true, false, true, 33, 0x00, 0x01, 0x13, true, 24, 37207},
+	{0x0482, 3, 1, 0, true, false, true, 33, 0x00, 0x01, 0x13, true, 25, 37232},
+	{0x0483, 3, 1, 0, true, false, true, 33, 0x00, 0x01, 0x13, true, 33, 37258},
+	{0x0484, 3, 1, 0, true, false, true, 33, 0x00, 0x01, 0x13, true, 30, 37292},
+	{0x0485, 3, 1, 0, true, false, true, 33, 0x00, 0x01, 0x13, true, 24, 37323},
+	{0x0486, 3, 1, 0, true, false, true, 33, 0x00, 0x01, 0x13, true, 27, 37348},
+	{0x0487, 3, 1, 0, true, false, true, 33, 0x00, 0x01, 0x13, true, 31, 37376},
+	{0x0488, 3, 1, 0, true, false, true, 33, 0x00, 0x01, 0x13, true, 25, 37408},
+	{0x048D, 0, 0, 0, true, false, true, 14, 0xFF, 0xFF, 0x00, false, 21, 37434},
+	{0x048E, 0, 0, 0, true, false, true, 14, 0xFF, 0xFF, 0x00, false, 21, 37456},
+	{0x0492, 10, 1, 1, false, false, true, 16, 0x0F, 0x10, 0x13, true, 28, 37478},
+	{0x0493, 10, 1, 1, false, false, true, 16, 0x0B, 0x0C, 0x0F, true, 24, 37507},
+	{0x0494, 0, 1, 0, false, false, true, 16, 0xFF, 0xFF, 0x00, false, 27, 37532},
+	{0x0495, 2, 1, 1, false, false, true, 16, 0x09, 0x25, 0x28, true, 49, 37560},
+	{0x0496, 2, 1, 1, false, false, true, 16, 0x0E, 0x2A, 0x2D, true, 54, 37610},
+	{0x0497, 2, 1, 0, false, false, true, 16, 0x13, 0x17, 0x1A, true, 35, 37665},
+	{0x0498, 2, 1, 1, false, false, true, 16, 0x16, 0x32, 0x35, true, 79, 37701},
+	{0x0499, 2, 1, 1, false, false, true, 16, 0x0A, 0x26, 0x29, true, 50, 37781},
+	{0x049A, 2, 1, 1, false, false, true, 16, 0x0B, 0x27, 0x2A, true, 51, 37832},
+	{0x049B, 0, 1, 0, false, false, true, 16, 0xFF, 0xFF, 0x00, false, 30, 37884},
+	{0x049C, 0, 0, 0, true, true, true, 16, 0xFF, 0xFF, 0x00, false, 33, 37915},
+	{0x04A6, 0, 0, 0, true, false, true, 17, 0xFF, 0xFF, 0x00, false, 11, 37949},
+	{0x04A7, 0, 0, 0, true, false, true, 17, 0xFF, 0xFF, 0x00, false, 24, 37961},
+	{0x04B1, 0, 0, 1, false, false, true, 17, 0xFF, 0xFF, 0x00, false, 9, 37986},
+	{0x04B2, 4, 0, 1, true, false, true, 17, 0x16, 0x17, 0x1A, true, 26, 37996},
+	{0x04B3, 4, 0, 1, true, false, true, 17, 0x06, 0x07, 0x0A, true, 10, 38023},
+	{0x04B4, 4, 0, 1, true, false, true, 17, 0x12, 0x13, 0x16, true, 22, 38034},
+	{0x04B5, 4, 0, 0, true, false, true, 17, 0x0D, 0x0E, 0x11, true, 17, 38057},
+	{0x04B6, 4, 1, 0, true, false, true, 36, 0x0F, 0x10, 0x13, true, 19, 38075},
+	{0x04B7, 4, 1, 0, true, false, true, 36, 0x0C, 0x0D, 0x10, true, 16, 38095},
+	{0x04B8, 0, 1, 0, true, false, true, 36, 0xFF, 0xFF, 0x00, false, 12, 38112},
+	{0x04B9, 4, 0, 0, true, false, true, 17, 0x0C, 0x0D, 0x10, true, 16, 38125},
+	{0x04BA, 4, 0, 0, true, false, true, 17, 0x0B, 0x0C, 0x0F, true, 15, 38142},
+	{0x04BB, 4, 0, 0, true, false, true, 17, 0x0D, 0x0E, 0x11, true, 47, 38158},
+	{0x04BC, 4, 0, 1, true, false, true, 9, 0x33, 0x34, 0x37, true, 55, 38206},
+	{0x04BD, 0, 0, 0, true, true, true, 17, 0xFF, 0xFF, 0x00, false, 19, 38262},
+	{0x04BE, 0, 2, 0, false, false, false, 17, 0xFF, 0xFF, 0x00, false, 17, 38282},
+	{0x04BF, 0, 0, 1, true, true, true, 9, 0xFF, 0xFF, 0x00, false, 43, 38300},
+	{0x04C0, 0, 1, 0, true, true, true, 36, 0xFF, 0xFF, 0x00, false, 23, 38344},
+	{0x04C1, 0, 0, 1, false, true, true, 17, 0xFF, 0xFF, 0x00, false, 21, 38368},
+	{0x04C2, 0, 1, 0, true, true, true, 36, 0xFF, 0xFF, 0x00, false, 23, 38390},
+	{0x04C3, 0, 2, 0, false, false, false, 36, 0xFF, 0xFF, 0x00, false, 17, 38414},
+	{0x04E3, 3, 1, 1, true, false, true, 36, 0x00, 0x01, 0x13, true, 29, 38432},
+	{0x04E4, 4, 1, 1, true, false, true, 36, 0x16, 0x17, 0x1A, true, 26, 38462},
+	{0x04E5, 4, 1, 1, true, false, true, 36, 0x06, 0x07, 0x0A, true, 10, 38489},
+	{0x04E6, 4, 1, 0, true, false, true, 36, 0x12, 0x13, 0x16, true, 22, 38500},
+	{0x04E7, 4, 1, 0, true, false, true, 36, 0x0D, 0x0E, 0x11, true, 17, 38523},
+	{0x04E8, 0, 1, 0, true, true, true, 36, 0xFF, 0xFF, 0x00, false, 30, 38541},
+	{0x0514, 2, 1, 1, true, false, true, 33, 0x11, 0x28, 0x2B, true, 52, 38572},
+	{0x0515, 2, 0, 1, false, false, true, 16, 0x0A, 0x21, 0x24, true, 36, 38625},
+	{0x0516, 0, 0, 1, false, false, true, 16, 0xFF, 0xFF, 0x00, false, 38, 38662},
+	{0x0517, 0, 0, 1, false, false, true, 16, 0xFF, 0xFF, 0x00, false, 38, 38701},
+	{0x0518, 2, 0, 1, false, false, true, 16, 0x04, 0x1B, 0x1E, true, 30, 38740},
+	{0x0519, 0, 0, 0, false, false, true, 16, 0xFF, 0xFF, 0x00, false, 33, 38771},
+	{0x051A, 3, 1, 0, true, false, true, 33, 0x00, 0x01, 0x13, true, 23, 38805},
+	{0x051B, 2, 0, 1, false, false, true, 16, 0x0B, 0x22, 0x25, true, 37, 38829},
+	{0x051C, 2, 0, 1, false, false, true, 16, 0x0D, 0x24, 0x27, true, 39, 38867},
+	{0x051D, 2, 0, 0, false, false, true, 16, 0x0D, 0x24, 0x27, true, 39, 38907},
+	{0x051E, 2, 0, 0, false, false, true, 16, 0x0D, 0x24, 0x27, true, 39, 38947},
+	{0x051F, 3, 1, 0, true, false, true, 35, 0x00, 0x01, 0x13, true, 44, 38987},
+	{0x0520, 2, 0, 1, false, false, true, 16, 0x11, 0x28, 0x2B, true, 43, 39032},
+	{0x0521, 0, 0, 0, true, true, true, 16, 0xFF, 0xFF, 0x00, false, 19, 39076},
+	{0x0522, 0, 2, 0, false, false, false, 16, 0xFF, 0xFF, 0x00, false, 17, 39096},
+	{0x0523, 3, 1, 1, true, false, true, 33, 0x00, 0x01, 0x13, true, 29, 39114},
+	{0x0524, 3, 1, 0, true, false, true, 33, 0x00, 0x01, 0x13, true, 30, 39144},
+	{0x0525, 3, 1, 1, true, false, true, 33, 0x00, 0x01, 0x13, true, 32, 39175},
+	{0x0526, 2, 0, 0, false, false, true, 16, 0x13, 0x17, 0x1A, true, 26, 39208},
+	{0x0527, 0, 0, 1, false, false, true, 16, 0xFF, 0xFF, 0x00, false, 27, 39235},
+	{0x0528, 0, 0, 1, false, false, true, 16, 0xFF, 0xFF, 0x00, false, 27, 39263},
+	{0x0529, 0, 0, 0, false, false, true, 16, 0xFF, 0xFF, 0x00, false, 28, 39291},
+	{0x052A, 2, 0, 1, false, false, true, 16, 0x0A, 0x21, 0x24, true, 36, 39320},
+	{0x052B, 2, 0, 0, false, false, true, 16, 0x0D, 0x24, 0x27, true, 39, 39357},
+	{0x052C, 2, 0, 0, false, false, true, 16, 0x0D, 0x24, 0x27, true, 39, 39397},
+	{0x052D, 0, 0, 0, false, false, false, 16, 0xFF, 0xFF, 0x00, false, 13, 39437},
+	{0x052E, 2, 0, 1, false, false, true, 16, 0x0B, 0x22, 0x25, true, 37, 39451},
+	{0x052F, 3, 1, 1, true, false, true, 33, 0x00, 0x01, 0x13, true, 30, 39489},
+	{0x0530, 3, 1, 0, true, false, true, 35, 0x00, 0x01, 0x13, true, 37, 39520},
+	{0x0531, 3, 1, 0, true, false, true, 35, 0x00, 0x01, 0x13, true, 37, 39558},
+	{0x0532, 3, 1, 0, true, false, true, 35, 0x00, 0x01, 0x13, true, 37, 39596},
+	{0x0533, 3, 1, 0, true, false, true, 35, 0x00, 0x01, 0x13, true, 42, 39634},
+	{0x0534, 0, 0, 0, true, false, true, 9, 0xFF, 0xFF, 0x00, false, 10, 39677},
+	{0x0535, 3, 1, 0, true, false, true, 35, 0x00, 0x01, 0x13, true, 24, 39688},
+	{0x0536, 3, 1, 0, true, false, true, 35, 0x00, 0x01, 0x13, true, 38, 39713},
+	{0x0537, 3, 1, 0, true, false, true, 35, 0x00, 0x01, 0x13, true, 40, 39752},
+	{0x0538, 3, 1, 0, true, false, true, 35, 0x00, 0x01, 0x13, true, 37, 39793},
+	{0x0539, 2, 0, 1, false, false, true, 16, 0x0D, 0x24, 0x27, true, 55, 39831},
+	{0x053A, 0, 0, 1, true, false, true, 9, 0xFF, 0xFF, 0x00, false, 35, 39887},
+	{0x053B, 0, 1, 0, true, true, true, 35, 0xFF, 0xFF, 0x00, false, 20, 39923},
+	{0x053C, 2, 0, 0, false, false, true, 16, 0x12, 0x29, 0x2C, true, 44, 39944},
+	{0x0541, 0, 0, 0, false, true, true, 16, 0xFF, 0xFF, 0x00, false, 12, 39989},
+	{0x0542, 0, 0, 0, false, true, true, 16, 0xFF, 0xFF, 0x00, false, 22, 40002},
+	{0x0547, 6, 1, 0, true, false, true, 37, 0x14, 0x18, 0x1B, true, 27, 40025},
+	{0x0548, 6, 1, 0, true, false, true, 37, 0x05, 0x1A, 0x1D, true, 29, 40053},
+	{0x0549, 6, 1, 0, true, false, true, 37, 0x06, 0x1B, 0x1E, true, 30, 40083},
+	{0x054A, 6, 1, 0, true, false, true, 37, 0x06, 0x1B, 0x1E, true, 30, 40114},
+	{0x054B, 6, 1, 0, true, false, true, 37, 0x06, 0x1B, 0x1E, true, 30, 40145},
+	{0x054C, 6, 1, 0, true, false, true, 37, 0x06, 0x1B, 0x1E, true, 30, 40176},
+	{0x054D, 6, 1, 0, true, false, true, 37, 0x0B, 0x20, 0x23, true, 35, 40207},
+	{0x054E, 0, 2, 0, false, false, false, 37, 0xFF, 0xFF, 0x00, false, 17, 40243},
+	{0x054F, 6, 1, 0, true, false, true, 37, 0x13, 0x17, 0x1A, true, 26, 40261},
+	{0x0550, 6, 1, 0, true, false, true, 37, 0x1C, 0x20, 0x23, true, 35, 40288},
+	{0x0551, 6, 1, 0, true, false, true, 37, 0x0C, 0x0D, 0x10, true, 16, 40324},
+	{0x0552, 6, 1, 0, true, false, true, 37, 0x27, 0x28, 0x2B, true, 43, 40341},
+	{0x0554, 6, 1, 0, true, false, true, 37, 0x0D, 0x14, 0x17, true, 23, 40385},
+	{0x0555, 6, 1, 0, true, false, true, 37, 0x0D, 0x11, 0x14, true, 20, 40409},
+	{0x0579, 6, 1, 0, true, false, true, 37, 0x14, 0x18, 0x1B, true, 27, 40430},
+	{0x057A, 6, 1, 0, true, false, true, 37, 0x0A, 0x1F, 0x22, true, 34, 40458},
+	{0x057B, 6, 1, 0, true, false, true, 37, 0x05, 0x1A, 0x1D, true, 29, 40493},
+	{0x057C, 6, 1, 0, true, false, true, 37, 0x05, 0x1A, 0x1D, true, 29, 40523},
+	{0x057D, 6, 1, 0, true, false, true, 37, 0x05, 0x1A, 0x1D, true, 29, 40553},
+	{0x057E, 6, 1, 0, true, false, true, 37, 0x05, 0x1A, 0x1D, true, 29, 40583},
+	{0x057F, 6, 1, 0, true, false, true, 37, 0x0A, 0x1F, 0x22, true, 34, 40613},
+	{0x0580, 0, 1, 0, true, false, true, 37, 0xFF, 0xFF, 0x00, false, 34, 40648},
+	{0x05A9, 0, 0, 0, false, false, true, 18, 0xFF, 0xFF, 0x00, false, 30, 40683},
+	{0x05AA, 0, 0, 0, true, false, true, 18, 0xFF, 0xFF, 0x00, false, 28, 40714},
+	{0x05AB, 0, 0, 0, false, false, true, 18, 0xFF, 0xFF, 0x00, false, 5, 40743},
+	{0x05AC, 0, 0, 0, true, false, true, 18, 0xFF, 0xFF, 0x00, false, 10, 40749},
+	{0x05AD, 0, 0, 0, false, false, true, 18, 0xFF, 0xFF, 0x00, false, 17, 40760},
+	{0x05AE, 0, 0, 0, false, false, true, 18, 0xFF, 0xFF, 0x00, false, 9, 40778},
+	{0x05AF, 0, 0, 0, false, false, true, 18, 0xFF, 0xFF, 0x00, false, 17, 40788},
+	{0x05B0, 0, 0, 0, false, false, true, 18, 0xFF, 0xFF, 0x00, false, 10, 40806},
+	{0x05B1, 0, 0, 0, false, false, true, 18, 0xFF, 0xFF, 0x00, false, 13, 40817},
+	{0x05B2, 0, 0, 0, false, false, true, 18, 0xFF, 0xFF, 0x00, false, 10, 40831},
+	{0x05B3, 0, 0, 0, false, false, true, 18, 0xFF, 0xFF, 0x00, false, 14, 40842},
+	{0x05B4, 0, 0, 0, false, false, true, 18, 0xFF, 0xFF, 0x00, false, 15, 40857},
+	{0x05B5, 0, 0, 0, false, false, true, 18, 0xFF, 0xFF, 0x00, false, 8, 40873},
+	{0x05B6, 0, 0, 0, false, false, true, 18, 0xFF, 0xFF, 0x00, false, 12, 40882},
+	{0x05B7, 0, 0, 0, false, false, true, 18, 0xFF, 0xFF, 0x00, false, 11, 40895},
+	{0x05B8, 0, 0, 0, false, false, true, 18, 0xFF, 0xFF, 0x00, false, 12, 40907},
+	{0x05B9, 0, 0, 0, false, false, true, 18, 0xFF, 0xFF, 0x00, false, 17, 40920},
+	{0x05BA, 0, 0, 0, false, false, true, 18, 0xFF, 0xFF, 0x00, false, 20, 40938},
+	{0x05BB, 0, 0, 0, false, false, true, 18, 0xFF, 0xFF, 0x00, false, 21, 40959},
+	{0x05BC, 0, 0, 0, false, false, true, 18, 0xFF, 0xFF, 0x00, false, 7, 40981},
+	{0x05BD, 0, 0, 0, true, false, true, 18, 0xFF, 0xFF, 0x00, false, 10, 40989},
+	{0x05BE, 0, 0, 0, false, false, true, 18, 0xFF, 0xFF, 0x00, false, 10, 41000},
+	{0x05BF, 0, 0, 1, false, false, true, 13, 0xFF, 0xFF, 0x00, false, 29, 41011},
+	{0x05C0, 0, 0, 0, false, false, true, 13, 0xFF, 0xFF, 0x00, false, 17, 41041},
+	{0x05C1, 0, 0, 0, false, false, true, 13, 0xFF, 0xFF, 0x00, false, 19, 41059},
+	{0x05C2, 0, 0, 0, false, false, true, 13, 0xFF, 0xFF, 0x00, false, 19, 41079},
+	{0x05C3, 0, 0, 1, true, false, true, 18, 0xFF, 0xFF, 0x00, false, 6, 41099},
+	{0x05C4, 0, 0, 1, false, false, true, 19, 0xFF, 0xFF, 0x00, false, 17, 41106},
+	{0x05C5, 0, 0, 0, true, false, true, 19, 0xFF, 0xFF, 0x00, false, 17, 41124},
+	{0x05C6, 0, 0, 1, true, false, true, 19, 0xFF, 0xFF, 0x00, false, 18, 41142},
+	{0x05C7, 0, 0, 2, false, true, true, 19, 0xFF, 0xFF, 0x00, false, 26, 41161},
+	{0x05C8, 0, 0, 1, false, false, true, 19, 0xFF, 0xFF, 0x00, false, 15, 41188},
+	{0x05C9, 0, 0, 2, false, true, true, 19, 0xFF, 0xFF, 0x00, false, 16, 41204},
+	{0x05CA, 0, 0, 1, false, false, true, 13, 0xFF, 0xFF, 0x00, false, 25, 41221},
+	{0x05CB, 0, 0, 1, false, false, true, 13, 0xFF, 0xFF, 0x00, false, 27, 41247},
+	{0x05CC, 0, 0, 1, false, false, true, 13, 0xFF, 0xFF, 0x00, false, 27, 41275},
+	{0x05CD, 0, 0, 1, false, false, true, 9, 0xFF, 0xFF, 0x00, false, 31, 41303},
+	{0x05CE, 5, 0, 1, false, false, false, 20, 0x1A, 0x1B, 0x1E, true, 30, 41335},
+	{0x05CF, 5, 1, 1, false, false, false, 20, 0x1A, 0x1B, 0x1E, true, 39, 41366},
+	{0x05D0, 5, 0, 1, true, false, false, 20, 0x1F, 0x20, 0x23, true, 35, 41406},
+	{0x05D1, 5, 0, 0, false, false, false, 20, 0x1A, 0x1B, 0x1E, true, 30, 41442},
+	{0x05D2, 5, 1, 0, false, false, false, 20, 0x1A, 0x1B, 0x1E, true, 39, 41473},
+	{0x05D3, 5, 0, 1, true, false, false, 20, 0x1F, 0x20, 0x23, true, 35, 41513},
+	{0x05D4, 0, 0, 0, false, true, true, 19, 0xFF, 0xFF, 0x00, false, 24, 41549},
+	{0x05D5, 0, 0, 0, false, true, true, 18, 0xFF, 0xFF, 0x00, false, 22, 41574},
+	{0x05D6, 0, 0, 1, false, false, true, 19, 0xFF, 0xFF, 0x00, false, 10, 41597},
+	{0x05D7, 0, 0, 0, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 25, 41608},
+	{0x05D8, 0, 0, 0, false, true, true, 18, 0xFF, 0xFF, 0x00, false, 26, 41634},
+	{0x05D9, 0, 0, 0, false, false, true, 18, 0xFF, 0xFF, 0x00, false, 29, 41661},
+	{0x05DA, 0, 0, 1, false, false, false, 13, 0xFF, 0xFF, 0x00, false, 23, 41691},
+	{0x05DB, 0, 0, 1, false, false, false, 13, 0xFF, 0xFF, 0x00, false, 25, 41715},
+	{0x05DC, 0, 0, 2, false, false, true, 19, 0xFF, 0xFF, 0x00, false, 27, 41741},
+	{0x05DD, 0, 0, 0, true, false, true, 18, 0xFF, 0xFF, 0x00, false, 11, 41769},
+	{0x05DE, 0, 0, 0, false, false, true, 18, 0xFF, 0xFF, 0x00, false, 20, 41781},
+	{0x05DF, 0, 0, 0, false, false, true, 18, 0xFF, 0xFF, 0x00, false, 4, 41802},
+	{0x05E0, 0, 0, 0, false, false, true, 18, 0xFF, 0xFF, 0x00, false, 8, 41807},
+	{0x05E1, 0, 0, 0, true, false, true, 18, 0xFF, 0xFF, 0x00, false, 10, 41816},
+	{0x05E2, 0, 0, 0, false, false, true, 18, 0xFF, 0xFF, 0x00, false, 4, 41827},
+	{0x05E3, 0, 0, 0, false, false, true, 18, 0xFF, 0xFF, 0x00, false, 6, 41832},
+	{0x05E4, 0, 0, 0, false, false, true, 18, 0xFF, 0xFF, 0x00, false, 16, 41839},
+	{0x05E5, 0, 0, 0, false, false, true, 18, 0xFF, 0xFF, 0x00, false, 14, 41856},
+	{0x05E6, 0, 0, 0, false, false, true, 18, 0xFF, 0xFF, 0x00, false, 6, 41871},
+	{0x05E7, 0, 0, 0, false, false, true, 18, 0xFF, 0xFF, 0x00, false, 5, 41878},
+	{0x05E8, 0, 0, 0, false, false, true, 18, 0xFF, 0xFF, 0x00, false, 5, 41884},
+	{0x05E9, 0, 0, 0, false, false, true, 18, 0xFF, 0xFF, 0x00, false, 13, 41890},
+	{0x05EA, 0, 0, 1, false, false, true, 18, 0xFF, 0xFF, 0x00, false, 18, 41904},
+	{0x05EB, 0, 0, 0, false, false, true, 19, 0xFF, 0xFF, 0x00, false, 14, 41923},
+	{0x05EC, 0, 0, 1, false, false, true, 19, 0xFF, 0xFF, 0x00, false, 10, 41938},
+	{0x05ED, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 31, 41949},
+	{0x05EE, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 41, 41981},
+	{0x05EF, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 28, 42023},
+	{0x05F0, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 38, 42052},
+	{0x05F1, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 25, 42091},
+	{0x05F2, 0, 1, 1, false, false, false, 2, 0xFF, 0xFF, 0x00, false, 34, 42117},
+	{0x05F3, 0, 0, 0, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 26, 42152},
+	{0x05F4, 0, 1, 0, false, false, false, 2, 0xFF, 0xFF, 0x00, false, 35, 42179},
+	{0x05F5, 0, 0, 0, false, true, false, 1, 0xFF, 0xFF, 0x00, false, 35, 42215},
+	{0x05F6, 0, 0, 0, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 32, 42251},
+	{0x05F7, 0, 0, 1, false, false, false, 9, 0xFF, 0xFF, 0x00, false, 25, 42284},
+	{0x05F8, 5, 0, 0, false, false, false, 20, 0x14, 0x15, 0x18, true, 24, 42310},
+	{0x05F9, 5, 1, 1, false, false, false, 20, 0x14, 0x15, 0x18, true, 33, 42335},
+	{0x05FA, 5, 0, 1, true, false, false, 20, 0x19, 0x1A, 0x1D, true, 29, 42369},
+	{0x05FB, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 34, 42399},
+	{0x05FC, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 44, 42434},
+	{0x05FD, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 31, 42479},
+	{0x05FE, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 41, 42511},
+	{0x05FF, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 28, 42553},
+	{0x0600, 0, 1, 1, false, false, false, 2, 0xFF, 0xFF, 0x00, false, 37, 42582},
+	{0x0601, 0, 0, 0, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 29, 42620},
+	{0x0602, 0, 1, 0, false, false, false, 2, 0xFF, 0xFF, 0x00, false, 38, 42650},
+	{0x0603, 0, 0, 0, false, true, false, 1, 0xFF, 0xFF, 0x00, false, 38, 42689},
+	{0x0604, 0, 0, 0, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 35, 42728},
+	{0x0605, 0, 0, 1, false, false, false, 9, 0xFF, 0xFF, 0x00, false, 28, 42764},
+	{0x0606, 5, 0, 0, false, false, false, 20, 0x17, 0x18, 0x1B, true, 27, 42793},
+	{0x0607, 5, 1, 0, false, false, false, 20, 0x17, 0x18, 0x1B, true, 36, 42821},
+	{0x0608, 5, 0, 1, false, false, false, 20, 0x1C, 0x1D, 0x20, true, 32, 42858},
+	{0x0609, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 24, 42891},
+	{0x060A, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 34, 42916},
+	{0x060B, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 21, 42951},
+	{0x060C, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 31, 42973},
+	{0x060D, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 18, 43005},
+	{0x060E, 0, 1, 1, false, false, false, 2, 0xFF, 0xFF, 0x00, false, 27, 43024},
+	{0x060F, 0, 0, 0, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 19, 43052},
+	{0x0610, 0, 1, 0, false, false, false, 2, 0xFF, 0xFF, 0x00, false, 28, 43072},
+	{0x0611, 0, 0, 0, false, true, false, 1, 0xFF, 0xFF, 0x00, false, 28, 43101},
+	{0x0612, 0, 0, 0, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 25, 43130},
+	{0x0613, 0, 0, 1, false, false, false, 9, 0xFF, 0xFF, 0x00, false, 18, 43156},
+	{0x0614, 5, 0, 0, false, false, false, 20, 0x0D, 0x0E, 0x11, true, 17, 43175},
+	{0x0615, 5, 1, 0, false, false, false, 20, 0x0D, 0x0E, 0x11, true, 26, 43193},
+	{0x0616, 5, 0, 1, false, false, false, 20, 0x12, 0x13, 0x16, true, 22, 43220},
+	{0x0617, 0, 0, 1, false, false, false, 9, 0xFF, 0xFF, 0x00, false, 20, 43243},
+	{0x0618, 5, 0, 0, false, false, false, 20, 0x0F, 0x10, 0x13, true, 19, 43264},
+	{0x0619, 5, 1, 1, false, false, false, 20, 0x0F, 0x10, 0x13, true, 28, 43284},
+	{0x061A, 5, 0, 1, false, false, false, 20, 0x14, 0x15, 0x18, true, 24, 43313},
+	{0x061B, 0, 0, 1, false, false, false, 9, 0xFF, 0xFF, 0x00, false, 20, 43338},
+	{0x061C, 5, 0, 1, false, false, false, 20, 0x0F, 0x10, 0x13, true, 19, 43359},
+	{0x061D, 5, 1, 1, false, false, false, 20, 0x0F, 0x10, 0x13, true, 28, 43379},
+	{0x061E, 5, 0, 1, true, false, false, 20, 0x14, 0x15, 0x18, true, 24, 43408},
+	{0x061F, 0, 0, 1, false, false, false, 9, 0xFF, 0xFF, 0x00, false, 27, 43433},
+	{0x0620, 5, 0, 0, false, false, false, 20, 0x16, 0x17, 0x1A, true, 26, 43461},
+	{0x0621, 5, 1, 1, false, false, false, 20, 0x16, 0x17, 0x1A, true, 35, 43488},
+	{0x0622, 5, 0, 1, false, false, false, 20, 0x1B, 0x1C, 0x1F, true, 31, 43524},
+	{0x0623, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 34, 43556},
+	{0x0624, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 44, 43591},
+	{0x0625, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 31, 43636},
+	{0x0626, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 41, 43668},
+	{0x0627, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 28, 43710},
+	{0x0628, 0, 1, 1, false, false, false, 2, 0xFF, 0xFF, 0x00, false, 37, 43739},
+	{0x0629, 0, 0, 0, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 29, 43777},
+	{0x062A, 0, 1, 0, false, false, false, 2, 0xFF, 0xFF, 0x00, false, 38, 43807},
+	{0x062B, 0, 0, 0, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 35, 43846},
+	{0x062C, 0, 0, 1, false, false, false, 9, 0xFF, 0xFF, 0x00, false, 28, 43882},
+	{0x062D, 5, 0, 0, false, false, false, 20, 0x17, 0x18, 0x1B, true, 27, 43911},
+	{0x062E, 5, 1, 0, false, false, false, 20, 0x17, 0x18, 0x1B, true, 36, 43939},
+	{0x062F, 5, 0, 1, false, false, false, 20, 0x1C, 0x1D, 0x20, true, 32, 43976},
+	{0x0630, 0, 0, 0, false, true, false, 1, 0xFF, 0xFF, 0x00, false, 30, 44009},
+	{0x0631, 0, 2, 0, false, false, false, 18, 0xFF, 0xFF, 0x00, false, 17, 44040},
+	{0x0632, 0, 0, 0, false, true, false, 1, 0xFF, 0xFF, 0x00, false, 38, 44058},
+	{0x0633, 0, 0, 0, false, true, true, 19, 0xFF, 0xFF, 0x00, false, 26, 44097},
+	{0x0634, 0, 0, 0, true, true, true, 19, 0xFF, 0xFF, 0x00, false, 25, 44124},
+	{0x0635, 0, 2, 0, false, false, false, 2, 0xFF, 0xFF, 0x00, false, 17, 44150},
+	{0x0636, 0, 0, 0, true, false, true, 18, 0xFF, 0xFF, 0x00, false, 20, 44168},
+	{0x0637, 0, 0, 0, true, true, true, 18, 0xFF, 0xFF, 0x00, false, 45, 44189},
+	{0x0638, 0, 0, 0, false, false, true, 18, 0xFF, 0xFF, 0x00, false, 15, 44235},
+	{0x0639, 0, 0, 0, false, false, true, 18, 0xFF, 0xFF, 0x00, false, 13, 44251},
+	{0x063A, 0, 0, 0, false, false, true, 18, 0xFF, 0xFF, 0x00, false, 15, 44265},
+	{0x063B, 0, 0, 0, false, false, true, 18, 0xFF, 0xFF, 0x00, false, 9, 44281},
+	{0x063C, 0, 0, 0, false, false, true, 18, 0xFF, 0xFF, 0x00, false, 7, 44291},
+	{0x063D, 0, 0, 0, false, false, true, 18, 0xFF, 0xFF, 0x00, false, 11, 44299},
+	{0x0641, 5, 0, 0, false, false, false, 20, 0x07, 0x08, 0x0B, true, 11, 44311},
+	{0x0642, 0, 0, 0, false, false, false, 20, 0xFF, 0xFF, 0x00, false, 23, 44323},
+	{0x0643, 0, 0, 0, false, false, false, 20, 0xFF, 0xFF, 0x00, false, 23, 44347},
+	{0x0644, 0, 0, 0, false, false, false, 20, 0xFF, 0xFF, 0x00, false, 21, 44371},
+	{0x0645, 0, 0, 1, false, false, false, 20, 0xFF, 0xFF, 0x00, false, 22, 44393},
+	{0x0646, 0, 0, 1, false, false, false, 20, 0xFF, 0xFF, 0x00, false, 23, 44416},
+	{0x0647, 5, 1, 0, false, false, false, 20, 0x07, 0x08, 0x0B, true, 20, 44440},
+	{0x0648, 5, 0, 1, false, false, false, 20, 0x0C, 0x0D, 0x10, true, 16, 44461},
+	{0x0649, 5, 0, 0, false, false, false, 20, 0x07, 0x08, 0x0B, true, 30, 44478},
+	{0x064A, 0, 0, 0, false, false, false, 20, 0xFF, 0xFF, 0x00, false, 45, 44509},
+	{0x064B, 0, 0, 0, false, false, false, 20, 0xFF, 0xFF, 0x00, false, 45, 44555},
+	{0x064C, 0, 0, 0, false, false, false, 20, 0xFF, 0xFF, 0x00, false, 43, 44601},
+	{0x064D, 0, 0, 1, false, false, false, 20, 0xFF, 0xFF, 0x00, false, 44, 44645},
+	{0x064E, 0, 0, 1, false, false, false, 20, 0xFF, 0xFF, 0x00, false, 45, 44690},
+	{0x064F, 7, 0, 1, true, true, false, 21, 0x12, 0x19, 0x1C, true, 28, 44736},
+	{0x0650, 7, 0, 0, true, true, false, 21, 0x00, 0x01, 0x04, true, 22, 44765},
+	{0x0651, 7, 0, 0, true, true, false, 21, 0x00, 0x01, 0x04, true, 28, 44788},
+	{0x0652, 7, 0, 0, true, true, false, 21, 0x00, 0x01, 0x04, true, 47, 44817},
+	{0x0653, 0, 0, 0, true, true, true, 21, 0xFF, 0xFF, 0x00, false, 23, 44865},
+	{0x0654, 0, 2, 0, false, false, false, 20, 0xFF, 0xFF, 0x00, false, 17, 44889},
+	{0x0655, 0, 0, 0, false, false, false, 20, 0xFF, 0xFF, 0x00, false, 22, 44907},
+	{0x0656, 0, 0, 0, false, false, false, 20, 0xFF, 0xFF, 0x00, false, 23, 44930},
+	{0x0657, 0, 0, 0, false, false, false, 20, 0xFF, 0xFF, 0x00, false, 23, 44954},
+	{0x0658, 0, 0, 0, false, false, false, 20, 0xFF, 0xFF, 0x00, false, 23, 44978},
+	{0x0659, 0, 0, 0, false, false, false, 20, 0xFF, 0xFF, 0x00, false, 23, 45002},
+	{0x065A, 0, 0, 0, false, false, false, 20, 0xFF, 0xFF, 0x00, false, 23, 45026},
+	{0x065B, 0, 0, 1, false, false, false, 20, 0xFF, 0xFF, 0x00, false, 23, 45050},
+	{0x065C, 0, 0, 1, false, false, false, 20, 0xFF, 0xFF, 0x00, false, 24, 45074},
+	{0x065D, 0, 0, 1, true, false, false, 20, 0xFF, 0xFF, 0x00, false, 23, 45099},
+	{0x065E, 0, 0, 1, true, false, false, 20, 0xFF, 0xFF, 0x00, false, 23, 45123},
+	{0x065F, 5, 0, 1, true, false, false, 20, 0x11, 0x12, 0x15, true, 21, 45147},
+	{0x0660, 0, 0, 0, false, false, false, 20, 0xFF, 0xFF, 0x00, false, 28, 45169},
+	{0x0661, 0, 0, 0, false, true, false, 21, 0xFF, 0xFF, 0x00, false, 28, 45198},
+	{0x0662, 0, 0, 0, false, false, false, 21, 0xFF, 0xFF, 0x00, false, 13, 45227},
+	{0x0663, 7, 0, 1, false, true, true, 21, 0x24, 0x2B, 0x2E, true, 46, 45241},
+	{0x0664, 7, 0, 0, false, true, true, 21, 0x2C, 0x33, 0x36, true, 54, 45288},
+	{0x0665, 7, 0, 1, false, true, true, 21, 0x1E, 0x25, 0x28, true, 40, 45343},
+	{0x0666, 7, 0, 1, false, true, true, 21, 0x1C, 0x23, 0x26, true, 38, 45384},
+	{0x0667, 7, 0, 1, false, true, true, 21, 0x1B, 0x22, 0x25, true, 37, 45423},
+	{0x0668, 7, 0, 0, false, true, true, 21, 0x1A, 0x21, 0x24, true, 36, 45461},
+	{0x0669, 7, 0, 0, false, true, true, 21, 0x1F, 0x26, 0x29, true, 41, 45498},
+	{0x066A, 5, 0, 0, false, false, false, 20, 0x07, 0x08, 0x0B, true, 33, 45540},
+	{0x066B, 5, 0, 0, false, false, false, 20, 0x07, 0x08, 0x0B, true, 21, 45574},
+	{0x066C, 7, 0, 0, true, true, false, 21, 0x00, 0x01, 0x04, true, 50, 45596},
+	{0x066D, 7, 0, 0, true, true, false, 21, 0x00, 0x01, 0x04, true, 38, 45647},
+	{0x066E, 7, 1, 0, false, true, false, 22, 0x0F, 0x10, 0x13, true, 41, 45686},
+	{0x066F, 7, 1, 0, false, true, false, 22, 0x0F, 0x10, 0x13, true, 29, 45728},
+	{0x0670, 0, 0, 0, false, true, false, 20, 0xFF, 0xFF, 0x00, false, 14, 45758},
+	{0x0671, 7, 0, 1, false, true, true, 21, 0x24, 0x2B, 0x2E, true, 46, 45773},
+	{0x0672, 5, 1, 0, false, false, false, 20, 0x07, 0x08, 0x0B, true, 20, 45820},
+	{0x0673, 7, 0, 1, false, true, true, 21, 0x22, 0x29, 0x2C, true, 44, 45841},
+	{0x0674, 0, 1, 0, false, false, false, 21, 0xFF, 0xFF, 0x00, false, 22, 45886},
+	{0x0675, 0, 1, 1, false, false, false, 20, 0xFF, 0xFF, 0x00, false, 20, 45909},
+	{0x0676, 0, 1, 1, true, false, false, 20, 0xFF, 0xFF, 0x00, false, 25, 45930},
+	{0x0677, 7, 0, 1, true, true, false, 21, 0x1A, 0x21, 0x24, true, 36, 45956},
+	{0x0678, 7, 1, 0, false, true, false, 22, 0x0D, 0x0E, 0x11, true, 17, 45993},
+	{0x0679, 5, 0, 0, false, false, true, 21, 0x20, 0x21, 0x24, true, 36, 46011},
+	{0x067A, 5, 0, 0, false, false, true, 21, 0x1F, 0x20, 0x23, true, 35, 46048},
+	{0x067B, 0, 0, 0, false, false, true, 21, 0xFF, 0xFF, 0x00, false, 30, 46084},
+	{0x067C, 0, 0, 0, true, true, true, 21, 0xFF, 0xFF, 0x00, false, 40, 46115},
+	{0x067D, 7, 0, 1, false, true, true, 21, 0x1C, 0x23, 0x26, true, 38, 46156},
+	{0x067E, 5, 0, 0, false, false, false, 22, 0x18, 0x19, 0x1C, true, 28, 46195},
+	{0x067F, 0, 1, 0, false, false, false, 20, 0xFF, 0xFF, 0x00, false, 28, 46224},
+	{0x0680, 0, 0, 0, false, false, false, 18, 0xFF, 0xFF, 0x00, false, 25, 46253},
+	{0x0690, 5, 1, 0, true, false, false, 38, 0x07, 0x08, 0x0B, true, 31, 46279},
+	{0x0691, 0, 1, 1, true, false, false, 38, 0xFF, 0xFF, 0x00, false, 43, 46311},
+	{0x0692, 5, 1, 1, true, false, false, 38, 0x15, 0x16, 0x19, true, 45, 46355},
+	{0x0693, 5, 1, 0, true, false, false, 38, 0x12, 0x13, 0x16, true, 42, 46401},
+	{0x0694, 5, 1, 1, true, false, false, 38, 0x11, 0x12, 0x15, true, 41, 46444},
+	{0x0695, 5, 1, 1, true, false, false, 38, 0x14, 0x15, 0x18, true, 44, 46486},
+	{0x0696, 5, 1, 1, true, false, false, 38, 0x0F, 0x10, 0x13, true, 39, 46531},
+	{0x0697, 0, 1, 1, true, false, false, 38, 0xFF, 0xFF, 0x00, false, 61, 46571},
+	{0x0698, 0, 1, 1, true, false, false, 38, 0xFF, 0xFF, 0x00, false, 31, 46633},
+	{0x0699, 0, 1, 1, true, false, false, 38, 0xFF, 0xFF, 0x00, false, 36, 46665},
+	{0x069A, 0, 1, 0, true, true, true, 38, 0xFF, 0xFF, 0x00, false, 24, 46702},
+	{0x069B, 0, 2, 0, false, false, false, 38, 0xFF, 0xFF, 0x00, false, 17, 46727},
+	{0x069F, 5, 0, 0, false, false, false, 22, 0x12, 0x13, 0x16, true, 22, 46745},
+	{0x06A0, 5, 1, 0, false, false, false, 22, 0x13, 0x14, 0x17, true, 23, 46768},
+	{0x06A4, 0, 0, 1, false, false, false, 12, 0x00, 0x01, 0x04, true, 39, 46792},
+	{0x06A5, 0, 0, 2, false, true, true, 23, 0x00, 0x01, 0x04, true, 36, 46832},
+	{0x06A6, 0, 0, 1, false, true, true, 23, 0xFF, 0xFF, 0x00, false, 33, 46869},
+	{0x06A7, 0, 2, 0, false, false, false, 23, 0xFF, 0xFF, 0x00, false, 17, 46903},
+	{0x06A8, 0, 0, 1, false, true, false, 23, 0x00, 0x01, 0x04, true, 23, 46921},
+	{0x06A9, 0, 0, 1, false, false, false, 23, 0x00, 0x01, 0x04, true, 41, 46945},
+	{0x06AA, 0, 0, 1, false, false, false, 23, 0x00, 0x01, 0x04, true, 23, 46987},
+	{0x06AB, 0, 0, 2, false, false, false, 23, 0x00, 0x01, 0x04, true, 34, 47011},
+	{0x06AC, 0, 0, 2, false, true, false, 23, 0x11, 0x1C, 0x28, true, 40, 47046},
+	{0x06AD, 0, 0, 1, false, false, false, 12, 0xFF, 0xFF, 0x00, false, 38, 47087},
+	{0x06AE, 0, 0, 1, false, true, false, 23, 0xFF, 0xFF, 0x00, false, 35, 47126},
+	{0x06AF, 0, 0, 1, false, true, false, 23, 0xFF, 0xFF, 0x00, false, 33, 47162},
+	{0x06B0, 0, 0, 0, false, true, false, 12, 0xFF, 0xFF, 0x00, false, 12, 47196},
+	{0x06B8, 0, 0, 0, false, false, true, 21, 0xFF, 0xFF, 0x00, false, 23, 47209},
+	{0x06B9, 0, 0, 1, false, false, true, 21, 0xFF, 0xFF, 0x00, false, 39, 47233},
+	{0x06C3, 0, 0, 1, false, false, false, 24, 0x00, 0x01, 0x04, true, 29, 47273},
+	{0x06C4, 0, 0, 1, false, false, false, 24, 0x00, 0x01, 0x04, true, 25, 47303},
+	{0x06C5, 0, 0, 1, false, false, false, 24, 0x00, 0x01, 0x04, true, 25, 47329},
+	{0x06C6, 0, 0, 1, false, false, false, 24, 0x00, 0x01, 0x04, true, 28, 47355},
+	{0x06C7, 0, 0, 1, false, false, false, 24, 0x00, 0x01, 0x04, true, 36, 47384},
+	{0x06C8, 0, 0, 1, false, false, false, 23, 0x00, 0x01, 0x04, true, 52, 47421},
+	{0x06C9, 0, 0, 1, false, false, false, 24, 0x00, 0x01, 0x04, true, 22, 47474},
+	{0x06CA, 0, 0, 1, false, false, false, 24, 0x00, 0x01, 0x04, true, 31, 47497},
+	{0x06CB, 0, 0, 1, false, false, false, 24, 0x00, 0x01, 0x04, true, 31, 47529},
+	{0x06CC, 5, 0, 1, false, false, false, 20, 0x2B, 0x2C, 0x2F, true, 47, 47561},
+	{0x06CD, 5, 0, 1, false, false, false, 20, 0x24, 0x25, 0x28, true, 40, 47609},
+	{0x06D7, 0, 0, 0, false, false, false, 24, 0x00, 0x01, 0x04, true, 21, 47650},
+	{0x06D8, 0, 0, 0, false, false, false, 24, 0x00, 0x01, 0x04, true, 17, 47672},
+	{0x06D9, 0, 0, 0, false, false, false, 24, 0x00, 0x01, 0x04, true, 17, 47690},
+	{0x06DA, 0, 0, 0, false, false, false, 24, 0x00, 0x01, 0x04, true, 20, 47708},
+	{0x06DB, 0, 0, 0, false, false, false, 24, 0x00, 0x01, 0x04, true, 14, 47729},
+	{0x06DC, 5, 0, 1, false, false, false, 20, 0x16, 0x17, 0x1A, true, 26, 47744},
+	{0x06DD, 5, 1, 0, false, false, false, 20, 0x16, 0x17, 0x1A, true, 35, 47771},
+	{0x06DE, 5, 0, 1, false, false, false, 20, 0x1B, 0x1C, 0x1F, true, 31, 47807},
+	{0x06DF, 5, 0, 0, false, false, false, 20, 0x16, 0x17, 0x1A, true, 26, 47839},
+	{0x06E0, 5, 1, 0, false, false, false, 20, 0x0F, 0x10, 0x13, true, 28, 47866},
+	{0x06E1, 5, 0, 1, false, false, false, 20, 0x1B, 0x1C, 0x1F, true, 31, 47895},
+	{0x06E2, 0, 0, 0, false, true, false, 24, 0xFF, 0xFF, 0x00, false, 32, 47927},
+	{0x06E3, 0, 2, 0, false, false, false, 24, 0xFF, 0xFF, 0x00, false, 17, 47960},
+	{0x06E4, 0, 0, 0, false, false, false, 24, 0x00, 0x01, 0x04, true, 28, 47978},
+	{0x06E5, 0, 0, 0, false, false, false, 23, 0x00, 0x01, 0x04, true, 44, 48007},
+	{0x06E6, 0, 0, 0, false, false, false, 24, 0x00, 0x01, 0x04, true, 23, 48052},
+	{0x06E7, 0, 0, 1, false, false, false, 24, 0x00, 0x01, 0x04, true, 36, 48076},
+	{0x06E8, 0, 0, 1, false, false, false, 23, 0xFF, 0xFF, 0x00, false, 70, 48113},
+	{0x06E9, 0, 0, 0, false, true, false, 23, 0xFF, 0xFF, 0x00, false, 30, 48184},
+	{0x06EA, 0, 0, 0, false, true, false, 24, 0xFF, 0xFF, 0x00, false, 14, 48215},
+	{0x06EB, 0, 0, 0, false, true, false, 13, 0xFF, 0xFF, 0x00, false, 15, 48230},
+	{0x06F4, 0, 1, 0, true, false, false, 39, 0xFF, 0xFF, 0x00, false, 33, 48246},
+	{0x06F5, 7, 1, 1, true, true, false, 39, 0x1A, 0x21, 0x24, true, 36, 48280},
+	{0x06F6, 7, 1, 1, true, true, true, 39, 0x2C, 0x33, 0x36, true, 54, 48317},
+	{0x06F7, 7, 1, 1, true, true, true, 39, 0x26, 0x2D, 0x30, true, 48, 48372},
+	{0x06F8, 7, 1, 1, true, true, true, 39, 0x24, 0x2B, 0x2E, true, 46, 48421},
+	{0x06F9, 7, 1, 1, true, true, true, 39, 0x2C, 0x33, 0x36, true, 54, 48468},
+	{0x06FA, 7, 1, 1, true, true, true, 39, 0x2A, 0x31, 0x34, true, 52, 48523},
+	{0x06FB, 0, 1, 1, true, false, true, 39, 0xFF, 0xFF, 0x00, false, 34, 48576},
+	{0x06FC, 7, 1, 1, true, true, true, 39, 0x24, 0x2B, 0x2E, true, 46, 48611},
+	{0x06FD, 0, 1, 0, true, false, true, 39, 0xFF, 0xFF, 0x00, false, 24, 48658},
+	{0x06FE, 0, 2, 0, false, false, false, 39, 0xFF, 0xFF, 0x00, false, 17, 48683},
+	{0x0709, 0, 0, 1, false, false, false, 25, 0xFF, 0xFF, 0x00, false, 30, 48701},
+	{0x070A, 0, 0, 0, false, false, true, 25, 0xFF, 0xFF, 0x00, false, 32, 48732},
+	{0x070B, 0, 0, 0, false, false, true, 25, 0xFF, 0xFF, 0x00, false, 38, 48765},
+	{0x070C, 0, 0, 0, false, false, true, 25, 0x00, 0x01, 0x0C, true, 39, 48804},
+	{0x070D, 0, 0, 1, false, false, true, 25, 0x00, 0x01, 0x0C, true, 47, 48844},
+	{0x070E, 0, 0, 0, false, false, true, 25, 0xFF, 0xFF, 0x00, false, 22, 48892},
+	{0x070F, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 59, 48915},
+	{0x0710, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 69, 48975},
+	{0x0711, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 56, 49045},
+	{0x0712, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 66, 49102},
+	{0x0713, 0, 0, 1, false, false, false, 1, 0x00, 0x01, 0x0C, true, 53, 49169},
+	{0x0714, 0, 1, 1, false, false, false, 2, 0x00, 0x01, 0x0C, true, 62, 49223},
+	{0x0715, 0, 0, 0, false, false, false, 1, 0x00, 0x01, 0x0C, true, 54, 49286},
+	{0x0716, 0, 1, 0, false, false, false, 2, 0x00, 0x01, 0x0C, true, 63, 49341},
+	{0x0717, 0, 0, 0, false, true, false, 1, 0x00, 0x01, 0x0C, true, 63, 49405},
+	{0x0718, 0, 0, 0, false, false, false, 1, 0x00, 0x01, 0x0C, true, 60, 49469},
+	{0x0719, 5, 0, 0, false, false, false, 20, 0x23, 0x24, 0x27, true, 39, 49530},
+	{0x071A, 5, 1, 0, false, false, false, 20, 0x23, 0x24, 0x27, true, 48, 49570},
+	{0x071B, 5, 0, 1, false, false, false, 20, 0x28, 0x29, 0x2C, true, 44, 49619},
+	{0x071C, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 42, 49664},
+	{0x071D, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 52, 49707},
+	{0x071E, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 39, 49760},
+	{0x071F, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 49, 49800},
+	{0x0720, 0, 0, 1, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 36, 49850},
+	{0x0721, 0, 1, 1, false, false, false, 2, 0xFF, 0xFF, 0x00, false, 45, 49887},
+	{0x0722, 0, 0, 0, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 37, 49933},
+	{0x0723, 0, 1, 0, false, false, false, 2, 0xFF, 0xFF, 0x00, false, 46, 49971},
+	{0x0724, 0, 0, 0, false, true, false, 1, 0xFF, 0xFF, 0x00, false, 46, 50018},
+	{0x0725, 0, 0, 0, false, false, false, 1, 0xFF, 0xFF, 0x00, false, 43, 50065},
+	{0x0726, 5, 0, 0, false, false, false, 20, 0x1F, 0x20, 0x23, true, 35, 50109},
+	{0x0727, 5, 1, 0, false, false, false, 20, 0x1F, 0x20, 0x23, true, 44, 50145},
+	{0x0728, 5, 0, 1, false, false, false, 20, 0x24, 0x25, 0x28, true, 40, 50190},
+	{0x0729, 0, 0, 0, false, true, true, 25, 0xFF, 0xFF, 0x00, false, 25, 50231},
+	{0x072A, 0, 0, 0, false, true, true, 25, 0xFF, 0xFF, 0x00, false, 34, 50257},
+	{0x072B, 0, 0, 0, false, true, true, 25, 0xFF, 0xFF, 0x00, false, 24, 50292},
+	{0x072C, 0, 0, 0, false, true, true, 25, 0xFF, 0xFF, 0x00, false, 35, 50317},
+	{0x072D, 0, 2, 0, false, false, false, 25, 0xFF, 0xFF, 0x00, false, 17, 50353},
+	{0x072E, 0, 0, 1, false, false, false, 25, 0xFF, 0xFF, 0x00, false, 38, 50371},
+	{0x072F, 0, 0, 0, false, false, false, 25, 0xFF, 0xFF, 0x00, false, 28, 50410},
+	{0x0730, 0, 0, 0, false, false, false, 25, 0xFF, 0xFF, 0x00, false, 34, 50439},
+	{0x0731, 0, 0, 1, false, false, false, 25, 0xFF, 0xFF, 0x00, false, 42, 50474},
+	{0x0732, 0, 0, 0, false, false, false, 25, 0xFF, 0xFF, 0x00, false, 32, 50517},
+	{0x0733, 0, 0, 0, false, false, false, 25, 0x00, 0x01, 0x0C, true, 45, 50550},
+	{0x0734, 0, 0, 0, false, false, false, 25, 0x00, 0x01, 0x0C, true, 53, 50596},
+	{0x0735, 0, 0, 0, false, false, true, 25, 0x00, 0x01, 0x0C, true, 49, 50650},
+	{0x0736, 0, 0, 1, false, false, true, 25, 0x00, 0x01, 0x0C, true, 57, 50700},
+	{0x0737, 0, 0, 0, false, false, true, 25, 0xFF, 0xFF, 0x00, false, 43, 50758},
+	{0x0738, 0, 0, 1, true, false, true, 25, 0xFF, 0xFF, 0x00, false, 30, 50802},
+	{0x0739, 0, 0, 1, false, false, true, 25, 0xFF, 0xFF, 0x00, false, 30, 50833},
+	{0x073A, 0, 0, 1, false, false, false, 25, 0xFF, 0xFF, 0x00, false, 38, 50864},
+	{0x073B, 9, 0, 0, true, true, false, 26, 0x16, 0x17, 0x1A, true, 26, 50903},
+	{0x073C, 0, 0, 0, true, true, false, 26, 0xFF, 0xFF, 0x00, false, 28, 50930},
+	{0x073E, 0, 0, 0, true, true, true, 9, 0xFF, 0xFF, 0x00, false, 37, 50959},
+	{0x073F, 0, 0, 0, false, true, true, 28, 0xFF, 0xFF, 0x00, false, 37, 50997},
+	{0x0740, 7, 0, 0, false, true, true, 28, 0x21, 0x28, 0x2B, true, 43, 51035},
+	{0x0741, 0, 2, 0, false, false, false, 26, 0xFF, 0xFF, 0x00, false, 17, 51079},
+	{0x0742, 5, 0, 0, false, false, false, 20, 0x13, 0x14, 0x17, true, 23, 51097},
+	{0x0745, 9, 0, 0, true, true, false, 26, 0x17, 0x18, 0x1B, true, 27, 51121},
+	{0x0746, 0, 0, 0, true, true, false, 26, 0xFF, 0xFF, 0x00, false, 29, 51149},
+	{0x0747, 0, 0, 0, false, false, false, 25, 0x00, 0x01, 0x04, true, 40, 51179},
+	{0x0748, 0, 0, 1, false, false, false, 25, 0xFF, 0xFF, 0x00, false, 46, 51220},
+	{0x0749, 0, 0, 0, false, false, true, 25, 0xFF, 0xFF, 0x00, false, 68, 51267},
+	{0x074A, 0, 0, 1, false, false, true, 25, 0xFF, 0xFF, 0x00, false, 71, 51336},
+	{0x074B, 0, 0, 1, false, false, true, 25, 0x00, 0x01, 0x0C, true, 47, 51408},
+	{0x074C, 5, 0, 0, false, false, false, 20, 0x2B, 0x2C, 0x2F, true, 47, 51456},
+	{0x074D, 5, 1, 0, false, false, false, 20, 0x2B, 0x2C, 0x2F, true, 56, 51504},
+	{0x074E, 5, 0, 1, false, false, false, 20, 0x30, 0x31, 0x34, true, 52, 51561},
+	{0x074F, 8, 0, 0, true, true, true, 26, 0x1A, 0x1B, 0x1E, true, 30, 51614},
+	{0x0750, 8, 0, 0, true, true, true, 26, 0x1D, 0x1E, 0x21, true, 33, 51645},
+	{0x0751, 0, 0, 0, true, true, true, 26, 0xFF, 0xFF, 0x00, false, 35, 51679},
+	{0x0752, 0, 0, 0, true, true, true, 26, 0xFF, 0xFF, 0x00, false, 34, 51715},
+	{0x0753, 0, 0, 1, false, false, true, 25, 0x00, 0x01, 0x0C, true, 55, 51750},
+	{0x0754, 5, 0, 0, false, false, false, 20, 0x2D, 0x2E, 0x31, true, 49, 51806},
+	{0x0755, 5, 1, 0, false, false, false, 20, 0x2D, 0x2E, 0x31, true, 58, 51856},
+	{0x0756, 5, 0, 1, false, false, false, 20, 0x32, 0x33, 0x36, true, 54, 51915},
+	{0x0757, 0, 0, 1, false, false, true, 25, 0x00, 0x01, 0x0C, true, 57, 51970},
+	{0x0758, 5, 0, 0, false, false, false, 20, 0x34, 0x35, 0x38, true, 56, 52028},
+	{0x0759, 9, 0, 0, true, true, true, 26, 0x17, 0x18, 0x1B, true, 27, 52085},
+	{0x075A, 0, 0, 0, true, true, true, 26, 0xFF, 0xFF, 0x00, false, 29, 52113},
+	{0x075B, 0, 2, 0, false, false, false, 27, 0xFF, 0xFF, 0x00, false, 17, 52143},
+	{0x075C, 5, 1, 0, false, false, false, 20, 0x34, 0x35, 0x38, true, 65, 52161},
+	{0x075D, 5, 0, 1, false, false, false, 20, 0x39, 0x3A, 0x3D, true, 61, 52227},
+	{0x075E, 0, 0, 0, false, false, true, 27, 0xFF, 0xFF, 0x00, false, 34, 52289},
+	{0x075F, 0, 0, 0, true, false, true, 27, 0xFF, 0xFF, 0x00, false, 37, 52324},
+	{0x0760, 0, 0, 0, false, true, true, 28, 0xFF, 0xFF, 0x00, false, 8, 52362},
+	{0x0761, 0, 0, 0, false, true, true, 28, 0xFF, 0xFF, 0x00, false, 8, 52371},
+	{0x0762, 0, 0, 0, false, true, true, 28, 0xFF, 0xFF, 0x00, false, 8, 52380},
+	{0x0763, 0, 0, 0, false, true, true, 28, 0xFF, 0xFF, 0x00, false, 8, 52389},
+	{0x0764, 0, 0, 0, false, true, true, 28, 0xFF, 0xFF, 0x00, false, 8, 52398},
+	{0x0765, 0, 0, 0, false, true, true, 28, 0xFF, 0xFF, 0x00, false, 8, 52407},
+	{0x0766, 0, 0, 0, false, true, true, 28, 0xFF, 0xFF, 0x00, false, 8, 52416},
+	{0x0767, 0, 0, 0, false, true, true, 28, 0xFF, 0xFF, 0x00, false, 8, 52425},
+	{0x0768, 0, 0, 0, false, true, true, 28, 0xFF, 0xFF, 0x00, false, 8, 52434},
+	{0x0769, 0, 0, 0, false, true, true, 28, 0xFF, 0xFF, 0x00, false, 37, 52443},
+	{0x076A, 0, 0, 0, false, true, true, 28, 0xFF, 0xFF, 0x00, false, 37, 52481},
+	{0x076B, 0, 0, 0, false, true, true, 28, 0xFF, 0xFF, 0x00, false, 37, 52519},
+	{0x076C, 0, 0, 0, false, true, true, 28, 0xFF, 0xFF, 0x00, false, 37, 52557},
+	{0x076D, 7, 1, 0, false, true, false, 22, 0x0F, 0x10, 0x13, true, 19, 52595},
+	{0x076E, 7, 1, 0, false, true, false, 22, 0x0F, 0x10, 0x13, true, 38, 52615},
+	{0x076F, 3, 0, 1, false, false, true, 28, 0x09, 0x0A, 0x0D, true, 18, 52654},
+	{0x0770, 3, 0, 1, false, true, true, 28, 0x0E, 0x0F, 0x12, true, 23, 52673},
+	{0x0771, 1, 0, 0, false, true, true, 28, 0x0A, 0x0B, 0x0E, true, 43, 52697},
+	{0x0772, 7, 0, 0, false, true, true, 21, 0x20, 0x27, 0x2A, true, 42, 52741},
+	{0x0773, 0, 0, 0, false, false, false, 31, 0xFF, 0xFF, 0x00, false, 12, 52784},
+	{0x0774, 11, 0, 1, false, true, true, 29, 0x16, 0x1A, 0x1D, true, 29, 52797},
+	{0x0775, 0, 2, 0, false, true, false, 29, 0xFF, 0xFF, 0x00, false, 87, 52827},
+	{0x0776, 0, 2, 0, true, true, false, 29, 0xFF, 0xFF, 0x00, false, 84, 52915},
+	{0x0777, 0, 2, 0, false, false, false, 29, 0xFF, 0xFF, 0x00, false, 17, 53000},
+	{0x0779, 12, 0, 1, false, true, true, 29, 0x16, 0x1A, 0x1D, true, 29, 53018},
+	{0x077A, 7, 0, 0, false, true, true, 30, 0x19, 0x20, 0x23, true, 35, 53048},
+	{0x077B, 0, 0, 0, false, true, false, 31, 0x27, 0x2F, 0x32, true, 65, 53084},
+	{0x077C, 7, 0, 0, false, true, true, 30, 0x19, 0x20, 0x23, true, 61, 53150},
+	{0x077D, 0, 0, 0, false, false, false, 25, 0xFF, 0xFF, 0x00, false, 47, 53212},
+	{0x077E, 0, 0, 1, false, true, true, 28, 0xFF, 0xFF, 0x00, false, 4, 53260},
+	{0x0780, 0, 0, 0, false, true, true, 28, 0xFF, 0xFF, 0x00, false, 35, 53265},
+	{0x0781, 1, 0, 0, false, true, true, 28, 0x00, 0x01, 0x04, true, 29, 53301},
+	{0x0782, 0, 1, 0, false, false, true, 28, 0xFF, 0xFF, 0x00, false, 26, 53331},
+	{0x0783, 0, 1, 1, false, false, true, 28, 0xFF, 0xFF, 0x00, false, 34, 53358},
+	{0x0784, 0, 0, 0, false, false, true, 28, 0xFF, 0xFF, 0x00, false, 26, 53393},
+	{0x0785, 0, 0, 0, false, true, true, 28, 0xFF, 0xFF, 0x00, false, 49, 53420},
+	{0x0786, 0, 0, 1, false, false, true, 28, 0xFF, 0xFF, 0x00, false, 27, 53470},
+	{0x0787, 7, 0, 0, false, true, true, 27, 0x0B, 0x12, 0x15, true, 21, 53498},
+	{0x0788, 0, 0, 0, true, true, true, 27, 0xFF, 0xFF, 0x00, false, 35, 53520},
+	{0x0789, 7, 1, 1, false, true, true, 29, 0x21, 0x25, 0x28, true, 71, 53556},
+	{0x078A, 7, 0, 0, false, true, true, 30, 0x1F, 0x26, 0x29, true, 41, 53628},
+	{0x078B, 7, 1, 1, false, true, true, 29, 0x23, 0x27, 0x2A, true, 73, 53670},
+	{0x078C, 0, 0, 1, false, false, true, 30, 0xFF, 0xFF, 0x00, false, 55, 53744},
+	{0x078E, 7, 0, 0, false, true, true, 28, 0x27, 0x2E, 0x31, true, 49, 53800},
+	{0x0792, 0, 0, 0, false, true, true, 28, 0xFF, 0xFF, 0x00, false, 41, 53850},
+	{0x0793, 0, 0, 0, false, false, true, 30, 0xFF, 0xFF, 0x00, false, 47, 53892},
+	{0x0794, 0, 0, 0, true, true, true, 30, 0xFF, 0xFF, 0x00, false, 66, 53940},
+	{0x0795, 0, 0, 0, true, true, true, 30, 0xFF, 0xFF, 0x00, false, 63, 54007},
+	{0x0796, 0, 0, 0, true, true, true, 30, 0xFF, 0xFF, 0x00, false, 74, 54071},
+	{0x0797, 0, 0, 0, true, true, true, 30, 0xFF, 0xFF, 0x00, false, 63, 54146},
+	{0x0798, 0, 0, 0, true, true, true, 30, 0xFF, 0xFF, 0x00, false, 44, 54210},
+	{0x0799, 0, 0, 0, true, true, true, 30, 0xFF, 0xFF, 0x00, false, 49, 54255},
+	{0x079A, 0, 0, 0, true, true, true, 30, 0xFF, 0xFF, 0x00, false, 46, 54305},
+	{0x079B, 0, 0, 0, true, false, true, 30, 0xFF, 0xFF, 0x00, false, 57, 54352},
+	{0x079C, 0, 0, 0, true, false, true, 30, 0xFF, 0xFF, 0x00, false, 54, 54410},
+	{0x079D, 0, 0, 0, true, false, true, 30, 0xFF, 0xFF, 0x00, false, 52, 54465},
+	{0x079E, 0, 0, 0, true, false, true, 30, 0xFF, 0xFF, 0x00, false, 35, 54518},
+	{0x079F, 7, 0, 0, false, true, true, 30, 0x25, 0x2C, 0x2F, true, 47, 54554},
+	{0x07A0, 0, 0, 0, false, false, true, 30, 0xFF, 0xFF, 0x00, false, 41, 54602},
+	{0x07A1, 7, 0, 0, false, true, true, 30, 0x24, 0x28, 0x2B, true, 43, 54644},
+	{0x07A2, 7, 1, 0, false, true, true, 30, 0x1F, 0x23, 0x26, true, 38, 54688},
+	{0x07A3, 0, 0, 0, false, true, true, 29, 0xFF, 0xFF, 0x00, false, 45, 54727},
+	{0x07A4, 0, 0, 0, false, true, true, 30, 0xFF, 0xFF, 0x00, false, 47, 54773},
+	{0x07A5, 0, 0, 0, false, true, true, 30, 0xFF, 0xFF, 0x00, false, 70, 54821},
+	{0x07A9, 0, 0, 1, false, true, false, 9, 0xFF, 0xFF, 0x00, false, 52, 54892},
+	{0x07AA, 0, 0, 0, true, false, false, 10, 0xFF, 0xFF, 0x00, false, 39, 54945},
+	{0x07AB, 0, 0, 0, false, true, false, 10, 0xFF, 0xFF, 0x00, false, 45, 54985},
+	{0x07AC, 0, 0, 0, false, false, true, 30, 0xFF, 0xFF, 0x00, false, 38, 55031},
+	{0x07AD, 0, 0, 0, false, false, true, 30, 0xFF, 0xFF, 0x00, false, 32, 55070},
+	{0x07AE, 0, 0, 0, false, false, true, 30, 0xFF, 0xFF, 0x00, false, 47, 55103},
+	{0x07AF, 0, 0, 0, false, false, true, 30, 0xFF, 0xFF, 0x00, false, 41, 55151},
+	{0x07B3, 0, 0, 0, false, true, false, 9, 0xFF, 0xFF, 0x00, false, 24, 55193},
+	{0x07B4, 0, 0, 0, true, false, false, 9, 0xFF, 0xFF, 0x00, false, 34, 55218},
+	{0x07B5, 0, 0, 1, false, true, false, 9, 0xFF, 0xFF, 0x00, false, 40, 55253},
+	{0x07B6, 0, 0, 1, false, true, false, 9, 0xFF, 0xFF, 0x00, false, 32, 55294},
+	{0x07B7, 8, 0, 1, false, false, false, 9, 0x29, 0x2F, 0x32, true, 50, 55327},
+	{0x07B8, 0, 0, 0, false, false, false, 9, 0xFF, 0xFF, 0x00, false, 21, 55378},
+	{0x07B9, 0, 0, 1, false, true, false, 9, 0xFF, 0xFF, 0x00, false, 58, 55400},
+	{0x07BA, 0, 0, 0, true, false, false, 9, 0xFF, 0xFF, 0x00, false, 45, 55459},
+	{0x07BB, 0, 0, 0, false, true, false, 9, 0xFF, 0xFF, 0x00, false, 51, 55505},
+	{0x07BC, 8, 0, 0, false, false, false, 9, 0x28, 0x2E, 0x31, true, 49, 55557},
+	{0x07BD, 8, 0, 1, false, false, true, 9, 0x19, 0x1F, 0x22, true, 77, 55607},
+	{0x07BE, 0, 0, 0, true, false, false, 6, 0xFF, 0xFF, 0x00, false, 14, 55685},
+	{0x07BF, 0, 0, 0, false, false, true, 25, 0xFF, 0xFF, 0x00, false, 13, 55700},
+	{0x07C1, 0, 0, 0, false, false, false, 9, 0xFF, 0xFF, 0x00, false, 29, 55714},
+	{0x07C2, 0, 0, 0, true, false, true, 9, 0xFF, 0xFF, 0x00, false, 38, 55744},
+	{0x07C6, 7, 0, 0, false, true, true, 28, 0x10, 0x17, 0x1A, true, 26, 55783},
+	{0x07C7, 0, 0, 1, false, false, false, 13, 0xFF, 0xFF, 0x00, false, 37, 55810},
+	{0x07C9, 0, 0, 0, false, false, true, 28, 0xFF, 0xFF, 0x00, false, 35, 55848},
+	{0x07CA, 0, 0, 0, false, false, true, 28, 0xFF, 0xFF, 0x00, false, 33, 55884},
+	{0x07CB, 0, 0, 0, false, false, true, 28, 0xFF, 0xFF, 0x00, false, 35, 55918},
+	{0x07CE, 0, 0, 1, false, false, false, 7, 0xFF, 0xFF, 0x00, false, 37, 55954},
+	{0x07CF, 0, 0, 1, false, false, false, 8, 0xFF, 0xFF, 0x00, false, 38, 55992},
+	{0x07D0, 7, 0, 1, true, true, true, 9, 0x19, 0x20, 0x23, true, 35, 56031},
+	{0x07D6, 0, 0, 1, true, false, false, 10, 0xFF, 0xFF, 0x00, false, 50, 56067},
+	{0x07D7, 0, 0, 1, true, false, false, 10, 0xFF, 0xFF, 0x00, false, 42, 56118},
+	{0x07DD, 0, 0, 0, false, false, false, 9, 0xFF, 0xFF, 0x00, false, 17, 56161},
+	{0x07E5, 0, 0, 0, false, false, true, 21, 0xFF, 0xFF, 0x00, false, 51, 56179},
+	{0x07E6, 0, 0, 1, false, false, true, 21, 0xFF, 0xFF, 0x00, false, 23, 56231},
+	{0x07EC, 0, 2, 0, false, false, false, 4, 0xFF, 0xFF, 0x00, false, 17, 56255},
+	{0x07ED, 0, 2, 0, false, false, false, 10, 0xFF, 0xFF, 0x00, false, 17, 56273},
+	{0x07EE, 0, 2, 0, false, false, false, 13, 0xFF, 0xFF, 0x00, false, 17, 56291},
+	{0x07F0, 0, 2, 0, false, false, false, 35, 0xFF, 0xFF, 0x00, false, 17, 56309},
+	{0x07F1, 0, 2, 0, false, false, false, 19, 0xFF, 0xFF, 0x00, false, 17, 56327},
+	{0x07F2, 0, 2, 0, false, false, false, 21, 0xFF, 0xFF, 0x00, false, 17, 56345},
+	{0x07F3, 0, 2, 0, false, false, false, 22, 0xFF, 0xFF, 0x00, false, 17, 56363},
+	{0x07F6, 0, 2, 0, false, false, false, 28, 0xFF, 0xFF, 0x00, false, 17, 56381},
+	{0x07F7, 0, 2, 0, false, false, false, 30, 0xFF, 0xFF, 0x00, false, 17, 56399},
+	{0x07F8, 0, 2, 0, false, false, false, 31, 0xFF, 0xFF, 0x00, false, 17, 56417},
+	{0x07F9, 0, 2, 0, false, true, true, 31, 0xFF, 0xFF, 0x00, false, 17, 56435},
+	{0x07FA, 0, 0, 1, false, false, true, 13, 0xFF, 0xFF, 0x00, false, 31, 56453},
+	{0x07FB, 0, 0, 0, false, false, false, 14, 0xFF, 0xFF, 0x00, false, 11, 56485},
+	{0x07FC, 0, 0, 1, false, false, true, 14, 0xFF, 0xFF, 0x00, false, 22, 56497},
+	{0x07FD, 0, 0, 1, false, false, true, 14, 0xFF, 0xFF, 0x00, false, 12, 56520},
+	{0x07FE, 0, 0, 1, false, false, true, 9, 0xFF, 0xFF, 0x00, false, 42, 56533},
+	{0x07FF, 0, 2, 0, false, true, true, 31, 0xFF, 0xFF, 0x00, false, 14, 56576},
+};
+
+inline constexpr char ISO14819_2_ConstexprSupplementaryText[] =
+	"heavy lorries are recommended to avoid the area\000"
+	"follow signs\000"
+	"follow diversion signs\000"
+	"diversion in operation\000"
+	"no suitable diversion available\000"
+	"diversion is no longer recommended\000"
+	"for exceptional loads only\000"
+	"for heavy vehicles only\000"
+	"for cars and light vehicles only\000"
+	"snowploughs in use\000"
+	"gritting vehicles in use\000"
+	"drive carefully\000"
+	"keep your distance\000"
+	"observe signals\000"
+	"overtake with care\000"
+	"cross junction with care\000"
+	"no overtaking\000"
+	"use headlights\000"
+	"use fog lights\000"
+	"do not leave your vehicle\000"
+	"switch off engine\000"
+	"close all windows. Turn off heater and vents\000"
+	"test your brakes\000"
+	"winter equipment recommended\000"
+	"snow chains recommended\000"
+	"snow chains mandatory\000"
+	"keep to the left\000"
+	"keep to the right\000"
+	"use hard shoulder as lane\000"
+	"do not drive on the hard shoulder\000"
+	"in the opposite direction\000"
+	"in the opposing lanes\000"
+	"in the overtaking lane\000"
+	"in the crawler lane\000"
+	"in the right lane\000"
+	"in the middle lane\000"
+	"in the left lane\000"
+	"on the roadway\000"
+	"police directing traffic\000"
+	"police in attendance\000"
+	"extra police patrols in operation\000"
+	"rescue and recovery work in progress\000"
+	"look out for flagman\000"
+	"why not park-and-ride?\000"
+	"why not try public transport?\000"
+	"only travel if absolutely necessary\000"
+	"increased risk of accident\000"
+	"on bridges\000"
+	"in shaded areas\000"
+	"entering or leaving tunnels\000"
+	"winter closure\000"
+	"batch service in progress\000"
+	"the north\000"
+	"the north-east\000"
+	"the east\000"
+	"the south-east\000"
+	"the south\000"
+	"the south-west\000"
+	"the west\000"
+	"the north-west\000"
+	"follow special diversion markers\000"
+	"do not follow diversion signs\000"
+	"follow local diversion\000"
+	"compulsory diversion in operation\000"
+	"for petrol-engined vehicles only\000"
+	"for diesel-engined vehicles only\000"
+	"for LPG vehicles only\000"
+	"local drivers are recommended to avoid the area\000"
+	"for 4-wheel-drive with snow tyres or chains only\000"
+	"in the median\000"
+	"for cars only\000"
+	"for light vehicles only\000"
+	"for vehicles with catalytic converters\000"
+	"for vehicles without catalytic converters\000"
+	"for cars with trailers only\000"
+	"for cars with caravans only\000"
+	"for vehicles with trailers only\000"
+	"for heavy lorries only\000"
+	"for buses only\000"
+	"for articulated vehicles only\000"
+	"for high-sided vehicles only\000"
+	"for hazardous loads only\000"
+	"for abnormal loads only\000"
+	"with even-numbered registration plates\000"
+	"with odd-numbered registration plates\000"
+	"for all vehicles\000"
+	"for through traffic\000"
+	"for rail services\000"
+	"on the underground\000"
+	"danger\000"
+	"repairs in progress\000"
+	"pilot car in operation\000"
+	"emergency vehicles at scene\000"
+	"traffic being directed around accident area\000"
+	"danger of explosion\000"
+	"danger of fire\000"
+	"radiation hazard\000"
+	"toxic leak\000"
+	"firemen directing traffic\000"
+	"police speed checks in operation\000"
+	"mandatory speed limit in force\000"
+	"speed limit in force for heavy vehicles\000"
+	"reduce your speed\000"
+	"observe speed limits\000"
+	"observe recommended speed\000"
+	"snow chains required\000"
+	"snow chains or tyres reqired\000"
+	"helicopter rescue in progress\000"
+	"several accidents have taken place\000"
+	"drive with extreme caution\000"
+	"approach with care\000"
+	"increase normal following distance\000"
+	"do not allow unnecessary gaps\000"
+	"follow the vehicle in front, smoothly\000"
+	"do not slow down unneccessarily\000"
+	"observe signs\000"
+	"use hazard warning lights\000"
+	"no smoking\000"
+	"no naked flames\000"
+	"switch off mobile phones and two-way radios\000"
+	"allow emergency vehicles to pass\000"
+	"clear a lane for emergency vehicles\000"
+	"pull over to the edge of the roadway\000"
+	"wait for escort vehicle\000"
+	"in emergency, wait for police patrol\000"
+	"stop at next safe place\000"
+	"clear a lane for snowploughs and gritting vehicles\000"
+	"use right lane\000"
+	"use left lane\000"
+	"heavy vehicles use right lane\000"
+	"heavy vehicles use left lane\000"
+	"stop at next service area\000"
+	"on the right\000"
+	"in the centre\000"
+	"on the left\000"
+	"in the bus lane\000"
+	"in the carpool lane\000"
+	"on the hard shoulder\000"
+	"in the emergency lane\000"
+	"on the opposite carriageway\000"
+	"in the heavy vehicle lane\000"
+	"in the local lane\000"
+	"due to heat\000"
+	"due to frost\000"
+	"for ferry service\000"
+	"for roads in\000"
+	"in the through traffic lane\000"
+	"in the express lane\000"
+	"in the connecting carriageway\000"
+	"in the parallel carriageway\000"
+	"in the right-hand parallel carriageway\000"
+	"in the left-hand parallel carriageway\000"
+	"in tunnels\000"
+	"on slip roads\000"
+	"at high altitudes\000"
+	"in low-lying areas\000"
+	"around a bend in the road\000"
+	"over the crest of a hill\000"
+	"in the city centre\000"
+	"in the inner city area\000"
+	"in the slow vehicle lane\000"
+	"in the turning lane\000"
+	"due to an earlier accident\000"
+	"due to shear weight of traffic\000"
+	"due to large numbers of visitors\000"
+	"due to holiday traffic\000"
+	"due to technical problems\000"
+	"towards town\000"
+	"from town\000"
+	"on entry into the country\000"
+	"on leaving the country\000"
+	"do not throw out any burning objects\000"
+	"traffic wardens directing traffic\000"
+	"due to falling ice\000"
+	"snow tyres recommended\000"
+	"snow tyres mandatory\000"
+	"use through traffic lanes\000"
+	"use local traffic lanes\000"
+	"use left-hand parallel carriageway\000"
+	"use right-hand parallel carriageway\000"
+	"use heavy vehicle lane\000"
+	"due to an earlier incident\000"
+	"why not ride share?\000"
+	"is this your no-ride day?\000"
+	"due to an earlier event\000"
+	"please use rail service\000"
+	"please use underground service\000"
+	"please use tram service\000"
+	"please use bus service\000"
+	"for a limited time\000"
+	"your parking ticket covers the return ride\000"
+	"avoid the rush hour\000"
+	"for holiday traffic\000"
+	"for residents\000"
+	"several times\000"
+	"during the day time\000"
+	"during off-peak periods\000"
+	"during the night\000"
+	"until further notice\000"
+	"for arrivals\000"
+	"for departures\000"
+	"access only\000"
+	"only\000"
+	"except\000"
+	"for long distance traffic\000"
+	"for local traffic\000"
+	"for regional traffic\000"
+	"unconfirmed report\000"
+	"on manual payment lanes\000"
+	"sorry for any delay\000"
+	"for roads leading towards\000"
+	"for roads from\000"
+	"we are grateful for your cooperation\000"
+	"Traffic queue length decreasing at an average rate of 10 km/hr\000"
+	"Traffic queue length decreasing at an average rate of 20 km/hr\000"
+	"Traffic queue length decreasing at an average rate of 30 km/hr\000"
+	"Traffic queue length decreasing at an average rate of 40 km/hr\000"
+	"leave your vehicle. Proceed to next save place\000"
+	"for visitors\000"
+	"in the roadworks area\000"
+	"from\000"
+	"to\000"
+	"in\000"
+	"Traffic queue length increasing\000"
+	"Traffic queue length increasing at an average rate of 10 km/hr\000"
+	"Traffic queue length increasing at an average rate of 20 km/hr\000"
+	"Traffic queue length increasing at an average rate of 30 km/hr\000"
+	"Traffic queue length increasing at an average rate of 40 km/hr\000"
+	"very frequent service\000"
+	"frequent service\000"
+	"fairly frequent service\000"
+	"regular service\000"
+	"Traffic queue length decreasing\000"
+;
+
+inline constexpr TRDSTMCConstexprSupplementary ISO14819_2_ConstexprSupplementary[233] = {
+	{0x01, 47, 0},
+	{0x02, 12, 48},
+	{0x03, 22, 61},
+	{0x04, 22, 84},
+	{0x05, 31, 107},
+	{0x06, 34, 139},
+	{0x07, 26, 174},
+	{0x08, 23, 201},
+	{0x09, 32, 225},
+	{0x0A, 18, 258},
+	{0x0B, 24, 277},
+	{0x0C, 15, 302},
+	{0x0D, 18, 318},
+	{0x0E, 15, 337},
+	{0x0F, 18, 353},
+	{0x10, 24, 372},
+	{0x11, 13, 397},
+	{0x12, 14, 411},
+	{0x13, 14, 426},
+	{0x14, 25, 441},
+	{0x15, 17, 467},
+	{0x16, 44, 485},
+	{0x17, 16, 530},
+	{0x18, 28, 547},
+	{0x19, 23, 576},
+	{0x1A, 21, 600},
+	{0x1B, 16, 622},
+	{0x1C, 17, 639},
+	{0x1D, 25, 657},
+	{0x1E, 33, 683},
+	{0x1F, 25, 717},
+	{0x20, 21, 743},
+	{0x21, 22, 765},
+	{0x22, 19, 788},
+	{0x23, 17, 808},
+	{0x24, 18, 826},
+	{0x25, 16, 845},
+	{0x26, 14, 862},
+	{0x27, 24, 877},
+	{0x28, 20, 902},
+	{0x29, 33, 923},
+	{0x2A, 36, 957},
+	{0x2B, 20, 994},
+	{0x2C, 22, 1015},
+	{0x2D, 29, 1038},
+	{0x2E, 35, 1068},
+	{0x2F, 26, 1104},
+	{0x30, 10, 1131},
+	{0x31, 15, 1142},
+	{0x32, 27, 1158},
+	{0x33, 14, 1186},
+	{0x34, 25, 1201},
+	{0x35, 9, 1227},
+	{0x36, 14, 1237},
+	{0x37, 8, 1252},
+	{0x38, 14, 1261},
+	{0x39, 9, 1276},
+	{0x3A, 14, 1286},
+	{0x3B, 8, 1301},
+	{0x3C, 14, 1310},
+	{0x3D, 32, 1325},
+	{0x3E, 29, 1358},
+	{0x3F, 22, 1388},
+	{0x40, 33, 1411},
+	{0x41, 32, 1445},
+	{0x42, 32, 1478},
+	{0x43, 21, 1511},
+	{0x44, 47, 1533},
+	{0x45, 48, 1581},
+	{0x46, 13, 1630},
+	{0x47, 13, 1644},
+	{0x48, 23, 1658},
+	{0x49, 38, 1682},
+	{0x4A, 41, 1721},
+	{0x4B, 27, 1763},
+	{0x4C, 27, 1791},
+	{0x4D, 31, 1819},
+	{0x4E, 22, 1851},
+	{0x4F, 14, 1874},
+	{0x50, 29, 1889},
+	{0x51, 28, 1919},
+	{0x52, 24, 1948},
+	{0x53, 23, 1973},
+	{0x54, 38, 1997},
+	{0x55, 37, 2036},
+	{0x56, 16, 2074},
+	{0x58, 19, 2091},
+	{0x59, 17, 2111},
+	{0x5A, 18, 2129},
+	{0x5B, 6, 2148},
+	{0x5C, 19, 2155},
+	{0x5D, 22, 2175},
+	{0x5E, 27, 2198},
+	{0x5F, 43, 2226},
+	{0x60, 19, 2270},
+	{0x61, 14, 2290},
+	{0x62, 16, 2305},
+	{0x63, 10, 2322},
+	{0x64, 25, 2333},
+	{0x65, 32, 2359},
+	{0x66, 30, 2392},
+	{0x67, 39, 2423},
+	{0x68, 17, 2463},
+	{0x69, 20, 2481},
+	{0x6A, 25, 2502},
+	{0x6B, 20, 2528},
+	{0x6C, 28, 2549},
+	{0x6D, 29, 2578},
+	{0x6E, 34, 2608},
+	{0x6F, 26, 2643},
+	{0x70, 18, 2670},
+	{0x71, 34, 2689},
+	{0x72, 29, 2724},
+	{0x73, 37, 2754},
+	{0x74, 31, 2792},
+	{0x75, 13, 2824},
+	{0x76, 25, 2838},
+	{0x77, 10, 2864},
+	{0x78, 15, 2875},
+	{0x79, 43, 2891},
+	{0x7A, 32, 2935},
+	{0x7B, 35, 2968},
+	{0x7C, 36, 3004},
+	{0x7D, 23, 3041},
+	{0x7E, 36, 3065},
+	{0x80, 23, 3102},
+	{0x81, 50, 3126},
+	{0x83, 14, 3177},
+	{0x84, 13, 3192},
+	{0x85, 29, 3206},
+	{0x86, 28, 3236},
+	{0x88, 25, 3265},
+	{0x8D, 12, 3291},
+	{0x8E, 13, 3304},
+	{0x8F, 11, 3318},
+	{0x90, 15, 3330},
+	{0x91, 19, 3346},
+	{0x92, 20, 3366},
+	{0x93, 21, 3387},
+	{0x94, 27, 3409},
+	{0x95, 25, 3437},
+	{0x96, 17, 3463},
+	{0x97, 11, 3481},
+	{0x98, 12, 3493},
+	{0x99, 17, 3506},
+	{0x9A, 12, 3524},
+	{0x9B, 27, 3537},
+	{0x9C, 19, 3565},
+	{0x9D, 29, 3585},
+	{0x9E, 27, 3615},
+	{0x9F, 38, 3643},
+	{0xA0, 37, 3682},
+	{0xA1, 10, 3720},
+	{0xA2, 13, 3731},
+	{0xA3, 17, 3745},
+	{0xA4, 18, 3763},
+	{0xA5, 25, 3782},
+	{0xA6, 24, 3808},
+	{0xA7, 18, 3833},
+	{0xA8, 22, 3852},
+	{0xA9, 24, 3875},
+	{0xAA, 19, 3900},
+	{0xAB, 26, 3920},
+	{0xAC, 30, 3947},
+	{0xAD, 32, 3978},
+	{0xAE, 22, 4011},
+	{0xAF, 25, 4034},
+	{0xB0, 12, 4060},
+	{0xB1, 9, 4073},
+	{0xB2, 25, 4083},
+	{0xB3, 22, 4109},
+	{0xB4, 36, 4132},
+	{0xB5, 33, 4169},
+	{0xB9, 18, 4203},
+	{0xBF, 22, 4222},
+	{0xC0, 20, 4245},
+	{0xC3, 25, 4266},
+	{0xC4, 23, 4292},
+	{0xC5, 34, 4316},
+	{0xC6, 35, 4351},
+	{0xC7, 22, 4387},
+	{0xC8, 26, 4410},
+	{0xC9, 19, 4437},
+	{0xCA, 25, 4457},
+	{0xCB, 23, 4483},
+	{0xCC, 23, 4507},
+	{0xCD, 30, 4531},
+	{0xCE, 23, 4562},
+	{0xCF, 22, 4586},
+	{0xD0, 18, 4609},
+	{0xD1, 42, 4628},
+	{0xD2, 19, 4671},
+	{0xD3, 19, 4691},
+	{0xD4, 13, 4711},
+	{0xD5, 13, 4725},
+	{0xD6, 19, 4739},
+	{0xD7, 23, 4759},
+	{0xD8, 16, 4783},
+	{0xD9, 20, 4800},
+	{0xDA, 12, 4821},
+	{0xDB, 14, 4834},
+	{0xDC, 11, 4849},
+	{0xDD, 4, 4861},
+	{0xDE, 6, 4866},
+	{0xDF, 25, 4873},
+	{0xE0, 17, 4899},
+	{0xE1, 20, 4917},
+	{0xE2, 18, 4938},
+	{0xE3, 23, 4957},
+	{0xE7, 19, 4981},
+	{0xE8, 25, 5001},
+	{0xE9, 14, 5027},
+	{0xEA, 36, 5042},
+	{0xEB, 62, 5079},
+	{0xEC, 62, 5142},
+	{0xED, 62, 5205},
+	{0xEE, 62, 5268},
+	{0xEF, 46, 5331},
+	{0xF0, 12, 5378},
+	{0xF1, 21, 5391},
+	{0xF2, 4, 5413},
+	{0xF3, 2, 5418},
+	{0xF4, 2, 5421},
+	{0xF5, 31, 5424},
+	{0xF6, 62, 5456},
+	{0xF7, 62, 5519},
+	{0xF8, 62, 5582},
+	{0xF9, 62, 5645},
+	{0xFA, 21, 5708},
+	{0xFB, 16, 5730},
+	{0xFC, 23, 5747},
+	{0xFD, 15, 5771},
+	{0xFF, 31, 5787},
+};
+
+/* Binary search, usable in constant expressions: with a known code, the
+ * compiler folds the whole lookup. Returns nullptr for unknown codes.
+ */
+template <typename T, size_t N>
+constexpr const T *ISO14819_2_Find(const T (&table)[N], uint16_t code) {
+  size_t low = 0, high = N;
+
+  while (low < high) {
+    size_t middle = low + (high - low) / 2;
+
+    if (table[middle].code == code)
+      return &table[middle];
+    if (table[middle].code < code)
+      low = middle + 1;
+    else
+      high = middle;
+  }
+
+  return nullptr;
+}
+
+constexpr const TRDSTMCConstexprEvent *findTMCEventConstexpr(uint16_t code) {
+  return ISO14819_2_Find(ISO14819_2_ConstexprEvents, code);
+}
+
+constexpr const TRDSTMCConstexprSupplementary *findTMCSupplementaryConstexpr(
+    uint8_t code) {
+  return ISO14819_2_Find(ISO14819_2_ConstexprSupplementary, code);
+}
+
+/* Event and supplementary information texts, the former still with %s where
+ * the quantifier goes; empty for unknown codes.
+ */
+constexpr std::string_view getTMCEventTextConstexpr(uint16_t code) {
+  const TRDSTMCConstexprEvent *event = findTMCEventConstexpr(code);
+
+  return event ? std::string_view(&ISO14819_2_ConstexprEventText[event->text],
+                                  event->length) : std::string_view();
+}
+
+constexpr std::string_view getTMCSupplementaryTextConstexpr(uint8_t code) {
+  const TRDSTMCConstexprSupplementary *entry =
+      findTMCSupplementaryConstexpr(code);
+
+  return entry ? std::string_view(
+                     &ISO14819_2_ConstexprSupplementaryText[entry->text],
+                     entry->length) : std::string_view();
+}
+
+/* The TMC label carrying the value of a quantifier type: 4 (5 bit) for types
+ * 0 through 5, 5 (8 bit) for types 6 through 12, 0 for invalid types.
+ */
+constexpr uint8_t getTMCQuantifierLabelConstexpr(uint8_t quantifier) {
+  return quantifier <= 5 ? 4 : (quantifier <= 12 ? 5 : 0);
+}
+
+template <typename T, size_t N>
+constexpr bool ISO14819_2_IsSorted(const T (&table)[N]) {
+  for (size_t i = 1; i < N; i++)
+    if (!(table[i - 1].code < table[i].code))
+      return false;
+
+  return true;
+}
+
+constexpr bool ISO14819_2_GroupsValid(void) {
+  for (const TRDSTMCConstexprEvent &event : ISO14819_2_ConstexprEvents) {
+    std::string_view text = getTMCEventTextConstexpr(event.code);
+    size_t found = text.find("%s");
+
+    if (event.substitution == 0xFF) {
+      if (found != std::string_view::npos)
+        return false;
+      continue;
+    }
+    if (found != event.substitution ||
+        !(event.groupStart < event.substitution &&
+          event.substitution < event.groupEnd &&
+          event.groupEnd <= event.length) ||
+        text[event.groupStart] != '(' || text[event.groupEnd - 1] != ')' ||
+        !getTMCQuantifierLabelConstexpr(event.quantifier))
+      return false;
+  }
+
+  return true;
+}
+
+static_assert(ISO14819_2_IsSorted(ISO14819_2_ConstexprEvents),
+              "event codes must be unique and sorted");
+static_assert(ISO14819_2_IsSorted(ISO14819_2_ConstexprSupplementary),
+              "supplementary information codes must be unique and sorted");
+static_assert(ISO14819_2_GroupsValid(),
+              "quantifier groups must match their texts and have a valid "
+              "quantifier type");
+
+#endif
+#endif
\ No newline at end of file
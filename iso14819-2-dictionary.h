@@ -0,0 +1,145 @@
+/*
+ * ISO 14819-2 header file: string compression dictionary
+ * DO NOT EDIT: automatically generated by gentables.py from CSV files
+ */
+
+#ifndef _ISO14819_2_DICTIONARY_H_INCLUDED
+#define _ISO14819_2_DICTIONARY_H_INCLUDED
+#ifdef WITH_RDS_TMC_COMPRESSED_STRINGS
+
+#define RDS_TMC_DICTIONARY_FIRST 0x80
+#define RDS_TMC_DICTIONARY_DEPTH 7
+
+const uint8_t ISO14819_2_Dictionary[128][2] PROGMEM = {
+	{0x73, 0x20},
+	{0x20, 0x74},
+	{0x69, 0x63},
+	{0x65, 0x64},
+	{0x73, 0x29},
+	{0x72, 0x61},
+	{0x69, 0x6E},
+	{0x65, 0x20},
+	{0x6C, 0x6F},
+	{0x2E, 0x20},
+	{0x6F, 0x72},
+	{0x28, 0x25},
+	{0x85, 0x66},
+	{0x6F, 0x6E},
+	{0x61, 0x6E},
+	{0x66, 0x82},
+	{0x8C, 0x8F},
+	{0x86, 0x67},
+	{0x65, 0x72},
+	{0x81, 0x90},
+	{0x61, 0x72},
+	{0x8B, 0x84},
+	{0x72, 0x6F},
+	{0x20, 0x66},
+	{0x72, 0x65},
+	{0x79, 0x20},
+	{0x83, 0x20},
+	{0x6C, 0x65},
+	{0x74, 0x69},
+	{0x61, 0x64},
+	{0x65, 0x6E},
+	{0x6F, 0x66},
+	{0x95, 0x20},
+	{0x8A, 0x20},
+	{0x6C, 0x8E},
+	{0x9C, 0x8D},
+	{0x6F, 0x20},
+	{0x74, 0x20},
+	{0x76, 0x65},
+	{0x88, 0x77},
+	{0x70, 0x65},
+	{0x65, 0x6C},
+	{0x91, 0x20},
+	{0x69, 0x74},
+	{0x69, 0x6C},
+	{0xA2, 0x65},
+	{0x28, 0x84},
+	{0x97, 0xA1},
+	{0x73, 0x65},
+	{0x61, 0x79},
+	{0x20, 0x6B},
+	{0x77, 0x8A},
+	{0xB2, 0x6D},
+	{0xB3, 0x6B},
+	{0x89, 0x53},
+	{0x69, 0x64},
+	{0x8B, 0x80},
+	{0x61, 0x63},
+	{0x79, 0x93},
+	{0x75, 0x65},
+	{0x6C, 0x20},
+	{0x9F, 0x29},
+	{0x65, 0x78},
+	{0x68, 0x82},
+	{0x75, 0x72},
+	{0x89, 0x44},
+	{0xA6, 0xBF},
+	{0x63, 0x74},
+	{0x81, 0xA4},
+	{0x96, 0x9D},
+	{0x61, 0xA3},
+	{0x92, 0x20},
+	{0x74, 0x80},
+	{0xC2, 0x9B},
+	{0xA9, 0xB1},
+	{0xBD, 0x20},
+	{0x61, 0x76},
+	{0x68, 0x65},
+	{0x63, 0x88},
+	{0xCA, 0x80},
+	{0xCE, 0x73},
+	{0x9E, 0x74},
+	{0x61, 0x62},
+	{0xB8, 0xB0},
+	{0xBE, 0xA8},
+	{0xD4, 0xC3},
+	{0x8E, 0x67},
+	{0x73, 0x74},
+	{0x61, 0x67},
+	{0xD5, 0x83},
+	{0xBB, 0x75},
+	{0x91, 0x93},
+	{0x25, 0x84},
+	{0x61, 0x6C},
+	{0x6D, 0x65},
+	{0x72, 0x69},
+	{0xDA, 0xDB},
+	{0x75, 0x6E},
+	{0x94, 0xBA},
+	{0xC6, 0xE2},
+	{0xA7, 0x93},
+	{0x63, 0xB7},
+	{0x6F, 0x76},
+	{0x20, 0x64},
+	{0x6E, 0x6F},
+	{0x63, 0x6B},
+	{0x81, 0x68},
+	{0xD3, 0xC8},
+	{0x6C, 0x69},
+	{0xAB, 0x99},
+	{0x9F, 0x20},
+	{0xB9, 0xE5},
+	{0x75, 0x63},
+	{0xB6, 0xE4},
+	{0x63, 0x8D},
+	{0x73, 0x73},
+	{0xC1, 0xD6},
+	{0x72, 0x83},
+	{0x62, 0x88},
+	{0xF6, 0xE9},
+	{0x63, 0x94},
+	{0x25, 0x80},
+	{0x6D, 0x61},
+	{0xF5, 0xF0},
+	{0x68, 0x20},
+	{0xEF, 0xD1},
+	{0x73, 0x92},
+	{0x77, 0xAB},
+};
+
+#endif
+#endif
\ No newline at end of file
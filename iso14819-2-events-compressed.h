@@ -0,0 +1,12433 @@
+/*
+ * ISO 14819-2 header file: event list entries
+ * DO NOT EDIT: automatically generated by gentables.py from CSV files
+ */
+
+#ifndef _ISO14819_2_EVENTS_COMPRESSED_H_INCLUDED
+#define _ISO14819_2_EVENTS_COMPRESSED_H_INCLUDED
+#ifdef WITH_RDS_TMC_EVENTS
+
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+const char Event_S_0001[] PROGMEM = "t\220 p\226b\233m";
+const char Event_S_0002[] PROGMEM = "q\340 (\377\374a\246\205g\207s\250\203\200\334\364\307\356\327\343";
+const char Event_S_000B[] PROGMEM = "\346\222\315igh\245w\224n\252sy\327em\201\337gg\222\203";
+const char Event_S_000C[] PROGMEM = "\240\375\256,\223 be\252di\230\303\232\224o\341d \357\236\245\224ea";
+const char Event_S_0010[] PROGMEM = "\320\203, \230scu\207\216d \230c\346\222\231\265 \206 p\226g\230\363";
+const char Event_S_0014[] PROGMEM = "\376v\202\207\224ea \346\222c\226wd\203,\347\337\246\304\216oth\307\376v\202\207\224ea";
+const char Event_S_0016[] PROGMEM = "\376v\202\207\224ea,\227u\251 \327\306 \320\203";
+const char Event_S_0017[] PROGMEM = "\376v\202\207\224ea, \230\327au\205n\245\320\203";
+const char Event_S_0018[] PROGMEM = "br\267g\207\320\203";
+const char Event_S_0019[] PROGMEM = "t\341n\251 \320\203";
+const char Event_S_001A[] PROGMEM = "br\267g\207\367\203";
+const char Event_S_001B[] PROGMEM = "t\341n\251 \367\203";
+const char Event_S_001C[] PROGMEM = "\305 \320\232\206t\222m\253t\321ly";
+const char Event_S_0024[] PROGMEM = "fu\251 \327\306 \230op\236\203";
+const char Event_S_0025[] PROGMEM = "\230\327au\205n\245\230op\236\203";
+const char Event_S_0027[] PROGMEM = "\230op\236\252\356br\267g\207\325\232\225";
+const char Event_S_0028[] PROGMEM = "smog \335\222\245\236d\203";
+const char Event_S_0029[] PROGMEM = "\240\346\222tak\252\255\256 \320\203";
+const char Event_S_002A[] PROGMEM = "\240\346\222tak\252\255\256 \367\203";
+const char Event_S_0033[] PROGMEM = "\305\265s, \240\346\222tak\252\255\256 \320\203";
+const char Event_S_0034[] PROGMEM = "\353\313\305\265\200\215\352\207h\224d should\222";
+const char Event_S_0035[] PROGMEM = "\353\313\305\265\200\206\352\207em\222g\236c\231\255";
+const char Event_S_0037[] PROGMEM = "t\220 p\226b\233m \331";
+const char Event_S_0038[] PROGMEM = "t\220 \362ges\243 \331";
+const char Event_S_0039[] PROGMEM = "n\212m\335\223 \331";
+const char Event_S_003D[] PROGMEM = "\240obje\303\256 \215 \305w\261";
+const char Event_S_003E[] PROGMEM = "\240b\300s\245pi\250\256";
+const char Event_S_003F[] PROGMEM = "\240obje\303\256 \215\352\207\305\364\222";
+const char Event_S_0040[] PROGMEM = "b\300s\245pi\250\364\222";
+const char Event_S_0046[] PROGMEM = "t\220 \362ges\243, a\246\205g\207s\250\232\35610\264/h";
+const char Event_S_0047[] PROGMEM = "t\220 \362ges\243, a\246\205g\207s\250\232\35620\264/h";
+const char Event_S_0048[] PROGMEM = "t\220 \362ges\243, a\246\205g\207s\250\232\35630\264/h";
+const char Event_S_0049[] PROGMEM = "t\220 \362ges\243, a\246\205g\207s\250\232\35640\264/h";
+const char Event_S_004A[] PROGMEM = "t\220 \362ges\243, a\246\205g\207s\250\232\35650\264/h";
+const char Event_S_004B[] PROGMEM = "t\220 \362ges\243, a\246\205g\207s\250\232\35660\264/h";
+const char Event_S_004C[] PROGMEM = "t\220 \362ges\243, a\246\205g\207s\250\232\35670\264/h";
+const char Event_S_0050[] PROGMEM = "\315\314\272 ha\200t\244b\207\331";
+const char Event_S_0051[] PROGMEM = "t\220 \362ges\243 ha\200t\244b\207\331";
+const char Event_S_0052[] PROGMEM = "\353\313\305\265s\211He\314\272 ha\200t\244b\207\331";
+const char Event_S_0053[] PROGMEM = "\320\232a\315\235\211He\314\272 \331";
+const char Event_S_0054[] PROGMEM = "\372j\241ev\321\211He\314\272 ha\200t\244b\207\331";
+const char Event_S_0055[] PROGMEM = "sp\212\310\336et\221\211He\314\272 ha\200t\244b\207\331";
+const char Event_S_0056[] PROGMEM = "fair\211He\314\272 ha\200t\244b\207\331";
+const char Event_S_0057[] PROGMEM = "ev\271u\306\211He\314\272 ha\200t\244b\207\331";
+const char Event_S_0058[] PROGMEM = "t\220 \362ges\243\227\212ecas\245\377hd\205wn";
+const char Event_S_0059[] PROGMEM = "\336\363\330\207c\216c\251l\203";
+const char Event_S_005B[] PROGMEM = "d\317\225\257\370s";
+const char Event_S_0065[] PROGMEM = "\327\343";
+const char Event_S_0066[] PROGMEM = "\327\343\2571\264";
+const char Event_S_0067[] PROGMEM = "\327\343\2572\264";
+const char Event_S_0068[] PROGMEM = "\327\343\2574\264";
+const char Event_S_0069[] PROGMEM = "\327\343\2576\264";
+const char Event_S_006A[] PROGMEM = "\327\343\25710\264";
+const char Event_S_006B[] PROGMEM = "\327\343 \331";
+const char Event_S_006C[] PROGMEM = "q\340 (\377\374a\246\205g\207s\250\203\200\334";
+const char Event_S_006D[] PROGMEM = "q\340\2571\264 (\377\374a\246\205g\207s\250\203\200\334";
+const char Event_S_006E[] PROGMEM = "q\340\2572\264 (\377\374a\246\205g\207s\250\203\200\334";
+const char Event_S_006F[] PROGMEM = "q\340\2574\264 (\377\374a\246\205g\207s\250\203\200\334";
+const char Event_S_0070[] PROGMEM = "q\340\2576\264 (\377\374a\246\205g\207s\250\203\200\334";
+const char Event_S_0071[] PROGMEM = "q\340\25710\264 (\377\374a\246\205g\207s\250\203\200\334";
+const char Event_S_0072[] PROGMEM = "q\340 \331";
+const char Event_S_0073[] PROGMEM = "s\344 (\377\374a\246\205g\207s\250\203\200\334";
+const char Event_S_0074[] PROGMEM = "s\344\2571\264 (\377\374a\246\205g\207s\250\203\200\334";
+const char Event_S_0075[] PROGMEM = "s\344\2572\264 (\377\374a\246\205g\207s\250\203\200\334";
+const char Event_S_0076[] PROGMEM = "s\344\2574\264 (\377\374a\246\205g\207s\250\203\200\334";
+const char Event_S_0077[] PROGMEM = "s\344\2576\264 (\377\374a\246\205g\207s\250\203\200\334";
+const char Event_S_0078[] PROGMEM = "s\344\25710\264 (\377\374a\246\205g\207s\250\203\200\334";
+const char Event_S_0079[] PROGMEM = "s\344 \331";
+const char Event_S_007A[] PROGMEM = "\315\314\272 (\377\374a\246\205g\207s\250\203\200\334";
+const char Event_S_007B[] PROGMEM = "\315\314\272 \331";
+const char Event_S_007C[] PROGMEM = "t\220\227\247\221\227\230\251\231(\377\374a\246\205g\207s\250\203\200\334";
+const char Event_S_007D[] PROGMEM = "t\220 bu\254d\252up (\377\374a\246\205g\207s\250\203\200\334";
+const char Event_S_007E[] PROGMEM = "n\244p\226b\233m\200t\244\230p\212t";
+const char Event_S_007F[] PROGMEM = "t\220 \362ges\243 c\233\224\203";
+const char Event_S_0080[] PROGMEM = "\336\363\330\207c\216c\251l\203";
+const char Event_S_0081[] PROGMEM = "\327\343\2573\264";
+const char Event_S_0082[] PROGMEM = "d\326\307\356\327\343";
+const char Event_S_0083[] PROGMEM = "q\340\2573\264 (\377\374a\246\205g\207s\250\203\200\334";
+const char Event_S_0084[] PROGMEM = "d\326\307\356q\340 (\377\374a\246\205g\207s\250\203\200\334";
+const char Event_S_0085[] PROGMEM = "\210ng q\273\273\200(\377\374a\246\205g\207s\250\203\200\334";
+const char Event_S_0086[] PROGMEM = "s\344\2573\264 (\377\374a\246\205g\207s\250\203\200\334";
+const char Event_S_0087[] PROGMEM = "t\220 eas\221";
+const char Event_S_0088[] PROGMEM = "t\220 \362ges\243 (\377\374a\246\205g\207s\250\203\200\334";
+const char Event_S_0089[] PROGMEM = "t\220 \354ght\222\352\216 n\212\372\274(\377\374a\246\205g\207s\250\203\200\334";
+const char Event_S_008A[] PROGMEM = "q\340 (\377\374a\246\205g\207s\250\203\200\334\211App\226\271\374\377\374\370e";
+const char Event_S_008B[] PROGMEM = "q\340 \224o\341d a b\236d \206\352\207\305";
+const char Event_S_008C[] PROGMEM = "q\340 \346\222\352\207c\230s\245\356a h\254l";
+const char Event_S_008D[] PROGMEM = "\335\274\357\236\310c\233\224\203, n\244p\226b\233m\200t\244\230p\212t";
+const char Event_S_008E[] PROGMEM = "t\220 \315\314i\222\352\216 n\212\372\274(\377\374a\246\205g\207s\250\203\200\334";
+const char Event_S_008F[] PROGMEM = "t\220 v\222\231m\360\374\315\314i\222\352\216 n\212\372\274(\377\374a\246\205g\207s\250\203\200\334";
+const char Event_S_00C8[] PROGMEM = "mul\234 \302l\207p\254\207up\301\317\225";
+const char Event_S_00C9[] PROGMEM = "\240\375\256";
+const char Event_S_00CA[] PROGMEM = "\240\376iou\200\375\256";
+const char Event_S_00CB[] PROGMEM = "mul\234-\302l\207\357\236\245(\206volv\252\371\311\204";
+const char Event_S_00CC[] PROGMEM = "\357\236\245\206volv\252(a/\334 \315\314\231\210rr(y/ie\204";
+const char Event_S_00CD[] PROGMEM = "\240\375\256 \206volv\252haz\224dou\200\372t\222i\335s";
+const char Event_S_00CE[] PROGMEM = "\225\227u\251 sp\254l\330\207\375\256";
+const char Event_S_00CF[] PROGMEM = "\240c\315m\202a\274sp\254l\330\207\375\256";
+const char Event_S_00D0[] PROGMEM = "\311\200s\247\221\304\210ok a\245\240\375\256";
+const char Event_S_00D1[] PROGMEM = "\240\375\256 \206\352\207oppos\252\255s";
+const char Event_S_00D2[] PROGMEM = "\240sh\232\210\235\256";
+const char Event_S_00D3[] PROGMEM = "\240b\226k\236\347own \311\256";
+const char Event_S_00D4[] PROGMEM = "\240b\226k\236\347own \315\314\231\210rr(y/ie\204";
+const char Event_S_00D5[] PROGMEM = "\240\302l\207fi\230\256";
+const char Event_S_00D6[] PROGMEM = "\240\206\345\321\256";
+const char Event_S_00D7[] PROGMEM = "\240\375\256\266t\343";
+const char Event_S_00D8[] PROGMEM = "\240\375\256\266t\343\2571\264";
+const char Event_S_00D9[] PROGMEM = "\240\375\256\266t\343\2572\264";
+const char Event_S_00DA[] PROGMEM = "\240\375\256\266t\343\2574\264";
+const char Event_S_00DB[] PROGMEM = "\240\375\256\266t\343\2576\264";
+const char Event_S_00DC[] PROGMEM = "\240\375\256\266t\343\25710\264";
+const char Event_S_00DD[] PROGMEM = "\240\375\256\364\307\356\327\343";
+const char Event_S_00DE[] PROGMEM = "\240\375\256\211Q\340";
+const char Event_S_00DF[] PROGMEM = "\240\375\256\211Q\340\2571\264";
+const char Event_S_00E0[] PROGMEM = "\240\375\256\211Q\340\2572\264";
+const char Event_S_00E1[] PROGMEM = "\240\375\256\211Q\340\2574\264";
+const char Event_S_00E2[] PROGMEM = "\240\375\256\211Q\340\2576\264";
+const char Event_S_00E3[] PROGMEM = "\240\375\256\211Q\340\25710\264";
+const char Event_S_00E4[] PROGMEM = "\240\375\256\364\307\356q\340";
+const char Event_S_00E5[] PROGMEM = "\240\375\256\361";
+const char Event_S_00E6[] PROGMEM = "\240\375\256\361\2571\264";
+const char Event_S_00E7[] PROGMEM = "\240\375\256\361\2572\264";
+const char Event_S_00E8[] PROGMEM = "\240\375\256\361\2574\264";
+const char Event_S_00E9[] PROGMEM = "\240\375\256\361\2576\264";
+const char Event_S_00EA[] PROGMEM = "\240\375\256\361\25710\264";
+const char Event_S_00EB[] PROGMEM = "\240\375\256\361 \331";
+const char Event_S_00EC[] PROGMEM = "\240\375\256\211He\314\272";
+const char Event_S_00ED[] PROGMEM = "\240\375\256\211He\314\272 \331";
+const char Event_S_00EE[] PROGMEM = "\240\375\256\211T\220\227\247\221\227\230\251y";
+const char Event_S_00EF[] PROGMEM = "\240\375\256\211T\220 bu\254d\252up";
+const char Event_S_00F0[] PROGMEM = "\305 \320\232d\273\304\240\375\256";
+const char Event_S_00F1[] PROGMEM = "\240\375\256\211Righ\245\242\207\367\203";
+const char Event_S_00F2[] PROGMEM = "\240\375\256\211C\321r\207\242\207\367\203";
+const char Event_S_00F3[] PROGMEM = "\240\375\256\211Lef\245\242\207\367\203";
+const char Event_S_00F4[] PROGMEM = "\240\375\256\211H\224d should\307\367\203";
+const char Event_S_00F5[] PROGMEM = "\240\375\256\211Tw\244\255\200\367\203";
+const char Event_S_00F6[] PROGMEM = "\240\375\256\211Th\230\207\255\200\367\203";
+const char Event_S_00F7[] PROGMEM = "\375\301\317\225";
+const char Event_S_00F8[] PROGMEM = "\375\301\317\240\331";
+const char Event_S_00F9[] PROGMEM = "\375\211L\215g\347\317\225";
+const char Event_S_00FA[] PROGMEM = "\311\200s\247\221\304\210ok a\245\240\375\256\266t\343";
+const char Event_S_00FB[] PROGMEM = "\311\200s\247\221\304\210ok a\245\240\375\256\266t\343\2571\264";
+const char Event_S_00FC[] PROGMEM = "\311\200s\247\221\304\210ok a\245\240\375\256\266t\343\2572\264";
+const char Event_S_00FD[] PROGMEM = "\311\200s\247\221\304\210ok a\245\240\375\256\266t\343\2574\264";
+const char Event_S_00FE[] PROGMEM = "\311\200s\247\221\304\210ok a\245\240\375\256\266t\343\2576\264";
+const char Event_S_00FF[] PROGMEM = "\311\200s\247\221\304\210ok a\245\240\375\256\266t\343\25710\264";
+const char Event_S_0100[] PROGMEM = "\311\200s\247\221\304\210ok a\245\240\375\256\364\307\356\327\343";
+const char Event_S_0101[] PROGMEM = "\311\200s\247\221\304\210ok a\245\240\375\256\211Q\340";
+const char Event_S_0102[] PROGMEM = "\311\200s\247\221\304\210ok a\245\240\375\256\211Q\340\2571\264";
+const char Event_S_0103[] PROGMEM = "\311\200s\247\221\304\210ok a\245\240\375\256\211Q\340\2572\264";
+const char Event_S_0104[] PROGMEM = "\311\200s\247\221\304\210ok a\245\240\375\256\211Q\340\2574\264";
+const char Event_S_0105[] PROGMEM = "\311\200s\247\221\304\210ok a\245\240\375\256\211Q\340\2576\264";
+const char Event_S_0106[] PROGMEM = "\311\200s\247\221\304\210ok a\245\240\375\256\211Q\340\25710\264";
+const char Event_S_0107[] PROGMEM = "\311\200s\247\221\304\210ok a\245\240\375\256\364\307\356q\340";
+const char Event_S_0108[] PROGMEM = "\311\200s\247\221\304\210ok a\245\240\375\256\361";
+const char Event_S_0109[] PROGMEM = "\311\200s\247\221\304\210ok a\245\240\375\256\361\2571\264";
+const char Event_S_010A[] PROGMEM = "\311\200s\247\221\304\210ok a\245\240\375\256\361\2572\264";
+const char Event_S_010B[] PROGMEM = "\311\200s\247\221\304\210ok a\245\240\375\256\361\2574\264";
+const char Event_S_010C[] PROGMEM = "\311\200s\247\221\304\210ok a\245\240\375\256\361\2576\264";
+const char Event_S_010D[] PROGMEM = "\311\200s\247\221\304\210ok a\245\240\375\256\361\25710\264";
+const char Event_S_010E[] PROGMEM = "\311\200s\247\221\304\210ok a\245\240\375\256\361 \331";
+const char Event_S_010F[] PROGMEM = "\311\200s\247\221\304\210ok a\245\240\375\256\211He\314\272";
+const char Event_S_0110[] PROGMEM = "\311\200s\247\221\304\210ok a\245\240\375\256\211He\314\272 \331";
+const char Event_S_0112[] PROGMEM = "\311\200s\247\221\304\210ok a\245\240\375\256\211T\220 bu\254d\252up";
+const char Event_S_0113[] PROGMEM = "\311\200s\247\221\304\210ok a\245\375\301\317\225";
+const char Event_S_0114[] PROGMEM = "\311\200s\247\221\304\210ok a\245\375\301\317\240\331";
+const char Event_S_0115[] PROGMEM = "\311\200s\247\221\304\210ok a\245\375\211L\215g\347\317\225";
+const char Event_S_0116[] PROGMEM = "\240sh\232\210\235\256\266t\343";
+const char Event_S_0117[] PROGMEM = "\240sh\232\210\235\256\266t\343\2571\264";
+const char Event_S_0118[] PROGMEM = "\240sh\232\210\235\256\266t\343\2572\264";
+const char Event_S_0119[] PROGMEM = "\240sh\232\210\235\256\266t\343\2574\264";
+const char Event_S_011A[] PROGMEM = "\240sh\232\210\235\256\266t\343\2576\264";
+const char Event_S_011B[] PROGMEM = "\240sh\232\210\235\256\266t\343\25710\264";
+const char Event_S_011C[] PROGMEM = "\240sh\232\210\235\256\364\307\356\327\343";
+const char Event_S_011D[] PROGMEM = "\240sh\232\210\235\256\211Q\340";
+const char Event_S_011E[] PROGMEM = "\240sh\232\210\235\256\211Q\340\2571\264";
+const char Event_S_011F[] PROGMEM = "\240sh\232\210\235\256\211Q\340\2572\264";
+const char Event_S_0120[] PROGMEM = "\240sh\232\210\235\256\211Q\340\2574\264";
+const char Event_S_0121[] PROGMEM = "\240sh\232\210\235\256\211Q\340\2576\264";
+const char Event_S_0122[] PROGMEM = "\240sh\232\210\235\256\211Q\340\25710\264";
+const char Event_S_0123[] PROGMEM = "\240sh\232\210\235\256\364\307\356q\340";
+const char Event_S_0124[] PROGMEM = "\240sh\232\210\235\256\361";
+const char Event_S_0125[] PROGMEM = "\240sh\232\210\235\256\361\2571\264";
+const char Event_S_0126[] PROGMEM = "\240sh\232\210\235\256\361\2572\264";
+const char Event_S_0127[] PROGMEM = "\240sh\232\210\235\256\361\2574\264";
+const char Event_S_0128[] PROGMEM = "\240sh\232\210\235\256\361\2576\264";
+const char Event_S_0129[] PROGMEM = "\240sh\232\210\235\256\361\25710\264";
+const char Event_S_012A[] PROGMEM = "\240sh\232\210\235\256\361 \331";
+const char Event_S_012B[] PROGMEM = "\240sh\232\210\235\256\211He\314\272";
+const char Event_S_012C[] PROGMEM = "\240sh\232\210\235\256\211He\314\272 \331";
+const char Event_S_012D[] PROGMEM = "\240sh\232\210\235\256\211T\220\227\247\221\227\230\251y";
+const char Event_S_012E[] PROGMEM = "\240sh\232\210\235\256\211T\220 bu\254d\252up";
+const char Event_S_012F[] PROGMEM = "\367\232b\231\240sh\232\210\235\256";
+const char Event_S_0130[] PROGMEM = "\240sh\232\210\235\256\211Righ\245\242\207\367\203";
+const char Event_S_0131[] PROGMEM = "\240sh\232\210\235\256\211C\321r\207\242\207\367\203";
+const char Event_S_0132[] PROGMEM = "\240sh\232\210\235\256\211Lef\245\242\207\367\203";
+const char Event_S_0133[] PROGMEM = "\240sh\232\210\235\256\211H\224d should\307\367\203";
+const char Event_S_0134[] PROGMEM = "\240sh\232\210\235\256\211Tw\244\255\200\367\203";
+const char Event_S_0135[] PROGMEM = "\240sh\232\210\235\256\211Th\230\207\255\200\367\203";
+const char Event_S_0136[] PROGMEM = "sh\232\210\235\301\317\225";
+const char Event_S_0137[] PROGMEM = "sh\232\210\235\301\317\240\331";
+const char Event_S_0138[] PROGMEM = "sh\232\210\235\211L\215g\347\317\225";
+const char Event_S_0139[] PROGMEM = "\240b\226k\236\347own \311\256\266t\343";
+const char Event_S_013A[] PROGMEM = "\240b\226k\236\347own \311\256\364\307\356\327\343";
+const char Event_S_013B[] PROGMEM = "\240b\226k\236\347own \311\256\211Q\340";
+const char Event_S_013C[] PROGMEM = "\240b\226k\236\347own \311\256\364\307\356q\340";
+const char Event_S_013D[] PROGMEM = "\240b\226k\236\347own \311\256\361";
+const char Event_S_013E[] PROGMEM = "\240b\226k\236\347own \311\256\361 \331";
+const char Event_S_013F[] PROGMEM = "\240b\226k\236\347own \311\256\211He\314\272";
+const char Event_S_0140[] PROGMEM = "\240b\226k\236\347own \311\256\211He\314\272 \331";
+const char Event_S_0141[] PROGMEM = "\240b\226k\236\347own \311\256\211T\220\227\247\221\227\230\251y";
+const char Event_S_0142[] PROGMEM = "\240b\226k\236\347own \311\256.T\220 bu\254d\252up";
+const char Event_S_0143[] PROGMEM = "\367\232b\231\240b\226k\236\347own \311\256.";
+const char Event_S_0144[] PROGMEM = "\240b\226k\236\347own \311\256\211Righ\245\242\207\367\203";
+const char Event_S_0145[] PROGMEM = "\240b\226k\236\347own \311\256\211C\321r\207\242\207\367\203";
+const char Event_S_0146[] PROGMEM = "\240b\226k\236\347own \311\256\211Lef\245\242\207\367\203";
+const char Event_S_0147[] PROGMEM = "\240b\226k\236\347own \311\256\211H\224d should\307\367\203";
+const char Event_S_0148[] PROGMEM = "\240b\226k\236\347own \311\256\211Tw\244\255\200\367\203";
+const char Event_S_0149[] PROGMEM = "\240b\226k\236\347own \311\256\211Th\230\207\255\200\367\203";
+const char Event_S_014A[] PROGMEM = "b\226k\236\347own \311\301\317\225";
+const char Event_S_014B[] PROGMEM = "b\226k\236\347own \311\301\317\240\331";
+const char Event_S_014C[] PROGMEM = "b\226k\236\347own \311\211L\215g\347\317\225";
+const char Event_S_014D[] PROGMEM = "\357\236\245c\233\224\203";
+const char Event_S_014E[] PROGMEM = "\336\363\330\207c\216c\251l\203";
+const char Event_S_014F[] PROGMEM = "\357\236\245\206volv\252(a/\334 bus(e\204";
+const char Event_S_0150[] PROGMEM = "\240o\254 sp\254l\330\207\375\256";
+const char Event_S_0151[] PROGMEM = "\240\346\222t\300n\232\311\256";
+const char Event_S_0152[] PROGMEM = "\240\346\222t\300n\232\315\314\231\210rr(y/ie\204";
+const char Event_S_0153[] PROGMEM = "\240j\271kknif\203\201\205\254\222\256";
+const char Event_S_0154[] PROGMEM = "\240j\271kknif\232ca\205v\216\256";
+const char Event_S_0155[] PROGMEM = "\240j\271kknif\232\224t\202ulat\232\210rr(y/ie\204";
+const char Event_S_0156[] PROGMEM = "\240\311\256 sp\341 \224o\341d";
+const char Event_S_0157[] PROGMEM = "\240e\224\354\307\375\256";
+const char Event_S_0158[] PROGMEM = "\357\236\245\206\246s\234g\306 \265";
+const char Event_S_0159[] PROGMEM = "\240\260\362d\224\231\375\256";
+const char Event_S_015A[] PROGMEM = "\240b\226k\236\347own bus(e\204";
+const char Event_S_015B[] PROGMEM = "\240\346\222\315igh\245\311\256";
+const char Event_S_015C[] PROGMEM = "\240\375\256\266t\343\2573\264";
+const char Event_S_015D[] PROGMEM = "\240\375\256\211Q\340\2573\264";
+const char Event_S_015E[] PROGMEM = "\240\375\256\361\2573\264";
+const char Event_S_015F[] PROGMEM = "\240\375\256 \206 \305\265\200\224ea";
+const char Event_S_0160[] PROGMEM = "\311\200s\247\221\304\210ok a\245\240\375\256\266t\343\2573\264";
+const char Event_S_0161[] PROGMEM = "\311\200s\247\221\304\210ok a\245\240\375\256\211Q\340\2573\264";
+const char Event_S_0162[] PROGMEM = "\311\200s\247\221\304\210ok a\245\240\375\256\361\2573\264";
+const char Event_S_0163[] PROGMEM = "\311\200s\247\221\304\210ok a\245\240\375\256\364\222";
+const char Event_S_0164[] PROGMEM = "\240sh\232\210\235\256\266t\343\2573\264";
+const char Event_S_0165[] PROGMEM = "\240sh\232\210\235\256\211Q\340\2573\264";
+const char Event_S_0166[] PROGMEM = "\240sh\232\210\235\256\361\2573\264";
+const char Event_S_0167[] PROGMEM = "\240sh\232\210\235\256\364\222";
+const char Event_S_0168[] PROGMEM = "\240\346\222t\300n\232\311\256\266t\343";
+const char Event_S_0169[] PROGMEM = "\240\346\222t\300n\232\311\256\364\307\356\327\343";
+const char Event_S_016A[] PROGMEM = "\240\346\222t\300n\232\311\256\211Q\340";
+const char Event_S_016B[] PROGMEM = "\240\346\222t\300n\232\311\256\364\307\356q\340";
+const char Event_S_016C[] PROGMEM = "\240\346\222t\300n\232\311\256\361";
+const char Event_S_016D[] PROGMEM = "\240\346\222t\300n\232\311\256\361 \331";
+const char Event_S_016E[] PROGMEM = "\240\346\222t\300n\232\311\256\211He\314\272";
+const char Event_S_016F[] PROGMEM = "\240\346\222t\300n\232\311\256\211He\314\272 \331";
+const char Event_S_0170[] PROGMEM = "\240\346\222t\300n\232\311\256\211T\220 bu\254d\252up";
+const char Event_S_0171[] PROGMEM = "\367\232b\231\240\346\222t\300n\232\311\256";
+const char Event_S_0172[] PROGMEM = "\240\346\222t\300n\232\311\256\211Righ\245\242\207\367\203";
+const char Event_S_0173[] PROGMEM = "\240\346\222t\300n\232\311\256\211C\321r\207\242\207\367\203";
+const char Event_S_0174[] PROGMEM = "\240\346\222t\300n\232\311\256\211Lef\245\242\207\367\203";
+const char Event_S_0175[] PROGMEM = "\240\346\222t\300n\232\311\256\211Tw\244\255\200\367\203";
+const char Event_S_0176[] PROGMEM = "\240\346\222t\300n\232\311\256\211Th\230\207\255\200\367\203";
+const char Event_S_0177[] PROGMEM = "\346\222t\300n\232\311\301\317\225";
+const char Event_S_0178[] PROGMEM = "\346\222t\300n\232\311\301\317\240\331";
+const char Event_S_0179[] PROGMEM = "\346\222t\300n\232\311\211L\215g\347\317\225";
+const char Event_S_017A[] PROGMEM = "\240\346\222t\300n\232\311\256\364\222";
+const char Event_S_017B[] PROGMEM = "St\343\347\273\304\240e\224\354\307\375\256";
+const char Event_S_017C[] PROGMEM = "D\326\307\356\327\343\347\273\304\240e\224\354\307\375\256";
+const char Event_S_017D[] PROGMEM = "Q\340\347\273\304\240e\224\354\307\375\256";
+const char Event_S_017E[] PROGMEM = "D\326\307\356q\340\347\273\304\240e\224\354\307\375\256";
+const char Event_S_017F[] PROGMEM = "S\344\347\273\304\240e\224\354\307\375\256";
+const char Event_S_0181[] PROGMEM = "He\314\272\347\273\304\240e\224\354\307\375\256";
+const char Event_S_0183[] PROGMEM = "T\220 bu\254d\252up\347\273\304\240e\224\354\307\375\256";
+const char Event_S_0184[] PROGMEM = "D\317\240d\273\304e\224\354\307\375";
+const char Event_S_0186[] PROGMEM = "L\215g\347\317\240d\273\304e\224\354\307\375";
+const char Event_S_0187[] PROGMEM = "\357\236\245\206\246s\234g\306 \265\364\222";
+const char Event_S_0188[] PROGMEM = "\240\260\362d\224\231\375\256\364\222";
+const char Event_S_0189[] PROGMEM = "\240b\226k\236\347own \311\256\364\222";
+const char Event_S_018A[] PROGMEM = "\240b\226k\236\347own \315\314\231\210rr(y/ie\204\364\222";
+const char Event_S_018B[] PROGMEM = "\305 c\233\224\203";
+const char Event_S_018C[] PROGMEM = "\206\345\236\245c\233\224\203";
+const char Event_S_018D[] PROGMEM = "\230scu\207\216d \230c\346\222\231\265 \206 p\226g\230\363";
+const char Event_S_018F[] PROGMEM = "\336\363\330\207c\216c\251l\203";
+const char Event_S_0191[] PROGMEM = "\320\203";
+const char Event_S_0192[] PROGMEM = "\367\203";
+const char Event_S_0193[] PROGMEM = "\320\203\257\315\314\231\311\200(\346\307\334";
+const char Event_S_0194[] PROGMEM = "\350\352\226ugh\223\257\315\314\231\210r\337e\200(\346\307\334";
+const char Event_S_0195[] PROGMEM = "\350\352\226ugh\223";
+const char Event_S_0196[] PROGMEM = "\270th) \321r\231s\354p \305 \320\203";
+const char Event_S_0197[] PROGMEM = "\270th) \276i\245s\354p \305 \320\203";
+const char Event_S_0198[] PROGMEM = "s\354p \305\200\320\203";
+const char Event_S_0199[] PROGMEM = "s\354p \305 \230\327r\202\243s";
+const char Event_S_019A[] PROGMEM = "\320\232a\315\235\266t\343";
+const char Event_S_019B[] PROGMEM = "\320\232a\315\235\266t\343\2571\264";
+const char Event_S_019C[] PROGMEM = "\320\232a\315\235\266t\343\2572\264";
+const char Event_S_019D[] PROGMEM = "\320\232a\315\235\266t\343\2574\264";
+const char Event_S_019E[] PROGMEM = "\320\232a\315\235\266t\343\2576\264";
+const char Event_S_019F[] PROGMEM = "\320\232a\315\235\266t\343\25710\264";
+const char Event_S_01A0[] PROGMEM = "\320\232a\315\235\364\307\356\327\343";
+const char Event_S_01A1[] PROGMEM = "\320\232a\315\235\211Q\340";
+const char Event_S_01A2[] PROGMEM = "\320\232a\315\235\211Q\340\2571\264";
+const char Event_S_01A3[] PROGMEM = "\320\232a\315\235\211Q\340\2572\264";
+const char Event_S_01A4[] PROGMEM = "\320\232a\315\235\211Q\340\2574\264";
+const char Event_S_01A5[] PROGMEM = "\320\232a\315\235\211Q\340\2576\264";
+const char Event_S_01A6[] PROGMEM = "\320\232a\315\235\211Q\340\25710\264";
+const char Event_S_01A7[] PROGMEM = "\320\232a\315\235\364\307\356q\340";
+const char Event_S_01A8[] PROGMEM = "\320\232a\315\235\361";
+const char Event_S_01A9[] PROGMEM = "\320\232a\315\235\361\2571\264";
+const char Event_S_01AA[] PROGMEM = "\320\232a\315\235\361\2572\264";
+const char Event_S_01AB[] PROGMEM = "\320\232a\315\235\361\2574\264";
+const char Event_S_01AC[] PROGMEM = "\320\232a\315\235\361\2576\264";
+const char Event_S_01AD[] PROGMEM = "\320\232a\315\235\361\25710\264";
+const char Event_S_01AE[] PROGMEM = "\320\232a\315\235\361 \331";
+const char Event_S_01AF[] PROGMEM = "\320\232a\315\235\211He\314\272";
+const char Event_S_01B0[] PROGMEM = "\320\232a\315\235\211He\314\272 \331";
+const char Event_S_01B1[] PROGMEM = "\320\232a\315\235\211T\220\227\247\221\227\230\251y";
+const char Event_S_01B2[] PROGMEM = "\320\232a\315\235\211T\220 bu\254d\252up";
+const char Event_S_01B3[] PROGMEM = "\320\232a\315\235\301\317\225";
+const char Event_S_01B4[] PROGMEM = "\320\232a\315\235\301\317\240\331";
+const char Event_S_01B5[] PROGMEM = "\320\232a\315\235\211L\215g\347\317\225";
+const char Event_S_01B6[] PROGMEM = "\367\232a\315\235\266t\343";
+const char Event_S_01B7[] PROGMEM = "\367\232a\315\235\266t\343\2571\264";
+const char Event_S_01B8[] PROGMEM = "\367\232a\315\235\266t\343\2572\264";
+const char Event_S_01B9[] PROGMEM = "\367\232a\315\235\266t\343\2574\264";
+const char Event_S_01BA[] PROGMEM = "\367\232a\315\235\266t\343\2576\264";
+const char Event_S_01BB[] PROGMEM = "\367\232a\315\235\266t\343\25710\264";
+const char Event_S_01BC[] PROGMEM = "\367\232a\315\235\364\307\356\327\343";
+const char Event_S_01BD[] PROGMEM = "\367\232a\315\235\211Q\340";
+const char Event_S_01BE[] PROGMEM = "\367\232a\315\235\211Q\340\2571\264";
+const char Event_S_01BF[] PROGMEM = "\367\232a\315\235\211Q\340\2572\264";
+const char Event_S_01C0[] PROGMEM = "\367\232a\315\235\211Q\340\2574\264";
+const char Event_S_01C1[] PROGMEM = "\367\232a\315\235\211Q\340\2576\264";
+const char Event_S_01C2[] PROGMEM = "\367\232a\315\235\211Q\340\25710\264";
+const char Event_S_01C3[] PROGMEM = "\367\232a\315\235\364\307\356q\340";
+const char Event_S_01C4[] PROGMEM = "\367\232a\315\235\361";
+const char Event_S_01C5[] PROGMEM = "\367\232a\315\235\361\2571\264";
+const char Event_S_01C6[] PROGMEM = "\367\232a\315\235\361\2572\264";
+const char Event_S_01C7[] PROGMEM = "\367\232a\315\235\361\2574\264";
+const char Event_S_01C8[] PROGMEM = "\367\232a\315\235\361\2576\264";
+const char Event_S_01C9[] PROGMEM = "\367\232a\315\235\361\25710\264";
+const char Event_S_01CA[] PROGMEM = "\367\232a\315\235\361 \331";
+const char Event_S_01CB[] PROGMEM = "\367\232a\315\235\211He\314\272";
+const char Event_S_01CC[] PROGMEM = "\367\232a\315\235\211He\314\272 \331";
+const char Event_S_01CD[] PROGMEM = "\367\232a\315\235\211T\220\227\247\221\227\230\251y";
+const char Event_S_01CE[] PROGMEM = "\367\232a\315\235\211T\220 bu\254d\252up";
+const char Event_S_01CF[] PROGMEM = "\367\232a\315\235\301\317\225";
+const char Event_S_01D0[] PROGMEM = "\367\232a\315\235\301\317\240\331";
+const char Event_S_01D1[] PROGMEM = "\367\232a\315\235\211L\215g\347\317\225";
+const char Event_S_01D2[] PROGMEM = "s\354p \305\200\230op\236\203";
+const char Event_S_01D3[] PROGMEM = "\230op\236\203";
+const char Event_S_01D4[] PROGMEM = "\336\363\330\207c\216c\251l\203";
+const char Event_S_01D5[] PROGMEM = "\320\232a\315\235";
+const char Event_S_01D6[] PROGMEM = "\367\232a\315\235";
+const char Event_S_01D7[] PROGMEM = "\240\321r\231s\354p \305\256 \320\203";
+const char Event_S_01D8[] PROGMEM = "\270th) \321r\231s\354p \305 \367\203";
+const char Event_S_01D9[] PROGMEM = "\321r\231\367\203";
+const char Event_S_01DA[] PROGMEM = "\240\276i\245s\354p \305\256 \320\203";
+const char Event_S_01DB[] PROGMEM = "\270th) \276i\245s\354p \305 \367\203";
+const char Event_S_01DC[] PROGMEM = "\276i\245\367\203";
+const char Event_S_01DD[] PROGMEM = "s\354p \305\200\367\203";
+const char Event_S_01DE[] PROGMEM = "\362ne\303\252\370\337\330ewa\231\320\203";
+const char Event_S_01DF[] PROGMEM = "pa\205l\233\274\370\337\330ewa\231\320\203";
+const char Event_S_01E0[] PROGMEM = "\337ght-h\216d pa\205l\233\274\370\337\330ewa\231\320\203";
+const char Event_S_01E1[] PROGMEM = "\233ft-h\216d pa\205l\233\274\370\337\330ewa\231\320\203";
+const char Event_S_01E2[] PROGMEM = "\276p\230s\200\255\200\320\203";
+const char Event_S_01E3[] PROGMEM = "th\226ugh\223 \255\200\320\203";
+const char Event_S_01E4[] PROGMEM = "\210ca\274\255\200\320\203";
+const char Event_S_01E5[] PROGMEM = "\362ne\303\252\370\337\330ewa\231\367\203";
+const char Event_S_01E6[] PROGMEM = "pa\205l\233\274\370\337\330ewa\231\367\203";
+const char Event_S_01E7[] PROGMEM = "\337ght-h\216d pa\205l\233\274\370\337\330ewa\231\367\203";
+const char Event_S_01E8[] PROGMEM = "\233ft-h\216d pa\205l\233\274\370\337\330ewa\231\367\203";
+const char Event_S_01E9[] PROGMEM = "\276p\230s\200\255\200\367\203";
+const char Event_S_01EA[] PROGMEM = "th\226ugh\223 \255\200\367\203";
+const char Event_S_01EB[] PROGMEM = "\210ca\274\255\200\367\203";
+const char Event_S_01EC[] PROGMEM = "n\244mot\241\311s";
+const char Event_S_01ED[] PROGMEM = "\230\327r\202\243s";
+const char Event_S_01EE[] PROGMEM = "\320\203\257\315\314\231\210r\337e\200(\346\307\334";
+const char Event_S_01EF[] PROGMEM = "\320\232a\315\235\266t\343\2573\264";
+const char Event_S_01F0[] PROGMEM = "\320\232a\315\235\211Q\340\2573\264";
+const char Event_S_01F1[] PROGMEM = "\320\232a\315\235\361\2573\264";
+const char Event_S_01F2[] PROGMEM = "\367\232a\315\235\266t\343\2573\264";
+const char Event_S_01F3[] PROGMEM = "\367\232a\315\235\211Q\340\2573\264";
+const char Event_S_01F4[] PROGMEM = "\240\255\256 \320\203";
+const char Event_S_01F5[] PROGMEM = "\240\337gh\245\255\256 \320\203";
+const char Event_S_01F6[] PROGMEM = "\240c\321r\207\255\256 \320\203";
+const char Event_S_01F7[] PROGMEM = "\240\233f\245\255\256 \320\203";
+const char Event_S_01F8[] PROGMEM = "h\224d should\307\320\203";
+const char Event_S_01F9[] PROGMEM = "tw\244\255\200\320\203";
+const char Event_S_01FA[] PROGMEM = "th\230\207\255\200\320\203";
+const char Event_S_01FB[] PROGMEM = "\240\337gh\245\255\256 \367\203";
+const char Event_S_01FC[] PROGMEM = "\240c\321r\207\255\256 \367\203";
+const char Event_S_01FD[] PROGMEM = "\240\233f\245\255\256 \367\203";
+const char Event_S_01FE[] PROGMEM = "h\224d should\307\367\203";
+const char Event_S_01FF[] PROGMEM = "tw\244\255\200\367\203";
+const char Event_S_0200[] PROGMEM = "th\230\207\255\200\367\203";
+const char Event_S_0201[] PROGMEM = "s\221l\207\335t\222nat\207l\206e\223";
+const char Event_S_0202[] PROGMEM = "\370\337\330ewa\231\373\232(f\226m \371\255\204\304\215\207\255";
+const char Event_S_0203[] PROGMEM = "\370\337\330ewa\231\373\232(f\226m \371\255\204\201o\201w\244\255s";
+const char Event_S_0204[] PROGMEM = "\370\337\330ewa\231\373\232(f\226m \371\255\204\201o\352\230\207\255s";
+const char Event_S_0205[] PROGMEM = "\362t\214\247";
+const char Event_S_0206[] PROGMEM = "n\224\226w \255s";
+const char Event_S_0207[] PROGMEM = "\362t\214\247 \377\374n\224\226w \255s";
+const char Event_S_0208[] PROGMEM = "\240\255\256 \367\203";
+const char Event_S_0209[] PROGMEM = "\240\255\200\320\203\266t\343";
+const char Event_S_020A[] PROGMEM = "\240\255\200\320\203\266t\343\2571\264";
+const char Event_S_020B[] PROGMEM = "\240\255\200\320\203\266t\343\2572\264";
+const char Event_S_020C[] PROGMEM = "\240\255\200\320\203\266t\343\2574\264";
+const char Event_S_020D[] PROGMEM = "\240\255\200\320\203\266t\343\2576\264";
+const char Event_S_020E[] PROGMEM = "\240\255\200\320\203\266t\343\25710\264";
+const char Event_S_020F[] PROGMEM = "\240\255\200\320\203\364\307\356\327\343";
+const char Event_S_0210[] PROGMEM = "\240\255\200\320\203\211Q\340";
+const char Event_S_0211[] PROGMEM = "\240\255\200\320\203\211Q\340\2571\264";
+const char Event_S_0212[] PROGMEM = "\240\255\200\320\203\211Q\340\2572\264";
+const char Event_S_0213[] PROGMEM = "\240\255\200\320\203\211Q\340\2574\264";
+const char Event_S_0214[] PROGMEM = "\240\255\200\320\203\211Q\340\2576\264";
+const char Event_S_0215[] PROGMEM = "\240\255\200\320\203\211Q\340\25710\264";
+const char Event_S_0216[] PROGMEM = "\240\255\200\320\203\364\307\356q\340";
+const char Event_S_0217[] PROGMEM = "\240\255\200\320\203\361";
+const char Event_S_0218[] PROGMEM = "\240\255\200\320\203\361\2571\264";
+const char Event_S_0219[] PROGMEM = "\240\255\200\320\203\361\2572\264";
+const char Event_S_021A[] PROGMEM = "\240\255\200\320\203\361\2574\264";
+const char Event_S_021B[] PROGMEM = "\240\255\200\320\203\361\2576\264";
+const char Event_S_021C[] PROGMEM = "\240\255\200\320\203\361\25710\264";
+const char Event_S_021D[] PROGMEM = "\240\255\200\320\203\361 \331";
+const char Event_S_021E[] PROGMEM = "\240\255\200\320\203\211He\314\272";
+const char Event_S_021F[] PROGMEM = "\240\255\200\320\203\211He\314\272 \331";
+const char Event_S_0220[] PROGMEM = "\225\255\200\320\203\211T\220\227\247\221\227\230\251y";
+const char Event_S_0221[] PROGMEM = "\225\255\200\320\203\211T\220 bu\254d\252up";
+const char Event_S_0222[] PROGMEM = "\370\337\330ewa\231\373\232(f\226m \371\255\204\304\215\207\255\266t\343";
+const char Event_S_0223[] PROGMEM = "\370\337\330ewa\231\373\232(f\226m \371\255\204\304\215\207\255\364\307\356\327\343";
+const char Event_S_0224[] PROGMEM = "\370\337\330ewa\231\373\232(f\226m \371\255\204\304\215\207\255\211Q\340";
+const char Event_S_0225[] PROGMEM = "\370\337\330ewa\231\373\232(f\226m \371\255\204\304\215\207\255\364\307\356q\340";
+const char Event_S_0226[] PROGMEM = "\370\337\330ewa\231\373\232(f\226m \371\255\204\304\215\207\255\361";
+const char Event_S_0227[] PROGMEM = "\370\337\330ewa\231\373\232(f\226m \371\255\204\304\215\207\255\361 \331";
+const char Event_S_0228[] PROGMEM = "\370\337\330ewa\231\373\232(f\226m \371\255\204\304\215\207\255\211He\314\272";
+const char Event_S_0229[] PROGMEM = "\370\337\330ewa\231\373\232(f\226m \371\255\204\304\215\207\255\211He\314\272 \331";
+const char Event_S_022A[] PROGMEM = "\370\337\330ewa\231\373\232(f\226m \371\255\204\304\215\207\255\211T\220\227\247\221\227\230\251y";
+const char Event_S_022B[] PROGMEM = "\370\337\330ewa\231\373\232(f\226m \371\255\204\304\215\207\255\211T\220 bu\254d\252up";
+const char Event_S_022C[] PROGMEM = "\370\337\330ewa\231\373\232(f\226m \371\255\204\201o\201w\244\255s\266t\343";
+const char Event_S_022D[] PROGMEM = "\370\337\330ewa\231\373\232(f\226m \371\255\204\201o\201w\244\255s\364\307\356\327\343";
+const char Event_S_022E[] PROGMEM = "\370\337\330ewa\231\373\232(f\226m \371\255\204\201o\201w\244\255s\211Q\340";
+const char Event_S_022F[] PROGMEM = "\370\337\330ewa\231\373\232(f\226m \371\255\204\201o\201w\244\255s\364\307\356q\340";
+const char Event_S_0230[] PROGMEM = "\370\337\330ewa\231\373\232(f\226m \371\255\204\201o\201w\244\255s\361";
+const char Event_S_0231[] PROGMEM = "\370\337\330ewa\231\373\232(f\226m \371\255\204\201o\201w\244\255s\361 \331";
+const char Event_S_0232[] PROGMEM = "\370\337\330ewa\231\373\232(f\226m \371\255\204\201o\201w\244\255s\211He\314\272";
+const char Event_S_0233[] PROGMEM = "\370\337\330ewa\231\373\232(f\226m \371\255\204\201o\201w\244\255s\211He\314\272 \331";
+const char Event_S_0234[] PROGMEM = "\370\337\330ewa\231\373\232(f\226m \371\255\204\201o\201w\244\255s\211T\220\227\247\221\227\230\251y";
+const char Event_S_0235[] PROGMEM = "\370\337\330ewa\231\373\232(f\226m \371\255\204\201o\201w\244\255s\211T\220 bu\254d\252up";
+const char Event_S_0236[] PROGMEM = "\370\337\330ewa\231\373\232(f\226m \371\255\204\201o\352\230\207\255s\266t\343";
+const char Event_S_0237[] PROGMEM = "\370\337\330ewa\231\373\232(f\226m \371\255\204\201o\352\230\207\255s\364\307\356\327\343";
+const char Event_S_0238[] PROGMEM = "\370\337\330ewa\231\373\232(f\226m \371\255\204\201o\352\230\207\255s\211Q\340";
+const char Event_S_0239[] PROGMEM = "\370\337\330ewa\231\373\232(f\226m \371\255\204\201o\352\230\207\255s\364\307\356q\340";
+const char Event_S_023A[] PROGMEM = "\370\337\330ewa\231\373\232(f\226m \371\255\204\201o\352\230\207\255s\361";
+const char Event_S_023B[] PROGMEM = "\370\337\330ewa\231\373\232(f\226m \371\255\204\201o\352\230\207\255s\361 \331";
+const char Event_S_023C[] PROGMEM = "\370\337\330ewa\231\373\232(f\226m \371\255\204\201o\352\230\207\255s\211He\314\272";
+const char Event_S_023D[] PROGMEM = "\370\337\330ewa\231\373\232(f\226m \371\255\204\201o\352\230\207\255s\211He\314\272 \331";
+const char Event_S_023E[] PROGMEM = "\370\337\330ewa\231\373\232(f\226m \371\255\204\201o\352\230\207\255s\211T\220\227\247\221\227\230\251y";
+const char Event_S_023F[] PROGMEM = "\370\337\330ewa\231\373\232(f\226m \371\255\204\201o\352\230\207\255s\211T\220 bu\254d\252up";
+const char Event_S_0240[] PROGMEM = "\362t\214\247\266t\343";
+const char Event_S_0241[] PROGMEM = "\362t\214\247\266t\343\2571\264";
+const char Event_S_0242[] PROGMEM = "\362t\214\247\266t\343\2572\264";
+const char Event_S_0243[] PROGMEM = "\362t\214\247\266t\343\2574\264";
+const char Event_S_0244[] PROGMEM = "\362t\214\247\266t\343\2576\264";
+const char Event_S_0245[] PROGMEM = "\362t\214\247\266t\343\25710\264";
+const char Event_S_0246[] PROGMEM = "\362t\214\247\364\307\356\327\343";
+const char Event_S_0247[] PROGMEM = "\362t\214\247\211Q\340";
+const char Event_S_0248[] PROGMEM = "\362t\214\247\211Q\340\2571\264";
+const char Event_S_0249[] PROGMEM = "\362t\214\247\211Q\340\2572\264";
+const char Event_S_024A[] PROGMEM = "\362t\214\247\211Q\340\2574\264";
+const char Event_S_024B[] PROGMEM = "\362t\214\247\211Q\340\2576\264";
+const char Event_S_024C[] PROGMEM = "\362t\214\247\211Q\340\25710\264";
+const char Event_S_024D[] PROGMEM = "\362t\214\247\364\307\356q\340";
+const char Event_S_024E[] PROGMEM = "\362t\214\247\361";
+const char Event_S_024F[] PROGMEM = "\362t\214\247\361\2571\264";
+const char Event_S_0250[] PROGMEM = "\362t\214\247\361\2572\264";
+const char Event_S_0251[] PROGMEM = "\362t\214\247\361\2574\264";
+const char Event_S_0252[] PROGMEM = "\362t\214\247\361\2576\264";
+const char Event_S_0253[] PROGMEM = "\362t\214\247\361\25710\264";
+const char Event_S_0254[] PROGMEM = "\362t\214\247\361 \331";
+const char Event_S_0255[] PROGMEM = "\362t\214\247\211He\314\272";
+const char Event_S_0256[] PROGMEM = "\362t\214\247\211He\314\272 \331";
+const char Event_S_0257[] PROGMEM = "\362t\214\247\211T\220\227\247\221\227\230\251y";
+const char Event_S_0258[] PROGMEM = "\362t\214\247\211T\220 bu\254d\252up";
+const char Event_S_0259[] PROGMEM = "\362t\214\247\211C\224\337\330ewa\231\373\232(f\226m \371\255\204\304\215\207\255";
+const char Event_S_025A[] PROGMEM = "\362t\214\247\211C\224\337\330ewa\231\373\232(f\226m \371\255\204\201o\201w\244\255s";
+const char Event_S_025B[] PROGMEM = "\362t\214\247\211C\224\337\330ewa\231\373\232(f\226m \371\255\204\201o\352\230\207\255s";
+const char Event_S_025C[] PROGMEM = "n\224\226w \255s\266t\343";
+const char Event_S_025D[] PROGMEM = "n\224\226w \255s\364\307\356\327\343";
+const char Event_S_025E[] PROGMEM = "n\224\226w \255s\211Q\340";
+const char Event_S_025F[] PROGMEM = "n\224\226w \255s\364\307\356q\340";
+const char Event_S_0260[] PROGMEM = "n\224\226w \255s\361";
+const char Event_S_0261[] PROGMEM = "n\224\226w \255s\361 \331";
+const char Event_S_0262[] PROGMEM = "n\224\226w \255s\211He\314\272";
+const char Event_S_0263[] PROGMEM = "n\224\226w \255s\211He\314\272 \331";
+const char Event_S_0264[] PROGMEM = "n\224\226w \255s\211T\220\227\247\221\227\230\251y";
+const char Event_S_0265[] PROGMEM = "n\224\226w \255s\211T\220 bu\254d\252up";
+const char Event_S_0266[] PROGMEM = "\362t\214\247 \377\374n\224\226w \255s\266t\343";
+const char Event_S_0267[] PROGMEM = "\362t\214\247 \377\374n\224\226w \255s\266t\343\364\307\356\327\343";
+const char Event_S_0268[] PROGMEM = "\362t\214\247 \377\374n\224\226w \255s\211Q\340";
+const char Event_S_0269[] PROGMEM = "\362t\214\247 \377\374n\224\226w \255s\364\307\356q\340";
+const char Event_S_026A[] PROGMEM = "\362t\214\247 \377\374n\224\226w \255s\361";
+const char Event_S_026B[] PROGMEM = "\362t\214\247 \377\374n\224\226w \255s\361 \331";
+const char Event_S_026C[] PROGMEM = "\362t\214\247 \377\374n\224\226w \255s\211He\314\272";
+const char Event_S_026D[] PROGMEM = "\362t\214\247 \377\374n\224\226w \255s\211He\314\272 \331";
+const char Event_S_026E[] PROGMEM = "\362t\214\247 \377\374n\224\226w \255s\211T\220\227\247\221\227\230\251y";
+const char Event_S_026F[] PROGMEM = "\362t\214\247 \377\374n\224\226w \255s\211T\220 bu\254d\252up";
+const char Event_S_0270[] PROGMEM = "\242\207\320u\230\200\230m\346\203";
+const char Event_S_0271[] PROGMEM = "\336\363\330\207c\216c\251l\203";
+const char Event_S_0272[] PROGMEM = "\367\232a\315\235\361\2573\264";
+const char Event_S_0273[] PROGMEM = "n\244mot\241\311\200\377hou\245cat\335yt\202 \362v\222t\222s";
+const char Event_S_0274[] PROGMEM = "n\244mot\241\311\200\377\374ev\236-numb\222\232\230gi\327\205\243 plates";
+const char Event_S_0275[] PROGMEM = "n\244mot\241\311\200\377\374odd-numb\222\232\230gi\327\205\243 plates";
+const char Event_S_0276[] PROGMEM = "op\236";
+const char Event_S_0277[] PROGMEM = "\305 c\233\224\203";
+const char Event_S_0278[] PROGMEM = "\321r\231\230op\236\203";
+const char Event_S_0279[] PROGMEM = "\276i\245\230op\236\203";
+const char Event_S_027A[] PROGMEM = "\335\274\370\337\330ew\261\200\230op\236\203";
+const char Event_S_027B[] PROGMEM = "mot\241\302l\207\230\327r\202\243\200\354ft\203";
+const char Event_S_027C[] PROGMEM = "t\220 \230\327r\202\243\200\354ft\203";
+const char Event_S_027D[] PROGMEM = "em\222g\236c\231\242\207\320\203";
+const char Event_S_027E[] PROGMEM = "t\300n\252\242\207\320\203";
+const char Event_S_027F[] PROGMEM = "c\205wl\307\242\207\320\203";
+const char Event_S_0280[] PROGMEM = "s\247 \302l\207\242\207\320\203";
+const char Event_S_0281[] PROGMEM = "\215\207\242\207\320\203";
+const char Event_S_0282[] PROGMEM = "em\222g\236c\231\242\207\367\203";
+const char Event_S_0283[] PROGMEM = "t\300n\252\242\207\367\203";
+const char Event_S_0284[] PROGMEM = "c\205wl\307\242\207\367\203";
+const char Event_S_0285[] PROGMEM = "s\247 \302l\207\242\207\367\203";
+const char Event_S_0286[] PROGMEM = "\215\207\242\207\367\203";
+const char Event_S_0287[] PROGMEM = "\270p\222s\215) \370poo\274\242\207\206 o\250\205\243";
+const char Event_S_0288[] PROGMEM = "\270p\222s\215) \370poo\274\242\207\320\203";
+const char Event_S_0289[] PROGMEM = "\270p\222s\215) \370poo\274\242\207\367\203";
+const char Event_S_028A[] PROGMEM = "\370poo\274\230\327r\202\243\200ch\326\232(t\244\371p\222s\215\200p\307\311)";
+const char Event_S_028B[] PROGMEM = "\240\255\200\320\203\266t\343\2573\264";
+const char Event_S_028C[] PROGMEM = "\240\255\200\320\203\211Q\340\2573\264";
+const char Event_S_028D[] PROGMEM = "\240\255\200\320\203\361\2573\264";
+const char Event_S_028E[] PROGMEM = "\362t\214\247\266t\343\2573\264";
+const char Event_S_028F[] PROGMEM = "\362t\214\247\211Q\340\2573\264";
+const char Event_S_0290[] PROGMEM = "\362t\214\247\361\2573\264";
+const char Event_S_0291[] PROGMEM = "\242\207\367\330e\200c\233\224\203";
+const char Event_S_0292[] PROGMEM = "\362t\214\247 \230m\346\203";
+const char Event_S_0293[] PROGMEM = "\270p\222s\215) \370poo\274\230\327r\202\243\200\354ft\203";
+const char Event_S_0294[] PROGMEM = "\242\207\230\327r\202\243\200\354ft\203";
+const char Event_S_0295[] PROGMEM = "us\207\356h\224d should\307\335\247\203";
+const char Event_S_0296[] PROGMEM = "n\212\372\274\242\207\230gul\306\200\230\327\212\203";
+const char Event_S_0297[] PROGMEM = "\335\274\370\337\330ew\261\200c\233\224\203";
+const char Event_S_0298[] PROGMEM = "\370\337\330ewa\231\320\203";
+const char Event_S_0299[] PROGMEM = "both\347i\230c\243\200\320\203";
+const char Event_S_029A[] PROGMEM = "\206t\222m\253t\236\245sh\212t\201\222m \320u\230s";
+const char Event_S_029F[] PROGMEM = "bu\200\242\207\314a\254\322l\207f\241\370pool\200(\377\374a\245\233as\245\371occup\216t\204";
+const char Event_S_02A0[] PROGMEM = "\336\363\330\207c\216c\251l\203";
+const char Event_S_02A1[] PROGMEM = "\336\363\330\207c\216c\251l\203";
+const char Event_S_02A3[] PROGMEM = "\240s\335t\252\311s";
+const char Event_S_02A4[] PROGMEM = "bu\200\242\207\367\203";
+const char Event_S_02A6[] PROGMEM = "\315\314\231\302l\207\242\207\320\203";
+const char Event_S_02A7[] PROGMEM = "\315\314\231\302l\207\242\207\367\203";
+const char Event_S_02A8[] PROGMEM = "\230op\236\203\227\212\352\226ugh\223";
+const char Event_S_02A9[] PROGMEM = "\240s\350wp\210ughs";
+const char Event_S_02BD[] PROGMEM = "\353\313\305\265s";
+const char Event_S_02BE[] PROGMEM = "\353\313\372j\241\305\265s";
+const char Event_S_02BF[] PROGMEM = "\353\313\372\206t\236\216c\207\265";
+const char Event_S_02C0[] PROGMEM = "\323c\243\200\313\230s\300f\271\252\265";
+const char Event_S_02C1[] PROGMEM = "\353\313c\321\205\274\230\376v\306 \265";
+const char Event_S_02C2[] PROGMEM = "\353\313\305 m\224k\252\265";
+const char Event_S_02C3[] PROGMEM = "br\267g\207\372\206t\236\216c\207\265 (a\245\371br\267ge\204";
+const char Event_S_02C4[] PROGMEM = "\353\275\201empo\205r\272 \354ghts";
+const char Event_S_02C5[] PROGMEM = "\323c\243\200\313bla\327\252\265";
+const char Event_S_02C6[] PROGMEM = "\353\313\305\265s\266t\343";
+const char Event_S_02C7[] PROGMEM = "\353\313\305\265s\266t\343\2571\264";
+const char Event_S_02C8[] PROGMEM = "\353\313\305\265s\266t\343\2572\264";
+const char Event_S_02C9[] PROGMEM = "\353\313\305\265s\266t\343\2574\264";
+const char Event_S_02CA[] PROGMEM = "\353\313\305\265s\266t\343\2576\264";
+const char Event_S_02CB[] PROGMEM = "\353\313\305\265s\266t\343\25710\264";
+const char Event_S_02CC[] PROGMEM = "\353\313\305\265s\364\307\356\327\343";
+const char Event_S_02CD[] PROGMEM = "\353\313\305\265s\211Q\340";
+const char Event_S_02CE[] PROGMEM = "\353\313\305\265s\211Q\340\2571\264";
+const char Event_S_02CF[] PROGMEM = "\353\313\305\265s\211Q\340\2572\264";
+const char Event_S_02D0[] PROGMEM = "\353\313\305\265s\211Q\340\2574\264";
+const char Event_S_02D1[] PROGMEM = "\353\313\305\265s\211Q\340\2576\264";
+const char Event_S_02D2[] PROGMEM = "\353\313\305\265s\211Q\340\25710\264";
+const char Event_S_02D3[] PROGMEM = "\353\313\305\265s\364\307\356q\340";
+const char Event_S_02D4[] PROGMEM = "\353\313\305\265s\361";
+const char Event_S_02D5[] PROGMEM = "\353\313\305\265s\361\2571\264";
+const char Event_S_02D6[] PROGMEM = "\353\313\305\265s\361\2572\264";
+const char Event_S_02D7[] PROGMEM = "\353\313\305\265s\361\2574\264";
+const char Event_S_02D8[] PROGMEM = "\353\313\305\265s\361\2576\264";
+const char Event_S_02D9[] PROGMEM = "\353\313\305\265s\361\25710\264";
+const char Event_S_02DA[] PROGMEM = "\353\313\305\265s\361 \331";
+const char Event_S_02DB[] PROGMEM = "\353\313\305\265s\211He\314\272";
+const char Event_S_02DC[] PROGMEM = "\353\313\305\265s\211He\314\272 \331";
+const char Event_S_02DD[] PROGMEM = "\353\313\305\265s\211T\220\227\247\221\227\230\251y";
+const char Event_S_02DE[] PROGMEM = "\353\313\305\265s\211T\220 bu\254d\252up";
+const char Event_S_02DF[] PROGMEM = "\320\232d\273\304\353\313\305\265s";
+const char Event_S_02E0[] PROGMEM = "\353\313\305\265s\211Righ\245\242\207\320\203";
+const char Event_S_02E1[] PROGMEM = "\353\313\305\265s\211C\321r\207\242\207\320\203";
+const char Event_S_02E2[] PROGMEM = "\353\313\305\265s\211Lef\245\242\207\320\203";
+const char Event_S_02E3[] PROGMEM = "\353\313\305\265s\211H\224d should\307\320\203";
+const char Event_S_02E4[] PROGMEM = "\353\313\305\265s\211Tw\244\255\200\320\203";
+const char Event_S_02E5[] PROGMEM = "\353\313\305\265s\211Th\230\207\255\200\320\203";
+const char Event_S_02E6[] PROGMEM = "\353\313\305\265s\266\221l\207\335t\222nat\207l\206e\223";
+const char Event_S_02E7[] PROGMEM = "\305\265s\211C\224\337\330ewa\231\373\232(f\226m \371\255\204\304\215\207\255";
+const char Event_S_02E8[] PROGMEM = "\305\265s\211C\224\337\330ewa\231\373\232(f\226m \371\255\204\201o\201w\244\255s";
+const char Event_S_02E9[] PROGMEM = "\305\265s\211C\224\337\330ewa\231\373\232(f\226m \371\255\204\201o\352\230\207\255s";
+const char Event_S_02EA[] PROGMEM = "\353\313\305\265s\211C\215t\214\247";
+const char Event_S_02EB[] PROGMEM = "\305\265s\301\317\225";
+const char Event_S_02EC[] PROGMEM = "\305\265s\301\317\240\331";
+const char Event_S_02ED[] PROGMEM = "\305\265s\211L\215g\347\317\225";
+const char Event_S_02EE[] PROGMEM = "\323c\243\200\313\230s\300f\271\252\265\266t\343";
+const char Event_S_02EF[] PROGMEM = "\323c\243\200\313\230s\300f\271\252\265\266t\343\2571\264";
+const char Event_S_02F0[] PROGMEM = "\323c\243\200\313\230s\300f\271\252\265\266t\343\2572\264";
+const char Event_S_02F1[] PROGMEM = "\323c\243\200\313\230s\300f\271\252\265\266t\343\2574\264";
+const char Event_S_02F2[] PROGMEM = "\323c\243\200\313\230s\300f\271\252\265\266t\343\2576\264";
+const char Event_S_02F3[] PROGMEM = "\323c\243\200\313\230s\300f\271\252\265\266t\343\25710\264";
+const char Event_S_02F4[] PROGMEM = "\323c\243\200\313\230s\300f\271\252\265\364\307\356\327\343";
+const char Event_S_02F5[] PROGMEM = "\323c\243\200\313\230s\300f\271\252\265\211Q\340";
+const char Event_S_02F6[] PROGMEM = "\323c\243\200\313\230s\300f\271\252\265\211Q\340\2571\264";
+const char Event_S_02F7[] PROGMEM = "\323c\243\200\313\230s\300f\271\252\265\211Q\340\2572\264";
+const char Event_S_02F8[] PROGMEM = "\323c\243\200\313\230s\300f\271\252\265\211Q\340\2574\264";
+const char Event_S_02F9[] PROGMEM = "\323c\243\200\313\230s\300f\271\252\265\211Q\340\2576\264";
+const char Event_S_02FA[] PROGMEM = "\323c\243\200\313\230s\300f\271\252\265\211Q\340\25710\264";
+const char Event_S_02FB[] PROGMEM = "\323c\243\200\313\230s\300f\271\252\265\364\307\356q\340";
+const char Event_S_02FC[] PROGMEM = "\323c\243\200\313\230s\300f\271\252\265\361";
+const char Event_S_02FD[] PROGMEM = "\323c\243\200\313\230s\300f\271\252\265\361\2571\264";
+const char Event_S_02FE[] PROGMEM = "\323c\243\200\313\230s\300f\271\252\265\361\2572\264";
+const char Event_S_02FF[] PROGMEM = "\323c\243\200\313\230s\300f\271\252\265\361\2574\264";
+const char Event_S_0300[] PROGMEM = "\323c\243\200\313\230s\300f\271\252\265\361\2576\264";
+const char Event_S_0301[] PROGMEM = "\323c\243\200\313\230s\300f\271\252\265\361\25710\264";
+const char Event_S_0302[] PROGMEM = "\323c\243\200\313\230s\300f\271\252\265\361 \331";
+const char Event_S_0303[] PROGMEM = "\323c\243\200\313\230s\300f\271\252\265\211He\314\272";
+const char Event_S_0304[] PROGMEM = "\323c\243\200\313\230s\300f\271\252\265\211He\314\272 \331";
+const char Event_S_0305[] PROGMEM = "\323c\243\200\313\230s\300f\271\252\265\211T\220\227\247\221\227\230\251y";
+const char Event_S_0306[] PROGMEM = "\323c\243\200\313\230s\300f\271\252\265\211T\220 bu\254d\252up";
+const char Event_S_0307[] PROGMEM = "\323c\243\200\313\230s\300f\271\252\265\266\221l\207\335t\222nat\207l\206e\223";
+const char Event_S_0308[] PROGMEM = "\230s\300f\271\252\265\211C\224\337\330ewa\231\373\232(f\226m \371\255\204\304\215\207\255";
+const char Event_S_0309[] PROGMEM = "\230s\300f\271\252\265\211C\224\337\330ewa\231\373\232(f\226m \371\255\204\201o\201w\244\255s";
+const char Event_S_030A[] PROGMEM = "\230s\300f\271\252\265\211C\224\337\330ewa\231\373\232(f\226m \371\255\204\201o\352\230\207\255s";
+const char Event_S_030B[] PROGMEM = "\323c\243\200\313\230s\300f\271\252\265\211C\215t\214\247";
+const char Event_S_030C[] PROGMEM = "\230s\300f\271\252\265\301\317\225";
+const char Event_S_030D[] PROGMEM = "\230s\300f\271\252\265\301\317\240\331";
+const char Event_S_030E[] PROGMEM = "\230s\300f\271\252\265\211L\215g\347\317\225";
+const char Event_S_030F[] PROGMEM = "\353\313\305 m\224k\252\265\266t\343";
+const char Event_S_0310[] PROGMEM = "\353\313\305 m\224k\252\265\364\307\356\327\343";
+const char Event_S_0311[] PROGMEM = "\353\313\305 m\224k\252\265\211Q\340";
+const char Event_S_0312[] PROGMEM = "\353\313\305 m\224k\252\265\364\307\356q\340";
+const char Event_S_0313[] PROGMEM = "\353\313\305 m\224k\252\265\361";
+const char Event_S_0314[] PROGMEM = "\353\313\305 m\224k\252\265\361 \331";
+const char Event_S_0315[] PROGMEM = "\353\313\305 m\224k\252\265\211He\314\272";
+const char Event_S_0316[] PROGMEM = "\353\313\305 m\224k\252\265\211He\314\272 \331";
+const char Event_S_0317[] PROGMEM = "\353\313\305 m\224k\252\265\211T\220\227\247\221\227\230\251y";
+const char Event_S_0318[] PROGMEM = "\353\313\305 m\224k\252\265\211T\220 bu\254d\252up";
+const char Event_S_0319[] PROGMEM = "\353\313\305 m\224k\252\265\211Righ\245\242\207\320\203";
+const char Event_S_031A[] PROGMEM = "\353\313\305 m\224k\252\265\211C\321r\207\242\207\320\203";
+const char Event_S_031B[] PROGMEM = "\353\313\305 m\224k\252\265\211Lef\245\242\207\320\203";
+const char Event_S_031C[] PROGMEM = "\353\313\305 m\224k\252\265\211H\224d should\307\320\203";
+const char Event_S_031D[] PROGMEM = "\353\313\305 m\224k\252\265\211Tw\244\255\200\320\203";
+const char Event_S_031E[] PROGMEM = "\353\313\305 m\224k\252\265\211Th\230\207\255\200\320\203";
+const char Event_S_031F[] PROGMEM = "\320\203\257br\267g\207demo\354\243 \265 (a\245\371br\267ge\204";
+const char Event_S_0320[] PROGMEM = "\305\265\200c\233\224\203";
+const char Event_S_0321[] PROGMEM = "\336\363\330\207c\216c\251l\203";
+const char Event_S_0322[] PROGMEM = "\353\313\210ng-t\222m \305\265s";
+const char Event_S_0323[] PROGMEM = "\353\313\362\327r\360\243 \265";
+const char Event_S_0324[] PROGMEM = "\353\313s\247 m\346\252\372\206t\236\216c\207\311s";
+const char Event_S_0325[] PROGMEM = "br\267g\207demo\354\243 \265 (a\245\371br\267ge\204";
+const char Event_S_0326[] PROGMEM = "\353\313wat\307\372\206 \265";
+const char Event_S_0327[] PROGMEM = "\353\313ga\200\372\206 \265";
+const char Event_S_0328[] PROGMEM = "\353\313\265 \215 b\300i\232c\322\233s";
+const char Event_S_0329[] PROGMEM = "\353\313\265 \215 b\300i\232\376v\202es";
+const char Event_S_032A[] PROGMEM = "new \305\265\200l\261out";
+const char Event_S_032B[] PROGMEM = "new \305 l\261out";
+const char Event_S_032C[] PROGMEM = "\353\313\305\265s\266t\343\2573\264";
+const char Event_S_032D[] PROGMEM = "\353\313\305\265s\211Q\340\2573\264";
+const char Event_S_032E[] PROGMEM = "\353\313\305\265s\361\2573\264";
+const char Event_S_032F[] PROGMEM = "\353\313\305\265\200d\300\221\352\207d\261\201i\336";
+const char Event_S_0330[] PROGMEM = "\353\313\305\265\200d\300\252\237f-\250ak p\222iods";
+const char Event_S_0331[] PROGMEM = "\353\313\305\265\200d\300\221\352\207night";
+const char Event_S_0332[] PROGMEM = "\323c\243\200\313\230s\300f\271\252\265\266t\343\2573\264";
+const char Event_S_0333[] PROGMEM = "\323c\243\200\313\230s\300f\271\252\265\211Q\340\2573\264";
+const char Event_S_0334[] PROGMEM = "\323c\243\200\313\230s\300f\271\252\265\361\2573\264";
+const char Event_S_0335[] PROGMEM = "\353\313\230s\300f\271\252\265\347\300\221\352\207d\261\201i\336";
+const char Event_S_0336[] PROGMEM = "\353\313\230s\300f\271\252\265\347\300\252\237f-\250ak p\222iods";
+const char Event_S_0337[] PROGMEM = "\353\313\230s\300f\271\252\265\347\300\221\352\207night";
+const char Event_S_0338[] PROGMEM = "\353\313\305 m\224k\252\265\364\222";
+const char Event_S_0339[] PROGMEM = "\353\313s\247 m\346\252\372\206t\236\216c\207\311s\266t\343";
+const char Event_S_033A[] PROGMEM = "\353\313s\247 m\346\252\372\206t\236\216c\207\311s\364\307\356\327\343";
+const char Event_S_033B[] PROGMEM = "\353\313s\247 m\346\252\372\206t\236\216c\207\311s\211Q\340";
+const char Event_S_033C[] PROGMEM = "\353\313s\247 m\346\252\372\206t\236\216c\207\311s\364\307\356q\340";
+const char Event_S_033D[] PROGMEM = "\353\313s\247 m\346\252\372\206t\236\216c\207\311s\361";
+const char Event_S_033E[] PROGMEM = "\353\313s\247 m\346\252\372\206t\236\216c\207\311s\361 \331";
+const char Event_S_033F[] PROGMEM = "\353\313s\247 m\346\252\372\206t\236\216c\207\311s\211He\314\272";
+const char Event_S_0340[] PROGMEM = "\353\313s\247 m\346\252\372\206t\236\216c\207\311s\211He\314\272 \331";
+const char Event_S_0341[] PROGMEM = "\353\313s\247 m\346\252\372\206t\236\216c\207\311s\211T\220\227\247\221\227\230\251y";
+const char Event_S_0342[] PROGMEM = "\353\313s\247 m\346\252\372\206t\236\216c\207\311s\211T\220 bu\254d\252up";
+const char Event_S_0343[] PROGMEM = "\353\313s\247 m\346\252\372\206t\236\216c\207\311s\211Righ\245\242\207\320\203";
+const char Event_S_0344[] PROGMEM = "\353\313s\247 m\346\252\372\206t\236\216c\207\311s\211C\321r\207\242\207\320\203";
+const char Event_S_0345[] PROGMEM = "\353\313s\247 m\346\252\372\206t\236\216c\207\311s\211Lef\245\242\207\320\203";
+const char Event_S_0346[] PROGMEM = "\353\313s\247 m\346\252\372\206t\236\216c\207\311s\211Tw\244\255\200\320\203";
+const char Event_S_0347[] PROGMEM = "\353\313s\247 m\346\252\372\206t\236\216c\207\311s\211Th\230\207\255\200\320\203";
+const char Event_S_0348[] PROGMEM = "wat\307\372\206 \265\301\317\225";
+const char Event_S_0349[] PROGMEM = "wat\307\372\206 \265\301\317\240\331";
+const char Event_S_034A[] PROGMEM = "wat\307\372\206 \265\211L\215g\347\317\225";
+const char Event_S_034B[] PROGMEM = "ga\200\372\206 \265\301\317\225";
+const char Event_S_034C[] PROGMEM = "ga\200\372\206 \265\301\317\240\331";
+const char Event_S_034D[] PROGMEM = "ga\200\372\206 \265\211L\215g\347\317\225";
+const char Event_S_034E[] PROGMEM = "\265 \215 b\300i\232c\322\233s\301\317\225";
+const char Event_S_034F[] PROGMEM = "\265 \215 b\300i\232c\322\233s\301\317\240\331";
+const char Event_S_0350[] PROGMEM = "\265 \215 b\300i\232c\322\233s\211L\215g\347\317\225";
+const char Event_S_0351[] PROGMEM = "\265 \215 b\300i\232\376v\202es\301\317\225";
+const char Event_S_0352[] PROGMEM = "\265 \215 b\300i\232\376v\202es\301\317\240\331";
+const char Event_S_0353[] PROGMEM = "\265 \215 b\300i\232\376v\202es\211L\215g\347\317\225";
+const char Event_S_0354[] PROGMEM = "\362\327r\360\243\223 m\222g\221";
+const char Event_S_0355[] PROGMEM = "\305\265 c\233a\205nc\207\206 p\226g\230\363";
+const char Event_S_0356[] PROGMEM = "\372\206t\236\216c\207\265 c\233\224\203";
+const char Event_S_0357[] PROGMEM = "\305 l\261ou\245\341ch\326\203";
+const char Event_S_0358[] PROGMEM = "\362\327r\360\243\223 m\222g\221\364\222";
+const char Event_S_0359[] PROGMEM = "\240\341p\226te\303\232\357\236\245\224ea\256";
+const char Event_S_035A[] PROGMEM = "d\326\307\237\240\341p\226te\303\232\357\236\245\224ea\256";
+const char Event_S_035B[] PROGMEM = "\240\341\354\245\311\256 \215\352\207\305";
+const char Event_S_035C[] PROGMEM = "d\326\307\356\240\341\354\245\311\256 \215\352\207\305";
+const char Event_S_035D[] PROGMEM = "s\350w \216d \202\207deb\337s";
+const char Event_S_035E[] PROGMEM = "d\326\307\356s\350w \216d \202\207deb\337s";
+const char Event_S_0381[] PROGMEM = "\250op\233\352\226w\252obje\303\200\215to\352\207\305\364\222";
+const char Event_S_0382[] PROGMEM = "ob\327r\360\243 w\224n\252\377hd\205wn";
+const char Event_S_0383[] PROGMEM = "c\233a\205nc\207\265 \206 p\226g\230\363, \305\227\230\207\330a\206";
+const char Event_S_0384[] PROGMEM = "f\210od\252\331";
+const char Event_S_0385[] PROGMEM = "\240ob\327r\360\243\256 \215 \305w\261";
+const char Event_S_0386[] PROGMEM = "\240ob\327r\360\243\200\215\352\207\305\364\222";
+const char Event_S_0387[] PROGMEM = "sp\254l\330\207\215\352\207\305";
+const char Event_S_0388[] PROGMEM = "\327\212m\347am\330e";
+const char Event_S_0389[] PROGMEM = "\225\227\335\233n\201\230es";
+const char Event_S_038A[] PROGMEM = "\225\227\335\233n\201\230es\364\222";
+const char Event_S_038B[] PROGMEM = "f\210od\221";
+const char Event_S_038C[] PROGMEM = "f\210od\221\364\222";
+const char Event_S_038D[] PROGMEM = "flash\227\210ods";
+const char Event_S_038E[] PROGMEM = "d\326\307\237\227lash\227\210ods";
+const char Event_S_038F[] PROGMEM = "\314a\242c\315s";
+const char Event_S_0390[] PROGMEM = "\314a\242ch\207\337sk";
+const char Event_S_0391[] PROGMEM = "\226\351f\335ls";
+const char Event_S_0392[] PROGMEM = "\242ds\354ps";
+const char Event_S_0393[] PROGMEM = "e\224thquak\207dam\330e";
+const char Event_S_0394[] PROGMEM = "\305 s\300f\271\207\206 po\241\362di\243";
+const char Event_S_0395[] PROGMEM = "subs\267\236ce";
+const char Event_S_0396[] PROGMEM = "\240collaps\232\260w\222\256";
+const char Event_S_0397[] PROGMEM = "b\300s\245wat\307\372\206";
+const char Event_S_0398[] PROGMEM = "ga\200\233ak";
+const char Event_S_0399[] PROGMEM = "\376iou\200fi\230";
+const char Event_S_039A[] PROGMEM = "\216im\335\200\215 \305w\261";
+const char Event_S_039B[] PROGMEM = "\216im\335\200\215\352\207\305\364\222";
+const char Event_S_039C[] PROGMEM = "c\233a\205nc\207\265";
+const char Event_S_039D[] PROGMEM = "\367\232b\231\327\212m\347am\330e";
+const char Event_S_039E[] PROGMEM = "\367\232b\231\225\227\335\233n\201\230es";
+const char Event_S_039F[] PROGMEM = "\225\227\335\233n\201\230e\256\211Pa\363\322l\207\377\374\370e";
+const char Event_S_03A0[] PROGMEM = "f\210od\221\266t\343";
+const char Event_S_03A1[] PROGMEM = "f\210od\221\364\307\356\327\343";
+const char Event_S_03A2[] PROGMEM = "f\210od\221\211Q\340";
+const char Event_S_03A3[] PROGMEM = "f\210od\221\364\307\356q\340";
+const char Event_S_03A4[] PROGMEM = "f\210od\221\361";
+const char Event_S_03A5[] PROGMEM = "f\210od\221\361 \331";
+const char Event_S_03A6[] PROGMEM = "f\210od\221\211He\314\272";
+const char Event_S_03A7[] PROGMEM = "f\210od\221\211He\314\272 \331";
+const char Event_S_03A8[] PROGMEM = "f\210od\221\211T\220\227\247\221\227\230\251y";
+const char Event_S_03A9[] PROGMEM = "f\210od\221\211T\220 bu\254d\252up";
+const char Event_S_03AA[] PROGMEM = "\320\232d\273\201o\227\210od\221";
+const char Event_S_03AB[] PROGMEM = "f\210od\221\301\317\225";
+const char Event_S_03AC[] PROGMEM = "f\210od\221\301\317\240\331";
+const char Event_S_03AD[] PROGMEM = "f\210od\221\211L\215g\347\317\225";
+const char Event_S_03AE[] PROGMEM = "f\210od\221\211Pa\363\322l\207\377\374\370e";
+const char Event_S_03AF[] PROGMEM = "\320\232d\273\304\314a\242c\315s";
+const char Event_S_03B0[] PROGMEM = "\314a\242c\315s\211Pa\363\322l\207\377\374\370\207(\322\346\207\371h\341dr\232\336t\230\204";
+const char Event_S_03B1[] PROGMEM = "\320\232d\273\304\226\351f\335ls";
+const char Event_S_03B2[] PROGMEM = "\226\351f\335ls\211Pa\363\322l\207\377\374\370e";
+const char Event_S_03B3[] PROGMEM = "\305 \320\232d\273\304\242ds\354ps";
+const char Event_S_03B4[] PROGMEM = "\242ds\354ps\211Pa\363\322l\207\377\374\370e";
+const char Event_S_03B5[] PROGMEM = "\320\232d\273\304subs\267\236ce";
+const char Event_S_03B6[] PROGMEM = "subs\267\236ce\266\221l\207\335t\222nat\207l\206e\223";
+const char Event_S_03B7[] PROGMEM = "subs\267\236ce\211C\224\337\330ewa\231\373\232(f\226m \371\255\204\304\215\207\255";
+const char Event_S_03B8[] PROGMEM = "subs\267\236ce\211C\224\337\330ewa\231\373\232(f\226m \371\255\204\201o\201w\244\255s";
+const char Event_S_03B9[] PROGMEM = "subs\267\236ce\211C\224\337\330ewa\231\373\232(f\226m \371\255\204\201o\352\230\207\255s";
+const char Event_S_03BA[] PROGMEM = "subs\267\236ce\211C\215t\214\247 \206 o\250\205\243";
+const char Event_S_03BB[] PROGMEM = "subs\267\236ce\211Pa\363\322l\207\377\374\370e";
+const char Event_S_03BC[] PROGMEM = "\320\232d\273\304\260w\307collap\260";
+const char Event_S_03BD[] PROGMEM = "\305 \320\232d\273\304b\300s\245wat\307\372\206";
+const char Event_S_03BE[] PROGMEM = "b\300s\245wat\307\372\206\301\317\225";
+const char Event_S_03BF[] PROGMEM = "b\300s\245wat\307\372\206\301\317\240\331";
+const char Event_S_03C0[] PROGMEM = "b\300s\245wat\307\372\206\211L\215g\347\317\225";
+const char Event_S_03C1[] PROGMEM = "\320\232d\273\304ga\200\233ak";
+const char Event_S_03C2[] PROGMEM = "ga\200\233ak\301\317\225";
+const char Event_S_03C3[] PROGMEM = "ga\200\233ak\301\317\240\331";
+const char Event_S_03C4[] PROGMEM = "ga\200\233ak\211L\215g\347\317\225";
+const char Event_S_03C5[] PROGMEM = "\320\232d\273\304\376iou\200fi\230";
+const char Event_S_03C6[] PROGMEM = "\376iou\200fi\230\301\317\225";
+const char Event_S_03C7[] PROGMEM = "\376iou\200fi\230\301\317\240\331";
+const char Event_S_03C8[] PROGMEM = "\376iou\200fi\230\211L\215g\347\317\225";
+const char Event_S_03C9[] PROGMEM = "\320\203\257c\233a\205nc\207\265";
+const char Event_S_03CA[] PROGMEM = "\305\227\230\207\330a\206";
+const char Event_S_03CB[] PROGMEM = "\336\363\330\207c\216c\251l\203";
+const char Event_S_03CC[] PROGMEM = "\327\212m\347am\330\207\331";
+const char Event_S_03CD[] PROGMEM = "f\335\233n pow\307c\322\233s";
+const char Event_S_03CE[] PROGMEM = "\260w\307\346\222f\247";
+const char Event_S_03CF[] PROGMEM = "\202\207bu\254d-up";
+const char Event_S_03D0[] PROGMEM = "mud sl\267e";
+const char Event_S_03D1[] PROGMEM = "g\205s\200fi\230";
+const char Event_S_03D2[] PROGMEM = "air c\205sh";
+const char Event_S_03D3[] PROGMEM = "\205\254 c\205sh";
+const char Event_S_03D4[] PROGMEM = "\367\232b\231\240ob\327r\360\243\256 \215\352\207\305";
+const char Event_S_03D5[] PROGMEM = "\240ob\327r\360\243\200\215\352\207\305\211Pa\363\322l\207\377\374\370e";
+const char Event_S_03D6[] PROGMEM = "\367\232d\273\304sp\254l\330\207\215 \305w\261";
+const char Event_S_03D7[] PROGMEM = "sp\254l\330\207\215\352\207\305\211Pa\363\322l\207\377\374\370e";
+const char Event_S_03D8[] PROGMEM = "sp\254l\330\207\215\352\207\305\364\222";
+const char Event_S_03D9[] PROGMEM = "\327\212m\347am\330e\211Pa\363\322l\207\377\374\370e";
+const char Event_S_03DA[] PROGMEM = "\327\212m\347am\330e\364\222";
+const char Event_S_03DB[] PROGMEM = "\367\232by\227\335\233n pow\307c\322\233s";
+const char Event_S_03DC[] PROGMEM = "f\335\233n pow\307c\322\233s\211Pa\363\322l\207\377\374\370e";
+const char Event_S_03DD[] PROGMEM = "f\335\233n pow\307c\322\233s\364\222";
+const char Event_S_03DE[] PROGMEM = "\260w\307\346\222f\247\364\222";
+const char Event_S_03DF[] PROGMEM = "flash\227\210ods\364\222";
+const char Event_S_03E0[] PROGMEM = "\314a\242c\315s\364\222";
+const char Event_S_03E1[] PROGMEM = "\320\232d\273\304\314a\242ch\207\337sk";
+const char Event_S_03E2[] PROGMEM = "\314a\242ch\207\337sk\364\222";
+const char Event_S_03E3[] PROGMEM = "\320\232d\273\304\202\207bu\254d-up";
+const char Event_S_03E4[] PROGMEM = "\202\207bu\254d-up\211Pa\363\322l\207\377\374\370\207(\322\346\207\371h\341dr\232\336t\230\204";
+const char Event_S_03E5[] PROGMEM = "\202\207bu\254d-up\266\221l\207\335t\222nate\223";
+const char Event_S_03E6[] PROGMEM = "\226\351f\335ls\364\222";
+const char Event_S_03E7[] PROGMEM = "\242ds\354ps\364\222";
+const char Event_S_03E8[] PROGMEM = "e\224thquak\207dam\330e\364\222";
+const char Event_S_03E9[] PROGMEM = "haz\224dou\200d\337v\252\362di\243\200(\322\346\207\371h\341dr\232\336t\230\204";
+const char Event_S_03EA[] PROGMEM = "d\326\307\356aquap\242\221";
+const char Event_S_03EB[] PROGMEM = "s\354pp\222\231\305 (\322\346\207\371h\341dr\232\336t\230\204";
+const char Event_S_03EC[] PROGMEM = "mud \215 \305";
+const char Event_S_03ED[] PROGMEM = "\233a\246\200\215 \305";
+const char Event_S_03EE[] PROGMEM = "\202\207(\322\346\207\371h\341dr\232\336t\230\204";
+const char Event_S_03EF[] PROGMEM = "d\326\307\356\202\207(\322\346\207\371h\341dr\232\336t\230\204";
+const char Event_S_03F0[] PROGMEM = "bl\271k \202\207(\322\346\207\371h\341dr\232\336t\230\204";
+const char Event_S_03F1[] PROGMEM = "f\230ez\252\205\206 (\322\346\207\371h\341dr\232\336t\230\204";
+const char Event_S_03F2[] PROGMEM = "we\245\216d \202\231\305\200(\322\346\207\371h\341dr\232\336t\230\204";
+const char Event_S_03F3[] PROGMEM = "slus\374(\322\346\207\371h\341dr\232\336t\230\204";
+const char Event_S_03F4[] PROGMEM = "s\350w \215\352\207\305 (\322\346\207\371h\341dr\232\336t\230\204";
+const char Event_S_03F5[] PROGMEM = "p\271k\232s\350w (\322\346\207\371h\341dr\232\336t\230\204";
+const char Event_S_03F6[] PROGMEM = "f\230s\374s\350w (\322\346\207\371h\341dr\232\336t\230\204";
+const char Event_S_03F7[] PROGMEM = "deep s\350w (\322\346\207\371h\341dr\232\336t\230\204";
+const char Event_S_03F8[] PROGMEM = "s\350w\347\337f\310(\322\346\207\371h\341dr\232\336t\230\204";
+const char Event_S_03F9[] PROGMEM = "s\354pp\222\231d\273\304sp\254l\330\207\215 \305w\261";
+const char Event_S_03FA[] PROGMEM = "s\354pp\222\231\305 (\322\346\207\371h\341dr\232\336t\230\204\347\273\304s\350w";
+const char Event_S_03FB[] PROGMEM = "s\354pp\222\231\305 (\322\346\207\371h\341dr\232\336t\230\204\347\273\201o\227\226\327";
+const char Event_S_03FC[] PROGMEM = "\305 \367\232b\231s\350w (\322\346\207\371h\341dr\232\336t\230\204";
+const char Event_S_03FD[] PROGMEM = "s\350w \215\352\207\305\211C\224\337\330ewa\231\373\232(f\226m \371\255\204\304\215\207\255";
+const char Event_S_03FE[] PROGMEM = "s\350w \215\352\207\305\211C\224\337\330ewa\231\373\232(f\226m \371\255\204\201o\201w\244\255s";
+const char Event_S_03FF[] PROGMEM = "s\350w \215\352\207\305\211C\224\337\330ewa\231\373\232(f\226m \371\255\204\201o\352\230\207\255s";
+const char Event_S_0400[] PROGMEM = "\362di\243\200\356\305 s\300f\271\207imp\226v\203";
+const char Event_S_0401[] PROGMEM = "\336\363\330\207c\216c\251l\203";
+const char Event_S_0402[] PROGMEM = "subs\267\236ce\364\222";
+const char Event_S_0403[] PROGMEM = "\260w\307collap\260\301\317\225";
+const char Event_S_0404[] PROGMEM = "\260w\307collap\260\301\317\240\331";
+const char Event_S_0405[] PROGMEM = "\260w\307collap\260\211L\215g\347\317\225";
+const char Event_S_0406[] PROGMEM = "\260w\307collap\260\364\222";
+const char Event_S_0407[] PROGMEM = "b\300s\245wat\307\372\206\364\222";
+const char Event_S_0408[] PROGMEM = "ga\200\233ak\364\222";
+const char Event_S_0409[] PROGMEM = "\376iou\200fi\230\364\222";
+const char Event_S_040A[] PROGMEM = "c\233a\205nc\207\265\364\222";
+const char Event_S_040B[] PROGMEM = "impa\363\322l\207(\322\346\207\371h\341dr\232\336t\230\204";
+const char Event_S_040C[] PROGMEM = "\335mos\245impa\363\322l\207(\322\346\207\371h\341dr\232\336t\230\204";
+const char Event_S_040D[] PROGMEM = "\276t\230m\251\231haz\224dou\200d\337v\252\362di\243\200(\322\346\207\371h\341dr\232\336t\230\204";
+const char Event_S_040E[] PROGMEM = "dif\217ul\245d\337v\252\362di\243\200(\322\346\207\371h\341dr\232\336t\230\204";
+const char Event_S_040F[] PROGMEM = "pa\363\322l\207\377\374\370\207(up\304\371h\341dr\232\336t\230\204";
+const char Event_S_0410[] PROGMEM = "pa\363\322l\207(up\304\371h\341dr\232\336t\230\204";
+const char Event_S_0411[] PROGMEM = "s\300f\271\207wat\307haz\224d";
+const char Event_S_0412[] PROGMEM = "\210os\207s\216d \215 \305";
+const char Event_S_0413[] PROGMEM = "\210os\207chipp\221s";
+const char Event_S_0414[] PROGMEM = "o\254 \215 \305";
+const char Event_S_0415[] PROGMEM = "\250t\226\274\215 \305";
+const char Event_S_0416[] PROGMEM = "\202\207\325\232(\322\346\207\371h\341dr\232\336t\230\204";
+const char Event_S_0417[] PROGMEM = "\202\231patc\315\200(\322\346\207\371h\341dr\232\336t\230\204";
+const char Event_S_0418[] PROGMEM = "d\326\307\356\202\231patc\315\200(\322\346\207\371h\341dr\232\336t\230\204";
+const char Event_S_0419[] PROGMEM = "\202\231patc\315\200\325\232(\322\346\207\371h\341dr\232\336t\230\204";
+const char Event_S_041A[] PROGMEM = "d\326\307\356bl\271k \202\207(\322\346\207\371h\341dr\232\336t\230\204";
+const char Event_S_041B[] PROGMEM = "bl\271k \202\207\325\232(\322\346\207\371h\341dr\232\336t\230\204";
+const char Event_S_041C[] PROGMEM = "f\230ez\252\205\206 \325\232(\322\346\207\371h\341dr\232\336t\230\204";
+const char Event_S_041D[] PROGMEM = "s\350w\347\337f\310\325\232(\322\346\207\371h\341dr\232\336t\230\204";
+const char Event_S_041E[] PROGMEM = "s\354pp\222\231d\273\304\210os\207s\216d \215 \305w\261";
+const char Event_S_041F[] PROGMEM = "mud \215 \305\364\222";
+const char Event_S_0420[] PROGMEM = "\210os\207chipp\221s\364\222";
+const char Event_S_0421[] PROGMEM = "o\254 \215 \305\364\222";
+const char Event_S_0422[] PROGMEM = "\250t\226\274\215 \305\364\222";
+const char Event_S_0423[] PROGMEM = "\305 s\300f\271\207\206 po\241\362di\243\364\222";
+const char Event_S_0424[] PROGMEM = "\202\231patc\315\200(\322\346\207\371h\341dr\232\336t\230\204 \215 br\267ges";
+const char Event_S_0425[] PROGMEM = "d\326\307\356\202\231patc\315\200(\322\346\207\371h\341dr\232\336t\230\204 \215 br\267ges";
+const char Event_S_0426[] PROGMEM = "\202\231patc\315\200(\322\346\207\371h\341dr\232\336t\230\204 \215 br\267ges, \206 sh\235\232\224ea\200\216d \215 s\354p \305s";
+const char Event_S_0427[] PROGMEM = "impa\363\322l\207f\241\315\314\231\311\200(\346\307\334";
+const char Event_S_0428[] PROGMEM = "impa\363\322l\207(\322\346\207\371h\341dr\232\336t\230\204\257\311\200\377h\201\205\254\222s";
+const char Event_S_0429[] PROGMEM = "d\337v\252\362di\243\200imp\226v\203";
+const char Event_S_042A[] PROGMEM = "\230scu\207\216d \230c\346\222\231\265 \206 p\226g\230\363\364\222";
+const char Event_S_042B[] PROGMEM = "l\224g\207\216im\335\200\215 \305w\261";
+const char Event_S_042C[] PROGMEM = "h\222d\200\356\216im\335\200\215 \305w\261";
+const char Event_S_042D[] PROGMEM = "sk\267 haz\224d \373\203";
+const char Event_S_042E[] PROGMEM = "s\350w c\233\224\203";
+const char Event_S_042F[] PROGMEM = "\305 \362di\243\200f\212ecas\245\377hd\205wn";
+const char Event_S_0430[] PROGMEM = "\336\363\330\207c\216c\251l\203";
+const char Event_S_0431[] PROGMEM = "\276t\230m\251\231haz\224dou\200d\337v\252\362di\243\200\325\232(\322\346\207\371h\341dr\232\336t\222\204";
+const char Event_S_0432[] PROGMEM = "f\230ez\252\205\206 \325\232(\322\346\207\371h\341dr\232\336t\230\204";
+const char Event_S_0433[] PROGMEM = "d\326\307\356\305 be\252\367\232b\231s\350w (\322\346\207\371h\341dr\232\336t\230\204";
+const char Event_S_0437[] PROGMEM = "tem\250\205t\300\207f\335l\252\205p\267l\231(t\244\334";
+const char Event_S_0438[] PROGMEM = "\276t\230m\207\315a\245(up\304\334";
+const char Event_S_0439[] PROGMEM = "\276t\230m\207cold (\356\334";
+const char Event_S_043A[] PROGMEM = "\233s\200\276t\230\336\201em\250\205tu\230s";
+const char Event_S_043B[] PROGMEM = "c\300\230nt\201em\250\205t\300\207\225";
+const char Event_S_043C[] PROGMEM = "hous\207fi\230";
+const char Event_S_043D[] PROGMEM = "f\212e\327\227i\230";
+const char Event_S_043E[] PROGMEM = "\302l\207\327u\351 \341d\307br\267ge";
+const char Event_S_0442[] PROGMEM = "volc\216\244\222up\243 w\224n\221";
+const char Event_S_044D[] PROGMEM = "\315\314\231s\350wf\335\274\225";
+const char Event_S_044E[] PROGMEM = "\315\314\231s\350wf\335\274\225\211Visib\254\355\373\203\304<30 m";
+const char Event_S_044F[] PROGMEM = "\315\314\231s\350wf\335\274\225\211Visib\254\355\373\203\304<50 m";
+const char Event_S_0450[] PROGMEM = "s\350wf\335\274\225";
+const char Event_S_0451[] PROGMEM = "s\350wf\335\274\225\211Visib\254\355\373\203\304<100 m";
+const char Event_S_0452[] PROGMEM = "ha\254 (visib\254\355\373\203\304\334";
+const char Event_S_0453[] PROGMEM = "s\233e\245(visib\254\355\373\203\304\334";
+const char Event_S_0454[] PROGMEM = "th\341d\222\327\212m\200(visib\254\355\373\203\304\334";
+const char Event_S_0455[] PROGMEM = "\315\314\231\205\206 \225";
+const char Event_S_0456[] PROGMEM = "\315\314\231\205\206 \225\211Visib\254\355\373\203\304<30 m";
+const char Event_S_0457[] PROGMEM = "\315\314\231\205\206 \225\211Visib\254\355\373\203\304<50 m";
+const char Event_S_0458[] PROGMEM = "\205\206 \225";
+const char Event_S_0459[] PROGMEM = "\205\206 \225\211Visib\254\355\373\203\304<100 m";
+const char Event_S_045A[] PROGMEM = "show\222\200(visib\254\355\373\203\304\334";
+const char Event_S_045B[] PROGMEM = "\315\314y\227\226\327";
+const char Event_S_045C[] PROGMEM = "f\226\327";
+const char Event_S_045D[] PROGMEM = "\270p\226b\322\254\355\313\346\222cas\245weath\222";
+const char Event_S_045E[] PROGMEM = "\270p\226b\322\254\355\313mo\327l\231\316udy";
+const char Event_S_045F[] PROGMEM = "\270p\226b\322\254\355\313p\224tl\231\316udy";
+const char Event_S_0460[] PROGMEM = "\270p\226b\322\254\355\313s\341n\231p\222iods";
+const char Event_S_0461[] PROGMEM = "\270p\226b\322\254\355\313c\233\224 weath\222";
+const char Event_S_0462[] PROGMEM = "\270p\226b\322\254\355\313s\341n\231weath\222";
+const char Event_S_0463[] PROGMEM = "\270p\226b\322\254\355\313mo\327l\231dr\231weath\222";
+const char Event_S_0464[] PROGMEM = "\270p\226b\322\254\355\313dr\231weath\222";
+const char Event_S_0465[] PROGMEM = "s\341n\231p\222iod\200\216d \377\374\270p\226b\322\254\355\313show\222s";
+const char Event_S_0466[] PROGMEM = "weath\307s\253u\306 imp\226v\203";
+const char Event_S_0467[] PROGMEM = "\336\363\330\207c\216c\251l\203";
+const char Event_S_0468[] PROGMEM = "w\206t\307\327\212m (visib\254\355\373\203\304\334";
+const char Event_S_0469[] PROGMEM = "\270p\226b\322\254\355\313w\206t\307\327\212m";
+const char Event_S_046A[] PROGMEM = "b\354zz\224d (visib\254\355\373\203\304\334";
+const char Event_S_046B[] PROGMEM = "\270p\226b\322\254\355\313b\354zz\224d";
+const char Event_S_046C[] PROGMEM = "dam\330\252ha\254 (visib\254\355\373\203\304\334";
+const char Event_S_046D[] PROGMEM = "\270p\226b\322\254\355\313dam\330\252ha\254";
+const char Event_S_046E[] PROGMEM = "\315\314\231s\350wf\335l\211Visib\254\355\373\232(t\244\334";
+const char Event_S_046F[] PROGMEM = "s\350wf\335l\211Visib\254\355\373\232(t\244\334";
+const char Event_S_0470[] PROGMEM = "\315\314\231\205\206\211Visib\254\355\373\232(t\244\334";
+const char Event_S_0471[] PROGMEM = "\205\206\211Visib\254\355\373\232(t\244\334";
+const char Event_S_0472[] PROGMEM = "\260v\222\207weath\307w\224n\221\200c\216c\251l\203";
+const char Event_S_0473[] PROGMEM = "\336\363\330\207c\216c\251l\203";
+const char Event_S_0474[] PROGMEM = "weath\222\227\212ecas\245\377hd\205wn";
+const char Event_S_0475[] PROGMEM = "fog\227\212ecas\245\377hd\205wn";
+const char Event_S_0477[] PROGMEM = "s\354pp\222\231\305 \325\232(\322\346\207\371h\341dr\232\336t\230\204";
+const char Event_S_047F[] PROGMEM = "\270p\226b\322\254\355\313\315\314\231s\350wf\335l";
+const char Event_S_0480[] PROGMEM = "\270p\226b\322\254\355\313s\350wf\335l";
+const char Event_S_0481[] PROGMEM = "\270p\226b\322\254\355\313ha\254";
+const char Event_S_0482[] PROGMEM = "\270p\226b\322\254\355\313s\233et";
+const char Event_S_0483[] PROGMEM = "\270p\226b\322\254\355\275\352\341d\222\327\212ms";
+const char Event_S_0484[] PROGMEM = "\270p\226b\322\254\355\313\315\314\231\205\206";
+const char Event_S_0485[] PROGMEM = "\270p\226b\322\254\355\313\205\206";
+const char Event_S_0486[] PROGMEM = "\270p\226b\322\254\355\313show\222s";
+const char Event_S_0487[] PROGMEM = "\270p\226b\322\254\355\313\315\314y\227\226\327";
+const char Event_S_0488[] PROGMEM = "\270p\226b\322\254\355\275\227\226\327";
+const char Event_S_048D[] PROGMEM = "\205\206 ch\326\221\304s\350w";
+const char Event_S_048E[] PROGMEM = "s\350w ch\326\221\304\205\206";
+const char Event_S_0492[] PROGMEM = "\315\314\231s\350wf\335\274\240\331";
+const char Event_S_0493[] PROGMEM = "\315\314\231\205\206 \240\331";
+const char Event_S_0494[] PROGMEM = "weath\307\331\304imp\226\246";
+const char Event_S_0495[] PROGMEM = "b\354zz\224d (\377\374visib\254\355\373\203\304\334 \331";
+const char Event_S_0496[] PROGMEM = "dam\330\252ha\254 (\377\374visib\254\355\373\203\304\334 \331";
+const char Event_S_0497[] PROGMEM = "\373\232visib\254\355(t\244\334 \331";
+const char Event_S_0498[] PROGMEM = "f\230ez\221\227og \325\232(\377\374visib\254\355\373\203\304\334\364\307\356s\354pp\222\231\305s";
+const char Event_S_0499[] PROGMEM = "d\236s\207fog (\377\374visib\254\355\373\203\304\334 \331";
+const char Event_S_049A[] PROGMEM = "patchy\227og (\377\374visib\254\355\373\203\304\334 \331";
+const char Event_S_049B[] PROGMEM = "visib\254\355\331\304imp\226\246";
+const char Event_S_049C[] PROGMEM = "\235v\222s\207weath\307w\224n\252\377hd\205wn";
+const char Event_S_04A6[] PROGMEM = "\260v\222\207smog";
+const char Event_S_04A7[] PROGMEM = "\260v\222\207\276haus\245pollu\243";
+const char Event_S_04B1[] PROGMEM = "t\212n\235oes";
+const char Event_S_04B2[] PROGMEM = "h\300r\202\216\207f\212c\207w\206d\200\225";
+const char Event_S_04B3[] PROGMEM = "ga\233\200\225";
+const char Event_S_04B4[] PROGMEM = "\327\212m\227\212c\207w\206d\200\225";
+const char Event_S_04B5[] PROGMEM = "\327r\215g w\206d\200\225";
+const char Event_S_04B6[] PROGMEM = "mode\205t\207w\206d\200\225";
+const char Event_S_04B7[] PROGMEM = "\354gh\245w\206d\200\225";
+const char Event_S_04B8[] PROGMEM = "c\335m weath\222";
+const char Event_S_04B9[] PROGMEM = "gu\327\231w\206d\200\225";
+const char Event_S_04BA[] PROGMEM = "c\226\363w\206d\200\225";
+const char Event_S_04BB[] PROGMEM = "\327r\215g w\206d\200\240affe\303\252high-s\267\232\311s";
+const char Event_S_04BC[] PROGMEM = "\320\203\257high-s\267\232\311\200d\273\304\327r\215g w\206d\200\225";
+const char Event_S_04BD[] PROGMEM = "\327r\215g w\206d\200eas\221";
+const char Event_S_04BE[] PROGMEM = "\336\363\330\207c\216c\251l\203";
+const char Event_S_04BF[] PROGMEM = "\230\327r\202\243\200f\241high-s\267\232\311\200\354ft\203";
+const char Event_S_04C0[] PROGMEM = "t\212n\235\244watc\374c\216c\251l\203";
+const char Event_S_04C1[] PROGMEM = "t\212n\235\244w\224n\252\236d\203";
+const char Event_S_04C2[] PROGMEM = "w\206d\227\212ecas\245\377hd\205wn";
+const char Event_S_04C3[] PROGMEM = "\336\363\330\207c\216c\251l\203";
+const char Event_S_04E3[] PROGMEM = "\270p\226b\322\254\355\275\201\212n\235oes";
+const char Event_S_04E4[] PROGMEM = "h\300r\202\216\207f\212c\207w\206d\200\225";
+const char Event_S_04E5[] PROGMEM = "ga\233\200\225";
+const char Event_S_04E6[] PROGMEM = "\327\212m\227\212c\207w\206d\200\225";
+const char Event_S_04E7[] PROGMEM = "\327r\215g w\206d\200\225";
+const char Event_S_04E8[] PROGMEM = "\327r\215g w\206d\227\212ecas\245\377hd\205wn";
+const char Event_S_0514[] PROGMEM = "s\350wf\335\274\216d\227og (visib\254\355\373\203\304\334 \331";
+const char Event_S_0515[] PROGMEM = "d\236s\207fog (visib\254\355\373\203\304\334";
+const char Event_S_0516[] PROGMEM = "d\236s\207fog\211Visib\254\355\373\203\304<30 m";
+const char Event_S_0517[] PROGMEM = "d\236s\207fog\211Visib\254\355\373\203\304<50 m";
+const char Event_S_0518[] PROGMEM = "fog (visib\254\355\373\203\304\334";
+const char Event_S_0519[] PROGMEM = "fog\211Visib\254\355\373\203\304<100 m";
+const char Event_S_051A[] PROGMEM = "\270p\226b\322\254\355\275\227og";
+const char Event_S_051B[] PROGMEM = "patchy\227og (visib\254\355\373\203\304\334";
+const char Event_S_051C[] PROGMEM = "f\230ez\221\227og (visib\254\355\373\203\304\334";
+const char Event_S_051D[] PROGMEM = "smok\207haz\224d (visib\254\355\373\203\304\334";
+const char Event_S_051E[] PROGMEM = "b\247\252dus\245(visib\254\355\373\203\304\334";
+const char Event_S_051F[] PROGMEM = "\270p\226b\322\254\355\313\260v\222\207\276haus\245pollu\243";
+const char Event_S_0520[] PROGMEM = "s\350wf\335\274\216d\227og (visib\254\355\373\203\304\334";
+const char Event_S_0521[] PROGMEM = "visib\254\355imp\226v\203";
+const char Event_S_0522[] PROGMEM = "\336\363\330\207c\216c\251l\203";
+const char Event_S_0523[] PROGMEM = "\270p\226b\322\254\355\313d\236s\207fog";
+const char Event_S_0524[] PROGMEM = "\270p\226b\322\254\355\313patchy\227og";
+const char Event_S_0525[] PROGMEM = "\270p\226b\322\254\355\275\227\230ez\221\227og";
+const char Event_S_0526[] PROGMEM = "visib\254\355\373\232(t\244\334";
+const char Event_S_0527[] PROGMEM = "visib\254\355\373\203\304<30 m";
+const char Event_S_0528[] PROGMEM = "visib\254\355\373\203\304<50 m";
+const char Event_S_0529[] PROGMEM = "visib\254\355\373\203\304<100 m";
+const char Event_S_052A[] PROGMEM = "wh\253\207ou\245(visib\254\355\373\203\304\334";
+const char Event_S_052B[] PROGMEM = "b\247\252s\350w (visib\254\355\373\203\304\334";
+const char Event_S_052C[] PROGMEM = "sp\205\231haz\224d (visib\254\355\373\203\304\334";
+const char Event_S_052D[] PROGMEM = "\247 s\341 gl\224e";
+const char Event_S_052E[] PROGMEM = "s\216d\327\212m\200(visib\254\355\373\203\304\334";
+const char Event_S_052F[] PROGMEM = "\270p\226b\322\254\355\313s\216d\327\212ms";
+const char Event_S_0530[] PROGMEM = "\270p\226b\322\254\355\313air qu\335\253y: good";
+const char Event_S_0531[] PROGMEM = "\270p\226b\322\254\355\313air qu\335\253y:\227air";
+const char Event_S_0532[] PROGMEM = "\270p\226b\322\254\355\313air qu\335\253y: po\212";
+const char Event_S_0533[] PROGMEM = "\270p\226b\322\254\355\313air qu\335\253y: v\222\231po\212";
+const char Event_S_0534[] PROGMEM = "smog \335\222t";
+const char Event_S_0535[] PROGMEM = "\270p\226b\322\254\355\313smog";
+const char Event_S_0536[] PROGMEM = "\270p\226b\322\254\355\313pol\233n co\341t: high";
+const char Event_S_0537[] PROGMEM = "\270p\226b\322\254\355\313pol\233n co\341t: m\203ium";
+const char Event_S_0538[] PROGMEM = "\270p\226b\322\254\355\313pol\233n co\341t: \247";
+const char Event_S_0539[] PROGMEM = "f\230ez\221\227og (visib\254\355\373\203\304\334\266\354pp\222\231\305s";
+const char Event_S_053A[] PROGMEM = "n\244mot\241\311\200d\273\304smog \335\222t";
+const char Event_S_053B[] PROGMEM = "air qu\335\355imp\226v\203";
+const char Event_S_053C[] PROGMEM = "sw\224m\200\356\206\260\303\200(visib\254\355\373\203\304\334";
+const char Event_S_0541[] PROGMEM = "fog c\233\224\221";
+const char Event_S_0542[] PROGMEM = "fog\227\212ecas\245\377hd\205wn";
+const char Event_S_0547[] PROGMEM = "\372ximum\201em\250\205t\300\207(\356\334";
+const char Event_S_0548[] PROGMEM = "hot, (\372ximum\201em\250\205t\300\207\334";
+const char Event_S_0549[] PROGMEM = "w\224m, (\372ximum\201em\250\205t\300\207\334";
+const char Event_S_054A[] PROGMEM = "m\254d, (\372ximum\201em\250\205t\300\207\334";
+const char Event_S_054B[] PROGMEM = "cool, (\372ximum\201em\250\205t\300\207\334";
+const char Event_S_054C[] PROGMEM = "cold, (\372ximum\201em\250\205t\300\207\334";
+const char Event_S_054D[] PROGMEM = "v\222\231cold, (\372ximum\201em\250\205t\300\207\334";
+const char Event_S_054E[] PROGMEM = "\336\363\330\207c\216c\251l\203";
+const char Event_S_054F[] PROGMEM = "tem\250\205t\300\207\337s\252(t\244\334";
+const char Event_S_0550[] PROGMEM = "tem\250\205t\300\207f\335l\252\205p\267l\231(t\244\334";
+const char Event_S_0551[] PROGMEM = "tem\250\205t\300\207\225";
+const char Event_S_0552[] PROGMEM = "effec\234\246\201em\250\205tu\230, \377\374w\206d ch\254\274\225";
+const char Event_S_0554[] PROGMEM = "\276t\230m\207\315a\245(up\304\334";
+const char Event_S_0555[] PROGMEM = "\276t\230m\207cold (\356\334";
+const char Event_S_0579[] PROGMEM = "m\206imum\201em\250\205t\300\207(\356\334";
+const char Event_S_057A[] PROGMEM = "v\222\231w\224m (m\206imum\201em\250\205t\300\207\334";
+const char Event_S_057B[] PROGMEM = "w\224m (m\206imum\201em\250\205t\300\207\334";
+const char Event_S_057C[] PROGMEM = "m\254d (m\206imum\201em\250\205t\300\207\334";
+const char Event_S_057D[] PROGMEM = "coo\274(m\206imum\201em\250\205t\300\207\334";
+const char Event_S_057E[] PROGMEM = "cold (m\206imum\201em\250\205t\300\207\334";
+const char Event_S_057F[] PROGMEM = "v\222\231cold (m\206imum\201em\250\205t\300\207\334";
+const char Event_S_0580[] PROGMEM = "\233s\200\276t\230\336\201em\250\205tu\230\200\331";
+const char Event_S_05A9[] PROGMEM = "em\222g\236cy\201\205\206\252\206 p\226g\230\363";
+const char Event_S_05AA[] PROGMEM = "\206t\222n\306a\274sp\212\310\336et\221";
+const char Event_S_05AB[] PROGMEM = "\372tch";
+const char Event_S_05AC[] PROGMEM = "to\300nam\321";
+const char Event_S_05AD[] PROGMEM = "ath\233t\202\200\336et\221";
+const char Event_S_05AE[] PROGMEM = "b\335\274ga\336";
+const char Event_S_05AF[] PROGMEM = "box\221\201o\300nam\321";
+const char Event_S_05B0[] PROGMEM = "bull\227ight";
+const char Event_S_05B1[] PROGMEM = "cr\202ke\245\372tch";
+const char Event_S_05B2[] PROGMEM = "cycl\207\205ce";
+const char Event_S_05B3[] PROGMEM = "footb\335\274\372tch";
+const char Event_S_05B4[] PROGMEM = "golf\201o\300nam\321";
+const char Event_S_05B5[] PROGMEM = "\372\205th\215";
+const char Event_S_05B6[] PROGMEM = "\205c\207\336et\221";
+const char Event_S_05B7[] PROGMEM = "rugb\231\372tch";
+const char Event_S_05B8[] PROGMEM = "show jump\221";
+const char Event_S_05B9[] PROGMEM = "t\236ni\200to\300nam\321";
+const char Event_S_05BA[] PROGMEM = "wat\307sp\212\310\336et\221";
+const char Event_S_05BB[] PROGMEM = "w\206t\307sp\212\310\336et\221";
+const char Event_S_05BC[] PROGMEM = "f\341fair";
+const char Event_S_05BD[] PROGMEM = "t\205d\207fair";
+const char Event_S_05BE[] PROGMEM = "p\226ce\363i\215";
+const char Event_S_05BF[] PROGMEM = "sight\260\222\200ob\327ru\303\252\271ce\363";
+const char Event_S_05C0[] PROGMEM = "\250opl\207\215 \305w\261";
+const char Event_S_05C1[] PROGMEM = "ch\254d\230n \215 \305w\261";
+const char Event_S_05C2[] PROGMEM = "cyc\354s\310\215 \305w\261";
+const char Event_S_05C3[] PROGMEM = "\327\337ke";
+const char Event_S_05C4[] PROGMEM = "\260c\300\355\206\345\321";
+const char Event_S_05C5[] PROGMEM = "pol\202\207c\315\351po\206t";
+const char Event_S_05C6[] PROGMEM = "t\222r\212is\245\206\345\321";
+const char Event_S_05C7[] PROGMEM = "g\341fir\207\215 \305w\261,\347\326\222";
+const char Event_S_05C8[] PROGMEM = "civ\254 em\222g\236cy";
+const char Event_S_05C9[] PROGMEM = "air \205\267,\347\326\222";
+const char Event_S_05CA[] PROGMEM = "\250opl\207\215 \305w\261\364\222";
+const char Event_S_05CB[] PROGMEM = "ch\254d\230n \215 \305w\261\364\222";
+const char Event_S_05CC[] PROGMEM = "cyc\354s\310\215 \305w\261\364\222";
+const char Event_S_05CD[] PROGMEM = "\320\232d\273\304\260c\300\355\206\345\321";
+const char Event_S_05CE[] PROGMEM = "\260c\300\355\206\345\321\301\317\225";
+const char Event_S_05CF[] PROGMEM = "\260c\300\355\206\345\321\301\317\240\331";
+const char Event_S_05D0[] PROGMEM = "\260c\300\355\206\345\321\211L\215g\347\317\225";
+const char Event_S_05D1[] PROGMEM = "pol\202\207c\315\351po\206t\301\317\225";
+const char Event_S_05D2[] PROGMEM = "pol\202\207c\315\351po\206t\301\317\240\331";
+const char Event_S_05D3[] PROGMEM = "pol\202\207c\315\351po\206t\211L\215g\347\317\225";
+const char Event_S_05D4[] PROGMEM = "\260c\300\355\335\222\245\377hd\205wn";
+const char Event_S_05D5[] PROGMEM = "sp\212\310t\220 c\233\224\203";
+const char Event_S_05D6[] PROGMEM = "ev\271u\306";
+const char Event_S_05D7[] PROGMEM = "ev\271u\306\211He\314\272";
+const char Event_S_05D8[] PROGMEM = "t\220\347isrup\243 c\233\224\203";
+const char Event_S_05D9[] PROGMEM = "m\254\253\224y\201\205\206\252\206 p\226g\230\363";
+const char Event_S_05DA[] PROGMEM = "pol\202\207\271\234v\355\215go\221";
+const char Event_S_05DB[] PROGMEM = "m\203\202a\274em\222g\236c\231\215go\221";
+const char Event_S_05DC[] PROGMEM = "ch\254d \322d\360\243 \206 p\226g\230\363";
+const char Event_S_05DD[] PROGMEM = "\372j\241ev\321";
+const char Event_S_05DE[] PROGMEM = "sp\212\310ev\236\245\336et\221";
+const char Event_S_05DF[] PROGMEM = "show";
+const char Event_S_05E0[] PROGMEM = "fes\234v\335";
+const char Event_S_05E1[] PROGMEM = "\276hibi\243";
+const char Event_S_05E2[] PROGMEM = "fair";
+const char Event_S_05E3[] PROGMEM = "m\224ket";
+const char Event_S_05E4[] PROGMEM = "c\222em\215ia\274ev\321";
+const char Event_S_05E5[] PROGMEM = "\327at\207occasi\215";
+const char Event_S_05E6[] PROGMEM = "pa\205de";
+const char Event_S_05E7[] PROGMEM = "c\226wd";
+const char Event_S_05E8[] PROGMEM = "m\224ch";
+const char Event_S_05E9[] PROGMEM = "dem\215\327\205\243";
+const char Event_S_05EA[] PROGMEM = "publ\202\347i\327\300b\216ce";
+const char Event_S_05EB[] PROGMEM = "\260c\300\355\335\222t";
+const char Event_S_05EC[] PROGMEM = "bomb \335\222t";
+const char Event_S_05ED[] PROGMEM = "\372j\241ev\321\266t\343";
+const char Event_S_05EE[] PROGMEM = "\372j\241ev\321\364\307\356\327\343";
+const char Event_S_05EF[] PROGMEM = "\372j\241ev\321\211Q\340";
+const char Event_S_05F0[] PROGMEM = "\372j\241ev\321\364\307\356q\340";
+const char Event_S_05F1[] PROGMEM = "\372j\241ev\321\361";
+const char Event_S_05F2[] PROGMEM = "\372j\241ev\321\361 \331";
+const char Event_S_05F3[] PROGMEM = "\372j\241ev\321\211He\314\272";
+const char Event_S_05F4[] PROGMEM = "\372j\241ev\321\211He\314\272 \331";
+const char Event_S_05F5[] PROGMEM = "\372j\241ev\321\211T\220\227\247\221\227\230\251y";
+const char Event_S_05F6[] PROGMEM = "\372j\241ev\321\211T\220 bu\254d\252up";
+const char Event_S_05F7[] PROGMEM = "\320\232d\273\304\372j\241ev\321";
+const char Event_S_05F8[] PROGMEM = "\372j\241ev\321\301\317\225";
+const char Event_S_05F9[] PROGMEM = "\372j\241ev\321\301\317\240\331";
+const char Event_S_05FA[] PROGMEM = "\372j\241ev\321\211L\215g\347\317\225";
+const char Event_S_05FB[] PROGMEM = "sp\212\310\336et\221\266t\343";
+const char Event_S_05FC[] PROGMEM = "sp\212\310\336et\221\364\307\356\327\343";
+const char Event_S_05FD[] PROGMEM = "sp\212\310\336et\221\211Q\340";
+const char Event_S_05FE[] PROGMEM = "sp\212\310\336et\221\364\307\356q\340";
+const char Event_S_05FF[] PROGMEM = "sp\212\310\336et\221\361";
+const char Event_S_0600[] PROGMEM = "sp\212\310\336et\221\361 \331";
+const char Event_S_0601[] PROGMEM = "sp\212\310\336et\221\211He\314\272";
+const char Event_S_0602[] PROGMEM = "sp\212\310\336et\221\211He\314\272 \331";
+const char Event_S_0603[] PROGMEM = "sp\212\310\336et\221\211T\220\227\247\221\227\230\251y";
+const char Event_S_0604[] PROGMEM = "sp\212\310\336et\221\211T\220 bu\254d\252up";
+const char Event_S_0605[] PROGMEM = "\320\232d\273\304sp\212\310\336et\221";
+const char Event_S_0606[] PROGMEM = "sp\212\310\336et\221\301\317\225";
+const char Event_S_0607[] PROGMEM = "sp\212\310\336et\221\301\317\240\331";
+const char Event_S_0608[] PROGMEM = "sp\212\310\336et\221\211L\215g\347\317\225";
+const char Event_S_0609[] PROGMEM = "fair\266t\343";
+const char Event_S_060A[] PROGMEM = "fair\364\307\356\327\343";
+const char Event_S_060B[] PROGMEM = "fair\211Q\340";
+const char Event_S_060C[] PROGMEM = "fair\364\307\356q\340";
+const char Event_S_060D[] PROGMEM = "fair\361";
+const char Event_S_060E[] PROGMEM = "fair\361 \331";
+const char Event_S_060F[] PROGMEM = "fair\211He\314\272";
+const char Event_S_0610[] PROGMEM = "fair\211He\314\272 \331";
+const char Event_S_0611[] PROGMEM = "fair\211T\220\227\247\221\227\230\251y";
+const char Event_S_0612[] PROGMEM = "fair\211T\220 bu\254d\252up";
+const char Event_S_0613[] PROGMEM = "\320\232d\273\201o\227air";
+const char Event_S_0614[] PROGMEM = "fair\301\317\225";
+const char Event_S_0615[] PROGMEM = "fair\301\317\240\331";
+const char Event_S_0616[] PROGMEM = "fair\211L\215g\347\317\225";
+const char Event_S_0617[] PROGMEM = "\320\232d\273\304pa\205de";
+const char Event_S_0618[] PROGMEM = "pa\205de\301\317\225";
+const char Event_S_0619[] PROGMEM = "pa\205de\301\317\240\331";
+const char Event_S_061A[] PROGMEM = "pa\205de\211L\215g\347\317\225";
+const char Event_S_061B[] PROGMEM = "\320\232d\273\304\327\337ke";
+const char Event_S_061C[] PROGMEM = "\327\337ke\301\317\225";
+const char Event_S_061D[] PROGMEM = "\327\337ke\301\317\240\331";
+const char Event_S_061E[] PROGMEM = "\327\337ke\211L\215g\347\317\225";
+const char Event_S_061F[] PROGMEM = "\320\232d\273\304dem\215\327\205\243";
+const char Event_S_0620[] PROGMEM = "dem\215\327\205\243\301\317\225";
+const char Event_S_0621[] PROGMEM = "dem\215\327\205\243\301\317\240\331";
+const char Event_S_0622[] PROGMEM = "dem\215\327\205\243\211L\215g\347\317\225";
+const char Event_S_0623[] PROGMEM = "\260c\300\355\335\222t\266t\343";
+const char Event_S_0624[] PROGMEM = "\260c\300\355\335\222t\364\307\356\327\343";
+const char Event_S_0625[] PROGMEM = "\260c\300\355\335\222t\211Q\340";
+const char Event_S_0626[] PROGMEM = "\260c\300\355\335\222t\364\307\356q\340";
+const char Event_S_0627[] PROGMEM = "\260c\300\355\335\222t\361";
+const char Event_S_0628[] PROGMEM = "\260c\300\355\335\222t\361 \331";
+const char Event_S_0629[] PROGMEM = "\260c\300\355\335\222t\211He\314\272";
+const char Event_S_062A[] PROGMEM = "\260c\300\355\335\222t\211He\314\272 \331";
+const char Event_S_062B[] PROGMEM = "\260c\300\355\335\222t\211T\220 bu\254d\252up";
+const char Event_S_062C[] PROGMEM = "\320\232d\273\304\260c\300\355\335\222t";
+const char Event_S_062D[] PROGMEM = "\260c\300\355\335\222t\301\317\225";
+const char Event_S_062E[] PROGMEM = "\260c\300\355\335\222t\301\317\240\331";
+const char Event_S_062F[] PROGMEM = "\260c\300\355\335\222t\211L\215g\347\317\225";
+const char Event_S_0630[] PROGMEM = "t\220 ha\200\230t\300n\203\304n\212m\335";
+const char Event_S_0631[] PROGMEM = "\336\363\330\207c\216c\251l\203";
+const char Event_S_0632[] PROGMEM = "\260c\300\355\335\222t\211T\220\227\247\221\227\230\251y";
+const char Event_S_0633[] PROGMEM = "air \205\267 w\224n\252c\216c\251l\203";
+const char Event_S_0634[] PROGMEM = "civ\254 em\222g\236c\231c\216c\251l\203";
+const char Event_S_0635[] PROGMEM = "\336\363\330\207c\216c\251l\203";
+const char Event_S_0636[] PROGMEM = "\260\246\205\274\372j\241ev\321s";
+const char Event_S_0637[] PROGMEM = "\206f\212m\306 \322ou\245\372j\241ev\236\245n\244\210ng\307v\335\267";
+const char Event_S_0638[] PROGMEM = "automob\254\207\205ce";
+const char Event_S_0639[] PROGMEM = "ba\260b\335\274ga\336";
+const char Event_S_063A[] PROGMEM = "basketb\335\274ga\336";
+const char Event_S_063B[] PROGMEM = "boa\245\205ce";
+const char Event_S_063C[] PROGMEM = "\362c\222t";
+const char Event_S_063D[] PROGMEM = "ho\351e\231ga\336";
+const char Event_S_0641[] PROGMEM = "d\317\225";
+const char Event_S_0642[] PROGMEM = "d\317up\30415 m\206utes";
+const char Event_S_0643[] PROGMEM = "d\317up\30430 m\206utes";
+const char Event_S_0644[] PROGMEM = "d\317up\304\215\207ho\300";
+const char Event_S_0645[] PROGMEM = "d\317up\201o\201w\244ho\300s";
+const char Event_S_0646[] PROGMEM = "d\317\356\260\246\205\274ho\300s";
+const char Event_S_0647[] PROGMEM = "d\317\240\331";
+const char Event_S_0648[] PROGMEM = "\210ng\347\317\225";
+const char Event_S_0649[] PROGMEM = "d\317\225\257\315\314\231\311s";
+const char Event_S_064A[] PROGMEM = "d\317up\30415 m\206ute\200f\241\315\314\231\210rr(y/ie\204";
+const char Event_S_064B[] PROGMEM = "d\317up\30430 m\206ute\200f\241\315\314\231\210rr(y/ie\204";
+const char Event_S_064C[] PROGMEM = "d\317up\304\215\207ho\300\257\315\314\231\210rr(y/ie\204";
+const char Event_S_064D[] PROGMEM = "d\317up\201o\201w\244ho\300\200f\241\315\314\231\210rr(y/ie\204";
+const char Event_S_064E[] PROGMEM = "d\317\356\260\246\205\274ho\300\200f\241\315\314\231\210rr(y/ie\204";
+const char Event_S_064F[] PROGMEM = "\376v\202\207susp\236d\232(\341\234\274\334";
+const char Event_S_0650[] PROGMEM = "\240\376v\202\207\377hd\205wn";
+const char Event_S_0651[] PROGMEM = "\240\376v\202e\256\227ull\231book\203";
+const char Event_S_0652[] PROGMEM = "\240\376v\202e\256\227ull\231book\203\257\315\314\231\311s";
+const char Event_S_0653[] PROGMEM = "n\212\372\274\376v\202e\200\230sum\203";
+const char Event_S_0654[] PROGMEM = "\336\363\330\207c\216c\251l\203";
+const char Event_S_0655[] PROGMEM = "d\317up\3045 m\206utes";
+const char Event_S_0656[] PROGMEM = "d\317up\30410 m\206utes";
+const char Event_S_0657[] PROGMEM = "d\317up\30420 m\206utes";
+const char Event_S_0658[] PROGMEM = "d\317up\30425 m\206utes";
+const char Event_S_0659[] PROGMEM = "d\317up\30440 m\206utes";
+const char Event_S_065A[] PROGMEM = "d\317up\30450 m\206utes";
+const char Event_S_065B[] PROGMEM = "d\317up\30490 m\206utes";
+const char Event_S_065C[] PROGMEM = "d\317up\201o\352\230\207ho\300s";
+const char Event_S_065D[] PROGMEM = "d\317up\201o\227o\300 ho\300s";
+const char Event_S_065E[] PROGMEM = "d\317up\201o\227iv\207ho\300s";
+const char Event_S_065F[] PROGMEM = "v\222\231\210ng\347\317\225";
+const char Event_S_0660[] PROGMEM = "d\317\356\341c\222ta\206\347u\205\243";
+const char Event_S_0661[] PROGMEM = "d\312\232\341\234l\227\300th\307\350t\202e";
+const char Event_S_0662[] PROGMEM = "c\216c\251l\306s";
+const char Event_S_0663[] PROGMEM = "p\224k \216d r\267\207\376v\202\207\350\245o\250\205t\252(\341\234\274\334";
+const char Event_S_0664[] PROGMEM = "s\250cia\274publ\202\201\205nsp\212\245\376v\202e\200o\250\205t\252(\341\234\274\334";
+const char Event_S_0665[] PROGMEM = "n\212\372\274\376v\202e\200\350\245o\250\205t\252(\341\234\274\334";
+const char Event_S_0666[] PROGMEM = "\205\254 \376v\202e\200\350\245o\250\205t\252(\341\234\274\334";
+const char Event_S_0667[] PROGMEM = "bu\200\376v\202e\200\350\245o\250\205t\252(\341\234\274\334";
+const char Event_S_0668[] PROGMEM = "shuttl\207\376v\202\207o\250\205t\252(\341\234\274\334";
+const char Event_S_0669[] PROGMEM = "f\230\207shuttl\207\376v\202\207o\250\205t\252(\341\234\274\334";
+const char Event_S_066A[] PROGMEM = "d\317\225\257\315\314\231\210rr(y/ie\204";
+const char Event_S_066B[] PROGMEM = "d\317\225\257bu\260s";
+const char Event_S_066C[] PROGMEM = "\240\376v\202e\256\227ull\231book\203\257\315\314\231\210rr(y/ie\204";
+const char Event_S_066D[] PROGMEM = "\240\376v\202e\256\227ull\231book\203\257bu\260s";
+const char Event_S_066E[] PROGMEM = "n\276\245dep\224t\300\207\225\257\315\314\231\210rr(y/ie\204";
+const char Event_S_066F[] PROGMEM = "n\276\245dep\224t\300\207\225\257bu\260s";
+const char Event_S_0670[] PROGMEM = "d\317c\233\224\203";
+const char Event_S_0671[] PROGMEM = "\205p\267\201\205nsi\245\376v\202\207\350\245o\250\205t\252(\341\234\274\334";
+const char Event_S_0672[] PROGMEM = "d\317\240po\363ib\233";
+const char Event_S_0673[] PROGMEM = "\341d\222g\226\341d \376v\202\207\350\245o\250\205t\252(\341\234\274\334";
+const char Event_S_0674[] PROGMEM = "c\216c\251l\306\200\331";
+const char Event_S_0675[] PROGMEM = "\210ng\347\317\331";
+const char Event_S_0676[] PROGMEM = "v\222\231\210ng\347\317\331";
+const char Event_S_0677[] PROGMEM = "\335\274\376v\202e\200full\231book\232(\341\234\274\334";
+const char Event_S_0678[] PROGMEM = "n\276\245\224\337va\274\225";
+const char Event_S_0679[] PROGMEM = "\205\254 \376v\202e\200ir\230gul\224\301\317\225";
+const char Event_S_067A[] PROGMEM = "bu\200\376v\202e\200ir\230gul\224\301\317\225";
+const char Event_S_067B[] PROGMEM = "\341d\222g\226\341d \376v\202e\200ir\230gul\224";
+const char Event_S_067C[] PROGMEM = "n\212\372\274publ\202\201\205nsp\212\245\376v\202e\200\230sum\203";
+const char Event_S_067D[] PROGMEM = "f\222r\231\376v\202\207\350\245o\250\205t\252(\341\234\274\334";
+const char Event_S_067E[] PROGMEM = "p\224k \216d r\267e\201\337p\201im\207\225";
+const char Event_S_067F[] PROGMEM = "d\251a\231\331\304b\207c\233\224\203";
+const char Event_S_0680[] PROGMEM = "dem\215\327\205\243 b\231\311s";
+const char Event_S_0690[] PROGMEM = "d\317\240ha\246\304b\207\331";
+const char Event_S_0691[] PROGMEM = "d\317\356\260\246\205\274ho\300\200ha\246\304b\207\331";
+const char Event_S_0692[] PROGMEM = "\320\232a\315\235\301\317\240ha\246\304b\207\331";
+const char Event_S_0693[] PROGMEM = "\305\265s\301\317\240ha\246\304b\207\331";
+const char Event_S_0694[] PROGMEM = "f\210od\221\301\317\240ha\246\304b\207\331";
+const char Event_S_0695[] PROGMEM = "\372j\241ev\321\301\317\240ha\246\304b\207\331";
+const char Event_S_0696[] PROGMEM = "\327\337ke\301\317\240ha\246\304b\207\331";
+const char Event_S_0697[] PROGMEM = "d\317\356\260\246\205\274ho\300\200f\241\315\314\231\210r\337e\200ha\246\304b\207\331";
+const char Event_S_0698[] PROGMEM = "\210ng\347\317ha\246\304b\207\331";
+const char Event_S_0699[] PROGMEM = "v\222\231\210ng\347\317ha\246\304b\207\331";
+const char Event_S_069A[] PROGMEM = "d\312\227\212ecas\245\377hd\205wn";
+const char Event_S_069B[] PROGMEM = "\336\363\330\207c\216c\251l\203";
+const char Event_S_069F[] PROGMEM = "c\300\230nt\201\337p\201im\207\225";
+const char Event_S_06A0[] PROGMEM = "\331\201\337p\201im\207\225";
+const char Event_S_06A4[] PROGMEM = "\240s\247 m\346\252\372\206t\236\216c\207\311\256";
+const char Event_S_06A5[] PROGMEM = "\240\311\256 \215 wr\215g \370\337\330ew\261";
+const char Event_S_06A6[] PROGMEM = "d\326\222ou\200\302l\207w\224n\252c\233\224\203";
+const char Event_S_06A7[] PROGMEM = "\336\363\330\207c\216c\251l\203";
+const char Event_S_06A8[] PROGMEM = "\240\230\351\233s\200d\337v\222\256";
+const char Event_S_06A9[] PROGMEM = "\240p\226hib\253\232\311\256 \215\352\207\305w\261";
+const char Event_S_06AA[] PROGMEM = "\240em\222g\236c\231\311s";
+const char Event_S_06AB[] PROGMEM = "\240high-s\250\232em\222g\236c\231\311s";
+const char Event_S_06AC[] PROGMEM = "high-s\250\232chas\207(\206volv\252\371\311\204";
+const char Event_S_06AD[] PROGMEM = "sp\254l\330\207occ\300r\221\227\226m m\346\252\311";
+const char Event_S_06AE[] PROGMEM = "obje\303\200f\335l\221\227\226m m\346\252\311";
+const char Event_S_06AF[] PROGMEM = "em\222g\236c\231\302l\207w\224n\252c\233\224\203";
+const char Event_S_06B0[] PROGMEM = "\305 c\233\224\203";
+const char Event_S_06B8[] PROGMEM = "\205\254 \376v\202e\200ir\230gul\224";
+const char Event_S_06B9[] PROGMEM = "publ\202\201\205nsp\212\245\376v\202e\200\350\245o\250\205t\221";
+const char Event_S_06C3[] PROGMEM = "\240\322n\212\372\274\210\235\256,\347\326\222";
+const char Event_S_06C4[] PROGMEM = "\240w\267\207\210\235\256,\347\326\222";
+const char Event_S_06C5[] PROGMEM = "\240\210ng \210\235\256,\347\326\222";
+const char Event_S_06C6[] PROGMEM = "\240s\247 \311\256,\347\326\222";
+const char Event_S_06C7[] PROGMEM = "\225\201\205\351-l\261\252\311\256,\347\326\222";
+const char Event_S_06C8[] PROGMEM = "\240\311\256 \370ry\252haz\224dou\200\372t\222i\335s\364\222";
+const char Event_S_06C9[] PROGMEM = "\240\362voy\256,\347\326\222";
+const char Event_S_06CA[] PROGMEM = "\240m\254\253\224\231\362voy\256,\347\326\222";
+const char Event_S_06CB[] PROGMEM = "\240\346\222\315igh\245\210\235\256,\347\326\222";
+const char Event_S_06CC[] PROGMEM = "\322n\212\372\274\210\235 caus\252s\344\301\317\225";
+const char Event_S_06CD[] PROGMEM = "\362vo\231caus\252s\344\301\317\225";
+const char Event_S_06D7[] PROGMEM = "\240\322n\212\372\274\210\235\256";
+const char Event_S_06D8[] PROGMEM = "\240w\267\207\210\235\256";
+const char Event_S_06D9[] PROGMEM = "\240\210ng \210\235\256";
+const char Event_S_06DA[] PROGMEM = "\240s\247 \311\256";
+const char Event_S_06DB[] PROGMEM = "\240\362voy\256";
+const char Event_S_06DC[] PROGMEM = "\322n\212\372\274\210\235\301\317\225";
+const char Event_S_06DD[] PROGMEM = "\322n\212\372\274\210\235\301\317\240\331";
+const char Event_S_06DE[] PROGMEM = "\322n\212\372\274\210\235\211L\215g\347\317\225";
+const char Event_S_06DF[] PROGMEM = "\362vo\231caus\252d\317\225";
+const char Event_S_06E0[] PROGMEM = "\362voy\301\317\240\331";
+const char Event_S_06E1[] PROGMEM = "\362vo\231caus\252\210ng\347\317\225";
+const char Event_S_06E2[] PROGMEM = "\276cep\243a\274\210\235 w\224n\252c\233\224\203";
+const char Event_S_06E3[] PROGMEM = "\336\363\330\207c\216c\251l\203";
+const char Event_S_06E4[] PROGMEM = "\225\201\205\351-l\261\252\311\256";
+const char Event_S_06E5[] PROGMEM = "\240\311\256 \370ry\252haz\224dou\200\372t\222i\335s";
+const char Event_S_06E6[] PROGMEM = "\240m\254\253\224\231\362voy\256";
+const char Event_S_06E7[] PROGMEM = "\240\322n\212\372\274\210\235\256\211N\244\346\222tak\221";
+const char Event_S_06E8[] PROGMEM = "Ve\277\233\200\370ry\252haz\224dou\200\372t\222i\335\200ha\246\304\327op a\245n\276\245saf\207pl\271e!";
+const char Event_S_06E9[] PROGMEM = "haz\224dou\200\210\235 w\224n\252c\233\224\203";
+const char Event_S_06EA[] PROGMEM = "\362vo\231c\233\224\203";
+const char Event_S_06EB[] PROGMEM = "w\224n\252c\233\224\203";
+const char Event_S_06F4[] PROGMEM = "c\216c\251l\306\200ha\246\304b\207\331";
+const char Event_S_06F5[] PROGMEM = "\335\274\376v\202e\200full\231book\232(\341\234\274\334";
+const char Event_S_06F6[] PROGMEM = "p\224k \216d r\267\207\376v\202\207w\254\274\350\245b\207o\250\205t\252(\341\234\274\334";
+const char Event_S_06F7[] PROGMEM = "n\212\372\274\376v\202e\200w\254\274\350\245b\207o\250\205t\252(\341\234\274\334";
+const char Event_S_06F8[] PROGMEM = "\205\254 \376v\202e\200w\254\274\350\245b\207o\250\205t\252(\341\234\274\334";
+const char Event_S_06F9[] PROGMEM = "\205p\267\201\205nsi\245\376v\202\207w\254\274\350\245b\207o\250\205t\252(\341\234\274\334";
+const char Event_S_06FA[] PROGMEM = "\341d\222g\226\341d \376v\202\207w\254\274\350\245b\207o\250\205t\252(\341\234\274\334";
+const char Event_S_06FB[] PROGMEM = "publ\202\201\205nsp\212\245w\254\274b\207\215 \327\337ke";
+const char Event_S_06FC[] PROGMEM = "f\222r\231\376v\202\207w\254\274\350\245b\207o\250\205t\252(\341\234\274\334";
+const char Event_S_06FD[] PROGMEM = "n\212\372\274\376v\202e\200\331";
+const char Event_S_06FE[] PROGMEM = "\336\363\330\207c\216c\251l\203";
+const char Event_S_0709[] PROGMEM = "\242\207\362t\226\274sign\200\350\245\265\221";
+const char Event_S_070A[] PROGMEM = "em\222g\236cy\201e\233ph\215e\200\350\245\265\221";
+const char Event_S_070B[] PROGMEM = "em\222g\236cy\201e\233ph\215\207numb\307\350\245\265\221";
+const char Event_S_070C[] PROGMEM = "\353\275\223 \354gh\310\350\245\265\221";
+const char Event_S_070D[] PROGMEM = "\353\275\223 \354gh\310\265\252\206c\212\230\303ly";
+const char Event_S_070E[] PROGMEM = "\233\246\274c\226\363\221\227a\254u\230";
+const char Event_S_070F[] PROGMEM = "\353\275\223 \354gh\310\350\245\265\221\266t\343";
+const char Event_S_0710[] PROGMEM = "\353\275\223 \354gh\310\350\245\265\221\364\307\356\327\343";
+const char Event_S_0711[] PROGMEM = "\353\275\223 \354gh\310\350\245\265\221\211Q\340";
+const char Event_S_0712[] PROGMEM = "\353\275\223 \354gh\310\350\245\265\221\364\307\356q\340";
+const char Event_S_0713[] PROGMEM = "\353\275\223 \354gh\310\350\245\265\221\361";
+const char Event_S_0714[] PROGMEM = "\353\275\223 \354gh\310\350\245\265\221\361 \331";
+const char Event_S_0715[] PROGMEM = "\353\275\223 \354gh\310\350\245\265\221\211He\314\272";
+const char Event_S_0716[] PROGMEM = "\353\275\223 \354gh\310\350\245\265\221\211He\314\272 \331";
+const char Event_S_0717[] PROGMEM = "\353\275\223 \354gh\310\350\245\265\221\211T\220\227\247\221\227\230\251y";
+const char Event_S_0718[] PROGMEM = "\353\275\223 \354gh\310\350\245\265\221\211T\220 bu\254d\252up";
+const char Event_S_0719[] PROGMEM = "t\220 \354gh\310\350\245\265\221\301\317\225";
+const char Event_S_071A[] PROGMEM = "t\220 \354gh\310\350\245\265\221\301\317\240\331";
+const char Event_S_071B[] PROGMEM = "t\220 \354gh\310\350\245\265\221\211L\215g\347\317\225";
+const char Event_S_071C[] PROGMEM = "\233\246\274c\226\363\221\227a\254u\230\266t\343";
+const char Event_S_071D[] PROGMEM = "\233\246\274c\226\363\221\227a\254u\230\364\307\356\327\343";
+const char Event_S_071E[] PROGMEM = "\233\246\274c\226\363\221\227a\254u\230\211Q\340";
+const char Event_S_071F[] PROGMEM = "\233\246\274c\226\363\221\227a\254u\230\364\307\356q\340";
+const char Event_S_0720[] PROGMEM = "\233\246\274c\226\363\221\227a\254u\230\361";
+const char Event_S_0721[] PROGMEM = "\233\246\274c\226\363\221\227a\254u\230\361 \331";
+const char Event_S_0722[] PROGMEM = "\233\246\274c\226\363\221\227a\254u\230\211He\314\272";
+const char Event_S_0723[] PROGMEM = "\233\246\274c\226\363\221\227a\254u\230\211He\314\272 \331";
+const char Event_S_0724[] PROGMEM = "\233\246\274c\226\363\221\227a\254u\230\211T\220\227\247\221\227\230\251y";
+const char Event_S_0725[] PROGMEM = "\233\246\274c\226\363\221\227a\254u\230\211T\220 bu\254d\252up";
+const char Event_S_0726[] PROGMEM = "\233\246\274c\226\363\221\227a\254u\230\301\317\225";
+const char Event_S_0727[] PROGMEM = "\233\246\274c\226\363\221\227a\254u\230\301\317\240\331";
+const char Event_S_0728[] PROGMEM = "\233\246\274c\226\363\221\227a\254u\230\211L\215g\347\317\225";
+const char Event_S_0729[] PROGMEM = "e\233\303r\215\202 sign\200\230pai\365";
+const char Event_S_072A[] PROGMEM = "em\222g\236c\231c\335l\227\271\254i\234e\200\230\327\212\203";
+const char Event_S_072B[] PROGMEM = "t\220 sign\335\200\230pai\365";
+const char Event_S_072C[] PROGMEM = "\233\246\274c\226\363\252\350w \265\252n\212m\335ly";
+const char Event_S_072D[] PROGMEM = "\336\363\330\207c\216c\251l\203";
+const char Event_S_072E[] PROGMEM = "\242\207\362t\226\274sign\200\265\252\206c\212\230\303ly";
+const char Event_S_072F[] PROGMEM = "\242\207\362t\226\274sign\200o\250\205t\221";
+const char Event_S_0730[] PROGMEM = "v\224i\322l\207\336\363\330\207sign\200\350\245\265\221";
+const char Event_S_0731[] PROGMEM = "v\224i\322l\207\336\363\330\207sign\200\265\252\206c\212\230\303ly";
+const char Event_S_0732[] PROGMEM = "v\224i\322l\207\336\363\330\207sign\200o\250\205t\221";
+const char Event_S_0733[] PROGMEM = "\353\313\205mp \362t\226\274sign\335\200\350\245\265\221";
+const char Event_S_0734[] PROGMEM = "\353\313\205mp \362t\226\274sign\335\200\265\252\206c\212\230\303ly";
+const char Event_S_0735[] PROGMEM = "\353\275\201empo\205r\272 \354gh\310\350\245\265\221";
+const char Event_S_0736[] PROGMEM = "\353\275\201empo\205r\272 \354gh\310\265\252\206c\212\230\303ly";
+const char Event_S_0737[] PROGMEM = "t\220 signa\274\362t\226\274comput\307\350\245\265\221";
+const char Event_S_0738[] PROGMEM = "t\220 sign\335\201im\221\200ch\326\203";
+const char Event_S_0739[] PROGMEM = "t\341n\251 v\236\234l\306 \350\245\265\221";
+const char Event_S_073A[] PROGMEM = "\242\207\362t\226\274sign\200\350\245\265\221\364\222";
+const char Event_S_073B[] PROGMEM = "tempo\205r\231w\267t\374\354mi\245\225";
+const char Event_S_073C[] PROGMEM = "tempo\205r\231w\267t\374\354mi\245\354ft\203";
+const char Event_S_073E[] PROGMEM = "t\220 \230gul\306\200h\314\207be\236 ch\326\203";
+const char Event_S_073F[] PROGMEM = "\233s\200th\216 50 p\224k\252sp\271e\200\314a\254\322\233";
+const char Event_S_0740[] PROGMEM = "n\244p\224k\252\206f\212m\306 \314a\254\322l\207(\341\234\274\334";
+const char Event_S_0741[] PROGMEM = "\336\363\330\207c\216c\251l\203";
+const char Event_S_0742[] PROGMEM = "S\350wp\210ugh\301\317\225";
+const char Event_S_0745[] PROGMEM = "tempo\205r\231\315igh\245\354mi\245\225";
+const char Event_S_0746[] PROGMEM = "tempo\205r\231\315igh\245\354mi\245\354ft\203";
+const char Event_S_0747[] PROGMEM = "\240auto\372t\202 p\261m\236\245\255\200\350\245\265\221";
+const char Event_S_0748[] PROGMEM = "\242\207\362t\226\274sign\200\265\252\206c\212\230\303ly\364\222";
+const char Event_S_0749[] PROGMEM = "em\222g\236cy\201e\233ph\215e\200ou\245\356\212d\222\211Ext\205 pol\202\207pat\226l\200\206 o\250\205\243";
+const char Event_S_074A[] PROGMEM = "em\222g\236cy\201e\233ph\215e\200ou\245\356\212d\222\211In em\222g\236cy, wa\253\257pol\202\207pat\226l";
+const char Event_S_074B[] PROGMEM = "\353\275\223 \354gh\310\350\245\265\221\364\222";
+const char Event_S_074C[] PROGMEM = "t\220 \354gh\310\265\252\206c\212\230\303ly\301\317\225";
+const char Event_S_074D[] PROGMEM = "t\220 \354gh\310\265\252\206c\212\230\303ly\301\317\240\331";
+const char Event_S_074E[] PROGMEM = "t\220 \354gh\310\265\252\206c\212\230\303ly\211L\215g\347\317\225";
+const char Event_S_074F[] PROGMEM = "tempo\205r\231axl\207\210\235 \354mi\245\225";
+const char Event_S_0750[] PROGMEM = "tempo\205r\231g\226s\200weigh\245\354mi\245\225";
+const char Event_S_0751[] PROGMEM = "tempo\205r\231g\226s\200weigh\245\354mi\245\354ft\203";
+const char Event_S_0752[] PROGMEM = "tempo\205r\231axl\207weigh\245\354mi\245\354ft\203";
+const char Event_S_0753[] PROGMEM = "\353\275\223 \354gh\310\265\252\206c\212\230\303ly\364\222";
+const char Event_S_0754[] PROGMEM = "tempo\205r\272 \354gh\310\350\245\265\221\301\317\225";
+const char Event_S_0755[] PROGMEM = "tempo\205r\272 \354gh\310\350\245\265\221\301\317\240\331";
+const char Event_S_0756[] PROGMEM = "tempo\205r\272 \354gh\310\350\245\265\221\211L\215g\347\317\225";
+const char Event_S_0757[] PROGMEM = "\353\275\201empo\205r\272 \354gh\310\350\245\265\221\364\222";
+const char Event_S_0758[] PROGMEM = "t\220 signa\274\362t\226\274comput\307\350\245\265\221\301\317\225";
+const char Event_S_0759[] PROGMEM = "tempo\205r\231\233ngt\374\354mi\245\225";
+const char Event_S_075A[] PROGMEM = "tempo\205r\231\233ngt\374\354mi\245\354ft\203";
+const char Event_S_075B[] PROGMEM = "\336\363\330\207c\216c\251l\203";
+const char Event_S_075C[] PROGMEM = "t\220 signa\274\362t\226\274comput\307\350\245\265\221\301\317\240\331";
+const char Event_S_075D[] PROGMEM = "t\220 signa\274\362t\226\274comput\307\350\245\265\221\211L\215g\347\317\225";
+const char Event_S_075E[] PROGMEM = "n\212\372\274p\224k\252\230\327r\202\243\200\354ft\203";
+const char Event_S_075F[] PROGMEM = "s\250cia\274p\224k\252\230\327r\202\243\200\206\227\212ce";
+const char Event_S_0760[] PROGMEM = "10%\227ull";
+const char Event_S_0761[] PROGMEM = "20%\227ull";
+const char Event_S_0762[] PROGMEM = "30%\227ull";
+const char Event_S_0763[] PROGMEM = "40%\227ull";
+const char Event_S_0764[] PROGMEM = "50%\227ull";
+const char Event_S_0765[] PROGMEM = "60%\227ull";
+const char Event_S_0766[] PROGMEM = "70%\227ull";
+const char Event_S_0767[] PROGMEM = "80%\227ull";
+const char Event_S_0768[] PROGMEM = "90%\227ull";
+const char Event_S_0769[] PROGMEM = "\233s\200th\216 10 p\224k\252sp\271e\200\314a\254\322\233";
+const char Event_S_076A[] PROGMEM = "\233s\200th\216 20 p\224k\252sp\271e\200\314a\254\322\233";
+const char Event_S_076B[] PROGMEM = "\233s\200th\216 30 p\224k\252sp\271e\200\314a\254\322\233";
+const char Event_S_076C[] PROGMEM = "\233s\200th\216 40 p\224k\252sp\271e\200\314a\254\322\233";
+const char Event_S_076D[] PROGMEM = "n\276\245dep\224t\300\207\225";
+const char Event_S_076E[] PROGMEM = "n\276\245dep\224t\300\207\225\257\315\314\231\311s";
+const char Event_S_076F[] PROGMEM = "\370 p\224k \225\227ull";
+const char Event_S_0770[] PROGMEM = "\335\274\370 p\224k\200\225\227ull";
+const char Event_S_0771[] PROGMEM = "\233s\200th\216 \240\370 p\224k\252sp\271e\200\314a\254\322\233";
+const char Event_S_0772[] PROGMEM = "p\224k \216d r\267\207\376v\202\207o\250\205t\252(\341\234\274\334";
+const char Event_S_0773[] PROGMEM = "(nul\274ev\321)";
+const char Event_S_0774[] PROGMEM = "s\377c\374yo\300 \370 \205di\244(t\244\334";
+const char Event_S_0775[] PROGMEM = "\335\224m c\335l: imp\212t\216\245new \206f\212m\306 \215\352i\200f\230qu\236cy\227ol\247\200\350w \206 n\212\372\274p\226g\205m\336";
+const char Event_S_0776[] PROGMEM = "\335\224m \260t: new \206f\212m\306 w\254\274b\207b\305cas\245betwe\236\201\315\260\201i\336\200\206 n\212\372\274p\226g\205m\336";
+const char Event_S_0777[] PROGMEM = "\336\363\330\207c\216c\251l\203";
+const char Event_S_0779[] PROGMEM = "s\377c\374yo\300 \370 \205di\244(t\244\334";
+const char Event_S_077A[] PROGMEM = "n\244\206f\212m\306 \314a\254\322l\207(\341\234\274\334";
+const char Event_S_077B[] PROGMEM = "thi\200\336\363\330\207i\200f\212\201es\245p\300po\260\200\215l\231(numb\307\334, p\233as\207ign\212e";
+const char Event_S_077C[] PROGMEM = "n\244\206f\212m\306 \314a\254\322l\207(\341\234\274\334\347\273\201o\201echn\202a\274p\226b\233ms";
+const char Event_S_077D[] PROGMEM = "auto\372t\202\201ol\274sy\327em \350\245\265\221, pa\231m\216u\335ly";
+const char Event_S_077E[] PROGMEM = "full";
+const char Event_S_0780[] PROGMEM = "\215l\231a\227ew p\224k\252sp\271e\200\314a\254\322\233";
+const char Event_S_0781[] PROGMEM = "\240p\224k\252sp\271e\200\314a\254\322\233";
+const char Event_S_0782[] PROGMEM = "\324c\245\370 p\224k\304b\207full";
+const char Event_S_0783[] PROGMEM = "\324c\245n\244p\224k\252sp\271e\200\314a\254\322\233";
+const char Event_S_0784[] PROGMEM = "mul\234 \327\212\231\370 p\224k\200full";
+const char Event_S_0785[] PROGMEM = "n\244p\226b\233m\200t\244\230p\212\245\377\374p\224k \216d r\267\207\376v\202es";
+const char Event_S_0786[] PROGMEM = "n\244p\224k\252sp\271e\200\314a\254\322\233";
+const char Event_S_0787[] PROGMEM = "n\244p\224k\252(\341\234\274\334";
+const char Event_S_0788[] PROGMEM = "s\250cia\274p\224k\252\230\327r\202\243\200\354ft\203";
+const char Event_S_0789[] PROGMEM = "\300g\236\245\206f\212m\306 w\254\274b\207giv\236 (a\245\334 \215 n\212\372\274p\226g\205mm\207b\305ca\327s";
+const char Event_S_078A[] PROGMEM = "thi\200TMC-\376v\202\207i\200\350\245\271\234v\207(\341\234\274\334";
+const char Event_S_078B[] PROGMEM = "deta\254\232\206f\212m\306 w\254\274b\207giv\236 (a\245\334 \215 n\212\372\274p\226g\205mm\207b\305ca\327s";
+const char Event_S_078C[] PROGMEM = "deta\254\232\206f\212m\306 i\200p\226v\267\232b\231\216oth\307TMC \376v\202e";
+const char Event_S_078E[] PROGMEM = "n\244p\224k \216d r\267\207\206f\212m\306 \314a\254\322l\207(\341\234\274\334";
+const char Event_S_0792[] PROGMEM = "p\224k \216d r\267\207\206f\212m\306 \376v\202\207\230sum\203";
+const char Event_S_0793[] PROGMEM = "t\205\246\274\206f\212m\306\201e\233ph\215\207\376v\202\207\314a\254i\322\233";
+const char Event_S_0794[] PROGMEM = "\235di\243a\274\230gi\215a\274\206f\212m\306 i\200p\226v\267\232b\231\216oth\307TMC \376v\202e";
+const char Event_S_0795[] PROGMEM = "\235di\243a\274\210ca\274\206f\212m\306 i\200p\226v\267\232b\231\216oth\307TMC \376v\202e";
+const char Event_S_0796[] PROGMEM = "\235di\243a\274publ\202\201\205nsp\212\245\206f\212m\306 i\200p\226v\267\232b\231\216oth\307TMC \376v\202e";
+const char Event_S_0797[] PROGMEM = "n\306\335\223 \206f\212m\306 i\200p\226v\267\232b\231\216oth\307TMC \376v\202e";
+const char Event_S_0798[] PROGMEM = "thi\200\376v\202\207p\226v\267e\200\372j\241\305 \206f\212m\306";
+const char Event_S_0799[] PROGMEM = "thi\200\376v\202\207p\226v\267e\200\230gi\215\335\201\205\246\274\206f\212m\306";
+const char Event_S_079A[] PROGMEM = "thi\200\376v\202\207p\226v\267e\200\210c\335\201\205\246\274\206f\212m\306";
+const char Event_S_079B[] PROGMEM = "n\244deta\254\232\230gi\215a\274\206f\212m\306 p\226v\267\232by\352i\200\376v\202e";
+const char Event_S_079C[] PROGMEM = "n\244deta\254\232\210ca\274\206f\212m\306 p\226v\267\232by\352i\200\376v\202e";
+const char Event_S_079D[] PROGMEM = "n\244c\226\363-b\212d\307\206f\212m\306 p\226v\267\232by\352i\200\376v\202e";
+const char Event_S_079E[] PROGMEM = "\206f\212m\306 \230\327r\202t\203\201o\352i\200\224ea";
+const char Event_S_079F[] PROGMEM = "n\244new\223 \206f\212m\306 \314a\254\322l\207(\341\234\274\334";
+const char Event_S_07A0[] PROGMEM = "n\244publ\202\201\205nsp\212\245\206f\212m\306 \314a\254\322\233";
+const char Event_S_07A1[] PROGMEM = "thi\200TMC-\376v\202\207i\200be\252susp\236d\232(a\245\334";
+const char Event_S_07A2[] PROGMEM = "\271\234v\207TMC-\376v\202\207w\254\274\230sum\207(a\245\334";
+const char Event_S_07A3[] PROGMEM = "\230f\222\236ce\304audi\244p\226g\205m\336\200n\244\210ng\307v\335\267";
+const char Event_S_07A4[] PROGMEM = "\230f\222\236ce\304oth\307TMC \376v\202e\200n\244\210ng\307v\335\267";
+const char Event_S_07A5[] PROGMEM = "p\230viou\200\216\350\341cem\236\245\322out\352i\200\241oth\307TMC \376v\202e\200n\244\210ng\307v\335\267";
+const char Event_S_07A9[] PROGMEM = "\335\247 em\222g\236c\231\311\200t\244pas\200\206\352\207\370poo\274\255";
+const char Event_S_07AA[] PROGMEM = "\370poo\274\242\207\314a\254\322l\207f\241\335\274\311s";
+const char Event_S_07AB[] PROGMEM = "pol\202\207di\230\303\333 via\352\207\370poo\274\255";
+const char Event_S_07AC[] PROGMEM = "\205\254 \206f\212m\306 \376v\202\207\350\245\314a\254\322\233";
+const char Event_S_07AD[] PROGMEM = "\205\254 \206f\212m\306 \376v\202\207\230sum\203";
+const char Event_S_07AE[] PROGMEM = "\205p\267\201\205nsi\245\206f\212m\306 \376v\202\207\350\245\314a\254\322\233";
+const char Event_S_07AF[] PROGMEM = "\205p\267\201\205nsi\245\206f\212m\306 \376v\202\207\230sum\203";
+const char Event_S_07B3[] PROGMEM = "pol\202\207di\230\303\333";
+const char Event_S_07B4[] PROGMEM = "bus\242\207\314a\254\322l\207f\241\335\274\311s";
+const char Event_S_07B5[] PROGMEM = "pol\202\207di\230\303\333 via\352\207bus\255";
+const char Event_S_07B6[] PROGMEM = "\335\247 em\222g\236c\231\311\200t\244pa\363";
+const char Event_S_07B7[] PROGMEM = "\346\222tak\252p\226hib\253\203\257\315\314\231\311\200(\346\307\334";
+const char Event_S_07B8[] PROGMEM = "\346\222tak\252p\226hib\253\203";
+const char Event_S_07B9[] PROGMEM = "\335\247 em\222g\236c\231\311\200t\244pas\200\206\352\207\315\314\231\302l\207\255";
+const char Event_S_07BA[] PROGMEM = "\315\314\231\302l\207\242\207\314a\254\322l\207f\241\335\274\311s";
+const char Event_S_07BB[] PROGMEM = "pol\202\207di\230\303\333 via\352\207\315\314\231\302l\207\255";
+const char Event_S_07BC[] PROGMEM = "\346\222tak\252p\226hib\253\203\257\315\314\231\210r\337e\200(\346\307\334";
+const char Event_S_07BD[] PROGMEM = "d\337v\222\200\356\315\314\231\210r\337e\200(\346\307\334 \224\207\230comm\236d\203\304\327op a\245n\276\245saf\207pl\271e";
+const char Event_S_07BE[] PROGMEM = "bus\242\207\320\203";
+const char Event_S_07BF[] PROGMEM = "pow\222\227a\254u\230";
+const char Event_S_07C1[] PROGMEM = "\346\222tak\252\230\327r\202\243 \354ft\203";
+const char Event_S_07C2[] PROGMEM = "Low Emi\363i\215 Z\215\207\230\327r\202\243 \206\227\212ce";
+const char Event_S_07C6[] PROGMEM = "\370 p\224k \320\232(\341\234\274\334";
+const char Event_S_07C7[] PROGMEM = "d\326\307\356wa\253\252\311\200\215 \305w\261";
+const char Event_S_07C9[] PROGMEM = "numb\307\356p\224k\252sp\271e\200dec\230as\221";
+const char Event_S_07CA[] PROGMEM = "numb\307\356p\224k\252sp\271e\200\362\327\216t";
+const char Event_S_07CB[] PROGMEM = "numb\307\356p\224k\252sp\271e\200\206c\230as\221";
+const char Event_S_07CE[] PROGMEM = "d\326\222ou\200s\253u\306 \215 \276i\245s\354p \305";
+const char Event_S_07CF[] PROGMEM = "d\326\222ou\200s\253u\306 \215 \321r\231s\354p \305";
+const char Event_S_07D0[] PROGMEM = "\320\232d\273\304smog \335\222\245(\341\234\274\334";
+const char Event_S_07D6[] PROGMEM = "\320\203\257\311\200\377\374\233s\200th\216\352\230\207occup\216ts";
+const char Event_S_07D7[] PROGMEM = "\320\203\257\311\200\377\374\215l\231\215\207occup\216t";
+const char Event_S_07DD[] PROGMEM = "\376v\202\207\224ea busy";
+const char Event_S_07E5[] PROGMEM = "\376v\202\207\350\245o\250\205t\221, subs\234tut\207\376v\202\207\314a\254\322\233";
+const char Event_S_07E6[] PROGMEM = "publ\202\201\205nsp\212\245\327\337ke";
+const char Event_S_07EC[] PROGMEM = "\336\363\330\207c\216c\251l\203";
+const char Event_S_07ED[] PROGMEM = "\336\363\330\207c\216c\251l\203";
+const char Event_S_07EE[] PROGMEM = "\336\363\330\207c\216c\251l\203";
+const char Event_S_07F0[] PROGMEM = "\336\363\330\207c\216c\251l\203";
+const char Event_S_07F1[] PROGMEM = "\336\363\330\207c\216c\251l\203";
+const char Event_S_07F2[] PROGMEM = "\336\363\330\207c\216c\251l\203";
+const char Event_S_07F3[] PROGMEM = "\336\363\330\207c\216c\251l\203";
+const char Event_S_07F6[] PROGMEM = "\336\363\330\207c\216c\251l\203";
+const char Event_S_07F7[] PROGMEM = "\336\363\330\207c\216c\251l\203";
+const char Event_S_07F8[] PROGMEM = "\336\363\330\207c\216c\251l\203";
+const char Event_S_07F9[] PROGMEM = "\350th\221\304\230p\212t";
+const char Event_S_07FA[] PROGMEM = "\202\207bu\254d-up \215 c\322l\207\327ru\303u\230";
+const char Event_S_07FB[] PROGMEM = "\305 s\335t\203";
+const char Event_S_07FC[] PROGMEM = "d\326\307\356s\350w patc\315s";
+const char Event_S_07FD[] PROGMEM = "s\350w patc\315s";
+const char Event_S_07FE[] PROGMEM = "C\215vo\231\376v\202\207\230quir\232d\273\304b\235 weath\222";
+const char Event_S_07FF[] PROGMEM = "(nul\274\336\363\330e)";
+#endif
+
+const TRDSTMCEventListEntry ISO14819_2_Events[1552] PROGMEM = {
+	{0x0001, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0001, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0000, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0002, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0002, 0x10, 0x25, 0x28, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0009, 0x10, 0x25, 0x28, 1
+#endif
+},
+	{0x000B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 4
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_000B, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x001F, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x000C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 3
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_000C, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0036, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0010, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0010, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0050, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0014, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0014, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x006B, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0016, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0016, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x008C, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0017, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0017, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x009E, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0018, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0018, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x00B1, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0019, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0019, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x00B9, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x001A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 6
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_001A, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x00C1, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x001B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 6
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_001B, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x00C9, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x001C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_001C, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x00D1, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0024, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0024, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x00DF, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0025, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0025, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x00EC, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0027, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 39
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0027, 0x1D, 0x1E, 0x21, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x00F9, 0x1D, 0x1E, 0x21, 1
+#endif
+},
+	{0x0028, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0028, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0108, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0029, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0029, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0114, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x002A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_002A, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0121, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0033, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0033, 0x0B, 0x0C, 0x0F, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x012E, 0x0B, 0x0C, 0x0F, 1
+#endif
+},
+	{0x0034, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0034, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0140, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0035, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0035, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0154, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0037, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0037, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0165, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0038, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0038, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0170, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0039, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0039, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x017B, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x003D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_003D, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0183, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x003E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_003E, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0191, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x003F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_003F, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x019B, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0040, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0040, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x01AA, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0046, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0046, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x01B4, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0047, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0047, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x01CD, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0048, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0048, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x01E6, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0049, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0049, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x01FF, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x004A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_004A, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0218, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x004B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_004B, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0231, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x004C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_004C, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x024A, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0050, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, false, 32
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0050, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0263, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0051, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 32
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0051, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0270, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0052, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, false, 32
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0052, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0282, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0053, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 32
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0053, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0296, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0054, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, false, 32
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0054, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x02A3, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0055, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, false, 32
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0055, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x02B8, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0056, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, false, 32
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0056, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x02CF, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0057, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, false, 32
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0057, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x02E2, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0058, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, false, 32
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0058, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x02F6, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0059, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 32
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0059, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x030C, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x005B, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_005B, 0x07, 0x08, 0x0B, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0317, 0x07, 0x08, 0x0B, 1
+#endif
+},
+	{0x0065, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0065, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x031E, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0066, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0066, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0321, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0067, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0067, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0327, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0068, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0068, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x032D, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0069, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0069, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0333, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x006A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_006A, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0339, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x006B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_006B, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0340, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x006C, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_006C, 0x10, 0x25, 0x28, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0345, 0x10, 0x25, 0x28, 1
+#endif
+},
+	{0x006D, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_006D, 0x19, 0x2E, 0x31, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0356, 0x19, 0x2E, 0x31, 1
+#endif
+},
+	{0x006E, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_006E, 0x19, 0x2E, 0x31, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x036A, 0x19, 0x2E, 0x31, 1
+#endif
+},
+	{0x006F, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_006F, 0x19, 0x2E, 0x31, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x037E, 0x19, 0x2E, 0x31, 1
+#endif
+},
+	{0x0070, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0070, 0x19, 0x2E, 0x31, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0392, 0x19, 0x2E, 0x31, 1
+#endif
+},
+	{0x0071, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0071, 0x1A, 0x2F, 0x32, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x03A6, 0x1A, 0x2F, 0x32, 1
+#endif
+},
+	{0x0072, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0072, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x03BB, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0073, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0073, 0x0D, 0x22, 0x25, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x03C0, 0x0D, 0x22, 0x25, 1
+#endif
+},
+	{0x0074, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0074, 0x16, 0x2B, 0x2E, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x03D1, 0x16, 0x2B, 0x2E, 1
+#endif
+},
+	{0x0075, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0075, 0x16, 0x2B, 0x2E, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x03E5, 0x16, 0x2B, 0x2E, 1
+#endif
+},
+	{0x0076, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0076, 0x16, 0x2B, 0x2E, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x03F9, 0x16, 0x2B, 0x2E, 1
+#endif
+},
+	{0x0077, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0077, 0x16, 0x2B, 0x2E, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x040D, 0x16, 0x2B, 0x2E, 1
+#endif
+},
+	{0x0078, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0078, 0x17, 0x2C, 0x2F, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0421, 0x17, 0x2C, 0x2F, 1
+#endif
+},
+	{0x0079, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0079, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0436, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x007A, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_007A, 0x0E, 0x23, 0x26, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x043B, 0x0E, 0x23, 0x26, 1
+#endif
+},
+	{0x007B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_007B, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x044D, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x007C, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_007C, 0x17, 0x2C, 0x2F, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0453, 0x17, 0x2C, 0x2F, 1
+#endif
+},
+	{0x007D, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_007D, 0x14, 0x29, 0x2C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x046A, 0x14, 0x29, 0x2C, 1
+#endif
+},
+	{0x007E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_007E, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0483, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x007F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_007F, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0492, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0080, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0080, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x04A0, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0081, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0081, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x04AB, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0082, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0082, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x04B1, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0083, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0083, 0x19, 0x2E, 0x31, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x04B8, 0x19, 0x2E, 0x31, 1
+#endif
+},
+	{0x0084, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0084, 0x1A, 0x2F, 0x32, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x04CC, 0x1A, 0x2F, 0x32, 1
+#endif
+},
+	{0x0085, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0085, 0x0C, 0x21, 0x24, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x04E1, 0x0C, 0x21, 0x24, 1
+#endif
+},
+	{0x0086, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0086, 0x16, 0x2B, 0x2E, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x04F7, 0x16, 0x2B, 0x2E, 1
+#endif
+},
+	{0x0087, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0087, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x050B, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0088, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0088, 0x13, 0x28, 0x2B, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0513, 0x13, 0x28, 0x2B, 1
+#endif
+},
+	{0x0089, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0089, 0x1C, 0x31, 0x34, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x052A, 0x1C, 0x31, 0x34, 1
+#endif
+},
+	{0x008A, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_008A, 0x10, 0x25, 0x28, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0547, 0x10, 0x25, 0x28, 1
+#endif
+},
+	{0x008B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_008B, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0563, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x008C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_008C, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0576, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x008D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 3
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_008D, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0588, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x008E, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_008E, 0x1C, 0x31, 0x34, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x05A2, 0x1C, 0x31, 0x34, 1
+#endif
+},
+	{0x008F, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_008F, 0x26, 0x3B, 0x3E, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x05BE, 0x26, 0x3B, 0x3E, 1
+#endif
+},
+	{0x00C8, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00C8, 0x1E, 0x1F, 0x22, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x05E0, 0x1E, 0x1F, 0x22, 1
+#endif
+},
+	{0x00C9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 3
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00C9, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x05F1, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00CA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00CA, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x05F5, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00CB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00CB, 0x17, 0x22, 0x2E, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x05FE, 0x17, 0x22, 0x2E, 1
+#endif
+},
+	{0x00CC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00CC, 0x13, 0x16, 0x19, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0614, 0x13, 0x16, 0x19, 1
+#endif
+},
+	{0x00CD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00CD, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x062F, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00CE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00CE, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0648, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00CF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00CF, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0656, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00D0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00D0, 0x1C, 0x1D, 0x20, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0666, 0x1C, 0x1D, 0x20, 1
+#endif
+},
+	{0x00D1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 3
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00D1, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0676, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00D2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00D2, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0686, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00D3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 4
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00D3, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x068E, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00D4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 4
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00D4, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x069B, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00D5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 3
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00D5, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x06B2, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00D6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 4
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00D6, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x06BB, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00D7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00D7, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x06C1, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00D8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00D8, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x06C8, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00D9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00D9, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x06D2, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00DA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00DA, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x06DC, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00DB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00DB, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x06E6, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00DC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00DC, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x06F0, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00DD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00DD, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x06FB, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00DE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00DE, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0704, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00DF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00DF, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x070B, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00E0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00E0, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0715, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00E1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00E1, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x071F, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00E2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00E2, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0729, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00E3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00E3, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0733, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00E4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00E4, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x073E, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00E5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00E5, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0747, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00E6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00E6, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x074C, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00E7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00E7, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0754, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00E8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00E8, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x075C, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00E9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00E9, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0764, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00EA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00EA, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x076C, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00EB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00EB, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0775, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00EC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00EC, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x077C, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00ED, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00ED, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0785, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00EE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00EE, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0790, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00EF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00EF, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x079E, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00F0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00F0, 0x13, 0x14, 0x17, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x07AD, 0x13, 0x14, 0x17, 1
+#endif
+},
+	{0x00F1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00F1, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x07B8, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00F2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00F2, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x07C6, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00F3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00F3, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x07D3, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00F4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00F4, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x07E0, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00F5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00F5, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x07F2, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00F6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00F6, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x07FE, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x00F7, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00F7, 0x11, 0x12, 0x15, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x080B, 0x11, 0x12, 0x15, 1
+#endif
+},
+	{0x00F8, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00F8, 0x11, 0x12, 0x15, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0810, 0x11, 0x12, 0x15, 1
+#endif
+},
+	{0x00F9, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00F9, 0x16, 0x17, 0x1A, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0816, 0x16, 0x17, 0x1A, 1
+#endif
+},
+	{0x00FA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00FA, 0x1C, 0x1D, 0x20, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x081F, 0x1C, 0x1D, 0x20, 1
+#endif
+},
+	{0x00FB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00FB, 0x1C, 0x1D, 0x20, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0832, 0x1C, 0x1D, 0x20, 1
+#endif
+},
+	{0x00FC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00FC, 0x1C, 0x1D, 0x20, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0848, 0x1C, 0x1D, 0x20, 1
+#endif
+},
+	{0x00FD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00FD, 0x1C, 0x1D, 0x20, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x085E, 0x1C, 0x1D, 0x20, 1
+#endif
+},
+	{0x00FE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00FE, 0x1C, 0x1D, 0x20, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0874, 0x1C, 0x1D, 0x20, 1
+#endif
+},
+	{0x00FF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_00FF, 0x1C, 0x1D, 0x20, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x088A, 0x1C, 0x1D, 0x20, 1
+#endif
+},
+	{0x0100, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0100, 0x1C, 0x1D, 0x20, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x08A1, 0x1C, 0x1D, 0x20, 1
+#endif
+},
+	{0x0101, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0101, 0x1C, 0x1D, 0x20, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x08B6, 0x1C, 0x1D, 0x20, 1
+#endif
+},
+	{0x0102, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0102, 0x1C, 0x1D, 0x20, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x08C9, 0x1C, 0x1D, 0x20, 1
+#endif
+},
+	{0x0103, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0103, 0x1C, 0x1D, 0x20, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x08DF, 0x1C, 0x1D, 0x20, 1
+#endif
+},
+	{0x0104, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0104, 0x1C, 0x1D, 0x20, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x08F5, 0x1C, 0x1D, 0x20, 1
+#endif
+},
+	{0x0105, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0105, 0x1C, 0x1D, 0x20, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x090B, 0x1C, 0x1D, 0x20, 1
+#endif
+},
+	{0x0106, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0106, 0x1C, 0x1D, 0x20, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0921, 0x1C, 0x1D, 0x20, 1
+#endif
+},
+	{0x0107, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0107, 0x1C, 0x1D, 0x20, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0938, 0x1C, 0x1D, 0x20, 1
+#endif
+},
+	{0x0108, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0108, 0x1C, 0x1D, 0x20, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x094D, 0x1C, 0x1D, 0x20, 1
+#endif
+},
+	{0x0109, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0109, 0x1C, 0x1D, 0x20, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x095E, 0x1C, 0x1D, 0x20, 1
+#endif
+},
+	{0x010A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_010A, 0x1C, 0x1D, 0x20, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0972, 0x1C, 0x1D, 0x20, 1
+#endif
+},
+	{0x010B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_010B, 0x1C, 0x1D, 0x20, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0986, 0x1C, 0x1D, 0x20, 1
+#endif
+},
+	{0x010C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_010C, 0x1C, 0x1D, 0x20, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x099A, 0x1C, 0x1D, 0x20, 1
+#endif
+},
+	{0x010D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_010D, 0x1C, 0x1D, 0x20, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x09AE, 0x1C, 0x1D, 0x20, 1
+#endif
+},
+	{0x010E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_010E, 0x1C, 0x1D, 0x20, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x09C3, 0x1C, 0x1D, 0x20, 1
+#endif
+},
+	{0x010F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_010F, 0x1C, 0x1D, 0x20, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x09D6, 0x1C, 0x1D, 0x20, 1
+#endif
+},
+	{0x0110, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0110, 0x1C, 0x1D, 0x20, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x09EB, 0x1C, 0x1D, 0x20, 1
+#endif
+},
+	{0x0112, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0112, 0x1C, 0x1D, 0x20, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0A02, 0x1C, 0x1D, 0x20, 1
+#endif
+},
+	{0x0113, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0113, 0x2D, 0x2E, 0x31, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0A1D, 0x2D, 0x2E, 0x31, 1
+#endif
+},
+	{0x0114, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0114, 0x2D, 0x2E, 0x31, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0A2E, 0x2D, 0x2E, 0x31, 1
+#endif
+},
+	{0x0115, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0115, 0x32, 0x33, 0x36, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0A40, 0x32, 0x33, 0x36, 1
+#endif
+},
+	{0x0116, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0116, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0A55, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0117, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0117, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0A60, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0118, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0118, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0A6E, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0119, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0119, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0A7C, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x011A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_011A, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0A8A, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x011B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_011B, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0A98, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x011C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_011C, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0AA7, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x011D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_011D, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0AB4, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x011E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_011E, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0ABF, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x011F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_011F, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0ACD, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0120, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0120, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0ADB, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0121, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0121, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0AE9, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0122, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0122, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0AF7, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0123, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0123, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0B06, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0124, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0124, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0B13, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0125, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0125, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0B1C, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0126, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0126, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0B28, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0127, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0127, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0B34, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0128, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0128, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0B40, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0129, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0129, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0B4C, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x012A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_012A, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0B59, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x012B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_012B, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0B64, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x012C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_012C, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0B71, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x012D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_012D, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0B80, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x012E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_012E, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0B92, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x012F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_012F, 0x0B, 0x0C, 0x0F, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0BA5, 0x0B, 0x0C, 0x0F, 1
+#endif
+},
+	{0x0130, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0130, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0BB1, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0131, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0131, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0BC3, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0132, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0132, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0BD4, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0133, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0133, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0BE5, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0134, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0134, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0BFB, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0135, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0135, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0C0B, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0136, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0136, 0x12, 0x13, 0x16, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0C1C, 0x12, 0x13, 0x16, 1
+#endif
+},
+	{0x0137, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0137, 0x12, 0x13, 0x16, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0C25, 0x12, 0x13, 0x16, 1
+#endif
+},
+	{0x0138, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0138, 0x17, 0x18, 0x1B, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0C2F, 0x17, 0x18, 0x1B, 1
+#endif
+},
+	{0x0139, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0139, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0C3C, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x013A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_013A, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0C4C, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x013B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_013B, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0C5E, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x013C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_013C, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0C6E, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x013D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_013D, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0C80, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x013E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_013E, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0C8E, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x013F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_013F, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0C9E, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0140, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0140, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0CB0, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0141, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0141, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0CC4, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0142, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0142, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0CDB, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0143, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0143, 0x0B, 0x0C, 0x0F, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0CF3, 0x0B, 0x0C, 0x0F, 1
+#endif
+},
+	{0x0144, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0144, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0D05, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0145, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0145, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0D1C, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0146, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0146, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0D32, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0147, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0147, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0D48, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0148, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0148, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0D63, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0149, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0149, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0D78, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x014A, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_014A, 0x1C, 0x1D, 0x20, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0D8E, 0x1C, 0x1D, 0x20, 1
+#endif
+},
+	{0x014B, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_014B, 0x1C, 0x1D, 0x20, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0D9C, 0x1C, 0x1D, 0x20, 1
+#endif
+},
+	{0x014C, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_014C, 0x21, 0x22, 0x25, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0DAB, 0x21, 0x22, 0x25, 1
+#endif
+},
+	{0x014D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 3
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_014D, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0DBD, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x014E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 3
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_014E, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0DC5, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x014F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_014F, 0x13, 0x16, 0x19, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0DD0, 0x13, 0x16, 0x19, 1
+#endif
+},
+	{0x0150, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0150, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0DE5, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0151, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 3
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0151, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0DF2, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0152, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0152, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0DFC, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0153, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0153, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0E10, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0154, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0154, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0E1F, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0155, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0155, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0E2F, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0156, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 3
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0156, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0E4A, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0157, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 3
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0157, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0E57, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0158, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 3
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0158, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0E5F, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0159, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 3
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0159, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0E6B, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x015A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 4
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_015A, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0E74, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x015B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 24
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_015B, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0E85, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x015C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_015C, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0E90, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x015D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_015D, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0E9A, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x015E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_015E, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0EA4, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x015F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_015F, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0EAC, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0160, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0160, 0x1C, 0x1D, 0x20, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0EB9, 0x1C, 0x1D, 0x20, 1
+#endif
+},
+	{0x0161, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0161, 0x1C, 0x1D, 0x20, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0ECF, 0x1C, 0x1D, 0x20, 1
+#endif
+},
+	{0x0162, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0162, 0x1C, 0x1D, 0x20, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0EE5, 0x1C, 0x1D, 0x20, 1
+#endif
+},
+	{0x0163, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0163, 0x1C, 0x1D, 0x20, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0EF9, 0x1C, 0x1D, 0x20, 1
+#endif
+},
+	{0x0164, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0164, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0F0B, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0165, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0165, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0F19, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0166, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0166, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0F27, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0167, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0167, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0F33, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0168, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0168, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0F3D, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0169, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0169, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0F4A, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x016A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_016A, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0F59, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x016B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_016B, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0F66, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x016C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_016C, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0F75, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x016D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_016D, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0F80, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x016E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_016E, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0F8D, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x016F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_016F, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0F9C, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0170, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0170, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0FAD, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0171, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0171, 0x0B, 0x0C, 0x0F, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0FC2, 0x0B, 0x0C, 0x0F, 1
+#endif
+},
+	{0x0172, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0172, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0FD0, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0173, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0173, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0FE4, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0174, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0174, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x0FF7, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0175, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0175, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x100A, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0176, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0176, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x101C, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0177, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0177, 0x1B, 0x1C, 0x1F, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x102F, 0x1B, 0x1C, 0x1F, 1
+#endif
+},
+	{0x0178, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0178, 0x1B, 0x1C, 0x1F, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x103A, 0x1B, 0x1C, 0x1F, 1
+#endif
+},
+	{0x0179, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0179, 0x20, 0x21, 0x24, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1046, 0x20, 0x21, 0x24, 1
+#endif
+},
+	{0x017A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_017A, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1055, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x017B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_017B, 0x1A, 0x1B, 0x1E, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1061, 0x1A, 0x1B, 0x1E, 1
+#endif
+},
+	{0x017C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_017C, 0x24, 0x25, 0x28, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x106F, 0x24, 0x25, 0x28, 1
+#endif
+},
+	{0x017D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_017D, 0x17, 0x18, 0x1B, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1080, 0x17, 0x18, 0x1B, 1
+#endif
+},
+	{0x017E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_017E, 0x21, 0x22, 0x25, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x108D, 0x21, 0x22, 0x25, 1
+#endif
+},
+	{0x017F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_017F, 0x14, 0x15, 0x18, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x109E, 0x14, 0x15, 0x18, 1
+#endif
+},
+	{0x0181, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0181, 0x15, 0x16, 0x19, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x10AB, 0x15, 0x16, 0x19, 1
+#endif
+},
+	{0x0183, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0183, 0x1B, 0x1C, 0x1F, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x10BA, 0x1B, 0x1C, 0x1F, 1
+#endif
+},
+	{0x0184, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0184, 0x07, 0x08, 0x0B, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x10CF, 0x07, 0x08, 0x0B, 1
+#endif
+},
+	{0x0186, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0186, 0x0C, 0x0D, 0x10, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x10DB, 0x0C, 0x0D, 0x10, 1
+#endif
+},
+	{0x0187, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 3
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0187, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x10EA, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0188, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0188, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x10F8, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0189, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 4
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0189, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1103, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x018A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 4
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_018A, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1112, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x018B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 4
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_018B, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x112B, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x018C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 4
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_018C, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1132, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x018D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 4
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_018D, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x113B, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x018F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 8
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_018F, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1152, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0191, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0191, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x115D, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0192, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0192, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1160, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0193, RDS_TMC_QUANTIFIER_TONNES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0193, 0x1A, 0x20, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1163, 0x1A, 0x20, 0x23, 1
+#endif
+},
+	{0x0194, RDS_TMC_QUANTIFIER_TONNES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0194, 0x25, 0x2B, 0x2E, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1170, 0x25, 0x2B, 0x2E, 1
+#endif
+},
+	{0x0195, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0195, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1185, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0196, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 8
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0196, 0x00, 0x01, 0x07, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x118D, 0x00, 0x01, 0x07, 1
+#endif
+},
+	{0x0197, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 7
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0197, 0x00, 0x01, 0x07, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x119E, 0x00, 0x01, 0x07, 1
+#endif
+},
+	{0x0198, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 7
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0198, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x11AF, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0199, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 7
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0199, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x11B8, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x019A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_019A, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x11C5, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x019B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_019B, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x11CE, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x019C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_019C, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x11DA, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x019D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_019D, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x11E6, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x019E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_019E, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x11F2, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x019F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_019F, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x11FE, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01A0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01A0, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x120B, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01A1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01A1, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1216, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01A2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01A2, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x121F, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01A3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01A3, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x122B, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01A4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01A4, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1237, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01A5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01A5, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1243, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01A6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01A6, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x124F, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01A7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01A7, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x125C, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01A8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01A8, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1267, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01A9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01A9, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x126E, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01AA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01AA, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1278, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01AB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01AB, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1282, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01AC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01AC, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x128C, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01AD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01AD, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1296, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01AE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01AE, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x12A1, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01AF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01AF, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x12AA, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01B0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01B0, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x12B5, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01B1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01B1, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x12C2, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01B2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01B2, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x12D2, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01B3, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01B3, 0x15, 0x16, 0x19, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x12E3, 0x15, 0x16, 0x19, 1
+#endif
+},
+	{0x01B4, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01B4, 0x15, 0x16, 0x19, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x12EC, 0x15, 0x16, 0x19, 1
+#endif
+},
+	{0x01B5, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01B5, 0x1A, 0x1B, 0x1E, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x12F6, 0x1A, 0x1B, 0x1E, 1
+#endif
+},
+	{0x01B6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01B6, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1303, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01B7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01B7, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x130C, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01B8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01B8, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1318, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01B9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01B9, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1324, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01BA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01BA, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1330, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01BB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01BB, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x133C, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01BC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01BC, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1349, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01BD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01BD, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1354, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01BE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01BE, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x135D, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01BF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01BF, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1369, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01C0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01C0, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1375, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01C1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01C1, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1381, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01C2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01C2, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x138D, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01C3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01C3, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x139A, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01C4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01C4, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x13A5, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01C5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01C5, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x13AC, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01C6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01C6, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x13B6, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01C7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01C7, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x13C0, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01C8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01C8, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x13CA, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01C9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01C9, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x13D4, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01CA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01CA, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x13DF, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01CB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01CB, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x13E8, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01CC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01CC, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x13F3, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01CD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01CD, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1400, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01CE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01CE, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1410, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01CF, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01CF, 0x16, 0x17, 0x1A, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1421, 0x16, 0x17, 0x1A, 1
+#endif
+},
+	{0x01D0, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01D0, 0x16, 0x17, 0x1A, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x142A, 0x16, 0x17, 0x1A, 1
+#endif
+},
+	{0x01D1, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01D1, 0x1B, 0x1C, 0x1F, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1434, 0x1B, 0x1C, 0x1F, 1
+#endif
+},
+	{0x01D2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 7
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01D2, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1441, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01D3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01D3, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x144D, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01D4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01D4, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1453, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01D5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01D5, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x145E, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01D6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01D6, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1464, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01D7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 8
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01D7, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x146A, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x01D8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 8
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01D8, 0x00, 0x01, 0x07, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1478, 0x00, 0x01, 0x07, 1
+#endif
+},
+	{0x01D9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 8
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01D9, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1489, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01DA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 7
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01DA, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x148F, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x01DB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 7
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01DB, 0x00, 0x01, 0x07, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x149D, 0x00, 0x01, 0x07, 1
+#endif
+},
+	{0x01DC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 7
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01DC, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x14AE, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01DD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 7
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01DD, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x14B4, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01DE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 7
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01DE, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x14BD, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01DF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 6
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01DF, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x14CC, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01E0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 6
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01E0, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x14DC, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01E1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 6
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01E1, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x14F5, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01E2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 6
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01E2, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x150D, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01E3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 6
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01E3, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1517, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01E4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 6
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01E4, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1524, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01E5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 7
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01E5, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x152D, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01E6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 6
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01E6, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x153C, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01E7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 6
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01E7, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x154C, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01E8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 6
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01E8, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1565, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01E9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 6
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01E9, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x157D, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01EA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 6
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01EA, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1587, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01EB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 6
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01EB, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1594, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01EC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01EC, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x159D, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01ED, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01ED, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x15A6, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01EE, RDS_TMC_QUANTIFIER_TONNES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01EE, 0x19, 0x1F, 0x22, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x15AD, 0x19, 0x1F, 0x22, 1
+#endif
+},
+	{0x01EF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01EF, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x15BD, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01F0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01F0, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x15C9, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01F1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01F1, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x15D5, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01F2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01F2, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x15DF, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01F3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01F3, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x15EB, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01F4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01F4, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x15F7, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x01F5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01F5, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x15FE, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x01F6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01F6, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1609, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x01F7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01F7, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1614, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x01F8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01F8, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x161E, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01F9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01F9, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x162C, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01FA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01FA, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1634, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01FB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01FB, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x163D, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x01FC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01FC, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1648, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x01FD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01FD, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1653, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x01FE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01FE, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x165D, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x01FF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_01FF, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x166B, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0200, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0200, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1673, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0201, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0201, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x167C, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0202, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0202, 0x14, 0x1A, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x168C, 0x14, 0x1A, 0x23, 1
+#endif
+},
+	{0x0203, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0203, 0x14, 0x1A, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x16A2, 0x14, 0x1A, 0x23, 1
+#endif
+},
+	{0x0204, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0204, 0x14, 0x1A, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x16BB, 0x14, 0x1A, 0x23, 1
+#endif
+},
+	{0x0205, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0205, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x16D4, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0206, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0206, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x16D9, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0207, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0207, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x16E1, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0208, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0208, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x16F0, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0209, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0209, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x16F7, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x020A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_020A, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1700, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x020B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_020B, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x170C, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x020C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_020C, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1718, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x020D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_020D, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1724, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x020E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_020E, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1730, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x020F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_020F, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x173D, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0210, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0210, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1748, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0211, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0211, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1751, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0212, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0212, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x175D, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0213, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0213, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1769, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0214, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0214, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1775, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0215, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0215, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1781, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0216, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0216, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x178E, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0217, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0217, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1799, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0218, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0218, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x17A0, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0219, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0219, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x17AA, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x021A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_021A, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x17B4, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x021B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_021B, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x17BE, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x021C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_021C, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x17C8, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x021D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_021D, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x17D3, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x021E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_021E, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x17DC, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x021F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_021F, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x17E7, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0220, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0220, 0x00, 0x01, 0x04, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x17F4, 0x00, 0x01, 0x04, 0
+#endif
+},
+	{0x0221, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0221, 0x00, 0x01, 0x04, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1804, 0x00, 0x01, 0x04, 0
+#endif
+},
+	{0x0222, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0222, 0x14, 0x1A, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1815, 0x14, 0x1A, 0x23, 1
+#endif
+},
+	{0x0223, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0223, 0x14, 0x1A, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x182E, 0x14, 0x1A, 0x23, 1
+#endif
+},
+	{0x0224, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0224, 0x14, 0x1A, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1849, 0x14, 0x1A, 0x23, 1
+#endif
+},
+	{0x0225, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0225, 0x14, 0x1A, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1862, 0x14, 0x1A, 0x23, 1
+#endif
+},
+	{0x0226, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0226, 0x14, 0x1A, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x187D, 0x14, 0x1A, 0x23, 1
+#endif
+},
+	{0x0227, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0227, 0x14, 0x1A, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1894, 0x14, 0x1A, 0x23, 1
+#endif
+},
+	{0x0228, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0228, 0x14, 0x1A, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x18AD, 0x14, 0x1A, 0x23, 1
+#endif
+},
+	{0x0229, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0229, 0x14, 0x1A, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x18C8, 0x14, 0x1A, 0x23, 1
+#endif
+},
+	{0x022A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_022A, 0x14, 0x1A, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x18E5, 0x14, 0x1A, 0x23, 1
+#endif
+},
+	{0x022B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_022B, 0x14, 0x1A, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1905, 0x14, 0x1A, 0x23, 1
+#endif
+},
+	{0x022C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_022C, 0x14, 0x1A, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1926, 0x14, 0x1A, 0x23, 1
+#endif
+},
+	{0x022D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_022D, 0x14, 0x1A, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1942, 0x14, 0x1A, 0x23, 1
+#endif
+},
+	{0x022E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_022E, 0x14, 0x1A, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1960, 0x14, 0x1A, 0x23, 1
+#endif
+},
+	{0x022F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_022F, 0x14, 0x1A, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x197C, 0x14, 0x1A, 0x23, 1
+#endif
+},
+	{0x0230, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0230, 0x14, 0x1A, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x199A, 0x14, 0x1A, 0x23, 1
+#endif
+},
+	{0x0231, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0231, 0x14, 0x1A, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x19B4, 0x14, 0x1A, 0x23, 1
+#endif
+},
+	{0x0232, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0232, 0x14, 0x1A, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x19D0, 0x14, 0x1A, 0x23, 1
+#endif
+},
+	{0x0233, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0233, 0x14, 0x1A, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x19EE, 0x14, 0x1A, 0x23, 1
+#endif
+},
+	{0x0234, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0234, 0x14, 0x1A, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1A0E, 0x14, 0x1A, 0x23, 1
+#endif
+},
+	{0x0235, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0235, 0x14, 0x1A, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1A31, 0x14, 0x1A, 0x23, 1
+#endif
+},
+	{0x0236, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0236, 0x14, 0x1A, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1A55, 0x14, 0x1A, 0x23, 1
+#endif
+},
+	{0x0237, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0237, 0x14, 0x1A, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1A71, 0x14, 0x1A, 0x23, 1
+#endif
+},
+	{0x0238, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0238, 0x14, 0x1A, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1A8F, 0x14, 0x1A, 0x23, 1
+#endif
+},
+	{0x0239, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0239, 0x14, 0x1A, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1AAB, 0x14, 0x1A, 0x23, 1
+#endif
+},
+	{0x023A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_023A, 0x14, 0x1A, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1AC9, 0x14, 0x1A, 0x23, 1
+#endif
+},
+	{0x023B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_023B, 0x14, 0x1A, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1AE3, 0x14, 0x1A, 0x23, 1
+#endif
+},
+	{0x023C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_023C, 0x14, 0x1A, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1AFF, 0x14, 0x1A, 0x23, 1
+#endif
+},
+	{0x023D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_023D, 0x14, 0x1A, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1B1D, 0x14, 0x1A, 0x23, 1
+#endif
+},
+	{0x023E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_023E, 0x14, 0x1A, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1B3D, 0x14, 0x1A, 0x23, 1
+#endif
+},
+	{0x023F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_023F, 0x14, 0x1A, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1B60, 0x14, 0x1A, 0x23, 1
+#endif
+},
+	{0x0240, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0240, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1B84, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0241, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0241, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1B8C, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0242, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0242, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1B97, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0243, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0243, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1BA2, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0244, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0244, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1BAD, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0245, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0245, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1BB8, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0246, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0246, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1BC4, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0247, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0247, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1BCE, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0248, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0248, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1BD6, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0249, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0249, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1BE1, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x024A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_024A, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1BEC, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x024B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_024B, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1BF7, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x024C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_024C, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1C02, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x024D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_024D, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1C0E, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x024E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_024E, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1C18, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x024F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_024F, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1C1E, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0250, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0250, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1C27, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0251, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0251, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1C30, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0252, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0252, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1C39, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0253, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0253, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1C42, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0254, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0254, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1C4C, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0255, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0255, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1C54, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0256, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0256, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1C5E, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0257, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0257, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1C6A, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0258, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0258, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1C79, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0259, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0259, 0x20, 0x26, 0x2F, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1C89, 0x20, 0x26, 0x2F, 1
+#endif
+},
+	{0x025A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_025A, 0x20, 0x26, 0x2F, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1CA5, 0x20, 0x26, 0x2F, 1
+#endif
+},
+	{0x025B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_025B, 0x20, 0x26, 0x2F, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1CC4, 0x20, 0x26, 0x2F, 1
+#endif
+},
+	{0x025C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_025C, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1CE3, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x025D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_025D, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1CEE, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x025E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_025E, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1CFB, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x025F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_025F, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1D06, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0260, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0260, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1D13, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0261, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0261, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1D1C, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0262, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0262, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1D27, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0263, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0263, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1D34, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0264, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0264, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1D43, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0265, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0265, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1D55, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0266, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0266, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1D68, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0267, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0267, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1D7A, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0268, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0268, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1D91, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0269, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0269, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1DA3, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x026A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_026A, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1DB7, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x026B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_026B, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1DC7, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x026C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_026C, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1DD9, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x026D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_026D, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1DED, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x026E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_026E, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1E03, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x026F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_026F, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1E1C, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0270, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0270, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1E36, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0271, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0271, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1E41, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0272, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0272, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1E4C, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0273, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0273, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1E56, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0274, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0274, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1E72, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0275, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0275, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1E94, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0276, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0276, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1EB6, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0277, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0277, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1EBA, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0278, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 8
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0278, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1EC1, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0279, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 7
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0279, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1ECA, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x027A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 6
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_027A, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1ED3, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x027B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_027B, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1EE2, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x027C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_027C, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1EF4, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x027D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_027D, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1F02, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x027E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_027E, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1F0E, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x027F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_027F, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1F17, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0280, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0280, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1F21, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0281, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0281, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1F2C, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0282, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0282, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1F33, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0283, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0283, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1F3F, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0284, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0284, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1F48, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0285, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0285, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1F52, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0286, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0286, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1F5D, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0287, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 10
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0287, 0x00, 0x01, 0x0B, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1F64, 0x00, 0x01, 0x0B, 1
+#endif
+},
+	{0x0288, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 10
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0288, 0x00, 0x01, 0x0B, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1F79, 0x00, 0x01, 0x0B, 1
+#endif
+},
+	{0x0289, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 10
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0289, 0x00, 0x01, 0x0B, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1F8A, 0x00, 0x01, 0x0B, 1
+#endif
+},
+	{0x028A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 10
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_028A, 0x1D, 0x21, 0x38, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1F9B, 0x1D, 0x21, 0x38, 1
+#endif
+},
+	{0x028B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_028B, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1FB8, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x028C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_028C, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1FC4, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x028D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_028D, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1FD0, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x028E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_028E, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1FDA, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x028F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_028F, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1FE5, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0290, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0290, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1FF0, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0291, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0291, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x1FF9, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0292, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0292, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2004, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0293, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 10
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0293, 0x00, 0x01, 0x0B, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x200E, 0x00, 0x01, 0x0B, 1
+#endif
+},
+	{0x0294, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0294, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2025, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0295, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0295, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2032, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0296, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0296, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2045, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0297, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 6
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0297, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2056, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0298, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0298, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2064, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0299, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0299, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x206E, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x029A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_029A, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x207B, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x029F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 10
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_029F, 0x20, 0x2F, 0x3C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2090, 0x20, 0x2F, 0x3C, 1
+#endif
+},
+	{0x02A0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 6
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02A0, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x20B6, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x02A1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 7
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02A1, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x20C1, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x02A3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 23
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02A3, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x20CC, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x02A4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 6
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02A4, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x20D4, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x02A6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02A6, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x20DC, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x02A7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02A7, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x20E7, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x02A8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02A8, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x20F2, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x02A9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 23
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02A9, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2100, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x02BD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02BD, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x210B, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x02BE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02BE, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2111, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x02BF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 11
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02BF, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x211A, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x02C0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02C0, 0x00, 0x01, 0x10, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2125, 0x00, 0x01, 0x10, 1
+#endif
+},
+	{0x02C1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02C1, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2132, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x02C2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 13
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02C2, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x213F, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x02C3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02C3, 0x18, 0x1C, 0x27, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2149, 0x18, 0x1C, 0x27, 1
+#endif
+},
+	{0x02C4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 11
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02C4, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2162, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x02C5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 11
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02C5, 0x00, 0x01, 0x10, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2173, 0x00, 0x01, 0x10, 1
+#endif
+},
+	{0x02C6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02C6, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x217F, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x02C7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02C7, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2188, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x02C8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02C8, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2194, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x02C9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02C9, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x21A0, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x02CA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02CA, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x21AC, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x02CB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02CB, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x21B8, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x02CC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02CC, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x21C5, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x02CD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02CD, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x21D0, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x02CE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02CE, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x21D9, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x02CF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02CF, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x21E5, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x02D0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02D0, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x21F1, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x02D1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02D1, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x21FD, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x02D2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02D2, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2209, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x02D3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02D3, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2216, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x02D4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02D4, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2221, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x02D5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02D5, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2228, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x02D6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02D6, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2232, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x02D7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02D7, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x223C, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x02D8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02D8, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2246, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x02D9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02D9, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2250, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x02DA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02DA, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x225B, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x02DB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02DB, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2264, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x02DC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02DC, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x226F, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x02DD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02DD, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x227C, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x02DE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02DE, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x228C, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x02DF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02DF, 0x0E, 0x0F, 0x1A, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x229D, 0x0E, 0x0F, 0x1A, 1
+#endif
+},
+	{0x02E0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02E0, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x22A8, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x02E1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02E1, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x22B8, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x02E2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02E2, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x22C7, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x02E3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02E3, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x22D6, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x02E4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02E4, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x22EA, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x02E5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02E5, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x22F8, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x02E6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02E6, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2307, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x02E7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02E7, 0x1F, 0x25, 0x2E, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x231C, 0x1F, 0x25, 0x2E, 1
+#endif
+},
+	{0x02E8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02E8, 0x1F, 0x25, 0x2E, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2337, 0x1F, 0x25, 0x2E, 1
+#endif
+},
+	{0x02E9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02E9, 0x1F, 0x25, 0x2E, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2355, 0x1F, 0x25, 0x2E, 1
+#endif
+},
+	{0x02EA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02EA, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2373, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x02EB, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02EB, 0x12, 0x13, 0x16, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x237F, 0x12, 0x13, 0x16, 1
+#endif
+},
+	{0x02EC, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02EC, 0x12, 0x13, 0x16, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2386, 0x12, 0x13, 0x16, 1
+#endif
+},
+	{0x02ED, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02ED, 0x17, 0x18, 0x1B, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x238E, 0x17, 0x18, 0x1B, 1
+#endif
+},
+	{0x02EE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02EE, 0x00, 0x01, 0x10, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2399, 0x00, 0x01, 0x10, 1
+#endif
+},
+	{0x02EF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02EF, 0x00, 0x01, 0x10, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x23A9, 0x00, 0x01, 0x10, 1
+#endif
+},
+	{0x02F0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02F0, 0x00, 0x01, 0x10, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x23BC, 0x00, 0x01, 0x10, 1
+#endif
+},
+	{0x02F1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02F1, 0x00, 0x01, 0x10, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x23CF, 0x00, 0x01, 0x10, 1
+#endif
+},
+	{0x02F2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02F2, 0x00, 0x01, 0x10, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x23E2, 0x00, 0x01, 0x10, 1
+#endif
+},
+	{0x02F3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02F3, 0x00, 0x01, 0x10, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x23F5, 0x00, 0x01, 0x10, 1
+#endif
+},
+	{0x02F4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02F4, 0x00, 0x01, 0x10, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2409, 0x00, 0x01, 0x10, 1
+#endif
+},
+	{0x02F5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02F5, 0x00, 0x01, 0x10, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x241B, 0x00, 0x01, 0x10, 1
+#endif
+},
+	{0x02F6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02F6, 0x00, 0x01, 0x10, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x242B, 0x00, 0x01, 0x10, 1
+#endif
+},
+	{0x02F7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02F7, 0x00, 0x01, 0x10, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x243E, 0x00, 0x01, 0x10, 1
+#endif
+},
+	{0x02F8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02F8, 0x00, 0x01, 0x10, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2451, 0x00, 0x01, 0x10, 1
+#endif
+},
+	{0x02F9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02F9, 0x00, 0x01, 0x10, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2464, 0x00, 0x01, 0x10, 1
+#endif
+},
+	{0x02FA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02FA, 0x00, 0x01, 0x10, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2477, 0x00, 0x01, 0x10, 1
+#endif
+},
+	{0x02FB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02FB, 0x00, 0x01, 0x10, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x248B, 0x00, 0x01, 0x10, 1
+#endif
+},
+	{0x02FC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02FC, 0x00, 0x01, 0x10, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x249D, 0x00, 0x01, 0x10, 1
+#endif
+},
+	{0x02FD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02FD, 0x00, 0x01, 0x10, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x24AB, 0x00, 0x01, 0x10, 1
+#endif
+},
+	{0x02FE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02FE, 0x00, 0x01, 0x10, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x24BC, 0x00, 0x01, 0x10, 1
+#endif
+},
+	{0x02FF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_02FF, 0x00, 0x01, 0x10, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x24CD, 0x00, 0x01, 0x10, 1
+#endif
+},
+	{0x0300, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0300, 0x00, 0x01, 0x10, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x24DE, 0x00, 0x01, 0x10, 1
+#endif
+},
+	{0x0301, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0301, 0x00, 0x01, 0x10, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x24EF, 0x00, 0x01, 0x10, 1
+#endif
+},
+	{0x0302, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0302, 0x00, 0x01, 0x10, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2501, 0x00, 0x01, 0x10, 1
+#endif
+},
+	{0x0303, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0303, 0x00, 0x01, 0x10, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2511, 0x00, 0x01, 0x10, 1
+#endif
+},
+	{0x0304, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0304, 0x00, 0x01, 0x10, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2523, 0x00, 0x01, 0x10, 1
+#endif
+},
+	{0x0305, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0305, 0x00, 0x01, 0x10, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2537, 0x00, 0x01, 0x10, 1
+#endif
+},
+	{0x0306, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0306, 0x00, 0x01, 0x10, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x254E, 0x00, 0x01, 0x10, 1
+#endif
+},
+	{0x0307, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0307, 0x00, 0x01, 0x10, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2566, 0x00, 0x01, 0x10, 1
+#endif
+},
+	{0x0308, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0308, 0x26, 0x2C, 0x35, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2582, 0x26, 0x2C, 0x35, 1
+#endif
+},
+	{0x0309, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0309, 0x26, 0x2C, 0x35, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x25A1, 0x26, 0x2C, 0x35, 1
+#endif
+},
+	{0x030A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_030A, 0x26, 0x2C, 0x35, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x25C3, 0x26, 0x2C, 0x35, 1
+#endif
+},
+	{0x030B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_030B, 0x00, 0x01, 0x10, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x25E5, 0x00, 0x01, 0x10, 1
+#endif
+},
+	{0x030C, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_030C, 0x19, 0x1A, 0x1D, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x25F8, 0x19, 0x1A, 0x1D, 1
+#endif
+},
+	{0x030D, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_030D, 0x19, 0x1A, 0x1D, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2603, 0x19, 0x1A, 0x1D, 1
+#endif
+},
+	{0x030E, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_030E, 0x1E, 0x1F, 0x22, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x260F, 0x1E, 0x1F, 0x22, 1
+#endif
+},
+	{0x030F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_030F, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x261E, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0310, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0310, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x262B, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0311, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0311, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x263A, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0312, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0312, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2647, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0313, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0313, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2656, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0314, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0314, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2661, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0315, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0315, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x266E, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0316, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0316, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x267D, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0317, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0317, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x268E, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0318, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0318, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x26A2, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0319, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0319, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x26B7, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x031A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_031A, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x26CB, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x031B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_031B, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x26DE, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x031C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_031C, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x26F1, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x031D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_031D, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2709, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x031E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_031E, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x271B, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x031F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_031F, 0x22, 0x26, 0x31, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x272E, 0x22, 0x26, 0x31, 1
+#endif
+},
+	{0x0320, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 11
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0320, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x274A, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0321, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 11
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0321, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2752, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0322, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0322, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x275D, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0323, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0323, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x276B, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0324, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 23
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0324, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2775, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0325, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 11
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0325, 0x17, 0x1B, 0x26, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2787, 0x17, 0x1B, 0x26, 1
+#endif
+},
+	{0x0326, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 11
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0326, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x27A0, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0327, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 11
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0327, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x27AB, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0328, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 11
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0328, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x27B5, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0329, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 11
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0329, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x27C4, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x032A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 11
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_032A, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x27D4, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x032B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 11
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_032B, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x27E1, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x032C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_032C, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x27ED, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x032D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_032D, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x27F9, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x032E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_032E, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2805, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x032F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_032F, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x280F, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0330, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0330, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x281F, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0331, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0331, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2835, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0332, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0332, 0x00, 0x01, 0x10, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2845, 0x00, 0x01, 0x10, 1
+#endif
+},
+	{0x0333, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0333, 0x00, 0x01, 0x10, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2858, 0x00, 0x01, 0x10, 1
+#endif
+},
+	{0x0334, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0334, 0x00, 0x01, 0x10, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x286B, 0x00, 0x01, 0x10, 1
+#endif
+},
+	{0x0335, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0335, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x287C, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0336, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0336, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2890, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0337, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0337, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x28AA, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0338, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 13
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0338, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x28BE, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0339, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0339, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x28CA, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x033A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_033A, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x28DF, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x033B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_033B, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x28F6, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x033C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_033C, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x290B, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x033D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_033D, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2922, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x033E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_033E, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2935, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x033F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_033F, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x294A, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0340, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0340, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2961, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0341, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0341, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x297A, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0342, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0342, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2996, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0343, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0343, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x29B3, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0344, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0344, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x29CF, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0345, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0345, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x29EA, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0346, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0346, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2A05, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0347, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0347, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2A1F, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0348, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0348, 0x18, 0x19, 0x1C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2A3A, 0x18, 0x19, 0x1C, 1
+#endif
+},
+	{0x0349, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0349, 0x18, 0x19, 0x1C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2A46, 0x18, 0x19, 0x1C, 1
+#endif
+},
+	{0x034A, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_034A, 0x1D, 0x1E, 0x21, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2A53, 0x1D, 0x1E, 0x21, 1
+#endif
+},
+	{0x034B, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_034B, 0x16, 0x17, 0x1A, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2A63, 0x16, 0x17, 0x1A, 1
+#endif
+},
+	{0x034C, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_034C, 0x16, 0x17, 0x1A, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2A6E, 0x16, 0x17, 0x1A, 1
+#endif
+},
+	{0x034D, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_034D, 0x1B, 0x1C, 0x1F, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2A7A, 0x1B, 0x1C, 0x1F, 1
+#endif
+},
+	{0x034E, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_034E, 0x1E, 0x1F, 0x22, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2A89, 0x1E, 0x1F, 0x22, 1
+#endif
+},
+	{0x034F, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_034F, 0x1E, 0x1F, 0x22, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2A99, 0x1E, 0x1F, 0x22, 1
+#endif
+},
+	{0x0350, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0350, 0x23, 0x24, 0x27, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2AAA, 0x23, 0x24, 0x27, 1
+#endif
+},
+	{0x0351, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0351, 0x20, 0x21, 0x24, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2ABE, 0x20, 0x21, 0x24, 1
+#endif
+},
+	{0x0352, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0352, 0x20, 0x21, 0x24, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2ACF, 0x20, 0x21, 0x24, 1
+#endif
+},
+	{0x0353, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0353, 0x25, 0x26, 0x29, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2AE1, 0x25, 0x26, 0x29, 1
+#endif
+},
+	{0x0354, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 13
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0354, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2AF6, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0355, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 11
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0355, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2B02, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0356, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 11
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0356, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2B14, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0357, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 11
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0357, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2B22, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0358, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 13
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0358, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2B2F, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0359, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 13
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0359, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2B3D, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x035A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 13
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_035A, 0x09, 0x0A, 0x0D, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2B4D, 0x09, 0x0A, 0x0D, 0
+#endif
+},
+	{0x035B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 13
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_035B, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2B61, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x035C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 13
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_035C, 0x0A, 0x0B, 0x0E, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2B6D, 0x0A, 0x0B, 0x0E, 1
+#endif
+},
+	{0x035D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 13
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_035D, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2B7D, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x035E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 13
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_035E, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2B8C, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0381, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_XURGENT, false, false, true, 13
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0381, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2B9F, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0382, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0382, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2BB6, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0383, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0383, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2BC8, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0384, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0384, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2BE2, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0385, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0385, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2BE9, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0386, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0386, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2BF8, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0387, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0387, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2C07, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0388, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0388, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2C12, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0389, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0389, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2C1B, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x038A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_038A, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2C25, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x038B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_038B, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2C31, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x038C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_038C, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2C37, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x038D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_038D, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2C3F, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x038E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_038E, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2C4A, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x038F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_038F, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2C59, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0390, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0390, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2C60, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0391, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0391, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2C6A, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0392, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0392, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2C71, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0393, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0393, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2C78, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0394, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0394, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2C87, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0395, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0395, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2C98, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0396, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0396, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2CA1, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0397, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0397, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2CAF, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0398, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0398, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2CBA, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0399, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0399, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2CC1, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x039A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 13
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_039A, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2CCA, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x039B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 13
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_039B, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2CD5, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x039C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 4
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_039C, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2CE1, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x039D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_039D, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2CEA, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x039E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_039E, 0x0B, 0x0C, 0x0F, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2CF7, 0x0B, 0x0C, 0x0F, 1
+#endif
+},
+	{0x039F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_039F, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2D05, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x03A0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03A0, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2D1A, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03A1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03A1, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2D23, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03A2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03A2, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2D2E, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03A3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03A3, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2D37, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03A4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03A4, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2D42, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03A5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03A5, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2D49, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03A6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03A6, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2D52, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03A7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03A7, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2D5D, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03A8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03A8, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2D6A, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03A9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03A9, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2D7A, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03AA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03AA, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2D8B, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03AB, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03AB, 0x11, 0x12, 0x15, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2D97, 0x11, 0x12, 0x15, 1
+#endif
+},
+	{0x03AC, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03AC, 0x11, 0x12, 0x15, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2DA0, 0x11, 0x12, 0x15, 1
+#endif
+},
+	{0x03AD, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03AD, 0x16, 0x17, 0x1A, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2DAA, 0x16, 0x17, 0x1A, 1
+#endif
+},
+	{0x03AE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03AE, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2DB7, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03AF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03AF, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2DC8, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03B0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03B0, 0x1F, 0x26, 0x38, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2DD4, 0x1F, 0x26, 0x38, 1
+#endif
+},
+	{0x03B1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03B1, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2DF4, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03B2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03B2, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2E00, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03B3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03B3, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2E12, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03B4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03B4, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2E20, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03B5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03B5, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2E32, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03B6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03B6, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2E40, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03B7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03B7, 0x20, 0x26, 0x2F, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2E58, 0x20, 0x26, 0x2F, 1
+#endif
+},
+	{0x03B8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03B8, 0x20, 0x26, 0x2F, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2E78, 0x20, 0x26, 0x2F, 1
+#endif
+},
+	{0x03B9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03B9, 0x20, 0x26, 0x2F, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2E9B, 0x20, 0x26, 0x2F, 1
+#endif
+},
+	{0x03BA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03BA, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2EBE, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03BB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03BB, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2ED4, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03BC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03BC, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2EE8, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03BD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03BD, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2EF8, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03BE, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03BE, 0x19, 0x1A, 0x1D, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2F0A, 0x19, 0x1A, 0x1D, 1
+#endif
+},
+	{0x03BF, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03BF, 0x19, 0x1A, 0x1D, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2F18, 0x19, 0x1A, 0x1D, 1
+#endif
+},
+	{0x03C0, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03C0, 0x1E, 0x1F, 0x22, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2F27, 0x1E, 0x1F, 0x22, 1
+#endif
+},
+	{0x03C1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03C1, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2F39, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03C2, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03C2, 0x11, 0x12, 0x15, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2F45, 0x11, 0x12, 0x15, 1
+#endif
+},
+	{0x03C3, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03C3, 0x11, 0x12, 0x15, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2F4F, 0x11, 0x12, 0x15, 1
+#endif
+},
+	{0x03C4, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03C4, 0x16, 0x17, 0x1A, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2F5A, 0x16, 0x17, 0x1A, 1
+#endif
+},
+	{0x03C5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03C5, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2F68, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03C6, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03C6, 0x15, 0x16, 0x19, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2F76, 0x15, 0x16, 0x19, 1
+#endif
+},
+	{0x03C7, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03C7, 0x15, 0x16, 0x19, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2F82, 0x15, 0x16, 0x19, 1
+#endif
+},
+	{0x03C8, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03C8, 0x1A, 0x1B, 0x1E, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2F8F, 0x1A, 0x1B, 0x1E, 1
+#endif
+},
+	{0x03C9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03C9, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2F9F, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03CA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03CA, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2FAB, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03CB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03CB, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2FB3, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03CC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03CC, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2FBE, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03CD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03CD, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2FC8, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03CE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03CE, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2FD6, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03CF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03CF, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2FDE, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03D0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03D0, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2FE8, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03D1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03D1, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2FF1, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03D2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03D2, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x2FF9, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03D3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03D3, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3002, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03D4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03D4, 0x0B, 0x0C, 0x0F, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x300A, 0x0B, 0x0C, 0x0F, 1
+#endif
+},
+	{0x03D5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03D5, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x301C, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x03D6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03D6, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3034, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03D7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03D7, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3045, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03D8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03D8, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x305B, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03D9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03D9, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3068, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03DA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03DA, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x307C, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03DB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03DB, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3087, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03DC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03DC, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3099, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03DD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03DD, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x30B2, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03DE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03DE, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x30C2, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03DF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03DF, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x30CC, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03E0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03E0, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x30D9, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03E1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03E1, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x30E2, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03E2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03E2, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x30F1, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03E3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03E3, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x30FD, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03E4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03E4, 0x21, 0x28, 0x3A, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x310C, 0x21, 0x28, 0x3A, 1
+#endif
+},
+	{0x03E5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03E5, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x312F, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03E6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03E6, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3145, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03E7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03E7, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x314E, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03E8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03E8, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3157, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03E9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03E9, 0x1D, 0x24, 0x36, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3168, 0x1D, 0x24, 0x36, 1
+#endif
+},
+	{0x03EA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03EA, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3188, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03EB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03EB, 0x0E, 0x15, 0x27, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3194, 0x0E, 0x15, 0x27, 1
+#endif
+},
+	{0x03EC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03EC, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x31AB, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03ED, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03ED, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x31B3, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03EE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03EE, 0x04, 0x0B, 0x1D, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x31BB, 0x04, 0x0B, 0x1D, 1
+#endif
+},
+	{0x03EF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03EF, 0x0E, 0x15, 0x27, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x31CC, 0x0E, 0x15, 0x27, 1
+#endif
+},
+	{0x03F0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03F0, 0x0A, 0x11, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x31E1, 0x0A, 0x11, 0x23, 1
+#endif
+},
+	{0x03F1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03F1, 0x0E, 0x15, 0x27, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x31F7, 0x0E, 0x15, 0x27, 1
+#endif
+},
+	{0x03F2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03F2, 0x12, 0x19, 0x2B, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x320E, 0x12, 0x19, 0x2B, 1
+#endif
+},
+	{0x03F3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03F3, 0x06, 0x0D, 0x1F, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3227, 0x06, 0x0D, 0x1F, 1
+#endif
+},
+	{0x03F4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03F4, 0x11, 0x18, 0x2A, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x323B, 0x11, 0x18, 0x2A, 1
+#endif
+},
+	{0x03F5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03F5, 0x0C, 0x13, 0x25, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3253, 0x0C, 0x13, 0x25, 1
+#endif
+},
+	{0x03F6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03F6, 0x0B, 0x12, 0x24, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x326A, 0x0B, 0x12, 0x24, 1
+#endif
+},
+	{0x03F7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03F7, 0x0A, 0x11, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3281, 0x0A, 0x11, 0x23, 1
+#endif
+},
+	{0x03F8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03F8, 0x0C, 0x13, 0x25, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3299, 0x0C, 0x13, 0x25, 1
+#endif
+},
+	{0x03F9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03F9, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x32AF, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x03FA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03FA, 0x0E, 0x15, 0x27, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x32C4, 0x0E, 0x15, 0x27, 1
+#endif
+},
+	{0x03FB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03FB, 0x0E, 0x15, 0x27, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x32E1, 0x0E, 0x15, 0x27, 1
+#endif
+},
+	{0x03FC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03FC, 0x15, 0x1C, 0x2E, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x32FF, 0x15, 0x1C, 0x2E, 1
+#endif
+},
+	{0x03FD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03FD, 0x26, 0x2C, 0x35, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3318, 0x26, 0x2C, 0x35, 1
+#endif
+},
+	{0x03FE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03FE, 0x26, 0x2C, 0x35, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3338, 0x26, 0x2C, 0x35, 1
+#endif
+},
+	{0x03FF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_03FF, 0x26, 0x2C, 0x35, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x335B, 0x26, 0x2C, 0x35, 1
+#endif
+},
+	{0x0400, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0400, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x337E, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0401, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0401, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3392, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0402, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0402, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x339D, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0403, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0403, 0x17, 0x18, 0x1B, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x33A8, 0x17, 0x18, 0x1B, 1
+#endif
+},
+	{0x0404, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0404, 0x17, 0x18, 0x1B, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x33B6, 0x17, 0x18, 0x1B, 1
+#endif
+},
+	{0x0405, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0405, 0x1C, 0x1D, 0x20, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x33C5, 0x1C, 0x1D, 0x20, 1
+#endif
+},
+	{0x0406, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0406, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x33D7, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0407, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0407, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x33E4, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0408, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0408, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x33F1, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0409, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0409, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x33FA, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x040A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 4
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_040A, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3405, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x040B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_040B, 0x0B, 0x12, 0x24, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3410, 0x0B, 0x12, 0x24, 1
+#endif
+},
+	{0x040C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_040C, 0x12, 0x19, 0x2B, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3427, 0x12, 0x19, 0x2B, 1
+#endif
+},
+	{0x040D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_040D, 0x27, 0x2E, 0x40, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3443, 0x27, 0x2E, 0x40, 1
+#endif
+},
+	{0x040E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_040E, 0x1D, 0x24, 0x36, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3469, 0x1D, 0x24, 0x36, 1
+#endif
+},
+	{0x040F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_040F, 0x13, 0x1A, 0x2C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3488, 0x13, 0x1A, 0x2C, 1
+#endif
+},
+	{0x0410, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0410, 0x09, 0x10, 0x22, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x34A1, 0x09, 0x10, 0x22, 1
+#endif
+},
+	{0x0411, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0411, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x34B6, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0412, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0412, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x34C5, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0413, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0413, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x34D1, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0414, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0414, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x34DD, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0415, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0415, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x34E4, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0416, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 34
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0416, 0x0D, 0x14, 0x26, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x34EC, 0x0D, 0x14, 0x26, 1
+#endif
+},
+	{0x0417, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0417, 0x0C, 0x13, 0x25, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x34FF, 0x0C, 0x13, 0x25, 1
+#endif
+},
+	{0x0418, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0418, 0x16, 0x1D, 0x2F, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3516, 0x16, 0x1D, 0x2F, 1
+#endif
+},
+	{0x0419, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 34
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0419, 0x15, 0x1C, 0x2E, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3531, 0x15, 0x1C, 0x2E, 1
+#endif
+},
+	{0x041A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_041A, 0x14, 0x1B, 0x2D, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x354A, 0x14, 0x1B, 0x2D, 1
+#endif
+},
+	{0x041B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 34
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_041B, 0x13, 0x1A, 0x2C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3564, 0x13, 0x1A, 0x2C, 1
+#endif
+},
+	{0x041C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 34
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_041C, 0x17, 0x1E, 0x30, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x357C, 0x17, 0x1E, 0x30, 1
+#endif
+},
+	{0x041D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 34
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_041D, 0x15, 0x1C, 0x2E, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3595, 0x15, 0x1C, 0x2E, 1
+#endif
+},
+	{0x041E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_041E, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x35AD, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x041F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_041F, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x35C4, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0420, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0420, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x35CE, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0421, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0421, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x35DC, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0422, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0422, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x35E5, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0423, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0423, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x35EF, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0424, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0424, 0x0C, 0x13, 0x25, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3602, 0x0C, 0x13, 0x25, 1
+#endif
+},
+	{0x0425, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0425, 0x16, 0x1D, 0x2F, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3622, 0x16, 0x1D, 0x2F, 1
+#endif
+},
+	{0x0426, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0426, 0x0C, 0x13, 0x25, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3646, 0x0C, 0x13, 0x25, 1
+#endif
+},
+	{0x0427, RDS_TMC_QUANTIFIER_TONNES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0427, 0x1E, 0x24, 0x27, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x367D, 0x1E, 0x24, 0x27, 1
+#endif
+},
+	{0x0428, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0428, 0x0B, 0x12, 0x24, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3691, 0x0B, 0x12, 0x24, 1
+#endif
+},
+	{0x0429, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0429, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x36B2, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x042A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 4
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_042A, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x36C2, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x042B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 13
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_042B, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x36DB, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x042C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 13
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_042C, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x36EA, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x042D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_042D, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x36FA, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x042E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_042E, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3707, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x042F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 34
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_042F, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3710, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0430, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 34
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0430, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3725, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0431, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0431, 0x30, 0x37, 0x49, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3730, 0x30, 0x37, 0x49, 1
+#endif
+},
+	{0x0432, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0432, 0x17, 0x1E, 0x30, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3758, 0x17, 0x1E, 0x30, 1
+#endif
+},
+	{0x0433, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0433, 0x25, 0x2C, 0x3E, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3771, 0x25, 0x2C, 0x3E, 1
+#endif
+},
+	{0x0437, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 15
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0437, 0x1C, 0x20, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3791, 0x1C, 0x20, 0x23, 1
+#endif
+},
+	{0x0438, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 15
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0438, 0x0D, 0x14, 0x17, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x37A7, 0x0D, 0x14, 0x17, 1
+#endif
+},
+	{0x0439, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 15
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0439, 0x0D, 0x11, 0x14, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x37B5, 0x0D, 0x11, 0x14, 1
+#endif
+},
+	{0x043A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 15
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_043A, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x37C3, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x043B, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 15
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_043B, 0x14, 0x15, 0x18, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x37D4, 0x14, 0x15, 0x18, 1
+#endif
+},
+	{0x043C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_043C, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x37E3, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x043D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_043D, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x37EC, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x043E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_043E, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x37F4, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0442, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0442, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3804, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x044D, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_044D, 0x0F, 0x10, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3814, 0x0F, 0x10, 0x13, 1
+#endif
+},
+	{0x044E, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_044E, 0x0F, 0x10, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x381F, 0x0F, 0x10, 0x13, 1
+#endif
+},
+	{0x044F, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_044F, 0x0F, 0x10, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x383A, 0x0F, 0x10, 0x13, 1
+#endif
+},
+	{0x0450, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0450, 0x09, 0x0A, 0x0D, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3855, 0x09, 0x0A, 0x0D, 1
+#endif
+},
+	{0x0451, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0451, 0x09, 0x0A, 0x0D, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x385D, 0x09, 0x0A, 0x0D, 1
+#endif
+},
+	{0x0452, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0452, 0x05, 0x1C, 0x1F, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3876, 0x05, 0x1C, 0x1F, 1
+#endif
+},
+	{0x0453, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0453, 0x06, 0x1D, 0x20, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3887, 0x06, 0x1D, 0x20, 1
+#endif
+},
+	{0x0454, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0454, 0x0E, 0x25, 0x28, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3898, 0x0E, 0x25, 0x28, 1
+#endif
+},
+	{0x0455, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0455, 0x0B, 0x0C, 0x0F, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x38AE, 0x0B, 0x0C, 0x0F, 1
+#endif
+},
+	{0x0456, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0456, 0x0B, 0x0C, 0x0F, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x38B6, 0x0B, 0x0C, 0x0F, 1
+#endif
+},
+	{0x0457, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0457, 0x0B, 0x0C, 0x0F, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x38CE, 0x0B, 0x0C, 0x0F, 1
+#endif
+},
+	{0x0458, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0458, 0x05, 0x06, 0x09, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x38E6, 0x05, 0x06, 0x09, 1
+#endif
+},
+	{0x0459, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0459, 0x05, 0x06, 0x09, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x38EB, 0x05, 0x06, 0x09, 1
+#endif
+},
+	{0x045A, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_045A, 0x08, 0x1F, 0x22, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3901, 0x08, 0x1F, 0x22, 1
+#endif
+},
+	{0x045B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 15
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_045B, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3914, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x045C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 15
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_045C, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x391B, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x045D, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_045D, 0x00, 0x01, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x391F, 0x00, 0x01, 0x13, 1
+#endif
+},
+	{0x045E, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_045E, 0x00, 0x01, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3934, 0x00, 0x01, 0x13, 1
+#endif
+},
+	{0x045F, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_045F, 0x00, 0x01, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3946, 0x00, 0x01, 0x13, 1
+#endif
+},
+	{0x0460, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0460, 0x00, 0x01, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3958, 0x00, 0x01, 0x13, 1
+#endif
+},
+	{0x0461, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0461, 0x00, 0x01, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x396B, 0x00, 0x01, 0x13, 1
+#endif
+},
+	{0x0462, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0462, 0x00, 0x01, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x397E, 0x00, 0x01, 0x13, 1
+#endif
+},
+	{0x0463, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0463, 0x00, 0x01, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3991, 0x00, 0x01, 0x13, 1
+#endif
+},
+	{0x0464, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0464, 0x00, 0x01, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x39A8, 0x00, 0x01, 0x13, 1
+#endif
+},
+	{0x0465, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0465, 0x17, 0x18, 0x2A, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x39BA, 0x17, 0x18, 0x2A, 1
+#endif
+},
+	{0x0466, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0466, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x39D8, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0467, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 15
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0467, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x39EA, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0468, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0468, 0x0D, 0x24, 0x27, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x39F5, 0x0D, 0x24, 0x27, 1
+#endif
+},
+	{0x0469, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 33
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0469, 0x00, 0x01, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3A0A, 0x00, 0x01, 0x13, 1
+#endif
+},
+	{0x046A, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_046A, 0x09, 0x20, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3A1A, 0x09, 0x20, 0x23, 1
+#endif
+},
+	{0x046B, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 33
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_046B, 0x00, 0x01, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3A2E, 0x00, 0x01, 0x13, 1
+#endif
+},
+	{0x046C, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_046C, 0x0E, 0x25, 0x28, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3A3D, 0x0E, 0x25, 0x28, 1
+#endif
+},
+	{0x046D, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 33
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_046D, 0x00, 0x01, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3A53, 0x00, 0x01, 0x13, 1
+#endif
+},
+	{0x046E, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_046E, 0x23, 0x27, 0x2A, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3A64, 0x23, 0x27, 0x2A, 1
+#endif
+},
+	{0x046F, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_046F, 0x1D, 0x21, 0x24, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3A7C, 0x1D, 0x21, 0x24, 1
+#endif
+},
+	{0x0470, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0470, 0x1F, 0x23, 0x26, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3A91, 0x1F, 0x23, 0x26, 1
+#endif
+},
+	{0x0471, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0471, 0x19, 0x1D, 0x20, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3AA5, 0x19, 0x1D, 0x20, 1
+#endif
+},
+	{0x0472, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 33
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0472, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3AB6, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0473, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 33
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0473, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3ACC, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0474, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 33
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0474, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3AD7, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0475, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 33
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0475, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3AEB, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0477, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 34
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0477, 0x17, 0x1E, 0x30, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3AFC, 0x17, 0x1E, 0x30, 1
+#endif
+},
+	{0x047F, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 33
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_047F, 0x00, 0x01, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3B15, 0x00, 0x01, 0x13, 1
+#endif
+},
+	{0x0480, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0480, 0x00, 0x01, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3B27, 0x00, 0x01, 0x13, 1
+#endif
+},
+	{0x0481, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0481, 0x00, 0x01, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3B36, 0x00, 0x01, 0x13, 1
+#endif
+},
+	{0x0482, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0482, 0x00, 0x01, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3B42, 0x00, 0x01, 0x13, 1
+#endif
+},
+	{0x0483, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0483, 0x00, 0x01, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3B4F, 0x00, 0x01, 0x13, 1
+#endif
+},
+	{0x0484, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0484, 0x00, 0x01, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3B60, 0x00, 0x01, 0x13, 1
+#endif
+},
+	{0x0485, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0485, 0x00, 0x01, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3B6E, 0x00, 0x01, 0x13, 1
+#endif
+},
+	{0x0486, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0486, 0x00, 0x01, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3B79, 0x00, 0x01, 0x13, 1
+#endif
+},
+	{0x0487, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0487, 0x00, 0x01, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3B88, 0x00, 0x01, 0x13, 1
+#endif
+},
+	{0x0488, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0488, 0x00, 0x01, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3B97, 0x00, 0x01, 0x13, 1
+#endif
+},
+	{0x048D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_048D, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3BA3, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x048E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_048E, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3BAF, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0492, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0492, 0x0F, 0x10, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3BBB, 0x0F, 0x10, 0x13, 1
+#endif
+},
+	{0x0493, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0493, 0x0B, 0x0C, 0x0F, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3BC7, 0x0B, 0x0C, 0x0F, 1
+#endif
+},
+	{0x0494, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0494, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3BD0, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0495, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0495, 0x09, 0x25, 0x28, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3BDE, 0x09, 0x25, 0x28, 1
+#endif
+},
+	{0x0496, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0496, 0x0E, 0x2A, 0x2D, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3BF6, 0x0E, 0x2A, 0x2D, 1
+#endif
+},
+	{0x0497, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0497, 0x13, 0x17, 0x1A, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3C10, 0x13, 0x17, 0x1A, 1
+#endif
+},
+	{0x0498, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0498, 0x16, 0x32, 0x35, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3C20, 0x16, 0x32, 0x35, 1
+#endif
+},
+	{0x0499, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0499, 0x0A, 0x26, 0x29, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3C45, 0x0A, 0x26, 0x29, 1
+#endif
+},
+	{0x049A, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_049A, 0x0B, 0x27, 0x2A, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3C5E, 0x0B, 0x27, 0x2A, 1
+#endif
+},
+	{0x049B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_049B, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3C79, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x049C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_049C, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3C88, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x04A6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 17
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_04A6, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3C9E, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x04A7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 17
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_04A7, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3CA7, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x04B1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 17
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_04B1, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3CB8, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x04B2, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 17
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_04B2, 0x16, 0x17, 0x1A, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3CC0, 0x16, 0x17, 0x1A, 1
+#endif
+},
+	{0x04B3, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 17
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_04B3, 0x06, 0x07, 0x0A, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3CD0, 0x06, 0x07, 0x0A, 1
+#endif
+},
+	{0x04B4, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 17
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_04B4, 0x12, 0x13, 0x16, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3CD6, 0x12, 0x13, 0x16, 1
+#endif
+},
+	{0x04B5, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 17
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_04B5, 0x0D, 0x0E, 0x11, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3CE3, 0x0D, 0x0E, 0x11, 1
+#endif
+},
+	{0x04B6, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 36
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_04B6, 0x0F, 0x10, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3CEE, 0x0F, 0x10, 0x13, 1
+#endif
+},
+	{0x04B7, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 36
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_04B7, 0x0C, 0x0D, 0x10, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3CFB, 0x0C, 0x0D, 0x10, 1
+#endif
+},
+	{0x04B8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 36
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_04B8, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3D05, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x04B9, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 17
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_04B9, 0x0C, 0x0D, 0x10, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3D10, 0x0C, 0x0D, 0x10, 1
+#endif
+},
+	{0x04BA, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 17
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_04BA, 0x0B, 0x0C, 0x0F, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3D1A, 0x0B, 0x0C, 0x0F, 1
+#endif
+},
+	{0x04BB, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 17
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_04BB, 0x0D, 0x0E, 0x11, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3D23, 0x0D, 0x0E, 0x11, 1
+#endif
+},
+	{0x04BC, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_04BC, 0x33, 0x34, 0x37, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3D3E, 0x33, 0x34, 0x37, 1
+#endif
+},
+	{0x04BD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 17
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_04BD, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3D59, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x04BE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 17
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_04BE, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3D67, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x04BF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, true, true, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_04BF, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3D72, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x04C0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 36
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_04C0, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3D89, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x04C1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 17
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_04C1, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3D9A, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x04C2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 36
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_04C2, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3DA7, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x04C3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 36
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_04C3, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3DB8, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x04E3, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 36
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_04E3, 0x00, 0x01, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3DC3, 0x00, 0x01, 0x13, 1
+#endif
+},
+	{0x04E4, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 36
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_04E4, 0x16, 0x17, 0x1A, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3DD3, 0x16, 0x17, 0x1A, 1
+#endif
+},
+	{0x04E5, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 36
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_04E5, 0x06, 0x07, 0x0A, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3DE3, 0x06, 0x07, 0x0A, 1
+#endif
+},
+	{0x04E6, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 36
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_04E6, 0x12, 0x13, 0x16, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3DE9, 0x12, 0x13, 0x16, 1
+#endif
+},
+	{0x04E7, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 36
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_04E7, 0x0D, 0x0E, 0x11, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3DF6, 0x0D, 0x0E, 0x11, 1
+#endif
+},
+	{0x04E8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 36
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_04E8, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3E01, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0514, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 33
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0514, 0x11, 0x28, 0x2B, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3E17, 0x11, 0x28, 0x2B, 1
+#endif
+},
+	{0x0515, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0515, 0x0A, 0x21, 0x24, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3E32, 0x0A, 0x21, 0x24, 1
+#endif
+},
+	{0x0516, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0516, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3E47, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0517, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0517, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3E5F, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0518, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0518, 0x04, 0x1B, 0x1E, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3E77, 0x04, 0x1B, 0x1E, 1
+#endif
+},
+	{0x0519, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0519, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3E88, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x051A, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_051A, 0x00, 0x01, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3E9D, 0x00, 0x01, 0x13, 1
+#endif
+},
+	{0x051B, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_051B, 0x0B, 0x22, 0x25, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3EA9, 0x0B, 0x22, 0x25, 1
+#endif
+},
+	{0x051C, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_051C, 0x0D, 0x24, 0x27, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3EC0, 0x0D, 0x24, 0x27, 1
+#endif
+},
+	{0x051D, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_051D, 0x0D, 0x24, 0x27, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3ED6, 0x0D, 0x24, 0x27, 1
+#endif
+},
+	{0x051E, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_051E, 0x0D, 0x24, 0x27, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3EEE, 0x0D, 0x24, 0x27, 1
+#endif
+},
+	{0x051F, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 35
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_051F, 0x00, 0x01, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3F02, 0x00, 0x01, 0x13, 1
+#endif
+},
+	{0x0520, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0520, 0x11, 0x28, 0x2B, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3F1B, 0x11, 0x28, 0x2B, 1
+#endif
+},
+	{0x0521, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0521, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3F34, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0522, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0522, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3F42, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0523, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 33
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0523, 0x00, 0x01, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3F4D, 0x00, 0x01, 0x13, 1
+#endif
+},
+	{0x0524, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0524, 0x00, 0x01, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3F5D, 0x00, 0x01, 0x13, 1
+#endif
+},
+	{0x0525, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 33
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0525, 0x00, 0x01, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3F6F, 0x00, 0x01, 0x13, 1
+#endif
+},
+	{0x0526, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0526, 0x13, 0x17, 0x1A, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3F80, 0x13, 0x17, 0x1A, 1
+#endif
+},
+	{0x0527, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0527, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3F8E, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0528, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0528, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3F9E, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0529, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0529, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3FAE, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x052A, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_052A, 0x0A, 0x21, 0x24, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3FBF, 0x0A, 0x21, 0x24, 1
+#endif
+},
+	{0x052B, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_052B, 0x0D, 0x24, 0x27, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3FD3, 0x0D, 0x24, 0x27, 1
+#endif
+},
+	{0x052C, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_052C, 0x0D, 0x24, 0x27, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3FE7, 0x0D, 0x24, 0x27, 1
+#endif
+},
+	{0x052D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_052D, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x3FFE, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x052E, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_052E, 0x0B, 0x22, 0x25, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4008, 0x0B, 0x22, 0x25, 1
+#endif
+},
+	{0x052F, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 33
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_052F, 0x00, 0x01, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x401C, 0x00, 0x01, 0x13, 1
+#endif
+},
+	{0x0530, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 35
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0530, 0x00, 0x01, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x402C, 0x00, 0x01, 0x13, 1
+#endif
+},
+	{0x0531, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 35
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0531, 0x00, 0x01, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4044, 0x00, 0x01, 0x13, 1
+#endif
+},
+	{0x0532, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 35
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0532, 0x00, 0x01, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x405B, 0x00, 0x01, 0x13, 1
+#endif
+},
+	{0x0533, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 35
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0533, 0x00, 0x01, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4072, 0x00, 0x01, 0x13, 1
+#endif
+},
+	{0x0534, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0534, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x408C, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0535, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 35
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0535, 0x00, 0x01, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4095, 0x00, 0x01, 0x13, 1
+#endif
+},
+	{0x0536, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 35
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0536, 0x00, 0x01, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x40A2, 0x00, 0x01, 0x13, 1
+#endif
+},
+	{0x0537, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 35
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0537, 0x00, 0x01, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x40BB, 0x00, 0x01, 0x13, 1
+#endif
+},
+	{0x0538, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 35
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0538, 0x00, 0x01, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x40D5, 0x00, 0x01, 0x13, 1
+#endif
+},
+	{0x0539, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0539, 0x0D, 0x24, 0x27, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x40EB, 0x0D, 0x24, 0x27, 1
+#endif
+},
+	{0x053A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_053A, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4109, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x053B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 35
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_053B, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x411D, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x053C, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_053C, 0x12, 0x29, 0x2C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x412C, 0x12, 0x29, 0x2C, 1
+#endif
+},
+	{0x0541, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0541, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4143, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0542, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 16
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0542, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x414C, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0547, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0547, 0x14, 0x18, 0x1B, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x415D, 0x14, 0x18, 0x1B, 1
+#endif
+},
+	{0x0548, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0548, 0x05, 0x1A, 0x1D, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x416F, 0x05, 0x1A, 0x1D, 1
+#endif
+},
+	{0x0549, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0549, 0x06, 0x1B, 0x1E, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4185, 0x06, 0x1B, 0x1E, 1
+#endif
+},
+	{0x054A, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_054A, 0x06, 0x1B, 0x1E, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x419B, 0x06, 0x1B, 0x1E, 1
+#endif
+},
+	{0x054B, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_054B, 0x06, 0x1B, 0x1E, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x41B1, 0x06, 0x1B, 0x1E, 1
+#endif
+},
+	{0x054C, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_054C, 0x06, 0x1B, 0x1E, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x41C8, 0x06, 0x1B, 0x1E, 1
+#endif
+},
+	{0x054D, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_054D, 0x0B, 0x20, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x41DF, 0x0B, 0x20, 0x23, 1
+#endif
+},
+	{0x054E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 37
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_054E, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x41F9, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x054F, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_054F, 0x13, 0x17, 0x1A, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4204, 0x13, 0x17, 0x1A, 1
+#endif
+},
+	{0x0550, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0550, 0x1C, 0x20, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4214, 0x1C, 0x20, 0x23, 1
+#endif
+},
+	{0x0551, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0551, 0x0C, 0x0D, 0x10, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x422A, 0x0C, 0x0D, 0x10, 1
+#endif
+},
+	{0x0552, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0552, 0x27, 0x28, 0x2B, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4234, 0x27, 0x28, 0x2B, 1
+#endif
+},
+	{0x0554, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0554, 0x0D, 0x14, 0x17, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4251, 0x0D, 0x14, 0x17, 1
+#endif
+},
+	{0x0555, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0555, 0x0D, 0x11, 0x14, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x425F, 0x0D, 0x11, 0x14, 1
+#endif
+},
+	{0x0579, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0579, 0x14, 0x18, 0x1B, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x426D, 0x14, 0x18, 0x1B, 1
+#endif
+},
+	{0x057A, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_057A, 0x0A, 0x1F, 0x22, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x427F, 0x0A, 0x1F, 0x22, 1
+#endif
+},
+	{0x057B, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_057B, 0x05, 0x1A, 0x1D, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4297, 0x05, 0x1A, 0x1D, 1
+#endif
+},
+	{0x057C, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_057C, 0x05, 0x1A, 0x1D, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x42AC, 0x05, 0x1A, 0x1D, 1
+#endif
+},
+	{0x057D, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_057D, 0x05, 0x1A, 0x1D, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x42C1, 0x05, 0x1A, 0x1D, 1
+#endif
+},
+	{0x057E, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_057E, 0x05, 0x1A, 0x1D, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x42D6, 0x05, 0x1A, 0x1D, 1
+#endif
+},
+	{0x057F, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_057F, 0x0A, 0x1F, 0x22, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x42EC, 0x0A, 0x1F, 0x22, 1
+#endif
+},
+	{0x0580, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0580, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4305, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05A9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05A9, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4317, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05AA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05AA, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x432A, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05AB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05AB, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x433A, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05AC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05AC, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x433F, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05AD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05AD, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4347, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05AE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05AE, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4353, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05AF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05AF, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x435A, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05B0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05B0, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4366, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05B1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05B1, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4370, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05B2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05B2, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x437B, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05B3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05B3, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4384, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05B4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05B4, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4390, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05B5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05B5, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x439C, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05B6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05B6, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x43A2, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05B7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05B7, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x43AA, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05B8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05B8, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x43B4, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05B9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05B9, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x43BF, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05BA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05BA, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x43CC, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05BB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05BB, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x43D9, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05BC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05BC, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x43E6, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05BD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05BD, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x43ED, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05BE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05BE, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x43F6, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05BF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 13
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05BF, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x43FE, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05C0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 13
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05C0, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4412, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05C1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 13
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05C1, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x441D, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05C2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 13
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05C2, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x442A, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05C3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05C3, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4436, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05C4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 19
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05C4, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x443B, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05C5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 19
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05C5, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4443, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05C6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 19
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05C6, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4450, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05C7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_XURGENT, false, true, true, 19
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05C7, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x445B, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05C8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 19
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05C8, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x446B, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05C9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_XURGENT, false, true, true, 19
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05C9, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4478, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05CA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 13
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05CA, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4483, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05CB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 13
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05CB, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4490, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05CC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 13
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05CC, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x449F, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05CD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05CD, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x44AD, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05CE, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05CE, 0x1A, 0x1B, 0x1E, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x44BA, 0x1A, 0x1B, 0x1E, 1
+#endif
+},
+	{0x05CF, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05CF, 0x1A, 0x1B, 0x1E, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x44C5, 0x1A, 0x1B, 0x1E, 1
+#endif
+},
+	{0x05D0, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05D0, 0x1F, 0x20, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x44D1, 0x1F, 0x20, 0x23, 1
+#endif
+},
+	{0x05D1, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05D1, 0x1A, 0x1B, 0x1E, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x44E0, 0x1A, 0x1B, 0x1E, 1
+#endif
+},
+	{0x05D2, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05D2, 0x1A, 0x1B, 0x1E, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x44F0, 0x1A, 0x1B, 0x1E, 1
+#endif
+},
+	{0x05D3, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05D3, 0x1F, 0x20, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4501, 0x1F, 0x20, 0x23, 1
+#endif
+},
+	{0x05D4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 19
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05D4, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4515, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05D5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05D5, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4523, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05D6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 19
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05D6, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x452F, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05D7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05D7, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4535, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05D8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05D8, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4540, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05D9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05D9, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x454F, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05DA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 13
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05DA, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4560, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05DB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 13
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05DB, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x456E, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05DC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_XURGENT, false, false, true, 19
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05DC, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x457F, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05DD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05DD, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4591, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05DE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05DE, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4598, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05DF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05DF, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x45A5, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05E0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05E0, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x45AA, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05E1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05E1, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x45B1, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05E2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05E2, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x45B8, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05E3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05E3, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x45BD, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05E4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05E4, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x45C3, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05E5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05E5, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x45CF, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05E6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05E6, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x45DB, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05E7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05E7, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x45E1, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05E8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05E8, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x45E6, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05E9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05E9, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x45EB, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05EA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05EA, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x45F3, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05EB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 19
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05EB, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4601, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05EC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 19
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05EC, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4609, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05ED, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05ED, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4612, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05EE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05EE, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x461C, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05EF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05EF, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4628, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05F0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05F0, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4632, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05F1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05F1, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x463E, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05F2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05F2, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4646, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05F3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05F3, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4650, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05F4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05F4, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x465C, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05F5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05F5, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x466A, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05F6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05F6, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x467B, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05F7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05F7, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x468D, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05F8, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05F8, 0x14, 0x15, 0x18, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4699, 0x14, 0x15, 0x18, 1
+#endif
+},
+	{0x05F9, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05F9, 0x14, 0x15, 0x18, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x46A3, 0x14, 0x15, 0x18, 1
+#endif
+},
+	{0x05FA, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05FA, 0x19, 0x1A, 0x1D, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x46AE, 0x19, 0x1A, 0x1D, 1
+#endif
+},
+	{0x05FB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05FB, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x46BC, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05FC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05FC, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x46C8, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05FD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05FD, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x46D6, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05FE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05FE, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x46E2, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x05FF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_05FF, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x46F0, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0600, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0600, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x46FA, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0601, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0601, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4706, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0602, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0602, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4714, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0603, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0603, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4724, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0604, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0604, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4737, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0605, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0605, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x474B, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0606, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0606, 0x17, 0x18, 0x1B, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4759, 0x17, 0x18, 0x1B, 1
+#endif
+},
+	{0x0607, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0607, 0x17, 0x18, 0x1B, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4765, 0x17, 0x18, 0x1B, 1
+#endif
+},
+	{0x0608, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0608, 0x1C, 0x1D, 0x20, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4772, 0x1C, 0x1D, 0x20, 1
+#endif
+},
+	{0x0609, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0609, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4782, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x060A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_060A, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x478A, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x060B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_060B, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4794, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x060C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_060C, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x479C, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x060D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_060D, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x47A6, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x060E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_060E, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x47AC, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x060F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_060F, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x47B4, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0610, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0610, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x47BE, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0611, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0611, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x47CA, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0612, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0612, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x47D9, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0613, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0613, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x47E9, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0614, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0614, 0x0D, 0x0E, 0x11, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x47F4, 0x0D, 0x0E, 0x11, 1
+#endif
+},
+	{0x0615, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0615, 0x0D, 0x0E, 0x11, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x47FC, 0x0D, 0x0E, 0x11, 1
+#endif
+},
+	{0x0616, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0616, 0x12, 0x13, 0x16, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4805, 0x12, 0x13, 0x16, 1
+#endif
+},
+	{0x0617, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0617, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4811, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0618, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0618, 0x0F, 0x10, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x481C, 0x0F, 0x10, 0x13, 1
+#endif
+},
+	{0x0619, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0619, 0x0F, 0x10, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4825, 0x0F, 0x10, 0x13, 1
+#endif
+},
+	{0x061A, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_061A, 0x14, 0x15, 0x18, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x482F, 0x14, 0x15, 0x18, 1
+#endif
+},
+	{0x061B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_061B, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x483C, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x061C, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_061C, 0x0F, 0x10, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4846, 0x0F, 0x10, 0x13, 1
+#endif
+},
+	{0x061D, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_061D, 0x0F, 0x10, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x484E, 0x0F, 0x10, 0x13, 1
+#endif
+},
+	{0x061E, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_061E, 0x14, 0x15, 0x18, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4857, 0x14, 0x15, 0x18, 1
+#endif
+},
+	{0x061F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_061F, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4863, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0620, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0620, 0x16, 0x17, 0x1A, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4870, 0x16, 0x17, 0x1A, 1
+#endif
+},
+	{0x0621, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0621, 0x16, 0x17, 0x1A, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x487B, 0x16, 0x17, 0x1A, 1
+#endif
+},
+	{0x0622, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0622, 0x1B, 0x1C, 0x1F, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4887, 0x1B, 0x1C, 0x1F, 1
+#endif
+},
+	{0x0623, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0623, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4896, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0624, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0624, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x48A1, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0625, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0625, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x48AE, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0626, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0626, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x48B9, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0627, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0627, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x48C6, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0628, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0628, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x48CF, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0629, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0629, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x48DA, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x062A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_062A, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x48E7, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x062B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_062B, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x48F6, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x062C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_062C, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4909, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x062D, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_062D, 0x17, 0x18, 0x1B, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4916, 0x17, 0x18, 0x1B, 1
+#endif
+},
+	{0x062E, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_062E, 0x17, 0x18, 0x1B, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4921, 0x17, 0x18, 0x1B, 1
+#endif
+},
+	{0x062F, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_062F, 0x1C, 0x1D, 0x20, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x492D, 0x1C, 0x1D, 0x20, 1
+#endif
+},
+	{0x0630, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0630, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x493C, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0631, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0631, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x494D, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0632, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0632, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4958, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0633, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 19
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0633, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x496A, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0634, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 19
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0634, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x497C, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0635, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0635, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x498F, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0636, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0636, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x499A, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0637, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0637, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x49A6, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0638, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0638, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x49C1, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0639, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0639, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x49CE, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x063A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_063A, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x49D8, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x063B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_063B, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x49E5, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x063C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_063C, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x49ED, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x063D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_063D, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x49F2, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0641, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0641, 0x07, 0x08, 0x0B, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x49FB, 0x07, 0x08, 0x0B, 1
+#endif
+},
+	{0x0642, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0642, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x49FF, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0643, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0643, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4A0E, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0644, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0644, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4A1D, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0645, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0645, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4A28, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0646, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0646, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4A36, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0647, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0647, 0x07, 0x08, 0x0B, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4A42, 0x07, 0x08, 0x0B, 1
+#endif
+},
+	{0x0648, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0648, 0x0C, 0x0D, 0x10, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4A47, 0x0C, 0x0D, 0x10, 1
+#endif
+},
+	{0x0649, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0649, 0x07, 0x08, 0x0B, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4A4E, 0x07, 0x08, 0x0B, 1
+#endif
+},
+	{0x064A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_064A, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4A58, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x064B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_064B, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4A75, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x064C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_064C, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4A92, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x064D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_064D, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4AAA, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x064E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_064E, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4AC6, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x064F, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, true, false, 21
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_064F, 0x12, 0x19, 0x1C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4AE0, 0x12, 0x19, 0x1C, 1
+#endif
+},
+	{0x0650, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 21
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0650, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4AF1, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0651, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 21
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0651, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4AFD, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0652, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 21
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0652, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4B0E, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0653, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 21
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0653, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4B25, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0654, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0654, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4B34, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0655, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0655, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4B3F, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0656, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0656, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4B4D, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0657, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0657, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4B5C, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0658, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0658, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4B6B, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0659, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0659, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4B7A, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x065A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_065A, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4B89, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x065B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_065B, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4B98, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x065C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_065C, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4BA7, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x065D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_065D, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4BB5, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x065E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_065E, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4BC4, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x065F, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_065F, 0x11, 0x12, 0x15, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4BD3, 0x11, 0x12, 0x15, 1
+#endif
+},
+	{0x0660, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0660, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4BDD, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0661, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 21
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0661, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4BEB, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0662, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 21
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0662, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4BFB, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0663, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 21
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0663, 0x24, 0x2B, 0x2E, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4C03, 0x24, 0x2B, 0x2E, 1
+#endif
+},
+	{0x0664, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 21
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0664, 0x2C, 0x33, 0x36, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4C1E, 0x2C, 0x33, 0x36, 1
+#endif
+},
+	{0x0665, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 21
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0665, 0x1E, 0x25, 0x28, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4C40, 0x1E, 0x25, 0x28, 1
+#endif
+},
+	{0x0666, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 21
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0666, 0x1C, 0x23, 0x26, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4C56, 0x1C, 0x23, 0x26, 1
+#endif
+},
+	{0x0667, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 21
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0667, 0x1B, 0x22, 0x25, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4C6B, 0x1B, 0x22, 0x25, 1
+#endif
+},
+	{0x0668, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 21
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0668, 0x1A, 0x21, 0x24, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4C80, 0x1A, 0x21, 0x24, 1
+#endif
+},
+	{0x0669, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 21
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0669, 0x1F, 0x26, 0x29, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4C96, 0x1F, 0x26, 0x29, 1
+#endif
+},
+	{0x066A, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_066A, 0x07, 0x08, 0x0B, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4CAF, 0x07, 0x08, 0x0B, 1
+#endif
+},
+	{0x066B, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_066B, 0x07, 0x08, 0x0B, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4CC0, 0x07, 0x08, 0x0B, 1
+#endif
+},
+	{0x066C, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 21
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_066C, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4CC9, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x066D, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 21
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_066D, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4CE7, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x066E, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, true, false, 22
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_066E, 0x0F, 0x10, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4CFD, 0x0F, 0x10, 0x13, 1
+#endif
+},
+	{0x066F, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, true, false, 22
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_066F, 0x0F, 0x10, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4D16, 0x0F, 0x10, 0x13, 1
+#endif
+},
+	{0x0670, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0670, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4D27, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0671, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 21
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0671, 0x24, 0x2B, 0x2E, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4D2E, 0x24, 0x2B, 0x2E, 1
+#endif
+},
+	{0x0672, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0672, 0x07, 0x08, 0x0B, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4D48, 0x07, 0x08, 0x0B, 1
+#endif
+},
+	{0x0673, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 21
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0673, 0x22, 0x29, 0x2C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4D52, 0x22, 0x29, 0x2C, 1
+#endif
+},
+	{0x0674, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 21
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0674, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4D6B, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0675, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0675, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4D74, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0676, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0676, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4D7B, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0677, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, true, false, 21
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0677, 0x1A, 0x21, 0x24, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4D85, 0x1A, 0x21, 0x24, 1
+#endif
+},
+	{0x0678, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, true, false, 22
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0678, 0x0D, 0x0E, 0x11, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4D9C, 0x0D, 0x0E, 0x11, 1
+#endif
+},
+	{0x0679, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 21
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0679, 0x20, 0x21, 0x24, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4DA6, 0x20, 0x21, 0x24, 1
+#endif
+},
+	{0x067A, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 21
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_067A, 0x1F, 0x20, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4DB9, 0x1F, 0x20, 0x23, 1
+#endif
+},
+	{0x067B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 21
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_067B, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4DCC, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x067C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 21
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_067C, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4DE1, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x067D, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 21
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_067D, 0x1C, 0x23, 0x26, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4DFC, 0x1C, 0x23, 0x26, 1
+#endif
+},
+	{0x067E, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 22
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_067E, 0x18, 0x19, 0x1C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4E11, 0x18, 0x19, 0x1C, 1
+#endif
+},
+	{0x067F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_067F, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4E24, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0680, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 18
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0680, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4E31, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0690, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, false, 38
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0690, 0x07, 0x08, 0x0B, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4E3E, 0x07, 0x08, 0x0B, 1
+#endif
+},
+	{0x0691, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 38
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0691, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4E49, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0692, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 38
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0692, 0x15, 0x16, 0x19, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4E5C, 0x15, 0x16, 0x19, 1
+#endif
+},
+	{0x0693, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, false, 38
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0693, 0x12, 0x13, 0x16, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4E6C, 0x12, 0x13, 0x16, 1
+#endif
+},
+	{0x0694, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 38
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0694, 0x11, 0x12, 0x15, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4E7A, 0x11, 0x12, 0x15, 1
+#endif
+},
+	{0x0695, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 38
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0695, 0x14, 0x15, 0x18, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4E8A, 0x14, 0x15, 0x18, 1
+#endif
+},
+	{0x0696, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 38
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0696, 0x0F, 0x10, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4E9B, 0x0F, 0x10, 0x13, 1
+#endif
+},
+	{0x0697, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 38
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0697, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4EAA, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0698, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 38
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0698, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4EC7, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0699, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 38
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0699, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4ED4, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x069A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 38
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_069A, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4EE4, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x069B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 38
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_069B, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4EF4, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x069F, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 22
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_069F, 0x12, 0x13, 0x16, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4EFF, 0x12, 0x13, 0x16, 1
+#endif
+},
+	{0x06A0, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 22
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06A0, 0x13, 0x14, 0x17, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4F0D, 0x13, 0x14, 0x17, 1
+#endif
+},
+	{0x06A4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06A4, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4F17, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x06A5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_XURGENT, false, true, true, 23
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06A5, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4F28, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x06A6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 23
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06A6, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4F3A, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x06A7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 23
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06A7, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4F4C, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x06A8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 23
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06A8, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4F57, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x06A9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 23
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06A9, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4F63, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x06AA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 23
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06AA, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4F75, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x06AB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_XURGENT, false, false, false, 23
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06AB, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4F80, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x06AC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_XURGENT, false, true, false, 23
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06AC, 0x11, 0x1C, 0x28, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4F93, 0x11, 0x1C, 0x28, 1
+#endif
+},
+	{0x06AD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06AD, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4FAB, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x06AE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 23
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06AE, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4FC0, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x06AF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 23
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06AF, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4FD3, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x06B0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 12
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06B0, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4FE6, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x06B8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 21
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06B8, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4FED, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x06B9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 21
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06B9, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x4FFD, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x06C3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 24
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06C3, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5016, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x06C4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 24
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06C4, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5024, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x06C5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 24
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06C5, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5030, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x06C6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 24
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06C6, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x503D, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x06C7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 24
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06C7, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5048, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x06C8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 23
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06C8, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5057, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x06C9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 24
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06C9, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5070, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x06CA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 24
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06CA, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x507B, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x06CB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 24
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06CB, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x508B, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x06CC, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06CC, 0x2B, 0x2C, 0x2F, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x509B, 0x2B, 0x2C, 0x2F, 1
+#endif
+},
+	{0x06CD, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06CD, 0x24, 0x25, 0x28, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x50AE, 0x24, 0x25, 0x28, 1
+#endif
+},
+	{0x06D7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 24
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06D7, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x50BD, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x06D8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 24
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06D8, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x50C7, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x06D9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 24
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06D9, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x50CF, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x06DA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 24
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06DA, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x50D8, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x06DB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 24
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06DB, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x50DF, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x06DC, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06DC, 0x16, 0x17, 0x1A, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x50E6, 0x16, 0x17, 0x1A, 1
+#endif
+},
+	{0x06DD, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06DD, 0x16, 0x17, 0x1A, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x50F1, 0x16, 0x17, 0x1A, 1
+#endif
+},
+	{0x06DE, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06DE, 0x1B, 0x1C, 0x1F, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x50FD, 0x1B, 0x1C, 0x1F, 1
+#endif
+},
+	{0x06DF, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06DF, 0x16, 0x17, 0x1A, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x510C, 0x16, 0x17, 0x1A, 1
+#endif
+},
+	{0x06E0, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06E0, 0x0F, 0x10, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5119, 0x0F, 0x10, 0x13, 1
+#endif
+},
+	{0x06E1, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06E1, 0x1B, 0x1C, 0x1F, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5122, 0x1B, 0x1C, 0x1F, 1
+#endif
+},
+	{0x06E2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 24
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06E2, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5132, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x06E3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 24
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06E3, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5145, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x06E4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 24
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06E4, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5150, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x06E5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 23
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06E5, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x515B, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x06E6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 24
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06E6, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5172, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x06E7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 24
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06E7, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x517E, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x06E8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 23
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06E8, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5191, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x06E9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 23
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06E9, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x51BF, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x06EA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 24
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06EA, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x51D3, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x06EB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 13
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06EB, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x51DC, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x06F4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, false, 39
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06F4, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x51E5, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x06F5, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, true, false, 39
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06F5, 0x1A, 0x21, 0x24, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x51F4, 0x1A, 0x21, 0x24, 1
+#endif
+},
+	{0x06F6, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, true, true, 39
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06F6, 0x2C, 0x33, 0x36, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x520B, 0x2C, 0x33, 0x36, 1
+#endif
+},
+	{0x06F7, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, true, true, 39
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06F7, 0x26, 0x2D, 0x30, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x522B, 0x26, 0x2D, 0x30, 1
+#endif
+},
+	{0x06F8, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, true, true, 39
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06F8, 0x24, 0x2B, 0x2E, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5246, 0x24, 0x2B, 0x2E, 1
+#endif
+},
+	{0x06F9, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, true, true, 39
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06F9, 0x2C, 0x33, 0x36, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5260, 0x2C, 0x33, 0x36, 1
+#endif
+},
+	{0x06FA, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, true, true, 39
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06FA, 0x2A, 0x31, 0x34, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x527F, 0x2A, 0x31, 0x34, 1
+#endif
+},
+	{0x06FB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 39
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06FB, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x529D, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x06FC, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, true, true, 39
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06FC, 0x24, 0x2B, 0x2E, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x52B5, 0x24, 0x2B, 0x2E, 1
+#endif
+},
+	{0x06FD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 39
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06FD, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x52CF, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x06FE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 39
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_06FE, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x52DA, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0709, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 25
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0709, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x52E5, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x070A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 25
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_070A, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x52F5, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x070B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 25
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_070B, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5309, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x070C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 25
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_070C, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5321, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x070D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 25
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_070D, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x532E, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x070E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 25
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_070E, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5340, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x070F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_070F, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x534D, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0710, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0710, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x535D, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0711, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0711, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x536F, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0712, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0712, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x537F, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0713, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0713, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5391, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0714, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0714, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x539F, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0715, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0715, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x53AF, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0716, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0716, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x53C1, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0717, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0717, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x53D5, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0718, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0718, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x53EC, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0719, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0719, 0x23, 0x24, 0x27, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5404, 0x23, 0x24, 0x27, 1
+#endif
+},
+	{0x071A, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_071A, 0x23, 0x24, 0x27, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5413, 0x23, 0x24, 0x27, 1
+#endif
+},
+	{0x071B, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_071B, 0x28, 0x29, 0x2C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5423, 0x28, 0x29, 0x2C, 1
+#endif
+},
+	{0x071C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_071C, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5436, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x071D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_071D, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5446, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x071E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_071E, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5458, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x071F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_071F, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5468, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0720, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0720, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x547A, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0721, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0721, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5488, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0722, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0722, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5498, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0723, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0723, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x54AA, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0724, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0724, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x54BE, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0725, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0725, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x54D5, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0726, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0726, 0x1F, 0x20, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x54ED, 0x1F, 0x20, 0x23, 1
+#endif
+},
+	{0x0727, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0727, 0x1F, 0x20, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x54FD, 0x1F, 0x20, 0x23, 1
+#endif
+},
+	{0x0728, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0728, 0x24, 0x25, 0x28, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x550E, 0x24, 0x25, 0x28, 1
+#endif
+},
+	{0x0729, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 25
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0729, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5522, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x072A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 25
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_072A, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5534, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x072B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 25
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_072B, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x554A, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x072C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 25
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_072C, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5559, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x072D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 25
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_072D, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x556C, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x072E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 25
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_072E, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5577, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x072F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 25
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_072F, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x558C, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0730, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 25
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0730, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x559D, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0731, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 25
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0731, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x55B1, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0732, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 25
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0732, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x55CA, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0733, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 25
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0733, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x55DF, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0734, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 25
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0734, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x55F4, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0735, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 25
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0735, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x560E, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0736, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 25
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0736, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5622, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0737, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 25
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0737, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x563B, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0738, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 25
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0738, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5654, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0739, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 25
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0739, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5666, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x073A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 25
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_073A, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5676, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x073B, RDS_TMC_QUANTIFIER_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 26
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_073B, 0x16, 0x17, 0x1A, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5688, 0x16, 0x17, 0x1A, 1
+#endif
+},
+	{0x073C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 26
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_073C, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x569A, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x073E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_073E, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x56AF, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x073F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_073F, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x56C4, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0740, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0740, 0x21, 0x28, 0x2B, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x56DD, 0x21, 0x28, 0x2B, 1
+#endif
+},
+	{0x0741, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 26
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0741, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x56F5, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0742, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0742, 0x13, 0x14, 0x17, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5700, 0x13, 0x14, 0x17, 1
+#endif
+},
+	{0x0745, RDS_TMC_QUANTIFIER_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 26
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0745, 0x17, 0x18, 0x1B, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x570C, 0x17, 0x18, 0x1B, 1
+#endif
+},
+	{0x0746, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 26
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0746, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x571F, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0747, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 25
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0747, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5735, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0748, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 25
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0748, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x574A, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0749, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 25
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0749, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5761, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x074A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 25
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_074A, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x578F, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x074B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 25
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_074B, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x57C1, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x074C, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_074C, 0x2B, 0x2C, 0x2F, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x57D0, 0x2B, 0x2C, 0x2F, 1
+#endif
+},
+	{0x074D, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_074D, 0x2B, 0x2C, 0x2F, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x57E4, 0x2B, 0x2C, 0x2F, 1
+#endif
+},
+	{0x074E, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_074E, 0x30, 0x31, 0x34, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x57F9, 0x30, 0x31, 0x34, 1
+#endif
+},
+	{0x074F, RDS_TMC_QUANTIFIER_TONNES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 26
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_074F, 0x1A, 0x1B, 0x1E, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5811, 0x1A, 0x1B, 0x1E, 1
+#endif
+},
+	{0x0750, RDS_TMC_QUANTIFIER_TONNES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 26
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0750, 0x1D, 0x1E, 0x21, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5826, 0x1D, 0x1E, 0x21, 1
+#endif
+},
+	{0x0751, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 26
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0751, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x583E, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0752, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 26
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0752, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5859, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0753, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 25
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0753, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5874, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0754, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0754, 0x2D, 0x2E, 0x31, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5888, 0x2D, 0x2E, 0x31, 1
+#endif
+},
+	{0x0755, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0755, 0x2D, 0x2E, 0x31, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x589D, 0x2D, 0x2E, 0x31, 1
+#endif
+},
+	{0x0756, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0756, 0x32, 0x33, 0x36, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x58B3, 0x32, 0x33, 0x36, 1
+#endif
+},
+	{0x0757, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 25
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0757, 0x00, 0x01, 0x0C, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x58CC, 0x00, 0x01, 0x0C, 1
+#endif
+},
+	{0x0758, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0758, 0x34, 0x35, 0x38, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x58E2, 0x34, 0x35, 0x38, 1
+#endif
+},
+	{0x0759, RDS_TMC_QUANTIFIER_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 26
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0759, 0x17, 0x18, 0x1B, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x58FE, 0x17, 0x18, 0x1B, 1
+#endif
+},
+	{0x075A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 26
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_075A, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5911, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x075B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 27
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_075B, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5927, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x075C, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_075C, 0x34, 0x35, 0x38, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5932, 0x34, 0x35, 0x38, 1
+#endif
+},
+	{0x075D, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_075D, 0x39, 0x3A, 0x3D, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x594F, 0x39, 0x3A, 0x3D, 1
+#endif
+},
+	{0x075E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 27
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_075E, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x596F, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x075F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 27
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_075F, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5982, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0760, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0760, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5998, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0761, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0761, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x59A0, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0762, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0762, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x59A8, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0763, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0763, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x59B0, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0764, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0764, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x59B8, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0765, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0765, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x59C0, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0766, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0766, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x59C8, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0767, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0767, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x59D0, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0768, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0768, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x59D8, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0769, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0769, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x59E0, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x076A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_076A, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x59F9, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x076B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_076B, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5A12, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x076C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_076C, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5A2B, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x076D, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, true, false, 22
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_076D, 0x0F, 0x10, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5A44, 0x0F, 0x10, 0x13, 1
+#endif
+},
+	{0x076E, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, true, false, 22
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_076E, 0x0F, 0x10, 0x13, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5A50, 0x0F, 0x10, 0x13, 1
+#endif
+},
+	{0x076F, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 28
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_076F, 0x09, 0x0A, 0x0D, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5A62, 0x09, 0x0A, 0x0D, 1
+#endif
+},
+	{0x0770, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 28
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0770, 0x0E, 0x0F, 0x12, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5A6E, 0x0E, 0x0F, 0x12, 1
+#endif
+},
+	{0x0771, RDS_TMC_QUANTIFIER_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0771, 0x0A, 0x0B, 0x0E, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5A7C, 0x0A, 0x0B, 0x0E, 1
+#endif
+},
+	{0x0772, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 21
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0772, 0x20, 0x27, 0x2A, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5A95, 0x20, 0x27, 0x2A, 1
+#endif
+},
+	{0x0773, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 31
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0773, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5AAE, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0774, RDS_TMC_QUANTIFIER_MHZ, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 29
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0774, 0x16, 0x1A, 0x1D, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5AB8, 0x16, 0x1A, 0x1D, 1
+#endif
+},
+	{0x0775, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, true, false, 29
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0775, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5ACB, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0776, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, true, true, false, 29
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0776, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5B05, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0777, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 29
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0777, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5B3C, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0779, RDS_TMC_QUANTIFIER_KHZ, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 29
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0779, 0x16, 0x1A, 0x1D, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5B47, 0x16, 0x1A, 0x1D, 1
+#endif
+},
+	{0x077A, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 30
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_077A, 0x19, 0x20, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5B5A, 0x19, 0x20, 0x23, 1
+#endif
+},
+	{0x077B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 31
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_077B, 0x27, 0x2F, 0x32, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5B6E, 0x27, 0x2F, 0x32, 1
+#endif
+},
+	{0x077C, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 30
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_077C, 0x19, 0x20, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5B9B, 0x19, 0x20, 0x23, 1
+#endif
+},
+	{0x077D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 25
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_077D, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5BC1, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x077E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 28
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_077E, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5BE2, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0780, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0780, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5BE7, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0781, RDS_TMC_QUANTIFIER_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0781, 0x00, 0x01, 0x04, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5BFE, 0x00, 0x01, 0x04, 1
+#endif
+},
+	{0x0782, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, true, 28
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0782, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5C0E, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0783, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 28
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0783, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5C1E, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0784, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 28
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0784, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5C32, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0785, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0785, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5C45, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0786, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 28
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0786, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5C65, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0787, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 27
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0787, 0x0B, 0x12, 0x15, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5C76, 0x0B, 0x12, 0x15, 1
+#endif
+},
+	{0x0788, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 27
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0788, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5C82, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0789, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, true, true, 29
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0789, 0x21, 0x25, 0x28, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5C97, 0x21, 0x25, 0x28, 1
+#endif
+},
+	{0x078A, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 30
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_078A, 0x1F, 0x26, 0x29, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5CC4, 0x1F, 0x26, 0x29, 1
+#endif
+},
+	{0x078B, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, true, true, 29
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_078B, 0x23, 0x27, 0x2A, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5CDE, 0x23, 0x27, 0x2A, 1
+#endif
+},
+	{0x078C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 30
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_078C, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5D0D, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x078E, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_078E, 0x27, 0x2E, 0x31, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5D30, 0x27, 0x2E, 0x31, 1
+#endif
+},
+	{0x0792, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0792, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5D4E, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0793, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 30
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0793, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5D68, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0794, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 30
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0794, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5D83, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0795, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 30
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0795, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5DAC, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0796, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 30
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0796, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5DD3, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0797, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 30
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0797, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5E02, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0798, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 30
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0798, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5E24, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x0799, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 30
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_0799, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5E3D, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x079A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 30
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_079A, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5E5A, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x079B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 30
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_079B, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5E75, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x079C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 30
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_079C, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5E98, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x079D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 30
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_079D, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5EB9, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x079E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 30
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_079E, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5ED8, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x079F, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 30
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_079F, 0x25, 0x2C, 0x2F, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5EED, 0x25, 0x2C, 0x2F, 1
+#endif
+},
+	{0x07A0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 30
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07A0, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5F06, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07A1, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 30
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07A1, 0x24, 0x28, 0x2B, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5F20, 0x24, 0x28, 0x2B, 1
+#endif
+},
+	{0x07A2, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, true, true, 30
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07A2, 0x1F, 0x23, 0x26, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5F3D, 0x1F, 0x23, 0x26, 1
+#endif
+},
+	{0x07A3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 29
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07A3, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5F56, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07A4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 30
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07A4, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5F73, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07A5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 30
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07A5, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5F91, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07A9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07A9, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5FBF, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07AA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 10
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07AA, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5FDB, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07AB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 10
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07AB, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x5FEF, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07AC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 30
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07AC, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x6006, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07AD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 30
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07AD, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x601B, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07AE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 30
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07AE, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x602E, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07AF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 30
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07AF, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x6049, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07B3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07B3, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x6062, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07B4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07B4, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x606D, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07B5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07B5, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x607F, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07B6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07B6, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x6094, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07B7, RDS_TMC_QUANTIFIER_TONNES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07B7, 0x29, 0x2F, 0x32, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x60A6, 0x29, 0x2F, 0x32, 1
+#endif
+},
+	{0x07B8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07B8, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x60BE, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07B9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07B9, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x60CC, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07BA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07BA, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x60E9, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07BB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07BB, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x60FE, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07BC, RDS_TMC_QUANTIFIER_TONNES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07BC, 0x28, 0x2E, 0x31, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x6116, 0x28, 0x2E, 0x31, 1
+#endif
+},
+	{0x07BD, RDS_TMC_QUANTIFIER_TONNES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07BD, 0x19, 0x1F, 0x22, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x6131, 0x19, 0x1F, 0x22, 1
+#endif
+},
+	{0x07BE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 6
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07BE, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x6161, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07BF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 25
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07BF, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x6169, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07C1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07C1, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x6173, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07C2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07C2, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x6184, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07C6, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07C6, 0x10, 0x17, 0x1A, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x619E, 0x10, 0x17, 0x1A, 1
+#endif
+},
+	{0x07C7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 13
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07C7, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x61AC, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07C9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 28
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07C9, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x61BC, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07CA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 28
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07CA, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x61D3, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07CB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 28
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07CB, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x61E7, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07CE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 7
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07CE, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x61FD, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07CF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 8
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07CF, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x6213, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07D0, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, true, true, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07D0, 0x19, 0x20, 0x23, 1
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x6229, 0x19, 0x20, 0x23, 1
+#endif
+},
+	{0x07D6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 10
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07D6, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x623C, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07D7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 10
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07D7, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x6255, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07DD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07DD, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x6269, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07E5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 21
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07E5, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x6276, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07E6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 21
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07E6, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x6296, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07EC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 4
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07EC, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x62A7, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07ED, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 10
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07ED, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x62B2, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07EE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 13
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07EE, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x62BD, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07F0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 35
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07F0, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x62C8, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07F1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 19
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07F1, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x62D3, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07F2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 21
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07F2, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x62DE, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07F3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 22
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07F3, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x62E9, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07F6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 28
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07F6, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x62F4, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07F7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 30
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07F7, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x62FF, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07F8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 31
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07F8, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x630A, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07F9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, true, true, 31
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07F9, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x6315, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07FA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 13
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07FA, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x631F, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07FB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07FB, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x6336, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07FC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07FC, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x633D, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07FD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07FD, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x634C, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07FE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 9
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07FE, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x6357, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+	{0x07FF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, true, true, 31
+#if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
+, Event_S_07FF, 0xFF, 0xFF, 0x00, 0
+#elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
+, (const char * const) 0x6373, 0xFF, 0xFF, 0x00, 0
+#endif
+},
+};
+
+#endif
+#endif
\ No newline at end of file
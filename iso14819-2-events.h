@@ -1565,10866 +1565,10866 @@ const char Event_S_07FF[] PROGMEM = "(null message)";
 const TRDSTMCEventListEntry ISO14819_2_Events[1552] PROGMEM = {
 	{0x0001, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0001
+, Event_S_0001, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0000
+, (const char * const) 0x0000, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0002, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0002
+, Event_S_0002, 0x10, 0x25, 0x28, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0010
+, (const char * const) 0x0010, 0x10, 0x25, 0x28, 1
 #endif
 },
 	{0x000B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 4
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_000B
+, Event_S_000B, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0057
+, (const char * const) 0x0057, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x000C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 3
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_000C
+, Event_S_000C, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x007B
+, (const char * const) 0x007B, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0010, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0010
+, Event_S_0010, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x00B9
+, (const char * const) 0x00B9, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0014, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0014
+, Event_S_0014, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x00E6
+, (const char * const) 0x00E6, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0016, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0016
+, Event_S_0016, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x011E
+, (const char * const) 0x011E, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0017, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0017
+, Event_S_0017, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0140
+, (const char * const) 0x0140, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0018, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0018
+, Event_S_0018, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0160
+, (const char * const) 0x0160, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0019, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0019
+, Event_S_0019, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x016E
+, (const char * const) 0x016E, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x001A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 6
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_001A
+, Event_S_001A, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x017C
+, (const char * const) 0x017C, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x001B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 6
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_001B
+, Event_S_001B, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x018B
+, (const char * const) 0x018B, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x001C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_001C
+, Event_S_001C, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x019A
+, (const char * const) 0x019A, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0024, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0024
+, Event_S_0024, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x01B5
+, (const char * const) 0x01B5, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0025, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0025
+, Event_S_0025, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x01CB
+, (const char * const) 0x01CB, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0027, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 39
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0027
+, Event_S_0027, 0x1D, 0x1E, 0x21, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x01DF
+, (const char * const) 0x01DF, 0x1D, 0x1E, 0x21, 1
 #endif
 },
 	{0x0028, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0028
+, Event_S_0028, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0201
+, (const char * const) 0x0201, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0029, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0029
+, Event_S_0029, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0212
+, (const char * const) 0x0212, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x002A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_002A
+, Event_S_002A, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0231
+, (const char * const) 0x0231, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0033, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0033
+, Event_S_0033, 0x0B, 0x0C, 0x0F, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0251
+, (const char * const) 0x0251, 0x0B, 0x0C, 0x0F, 1
 #endif
 },
 	{0x0034, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0034
+, Event_S_0034, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x027B
+, (const char * const) 0x027B, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0035, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0035
+, Event_S_0035, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x02A7
+, (const char * const) 0x02A7, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0037, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0037
+, Event_S_0037, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x02D4
+, (const char * const) 0x02D4, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0038, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0038
+, Event_S_0038, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x02ED
+, (const char * const) 0x02ED, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0039, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0039
+, Event_S_0039, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0309
+, (const char * const) 0x0309, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x003D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_003D
+, Event_S_003D, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0321
+, (const char * const) 0x0321, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x003E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_003E
+, Event_S_003E, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x033B
+, (const char * const) 0x033B, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x003F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_003F
+, Event_S_003F, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x034E
+, (const char * const) 0x034E, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0040, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0040
+, Event_S_0040, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0371
+, (const char * const) 0x0371, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0046, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0046
+, Event_S_0046, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0384
+, (const char * const) 0x0384, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0047, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0047
+, Event_S_0047, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x03B1
+, (const char * const) 0x03B1, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0048, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0048
+, Event_S_0048, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x03DE
+, (const char * const) 0x03DE, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0049, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0049
+, Event_S_0049, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x040B
+, (const char * const) 0x040B, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x004A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_004A
+, Event_S_004A, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0438
+, (const char * const) 0x0438, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x004B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_004B
+, Event_S_004B, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0465
+, (const char * const) 0x0465, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x004C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_004C
+, Event_S_004C, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0492
+, (const char * const) 0x0492, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0050, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, false, 32
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0050
+, Event_S_0050, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x04BF
+, (const char * const) 0x04BF, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0051, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 32
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0051
+, Event_S_0051, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x04E0
+, (const char * const) 0x04E0, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0052, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, false, 32
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0052
+, Event_S_0052, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0506
+, (const char * const) 0x0506, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0053, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 32
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0053
+, Event_S_0053, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x053F
+, (const char * const) 0x053F, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0054, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, false, 32
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0054
+, Event_S_0054, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0564
+, (const char * const) 0x0564, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0055, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, false, 32
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0055
+, Event_S_0055, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0592
+, (const char * const) 0x0592, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0056, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, false, 32
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0056
+, Event_S_0056, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x05C3
+, (const char * const) 0x05C3, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0057, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, false, 32
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0057
+, Event_S_0057, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x05EA
+, (const char * const) 0x05EA, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0058, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, false, 32
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0058
+, Event_S_0058, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0617
+, (const char * const) 0x0617, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0059, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 32
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0059
+, Event_S_0059, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x063D
+, (const char * const) 0x063D, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x005B, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_005B
+, Event_S_005B, 0x07, 0x08, 0x0B, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x064F
+, (const char * const) 0x064F, 0x07, 0x08, 0x0B, 1
 #endif
 },
 	{0x0065, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0065
+, Event_S_0065, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0664
+, (const char * const) 0x0664, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0066, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0066
+, Event_S_0066, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0677
+, (const char * const) 0x0677, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0067, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0067
+, Event_S_0067, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0693
+, (const char * const) 0x0693, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0068, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0068
+, Event_S_0068, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x06AF
+, (const char * const) 0x06AF, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0069, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0069
+, Event_S_0069, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x06CB
+, (const char * const) 0x06CB, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x006A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_006A
+, Event_S_006A, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x06E7
+, (const char * const) 0x06E7, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x006B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_006B
+, Event_S_006B, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0704
+, (const char * const) 0x0704, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x006C, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_006C
+, Event_S_006C, 0x10, 0x25, 0x28, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0720
+, (const char * const) 0x0720, 0x10, 0x25, 0x28, 1
 #endif
 },
 	{0x006D, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_006D
+, Event_S_006D, 0x19, 0x2E, 0x31, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0749
+, (const char * const) 0x0749, 0x19, 0x2E, 0x31, 1
 #endif
 },
 	{0x006E, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_006E
+, Event_S_006E, 0x19, 0x2E, 0x31, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x077B
+, (const char * const) 0x077B, 0x19, 0x2E, 0x31, 1
 #endif
 },
 	{0x006F, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_006F
+, Event_S_006F, 0x19, 0x2E, 0x31, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x07AD
+, (const char * const) 0x07AD, 0x19, 0x2E, 0x31, 1
 #endif
 },
 	{0x0070, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0070
+, Event_S_0070, 0x19, 0x2E, 0x31, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x07DF
+, (const char * const) 0x07DF, 0x19, 0x2E, 0x31, 1
 #endif
 },
 	{0x0071, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0071
+, Event_S_0071, 0x1A, 0x2F, 0x32, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0811
+, (const char * const) 0x0811, 0x1A, 0x2F, 0x32, 1
 #endif
 },
 	{0x0072, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0072
+, Event_S_0072, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0844
+, (const char * const) 0x0844, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0073, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0073
+, Event_S_0073, 0x0D, 0x22, 0x25, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x085D
+, (const char * const) 0x085D, 0x0D, 0x22, 0x25, 1
 #endif
 },
 	{0x0074, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0074
+, Event_S_0074, 0x16, 0x2B, 0x2E, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0883
+, (const char * const) 0x0883, 0x16, 0x2B, 0x2E, 1
 #endif
 },
 	{0x0075, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0075
+, Event_S_0075, 0x16, 0x2B, 0x2E, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x08B2
+, (const char * const) 0x08B2, 0x16, 0x2B, 0x2E, 1
 #endif
 },
 	{0x0076, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0076
+, Event_S_0076, 0x16, 0x2B, 0x2E, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x08E1
+, (const char * const) 0x08E1, 0x16, 0x2B, 0x2E, 1
 #endif
 },
 	{0x0077, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0077
+, Event_S_0077, 0x16, 0x2B, 0x2E, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0910
+, (const char * const) 0x0910, 0x16, 0x2B, 0x2E, 1
 #endif
 },
 	{0x0078, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0078
+, Event_S_0078, 0x17, 0x2C, 0x2F, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x093F
+, (const char * const) 0x093F, 0x17, 0x2C, 0x2F, 1
 #endif
 },
 	{0x0079, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0079
+, Event_S_0079, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x096F
+, (const char * const) 0x096F, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x007A, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_007A
+, Event_S_007A, 0x0E, 0x23, 0x26, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0985
+, (const char * const) 0x0985, 0x0E, 0x23, 0x26, 1
 #endif
 },
 	{0x007B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_007B
+, Event_S_007B, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x09AC
+, (const char * const) 0x09AC, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x007C, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_007C
+, Event_S_007C, 0x17, 0x2C, 0x2F, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x09C3
+, (const char * const) 0x09C3, 0x17, 0x2C, 0x2F, 1
 #endif
 },
 	{0x007D, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_007D
+, Event_S_007D, 0x14, 0x29, 0x2C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x09F3
+, (const char * const) 0x09F3, 0x14, 0x29, 0x2C, 1
 #endif
 },
 	{0x007E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_007E
+, Event_S_007E, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0A20
+, (const char * const) 0x0A20, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x007F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_007F
+, Event_S_007F, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0A36
+, (const char * const) 0x0A36, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0080, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0080
+, Event_S_0080, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0A51
+, (const char * const) 0x0A51, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0081, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0081
+, Event_S_0081, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0A63
+, (const char * const) 0x0A63, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0082, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0082
+, Event_S_0082, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0A7F
+, (const char * const) 0x0A7F, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0083, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0083
+, Event_S_0083, 0x19, 0x2E, 0x31, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0A9C
+, (const char * const) 0x0A9C, 0x19, 0x2E, 0x31, 1
 #endif
 },
 	{0x0084, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0084
+, Event_S_0084, 0x1A, 0x2F, 0x32, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0ACE
+, (const char * const) 0x0ACE, 0x1A, 0x2F, 0x32, 1
 #endif
 },
 	{0x0085, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0085
+, Event_S_0085, 0x0C, 0x21, 0x24, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0B01
+, (const char * const) 0x0B01, 0x0C, 0x21, 0x24, 1
 #endif
 },
 	{0x0086, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0086
+, Event_S_0086, 0x16, 0x2B, 0x2E, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0B26
+, (const char * const) 0x0B26, 0x16, 0x2B, 0x2E, 1
 #endif
 },
 	{0x0087, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0087
+, Event_S_0087, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0B55
+, (const char * const) 0x0B55, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0088, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0088
+, Event_S_0088, 0x13, 0x28, 0x2B, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0B64
+, (const char * const) 0x0B64, 0x13, 0x28, 0x2B, 1
 #endif
 },
 	{0x0089, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0089
+, Event_S_0089, 0x1C, 0x31, 0x34, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0B90
+, (const char * const) 0x0B90, 0x1C, 0x31, 0x34, 1
 #endif
 },
 	{0x008A, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_008A
+, Event_S_008A, 0x10, 0x25, 0x28, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0BC5
+, (const char * const) 0x0BC5, 0x10, 0x25, 0x28, 1
 #endif
 },
 	{0x008B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_008B
+, Event_S_008B, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0C02
+, (const char * const) 0x0C02, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x008C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_008C
+, Event_S_008C, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0C2C
+, (const char * const) 0x0C2C, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x008D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 3
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_008D
+, Event_S_008D, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0C55
+, (const char * const) 0x0C55, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x008E, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_008E
+, Event_S_008E, 0x1C, 0x31, 0x34, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0C82
+, (const char * const) 0x0C82, 0x1C, 0x31, 0x34, 1
 #endif
 },
 	{0x008F, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_008F
+, Event_S_008F, 0x26, 0x3B, 0x3E, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0CB7
+, (const char * const) 0x0CB7, 0x26, 0x3B, 0x3E, 1
 #endif
 },
 	{0x00C8, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00C8
+, Event_S_00C8, 0x1E, 0x1F, 0x22, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0CF6
+, (const char * const) 0x0CF6, 0x1E, 0x1F, 0x22, 1
 #endif
 },
 	{0x00C9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 3
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00C9
+, Event_S_00C9, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0D19
+, (const char * const) 0x0D19, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00CA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00CA
+, Event_S_00CA, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0D2A
+, (const char * const) 0x0D2A, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00CB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00CB
+, Event_S_00CB, 0x17, 0x22, 0x2E, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0D43
+, (const char * const) 0x0D43, 0x17, 0x22, 0x2E, 1
 #endif
 },
 	{0x00CC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00CC
+, Event_S_00CC, 0x13, 0x16, 0x19, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0D72
+, (const char * const) 0x0D72, 0x13, 0x16, 0x19, 1
 #endif
 },
 	{0x00CD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00CD
+, Event_S_00CD, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0D9E
+, (const char * const) 0x0D9E, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00CE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00CE
+, Event_S_00CE, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0DCD
+, (const char * const) 0x0DCD, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00CF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00CF
+, Event_S_00CF, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0DEC
+, (const char * const) 0x0DEC, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00D0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00D0
+, Event_S_00D0, 0x1C, 0x1D, 0x20, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0E0F
+, (const char * const) 0x0E0F, 0x1C, 0x1D, 0x20, 1
 #endif
 },
 	{0x00D1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 3
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00D1
+, Event_S_00D1, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0E3C
+, (const char * const) 0x0E3C, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00D2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00D2
+, Event_S_00D2, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0E63
+, (const char * const) 0x0E63, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00D3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 4
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00D3
+, Event_S_00D3, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0E75
+, (const char * const) 0x0E75, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00D4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 4
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00D4
+, Event_S_00D4, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0E91
+, (const char * const) 0x0E91, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00D5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 3
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00D5
+, Event_S_00D5, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0EB4
+, (const char * const) 0x0EB4, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00D6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 4
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00D6
+, Event_S_00D6, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0EC9
+, (const char * const) 0x0EC9, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00D7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00D7
+, Event_S_00D7, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0EDA
+, (const char * const) 0x0EDA, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00D8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00D8
+, Event_S_00D8, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0EFF
+, (const char * const) 0x0EFF, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00D9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00D9
+, Event_S_00D9, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0F2D
+, (const char * const) 0x0F2D, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00DA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00DA
+, Event_S_00DA, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0F5B
+, (const char * const) 0x0F5B, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00DB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00DB
+, Event_S_00DB, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0F89
+, (const char * const) 0x0F89, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00DC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00DC
+, Event_S_00DC, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0FB7
+, (const char * const) 0x0FB7, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00DD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00DD
+, Event_S_00DD, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x0FE6
+, (const char * const) 0x0FE6, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00DE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00DE
+, Event_S_00DE, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1015
+, (const char * const) 0x1015, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00DF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00DF
+, Event_S_00DF, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1037
+, (const char * const) 0x1037, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00E0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00E0
+, Event_S_00E0, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1062
+, (const char * const) 0x1062, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00E1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00E1
+, Event_S_00E1, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x108D
+, (const char * const) 0x108D, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00E2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00E2
+, Event_S_00E2, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x10B8
+, (const char * const) 0x10B8, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00E3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00E3
+, Event_S_00E3, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x10E3
+, (const char * const) 0x10E3, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00E4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00E4
+, Event_S_00E4, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x110F
+, (const char * const) 0x110F, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00E5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00E5
+, Event_S_00E5, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x113B
+, (const char * const) 0x113B, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00E6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00E6
+, Event_S_00E6, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x115A
+, (const char * const) 0x115A, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00E7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00E7
+, Event_S_00E7, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1182
+, (const char * const) 0x1182, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00E8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00E8
+, Event_S_00E8, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x11AA
+, (const char * const) 0x11AA, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00E9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00E9
+, Event_S_00E9, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x11D2
+, (const char * const) 0x11D2, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00EA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00EA
+, Event_S_00EA, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x11FA
+, (const char * const) 0x11FA, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00EB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00EB
+, Event_S_00EB, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1223
+, (const char * const) 0x1223, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00EC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00EC
+, Event_S_00EC, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x124B
+, (const char * const) 0x124B, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00ED, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00ED
+, Event_S_00ED, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x126B
+, (const char * const) 0x126B, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00EE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00EE
+, Event_S_00EE, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1294
+, (const char * const) 0x1294, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00EF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00EF
+, Event_S_00EF, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x12BD
+, (const char * const) 0x12BD, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00F0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00F0
+, Event_S_00F0, 0x13, 0x14, 0x17, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x12E3
+, (const char * const) 0x12E3, 0x13, 0x14, 0x17, 1
 #endif
 },
 	{0x00F1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00F1
+, Event_S_00F1, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1307
+, (const char * const) 0x1307, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00F2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00F2
+, Event_S_00F2, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x132C
+, (const char * const) 0x132C, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00F3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00F3
+, Event_S_00F3, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1352
+, (const char * const) 0x1352, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00F4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00F4
+, Event_S_00F4, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1376
+, (const char * const) 0x1376, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00F5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00F5
+, Event_S_00F5, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x139E
+, (const char * const) 0x139E, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00F6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00F6
+, Event_S_00F6, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x13C2
+, (const char * const) 0x13C2, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x00F7, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00F7
+, Event_S_00F7, 0x11, 0x12, 0x15, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x13E8
+, (const char * const) 0x13E8, 0x11, 0x12, 0x15, 1
 #endif
 },
 	{0x00F8, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00F8
+, Event_S_00F8, 0x11, 0x12, 0x15, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x13FE
+, (const char * const) 0x13FE, 0x11, 0x12, 0x15, 1
 #endif
 },
 	{0x00F9, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00F9
+, Event_S_00F9, 0x16, 0x17, 0x1A, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x141D
+, (const char * const) 0x141D, 0x16, 0x17, 0x1A, 1
 #endif
 },
 	{0x00FA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00FA
+, Event_S_00FA, 0x1C, 0x1D, 0x20, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1438
+, (const char * const) 0x1438, 0x1C, 0x1D, 0x20, 1
 #endif
 },
 	{0x00FB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00FB
+, Event_S_00FB, 0x1C, 0x1D, 0x20, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1479
+, (const char * const) 0x1479, 0x1C, 0x1D, 0x20, 1
 #endif
 },
 	{0x00FC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00FC
+, Event_S_00FC, 0x1C, 0x1D, 0x20, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x14C3
+, (const char * const) 0x14C3, 0x1C, 0x1D, 0x20, 1
 #endif
 },
 	{0x00FD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00FD
+, Event_S_00FD, 0x1C, 0x1D, 0x20, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x150D
+, (const char * const) 0x150D, 0x1C, 0x1D, 0x20, 1
 #endif
 },
 	{0x00FE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00FE
+, Event_S_00FE, 0x1C, 0x1D, 0x20, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1557
+, (const char * const) 0x1557, 0x1C, 0x1D, 0x20, 1
 #endif
 },
 	{0x00FF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_00FF
+, Event_S_00FF, 0x1C, 0x1D, 0x20, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x15A1
+, (const char * const) 0x15A1, 0x1C, 0x1D, 0x20, 1
 #endif
 },
 	{0x0100, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0100
+, Event_S_0100, 0x1C, 0x1D, 0x20, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x15EC
+, (const char * const) 0x15EC, 0x1C, 0x1D, 0x20, 1
 #endif
 },
 	{0x0101, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0101
+, Event_S_0101, 0x1C, 0x1D, 0x20, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1637
+, (const char * const) 0x1637, 0x1C, 0x1D, 0x20, 1
 #endif
 },
 	{0x0102, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0102
+, Event_S_0102, 0x1C, 0x1D, 0x20, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1675
+, (const char * const) 0x1675, 0x1C, 0x1D, 0x20, 1
 #endif
 },
 	{0x0103, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0103
+, Event_S_0103, 0x1C, 0x1D, 0x20, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x16BC
+, (const char * const) 0x16BC, 0x1C, 0x1D, 0x20, 1
 #endif
 },
 	{0x0104, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0104
+, Event_S_0104, 0x1C, 0x1D, 0x20, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1703
+, (const char * const) 0x1703, 0x1C, 0x1D, 0x20, 1
 #endif
 },
 	{0x0105, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0105
+, Event_S_0105, 0x1C, 0x1D, 0x20, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x174A
+, (const char * const) 0x174A, 0x1C, 0x1D, 0x20, 1
 #endif
 },
 	{0x0106, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0106
+, Event_S_0106, 0x1C, 0x1D, 0x20, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1791
+, (const char * const) 0x1791, 0x1C, 0x1D, 0x20, 1
 #endif
 },
 	{0x0107, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0107
+, Event_S_0107, 0x1C, 0x1D, 0x20, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x17D9
+, (const char * const) 0x17D9, 0x1C, 0x1D, 0x20, 1
 #endif
 },
 	{0x0108, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0108
+, Event_S_0108, 0x1C, 0x1D, 0x20, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1821
+, (const char * const) 0x1821, 0x1C, 0x1D, 0x20, 1
 #endif
 },
 	{0x0109, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0109
+, Event_S_0109, 0x1C, 0x1D, 0x20, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x185C
+, (const char * const) 0x185C, 0x1C, 0x1D, 0x20, 1
 #endif
 },
 	{0x010A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_010A
+, Event_S_010A, 0x1C, 0x1D, 0x20, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x18A0
+, (const char * const) 0x18A0, 0x1C, 0x1D, 0x20, 1
 #endif
 },
 	{0x010B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_010B
+, Event_S_010B, 0x1C, 0x1D, 0x20, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x18E4
+, (const char * const) 0x18E4, 0x1C, 0x1D, 0x20, 1
 #endif
 },
 	{0x010C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_010C
+, Event_S_010C, 0x1C, 0x1D, 0x20, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1928
+, (const char * const) 0x1928, 0x1C, 0x1D, 0x20, 1
 #endif
 },
 	{0x010D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_010D
+, Event_S_010D, 0x1C, 0x1D, 0x20, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x196C
+, (const char * const) 0x196C, 0x1C, 0x1D, 0x20, 1
 #endif
 },
 	{0x010E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_010E
+, Event_S_010E, 0x1C, 0x1D, 0x20, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x19B1
+, (const char * const) 0x19B1, 0x1C, 0x1D, 0x20, 1
 #endif
 },
 	{0x010F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_010F
+, Event_S_010F, 0x1C, 0x1D, 0x20, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x19F5
+, (const char * const) 0x19F5, 0x1C, 0x1D, 0x20, 1
 #endif
 },
 	{0x0110, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0110
+, Event_S_0110, 0x1C, 0x1D, 0x20, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1A31
+, (const char * const) 0x1A31, 0x1C, 0x1D, 0x20, 1
 #endif
 },
 	{0x0112, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0112
+, Event_S_0112, 0x1C, 0x1D, 0x20, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1A76
+, (const char * const) 0x1A76, 0x1C, 0x1D, 0x20, 1
 #endif
 },
 	{0x0113, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0113
+, Event_S_0113, 0x2D, 0x2E, 0x31, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1AB8
+, (const char * const) 0x1AB8, 0x2D, 0x2E, 0x31, 1
 #endif
 },
 	{0x0114, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0114
+, Event_S_0114, 0x2D, 0x2E, 0x31, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1AEA
+, (const char * const) 0x1AEA, 0x2D, 0x2E, 0x31, 1
 #endif
 },
 	{0x0115, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0115
+, Event_S_0115, 0x32, 0x33, 0x36, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1B25
+, (const char * const) 0x1B25, 0x32, 0x33, 0x36, 1
 #endif
 },
 	{0x0116, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0116
+, Event_S_0116, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1B5C
+, (const char * const) 0x1B5C, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0117, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0117
+, Event_S_0117, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1B82
+, (const char * const) 0x1B82, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0118, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0118
+, Event_S_0118, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1BB1
+, (const char * const) 0x1BB1, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0119, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0119
+, Event_S_0119, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1BE0
+, (const char * const) 0x1BE0, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x011A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_011A
+, Event_S_011A, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1C0F
+, (const char * const) 0x1C0F, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x011B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_011B
+, Event_S_011B, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1C3E
+, (const char * const) 0x1C3E, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x011C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_011C
+, Event_S_011C, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1C6E
+, (const char * const) 0x1C6E, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x011D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_011D
+, Event_S_011D, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1C9E
+, (const char * const) 0x1C9E, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x011E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_011E
+, Event_S_011E, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1CC1
+, (const char * const) 0x1CC1, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x011F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_011F
+, Event_S_011F, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1CED
+, (const char * const) 0x1CED, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0120, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0120
+, Event_S_0120, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1D19
+, (const char * const) 0x1D19, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0121, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0121
+, Event_S_0121, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1D45
+, (const char * const) 0x1D45, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0122, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0122
+, Event_S_0122, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1D71
+, (const char * const) 0x1D71, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0123, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0123
+, Event_S_0123, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1D9E
+, (const char * const) 0x1D9E, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0124, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0124
+, Event_S_0124, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1DCB
+, (const char * const) 0x1DCB, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0125, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0125
+, Event_S_0125, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1DEB
+, (const char * const) 0x1DEB, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0126, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0126
+, Event_S_0126, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1E14
+, (const char * const) 0x1E14, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0127, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0127
+, Event_S_0127, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1E3D
+, (const char * const) 0x1E3D, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0128, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0128
+, Event_S_0128, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1E66
+, (const char * const) 0x1E66, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0129, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0129
+, Event_S_0129, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1E8F
+, (const char * const) 0x1E8F, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x012A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_012A
+, Event_S_012A, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1EB9
+, (const char * const) 0x1EB9, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x012B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_012B
+, Event_S_012B, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1EE2
+, (const char * const) 0x1EE2, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x012C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_012C
+, Event_S_012C, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1F03
+, (const char * const) 0x1F03, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x012D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_012D
+, Event_S_012D, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1F2D
+, (const char * const) 0x1F2D, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x012E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_012E
+, Event_S_012E, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1F57
+, (const char * const) 0x1F57, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x012F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_012F
+, Event_S_012F, 0x0B, 0x0C, 0x0F, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1F7E
+, (const char * const) 0x1F7E, 0x0B, 0x0C, 0x0F, 1
 #endif
 },
 	{0x0130, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0130
+, Event_S_0130, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1F9B
+, (const char * const) 0x1F9B, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0131, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0131
+, Event_S_0131, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1FC1
+, (const char * const) 0x1FC1, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0132, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0132
+, Event_S_0132, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x1FE8
+, (const char * const) 0x1FE8, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0133, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0133
+, Event_S_0133, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x200D
+, (const char * const) 0x200D, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0134, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0134
+, Event_S_0134, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2036
+, (const char * const) 0x2036, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0135, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0135
+, Event_S_0135, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x205B
+, (const char * const) 0x205B, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0136, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0136
+, Event_S_0136, 0x12, 0x13, 0x16, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2082
+, (const char * const) 0x2082, 0x12, 0x13, 0x16, 1
 #endif
 },
 	{0x0137, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0137
+, Event_S_0137, 0x12, 0x13, 0x16, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2099
+, (const char * const) 0x2099, 0x12, 0x13, 0x16, 1
 #endif
 },
 	{0x0138, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0138
+, Event_S_0138, 0x17, 0x18, 0x1B, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x20B9
+, (const char * const) 0x20B9, 0x17, 0x18, 0x1B, 1
 #endif
 },
 	{0x0139, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0139
+, Event_S_0139, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x20D5
+, (const char * const) 0x20D5, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x013A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_013A
+, Event_S_013A, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2105
+, (const char * const) 0x2105, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x013B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_013B
+, Event_S_013B, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x213F
+, (const char * const) 0x213F, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x013C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_013C
+, Event_S_013C, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x216C
+, (const char * const) 0x216C, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x013D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_013D
+, Event_S_013D, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x21A3
+, (const char * const) 0x21A3, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x013E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_013E
+, Event_S_013E, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x21CD
+, (const char * const) 0x21CD, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x013F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_013F
+, Event_S_013F, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2200
+, (const char * const) 0x2200, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0140, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0140
+, Event_S_0140, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x222B
+, (const char * const) 0x222B, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0141, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0141
+, Event_S_0141, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x225F
+, (const char * const) 0x225F, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0142, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0142
+, Event_S_0142, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2293
+, (const char * const) 0x2293, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0143, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0143
+, Event_S_0143, 0x0B, 0x0C, 0x0F, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x22C3
+, (const char * const) 0x22C3, 0x0B, 0x0C, 0x0F, 1
 #endif
 },
 	{0x0144, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0144
+, Event_S_0144, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x22EB
+, (const char * const) 0x22EB, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0145, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0145
+, Event_S_0145, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x231B
+, (const char * const) 0x231B, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0146, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0146
+, Event_S_0146, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x234C
+, (const char * const) 0x234C, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0147, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0147
+, Event_S_0147, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x237B
+, (const char * const) 0x237B, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0148, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0148
+, Event_S_0148, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x23AE
+, (const char * const) 0x23AE, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0149, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0149
+, Event_S_0149, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x23DD
+, (const char * const) 0x23DD, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x014A, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_014A
+, Event_S_014A, 0x1C, 0x1D, 0x20, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x240E
+, (const char * const) 0x240E, 0x1C, 0x1D, 0x20, 1
 #endif
 },
 	{0x014B, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_014B
+, Event_S_014B, 0x1C, 0x1D, 0x20, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x242F
+, (const char * const) 0x242F, 0x1C, 0x1D, 0x20, 1
 #endif
 },
 	{0x014C, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_014C
+, Event_S_014C, 0x21, 0x22, 0x25, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2459
+, (const char * const) 0x2459, 0x21, 0x22, 0x25, 1
 #endif
 },
 	{0x014D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 3
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_014D
+, Event_S_014D, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x247F
+, (const char * const) 0x247F, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x014E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 3
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_014E
+, Event_S_014E, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2490
+, (const char * const) 0x2490, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x014F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_014F
+, Event_S_014F, 0x13, 0x16, 0x19, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x24A2
+, (const char * const) 0x24A2, 0x13, 0x16, 0x19, 1
 #endif
 },
 	{0x0150, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0150
+, Event_S_0150, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x24C4
+, (const char * const) 0x24C4, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0151, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 3
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0151
+, Event_S_0151, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x24E2
+, (const char * const) 0x24E2, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0152, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0152
+, Event_S_0152, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x24FD
+, (const char * const) 0x24FD, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0153, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0153
+, Event_S_0153, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x251F
+, (const char * const) 0x251F, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0154, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0154
+, Event_S_0154, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x253A
+, (const char * const) 0x253A, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0155, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0155
+, Event_S_0155, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2555
+, (const char * const) 0x2555, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0156, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 3
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0156
+, Event_S_0156, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x257D
+, (const char * const) 0x257D, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0157, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 3
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0157
+, Event_S_0157, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2599
+, (const char * const) 0x2599, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0158, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 3
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0158
+, Event_S_0158, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x25B2
+, (const char * const) 0x25B2, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0159, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 3
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0159
+, Event_S_0159, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x25CE
+, (const char * const) 0x25CE, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x015A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 4
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_015A
+, Event_S_015A, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x25E9
+, (const char * const) 0x25E9, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x015B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 24
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_015B
+, Event_S_015B, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2602
+, (const char * const) 0x2602, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x015C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_015C
+, Event_S_015C, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x261D
+, (const char * const) 0x261D, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x015D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_015D
+, Event_S_015D, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x264B
+, (const char * const) 0x264B, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x015E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_015E
+, Event_S_015E, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2676
+, (const char * const) 0x2676, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x015F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_015F
+, Event_S_015F, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x269E
+, (const char * const) 0x269E, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0160, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0160
+, Event_S_0160, 0x1C, 0x1D, 0x20, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x26C1
+, (const char * const) 0x26C1, 0x1C, 0x1D, 0x20, 1
 #endif
 },
 	{0x0161, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0161
+, Event_S_0161, 0x1C, 0x1D, 0x20, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x270B
+, (const char * const) 0x270B, 0x1C, 0x1D, 0x20, 1
 #endif
 },
 	{0x0162, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0162
+, Event_S_0162, 0x1C, 0x1D, 0x20, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2752
+, (const char * const) 0x2752, 0x1C, 0x1D, 0x20, 1
 #endif
 },
 	{0x0163, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0163
+, Event_S_0163, 0x1C, 0x1D, 0x20, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2796
+, (const char * const) 0x2796, 0x1C, 0x1D, 0x20, 1
 #endif
 },
 	{0x0164, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0164
+, Event_S_0164, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x27CB
+, (const char * const) 0x27CB, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0165, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0165
+, Event_S_0165, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x27FA
+, (const char * const) 0x27FA, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0166, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0166
+, Event_S_0166, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2826
+, (const char * const) 0x2826, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0167, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0167
+, Event_S_0167, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x284F
+, (const char * const) 0x284F, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0168, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0168
+, Event_S_0168, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2869
+, (const char * const) 0x2869, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0169, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0169
+, Event_S_0169, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2898
+, (const char * const) 0x2898, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x016A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_016A
+, Event_S_016A, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x28D1
+, (const char * const) 0x28D1, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x016B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_016B
+, Event_S_016B, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x28FD
+, (const char * const) 0x28FD, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x016C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_016C
+, Event_S_016C, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2933
+, (const char * const) 0x2933, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x016D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_016D
+, Event_S_016D, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x295C
+, (const char * const) 0x295C, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x016E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_016E
+, Event_S_016E, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x298E
+, (const char * const) 0x298E, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x016F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_016F
+, Event_S_016F, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x29B8
+, (const char * const) 0x29B8, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0170, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0170
+, Event_S_0170, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x29EB
+, (const char * const) 0x29EB, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0171, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0171
+, Event_S_0171, 0x0B, 0x0C, 0x0F, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2A1B
+, (const char * const) 0x2A1B, 0x0B, 0x0C, 0x0F, 1
 #endif
 },
 	{0x0172, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0172
+, Event_S_0172, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2A41
+, (const char * const) 0x2A41, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0173, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0173
+, Event_S_0173, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2A70
+, (const char * const) 0x2A70, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0174, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0174
+, Event_S_0174, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2AA0
+, (const char * const) 0x2AA0, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0175, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0175
+, Event_S_0175, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2ACE
+, (const char * const) 0x2ACE, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0176, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0176
+, Event_S_0176, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2AFC
+, (const char * const) 0x2AFC, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0177, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0177
+, Event_S_0177, 0x1B, 0x1C, 0x1F, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2B2C
+, (const char * const) 0x2B2C, 0x1B, 0x1C, 0x1F, 1
 #endif
 },
 	{0x0178, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0178
+, Event_S_0178, 0x1B, 0x1C, 0x1F, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2B4C
+, (const char * const) 0x2B4C, 0x1B, 0x1C, 0x1F, 1
 #endif
 },
 	{0x0179, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0179
+, Event_S_0179, 0x20, 0x21, 0x24, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2B75
+, (const char * const) 0x2B75, 0x20, 0x21, 0x24, 1
 #endif
 },
 	{0x017A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_017A
+, Event_S_017A, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2B9A
+, (const char * const) 0x2B9A, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x017B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_017B
+, Event_S_017B, 0x1A, 0x1B, 0x1E, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2BBD
+, (const char * const) 0x2BBD, 0x1A, 0x1B, 0x1E, 1
 #endif
 },
 	{0x017C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_017C
+, Event_S_017C, 0x24, 0x25, 0x28, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2BF0
+, (const char * const) 0x2BF0, 0x24, 0x25, 0x28, 1
 #endif
 },
 	{0x017D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_017D
+, Event_S_017D, 0x17, 0x18, 0x1B, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2C2D
+, (const char * const) 0x2C2D, 0x17, 0x18, 0x1B, 1
 #endif
 },
 	{0x017E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_017E
+, Event_S_017E, 0x21, 0x22, 0x25, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2C5D
+, (const char * const) 0x2C5D, 0x21, 0x22, 0x25, 1
 #endif
 },
 	{0x017F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_017F
+, Event_S_017F, 0x14, 0x15, 0x18, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2C97
+, (const char * const) 0x2C97, 0x14, 0x15, 0x18, 1
 #endif
 },
 	{0x0181, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0181
+, Event_S_0181, 0x15, 0x16, 0x19, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2CC4
+, (const char * const) 0x2CC4, 0x15, 0x16, 0x19, 1
 #endif
 },
 	{0x0183, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0183
+, Event_S_0183, 0x1B, 0x1C, 0x1F, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2CF2
+, (const char * const) 0x2CF2, 0x1B, 0x1C, 0x1F, 1
 #endif
 },
 	{0x0184, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0184
+, Event_S_0184, 0x07, 0x08, 0x0B, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2D26
+, (const char * const) 0x2D26, 0x07, 0x08, 0x0B, 1
 #endif
 },
 	{0x0186, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0186
+, Event_S_0186, 0x0C, 0x0D, 0x10, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2D4A
+, (const char * const) 0x2D4A, 0x0C, 0x0D, 0x10, 1
 #endif
 },
 	{0x0187, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 3
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0187
+, Event_S_0187, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2D73
+, (const char * const) 0x2D73, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0188, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 3
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0188
+, Event_S_0188, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2D97
+, (const char * const) 0x2D97, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0189, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 4
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0189
+, Event_S_0189, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2DBA
+, (const char * const) 0x2DBA, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x018A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 4
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_018A
+, Event_S_018A, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2DDE
+, (const char * const) 0x2DDE, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x018B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 4
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_018B
+, Event_S_018B, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2E09
+, (const char * const) 0x2E09, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x018C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 4
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_018C
+, Event_S_018C, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2E16
+, (const char * const) 0x2E16, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x018D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 4
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_018D
+, Event_S_018D, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2E27
+, (const char * const) 0x2E27, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x018F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 8
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_018F
+, Event_S_018F, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2E4C
+, (const char * const) 0x2E4C, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0191, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0191
+, Event_S_0191, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2E5E
+, (const char * const) 0x2E5E, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0192, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0192
+, Event_S_0192, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2E65
+, (const char * const) 0x2E65, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0193, RDS_TMC_QUANTIFIER_TONNES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0193
+, Event_S_0193, 0x1A, 0x20, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2E6D
+, (const char * const) 0x2E6D, 0x1A, 0x20, 0x23, 1
 #endif
 },
 	{0x0194, RDS_TMC_QUANTIFIER_TONNES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0194
+, Event_S_0194, 0x25, 0x2B, 0x2E, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2E91
+, (const char * const) 0x2E91, 0x25, 0x2B, 0x2E, 1
 #endif
 },
 	{0x0195, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0195
+, Event_S_0195, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2EC0
+, (const char * const) 0x2EC0, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0196, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 8
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0196
+, Event_S_0196, 0x00, 0x01, 0x07, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2ED3
+, (const char * const) 0x2ED3, 0x00, 0x01, 0x07, 1
 #endif
 },
 	{0x0197, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 7
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0197
+, Event_S_0197, 0x00, 0x01, 0x07, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2EF2
+, (const char * const) 0x2EF2, 0x00, 0x01, 0x07, 1
 #endif
 },
 	{0x0198, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 7
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0198
+, Event_S_0198, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2F10
+, (const char * const) 0x2F10, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0199, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 7
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0199
+, Event_S_0199, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2F22
+, (const char * const) 0x2F22, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x019A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_019A
+, Event_S_019A, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2F39
+, (const char * const) 0x2F39, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x019B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_019B
+, Event_S_019B, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2F5A
+, (const char * const) 0x2F5A, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x019C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_019C
+, Event_S_019C, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2F84
+, (const char * const) 0x2F84, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x019D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_019D
+, Event_S_019D, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2FAE
+, (const char * const) 0x2FAE, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x019E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_019E
+, Event_S_019E, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x2FD8
+, (const char * const) 0x2FD8, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x019F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_019F
+, Event_S_019F, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3002
+, (const char * const) 0x3002, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01A0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01A0
+, Event_S_01A0, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x302D
+, (const char * const) 0x302D, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01A1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01A1
+, Event_S_01A1, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3058
+, (const char * const) 0x3058, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01A2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01A2
+, Event_S_01A2, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3076
+, (const char * const) 0x3076, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01A3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01A3
+, Event_S_01A3, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x309D
+, (const char * const) 0x309D, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01A4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01A4
+, Event_S_01A4, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x30C4
+, (const char * const) 0x30C4, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01A5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01A5
+, Event_S_01A5, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x30EB
+, (const char * const) 0x30EB, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01A6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01A6
+, Event_S_01A6, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3112
+, (const char * const) 0x3112, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01A7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01A7
+, Event_S_01A7, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x313A
+, (const char * const) 0x313A, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01A8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01A8
+, Event_S_01A8, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3162
+, (const char * const) 0x3162, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01A9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01A9
+, Event_S_01A9, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x317D
+, (const char * const) 0x317D, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01AA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01AA
+, Event_S_01AA, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x31A1
+, (const char * const) 0x31A1, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01AB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01AB
+, Event_S_01AB, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x31C5
+, (const char * const) 0x31C5, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01AC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01AC
+, Event_S_01AC, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x31E9
+, (const char * const) 0x31E9, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01AD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01AD
+, Event_S_01AD, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x320D
+, (const char * const) 0x320D, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01AE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01AE
+, Event_S_01AE, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3232
+, (const char * const) 0x3232, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01AF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01AF
+, Event_S_01AF, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3256
+, (const char * const) 0x3256, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01B0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01B0
+, Event_S_01B0, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3272
+, (const char * const) 0x3272, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01B1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01B1
+, Event_S_01B1, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3297
+, (const char * const) 0x3297, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01B2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01B2
+, Event_S_01B2, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x32BC
+, (const char * const) 0x32BC, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01B3, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01B3
+, Event_S_01B3, 0x15, 0x16, 0x19, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x32DE
+, (const char * const) 0x32DE, 0x15, 0x16, 0x19, 1
 #endif
 },
 	{0x01B4, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01B4
+, Event_S_01B4, 0x15, 0x16, 0x19, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x32F8
+, (const char * const) 0x32F8, 0x15, 0x16, 0x19, 1
 #endif
 },
 	{0x01B5, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01B5
+, Event_S_01B5, 0x1A, 0x1B, 0x1E, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x331B
+, (const char * const) 0x331B, 0x1A, 0x1B, 0x1E, 1
 #endif
 },
 	{0x01B6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01B6
+, Event_S_01B6, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x333A
+, (const char * const) 0x333A, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01B7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01B7
+, Event_S_01B7, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x335C
+, (const char * const) 0x335C, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01B8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01B8
+, Event_S_01B8, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3387
+, (const char * const) 0x3387, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01B9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01B9
+, Event_S_01B9, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x33B2
+, (const char * const) 0x33B2, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01BA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01BA
+, Event_S_01BA, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x33DD
+, (const char * const) 0x33DD, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01BB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01BB
+, Event_S_01BB, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3408
+, (const char * const) 0x3408, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01BC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01BC
+, Event_S_01BC, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3434
+, (const char * const) 0x3434, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01BD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01BD
+, Event_S_01BD, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3460
+, (const char * const) 0x3460, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01BE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01BE
+, Event_S_01BE, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x347F
+, (const char * const) 0x347F, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01BF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01BF
+, Event_S_01BF, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x34A7
+, (const char * const) 0x34A7, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01C0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01C0
+, Event_S_01C0, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x34CF
+, (const char * const) 0x34CF, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01C1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01C1
+, Event_S_01C1, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x34F7
+, (const char * const) 0x34F7, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01C2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01C2
+, Event_S_01C2, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x351F
+, (const char * const) 0x351F, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01C3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01C3
+, Event_S_01C3, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3548
+, (const char * const) 0x3548, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01C4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01C4
+, Event_S_01C4, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3571
+, (const char * const) 0x3571, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01C5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01C5
+, Event_S_01C5, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x358D
+, (const char * const) 0x358D, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01C6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01C6
+, Event_S_01C6, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x35B2
+, (const char * const) 0x35B2, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01C7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01C7
+, Event_S_01C7, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x35D7
+, (const char * const) 0x35D7, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01C8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01C8
+, Event_S_01C8, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x35FC
+, (const char * const) 0x35FC, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01C9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01C9
+, Event_S_01C9, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3621
+, (const char * const) 0x3621, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01CA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01CA
+, Event_S_01CA, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3647
+, (const char * const) 0x3647, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01CB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01CB
+, Event_S_01CB, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x366C
+, (const char * const) 0x366C, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01CC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01CC
+, Event_S_01CC, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3689
+, (const char * const) 0x3689, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01CD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01CD
+, Event_S_01CD, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x36AF
+, (const char * const) 0x36AF, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01CE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01CE
+, Event_S_01CE, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x36D5
+, (const char * const) 0x36D5, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01CF, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01CF
+, Event_S_01CF, 0x16, 0x17, 0x1A, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x36F8
+, (const char * const) 0x36F8, 0x16, 0x17, 0x1A, 1
 #endif
 },
 	{0x01D0, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01D0
+, Event_S_01D0, 0x16, 0x17, 0x1A, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3713
+, (const char * const) 0x3713, 0x16, 0x17, 0x1A, 1
 #endif
 },
 	{0x01D1, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01D1
+, Event_S_01D1, 0x1B, 0x1C, 0x1F, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3737
+, (const char * const) 0x3737, 0x1B, 0x1C, 0x1F, 1
 #endif
 },
 	{0x01D2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 7
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01D2
+, Event_S_01D2, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3757
+, (const char * const) 0x3757, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01D3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01D3
+, Event_S_01D3, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x376B
+, (const char * const) 0x376B, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01D4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01D4
+, Event_S_01D4, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3774
+, (const char * const) 0x3774, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01D5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01D5
+, Event_S_01D5, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3786
+, (const char * const) 0x3786, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01D6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01D6
+, Event_S_01D6, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3793
+, (const char * const) 0x3793, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01D7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 8
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01D7
+, Event_S_01D7, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x37A1
+, (const char * const) 0x37A1, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x01D8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 8
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01D8
+, Event_S_01D8, 0x00, 0x01, 0x07, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x37C0
+, (const char * const) 0x37C0, 0x00, 0x01, 0x07, 1
 #endif
 },
 	{0x01D9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 8
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01D9
+, Event_S_01D9, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x37E0
+, (const char * const) 0x37E0, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01DA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 7
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01DA
+, Event_S_01DA, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x37EE
+, (const char * const) 0x37EE, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x01DB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 7
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01DB
+, Event_S_01DB, 0x00, 0x01, 0x07, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x380C
+, (const char * const) 0x380C, 0x00, 0x01, 0x07, 1
 #endif
 },
 	{0x01DC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 7
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01DC
+, Event_S_01DC, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x382B
+, (const char * const) 0x382B, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01DD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 7
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01DD
+, Event_S_01DD, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3838
+, (const char * const) 0x3838, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01DE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 7
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01DE
+, Event_S_01DE, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x384B
+, (const char * const) 0x384B, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01DF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 6
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01DF
+, Event_S_01DF, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3869
+, (const char * const) 0x3869, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01E0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 6
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01E0
+, Event_S_01E0, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3885
+, (const char * const) 0x3885, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01E1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 6
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01E1
+, Event_S_01E1, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x38AC
+, (const char * const) 0x38AC, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01E2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 6
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01E2
+, Event_S_01E2, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x38D2
+, (const char * const) 0x38D2, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01E3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 6
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01E3
+, Event_S_01E3, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x38E7
+, (const char * const) 0x38E7, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01E4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 6
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01E4
+, Event_S_01E4, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3904
+, (const char * const) 0x3904, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01E5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 7
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01E5
+, Event_S_01E5, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3917
+, (const char * const) 0x3917, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01E6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 6
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01E6
+, Event_S_01E6, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3936
+, (const char * const) 0x3936, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01E7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 6
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01E7
+, Event_S_01E7, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3953
+, (const char * const) 0x3953, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01E8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 6
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01E8
+, Event_S_01E8, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x397B
+, (const char * const) 0x397B, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01E9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 6
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01E9
+, Event_S_01E9, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x39A2
+, (const char * const) 0x39A2, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01EA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 6
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01EA
+, Event_S_01EA, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x39B8
+, (const char * const) 0x39B8, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01EB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 6
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01EB
+, Event_S_01EB, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x39D6
+, (const char * const) 0x39D6, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01EC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01EC
+, Event_S_01EC, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x39EA
+, (const char * const) 0x39EA, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01ED, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01ED
+, Event_S_01ED, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x39FC
+, (const char * const) 0x39FC, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01EE, RDS_TMC_QUANTIFIER_TONNES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01EE
+, Event_S_01EE, 0x19, 0x1F, 0x22, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3A09
+, (const char * const) 0x3A09, 0x19, 0x1F, 0x22, 1
 #endif
 },
 	{0x01EF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01EF
+, Event_S_01EF, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3A2C
+, (const char * const) 0x3A2C, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01F0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01F0
+, Event_S_01F0, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3A56
+, (const char * const) 0x3A56, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01F1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01F1
+, Event_S_01F1, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3A7D
+, (const char * const) 0x3A7D, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01F2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01F2
+, Event_S_01F2, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3AA1
+, (const char * const) 0x3AA1, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01F3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01F3
+, Event_S_01F3, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3ACC
+, (const char * const) 0x3ACC, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01F4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01F4
+, Event_S_01F4, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3AF4
+, (const char * const) 0x3AF4, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x01F5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01F5
+, Event_S_01F5, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3B08
+, (const char * const) 0x3B08, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x01F6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01F6
+, Event_S_01F6, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3B22
+, (const char * const) 0x3B22, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x01F7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01F7
+, Event_S_01F7, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3B3D
+, (const char * const) 0x3B3D, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x01F8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01F8
+, Event_S_01F8, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3B56
+, (const char * const) 0x3B56, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01F9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01F9
+, Event_S_01F9, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3B6B
+, (const char * const) 0x3B6B, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01FA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01FA
+, Event_S_01FA, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3B7C
+, (const char * const) 0x3B7C, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01FB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01FB
+, Event_S_01FB, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3B8F
+, (const char * const) 0x3B8F, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x01FC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01FC
+, Event_S_01FC, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3BAA
+, (const char * const) 0x3BAA, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x01FD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01FD
+, Event_S_01FD, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3BC6
+, (const char * const) 0x3BC6, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x01FE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01FE
+, Event_S_01FE, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3BE0
+, (const char * const) 0x3BE0, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x01FF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_01FF
+, Event_S_01FF, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3BF6
+, (const char * const) 0x3BF6, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0200, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0200
+, Event_S_0200, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3C08
+, (const char * const) 0x3C08, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0201, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0201
+, Event_S_0201, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3C1C
+, (const char * const) 0x3C1C, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0202, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0202
+, Event_S_0202, 0x14, 0x1A, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3C3A
+, (const char * const) 0x3C3A, 0x14, 0x1A, 0x23, 1
 #endif
 },
 	{0x0203, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0203
+, Event_S_0203, 0x14, 0x1A, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3C6A
+, (const char * const) 0x3C6A, 0x14, 0x1A, 0x23, 1
 #endif
 },
 	{0x0204, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0204
+, Event_S_0204, 0x14, 0x1A, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3C9B
+, (const char * const) 0x3C9B, 0x14, 0x1A, 0x23, 1
 #endif
 },
 	{0x0205, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0205
+, Event_S_0205, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3CCE
+, (const char * const) 0x3CCE, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0206, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0206
+, Event_S_0206, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3CD9
+, (const char * const) 0x3CD9, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0207, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0207
+, Event_S_0207, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3CE6
+, (const char * const) 0x3CE6, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0208, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0208
+, Event_S_0208, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3D03
+, (const char * const) 0x3D03, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0209, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0209
+, Event_S_0209, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3D18
+, (const char * const) 0x3D18, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x020A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_020A
+, Event_S_020A, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3D3E
+, (const char * const) 0x3D3E, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x020B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_020B
+, Event_S_020B, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3D6D
+, (const char * const) 0x3D6D, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x020C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_020C
+, Event_S_020C, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3D9C
+, (const char * const) 0x3D9C, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x020D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_020D
+, Event_S_020D, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3DCB
+, (const char * const) 0x3DCB, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x020E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_020E
+, Event_S_020E, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3DFA
+, (const char * const) 0x3DFA, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x020F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_020F
+, Event_S_020F, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3E2A
+, (const char * const) 0x3E2A, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0210, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0210
+, Event_S_0210, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3E5A
+, (const char * const) 0x3E5A, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0211, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0211
+, Event_S_0211, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3E7D
+, (const char * const) 0x3E7D, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0212, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0212
+, Event_S_0212, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3EA9
+, (const char * const) 0x3EA9, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0213, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0213
+, Event_S_0213, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3ED5
+, (const char * const) 0x3ED5, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0214, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0214
+, Event_S_0214, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3F01
+, (const char * const) 0x3F01, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0215, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0215
+, Event_S_0215, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3F2D
+, (const char * const) 0x3F2D, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0216, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0216
+, Event_S_0216, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3F5A
+, (const char * const) 0x3F5A, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0217, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0217
+, Event_S_0217, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3F87
+, (const char * const) 0x3F87, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0218, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0218
+, Event_S_0218, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3FA7
+, (const char * const) 0x3FA7, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0219, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0219
+, Event_S_0219, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3FD0
+, (const char * const) 0x3FD0, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x021A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_021A
+, Event_S_021A, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x3FF9
+, (const char * const) 0x3FF9, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x021B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_021B
+, Event_S_021B, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4022
+, (const char * const) 0x4022, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x021C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_021C
+, Event_S_021C, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x404B
+, (const char * const) 0x404B, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x021D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_021D
+, Event_S_021D, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4075
+, (const char * const) 0x4075, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x021E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_021E
+, Event_S_021E, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x409E
+, (const char * const) 0x409E, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x021F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_021F
+, Event_S_021F, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x40BF
+, (const char * const) 0x40BF, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0220, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0220
+, Event_S_0220, 0x00, 0x01, 0x04, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x40E9
+, (const char * const) 0x40E9, 0x00, 0x01, 0x04, 0
 #endif
 },
 	{0x0221, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0221
+, Event_S_0221, 0x00, 0x01, 0x04, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4112
+, (const char * const) 0x4112, 0x00, 0x01, 0x04, 0
 #endif
 },
 	{0x0222, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0222
+, Event_S_0222, 0x14, 0x1A, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4138
+, (const char * const) 0x4138, 0x14, 0x1A, 0x23, 1
 #endif
 },
 	{0x0223, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0223
+, Event_S_0223, 0x14, 0x1A, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x417C
+, (const char * const) 0x417C, 0x14, 0x1A, 0x23, 1
 #endif
 },
 	{0x0224, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0224
+, Event_S_0224, 0x14, 0x1A, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x41CA
+, (const char * const) 0x41CA, 0x14, 0x1A, 0x23, 1
 #endif
 },
 	{0x0225, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0225
+, Event_S_0225, 0x14, 0x1A, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x420B
+, (const char * const) 0x420B, 0x14, 0x1A, 0x23, 1
 #endif
 },
 	{0x0226, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0226
+, Event_S_0226, 0x14, 0x1A, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4256
+, (const char * const) 0x4256, 0x14, 0x1A, 0x23, 1
 #endif
 },
 	{0x0227, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0227
+, Event_S_0227, 0x14, 0x1A, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4294
+, (const char * const) 0x4294, 0x14, 0x1A, 0x23, 1
 #endif
 },
 	{0x0228, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0228
+, Event_S_0228, 0x14, 0x1A, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x42DB
+, (const char * const) 0x42DB, 0x14, 0x1A, 0x23, 1
 #endif
 },
 	{0x0229, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0229
+, Event_S_0229, 0x14, 0x1A, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x431A
+, (const char * const) 0x431A, 0x14, 0x1A, 0x23, 1
 #endif
 },
 	{0x022A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_022A
+, Event_S_022A, 0x14, 0x1A, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4362
+, (const char * const) 0x4362, 0x14, 0x1A, 0x23, 1
 #endif
 },
 	{0x022B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_022B
+, Event_S_022B, 0x14, 0x1A, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x43AA
+, (const char * const) 0x43AA, 0x14, 0x1A, 0x23, 1
 #endif
 },
 	{0x022C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_022C
+, Event_S_022C, 0x14, 0x1A, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x43EF
+, (const char * const) 0x43EF, 0x14, 0x1A, 0x23, 1
 #endif
 },
 	{0x022D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_022D
+, Event_S_022D, 0x14, 0x1A, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4434
+, (const char * const) 0x4434, 0x14, 0x1A, 0x23, 1
 #endif
 },
 	{0x022E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_022E
+, Event_S_022E, 0x14, 0x1A, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4483
+, (const char * const) 0x4483, 0x14, 0x1A, 0x23, 1
 #endif
 },
 	{0x022F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_022F
+, Event_S_022F, 0x14, 0x1A, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x44C5
+, (const char * const) 0x44C5, 0x14, 0x1A, 0x23, 1
 #endif
 },
 	{0x0230, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0230
+, Event_S_0230, 0x14, 0x1A, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4511
+, (const char * const) 0x4511, 0x14, 0x1A, 0x23, 1
 #endif
 },
 	{0x0231, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0231
+, Event_S_0231, 0x14, 0x1A, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4550
+, (const char * const) 0x4550, 0x14, 0x1A, 0x23, 1
 #endif
 },
 	{0x0232, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0232
+, Event_S_0232, 0x14, 0x1A, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4598
+, (const char * const) 0x4598, 0x14, 0x1A, 0x23, 1
 #endif
 },
 	{0x0233, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0233
+, Event_S_0233, 0x14, 0x1A, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x45D8
+, (const char * const) 0x45D8, 0x14, 0x1A, 0x23, 1
 #endif
 },
 	{0x0234, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0234
+, Event_S_0234, 0x14, 0x1A, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4621
+, (const char * const) 0x4621, 0x14, 0x1A, 0x23, 1
 #endif
 },
 	{0x0235, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0235
+, Event_S_0235, 0x14, 0x1A, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x466A
+, (const char * const) 0x466A, 0x14, 0x1A, 0x23, 1
 #endif
 },
 	{0x0236, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0236
+, Event_S_0236, 0x14, 0x1A, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x46B0
+, (const char * const) 0x46B0, 0x14, 0x1A, 0x23, 1
 #endif
 },
 	{0x0237, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0237
+, Event_S_0237, 0x14, 0x1A, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x46F7
+, (const char * const) 0x46F7, 0x14, 0x1A, 0x23, 1
 #endif
 },
 	{0x0238, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0238
+, Event_S_0238, 0x14, 0x1A, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4748
+, (const char * const) 0x4748, 0x14, 0x1A, 0x23, 1
 #endif
 },
 	{0x0239, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0239
+, Event_S_0239, 0x14, 0x1A, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x478C
+, (const char * const) 0x478C, 0x14, 0x1A, 0x23, 1
 #endif
 },
 	{0x023A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_023A
+, Event_S_023A, 0x14, 0x1A, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x47DA
+, (const char * const) 0x47DA, 0x14, 0x1A, 0x23, 1
 #endif
 },
 	{0x023B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_023B
+, Event_S_023B, 0x14, 0x1A, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x481B
+, (const char * const) 0x481B, 0x14, 0x1A, 0x23, 1
 #endif
 },
 	{0x023C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_023C
+, Event_S_023C, 0x14, 0x1A, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4865
+, (const char * const) 0x4865, 0x14, 0x1A, 0x23, 1
 #endif
 },
 	{0x023D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_023D
+, Event_S_023D, 0x14, 0x1A, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x48A7
+, (const char * const) 0x48A7, 0x14, 0x1A, 0x23, 1
 #endif
 },
 	{0x023E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_023E
+, Event_S_023E, 0x14, 0x1A, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x48F2
+, (const char * const) 0x48F2, 0x14, 0x1A, 0x23, 1
 #endif
 },
 	{0x023F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_023F
+, Event_S_023F, 0x14, 0x1A, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x493D
+, (const char * const) 0x493D, 0x14, 0x1A, 0x23, 1
 #endif
 },
 	{0x0240, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0240
+, Event_S_0240, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4985
+, (const char * const) 0x4985, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0241, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0241
+, Event_S_0241, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x49A4
+, (const char * const) 0x49A4, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0242, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0242
+, Event_S_0242, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x49CC
+, (const char * const) 0x49CC, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0243, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0243
+, Event_S_0243, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x49F4
+, (const char * const) 0x49F4, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0244, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0244
+, Event_S_0244, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4A1C
+, (const char * const) 0x4A1C, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0245, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0245
+, Event_S_0245, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4A44
+, (const char * const) 0x4A44, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0246, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0246
+, Event_S_0246, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4A6D
+, (const char * const) 0x4A6D, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0247, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0247
+, Event_S_0247, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4A96
+, (const char * const) 0x4A96, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0248, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0248
+, Event_S_0248, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4AB2
+, (const char * const) 0x4AB2, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0249, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0249
+, Event_S_0249, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4AD7
+, (const char * const) 0x4AD7, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x024A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_024A
+, Event_S_024A, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4AFC
+, (const char * const) 0x4AFC, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x024B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_024B
+, Event_S_024B, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4B21
+, (const char * const) 0x4B21, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x024C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_024C
+, Event_S_024C, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4B46
+, (const char * const) 0x4B46, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x024D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_024D
+, Event_S_024D, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4B6C
+, (const char * const) 0x4B6C, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x024E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_024E
+, Event_S_024E, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4B92
+, (const char * const) 0x4B92, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x024F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_024F
+, Event_S_024F, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4BAB
+, (const char * const) 0x4BAB, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0250, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0250
+, Event_S_0250, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4BCD
+, (const char * const) 0x4BCD, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0251, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0251
+, Event_S_0251, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4BEF
+, (const char * const) 0x4BEF, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0252, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0252
+, Event_S_0252, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4C11
+, (const char * const) 0x4C11, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0253, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0253
+, Event_S_0253, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4C33
+, (const char * const) 0x4C33, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0254, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0254
+, Event_S_0254, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4C56
+, (const char * const) 0x4C56, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0255, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0255
+, Event_S_0255, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4C78
+, (const char * const) 0x4C78, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0256, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0256
+, Event_S_0256, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4C92
+, (const char * const) 0x4C92, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0257, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0257
+, Event_S_0257, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4CB5
+, (const char * const) 0x4CB5, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0258, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0258
+, Event_S_0258, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4CD8
+, (const char * const) 0x4CD8, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0259, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0259
+, Event_S_0259, 0x20, 0x26, 0x2F, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4CF8
+, (const char * const) 0x4CF8, 0x20, 0x26, 0x2F, 1
 #endif
 },
 	{0x025A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_025A
+, Event_S_025A, 0x20, 0x26, 0x2F, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4D34
+, (const char * const) 0x4D34, 0x20, 0x26, 0x2F, 1
 #endif
 },
 	{0x025B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_025B
+, Event_S_025B, 0x20, 0x26, 0x2F, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4D71
+, (const char * const) 0x4D71, 0x20, 0x26, 0x2F, 1
 #endif
 },
 	{0x025C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_025C
+, Event_S_025C, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4DB0
+, (const char * const) 0x4DB0, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x025D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_025D
+, Event_S_025D, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4DD1
+, (const char * const) 0x4DD1, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x025E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_025E
+, Event_S_025E, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4DFC
+, (const char * const) 0x4DFC, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x025F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_025F
+, Event_S_025F, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4E1A
+, (const char * const) 0x4E1A, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0260, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0260
+, Event_S_0260, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4E42
+, (const char * const) 0x4E42, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0261, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0261
+, Event_S_0261, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4E5D
+, (const char * const) 0x4E5D, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0262, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0262
+, Event_S_0262, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4E81
+, (const char * const) 0x4E81, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0263, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0263
+, Event_S_0263, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4E9D
+, (const char * const) 0x4E9D, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0264, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0264
+, Event_S_0264, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4EC2
+, (const char * const) 0x4EC2, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0265, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0265
+, Event_S_0265, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4EE7
+, (const char * const) 0x4EE7, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0266, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0266
+, Event_S_0266, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4F09
+, (const char * const) 0x4F09, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0267, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0267
+, Event_S_0267, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4F3A
+, (const char * const) 0x4F3A, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0268, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0268
+, Event_S_0268, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4F89
+, (const char * const) 0x4F89, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0269, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0269
+, Event_S_0269, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4FB7
+, (const char * const) 0x4FB7, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x026A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_026A
+, Event_S_026A, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x4FEF
+, (const char * const) 0x4FEF, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x026B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_026B
+, Event_S_026B, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x501A
+, (const char * const) 0x501A, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x026C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_026C
+, Event_S_026C, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x504E
+, (const char * const) 0x504E, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x026D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_026D
+, Event_S_026D, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x507A
+, (const char * const) 0x507A, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x026E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_026E
+, Event_S_026E, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x50AF
+, (const char * const) 0x50AF, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x026F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_026F
+, Event_S_026F, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x50E4
+, (const char * const) 0x50E4, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0270, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0270
+, Event_S_0270, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5116
+, (const char * const) 0x5116, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0271, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0271
+, Event_S_0271, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x512C
+, (const char * const) 0x512C, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0272, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0272
+, Event_S_0272, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x513E
+, (const char * const) 0x513E, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0273, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0273
+, Event_S_0273, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5163
+, (const char * const) 0x5163, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0274, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0274
+, Event_S_0274, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5192
+, (const char * const) 0x5192, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0275, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0275
+, Event_S_0275, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x51CB
+, (const char * const) 0x51CB, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0276, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0276
+, Event_S_0276, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5203
+, (const char * const) 0x5203, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0277, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0277
+, Event_S_0277, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5208
+, (const char * const) 0x5208, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0278, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 8
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0278
+, Event_S_0278, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5215
+, (const char * const) 0x5215, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0279, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 7
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0279
+, Event_S_0279, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5224
+, (const char * const) 0x5224, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x027A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 6
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_027A
+, Event_S_027A, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5232
+, (const char * const) 0x5232, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x027B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_027B
+, Event_S_027B, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x524C
+, (const char * const) 0x524C, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x027C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_027C
+, Event_S_027C, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x526E
+, (const char * const) 0x526E, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x027D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_027D
+, Event_S_027D, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x528A
+, (const char * const) 0x528A, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x027E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_027E
+, Event_S_027E, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x52A0
+, (const char * const) 0x52A0, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x027F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_027F
+, Event_S_027F, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x52B4
+, (const char * const) 0x52B4, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0280, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0280
+, Event_S_0280, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x52C8
+, (const char * const) 0x52C8, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0281, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0281
+, Event_S_0281, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x52E1
+, (const char * const) 0x52E1, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0282, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0282
+, Event_S_0282, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x52F1
+, (const char * const) 0x52F1, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0283, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0283
+, Event_S_0283, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5308
+, (const char * const) 0x5308, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0284, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0284
+, Event_S_0284, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x531D
+, (const char * const) 0x531D, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0285, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0285
+, Event_S_0285, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5332
+, (const char * const) 0x5332, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0286, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0286
+, Event_S_0286, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x534C
+, (const char * const) 0x534C, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0287, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 10
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0287
+, Event_S_0287, 0x00, 0x01, 0x0B, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x535D
+, (const char * const) 0x535D, 0x00, 0x01, 0x0B, 1
 #endif
 },
 	{0x0288, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 10
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0288
+, Event_S_0288, 0x00, 0x01, 0x0B, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5383
+, (const char * const) 0x5383, 0x00, 0x01, 0x0B, 1
 #endif
 },
 	{0x0289, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 10
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0289
+, Event_S_0289, 0x00, 0x01, 0x0B, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x53A3
+, (const char * const) 0x53A3, 0x00, 0x01, 0x0B, 1
 #endif
 },
 	{0x028A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 10
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_028A
+, Event_S_028A, 0x1D, 0x21, 0x38, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x53C4
+, (const char * const) 0x53C4, 0x1D, 0x21, 0x38, 1
 #endif
 },
 	{0x028B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_028B
+, Event_S_028B, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x53FD
+, (const char * const) 0x53FD, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x028C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_028C
+, Event_S_028C, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x542C
+, (const char * const) 0x542C, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x028D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_028D
+, Event_S_028D, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5458
+, (const char * const) 0x5458, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x028E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_028E
+, Event_S_028E, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5481
+, (const char * const) 0x5481, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x028F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_028F
+, Event_S_028F, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x54A9
+, (const char * const) 0x54A9, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0290, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0290
+, Event_S_0290, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x54CE
+, (const char * const) 0x54CE, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0291, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0291
+, Event_S_0291, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x54F0
+, (const char * const) 0x54F0, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0292, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0292
+, Event_S_0292, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5507
+, (const char * const) 0x5507, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0293, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 10
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0293
+, Event_S_0293, 0x00, 0x01, 0x0B, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x551A
+, (const char * const) 0x551A, 0x00, 0x01, 0x0B, 1
 #endif
 },
 	{0x0294, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0294
+, Event_S_0294, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5542
+, (const char * const) 0x5542, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0295, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0295
+, Event_S_0295, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x555B
+, (const char * const) 0x555B, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0296, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0296
+, Event_S_0296, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5578
+, (const char * const) 0x5578, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0297, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 6
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0297
+, Event_S_0297, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5599
+, (const char * const) 0x5599, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0298, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0298
+, Event_S_0298, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x55B2
+, (const char * const) 0x55B2, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0299, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0299
+, Event_S_0299, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x55C5
+, (const char * const) 0x55C5, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x029A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_029A
+, Event_S_029A, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x55DC
+, (const char * const) 0x55DC, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x029F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 10
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_029F
+, Event_S_029F, 0x20, 0x2F, 0x3C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x55FD
+, (const char * const) 0x55FD, 0x20, 0x2F, 0x3C, 1
 #endif
 },
 	{0x02A0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 6
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02A0
+, Event_S_02A0, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x563A
+, (const char * const) 0x563A, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x02A1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 7
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02A1
+, Event_S_02A1, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x564C
+, (const char * const) 0x564C, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x02A3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 23
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02A3
+, Event_S_02A3, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x565E
+, (const char * const) 0x565E, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x02A4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 6
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02A4
+, Event_S_02A4, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5674
+, (const char * const) 0x5674, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x02A6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02A6
+, Event_S_02A6, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5685
+, (const char * const) 0x5685, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x02A7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02A7
+, Event_S_02A7, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x569F
+, (const char * const) 0x569F, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x02A8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02A8
+, Event_S_02A8, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x56BA
+, (const char * const) 0x56BA, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x02A9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 23
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02A9
+, Event_S_02A9, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x56D7
+, (const char * const) 0x56D7, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x02BD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02BD
+, Event_S_02BD, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x56E8
+, (const char * const) 0x56E8, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x02BE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02BE
+, Event_S_02BE, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x56FF
+, (const char * const) 0x56FF, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x02BF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 11
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02BF
+, Event_S_02BF, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x571C
+, (const char * const) 0x571C, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x02C0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02C0
+, Event_S_02C0, 0x00, 0x01, 0x10, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x573A
+, (const char * const) 0x573A, 0x00, 0x01, 0x10, 1
 #endif
 },
 	{0x02C1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02C1
+, Event_S_02C1, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x575C
+, (const char * const) 0x575C, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x02C2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 13
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02C2
+, Event_S_02C2, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5782
+, (const char * const) 0x5782, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x02C3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02C3
+, Event_S_02C3, 0x18, 0x1C, 0x27, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x57A1
+, (const char * const) 0x57A1, 0x18, 0x1C, 0x27, 1
 #endif
 },
 	{0x02C4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 11
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02C4
+, Event_S_02C4, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x57C9
+, (const char * const) 0x57C9, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x02C5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 11
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02C5
+, Event_S_02C5, 0x00, 0x01, 0x10, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x57EF
+, (const char * const) 0x57EF, 0x00, 0x01, 0x10, 1
 #endif
 },
 	{0x02C6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02C6
+, Event_S_02C6, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x580E
+, (const char * const) 0x580E, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x02C7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02C7
+, Event_S_02C7, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5839
+, (const char * const) 0x5839, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x02C8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02C8
+, Event_S_02C8, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x586D
+, (const char * const) 0x586D, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x02C9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02C9
+, Event_S_02C9, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x58A1
+, (const char * const) 0x58A1, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x02CA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02CA
+, Event_S_02CA, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x58D5
+, (const char * const) 0x58D5, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x02CB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02CB
+, Event_S_02CB, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5909
+, (const char * const) 0x5909, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x02CC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02CC
+, Event_S_02CC, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x593E
+, (const char * const) 0x593E, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x02CD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02CD
+, Event_S_02CD, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5973
+, (const char * const) 0x5973, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x02CE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02CE
+, Event_S_02CE, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x599B
+, (const char * const) 0x599B, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x02CF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02CF
+, Event_S_02CF, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x59CC
+, (const char * const) 0x59CC, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x02D0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02D0
+, Event_S_02D0, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x59FD
+, (const char * const) 0x59FD, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x02D1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02D1
+, Event_S_02D1, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5A2E
+, (const char * const) 0x5A2E, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x02D2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02D2
+, Event_S_02D2, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5A5F
+, (const char * const) 0x5A5F, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x02D3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02D3
+, Event_S_02D3, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5A91
+, (const char * const) 0x5A91, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x02D4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02D4
+, Event_S_02D4, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5AC3
+, (const char * const) 0x5AC3, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x02D5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02D5
+, Event_S_02D5, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5AE8
+, (const char * const) 0x5AE8, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x02D6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02D6
+, Event_S_02D6, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5B16
+, (const char * const) 0x5B16, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x02D7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02D7
+, Event_S_02D7, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5B44
+, (const char * const) 0x5B44, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x02D8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02D8
+, Event_S_02D8, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5B72
+, (const char * const) 0x5B72, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x02D9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02D9
+, Event_S_02D9, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5BA0
+, (const char * const) 0x5BA0, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x02DA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02DA
+, Event_S_02DA, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5BCF
+, (const char * const) 0x5BCF, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x02DB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02DB
+, Event_S_02DB, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5BFD
+, (const char * const) 0x5BFD, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x02DC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02DC
+, Event_S_02DC, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5C23
+, (const char * const) 0x5C23, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x02DD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02DD
+, Event_S_02DD, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5C52
+, (const char * const) 0x5C52, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x02DE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02DE
+, Event_S_02DE, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5C81
+, (const char * const) 0x5C81, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x02DF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02DF
+, Event_S_02DF, 0x0E, 0x0F, 0x1A, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5CAD
+, (const char * const) 0x5CAD, 0x0E, 0x0F, 0x1A, 1
 #endif
 },
 	{0x02E0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02E0
+, Event_S_02E0, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5CD2
+, (const char * const) 0x5CD2, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x02E1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02E1
+, Event_S_02E1, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5CFC
+, (const char * const) 0x5CFC, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x02E2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02E2
+, Event_S_02E2, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5D27
+, (const char * const) 0x5D27, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x02E3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02E3
+, Event_S_02E3, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5D50
+, (const char * const) 0x5D50, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x02E4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02E4
+, Event_S_02E4, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5D7D
+, (const char * const) 0x5D7D, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x02E5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02E5
+, Event_S_02E5, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5DA6
+, (const char * const) 0x5DA6, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x02E6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02E6
+, Event_S_02E6, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5DD1
+, (const char * const) 0x5DD1, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x02E7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02E7
+, Event_S_02E7, 0x1F, 0x25, 0x2E, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5E07
+, (const char * const) 0x5E07, 0x1F, 0x25, 0x2E, 1
 #endif
 },
 	{0x02E8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02E8
+, Event_S_02E8, 0x1F, 0x25, 0x2E, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5E42
+, (const char * const) 0x5E42, 0x1F, 0x25, 0x2E, 1
 #endif
 },
 	{0x02E9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02E9
+, Event_S_02E9, 0x1F, 0x25, 0x2E, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5E7E
+, (const char * const) 0x5E7E, 0x1F, 0x25, 0x2E, 1
 #endif
 },
 	{0x02EA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02EA
+, Event_S_02EA, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5EBC
+, (const char * const) 0x5EBC, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x02EB, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02EB
+, Event_S_02EB, 0x12, 0x13, 0x16, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5EDF
+, (const char * const) 0x5EDF, 0x12, 0x13, 0x16, 1
 #endif
 },
 	{0x02EC, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02EC
+, Event_S_02EC, 0x12, 0x13, 0x16, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5EF6
+, (const char * const) 0x5EF6, 0x12, 0x13, 0x16, 1
 #endif
 },
 	{0x02ED, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02ED
+, Event_S_02ED, 0x17, 0x18, 0x1B, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5F16
+, (const char * const) 0x5F16, 0x17, 0x18, 0x1B, 1
 #endif
 },
 	{0x02EE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02EE
+, Event_S_02EE, 0x00, 0x01, 0x10, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5F32
+, (const char * const) 0x5F32, 0x00, 0x01, 0x10, 1
 #endif
 },
 	{0x02EF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02EF
+, Event_S_02EF, 0x00, 0x01, 0x10, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5F68
+, (const char * const) 0x5F68, 0x00, 0x01, 0x10, 1
 #endif
 },
 	{0x02F0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02F0
+, Event_S_02F0, 0x00, 0x01, 0x10, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5FA7
+, (const char * const) 0x5FA7, 0x00, 0x01, 0x10, 1
 #endif
 },
 	{0x02F1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02F1
+, Event_S_02F1, 0x00, 0x01, 0x10, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x5FE6
+, (const char * const) 0x5FE6, 0x00, 0x01, 0x10, 1
 #endif
 },
 	{0x02F2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02F2
+, Event_S_02F2, 0x00, 0x01, 0x10, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6025
+, (const char * const) 0x6025, 0x00, 0x01, 0x10, 1
 #endif
 },
 	{0x02F3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02F3
+, Event_S_02F3, 0x00, 0x01, 0x10, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6064
+, (const char * const) 0x6064, 0x00, 0x01, 0x10, 1
 #endif
 },
 	{0x02F4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02F4
+, Event_S_02F4, 0x00, 0x01, 0x10, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x60A4
+, (const char * const) 0x60A4, 0x00, 0x01, 0x10, 1
 #endif
 },
 	{0x02F5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02F5
+, Event_S_02F5, 0x00, 0x01, 0x10, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x60E4
+, (const char * const) 0x60E4, 0x00, 0x01, 0x10, 1
 #endif
 },
 	{0x02F6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02F6
+, Event_S_02F6, 0x00, 0x01, 0x10, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6117
+, (const char * const) 0x6117, 0x00, 0x01, 0x10, 1
 #endif
 },
 	{0x02F7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02F7
+, Event_S_02F7, 0x00, 0x01, 0x10, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6153
+, (const char * const) 0x6153, 0x00, 0x01, 0x10, 1
 #endif
 },
 	{0x02F8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02F8
+, Event_S_02F8, 0x00, 0x01, 0x10, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x618F
+, (const char * const) 0x618F, 0x00, 0x01, 0x10, 1
 #endif
 },
 	{0x02F9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02F9
+, Event_S_02F9, 0x00, 0x01, 0x10, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x61CB
+, (const char * const) 0x61CB, 0x00, 0x01, 0x10, 1
 #endif
 },
 	{0x02FA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02FA
+, Event_S_02FA, 0x00, 0x01, 0x10, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6207
+, (const char * const) 0x6207, 0x00, 0x01, 0x10, 1
 #endif
 },
 	{0x02FB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02FB
+, Event_S_02FB, 0x00, 0x01, 0x10, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6244
+, (const char * const) 0x6244, 0x00, 0x01, 0x10, 1
 #endif
 },
 	{0x02FC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02FC
+, Event_S_02FC, 0x00, 0x01, 0x10, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6281
+, (const char * const) 0x6281, 0x00, 0x01, 0x10, 1
 #endif
 },
 	{0x02FD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02FD
+, Event_S_02FD, 0x00, 0x01, 0x10, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x62B1
+, (const char * const) 0x62B1, 0x00, 0x01, 0x10, 1
 #endif
 },
 	{0x02FE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02FE
+, Event_S_02FE, 0x00, 0x01, 0x10, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x62EA
+, (const char * const) 0x62EA, 0x00, 0x01, 0x10, 1
 #endif
 },
 	{0x02FF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_02FF
+, Event_S_02FF, 0x00, 0x01, 0x10, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6323
+, (const char * const) 0x6323, 0x00, 0x01, 0x10, 1
 #endif
 },
 	{0x0300, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0300
+, Event_S_0300, 0x00, 0x01, 0x10, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x635C
+, (const char * const) 0x635C, 0x00, 0x01, 0x10, 1
 #endif
 },
 	{0x0301, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0301
+, Event_S_0301, 0x00, 0x01, 0x10, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6395
+, (const char * const) 0x6395, 0x00, 0x01, 0x10, 1
 #endif
 },
 	{0x0302, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0302
+, Event_S_0302, 0x00, 0x01, 0x10, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x63CF
+, (const char * const) 0x63CF, 0x00, 0x01, 0x10, 1
 #endif
 },
 	{0x0303, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0303
+, Event_S_0303, 0x00, 0x01, 0x10, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6408
+, (const char * const) 0x6408, 0x00, 0x01, 0x10, 1
 #endif
 },
 	{0x0304, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0304
+, Event_S_0304, 0x00, 0x01, 0x10, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6439
+, (const char * const) 0x6439, 0x00, 0x01, 0x10, 1
 #endif
 },
 	{0x0305, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0305
+, Event_S_0305, 0x00, 0x01, 0x10, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6473
+, (const char * const) 0x6473, 0x00, 0x01, 0x10, 1
 #endif
 },
 	{0x0306, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0306
+, Event_S_0306, 0x00, 0x01, 0x10, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x64AD
+, (const char * const) 0x64AD, 0x00, 0x01, 0x10, 1
 #endif
 },
 	{0x0307, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0307
+, Event_S_0307, 0x00, 0x01, 0x10, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x64E4
+, (const char * const) 0x64E4, 0x00, 0x01, 0x10, 1
 #endif
 },
 	{0x0308, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0308
+, Event_S_0308, 0x26, 0x2C, 0x35, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6525
+, (const char * const) 0x6525, 0x26, 0x2C, 0x35, 1
 #endif
 },
 	{0x0309, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0309
+, Event_S_0309, 0x26, 0x2C, 0x35, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6567
+, (const char * const) 0x6567, 0x26, 0x2C, 0x35, 1
 #endif
 },
 	{0x030A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_030A
+, Event_S_030A, 0x26, 0x2C, 0x35, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x65AA
+, (const char * const) 0x65AA, 0x26, 0x2C, 0x35, 1
 #endif
 },
 	{0x030B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_030B
+, Event_S_030B, 0x00, 0x01, 0x10, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x65EF
+, (const char * const) 0x65EF, 0x00, 0x01, 0x10, 1
 #endif
 },
 	{0x030C, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_030C
+, Event_S_030C, 0x19, 0x1A, 0x1D, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x661D
+, (const char * const) 0x661D, 0x19, 0x1A, 0x1D, 1
 #endif
 },
 	{0x030D, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_030D
+, Event_S_030D, 0x19, 0x1A, 0x1D, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x663B
+, (const char * const) 0x663B, 0x19, 0x1A, 0x1D, 1
 #endif
 },
 	{0x030E, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_030E
+, Event_S_030E, 0x1E, 0x1F, 0x22, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6662
+, (const char * const) 0x6662, 0x1E, 0x1F, 0x22, 1
 #endif
 },
 	{0x030F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_030F
+, Event_S_030F, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6685
+, (const char * const) 0x6685, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0310, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0310
+, Event_S_0310, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x66B8
+, (const char * const) 0x66B8, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0311, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0311
+, Event_S_0311, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x66F5
+, (const char * const) 0x66F5, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0312, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0312
+, Event_S_0312, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6725
+, (const char * const) 0x6725, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0313, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0313
+, Event_S_0313, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x675F
+, (const char * const) 0x675F, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0314, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0314
+, Event_S_0314, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x678C
+, (const char * const) 0x678C, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0315, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0315
+, Event_S_0315, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x67C2
+, (const char * const) 0x67C2, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0316, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0316
+, Event_S_0316, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x67F0
+, (const char * const) 0x67F0, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0317, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0317
+, Event_S_0317, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6827
+, (const char * const) 0x6827, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0318, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0318
+, Event_S_0318, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x685E
+, (const char * const) 0x685E, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0319, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0319
+, Event_S_0319, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6892
+, (const char * const) 0x6892, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x031A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_031A
+, Event_S_031A, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x68C4
+, (const char * const) 0x68C4, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x031B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_031B
+, Event_S_031B, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x68F7
+, (const char * const) 0x68F7, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x031C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_031C
+, Event_S_031C, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6928
+, (const char * const) 0x6928, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x031D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_031D
+, Event_S_031D, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x695D
+, (const char * const) 0x695D, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x031E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_031E
+, Event_S_031E, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x698E
+, (const char * const) 0x698E, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x031F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_031F
+, Event_S_031F, 0x22, 0x26, 0x31, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x69C1
+, (const char * const) 0x69C1, 0x22, 0x26, 0x31, 1
 #endif
 },
 	{0x0320, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 11
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0320
+, Event_S_0320, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x69F3
+, (const char * const) 0x69F3, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0321, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 11
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0321
+, Event_S_0321, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6A05
+, (const char * const) 0x6A05, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0322, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0322
+, Event_S_0322, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6A17
+, (const char * const) 0x6A17, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0323, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0323
+, Event_S_0323, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6A38
+, (const char * const) 0x6A38, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0324, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 23
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0324
+, Event_S_0324, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6A57
+, (const char * const) 0x6A57, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0325, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 11
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0325
+, Event_S_0325, 0x17, 0x1B, 0x26, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6A85
+, (const char * const) 0x6A85, 0x17, 0x1B, 0x26, 1
 #endif
 },
 	{0x0326, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 11
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0326
+, Event_S_0326, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6AAC
+, (const char * const) 0x6AAC, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0327, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 11
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0327
+, Event_S_0327, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6AC9
+, (const char * const) 0x6AC9, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0328, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 11
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0328
+, Event_S_0328, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6AE4
+, (const char * const) 0x6AE4, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0329, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 11
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0329
+, Event_S_0329, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6B07
+, (const char * const) 0x6B07, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x032A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 11
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_032A
+, Event_S_032A, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6B2C
+, (const char * const) 0x6B2C, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x032B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 11
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_032B
+, Event_S_032B, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6B41
+, (const char * const) 0x6B41, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x032C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_032C
+, Event_S_032C, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6B51
+, (const char * const) 0x6B51, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x032D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_032D
+, Event_S_032D, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6B85
+, (const char * const) 0x6B85, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x032E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_032E
+, Event_S_032E, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6BB6
+, (const char * const) 0x6BB6, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x032F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_032F
+, Event_S_032F, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6BE4
+, (const char * const) 0x6BE4, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0330, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0330
+, Event_S_0330, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6C0F
+, (const char * const) 0x6C0F, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0331, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0331
+, Event_S_0331, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6C3E
+, (const char * const) 0x6C3E, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0332, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0332
+, Event_S_0332, 0x00, 0x01, 0x10, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6C66
+, (const char * const) 0x6C66, 0x00, 0x01, 0x10, 1
 #endif
 },
 	{0x0333, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0333
+, Event_S_0333, 0x00, 0x01, 0x10, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6CA5
+, (const char * const) 0x6CA5, 0x00, 0x01, 0x10, 1
 #endif
 },
 	{0x0334, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0334
+, Event_S_0334, 0x00, 0x01, 0x10, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6CE1
+, (const char * const) 0x6CE1, 0x00, 0x01, 0x10, 1
 #endif
 },
 	{0x0335, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0335
+, Event_S_0335, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6D1A
+, (const char * const) 0x6D1A, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0336, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0336
+, Event_S_0336, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6D4C
+, (const char * const) 0x6D4C, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0337, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 11
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0337
+, Event_S_0337, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6D82
+, (const char * const) 0x6D82, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0338, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 13
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0338
+, Event_S_0338, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6DB1
+, (const char * const) 0x6DB1, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0339, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0339
+, Event_S_0339, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6DD8
+, (const char * const) 0x6DD8, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x033A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_033A
+, Event_S_033A, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6E1A
+, (const char * const) 0x6E1A, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x033B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_033B
+, Event_S_033B, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6E66
+, (const char * const) 0x6E66, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x033C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_033C
+, Event_S_033C, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6EA5
+, (const char * const) 0x6EA5, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x033D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_033D
+, Event_S_033D, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6EEE
+, (const char * const) 0x6EEE, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x033E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_033E
+, Event_S_033E, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6F2A
+, (const char * const) 0x6F2A, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x033F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_033F
+, Event_S_033F, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6F6F
+, (const char * const) 0x6F6F, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0340, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0340
+, Event_S_0340, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6FAC
+, (const char * const) 0x6FAC, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0341, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0341
+, Event_S_0341, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x6FF2
+, (const char * const) 0x6FF2, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0342, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0342
+, Event_S_0342, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7038
+, (const char * const) 0x7038, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0343, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0343
+, Event_S_0343, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x707B
+, (const char * const) 0x707B, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0344, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0344
+, Event_S_0344, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x70BC
+, (const char * const) 0x70BC, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0345, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0345
+, Event_S_0345, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x70FE
+, (const char * const) 0x70FE, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0346, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0346
+, Event_S_0346, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x713E
+, (const char * const) 0x713E, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0347, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0347
+, Event_S_0347, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x717E
+, (const char * const) 0x717E, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0348, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0348
+, Event_S_0348, 0x18, 0x19, 0x1C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x71C0
+, (const char * const) 0x71C0, 0x18, 0x19, 0x1C, 1
 #endif
 },
 	{0x0349, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0349
+, Event_S_0349, 0x18, 0x19, 0x1C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x71DD
+, (const char * const) 0x71DD, 0x18, 0x19, 0x1C, 1
 #endif
 },
 	{0x034A, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_034A
+, Event_S_034A, 0x1D, 0x1E, 0x21, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7203
+, (const char * const) 0x7203, 0x1D, 0x1E, 0x21, 1
 #endif
 },
 	{0x034B, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_034B
+, Event_S_034B, 0x16, 0x17, 0x1A, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7225
+, (const char * const) 0x7225, 0x16, 0x17, 0x1A, 1
 #endif
 },
 	{0x034C, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_034C
+, Event_S_034C, 0x16, 0x17, 0x1A, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7240
+, (const char * const) 0x7240, 0x16, 0x17, 0x1A, 1
 #endif
 },
 	{0x034D, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_034D
+, Event_S_034D, 0x1B, 0x1C, 0x1F, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7264
+, (const char * const) 0x7264, 0x1B, 0x1C, 0x1F, 1
 #endif
 },
 	{0x034E, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_034E
+, Event_S_034E, 0x1E, 0x1F, 0x22, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7284
+, (const char * const) 0x7284, 0x1E, 0x1F, 0x22, 1
 #endif
 },
 	{0x034F, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_034F
+, Event_S_034F, 0x1E, 0x1F, 0x22, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x72A7
+, (const char * const) 0x72A7, 0x1E, 0x1F, 0x22, 1
 #endif
 },
 	{0x0350, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0350
+, Event_S_0350, 0x23, 0x24, 0x27, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x72D3
+, (const char * const) 0x72D3, 0x23, 0x24, 0x27, 1
 #endif
 },
 	{0x0351, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0351
+, Event_S_0351, 0x20, 0x21, 0x24, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x72FB
+, (const char * const) 0x72FB, 0x20, 0x21, 0x24, 1
 #endif
 },
 	{0x0352, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0352
+, Event_S_0352, 0x20, 0x21, 0x24, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7320
+, (const char * const) 0x7320, 0x20, 0x21, 0x24, 1
 #endif
 },
 	{0x0353, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0353
+, Event_S_0353, 0x25, 0x26, 0x29, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x734E
+, (const char * const) 0x734E, 0x25, 0x26, 0x29, 1
 #endif
 },
 	{0x0354, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 13
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0354
+, Event_S_0354, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7378
+, (const char * const) 0x7378, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0355, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 11
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0355
+, Event_S_0355, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7395
+, (const char * const) 0x7395, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0356, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 11
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0356
+, Event_S_0356, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x73B4
+, (const char * const) 0x73B4, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0357, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 11
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0357
+, Event_S_0357, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x73CD
+, (const char * const) 0x73CD, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0358, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 13
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0358
+, Event_S_0358, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x73E3
+, (const char * const) 0x73E3, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0359, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 13
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0359
+, Event_S_0359, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7408
+, (const char * const) 0x7408, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x035A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 13
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_035A
+, Event_S_035A, 0x09, 0x0A, 0x0D, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x742A
+, (const char * const) 0x742A, 0x09, 0x0A, 0x0D, 0
 #endif
 },
 	{0x035B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 13
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_035B
+, Event_S_035B, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7455
+, (const char * const) 0x7455, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x035C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 13
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_035C
+, Event_S_035C, 0x0A, 0x0B, 0x0E, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7477
+, (const char * const) 0x7477, 0x0A, 0x0B, 0x0E, 1
 #endif
 },
 	{0x035D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 13
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_035D
+, Event_S_035D, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x74A3
+, (const char * const) 0x74A3, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x035E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 13
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_035E
+, Event_S_035E, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x74B7
+, (const char * const) 0x74B7, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0381, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_XURGENT, false, false, true, 13
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0381
+, Event_S_0381, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x74D5
+, (const char * const) 0x74D5, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0382, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0382
+, Event_S_0382, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7503
+, (const char * const) 0x7503, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0383, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0383
+, Event_S_0383, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7521
+, (const char * const) 0x7521, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0384, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0384
+, Event_S_0384, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x754D
+, (const char * const) 0x754D, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0385, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0385
+, Event_S_0385, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x755F
+, (const char * const) 0x755F, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0386, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0386
+, Event_S_0386, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x757E
+, (const char * const) 0x757E, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0387, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0387
+, Event_S_0387, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x75A4
+, (const char * const) 0x75A4, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0388, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0388
+, Event_S_0388, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x75B9
+, (const char * const) 0x75B9, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0389, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0389
+, Event_S_0389, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x75C6
+, (const char * const) 0x75C6, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x038A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_038A
+, Event_S_038A, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x75D8
+, (const char * const) 0x75D8, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x038B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_038B
+, Event_S_038B, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x75F2
+, (const char * const) 0x75F2, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x038C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_038C
+, Event_S_038C, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x75FB
+, (const char * const) 0x75FB, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x038D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_038D
+, Event_S_038D, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x760C
+, (const char * const) 0x760C, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x038E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_038E
+, Event_S_038E, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7619
+, (const char * const) 0x7619, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x038F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_038F
+, Event_S_038F, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7630
+, (const char * const) 0x7630, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0390, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0390
+, Event_S_0390, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x763B
+, (const char * const) 0x763B, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0391, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0391
+, Event_S_0391, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x764A
+, (const char * const) 0x764A, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0392, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0392
+, Event_S_0392, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7654
+, (const char * const) 0x7654, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0393, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0393
+, Event_S_0393, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x765E
+, (const char * const) 0x765E, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0394, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0394
+, Event_S_0394, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7670
+, (const char * const) 0x7670, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0395, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0395
+, Event_S_0395, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x768F
+, (const char * const) 0x768F, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0396, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0396
+, Event_S_0396, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x769A
+, (const char * const) 0x769A, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0397, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0397
+, Event_S_0397, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x76B2
+, (const char * const) 0x76B2, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0398, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0398
+, Event_S_0398, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x76C3
+, (const char * const) 0x76C3, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0399, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0399
+, Event_S_0399, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x76CC
+, (const char * const) 0x76CC, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x039A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 13
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_039A
+, Event_S_039A, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x76D9
+, (const char * const) 0x76D9, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x039B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 13
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_039B
+, Event_S_039B, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x76EC
+, (const char * const) 0x76EC, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x039C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 4
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_039C
+, Event_S_039C, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7708
+, (const char * const) 0x7708, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x039D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_039D
+, Event_S_039D, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7717
+, (const char * const) 0x7717, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x039E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_039E
+, Event_S_039E, 0x0B, 0x0C, 0x0F, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x772F
+, (const char * const) 0x772F, 0x0B, 0x0C, 0x0F, 1
 #endif
 },
 	{0x039F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_039F
+, Event_S_039F, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x774C
+, (const char * const) 0x774C, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x03A0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03A0
+, Event_S_03A0, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7774
+, (const char * const) 0x7774, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03A1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03A1
+, Event_S_03A1, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7791
+, (const char * const) 0x7791, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03A2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03A2
+, Event_S_03A2, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x77B8
+, (const char * const) 0x77B8, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03A3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03A3
+, Event_S_03A3, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x77D2
+, (const char * const) 0x77D2, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03A4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03A4
+, Event_S_03A4, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x77F6
+, (const char * const) 0x77F6, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03A5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03A5
+, Event_S_03A5, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x780D
+, (const char * const) 0x780D, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03A6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03A6
+, Event_S_03A6, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x782D
+, (const char * const) 0x782D, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03A7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03A7
+, Event_S_03A7, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7845
+, (const char * const) 0x7845, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03A8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03A8
+, Event_S_03A8, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7866
+, (const char * const) 0x7866, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03A9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03A9
+, Event_S_03A9, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7887
+, (const char * const) 0x7887, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03AA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03AA
+, Event_S_03AA, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x78A5
+, (const char * const) 0x78A5, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03AB, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03AB
+, Event_S_03AB, 0x11, 0x12, 0x15, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x78BC
+, (const char * const) 0x78BC, 0x11, 0x12, 0x15, 1
 #endif
 },
 	{0x03AC, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03AC
+, Event_S_03AC, 0x11, 0x12, 0x15, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x78D2
+, (const char * const) 0x78D2, 0x11, 0x12, 0x15, 1
 #endif
 },
 	{0x03AD, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03AD
+, Event_S_03AD, 0x16, 0x17, 0x1A, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x78F1
+, (const char * const) 0x78F1, 0x16, 0x17, 0x1A, 1
 #endif
 },
 	{0x03AE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03AE
+, Event_S_03AE, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x790C
+, (const char * const) 0x790C, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03AF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03AF
+, Event_S_03AF, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7929
+, (const char * const) 0x7929, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03B0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03B0
+, Event_S_03B0, 0x1F, 0x26, 0x38, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7942
+, (const char * const) 0x7942, 0x1F, 0x26, 0x38, 1
 #endif
 },
 	{0x03B1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03B1
+, Event_S_03B1, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x797B
+, (const char * const) 0x797B, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03B2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03B2
+, Event_S_03B2, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7993
+, (const char * const) 0x7993, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03B3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03B3
+, Event_S_03B3, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x79B1
+, (const char * const) 0x79B1, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03B4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03B4
+, Event_S_03B4, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x79CE
+, (const char * const) 0x79CE, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03B5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03B5
+, Event_S_03B5, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x79EC
+, (const char * const) 0x79EC, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03B6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03B6
+, Event_S_03B6, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7A05
+, (const char * const) 0x7A05, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03B7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03B7
+, Event_S_03B7, 0x20, 0x26, 0x2F, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7A2F
+, (const char * const) 0x7A2F, 0x20, 0x26, 0x2F, 1
 #endif
 },
 	{0x03B8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03B8
+, Event_S_03B8, 0x20, 0x26, 0x2F, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7A6B
+, (const char * const) 0x7A6B, 0x20, 0x26, 0x2F, 1
 #endif
 },
 	{0x03B9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03B9
+, Event_S_03B9, 0x20, 0x26, 0x2F, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7AA8
+, (const char * const) 0x7AA8, 0x20, 0x26, 0x2F, 1
 #endif
 },
 	{0x03BA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03BA
+, Event_S_03BA, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7AE7
+, (const char * const) 0x7AE7, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03BB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03BB
+, Event_S_03BB, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7B0B
+, (const char * const) 0x7B0B, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03BC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03BC
+, Event_S_03BC, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7B2A
+, (const char * const) 0x7B2A, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03BD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03BD
+, Event_S_03BD, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7B47
+, (const char * const) 0x7B47, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03BE, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03BE
+, Event_S_03BE, 0x19, 0x1A, 0x1D, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7B6B
+, (const char * const) 0x7B6B, 0x19, 0x1A, 0x1D, 1
 #endif
 },
 	{0x03BF, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03BF
+, Event_S_03BF, 0x19, 0x1A, 0x1D, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7B89
+, (const char * const) 0x7B89, 0x19, 0x1A, 0x1D, 1
 #endif
 },
 	{0x03C0, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03C0
+, Event_S_03C0, 0x1E, 0x1F, 0x22, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7BB0
+, (const char * const) 0x7BB0, 0x1E, 0x1F, 0x22, 1
 #endif
 },
 	{0x03C1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03C1
+, Event_S_03C1, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7BD3
+, (const char * const) 0x7BD3, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03C2, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03C2
+, Event_S_03C2, 0x11, 0x12, 0x15, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7BEA
+, (const char * const) 0x7BEA, 0x11, 0x12, 0x15, 1
 #endif
 },
 	{0x03C3, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03C3
+, Event_S_03C3, 0x11, 0x12, 0x15, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7C00
+, (const char * const) 0x7C00, 0x11, 0x12, 0x15, 1
 #endif
 },
 	{0x03C4, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03C4
+, Event_S_03C4, 0x16, 0x17, 0x1A, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7C1F
+, (const char * const) 0x7C1F, 0x16, 0x17, 0x1A, 1
 #endif
 },
 	{0x03C5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03C5
+, Event_S_03C5, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7C3A
+, (const char * const) 0x7C3A, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03C6, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03C6
+, Event_S_03C6, 0x15, 0x16, 0x19, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7C55
+, (const char * const) 0x7C55, 0x15, 0x16, 0x19, 1
 #endif
 },
 	{0x03C7, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03C7
+, Event_S_03C7, 0x15, 0x16, 0x19, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7C6F
+, (const char * const) 0x7C6F, 0x15, 0x16, 0x19, 1
 #endif
 },
 	{0x03C8, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03C8
+, Event_S_03C8, 0x1A, 0x1B, 0x1E, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7C92
+, (const char * const) 0x7C92, 0x1A, 0x1B, 0x1E, 1
 #endif
 },
 	{0x03C9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03C9
+, Event_S_03C9, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7CB1
+, (const char * const) 0x7CB1, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03CA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03CA
+, Event_S_03CA, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7CCB
+, (const char * const) 0x7CCB, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03CB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03CB
+, Event_S_03CB, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7CDB
+, (const char * const) 0x7CDB, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03CC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03CC
+, Event_S_03CC, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7CED
+, (const char * const) 0x7CED, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03CD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03CD
+, Event_S_03CD, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7D03
+, (const char * const) 0x7D03, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03CE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03CE
+, Event_S_03CE, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7D17
+, (const char * const) 0x7D17, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03CF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03CF
+, Event_S_03CF, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7D26
+, (const char * const) 0x7D26, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03D0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03D0
+, Event_S_03D0, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7D33
+, (const char * const) 0x7D33, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03D1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03D1
+, Event_S_03D1, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7D3D
+, (const char * const) 0x7D3D, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03D2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03D2
+, Event_S_03D2, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7D48
+, (const char * const) 0x7D48, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03D3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03D3
+, Event_S_03D3, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7D52
+, (const char * const) 0x7D52, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03D4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03D4
+, Event_S_03D4, 0x0B, 0x0C, 0x0F, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7D5D
+, (const char * const) 0x7D5D, 0x0B, 0x0C, 0x0F, 1
 #endif
 },
 	{0x03D5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03D5
+, Event_S_03D5, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7D88
+, (const char * const) 0x7D88, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x03D6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03D6
+, Event_S_03D6, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7DBA
+, (const char * const) 0x7DBA, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03D7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03D7
+, Event_S_03D7, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7DDD
+, (const char * const) 0x7DDD, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03D8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03D8
+, Event_S_03D8, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7E06
+, (const char * const) 0x7E06, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03D9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03D9
+, Event_S_03D9, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7E23
+, (const char * const) 0x7E23, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03DA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03DA
+, Event_S_03DA, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7E44
+, (const char * const) 0x7E44, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03DB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03DB
+, Event_S_03DB, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7E59
+, (const char * const) 0x7E59, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03DC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03DC
+, Event_S_03DC, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7E78
+, (const char * const) 0x7E78, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03DD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03DD
+, Event_S_03DD, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7EA0
+, (const char * const) 0x7EA0, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03DE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03DE
+, Event_S_03DE, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7EBC
+, (const char * const) 0x7EBC, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03DF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03DF
+, Event_S_03DF, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7ED3
+, (const char * const) 0x7ED3, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03E0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03E0
+, Event_S_03E0, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7EE8
+, (const char * const) 0x7EE8, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03E1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03E1
+, Event_S_03E1, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7EFB
+, (const char * const) 0x7EFB, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03E2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03E2
+, Event_S_03E2, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7F18
+, (const char * const) 0x7F18, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03E3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03E3
+, Event_S_03E3, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7F2F
+, (const char * const) 0x7F2F, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03E4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03E4
+, Event_S_03E4, 0x21, 0x28, 0x3A, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7F4A
+, (const char * const) 0x7F4A, 0x21, 0x28, 0x3A, 1
 #endif
 },
 	{0x03E5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03E5
+, Event_S_03E5, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7F85
+, (const char * const) 0x7F85, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03E6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03E6
+, Event_S_03E6, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7FAC
+, (const char * const) 0x7FAC, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03E7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03E7
+, Event_S_03E7, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7FBE
+, (const char * const) 0x7FBE, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03E8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03E8
+, Event_S_03E8, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7FD0
+, (const char * const) 0x7FD0, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03E9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03E9
+, Event_S_03E9, 0x1D, 0x24, 0x36, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x7FEA
+, (const char * const) 0x7FEA, 0x1D, 0x24, 0x36, 1
 #endif
 },
 	{0x03EA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03EA
+, Event_S_03EA, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8021
+, (const char * const) 0x8021, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03EB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03EB
+, Event_S_03EB, 0x0E, 0x15, 0x27, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8037
+, (const char * const) 0x8037, 0x0E, 0x15, 0x27, 1
 #endif
 },
 	{0x03EC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03EC
+, Event_S_03EC, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x805F
+, (const char * const) 0x805F, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03ED, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03ED
+, Event_S_03ED, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x806B
+, (const char * const) 0x806B, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03EE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03EE
+, Event_S_03EE, 0x04, 0x0B, 0x1D, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x807A
+, (const char * const) 0x807A, 0x04, 0x0B, 0x1D, 1
 #endif
 },
 	{0x03EF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03EF
+, Event_S_03EF, 0x0E, 0x15, 0x27, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8098
+, (const char * const) 0x8098, 0x0E, 0x15, 0x27, 1
 #endif
 },
 	{0x03F0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03F0
+, Event_S_03F0, 0x0A, 0x11, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x80C0
+, (const char * const) 0x80C0, 0x0A, 0x11, 0x23, 1
 #endif
 },
 	{0x03F1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03F1
+, Event_S_03F1, 0x0E, 0x15, 0x27, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x80E4
+, (const char * const) 0x80E4, 0x0E, 0x15, 0x27, 1
 #endif
 },
 	{0x03F2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03F2
+, Event_S_03F2, 0x12, 0x19, 0x2B, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x810C
+, (const char * const) 0x810C, 0x12, 0x19, 0x2B, 1
 #endif
 },
 	{0x03F3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03F3
+, Event_S_03F3, 0x06, 0x0D, 0x1F, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8138
+, (const char * const) 0x8138, 0x06, 0x0D, 0x1F, 1
 #endif
 },
 	{0x03F4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03F4
+, Event_S_03F4, 0x11, 0x18, 0x2A, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8158
+, (const char * const) 0x8158, 0x11, 0x18, 0x2A, 1
 #endif
 },
 	{0x03F5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03F5
+, Event_S_03F5, 0x0C, 0x13, 0x25, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8183
+, (const char * const) 0x8183, 0x0C, 0x13, 0x25, 1
 #endif
 },
 	{0x03F6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03F6
+, Event_S_03F6, 0x0B, 0x12, 0x24, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x81A9
+, (const char * const) 0x81A9, 0x0B, 0x12, 0x24, 1
 #endif
 },
 	{0x03F7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03F7
+, Event_S_03F7, 0x0A, 0x11, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x81CE
+, (const char * const) 0x81CE, 0x0A, 0x11, 0x23, 1
 #endif
 },
 	{0x03F8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03F8
+, Event_S_03F8, 0x0C, 0x13, 0x25, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x81F2
+, (const char * const) 0x81F2, 0x0C, 0x13, 0x25, 1
 #endif
 },
 	{0x03F9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03F9
+, Event_S_03F9, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8218
+, (const char * const) 0x8218, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x03FA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03FA
+, Event_S_03FA, 0x0E, 0x15, 0x27, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x823C
+, (const char * const) 0x823C, 0x0E, 0x15, 0x27, 1
 #endif
 },
 	{0x03FB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03FB
+, Event_S_03FB, 0x0E, 0x15, 0x27, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8270
+, (const char * const) 0x8270, 0x0E, 0x15, 0x27, 1
 #endif
 },
 	{0x03FC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03FC
+, Event_S_03FC, 0x15, 0x1C, 0x2E, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x82A5
+, (const char * const) 0x82A5, 0x15, 0x1C, 0x2E, 1
 #endif
 },
 	{0x03FD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03FD
+, Event_S_03FD, 0x26, 0x2C, 0x35, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x82D4
+, (const char * const) 0x82D4, 0x26, 0x2C, 0x35, 1
 #endif
 },
 	{0x03FE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03FE
+, Event_S_03FE, 0x26, 0x2C, 0x35, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8316
+, (const char * const) 0x8316, 0x26, 0x2C, 0x35, 1
 #endif
 },
 	{0x03FF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 5
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_03FF
+, Event_S_03FF, 0x26, 0x2C, 0x35, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8359
+, (const char * const) 0x8359, 0x26, 0x2C, 0x35, 1
 #endif
 },
 	{0x0400, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0400
+, Event_S_0400, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x839E
+, (const char * const) 0x839E, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0401, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0401
+, Event_S_0401, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x83C2
+, (const char * const) 0x83C2, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0402, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0402
+, Event_S_0402, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x83D4
+, (const char * const) 0x83D4, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0403, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0403
+, Event_S_0403, 0x17, 0x18, 0x1B, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x83E7
+, (const char * const) 0x83E7, 0x17, 0x18, 0x1B, 1
 #endif
 },
 	{0x0404, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0404
+, Event_S_0404, 0x17, 0x18, 0x1B, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8403
+, (const char * const) 0x8403, 0x17, 0x18, 0x1B, 1
 #endif
 },
 	{0x0405, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0405
+, Event_S_0405, 0x1C, 0x1D, 0x20, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8428
+, (const char * const) 0x8428, 0x1C, 0x1D, 0x20, 1
 #endif
 },
 	{0x0406, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0406
+, Event_S_0406, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8449
+, (const char * const) 0x8449, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0407, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0407
+, Event_S_0407, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8460
+, (const char * const) 0x8460, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0408, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0408
+, Event_S_0408, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8479
+, (const char * const) 0x8479, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0409, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0409
+, Event_S_0409, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x848A
+, (const char * const) 0x848A, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x040A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 4
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_040A
+, Event_S_040A, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x849F
+, (const char * const) 0x849F, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x040B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_040B
+, Event_S_040B, 0x0B, 0x12, 0x24, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x84B6
+, (const char * const) 0x84B6, 0x0B, 0x12, 0x24, 1
 #endif
 },
 	{0x040C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_040C
+, Event_S_040C, 0x12, 0x19, 0x2B, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x84DB
+, (const char * const) 0x84DB, 0x12, 0x19, 0x2B, 1
 #endif
 },
 	{0x040D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_040D
+, Event_S_040D, 0x27, 0x2E, 0x40, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8507
+, (const char * const) 0x8507, 0x27, 0x2E, 0x40, 1
 #endif
 },
 	{0x040E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_040E
+, Event_S_040E, 0x1D, 0x24, 0x36, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8548
+, (const char * const) 0x8548, 0x1D, 0x24, 0x36, 1
 #endif
 },
 	{0x040F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_040F
+, Event_S_040F, 0x13, 0x1A, 0x2C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x857F
+, (const char * const) 0x857F, 0x13, 0x1A, 0x2C, 1
 #endif
 },
 	{0x0410, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0410
+, Event_S_0410, 0x09, 0x10, 0x22, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x85AC
+, (const char * const) 0x85AC, 0x09, 0x10, 0x22, 1
 #endif
 },
 	{0x0411, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0411
+, Event_S_0411, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x85CF
+, (const char * const) 0x85CF, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0412, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0412
+, Event_S_0412, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x85E4
+, (const char * const) 0x85E4, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0413, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0413
+, Event_S_0413, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x85F7
+, (const char * const) 0x85F7, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0414, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0414
+, Event_S_0414, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8607
+, (const char * const) 0x8607, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0415, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0415
+, Event_S_0415, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8613
+, (const char * const) 0x8613, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0416, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 34
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0416
+, Event_S_0416, 0x0D, 0x14, 0x26, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8622
+, (const char * const) 0x8622, 0x0D, 0x14, 0x26, 1
 #endif
 },
 	{0x0417, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0417
+, Event_S_0417, 0x0C, 0x13, 0x25, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8649
+, (const char * const) 0x8649, 0x0C, 0x13, 0x25, 1
 #endif
 },
 	{0x0418, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0418
+, Event_S_0418, 0x16, 0x1D, 0x2F, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x866F
+, (const char * const) 0x866F, 0x16, 0x1D, 0x2F, 1
 #endif
 },
 	{0x0419, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 34
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0419
+, Event_S_0419, 0x15, 0x1C, 0x2E, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x869F
+, (const char * const) 0x869F, 0x15, 0x1C, 0x2E, 1
 #endif
 },
 	{0x041A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_041A
+, Event_S_041A, 0x14, 0x1B, 0x2D, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x86CE
+, (const char * const) 0x86CE, 0x14, 0x1B, 0x2D, 1
 #endif
 },
 	{0x041B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 34
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_041B
+, Event_S_041B, 0x13, 0x1A, 0x2C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x86FC
+, (const char * const) 0x86FC, 0x13, 0x1A, 0x2C, 1
 #endif
 },
 	{0x041C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 34
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_041C
+, Event_S_041C, 0x17, 0x1E, 0x30, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8729
+, (const char * const) 0x8729, 0x17, 0x1E, 0x30, 1
 #endif
 },
 	{0x041D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 34
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_041D
+, Event_S_041D, 0x15, 0x1C, 0x2E, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x875A
+, (const char * const) 0x875A, 0x15, 0x1C, 0x2E, 1
 #endif
 },
 	{0x041E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_041E
+, Event_S_041E, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8789
+, (const char * const) 0x8789, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x041F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_041F
+, Event_S_041F, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x87AF
+, (const char * const) 0x87AF, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0420, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0420
+, Event_S_0420, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x87C3
+, (const char * const) 0x87C3, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0421, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0421
+, Event_S_0421, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x87DB
+, (const char * const) 0x87DB, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0422, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0422
+, Event_S_0422, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x87EF
+, (const char * const) 0x87EF, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0423, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0423
+, Event_S_0423, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8806
+, (const char * const) 0x8806, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0424, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0424
+, Event_S_0424, 0x0C, 0x13, 0x25, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x882D
+, (const char * const) 0x882D, 0x0C, 0x13, 0x25, 1
 #endif
 },
 	{0x0425, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0425
+, Event_S_0425, 0x16, 0x1D, 0x2F, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x885E
+, (const char * const) 0x885E, 0x16, 0x1D, 0x2F, 1
 #endif
 },
 	{0x0426, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0426
+, Event_S_0426, 0x0C, 0x13, 0x25, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8899
+, (const char * const) 0x8899, 0x0C, 0x13, 0x25, 1
 #endif
 },
 	{0x0427, RDS_TMC_QUANTIFIER_TONNES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0427
+, Event_S_0427, 0x1E, 0x24, 0x27, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x88ED
+, (const char * const) 0x88ED, 0x1E, 0x24, 0x27, 1
 #endif
 },
 	{0x0428, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0428
+, Event_S_0428, 0x0B, 0x12, 0x24, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8915
+, (const char * const) 0x8915, 0x0B, 0x12, 0x24, 1
 #endif
 },
 	{0x0429, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0429
+, Event_S_0429, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8955
+, (const char * const) 0x8955, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x042A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 4
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_042A
+, Event_S_042A, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8971
+, (const char * const) 0x8971, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x042B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 13
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_042B
+, Event_S_042B, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x899E
+, (const char * const) 0x899E, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x042C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 13
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_042C
+, Event_S_042C, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x89B7
+, (const char * const) 0x89B7, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x042D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_042D
+, Event_S_042D, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x89D3
+, (const char * const) 0x89D3, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x042E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_042E
+, Event_S_042E, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x89E7
+, (const char * const) 0x89E7, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x042F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 34
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_042F
+, Event_S_042F, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x89F4
+, (const char * const) 0x89F4, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0430, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 34
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0430
+, Event_S_0430, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8A17
+, (const char * const) 0x8A17, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0431, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0431
+, Event_S_0431, 0x30, 0x37, 0x49, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8A29
+, (const char * const) 0x8A29, 0x30, 0x37, 0x49, 1
 #endif
 },
 	{0x0432, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0432
+, Event_S_0432, 0x17, 0x1E, 0x30, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8A73
+, (const char * const) 0x8A73, 0x17, 0x1E, 0x30, 1
 #endif
 },
 	{0x0433, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0433
+, Event_S_0433, 0x25, 0x2C, 0x3E, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8AA4
+, (const char * const) 0x8AA4, 0x25, 0x2C, 0x3E, 1
 #endif
 },
 	{0x0437, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 15
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0437
+, Event_S_0437, 0x1C, 0x20, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8AE3
+, (const char * const) 0x8AE3, 0x1C, 0x20, 0x23, 1
 #endif
 },
 	{0x0438, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 15
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0438
+, Event_S_0438, 0x0D, 0x14, 0x17, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8B07
+, (const char * const) 0x8B07, 0x0D, 0x14, 0x17, 1
 #endif
 },
 	{0x0439, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 15
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0439
+, Event_S_0439, 0x0D, 0x11, 0x14, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8B1F
+, (const char * const) 0x8B1F, 0x0D, 0x11, 0x14, 1
 #endif
 },
 	{0x043A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 15
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_043A
+, Event_S_043A, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8B34
+, (const char * const) 0x8B34, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x043B, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 15
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_043B
+, Event_S_043B, 0x14, 0x15, 0x18, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8B4E
+, (const char * const) 0x8B4E, 0x14, 0x15, 0x18, 1
 #endif
 },
 	{0x043C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_043C
+, Event_S_043C, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8B67
+, (const char * const) 0x8B67, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x043D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_043D
+, Event_S_043D, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8B72
+, (const char * const) 0x8B72, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x043E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_043E
+, Event_S_043E, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8B7E
+, (const char * const) 0x8B7E, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0442, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0442
+, Event_S_0442, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8B99
+, (const char * const) 0x8B99, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x044D, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_044D
+, Event_S_044D, 0x0F, 0x10, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8BB2
+, (const char * const) 0x8BB2, 0x0F, 0x10, 0x13, 1
 #endif
 },
 	{0x044E, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_044E
+, Event_S_044E, 0x0F, 0x10, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8BC6
+, (const char * const) 0x8BC6, 0x0F, 0x10, 0x13, 1
 #endif
 },
 	{0x044F, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_044F
+, Event_S_044F, 0x0F, 0x10, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8BF7
+, (const char * const) 0x8BF7, 0x0F, 0x10, 0x13, 1
 #endif
 },
 	{0x0450, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0450
+, Event_S_0450, 0x09, 0x0A, 0x0D, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8C28
+, (const char * const) 0x8C28, 0x09, 0x0A, 0x0D, 1
 #endif
 },
 	{0x0451, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0451
+, Event_S_0451, 0x09, 0x0A, 0x0D, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8C36
+, (const char * const) 0x8C36, 0x09, 0x0A, 0x0D, 1
 #endif
 },
 	{0x0452, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0452
+, Event_S_0452, 0x05, 0x1C, 0x1F, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8C62
+, (const char * const) 0x8C62, 0x05, 0x1C, 0x1F, 1
 #endif
 },
 	{0x0453, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0453
+, Event_S_0453, 0x06, 0x1D, 0x20, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8C82
+, (const char * const) 0x8C82, 0x06, 0x1D, 0x20, 1
 #endif
 },
 	{0x0454, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0454
+, Event_S_0454, 0x0E, 0x25, 0x28, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8CA3
+, (const char * const) 0x8CA3, 0x0E, 0x25, 0x28, 1
 #endif
 },
 	{0x0455, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0455
+, Event_S_0455, 0x0B, 0x0C, 0x0F, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8CCC
+, (const char * const) 0x8CCC, 0x0B, 0x0C, 0x0F, 1
 #endif
 },
 	{0x0456, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0456
+, Event_S_0456, 0x0B, 0x0C, 0x0F, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8CDC
+, (const char * const) 0x8CDC, 0x0B, 0x0C, 0x0F, 1
 #endif
 },
 	{0x0457, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0457
+, Event_S_0457, 0x0B, 0x0C, 0x0F, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8D09
+, (const char * const) 0x8D09, 0x0B, 0x0C, 0x0F, 1
 #endif
 },
 	{0x0458, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0458
+, Event_S_0458, 0x05, 0x06, 0x09, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8D36
+, (const char * const) 0x8D36, 0x05, 0x06, 0x09, 1
 #endif
 },
 	{0x0459, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0459
+, Event_S_0459, 0x05, 0x06, 0x09, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8D40
+, (const char * const) 0x8D40, 0x05, 0x06, 0x09, 1
 #endif
 },
 	{0x045A, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_045A
+, Event_S_045A, 0x08, 0x1F, 0x22, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8D68
+, (const char * const) 0x8D68, 0x08, 0x1F, 0x22, 1
 #endif
 },
 	{0x045B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 15
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_045B
+, Event_S_045B, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8D8B
+, (const char * const) 0x8D8B, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x045C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 15
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_045C
+, Event_S_045C, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8D97
+, (const char * const) 0x8D97, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x045D, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_045D
+, Event_S_045D, 0x00, 0x01, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8D9D
+, (const char * const) 0x8D9D, 0x00, 0x01, 0x13, 1
 #endif
 },
 	{0x045E, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_045E
+, Event_S_045E, 0x00, 0x01, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8DC2
+, (const char * const) 0x8DC2, 0x00, 0x01, 0x13, 1
 #endif
 },
 	{0x045F, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_045F
+, Event_S_045F, 0x00, 0x01, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8DE4
+, (const char * const) 0x8DE4, 0x00, 0x01, 0x13, 1
 #endif
 },
 	{0x0460, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0460
+, Event_S_0460, 0x00, 0x01, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8E06
+, (const char * const) 0x8E06, 0x00, 0x01, 0x13, 1
 #endif
 },
 	{0x0461, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0461
+, Event_S_0461, 0x00, 0x01, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8E28
+, (const char * const) 0x8E28, 0x00, 0x01, 0x13, 1
 #endif
 },
 	{0x0462, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0462
+, Event_S_0462, 0x00, 0x01, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8E4A
+, (const char * const) 0x8E4A, 0x00, 0x01, 0x13, 1
 #endif
 },
 	{0x0463, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0463
+, Event_S_0463, 0x00, 0x01, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8E6C
+, (const char * const) 0x8E6C, 0x00, 0x01, 0x13, 1
 #endif
 },
 	{0x0464, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0464
+, Event_S_0464, 0x00, 0x01, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8E93
+, (const char * const) 0x8E93, 0x00, 0x01, 0x13, 1
 #endif
 },
 	{0x0465, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0465
+, Event_S_0465, 0x17, 0x18, 0x2A, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8EB3
+, (const char * const) 0x8EB3, 0x17, 0x18, 0x2A, 1
 #endif
 },
 	{0x0466, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0466
+, Event_S_0466, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8EE6
+, (const char * const) 0x8EE6, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0467, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 15
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0467
+, Event_S_0467, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8F01
+, (const char * const) 0x8F01, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0468, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0468
+, Event_S_0468, 0x0D, 0x24, 0x27, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8F13
+, (const char * const) 0x8F13, 0x0D, 0x24, 0x27, 1
 #endif
 },
 	{0x0469, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 33
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0469
+, Event_S_0469, 0x00, 0x01, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8F3B
+, (const char * const) 0x8F3B, 0x00, 0x01, 0x13, 1
 #endif
 },
 	{0x046A, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_046A
+, Event_S_046A, 0x09, 0x20, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8F5C
+, (const char * const) 0x8F5C, 0x09, 0x20, 0x23, 1
 #endif
 },
 	{0x046B, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 33
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_046B
+, Event_S_046B, 0x00, 0x01, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8F80
+, (const char * const) 0x8F80, 0x00, 0x01, 0x13, 1
 #endif
 },
 	{0x046C, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_046C
+, Event_S_046C, 0x0E, 0x25, 0x28, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8F9D
+, (const char * const) 0x8F9D, 0x0E, 0x25, 0x28, 1
 #endif
 },
 	{0x046D, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 33
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_046D
+, Event_S_046D, 0x00, 0x01, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8FC6
+, (const char * const) 0x8FC6, 0x00, 0x01, 0x13, 1
 #endif
 },
 	{0x046E, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_046E
+, Event_S_046E, 0x23, 0x27, 0x2A, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x8FE8
+, (const char * const) 0x8FE8, 0x23, 0x27, 0x2A, 1
 #endif
 },
 	{0x046F, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_046F
+, Event_S_046F, 0x1D, 0x21, 0x24, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9013
+, (const char * const) 0x9013, 0x1D, 0x21, 0x24, 1
 #endif
 },
 	{0x0470, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0470
+, Event_S_0470, 0x1F, 0x23, 0x26, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9038
+, (const char * const) 0x9038, 0x1F, 0x23, 0x26, 1
 #endif
 },
 	{0x0471, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0471
+, Event_S_0471, 0x19, 0x1D, 0x20, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x905F
+, (const char * const) 0x905F, 0x19, 0x1D, 0x20, 1
 #endif
 },
 	{0x0472, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 33
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0472
+, Event_S_0472, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9080
+, (const char * const) 0x9080, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0473, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 33
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0473
+, Event_S_0473, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x90A2
+, (const char * const) 0x90A2, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0474, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 33
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0474
+, Event_S_0474, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x90B4
+, (const char * const) 0x90B4, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0475, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 33
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0475
+, Event_S_0475, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x90CF
+, (const char * const) 0x90CF, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0477, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 34
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0477
+, Event_S_0477, 0x17, 0x1E, 0x30, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x90E6
+, (const char * const) 0x90E6, 0x17, 0x1E, 0x30, 1
 #endif
 },
 	{0x047F, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 33
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_047F
+, Event_S_047F, 0x00, 0x01, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9117
+, (const char * const) 0x9117, 0x00, 0x01, 0x13, 1
 #endif
 },
 	{0x0480, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0480
+, Event_S_0480, 0x00, 0x01, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x913A
+, (const char * const) 0x913A, 0x00, 0x01, 0x13, 1
 #endif
 },
 	{0x0481, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0481
+, Event_S_0481, 0x00, 0x01, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9157
+, (const char * const) 0x9157, 0x00, 0x01, 0x13, 1
 #endif
 },
 	{0x0482, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0482
+, Event_S_0482, 0x00, 0x01, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9170
+, (const char * const) 0x9170, 0x00, 0x01, 0x13, 1
 #endif
 },
 	{0x0483, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0483
+, Event_S_0483, 0x00, 0x01, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x918A
+, (const char * const) 0x918A, 0x00, 0x01, 0x13, 1
 #endif
 },
 	{0x0484, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0484
+, Event_S_0484, 0x00, 0x01, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x91AC
+, (const char * const) 0x91AC, 0x00, 0x01, 0x13, 1
 #endif
 },
 	{0x0485, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0485
+, Event_S_0485, 0x00, 0x01, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x91CB
+, (const char * const) 0x91CB, 0x00, 0x01, 0x13, 1
 #endif
 },
 	{0x0486, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0486
+, Event_S_0486, 0x00, 0x01, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x91E4
+, (const char * const) 0x91E4, 0x00, 0x01, 0x13, 1
 #endif
 },
 	{0x0487, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0487
+, Event_S_0487, 0x00, 0x01, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9200
+, (const char * const) 0x9200, 0x00, 0x01, 0x13, 1
 #endif
 },
 	{0x0488, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0488
+, Event_S_0488, 0x00, 0x01, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9220
+, (const char * const) 0x9220, 0x00, 0x01, 0x13, 1
 #endif
 },
 	{0x048D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_048D
+, Event_S_048D, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x923A
+, (const char * const) 0x923A, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x048E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_048E
+, Event_S_048E, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9250
+, (const char * const) 0x9250, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0492, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0492
+, Event_S_0492, 0x0F, 0x10, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9266
+, (const char * const) 0x9266, 0x0F, 0x10, 0x13, 1
 #endif
 },
 	{0x0493, RDS_TMC_QUANTIFIER_UPTO_MILLIMETERS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0493
+, Event_S_0493, 0x0B, 0x0C, 0x0F, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9283
+, (const char * const) 0x9283, 0x0B, 0x0C, 0x0F, 1
 #endif
 },
 	{0x0494, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0494
+, Event_S_0494, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x929C
+, (const char * const) 0x929C, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0495, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0495
+, Event_S_0495, 0x09, 0x25, 0x28, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x92B8
+, (const char * const) 0x92B8, 0x09, 0x25, 0x28, 1
 #endif
 },
 	{0x0496, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0496
+, Event_S_0496, 0x0E, 0x2A, 0x2D, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x92EA
+, (const char * const) 0x92EA, 0x0E, 0x2A, 0x2D, 1
 #endif
 },
 	{0x0497, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0497
+, Event_S_0497, 0x13, 0x17, 0x1A, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9321
+, (const char * const) 0x9321, 0x13, 0x17, 0x1A, 1
 #endif
 },
 	{0x0498, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0498
+, Event_S_0498, 0x16, 0x32, 0x35, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9345
+, (const char * const) 0x9345, 0x16, 0x32, 0x35, 1
 #endif
 },
 	{0x0499, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0499
+, Event_S_0499, 0x0A, 0x26, 0x29, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9395
+, (const char * const) 0x9395, 0x0A, 0x26, 0x29, 1
 #endif
 },
 	{0x049A, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_049A
+, Event_S_049A, 0x0B, 0x27, 0x2A, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x93C8
+, (const char * const) 0x93C8, 0x0B, 0x27, 0x2A, 1
 #endif
 },
 	{0x049B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_049B
+, Event_S_049B, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x93FC
+, (const char * const) 0x93FC, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x049C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_049C
+, Event_S_049C, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x941B
+, (const char * const) 0x941B, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x04A6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 17
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04A6
+, Event_S_04A6, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x943D
+, (const char * const) 0x943D, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x04A7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 17
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04A7
+, Event_S_04A7, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9449
+, (const char * const) 0x9449, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x04B1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 17
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04B1
+, Event_S_04B1, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9462
+, (const char * const) 0x9462, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x04B2, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 17
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04B2
+, Event_S_04B2, 0x16, 0x17, 0x1A, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x946C
+, (const char * const) 0x946C, 0x16, 0x17, 0x1A, 1
 #endif
 },
 	{0x04B3, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 17
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04B3
+, Event_S_04B3, 0x06, 0x07, 0x0A, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9487
+, (const char * const) 0x9487, 0x06, 0x07, 0x0A, 1
 #endif
 },
 	{0x04B4, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 17
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04B4
+, Event_S_04B4, 0x12, 0x13, 0x16, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9492
+, (const char * const) 0x9492, 0x12, 0x13, 0x16, 1
 #endif
 },
 	{0x04B5, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 17
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04B5
+, Event_S_04B5, 0x0D, 0x0E, 0x11, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x94A9
+, (const char * const) 0x94A9, 0x0D, 0x0E, 0x11, 1
 #endif
 },
 	{0x04B6, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 36
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04B6
+, Event_S_04B6, 0x0F, 0x10, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x94BB
+, (const char * const) 0x94BB, 0x0F, 0x10, 0x13, 1
 #endif
 },
 	{0x04B7, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 36
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04B7
+, Event_S_04B7, 0x0C, 0x0D, 0x10, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x94CF
+, (const char * const) 0x94CF, 0x0C, 0x0D, 0x10, 1
 #endif
 },
 	{0x04B8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 36
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04B8
+, Event_S_04B8, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x94E0
+, (const char * const) 0x94E0, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x04B9, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 17
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04B9
+, Event_S_04B9, 0x0C, 0x0D, 0x10, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x94ED
+, (const char * const) 0x94ED, 0x0C, 0x0D, 0x10, 1
 #endif
 },
 	{0x04BA, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 17
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04BA
+, Event_S_04BA, 0x0B, 0x0C, 0x0F, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x94FE
+, (const char * const) 0x94FE, 0x0B, 0x0C, 0x0F, 1
 #endif
 },
 	{0x04BB, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 17
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04BB
+, Event_S_04BB, 0x0D, 0x0E, 0x11, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x950E
+, (const char * const) 0x950E, 0x0D, 0x0E, 0x11, 1
 #endif
 },
 	{0x04BC, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04BC
+, Event_S_04BC, 0x33, 0x34, 0x37, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x953E
+, (const char * const) 0x953E, 0x33, 0x34, 0x37, 1
 #endif
 },
 	{0x04BD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 17
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04BD
+, Event_S_04BD, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9576
+, (const char * const) 0x9576, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x04BE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 17
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04BE
+, Event_S_04BE, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x958A
+, (const char * const) 0x958A, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x04BF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, true, true, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04BF
+, Event_S_04BF, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x959C
+, (const char * const) 0x959C, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x04C0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 36
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04C0
+, Event_S_04C0, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x95C8
+, (const char * const) 0x95C8, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x04C1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 17
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04C1
+, Event_S_04C1, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x95E0
+, (const char * const) 0x95E0, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x04C2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 36
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04C2
+, Event_S_04C2, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x95F6
+, (const char * const) 0x95F6, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x04C3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 36
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04C3
+, Event_S_04C3, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x960E
+, (const char * const) 0x960E, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x04E3, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 36
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04E3
+, Event_S_04E3, 0x00, 0x01, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9620
+, (const char * const) 0x9620, 0x00, 0x01, 0x13, 1
 #endif
 },
 	{0x04E4, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 36
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04E4
+, Event_S_04E4, 0x16, 0x17, 0x1A, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x963E
+, (const char * const) 0x963E, 0x16, 0x17, 0x1A, 1
 #endif
 },
 	{0x04E5, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 36
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04E5
+, Event_S_04E5, 0x06, 0x07, 0x0A, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9659
+, (const char * const) 0x9659, 0x06, 0x07, 0x0A, 1
 #endif
 },
 	{0x04E6, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 36
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04E6
+, Event_S_04E6, 0x12, 0x13, 0x16, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9664
+, (const char * const) 0x9664, 0x12, 0x13, 0x16, 1
 #endif
 },
 	{0x04E7, RDS_TMC_QUANTIFIER_UPTO_KMH, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 36
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04E7
+, Event_S_04E7, 0x0D, 0x0E, 0x11, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x967B
+, (const char * const) 0x967B, 0x0D, 0x0E, 0x11, 1
 #endif
 },
 	{0x04E8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 36
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_04E8
+, Event_S_04E8, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x968D
+, (const char * const) 0x968D, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0514, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 33
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0514
+, Event_S_0514, 0x11, 0x28, 0x2B, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x96AC
+, (const char * const) 0x96AC, 0x11, 0x28, 0x2B, 1
 #endif
 },
 	{0x0515, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0515
+, Event_S_0515, 0x0A, 0x21, 0x24, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x96E1
+, (const char * const) 0x96E1, 0x0A, 0x21, 0x24, 1
 #endif
 },
 	{0x0516, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0516
+, Event_S_0516, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9706
+, (const char * const) 0x9706, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0517, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0517
+, Event_S_0517, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x972D
+, (const char * const) 0x972D, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0518, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0518
+, Event_S_0518, 0x04, 0x1B, 0x1E, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9754
+, (const char * const) 0x9754, 0x04, 0x1B, 0x1E, 1
 #endif
 },
 	{0x0519, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0519
+, Event_S_0519, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9773
+, (const char * const) 0x9773, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x051A, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_051A
+, Event_S_051A, 0x00, 0x01, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9795
+, (const char * const) 0x9795, 0x00, 0x01, 0x13, 1
 #endif
 },
 	{0x051B, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_051B
+, Event_S_051B, 0x0B, 0x22, 0x25, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x97AD
+, (const char * const) 0x97AD, 0x0B, 0x22, 0x25, 1
 #endif
 },
 	{0x051C, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_051C
+, Event_S_051C, 0x0D, 0x24, 0x27, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x97D3
+, (const char * const) 0x97D3, 0x0D, 0x24, 0x27, 1
 #endif
 },
 	{0x051D, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_051D
+, Event_S_051D, 0x0D, 0x24, 0x27, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x97FB
+, (const char * const) 0x97FB, 0x0D, 0x24, 0x27, 1
 #endif
 },
 	{0x051E, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_051E
+, Event_S_051E, 0x0D, 0x24, 0x27, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9823
+, (const char * const) 0x9823, 0x0D, 0x24, 0x27, 1
 #endif
 },
 	{0x051F, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 35
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_051F
+, Event_S_051F, 0x00, 0x01, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x984B
+, (const char * const) 0x984B, 0x00, 0x01, 0x13, 1
 #endif
 },
 	{0x0520, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0520
+, Event_S_0520, 0x11, 0x28, 0x2B, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9878
+, (const char * const) 0x9878, 0x11, 0x28, 0x2B, 1
 #endif
 },
 	{0x0521, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0521
+, Event_S_0521, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x98A4
+, (const char * const) 0x98A4, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0522, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0522
+, Event_S_0522, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x98B8
+, (const char * const) 0x98B8, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0523, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 33
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0523
+, Event_S_0523, 0x00, 0x01, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x98CA
+, (const char * const) 0x98CA, 0x00, 0x01, 0x13, 1
 #endif
 },
 	{0x0524, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 33
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0524
+, Event_S_0524, 0x00, 0x01, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x98E8
+, (const char * const) 0x98E8, 0x00, 0x01, 0x13, 1
 #endif
 },
 	{0x0525, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 33
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0525
+, Event_S_0525, 0x00, 0x01, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9907
+, (const char * const) 0x9907, 0x00, 0x01, 0x13, 1
 #endif
 },
 	{0x0526, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0526
+, Event_S_0526, 0x13, 0x17, 0x1A, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9928
+, (const char * const) 0x9928, 0x13, 0x17, 0x1A, 1
 #endif
 },
 	{0x0527, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0527
+, Event_S_0527, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9943
+, (const char * const) 0x9943, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0528, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0528
+, Event_S_0528, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x995F
+, (const char * const) 0x995F, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0529, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0529
+, Event_S_0529, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x997B
+, (const char * const) 0x997B, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x052A, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_052A
+, Event_S_052A, 0x0A, 0x21, 0x24, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9998
+, (const char * const) 0x9998, 0x0A, 0x21, 0x24, 1
 #endif
 },
 	{0x052B, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_052B
+, Event_S_052B, 0x0D, 0x24, 0x27, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x99BD
+, (const char * const) 0x99BD, 0x0D, 0x24, 0x27, 1
 #endif
 },
 	{0x052C, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_052C
+, Event_S_052C, 0x0D, 0x24, 0x27, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x99E5
+, (const char * const) 0x99E5, 0x0D, 0x24, 0x27, 1
 #endif
 },
 	{0x052D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_052D
+, Event_S_052D, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9A0D
+, (const char * const) 0x9A0D, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x052E, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_052E
+, Event_S_052E, 0x0B, 0x22, 0x25, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9A1B
+, (const char * const) 0x9A1B, 0x0B, 0x22, 0x25, 1
 #endif
 },
 	{0x052F, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 33
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_052F
+, Event_S_052F, 0x00, 0x01, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9A41
+, (const char * const) 0x9A41, 0x00, 0x01, 0x13, 1
 #endif
 },
 	{0x0530, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 35
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0530
+, Event_S_0530, 0x00, 0x01, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9A60
+, (const char * const) 0x9A60, 0x00, 0x01, 0x13, 1
 #endif
 },
 	{0x0531, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 35
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0531
+, Event_S_0531, 0x00, 0x01, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9A86
+, (const char * const) 0x9A86, 0x00, 0x01, 0x13, 1
 #endif
 },
 	{0x0532, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 35
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0532
+, Event_S_0532, 0x00, 0x01, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9AAC
+, (const char * const) 0x9AAC, 0x00, 0x01, 0x13, 1
 #endif
 },
 	{0x0533, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 35
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0533
+, Event_S_0533, 0x00, 0x01, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9AD2
+, (const char * const) 0x9AD2, 0x00, 0x01, 0x13, 1
 #endif
 },
 	{0x0534, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0534
+, Event_S_0534, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9AFD
+, (const char * const) 0x9AFD, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0535, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 35
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0535
+, Event_S_0535, 0x00, 0x01, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9B08
+, (const char * const) 0x9B08, 0x00, 0x01, 0x13, 1
 #endif
 },
 	{0x0536, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 35
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0536
+, Event_S_0536, 0x00, 0x01, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9B21
+, (const char * const) 0x9B21, 0x00, 0x01, 0x13, 1
 #endif
 },
 	{0x0537, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 35
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0537
+, Event_S_0537, 0x00, 0x01, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9B48
+, (const char * const) 0x9B48, 0x00, 0x01, 0x13, 1
 #endif
 },
 	{0x0538, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 35
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0538
+, Event_S_0538, 0x00, 0x01, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9B71
+, (const char * const) 0x9B71, 0x00, 0x01, 0x13, 1
 #endif
 },
 	{0x0539, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0539
+, Event_S_0539, 0x0D, 0x24, 0x27, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9B97
+, (const char * const) 0x9B97, 0x0D, 0x24, 0x27, 1
 #endif
 },
 	{0x053A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_053A
+, Event_S_053A, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9BCF
+, (const char * const) 0x9BCF, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x053B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 35
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_053B
+, Event_S_053B, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9BF3
+, (const char * const) 0x9BF3, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x053C, RDS_TMC_QUANTIFIER_LESSTHAN_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_053C
+, Event_S_053C, 0x12, 0x29, 0x2C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9C08
+, (const char * const) 0x9C08, 0x12, 0x29, 0x2C, 1
 #endif
 },
 	{0x0541, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0541
+, Event_S_0541, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9C35
+, (const char * const) 0x9C35, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0542, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 16
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0542
+, Event_S_0542, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9C42
+, (const char * const) 0x9C42, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0547, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0547
+, Event_S_0547, 0x14, 0x18, 0x1B, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9C59
+, (const char * const) 0x9C59, 0x14, 0x18, 0x1B, 1
 #endif
 },
 	{0x0548, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0548
+, Event_S_0548, 0x05, 0x1A, 0x1D, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9C75
+, (const char * const) 0x9C75, 0x05, 0x1A, 0x1D, 1
 #endif
 },
 	{0x0549, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0549
+, Event_S_0549, 0x06, 0x1B, 0x1E, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9C93
+, (const char * const) 0x9C93, 0x06, 0x1B, 0x1E, 1
 #endif
 },
 	{0x054A, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_054A
+, Event_S_054A, 0x06, 0x1B, 0x1E, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9CB2
+, (const char * const) 0x9CB2, 0x06, 0x1B, 0x1E, 1
 #endif
 },
 	{0x054B, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_054B
+, Event_S_054B, 0x06, 0x1B, 0x1E, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9CD1
+, (const char * const) 0x9CD1, 0x06, 0x1B, 0x1E, 1
 #endif
 },
 	{0x054C, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_054C
+, Event_S_054C, 0x06, 0x1B, 0x1E, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9CF0
+, (const char * const) 0x9CF0, 0x06, 0x1B, 0x1E, 1
 #endif
 },
 	{0x054D, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_054D
+, Event_S_054D, 0x0B, 0x20, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9D0F
+, (const char * const) 0x9D0F, 0x0B, 0x20, 0x23, 1
 #endif
 },
 	{0x054E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 37
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_054E
+, Event_S_054E, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9D33
+, (const char * const) 0x9D33, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x054F, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_054F
+, Event_S_054F, 0x13, 0x17, 0x1A, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9D45
+, (const char * const) 0x9D45, 0x13, 0x17, 0x1A, 1
 #endif
 },
 	{0x0550, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0550
+, Event_S_0550, 0x1C, 0x20, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9D60
+, (const char * const) 0x9D60, 0x1C, 0x20, 0x23, 1
 #endif
 },
 	{0x0551, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0551
+, Event_S_0551, 0x0C, 0x0D, 0x10, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9D84
+, (const char * const) 0x9D84, 0x0C, 0x0D, 0x10, 1
 #endif
 },
 	{0x0552, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0552
+, Event_S_0552, 0x27, 0x28, 0x2B, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9D95
+, (const char * const) 0x9D95, 0x27, 0x28, 0x2B, 1
 #endif
 },
 	{0x0554, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0554
+, Event_S_0554, 0x0D, 0x14, 0x17, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9DC1
+, (const char * const) 0x9DC1, 0x0D, 0x14, 0x17, 1
 #endif
 },
 	{0x0555, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0555
+, Event_S_0555, 0x0D, 0x11, 0x14, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9DD9
+, (const char * const) 0x9DD9, 0x0D, 0x11, 0x14, 1
 #endif
 },
 	{0x0579, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0579
+, Event_S_0579, 0x14, 0x18, 0x1B, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9DEE
+, (const char * const) 0x9DEE, 0x14, 0x18, 0x1B, 1
 #endif
 },
 	{0x057A, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_057A
+, Event_S_057A, 0x0A, 0x1F, 0x22, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9E0A
+, (const char * const) 0x9E0A, 0x0A, 0x1F, 0x22, 1
 #endif
 },
 	{0x057B, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_057B
+, Event_S_057B, 0x05, 0x1A, 0x1D, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9E2D
+, (const char * const) 0x9E2D, 0x05, 0x1A, 0x1D, 1
 #endif
 },
 	{0x057C, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_057C
+, Event_S_057C, 0x05, 0x1A, 0x1D, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9E4B
+, (const char * const) 0x9E4B, 0x05, 0x1A, 0x1D, 1
 #endif
 },
 	{0x057D, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_057D
+, Event_S_057D, 0x05, 0x1A, 0x1D, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9E69
+, (const char * const) 0x9E69, 0x05, 0x1A, 0x1D, 1
 #endif
 },
 	{0x057E, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_057E
+, Event_S_057E, 0x05, 0x1A, 0x1D, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9E87
+, (const char * const) 0x9E87, 0x05, 0x1A, 0x1D, 1
 #endif
 },
 	{0x057F, RDS_TMC_QUANTIFIER_DEGREES_CELSIUS, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_057F
+, Event_S_057F, 0x0A, 0x1F, 0x22, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9EA5
+, (const char * const) 0x9EA5, 0x0A, 0x1F, 0x22, 1
 #endif
 },
 	{0x0580, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 37
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0580
+, Event_S_0580, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9EC8
+, (const char * const) 0x9EC8, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05A9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05A9
+, Event_S_05A9, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9EEB
+, (const char * const) 0x9EEB, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05AA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05AA
+, Event_S_05AA, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9F0A
+, (const char * const) 0x9F0A, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05AB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05AB
+, Event_S_05AB, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9F27
+, (const char * const) 0x9F27, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05AC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05AC
+, Event_S_05AC, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9F2D
+, (const char * const) 0x9F2D, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05AD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05AD
+, Event_S_05AD, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9F38
+, (const char * const) 0x9F38, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05AE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05AE
+, Event_S_05AE, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9F4A
+, (const char * const) 0x9F4A, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05AF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05AF
+, Event_S_05AF, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9F54
+, (const char * const) 0x9F54, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05B0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05B0
+, Event_S_05B0, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9F66
+, (const char * const) 0x9F66, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05B1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05B1
+, Event_S_05B1, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9F71
+, (const char * const) 0x9F71, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05B2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05B2
+, Event_S_05B2, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9F7F
+, (const char * const) 0x9F7F, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05B3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05B3
+, Event_S_05B3, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9F8A
+, (const char * const) 0x9F8A, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05B4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05B4
+, Event_S_05B4, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9F99
+, (const char * const) 0x9F99, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05B5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05B5
+, Event_S_05B5, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9FA9
+, (const char * const) 0x9FA9, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05B6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05B6
+, Event_S_05B6, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9FB2
+, (const char * const) 0x9FB2, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05B7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05B7
+, Event_S_05B7, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9FBF
+, (const char * const) 0x9FBF, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05B8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05B8
+, Event_S_05B8, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9FCB
+, (const char * const) 0x9FCB, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05B9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05B9
+, Event_S_05B9, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9FD8
+, (const char * const) 0x9FD8, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05BA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05BA
+, Event_S_05BA, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9FEA
+, (const char * const) 0x9FEA, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05BB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05BB
+, Event_S_05BB, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0x9FFF
+, (const char * const) 0x9FFF, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05BC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05BC
+, Event_S_05BC, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA015
+, (const char * const) 0xA015, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05BD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05BD
+, Event_S_05BD, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA01D
+, (const char * const) 0xA01D, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05BE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05BE
+, Event_S_05BE, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA028
+, (const char * const) 0xA028, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05BF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 13
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05BF
+, Event_S_05BF, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA033
+, (const char * const) 0xA033, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05C0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 13
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05C0
+, Event_S_05C0, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA051
+, (const char * const) 0xA051, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05C1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 13
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05C1
+, Event_S_05C1, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA063
+, (const char * const) 0xA063, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05C2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 13
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05C2
+, Event_S_05C2, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA077
+, (const char * const) 0xA077, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05C3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05C3
+, Event_S_05C3, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA08B
+, (const char * const) 0xA08B, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05C4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 19
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05C4
+, Event_S_05C4, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA092
+, (const char * const) 0xA092, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05C5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 19
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05C5
+, Event_S_05C5, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA0A4
+, (const char * const) 0xA0A4, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05C6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 19
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05C6
+, Event_S_05C6, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA0B6
+, (const char * const) 0xA0B6, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05C7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_XURGENT, false, true, true, 19
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05C7
+, Event_S_05C7, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA0C9
+, (const char * const) 0xA0C9, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05C8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 19
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05C8
+, Event_S_05C8, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA0E4
+, (const char * const) 0xA0E4, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05C9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_XURGENT, false, true, true, 19
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05C9
+, Event_S_05C9, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA0F4
+, (const char * const) 0xA0F4, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05CA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 13
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05CA
+, Event_S_05CA, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA105
+, (const char * const) 0xA105, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05CB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 13
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05CB
+, Event_S_05CB, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA11F
+, (const char * const) 0xA11F, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05CC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 13
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05CC
+, Event_S_05CC, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA13B
+, (const char * const) 0xA13B, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05CD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05CD
+, Event_S_05CD, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA157
+, (const char * const) 0xA157, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05CE, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05CE
+, Event_S_05CE, 0x1A, 0x1B, 0x1E, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA177
+, (const char * const) 0xA177, 0x1A, 0x1B, 0x1E, 1
 #endif
 },
 	{0x05CF, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05CF
+, Event_S_05CF, 0x1A, 0x1B, 0x1E, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA196
+, (const char * const) 0xA196, 0x1A, 0x1B, 0x1E, 1
 #endif
 },
 	{0x05D0, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05D0
+, Event_S_05D0, 0x1F, 0x20, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA1BE
+, (const char * const) 0xA1BE, 0x1F, 0x20, 0x23, 1
 #endif
 },
 	{0x05D1, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05D1
+, Event_S_05D1, 0x1A, 0x1B, 0x1E, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA1E2
+, (const char * const) 0xA1E2, 0x1A, 0x1B, 0x1E, 1
 #endif
 },
 	{0x05D2, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05D2
+, Event_S_05D2, 0x1A, 0x1B, 0x1E, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA201
+, (const char * const) 0xA201, 0x1A, 0x1B, 0x1E, 1
 #endif
 },
 	{0x05D3, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05D3
+, Event_S_05D3, 0x1F, 0x20, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA229
+, (const char * const) 0xA229, 0x1F, 0x20, 0x23, 1
 #endif
 },
 	{0x05D4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 19
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05D4
+, Event_S_05D4, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA24D
+, (const char * const) 0xA24D, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05D5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05D5
+, Event_S_05D5, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA266
+, (const char * const) 0xA266, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05D6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 19
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05D6
+, Event_S_05D6, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA27D
+, (const char * const) 0xA27D, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05D7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05D7
+, Event_S_05D7, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA288
+, (const char * const) 0xA288, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05D8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05D8
+, Event_S_05D8, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA2A2
+, (const char * const) 0xA2A2, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05D9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05D9
+, Event_S_05D9, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA2BD
+, (const char * const) 0xA2BD, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05DA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 13
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05DA
+, Event_S_05DA, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA2DB
+, (const char * const) 0xA2DB, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05DB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 13
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05DB
+, Event_S_05DB, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA2F3
+, (const char * const) 0xA2F3, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05DC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_XURGENT, false, false, true, 19
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05DC
+, Event_S_05DC, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA30D
+, (const char * const) 0xA30D, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05DD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05DD
+, Event_S_05DD, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA329
+, (const char * const) 0xA329, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05DE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05DE
+, Event_S_05DE, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA335
+, (const char * const) 0xA335, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05DF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05DF
+, Event_S_05DF, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA34A
+, (const char * const) 0xA34A, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05E0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05E0
+, Event_S_05E0, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA34F
+, (const char * const) 0xA34F, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05E1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05E1
+, Event_S_05E1, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA358
+, (const char * const) 0xA358, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05E2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05E2
+, Event_S_05E2, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA363
+, (const char * const) 0xA363, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05E3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05E3
+, Event_S_05E3, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA368
+, (const char * const) 0xA368, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05E4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05E4
+, Event_S_05E4, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA36F
+, (const char * const) 0xA36F, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05E5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05E5
+, Event_S_05E5, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA380
+, (const char * const) 0xA380, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05E6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05E6
+, Event_S_05E6, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA38F
+, (const char * const) 0xA38F, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05E7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05E7
+, Event_S_05E7, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA396
+, (const char * const) 0xA396, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05E8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05E8
+, Event_S_05E8, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA39C
+, (const char * const) 0xA39C, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05E9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05E9
+, Event_S_05E9, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA3A2
+, (const char * const) 0xA3A2, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05EA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05EA
+, Event_S_05EA, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA3B0
+, (const char * const) 0xA3B0, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05EB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 19
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05EB
+, Event_S_05EB, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA3C3
+, (const char * const) 0xA3C3, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05EC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 19
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05EC
+, Event_S_05EC, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA3D2
+, (const char * const) 0xA3D2, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05ED, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05ED
+, Event_S_05ED, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA3DD
+, (const char * const) 0xA3DD, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05EE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05EE
+, Event_S_05EE, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA3FD
+, (const char * const) 0xA3FD, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05EF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05EF
+, Event_S_05EF, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA427
+, (const char * const) 0xA427, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05F0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05F0
+, Event_S_05F0, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA444
+, (const char * const) 0xA444, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05F1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05F1
+, Event_S_05F1, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA46B
+, (const char * const) 0xA46B, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05F2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05F2
+, Event_S_05F2, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA485
+, (const char * const) 0xA485, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05F3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05F3
+, Event_S_05F3, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA4A8
+, (const char * const) 0xA4A8, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05F4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05F4
+, Event_S_05F4, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA4C3
+, (const char * const) 0xA4C3, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05F5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05F5
+, Event_S_05F5, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA4E7
+, (const char * const) 0xA4E7, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05F6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05F6
+, Event_S_05F6, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA50B
+, (const char * const) 0xA50B, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05F7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05F7
+, Event_S_05F7, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA52C
+, (const char * const) 0xA52C, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05F8, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05F8
+, Event_S_05F8, 0x14, 0x15, 0x18, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA546
+, (const char * const) 0xA546, 0x14, 0x15, 0x18, 1
 #endif
 },
 	{0x05F9, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05F9
+, Event_S_05F9, 0x14, 0x15, 0x18, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA55F
+, (const char * const) 0xA55F, 0x14, 0x15, 0x18, 1
 #endif
 },
 	{0x05FA, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05FA
+, Event_S_05FA, 0x19, 0x1A, 0x1D, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA581
+, (const char * const) 0xA581, 0x19, 0x1A, 0x1D, 1
 #endif
 },
 	{0x05FB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05FB
+, Event_S_05FB, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA59F
+, (const char * const) 0xA59F, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05FC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05FC
+, Event_S_05FC, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA5C2
+, (const char * const) 0xA5C2, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05FD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05FD
+, Event_S_05FD, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA5EF
+, (const char * const) 0xA5EF, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05FE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05FE
+, Event_S_05FE, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA60F
+, (const char * const) 0xA60F, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x05FF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_05FF
+, Event_S_05FF, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA639
+, (const char * const) 0xA639, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0600, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0600
+, Event_S_0600, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA656
+, (const char * const) 0xA656, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0601, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0601
+, Event_S_0601, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA67C
+, (const char * const) 0xA67C, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0602, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0602
+, Event_S_0602, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA69A
+, (const char * const) 0xA69A, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0603, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0603
+, Event_S_0603, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA6C1
+, (const char * const) 0xA6C1, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0604, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0604
+, Event_S_0604, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA6E8
+, (const char * const) 0xA6E8, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0605, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0605
+, Event_S_0605, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA70C
+, (const char * const) 0xA70C, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0606, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0606
+, Event_S_0606, 0x17, 0x18, 0x1B, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA729
+, (const char * const) 0xA729, 0x17, 0x18, 0x1B, 1
 #endif
 },
 	{0x0607, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0607
+, Event_S_0607, 0x17, 0x18, 0x1B, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA745
+, (const char * const) 0xA745, 0x17, 0x18, 0x1B, 1
 #endif
 },
 	{0x0608, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0608
+, Event_S_0608, 0x1C, 0x1D, 0x20, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA76A
+, (const char * const) 0xA76A, 0x1C, 0x1D, 0x20, 1
 #endif
 },
 	{0x0609, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0609
+, Event_S_0609, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA78B
+, (const char * const) 0xA78B, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x060A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_060A
+, Event_S_060A, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA7A4
+, (const char * const) 0xA7A4, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x060B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_060B
+, Event_S_060B, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA7C7
+, (const char * const) 0xA7C7, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x060C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_060C
+, Event_S_060C, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA7DD
+, (const char * const) 0xA7DD, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x060D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_060D
+, Event_S_060D, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA7FD
+, (const char * const) 0xA7FD, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x060E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_060E
+, Event_S_060E, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA810
+, (const char * const) 0xA810, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x060F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_060F
+, Event_S_060F, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA82C
+, (const char * const) 0xA82C, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0610, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0610
+, Event_S_0610, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA840
+, (const char * const) 0xA840, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0611, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0611
+, Event_S_0611, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA85D
+, (const char * const) 0xA85D, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0612, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0612
+, Event_S_0612, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA87A
+, (const char * const) 0xA87A, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0613, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0613
+, Event_S_0613, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA894
+, (const char * const) 0xA894, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0614, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0614
+, Event_S_0614, 0x0D, 0x0E, 0x11, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA8A7
+, (const char * const) 0xA8A7, 0x0D, 0x0E, 0x11, 1
 #endif
 },
 	{0x0615, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0615
+, Event_S_0615, 0x0D, 0x0E, 0x11, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA8B9
+, (const char * const) 0xA8B9, 0x0D, 0x0E, 0x11, 1
 #endif
 },
 	{0x0616, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0616
+, Event_S_0616, 0x12, 0x13, 0x16, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA8D4
+, (const char * const) 0xA8D4, 0x12, 0x13, 0x16, 1
 #endif
 },
 	{0x0617, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0617
+, Event_S_0617, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA8EB
+, (const char * const) 0xA8EB, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0618, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0618
+, Event_S_0618, 0x0F, 0x10, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA900
+, (const char * const) 0xA900, 0x0F, 0x10, 0x13, 1
 #endif
 },
 	{0x0619, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0619
+, Event_S_0619, 0x0F, 0x10, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA914
+, (const char * const) 0xA914, 0x0F, 0x10, 0x13, 1
 #endif
 },
 	{0x061A, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_061A
+, Event_S_061A, 0x14, 0x15, 0x18, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA931
+, (const char * const) 0xA931, 0x14, 0x15, 0x18, 1
 #endif
 },
 	{0x061B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_061B
+, Event_S_061B, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA94A
+, (const char * const) 0xA94A, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x061C, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_061C
+, Event_S_061C, 0x0F, 0x10, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA95F
+, (const char * const) 0xA95F, 0x0F, 0x10, 0x13, 1
 #endif
 },
 	{0x061D, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_061D
+, Event_S_061D, 0x0F, 0x10, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA973
+, (const char * const) 0xA973, 0x0F, 0x10, 0x13, 1
 #endif
 },
 	{0x061E, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_061E
+, Event_S_061E, 0x14, 0x15, 0x18, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA990
+, (const char * const) 0xA990, 0x14, 0x15, 0x18, 1
 #endif
 },
 	{0x061F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_061F
+, Event_S_061F, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA9A9
+, (const char * const) 0xA9A9, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0620, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0620
+, Event_S_0620, 0x16, 0x17, 0x1A, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA9C5
+, (const char * const) 0xA9C5, 0x16, 0x17, 0x1A, 1
 #endif
 },
 	{0x0621, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0621
+, Event_S_0621, 0x16, 0x17, 0x1A, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xA9E0
+, (const char * const) 0xA9E0, 0x16, 0x17, 0x1A, 1
 #endif
 },
 	{0x0622, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0622
+, Event_S_0622, 0x1B, 0x1C, 0x1F, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAA04
+, (const char * const) 0xAA04, 0x1B, 0x1C, 0x1F, 1
 #endif
 },
 	{0x0623, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0623
+, Event_S_0623, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAA24
+, (const char * const) 0xAA24, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0624, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0624
+, Event_S_0624, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAA47
+, (const char * const) 0xAA47, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0625, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0625
+, Event_S_0625, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAA74
+, (const char * const) 0xAA74, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0626, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0626
+, Event_S_0626, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAA94
+, (const char * const) 0xAA94, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0627, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0627
+, Event_S_0627, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAABE
+, (const char * const) 0xAABE, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0628, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0628
+, Event_S_0628, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAADB
+, (const char * const) 0xAADB, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0629, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0629
+, Event_S_0629, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAB01
+, (const char * const) 0xAB01, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x062A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_062A
+, Event_S_062A, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAB1F
+, (const char * const) 0xAB1F, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x062B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_062B
+, Event_S_062B, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAB46
+, (const char * const) 0xAB46, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x062C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_062C
+, Event_S_062C, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAB6A
+, (const char * const) 0xAB6A, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x062D, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_062D
+, Event_S_062D, 0x17, 0x18, 0x1B, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAB87
+, (const char * const) 0xAB87, 0x17, 0x18, 0x1B, 1
 #endif
 },
 	{0x062E, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_062E
+, Event_S_062E, 0x17, 0x18, 0x1B, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xABA3
+, (const char * const) 0xABA3, 0x17, 0x18, 0x1B, 1
 #endif
 },
 	{0x062F, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_062F
+, Event_S_062F, 0x1C, 0x1D, 0x20, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xABC8
+, (const char * const) 0xABC8, 0x1C, 0x1D, 0x20, 1
 #endif
 },
 	{0x0630, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0630
+, Event_S_0630, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xABE9
+, (const char * const) 0xABE9, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0631, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0631
+, Event_S_0631, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAC08
+, (const char * const) 0xAC08, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0632, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0632
+, Event_S_0632, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAC1A
+, (const char * const) 0xAC1A, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0633, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 19
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0633
+, Event_S_0633, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAC41
+, (const char * const) 0xAC41, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0634, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 19
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0634
+, Event_S_0634, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAC5C
+, (const char * const) 0xAC5C, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0635, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0635
+, Event_S_0635, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAC76
+, (const char * const) 0xAC76, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0636, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0636
+, Event_S_0636, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAC88
+, (const char * const) 0xAC88, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0637, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0637
+, Event_S_0637, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAC9D
+, (const char * const) 0xAC9D, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0638, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0638
+, Event_S_0638, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xACCB
+, (const char * const) 0xACCB, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0639, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0639
+, Event_S_0639, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xACDB
+, (const char * const) 0xACDB, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x063A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_063A
+, Event_S_063A, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xACE9
+, (const char * const) 0xACE9, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x063B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_063B
+, Event_S_063B, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xACF9
+, (const char * const) 0xACF9, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x063C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_063C
+, Event_S_063C, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAD03
+, (const char * const) 0xAD03, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x063D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_063D
+, Event_S_063D, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAD0B
+, (const char * const) 0xAD0B, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0641, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0641
+, Event_S_0641, 0x07, 0x08, 0x0B, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAD17
+, (const char * const) 0xAD17, 0x07, 0x08, 0x0B, 1
 #endif
 },
 	{0x0642, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0642
+, Event_S_0642, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAD23
+, (const char * const) 0xAD23, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0643, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0643
+, Event_S_0643, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAD3B
+, (const char * const) 0xAD3B, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0644, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0644
+, Event_S_0644, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAD53
+, (const char * const) 0xAD53, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0645, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0645
+, Event_S_0645, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAD69
+, (const char * const) 0xAD69, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0646, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0646
+, Event_S_0646, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAD80
+, (const char * const) 0xAD80, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0647, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0647
+, Event_S_0647, 0x07, 0x08, 0x0B, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAD98
+, (const char * const) 0xAD98, 0x07, 0x08, 0x0B, 1
 #endif
 },
 	{0x0648, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0648
+, Event_S_0648, 0x0C, 0x0D, 0x10, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xADAD
+, (const char * const) 0xADAD, 0x0C, 0x0D, 0x10, 1
 #endif
 },
 	{0x0649, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0649
+, Event_S_0649, 0x07, 0x08, 0x0B, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xADBE
+, (const char * const) 0xADBE, 0x07, 0x08, 0x0B, 1
 #endif
 },
 	{0x064A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_064A
+, Event_S_064A, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xADDD
+, (const char * const) 0xADDD, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x064B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_064B
+, Event_S_064B, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAE0B
+, (const char * const) 0xAE0B, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x064C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_064C
+, Event_S_064C, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAE39
+, (const char * const) 0xAE39, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x064D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_064D
+, Event_S_064D, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAE65
+, (const char * const) 0xAE65, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x064E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_064E
+, Event_S_064E, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAE92
+, (const char * const) 0xAE92, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x064F, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, true, false, 21
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_064F
+, Event_S_064F, 0x12, 0x19, 0x1C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAEC0
+, (const char * const) 0xAEC0, 0x12, 0x19, 0x1C, 1
 #endif
 },
 	{0x0650, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 21
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0650
+, Event_S_0650, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAEDD
+, (const char * const) 0xAEDD, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0651, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 21
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0651
+, Event_S_0651, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAEF4
+, (const char * const) 0xAEF4, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0652, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 21
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0652
+, Event_S_0652, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAF11
+, (const char * const) 0xAF11, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0653, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 21
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0653
+, Event_S_0653, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAF41
+, (const char * const) 0xAF41, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0654, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0654
+, Event_S_0654, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAF59
+, (const char * const) 0xAF59, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0655, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0655
+, Event_S_0655, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAF6B
+, (const char * const) 0xAF6B, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0656, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0656
+, Event_S_0656, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAF82
+, (const char * const) 0xAF82, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0657, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0657
+, Event_S_0657, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAF9A
+, (const char * const) 0xAF9A, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0658, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0658
+, Event_S_0658, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAFB2
+, (const char * const) 0xAFB2, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0659, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0659
+, Event_S_0659, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAFCA
+, (const char * const) 0xAFCA, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x065A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_065A
+, Event_S_065A, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAFE2
+, (const char * const) 0xAFE2, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x065B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_065B
+, Event_S_065B, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xAFFA
+, (const char * const) 0xAFFA, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x065C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_065C
+, Event_S_065C, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB012
+, (const char * const) 0xB012, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x065D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_065D
+, Event_S_065D, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB02B
+, (const char * const) 0xB02B, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x065E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_065E
+, Event_S_065E, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB043
+, (const char * const) 0xB043, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x065F, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_065F
+, Event_S_065F, 0x11, 0x12, 0x15, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB05B
+, (const char * const) 0xB05B, 0x11, 0x12, 0x15, 1
 #endif
 },
 	{0x0660, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0660
+, Event_S_0660, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB071
+, (const char * const) 0xB071, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0661, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 21
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0661
+, Event_S_0661, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB08E
+, (const char * const) 0xB08E, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0662, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 21
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0662
+, Event_S_0662, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB0AB
+, (const char * const) 0xB0AB, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0663, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 21
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0663
+, Event_S_0663, 0x24, 0x2B, 0x2E, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB0B9
+, (const char * const) 0xB0B9, 0x24, 0x2B, 0x2E, 1
 #endif
 },
 	{0x0664, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 21
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0664
+, Event_S_0664, 0x2C, 0x33, 0x36, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB0E8
+, (const char * const) 0xB0E8, 0x2C, 0x33, 0x36, 1
 #endif
 },
 	{0x0665, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 21
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0665
+, Event_S_0665, 0x1E, 0x25, 0x28, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB11F
+, (const char * const) 0xB11F, 0x1E, 0x25, 0x28, 1
 #endif
 },
 	{0x0666, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 21
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0666
+, Event_S_0666, 0x1C, 0x23, 0x26, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB148
+, (const char * const) 0xB148, 0x1C, 0x23, 0x26, 1
 #endif
 },
 	{0x0667, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 21
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0667
+, Event_S_0667, 0x1B, 0x22, 0x25, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB16F
+, (const char * const) 0xB16F, 0x1B, 0x22, 0x25, 1
 #endif
 },
 	{0x0668, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 21
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0668
+, Event_S_0668, 0x1A, 0x21, 0x24, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB195
+, (const char * const) 0xB195, 0x1A, 0x21, 0x24, 1
 #endif
 },
 	{0x0669, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 21
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0669
+, Event_S_0669, 0x1F, 0x26, 0x29, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB1BA
+, (const char * const) 0xB1BA, 0x1F, 0x26, 0x29, 1
 #endif
 },
 	{0x066A, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_066A
+, Event_S_066A, 0x07, 0x08, 0x0B, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB1E4
+, (const char * const) 0xB1E4, 0x07, 0x08, 0x0B, 1
 #endif
 },
 	{0x066B, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_066B
+, Event_S_066B, 0x07, 0x08, 0x0B, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB206
+, (const char * const) 0xB206, 0x07, 0x08, 0x0B, 1
 #endif
 },
 	{0x066C, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 21
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_066C
+, Event_S_066C, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB21C
+, (const char * const) 0xB21C, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x066D, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 21
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_066D
+, Event_S_066D, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB24F
+, (const char * const) 0xB24F, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x066E, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, true, false, 22
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_066E
+, Event_S_066E, 0x0F, 0x10, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB276
+, (const char * const) 0xB276, 0x0F, 0x10, 0x13, 1
 #endif
 },
 	{0x066F, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, true, false, 22
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_066F
+, Event_S_066F, 0x0F, 0x10, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB2A0
+, (const char * const) 0xB2A0, 0x0F, 0x10, 0x13, 1
 #endif
 },
 	{0x0670, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0670
+, Event_S_0670, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB2BE
+, (const char * const) 0xB2BE, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0671, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 21
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0671
+, Event_S_0671, 0x24, 0x2B, 0x2E, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB2CD
+, (const char * const) 0xB2CD, 0x24, 0x2B, 0x2E, 1
 #endif
 },
 	{0x0672, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0672
+, Event_S_0672, 0x07, 0x08, 0x0B, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB2FC
+, (const char * const) 0xB2FC, 0x07, 0x08, 0x0B, 1
 #endif
 },
 	{0x0673, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 21
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0673
+, Event_S_0673, 0x22, 0x29, 0x2C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB311
+, (const char * const) 0xB311, 0x22, 0x29, 0x2C, 1
 #endif
 },
 	{0x0674, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 21
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0674
+, Event_S_0674, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB33E
+, (const char * const) 0xB33E, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0675, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0675
+, Event_S_0675, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB355
+, (const char * const) 0xB355, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0676, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0676
+, Event_S_0676, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB36A
+, (const char * const) 0xB36A, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0677, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, true, false, 21
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0677
+, Event_S_0677, 0x1A, 0x21, 0x24, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB384
+, (const char * const) 0xB384, 0x1A, 0x21, 0x24, 1
 #endif
 },
 	{0x0678, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, true, false, 22
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0678
+, Event_S_0678, 0x0D, 0x0E, 0x11, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB3A9
+, (const char * const) 0xB3A9, 0x0D, 0x0E, 0x11, 1
 #endif
 },
 	{0x0679, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 21
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0679
+, Event_S_0679, 0x20, 0x21, 0x24, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB3BB
+, (const char * const) 0xB3BB, 0x20, 0x21, 0x24, 1
 #endif
 },
 	{0x067A, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 21
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_067A
+, Event_S_067A, 0x1F, 0x20, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB3E0
+, (const char * const) 0xB3E0, 0x1F, 0x20, 0x23, 1
 #endif
 },
 	{0x067B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 21
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_067B
+, Event_S_067B, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB404
+, (const char * const) 0xB404, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x067C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 21
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_067C
+, Event_S_067C, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB423
+, (const char * const) 0xB423, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x067D, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 21
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_067D
+, Event_S_067D, 0x1C, 0x23, 0x26, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB44C
+, (const char * const) 0xB44C, 0x1C, 0x23, 0x26, 1
 #endif
 },
 	{0x067E, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 22
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_067E
+, Event_S_067E, 0x18, 0x19, 0x1C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB473
+, (const char * const) 0xB473, 0x18, 0x19, 0x1C, 1
 #endif
 },
 	{0x067F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_067F
+, Event_S_067F, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB490
+, (const char * const) 0xB490, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0680, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 18
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0680
+, Event_S_0680, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB4AD
+, (const char * const) 0xB4AD, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0690, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, false, 38
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0690
+, Event_S_0690, 0x07, 0x08, 0x0B, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB4C7
+, (const char * const) 0xB4C7, 0x07, 0x08, 0x0B, 1
 #endif
 },
 	{0x0691, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 38
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0691
+, Event_S_0691, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB4E7
+, (const char * const) 0xB4E7, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0692, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 38
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0692
+, Event_S_0692, 0x15, 0x16, 0x19, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB513
+, (const char * const) 0xB513, 0x15, 0x16, 0x19, 1
 #endif
 },
 	{0x0693, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, false, 38
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0693
+, Event_S_0693, 0x12, 0x13, 0x16, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB541
+, (const char * const) 0xB541, 0x12, 0x13, 0x16, 1
 #endif
 },
 	{0x0694, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 38
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0694
+, Event_S_0694, 0x11, 0x12, 0x15, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB56C
+, (const char * const) 0xB56C, 0x11, 0x12, 0x15, 1
 #endif
 },
 	{0x0695, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 38
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0695
+, Event_S_0695, 0x14, 0x15, 0x18, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB596
+, (const char * const) 0xB596, 0x14, 0x15, 0x18, 1
 #endif
 },
 	{0x0696, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 38
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0696
+, Event_S_0696, 0x0F, 0x10, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB5C3
+, (const char * const) 0xB5C3, 0x0F, 0x10, 0x13, 1
 #endif
 },
 	{0x0697, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 38
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0697
+, Event_S_0697, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB5EB
+, (const char * const) 0xB5EB, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0698, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 38
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0698
+, Event_S_0698, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB629
+, (const char * const) 0xB629, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0699, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, false, 38
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0699
+, Event_S_0699, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB649
+, (const char * const) 0xB649, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x069A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, true, true, 38
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_069A
+, Event_S_069A, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB66E
+, (const char * const) 0xB66E, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x069B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 38
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_069B
+, Event_S_069B, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB687
+, (const char * const) 0xB687, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x069F, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 22
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_069F
+, Event_S_069F, 0x12, 0x13, 0x16, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB699
+, (const char * const) 0xB699, 0x12, 0x13, 0x16, 1
 #endif
 },
 	{0x06A0, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 22
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06A0
+, Event_S_06A0, 0x13, 0x14, 0x17, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB6B0
+, (const char * const) 0xB6B0, 0x13, 0x14, 0x17, 1
 #endif
 },
 	{0x06A4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06A4
+, Event_S_06A4, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB6C8
+, (const char * const) 0xB6C8, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x06A5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_XURGENT, false, true, true, 23
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06A5
+, Event_S_06A5, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB6F0
+, (const char * const) 0xB6F0, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x06A6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 23
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06A6
+, Event_S_06A6, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB715
+, (const char * const) 0xB715, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x06A7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 23
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06A7
+, Event_S_06A7, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB737
+, (const char * const) 0xB737, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x06A8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 23
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06A8
+, Event_S_06A8, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB749
+, (const char * const) 0xB749, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x06A9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 23
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06A9
+, Event_S_06A9, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB761
+, (const char * const) 0xB761, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x06AA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 23
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06AA
+, Event_S_06AA, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB78B
+, (const char * const) 0xB78B, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x06AB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_XURGENT, false, false, false, 23
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06AB
+, Event_S_06AB, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB7A3
+, (const char * const) 0xB7A3, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x06AC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_XURGENT, false, true, false, 23
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06AC
+, Event_S_06AC, 0x11, 0x1C, 0x28, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB7C6
+, (const char * const) 0xB7C6, 0x11, 0x1C, 0x28, 1
 #endif
 },
 	{0x06AD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06AD
+, Event_S_06AD, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB7EF
+, (const char * const) 0xB7EF, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x06AE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 23
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06AE
+, Event_S_06AE, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB816
+, (const char * const) 0xB816, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x06AF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 23
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06AF
+, Event_S_06AF, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB83A
+, (const char * const) 0xB83A, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x06B0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 12
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06B0
+, Event_S_06B0, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB85C
+, (const char * const) 0xB85C, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x06B8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 21
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06B8
+, Event_S_06B8, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB869
+, (const char * const) 0xB869, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x06B9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 21
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06B9
+, Event_S_06B9, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB881
+, (const char * const) 0xB881, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x06C3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 24
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06C3
+, Event_S_06C3, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB8A9
+, (const char * const) 0xB8A9, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x06C4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 24
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06C4
+, Event_S_06C4, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB8C7
+, (const char * const) 0xB8C7, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x06C5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 24
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06C5
+, Event_S_06C5, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB8E1
+, (const char * const) 0xB8E1, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x06C6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 24
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06C6
+, Event_S_06C6, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB8FB
+, (const char * const) 0xB8FB, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x06C7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 24
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06C7
+, Event_S_06C7, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB918
+, (const char * const) 0xB918, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x06C8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 23
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06C8
+, Event_S_06C8, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB93D
+, (const char * const) 0xB93D, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x06C9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 24
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06C9
+, Event_S_06C9, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB972
+, (const char * const) 0xB972, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x06CA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 24
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06CA
+, Event_S_06CA, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB989
+, (const char * const) 0xB989, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x06CB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 24
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06CB
+, Event_S_06CB, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB9A9
+, (const char * const) 0xB9A9, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x06CC, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06CC
+, Event_S_06CC, 0x2B, 0x2C, 0x2F, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB9C9
+, (const char * const) 0xB9C9, 0x2B, 0x2C, 0x2F, 1
 #endif
 },
 	{0x06CD, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06CD
+, Event_S_06CD, 0x24, 0x25, 0x28, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xB9F9
+, (const char * const) 0xB9F9, 0x24, 0x25, 0x28, 1
 #endif
 },
 	{0x06D7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 24
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06D7
+, Event_S_06D7, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBA22
+, (const char * const) 0xBA22, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x06D8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 24
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06D8
+, Event_S_06D8, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBA38
+, (const char * const) 0xBA38, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x06D9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 24
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06D9
+, Event_S_06D9, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBA4A
+, (const char * const) 0xBA4A, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x06DA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 24
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06DA
+, Event_S_06DA, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBA5C
+, (const char * const) 0xBA5C, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x06DB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 24
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06DB
+, Event_S_06DB, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBA71
+, (const char * const) 0xBA71, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x06DC, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06DC
+, Event_S_06DC, 0x16, 0x17, 0x1A, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBA80
+, (const char * const) 0xBA80, 0x16, 0x17, 0x1A, 1
 #endif
 },
 	{0x06DD, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06DD
+, Event_S_06DD, 0x16, 0x17, 0x1A, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBA9B
+, (const char * const) 0xBA9B, 0x16, 0x17, 0x1A, 1
 #endif
 },
 	{0x06DE, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06DE
+, Event_S_06DE, 0x1B, 0x1C, 0x1F, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBABF
+, (const char * const) 0xBABF, 0x1B, 0x1C, 0x1F, 1
 #endif
 },
 	{0x06DF, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06DF
+, Event_S_06DF, 0x16, 0x17, 0x1A, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBADF
+, (const char * const) 0xBADF, 0x16, 0x17, 0x1A, 1
 #endif
 },
 	{0x06E0, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06E0
+, Event_S_06E0, 0x0F, 0x10, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBAFA
+, (const char * const) 0xBAFA, 0x0F, 0x10, 0x13, 1
 #endif
 },
 	{0x06E1, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06E1
+, Event_S_06E1, 0x1B, 0x1C, 0x1F, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBB17
+, (const char * const) 0xBB17, 0x1B, 0x1C, 0x1F, 1
 #endif
 },
 	{0x06E2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 24
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06E2
+, Event_S_06E2, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBB37
+, (const char * const) 0xBB37, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x06E3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 24
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06E3
+, Event_S_06E3, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBB58
+, (const char * const) 0xBB58, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x06E4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 24
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06E4
+, Event_S_06E4, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBB6A
+, (const char * const) 0xBB6A, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x06E5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 23
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06E5
+, Event_S_06E5, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBB87
+, (const char * const) 0xBB87, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x06E6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 24
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06E6
+, Event_S_06E6, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBBB4
+, (const char * const) 0xBBB4, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x06E7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 24
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06E7
+, Event_S_06E7, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBBCC
+, (const char * const) 0xBBCC, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x06E8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 23
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06E8
+, Event_S_06E8, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBBF1
+, (const char * const) 0xBBF1, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x06E9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 23
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06E9
+, Event_S_06E9, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBC38
+, (const char * const) 0xBC38, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x06EA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 24
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06EA
+, Event_S_06EA, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBC57
+, (const char * const) 0xBC57, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x06EB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 13
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06EB
+, Event_S_06EB, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBC66
+, (const char * const) 0xBC66, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x06F4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, false, 39
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06F4
+, Event_S_06F4, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBC76
+, (const char * const) 0xBC76, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x06F5, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, true, false, 39
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06F5
+, Event_S_06F5, 0x1A, 0x21, 0x24, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBC98
+, (const char * const) 0xBC98, 0x1A, 0x21, 0x24, 1
 #endif
 },
 	{0x06F6, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, true, true, 39
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06F6
+, Event_S_06F6, 0x2C, 0x33, 0x36, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBCBD
+, (const char * const) 0xBCBD, 0x2C, 0x33, 0x36, 1
 #endif
 },
 	{0x06F7, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, true, true, 39
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06F7
+, Event_S_06F7, 0x26, 0x2D, 0x30, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBCF4
+, (const char * const) 0xBCF4, 0x26, 0x2D, 0x30, 1
 #endif
 },
 	{0x06F8, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, true, true, 39
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06F8
+, Event_S_06F8, 0x24, 0x2B, 0x2E, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBD25
+, (const char * const) 0xBD25, 0x24, 0x2B, 0x2E, 1
 #endif
 },
 	{0x06F9, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, true, true, 39
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06F9
+, Event_S_06F9, 0x2C, 0x33, 0x36, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBD54
+, (const char * const) 0xBD54, 0x2C, 0x33, 0x36, 1
 #endif
 },
 	{0x06FA, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, true, true, 39
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06FA
+, Event_S_06FA, 0x2A, 0x31, 0x34, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBD8B
+, (const char * const) 0xBD8B, 0x2A, 0x31, 0x34, 1
 #endif
 },
 	{0x06FB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, false, true, 39
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06FB
+, Event_S_06FB, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBDC0
+, (const char * const) 0xBDC0, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x06FC, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, true, true, true, 39
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06FC
+, Event_S_06FC, 0x24, 0x2B, 0x2E, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBDE3
+, (const char * const) 0xBDE3, 0x24, 0x2B, 0x2E, 1
 #endif
 },
 	{0x06FD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, true, false, true, 39
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06FD
+, Event_S_06FD, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBE12
+, (const char * const) 0xBE12, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x06FE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 39
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_06FE
+, Event_S_06FE, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBE2B
+, (const char * const) 0xBE2B, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0709, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 25
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0709
+, Event_S_0709, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBE3D
+, (const char * const) 0xBE3D, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x070A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 25
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_070A
+, Event_S_070A, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBE5C
+, (const char * const) 0xBE5C, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x070B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 25
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_070B
+, Event_S_070B, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBE7D
+, (const char * const) 0xBE7D, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x070C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 25
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_070C
+, Event_S_070C, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBEA4
+, (const char * const) 0xBEA4, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x070D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 25
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_070D
+, Event_S_070D, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBECC
+, (const char * const) 0xBECC, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x070E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 25
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_070E
+, Event_S_070E, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBEFC
+, (const char * const) 0xBEFC, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x070F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_070F
+, Event_S_070F, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBF13
+, (const char * const) 0xBF13, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0710, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0710
+, Event_S_0710, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBF4F
+, (const char * const) 0xBF4F, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0711, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0711
+, Event_S_0711, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBF95
+, (const char * const) 0xBF95, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0712, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0712
+, Event_S_0712, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xBFCE
+, (const char * const) 0xBFCE, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0713, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0713
+, Event_S_0713, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC011
+, (const char * const) 0xC011, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0714, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0714
+, Event_S_0714, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC047
+, (const char * const) 0xC047, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0715, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0715
+, Event_S_0715, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC086
+, (const char * const) 0xC086, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0716, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0716
+, Event_S_0716, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC0BD
+, (const char * const) 0xC0BD, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0717, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0717
+, Event_S_0717, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC0FD
+, (const char * const) 0xC0FD, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0718, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0718
+, Event_S_0718, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC13D
+, (const char * const) 0xC13D, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0719, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0719
+, Event_S_0719, 0x23, 0x24, 0x27, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC17A
+, (const char * const) 0xC17A, 0x23, 0x24, 0x27, 1
 #endif
 },
 	{0x071A, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_071A
+, Event_S_071A, 0x23, 0x24, 0x27, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC1A2
+, (const char * const) 0xC1A2, 0x23, 0x24, 0x27, 1
 #endif
 },
 	{0x071B, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_071B
+, Event_S_071B, 0x28, 0x29, 0x2C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC1D3
+, (const char * const) 0xC1D3, 0x28, 0x29, 0x2C, 1
 #endif
 },
 	{0x071C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_071C
+, Event_S_071C, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC200
+, (const char * const) 0xC200, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x071D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_071D
+, Event_S_071D, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC22B
+, (const char * const) 0xC22B, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x071E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_071E
+, Event_S_071E, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC260
+, (const char * const) 0xC260, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x071F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_071F
+, Event_S_071F, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC288
+, (const char * const) 0xC288, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0720, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0720
+, Event_S_0720, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC2BA
+, (const char * const) 0xC2BA, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0721, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0721
+, Event_S_0721, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC2DF
+, (const char * const) 0xC2DF, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0722, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0722
+, Event_S_0722, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC30D
+, (const char * const) 0xC30D, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0723, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 2
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0723
+, Event_S_0723, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC333
+, (const char * const) 0xC333, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0724, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0724
+, Event_S_0724, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC362
+, (const char * const) 0xC362, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0725, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 1
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0725
+, Event_S_0725, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC391
+, (const char * const) 0xC391, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0726, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0726
+, Event_S_0726, 0x1F, 0x20, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC3BD
+, (const char * const) 0xC3BD, 0x1F, 0x20, 0x23, 1
 #endif
 },
 	{0x0727, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0727
+, Event_S_0727, 0x1F, 0x20, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC3E1
+, (const char * const) 0xC3E1, 0x1F, 0x20, 0x23, 1
 #endif
 },
 	{0x0728, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0728
+, Event_S_0728, 0x24, 0x25, 0x28, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC40E
+, (const char * const) 0xC40E, 0x24, 0x25, 0x28, 1
 #endif
 },
 	{0x0729, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 25
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0729
+, Event_S_0729, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC437
+, (const char * const) 0xC437, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x072A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 25
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_072A
+, Event_S_072A, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC451
+, (const char * const) 0xC451, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x072B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 25
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_072B
+, Event_S_072B, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC474
+, (const char * const) 0xC474, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x072C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 25
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_072C
+, Event_S_072C, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC48D
+, (const char * const) 0xC48D, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x072D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 25
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_072D
+, Event_S_072D, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC4B1
+, (const char * const) 0xC4B1, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x072E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 25
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_072E
+, Event_S_072E, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC4C3
+, (const char * const) 0xC4C3, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x072F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 25
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_072F
+, Event_S_072F, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC4EA
+, (const char * const) 0xC4EA, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0730, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 25
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0730
+, Event_S_0730, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC507
+, (const char * const) 0xC507, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0731, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 25
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0731
+, Event_S_0731, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC52A
+, (const char * const) 0xC52A, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0732, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 25
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0732
+, Event_S_0732, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC555
+, (const char * const) 0xC555, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0733, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 25
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0733
+, Event_S_0733, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC576
+, (const char * const) 0xC576, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0734, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 25
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0734
+, Event_S_0734, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC5A4
+, (const char * const) 0xC5A4, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0735, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 25
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0735
+, Event_S_0735, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC5DA
+, (const char * const) 0xC5DA, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0736, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 25
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0736
+, Event_S_0736, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC60C
+, (const char * const) 0xC60C, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0737, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 25
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0737
+, Event_S_0737, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC646
+, (const char * const) 0xC646, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0738, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, true, 25
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0738
+, Event_S_0738, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC672
+, (const char * const) 0xC672, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0739, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 25
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0739
+, Event_S_0739, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC691
+, (const char * const) 0xC691, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x073A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 25
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_073A
+, Event_S_073A, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC6B0
+, (const char * const) 0xC6B0, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x073B, RDS_TMC_QUANTIFIER_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 26
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_073B
+, Event_S_073B, 0x16, 0x17, 0x1A, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC6D7
+, (const char * const) 0xC6D7, 0x16, 0x17, 0x1A, 1
 #endif
 },
 	{0x073C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 26
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_073C
+, Event_S_073C, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC6F2
+, (const char * const) 0xC6F2, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x073E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_073E
+, Event_S_073E, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC70F
+, (const char * const) 0xC70F, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x073F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_073F
+, Event_S_073F, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC735
+, (const char * const) 0xC735, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0740, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0740
+, Event_S_0740, 0x21, 0x28, 0x2B, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC75B
+, (const char * const) 0xC75B, 0x21, 0x28, 0x2B, 1
 #endif
 },
 	{0x0741, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 26
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0741
+, Event_S_0741, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC787
+, (const char * const) 0xC787, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0742, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0742
+, Event_S_0742, 0x13, 0x14, 0x17, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC799
+, (const char * const) 0xC799, 0x13, 0x14, 0x17, 1
 #endif
 },
 	{0x0745, RDS_TMC_QUANTIFIER_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 26
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0745
+, Event_S_0745, 0x17, 0x18, 0x1B, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC7B1
+, (const char * const) 0xC7B1, 0x17, 0x18, 0x1B, 1
 #endif
 },
 	{0x0746, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, false, 26
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0746
+, Event_S_0746, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC7CD
+, (const char * const) 0xC7CD, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0747, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 25
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0747
+, Event_S_0747, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC7EB
+, (const char * const) 0xC7EB, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0748, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 25
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0748
+, Event_S_0748, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC814
+, (const char * const) 0xC814, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0749, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 25
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0749
+, Event_S_0749, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC843
+, (const char * const) 0xC843, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x074A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 25
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_074A
+, Event_S_074A, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC888
+, (const char * const) 0xC888, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x074B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 25
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_074B
+, Event_S_074B, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC8D0
+, (const char * const) 0xC8D0, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x074C, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_074C
+, Event_S_074C, 0x2B, 0x2C, 0x2F, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC900
+, (const char * const) 0xC900, 0x2B, 0x2C, 0x2F, 1
 #endif
 },
 	{0x074D, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_074D
+, Event_S_074D, 0x2B, 0x2C, 0x2F, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC930
+, (const char * const) 0xC930, 0x2B, 0x2C, 0x2F, 1
 #endif
 },
 	{0x074E, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_074E
+, Event_S_074E, 0x30, 0x31, 0x34, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC969
+, (const char * const) 0xC969, 0x30, 0x31, 0x34, 1
 #endif
 },
 	{0x074F, RDS_TMC_QUANTIFIER_TONNES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 26
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_074F
+, Event_S_074F, 0x1A, 0x1B, 0x1E, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC99E
+, (const char * const) 0xC99E, 0x1A, 0x1B, 0x1E, 1
 #endif
 },
 	{0x0750, RDS_TMC_QUANTIFIER_TONNES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 26
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0750
+, Event_S_0750, 0x1D, 0x1E, 0x21, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC9BD
+, (const char * const) 0xC9BD, 0x1D, 0x1E, 0x21, 1
 #endif
 },
 	{0x0751, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 26
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0751
+, Event_S_0751, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xC9DF
+, (const char * const) 0xC9DF, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0752, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 26
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0752
+, Event_S_0752, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCA03
+, (const char * const) 0xCA03, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0753, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 25
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0753
+, Event_S_0753, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCA26
+, (const char * const) 0xCA26, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0754, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0754
+, Event_S_0754, 0x2D, 0x2E, 0x31, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCA5E
+, (const char * const) 0xCA5E, 0x2D, 0x2E, 0x31, 1
 #endif
 },
 	{0x0755, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0755
+, Event_S_0755, 0x2D, 0x2E, 0x31, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCA90
+, (const char * const) 0xCA90, 0x2D, 0x2E, 0x31, 1
 #endif
 },
 	{0x0756, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0756
+, Event_S_0756, 0x32, 0x33, 0x36, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCACB
+, (const char * const) 0xCACB, 0x32, 0x33, 0x36, 1
 #endif
 },
 	{0x0757, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 25
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0757
+, Event_S_0757, 0x00, 0x01, 0x0C, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCB02
+, (const char * const) 0xCB02, 0x00, 0x01, 0x0C, 1
 #endif
 },
 	{0x0758, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0758
+, Event_S_0758, 0x34, 0x35, 0x38, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCB3C
+, (const char * const) 0xCB3C, 0x34, 0x35, 0x38, 1
 #endif
 },
 	{0x0759, RDS_TMC_QUANTIFIER_METERS, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 26
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0759
+, Event_S_0759, 0x17, 0x18, 0x1B, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCB75
+, (const char * const) 0xCB75, 0x17, 0x18, 0x1B, 1
 #endif
 },
 	{0x075A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 26
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_075A
+, Event_S_075A, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCB91
+, (const char * const) 0xCB91, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x075B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 27
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_075B
+, Event_S_075B, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCBAF
+, (const char * const) 0xCBAF, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x075C, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_075C
+, Event_S_075C, 0x34, 0x35, 0x38, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCBC1
+, (const char * const) 0xCBC1, 0x34, 0x35, 0x38, 1
 #endif
 },
 	{0x075D, RDS_TMC_QUANTIFIER_UPTO_MINUTES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 20
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_075D
+, Event_S_075D, 0x39, 0x3A, 0x3D, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCC03
+, (const char * const) 0xCC03, 0x39, 0x3A, 0x3D, 1
 #endif
 },
 	{0x075E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 27
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_075E
+, Event_S_075E, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCC41
+, (const char * const) 0xCC41, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x075F, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 27
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_075F
+, Event_S_075F, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCC64
+, (const char * const) 0xCC64, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0760, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0760
+, Event_S_0760, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCC8A
+, (const char * const) 0xCC8A, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0761, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0761
+, Event_S_0761, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCC93
+, (const char * const) 0xCC93, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0762, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0762
+, Event_S_0762, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCC9C
+, (const char * const) 0xCC9C, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0763, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0763
+, Event_S_0763, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCCA5
+, (const char * const) 0xCCA5, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0764, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0764
+, Event_S_0764, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCCAE
+, (const char * const) 0xCCAE, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0765, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0765
+, Event_S_0765, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCCB7
+, (const char * const) 0xCCB7, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0766, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0766
+, Event_S_0766, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCCC0
+, (const char * const) 0xCCC0, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0767, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0767
+, Event_S_0767, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCCC9
+, (const char * const) 0xCCC9, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0768, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0768
+, Event_S_0768, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCCD2
+, (const char * const) 0xCCD2, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0769, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0769
+, Event_S_0769, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCCDB
+, (const char * const) 0xCCDB, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x076A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_076A
+, Event_S_076A, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCD01
+, (const char * const) 0xCD01, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x076B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_076B
+, Event_S_076B, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCD27
+, (const char * const) 0xCD27, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x076C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_076C
+, Event_S_076C, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCD4D
+, (const char * const) 0xCD4D, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x076D, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, true, false, 22
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_076D
+, Event_S_076D, 0x0F, 0x10, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCD73
+, (const char * const) 0xCD73, 0x0F, 0x10, 0x13, 1
 #endif
 },
 	{0x076E, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, true, false, 22
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_076E
+, Event_S_076E, 0x0F, 0x10, 0x13, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCD87
+, (const char * const) 0xCD87, 0x0F, 0x10, 0x13, 1
 #endif
 },
 	{0x076F, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 28
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_076F
+, Event_S_076F, 0x09, 0x0A, 0x0D, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCDAE
+, (const char * const) 0xCDAE, 0x09, 0x0A, 0x0D, 1
 #endif
 },
 	{0x0770, RDS_TMC_QUANTIFIER_PERCENT, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 28
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0770
+, Event_S_0770, 0x0E, 0x0F, 0x12, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCDC1
+, (const char * const) 0xCDC1, 0x0E, 0x0F, 0x12, 1
 #endif
 },
 	{0x0771, RDS_TMC_QUANTIFIER_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0771
+, Event_S_0771, 0x0A, 0x0B, 0x0E, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCDD9
+, (const char * const) 0xCDD9, 0x0A, 0x0B, 0x0E, 1
 #endif
 },
 	{0x0772, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 21
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0772
+, Event_S_0772, 0x20, 0x27, 0x2A, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCE05
+, (const char * const) 0xCE05, 0x20, 0x27, 0x2A, 1
 #endif
 },
 	{0x0773, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 31
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0773
+, Event_S_0773, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCE30
+, (const char * const) 0xCE30, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0774, RDS_TMC_QUANTIFIER_MHZ, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 29
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0774
+, Event_S_0774, 0x16, 0x1A, 0x1D, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCE3D
+, (const char * const) 0xCE3D, 0x16, 0x1A, 0x1D, 1
 #endif
 },
 	{0x0775, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, true, false, 29
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0775
+, Event_S_0775, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCE5B
+, (const char * const) 0xCE5B, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0776, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, true, true, false, 29
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0776
+, Event_S_0776, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCEB3
+, (const char * const) 0xCEB3, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0777, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 29
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0777
+, Event_S_0777, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCF08
+, (const char * const) 0xCF08, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0779, RDS_TMC_QUANTIFIER_KHZ, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 29
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0779
+, Event_S_0779, 0x16, 0x1A, 0x1D, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCF1A
+, (const char * const) 0xCF1A, 0x16, 0x1A, 0x1D, 1
 #endif
 },
 	{0x077A, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 30
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_077A
+, Event_S_077A, 0x19, 0x20, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCF38
+, (const char * const) 0xCF38, 0x19, 0x20, 0x23, 1
 #endif
 },
 	{0x077B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 31
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_077B
+, Event_S_077B, 0x27, 0x2F, 0x32, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCF5C
+, (const char * const) 0xCF5C, 0x27, 0x2F, 0x32, 1
 #endif
 },
 	{0x077C, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 30
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_077C
+, Event_S_077C, 0x19, 0x20, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCF9E
+, (const char * const) 0xCF9E, 0x19, 0x20, 0x23, 1
 #endif
 },
 	{0x077D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 25
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_077D
+, Event_S_077D, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xCFDC
+, (const char * const) 0xCFDC, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x077E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, true, 28
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_077E
+, Event_S_077E, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD00C
+, (const char * const) 0xD00C, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0780, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0780
+, Event_S_0780, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD011
+, (const char * const) 0xD011, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0781, RDS_TMC_QUANTIFIER_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0781
+, Event_S_0781, 0x00, 0x01, 0x04, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD035
+, (const char * const) 0xD035, 0x00, 0x01, 0x04, 1
 #endif
 },
 	{0x0782, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, false, true, 28
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0782
+, Event_S_0782, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD053
+, (const char * const) 0xD053, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0783, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, false, true, 28
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0783
+, Event_S_0783, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD06E
+, (const char * const) 0xD06E, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0784, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 28
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0784
+, Event_S_0784, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD091
+, (const char * const) 0xD091, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0785, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0785
+, Event_S_0785, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD0AC
+, (const char * const) 0xD0AC, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0786, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 28
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0786
+, Event_S_0786, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD0DE
+, (const char * const) 0xD0DE, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0787, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 27
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0787
+, Event_S_0787, 0x0B, 0x12, 0x15, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD0FA
+, (const char * const) 0xD0FA, 0x0B, 0x12, 0x15, 1
 #endif
 },
 	{0x0788, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 27
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0788
+, Event_S_0788, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD110
+, (const char * const) 0xD110, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0789, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, true, true, 29
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0789
+, Event_S_0789, 0x21, 0x25, 0x28, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD134
+, (const char * const) 0xD134, 0x21, 0x25, 0x28, 1
 #endif
 },
 	{0x078A, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 30
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_078A
+, Event_S_078A, 0x1F, 0x26, 0x29, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD17C
+, (const char * const) 0xD17C, 0x1F, 0x26, 0x29, 1
 #endif
 },
 	{0x078B, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_URGENT, false, true, true, 29
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_078B
+, Event_S_078B, 0x23, 0x27, 0x2A, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD1A6
+, (const char * const) 0xD1A6, 0x23, 0x27, 0x2A, 1
 #endif
 },
 	{0x078C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 30
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_078C
+, Event_S_078C, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD1F0
+, (const char * const) 0xD1F0, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x078E, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_078E
+, Event_S_078E, 0x27, 0x2E, 0x31, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD228
+, (const char * const) 0xD228, 0x27, 0x2E, 0x31, 1
 #endif
 },
 	{0x0792, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0792
+, Event_S_0792, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD25A
+, (const char * const) 0xD25A, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0793, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 30
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0793
+, Event_S_0793, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD284
+, (const char * const) 0xD284, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0794, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 30
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0794
+, Event_S_0794, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD2B4
+, (const char * const) 0xD2B4, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0795, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 30
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0795
+, Event_S_0795, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD2F7
+, (const char * const) 0xD2F7, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0796, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 30
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0796
+, Event_S_0796, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD337
+, (const char * const) 0xD337, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0797, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 30
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0797
+, Event_S_0797, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD382
+, (const char * const) 0xD382, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0798, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 30
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0798
+, Event_S_0798, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD3C2
+, (const char * const) 0xD3C2, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x0799, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 30
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_0799
+, Event_S_0799, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD3EF
+, (const char * const) 0xD3EF, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x079A, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, true, true, 30
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_079A
+, Event_S_079A, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD421
+, (const char * const) 0xD421, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x079B, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 30
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_079B
+, Event_S_079B, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD450
+, (const char * const) 0xD450, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x079C, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 30
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_079C
+, Event_S_079C, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD48A
+, (const char * const) 0xD48A, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x079D, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 30
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_079D
+, Event_S_079D, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD4C1
+, (const char * const) 0xD4C1, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x079E, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 30
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_079E
+, Event_S_079E, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD4F6
+, (const char * const) 0xD4F6, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x079F, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 30
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_079F
+, Event_S_079F, 0x25, 0x2C, 0x2F, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD51A
+, (const char * const) 0xD51A, 0x25, 0x2C, 0x2F, 1
 #endif
 },
 	{0x07A0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 30
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07A0
+, Event_S_07A0, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD54A
+, (const char * const) 0xD54A, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07A1, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 30
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07A1
+, Event_S_07A1, 0x24, 0x28, 0x2B, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD574
+, (const char * const) 0xD574, 0x24, 0x28, 0x2B, 1
 #endif
 },
 	{0x07A2, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_FORECAST, RDS_TMC_URGENCY_NORMAL, false, true, true, 30
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07A2
+, Event_S_07A2, 0x1F, 0x23, 0x26, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD5A0
+, (const char * const) 0xD5A0, 0x1F, 0x23, 0x26, 1
 #endif
 },
 	{0x07A3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 29
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07A3
+, Event_S_07A3, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD5C7
+, (const char * const) 0xD5C7, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07A4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 30
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07A4
+, Event_S_07A4, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD5F5
+, (const char * const) 0xD5F5, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07A5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 30
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07A5
+, Event_S_07A5, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD625
+, (const char * const) 0xD625, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07A9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07A9
+, Event_S_07A9, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD66C
+, (const char * const) 0xD66C, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07AA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 10
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07AA
+, Event_S_07AA, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD6A1
+, (const char * const) 0xD6A1, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07AB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 10
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07AB
+, Event_S_07AB, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD6C9
+, (const char * const) 0xD6C9, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07AC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 30
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07AC
+, Event_S_07AC, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD6F7
+, (const char * const) 0xD6F7, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07AD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 30
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07AD
+, Event_S_07AD, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD71E
+, (const char * const) 0xD71E, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07AE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 30
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07AE
+, Event_S_07AE, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD73F
+, (const char * const) 0xD73F, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07AF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 30
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07AF
+, Event_S_07AF, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD76F
+, (const char * const) 0xD76F, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07B3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07B3
+, Event_S_07B3, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD799
+, (const char * const) 0xD799, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07B4, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07B4
+, Event_S_07B4, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD7B2
+, (const char * const) 0xD7B2, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07B5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07B5
+, Event_S_07B5, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD7D5
+, (const char * const) 0xD7D5, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07B6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07B6
+, Event_S_07B6, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD7FE
+, (const char * const) 0xD7FE, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07B7, RDS_TMC_QUANTIFIER_TONNES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07B7
+, Event_S_07B7, 0x29, 0x2F, 0x32, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD81F
+, (const char * const) 0xD81F, 0x29, 0x2F, 0x32, 1
 #endif
 },
 	{0x07B8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07B8
+, Event_S_07B8, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD852
+, (const char * const) 0xD852, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07B9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, true, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07B9
+, Event_S_07B9, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD868
+, (const char * const) 0xD868, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07BA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07BA
+, Event_S_07BA, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD8A3
+, (const char * const) 0xD8A3, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07BB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07BB
+, Event_S_07BB, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD8D1
+, (const char * const) 0xD8D1, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07BC, RDS_TMC_QUANTIFIER_TONNES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07BC
+, Event_S_07BC, 0x28, 0x2E, 0x31, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD905
+, (const char * const) 0xD905, 0x28, 0x2E, 0x31, 1
 #endif
 },
 	{0x07BD, RDS_TMC_QUANTIFIER_TONNES, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07BD
+, Event_S_07BD, 0x19, 0x1F, 0x22, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD937
+, (const char * const) 0xD937, 0x19, 0x1F, 0x22, 1
 #endif
 },
 	{0x07BE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, false, 6
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07BE
+, Event_S_07BE, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD985
+, (const char * const) 0xD985, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07BF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 25
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07BF
+, Event_S_07BF, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD994
+, (const char * const) 0xD994, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07C1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07C1
+, Event_S_07C1, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD9A2
+, (const char * const) 0xD9A2, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07C2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, true, false, true, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07C2
+, Event_S_07C2, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD9C0
+, (const char * const) 0xD9C0, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07C6, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, true, true, 28
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07C6
+, Event_S_07C6, 0x10, 0x17, 0x1A, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xD9E7
+, (const char * const) 0xD9E7, 0x10, 0x17, 0x1A, 1
 #endif
 },
 	{0x07C7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 13
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07C7
+, Event_S_07C7, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDA02
+, (const char * const) 0xDA02, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07C9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 28
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07C9
+, Event_S_07C9, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDA28
+, (const char * const) 0xDA28, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07CA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 28
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07CA
+, Event_S_07CA, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDA4C
+, (const char * const) 0xDA4C, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07CB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 28
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07CB
+, Event_S_07CB, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDA6E
+, (const char * const) 0xDA6E, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07CE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 7
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07CE
+, Event_S_07CE, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDA92
+, (const char * const) 0xDA92, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07CF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, false, 8
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07CF
+, Event_S_07CF, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDAB8
+, (const char * const) 0xDAB8, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07D0, RDS_TMC_QUANTIFIER_TIME, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, true, true, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07D0
+, Event_S_07D0, 0x19, 0x20, 0x23, 1
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDADF
+, (const char * const) 0xDADF, 0x19, 0x20, 0x23, 1
 #endif
 },
 	{0x07D6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 10
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07D6
+, Event_S_07D6, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDB03
+, (const char * const) 0xDB03, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07D7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, true, false, false, 10
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07D7
+, Event_S_07D7, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDB36
+, (const char * const) 0xDB36, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07DD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07DD
+, Event_S_07DD, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDB61
+, (const char * const) 0xDB61, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07E5, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, true, 21
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07E5
+, Event_S_07E5, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDB73
+, (const char * const) 0xDB73, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07E6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 21
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07E6
+, Event_S_07E6, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDBA7
+, (const char * const) 0xDBA7, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07EC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 4
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07EC
+, Event_S_07EC, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDBBF
+, (const char * const) 0xDBBF, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07ED, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 10
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07ED
+, Event_S_07ED, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDBD1
+, (const char * const) 0xDBD1, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07EE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 13
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07EE
+, Event_S_07EE, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDBE3
+, (const char * const) 0xDBE3, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07F0, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 35
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07F0
+, Event_S_07F0, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDBF5
+, (const char * const) 0xDBF5, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07F1, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 19
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07F1
+, Event_S_07F1, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDC07
+, (const char * const) 0xDC07, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07F2, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 21
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07F2
+, Event_S_07F2, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDC19
+, (const char * const) 0xDC19, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07F3, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 22
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07F3
+, Event_S_07F3, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDC2B
+, (const char * const) 0xDC2B, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07F6, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 28
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07F6
+, Event_S_07F6, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDC3D
+, (const char * const) 0xDC3D, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07F7, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 30
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07F7
+, Event_S_07F7, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDC4F
+, (const char * const) 0xDC4F, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07F8, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, false, false, 31
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07F8
+, Event_S_07F8, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDC61
+, (const char * const) 0xDC61, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07F9, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, true, true, 31
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07F9
+, Event_S_07F9, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDC73
+, (const char * const) 0xDC73, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07FA, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 13
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07FA
+, Event_S_07FA, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDC85
+, (const char * const) 0xDC85, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07FB, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_NORMAL, false, false, false, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07FB
+, Event_S_07FB, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDCA5
+, (const char * const) 0xDCA5, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07FC, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07FC
+, Event_S_07FC, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDCB1
+, (const char * const) 0xDCB1, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07FD, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 14
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07FD
+, Event_S_07FD, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDCC8
+, (const char * const) 0xDCC8, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07FE, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_INFORMATION, RDS_TMC_URGENCY_URGENT, false, false, true, 9
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07FE
+, Event_S_07FE, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDCD5
+, (const char * const) 0xDCD5, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 	{0x07FF, RDS_TMC_QUANTIFIER_SMALL_NUMBER, RDS_TMC_NATURE_SILENT, RDS_TMC_URGENCY_NORMAL, false, true, true, 31
 #if defined(WITH_RDS_TMC_EVENT_STRINGS_FLASH)
-, Event_S_07FF
+, Event_S_07FF, 0xFF, 0xFF, 0x00, 0
 #elif defined(WITH_RDS_TMC_EVENT_STRINGS_EEPROM)
-, (const char * const) 0xDD00
+, (const char * const) 0xDD00, 0xFF, 0xFF, 0x00, 0
 #endif
 },
 };
@@ -0,0 +1,1881 @@
+/*
+ * ISO 14819-2 header file: supplementary information entries
+ * DO NOT EDIT: automatically generated by gentables.py from CSV files
+ */
+
+#ifndef _ISO14819_2_SUPPLEMENTARY_COMPRESSED_H_INCLUDED
+#define _ISO14819_2_SUPPLEMENTARY_COMPRESSED_H_INCLUDED
+#ifdef WITH_RDS_TMC_SUPPLEMENTARY
+
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+const char Supplementary_S_01[] PROGMEM = "\315\314\231\210r\337e\200\224\207\230comm\236d\203\304\314o\267\352\207\224ea";
+const char Supplementary_S_02[] PROGMEM = "fol\247 signs";
+const char Supplementary_S_03[] PROGMEM = "fol\247\347iv\222si\215 signs";
+const char Supplementary_S_04[] PROGMEM = "div\222si\215 \206 o\250\205\243";
+const char Supplementary_S_05[] PROGMEM = "n\244su\253\322l\207div\222si\215 \314a\254\322\233";
+const char Supplementary_S_06[] PROGMEM = "div\222si\215 i\200n\244\210ng\307\230comm\236d\203";
+const char Supplementary_S_07[] PROGMEM = "f\241\276cep\243a\274\210\235\200\215ly";
+const char Supplementary_S_08[] PROGMEM = "f\241\315\314\231\311\200\215ly";
+const char Supplementary_S_09[] PROGMEM = "f\241\370\200\216d \354gh\245\311\200\215ly";
+const char Supplementary_S_0A[] PROGMEM = "s\350wp\210ugh\200\206 u\260";
+const char Supplementary_S_0B[] PROGMEM = "gr\253t\252\311\200\206 u\260";
+const char Supplementary_S_0C[] PROGMEM = "d\337v\207\370efully";
+const char Supplementary_S_0D[] PROGMEM = "keep yo\300\347i\327\216ce";
+const char Supplementary_S_0E[] PROGMEM = "ob\376v\207sign\335s";
+const char Supplementary_S_0F[] PROGMEM = "\346\222tak\207\377\374\370e";
+const char Supplementary_S_10[] PROGMEM = "c\226s\200j\341c\243 \377\374\370e";
+const char Supplementary_S_11[] PROGMEM = "n\244\346\222tak\221";
+const char Supplementary_S_12[] PROGMEM = "us\207\315\235\354ghts";
+const char Supplementary_S_13[] PROGMEM = "us\207fog \354ghts";
+const char Supplementary_S_14[] PROGMEM = "d\244\350\245\233\314\207yo\300 \311";
+const char Supplementary_S_15[] PROGMEM = "s\377c\374\237f \236g\206e";
+const char Supplementary_S_16[] PROGMEM = "\320\207\335\274w\206dows\211T\300n \237f \315at\307\216d v\321s";
+const char Supplementary_S_17[] PROGMEM = "tes\245yo\300 b\205kes";
+const char Supplementary_S_18[] PROGMEM = "w\206t\307equipm\236\245\230comm\236d\203";
+const char Supplementary_S_19[] PROGMEM = "s\350w cha\206\200\230comm\236d\203";
+const char Supplementary_S_1A[] PROGMEM = "s\350w cha\206\200m\216dat\212y";
+const char Supplementary_S_1B[] PROGMEM = "keep\201o\352\207\233ft";
+const char Supplementary_S_1C[] PROGMEM = "keep\201o\352\207\337ght";
+const char Supplementary_S_1D[] PROGMEM = "us\207h\224d should\307a\200\255";
+const char Supplementary_S_1E[] PROGMEM = "d\244\350\245d\337v\207\215\352\207h\224d should\222";
+const char Supplementary_S_1F[] PROGMEM = "\206\352\207oppos\253\207di\230c\243";
+const char Supplementary_S_20[] PROGMEM = "\206\352\207oppos\252\255s";
+const char Supplementary_S_21[] PROGMEM = "\206\352\207\346\222tak\252\255";
+const char Supplementary_S_22[] PROGMEM = "\206\352\207c\205wl\307\255";
+const char Supplementary_S_23[] PROGMEM = "\206\352\207\337gh\245\255";
+const char Supplementary_S_24[] PROGMEM = "\206\352\207m\267dl\207\255";
+const char Supplementary_S_25[] PROGMEM = "\206\352\207\233f\245\255";
+const char Supplementary_S_26[] PROGMEM = "\215\352\207\305w\261";
+const char Supplementary_S_27[] PROGMEM = "pol\202\207di\230\303\333";
+const char Supplementary_S_28[] PROGMEM = "pol\202\207\206 att\236d\216ce";
+const char Supplementary_S_29[] PROGMEM = "\276t\205 pol\202\207pat\226l\200\206 o\250\205\243";
+const char Supplementary_S_2A[] PROGMEM = "\230scu\207\216d \230c\346\222\231\265 \206 p\226g\230\363";
+const char Supplementary_S_2B[] PROGMEM = "\210ok out\227\212\227l\330m\216";
+const char Supplementary_S_2C[] PROGMEM = "wh\231\350\245p\224k-\216d-r\267e?";
+const char Supplementary_S_2D[] PROGMEM = "wh\231\350t\201r\231publ\202\201\205nsp\212t?";
+const char Supplementary_S_2E[] PROGMEM = "\215ly\201\205\246\274if \322solut\251\231nece\363\224y";
+const char Supplementary_S_2F[] PROGMEM = "\206c\230as\232\337sk \356\375";
+const char Supplementary_S_30[] PROGMEM = "\215 br\267ges";
+const char Supplementary_S_31[] PROGMEM = "\206 sh\235\232\224eas";
+const char Supplementary_S_32[] PROGMEM = "\321\222\252\241\233\314\221\201\341n\251s";
+const char Supplementary_S_33[] PROGMEM = "w\206t\307\320u\230";
+const char Supplementary_S_34[] PROGMEM = "batc\374\376v\202\207\206 p\226g\230\363";
+const char Supplementary_S_35[] PROGMEM = "th\207n\212th";
+const char Supplementary_S_36[] PROGMEM = "th\207n\212th-ea\327";
+const char Supplementary_S_37[] PROGMEM = "th\207ea\327";
+const char Supplementary_S_38[] PROGMEM = "th\207south-ea\327";
+const char Supplementary_S_39[] PROGMEM = "th\207south";
+const char Supplementary_S_3A[] PROGMEM = "th\207south-we\327";
+const char Supplementary_S_3B[] PROGMEM = "th\207we\327";
+const char Supplementary_S_3C[] PROGMEM = "th\207n\212th-we\327";
+const char Supplementary_S_3D[] PROGMEM = "fol\247 s\250cia\274div\222si\215 m\224k\222s";
+const char Supplementary_S_3E[] PROGMEM = "d\244\350t\227ol\247\347iv\222si\215 signs";
+const char Supplementary_S_3F[] PROGMEM = "fol\247 \210ca\274div\222si\215";
+const char Supplementary_S_40[] PROGMEM = "compuls\212\231div\222si\215 \206 o\250\205\243";
+const char Supplementary_S_41[] PROGMEM = "f\241\250t\226l-\236g\206\232\311\200\215ly";
+const char Supplementary_S_42[] PROGMEM = "f\241dies\251-\236g\206\232\311\200\215ly";
+const char Supplementary_S_43[] PROGMEM = "f\241LPG \311\200\215ly";
+const char Supplementary_S_44[] PROGMEM = "\210ca\274d\337v\222\200\224\207\230comm\236d\203\304\314o\267\352\207\224ea";
+const char Supplementary_S_45[] PROGMEM = "f\2414-w\315\251-d\337v\207\377\374s\350w\201y\230\200\241cha\206\200\215ly";
+const char Supplementary_S_46[] PROGMEM = "\206\352\207m\203i\216";
+const char Supplementary_S_47[] PROGMEM = "f\241\370\200\215ly";
+const char Supplementary_S_48[] PROGMEM = "f\241\354gh\245\311\200\215ly";
+const char Supplementary_S_49[] PROGMEM = "f\241\311\200\377\374cat\335yt\202 \362v\222t\222s";
+const char Supplementary_S_4A[] PROGMEM = "f\241\311\200\377hou\245cat\335yt\202 \362v\222t\222s";
+const char Supplementary_S_4B[] PROGMEM = "f\241\370\200\377h\201\205\254\222\200\215ly";
+const char Supplementary_S_4C[] PROGMEM = "f\241\370\200\377\374ca\205v\216\200\215ly";
+const char Supplementary_S_4D[] PROGMEM = "f\241\311\200\377h\201\205\254\222\200\215ly";
+const char Supplementary_S_4E[] PROGMEM = "f\241\315\314\231\210r\337e\200\215ly";
+const char Supplementary_S_4F[] PROGMEM = "f\241bu\260\200\215ly";
+const char Supplementary_S_50[] PROGMEM = "f\241\224t\202ulat\232\311\200\215ly";
+const char Supplementary_S_51[] PROGMEM = "f\241high-s\267\232\311\200\215ly";
+const char Supplementary_S_52[] PROGMEM = "f\241haz\224dou\200\210\235\200\215ly";
+const char Supplementary_S_53[] PROGMEM = "f\241\322n\212\372\274\210\235\200\215ly";
+const char Supplementary_S_54[] PROGMEM = "\377\374ev\236-numb\222\232\230gi\327\205\243 plates";
+const char Supplementary_S_55[] PROGMEM = "\377\374odd-numb\222\232\230gi\327\205\243 plates";
+const char Supplementary_S_56[] PROGMEM = "f\241\335\274\311s";
+const char Supplementary_S_58[] PROGMEM = "f\212\352\226ugh\223";
+const char Supplementary_S_59[] PROGMEM = "f\241\205\254 \376v\202es";
+const char Supplementary_S_5A[] PROGMEM = "\215\352\207\341d\222g\226\341d";
+const char Supplementary_S_5B[] PROGMEM = "d\326\222";
+const char Supplementary_S_5C[] PROGMEM = "\230pair\200\206 p\226g\230\363";
+const char Supplementary_S_5D[] PROGMEM = "pi\210\245\370 \206 o\250\205\243";
+const char Supplementary_S_5E[] PROGMEM = "em\222g\236c\231\311\200a\245sc\236e";
+const char Supplementary_S_5F[] PROGMEM = "t\220 be\252di\230\303\232\224o\341d \357\236\245\224ea";
+const char Supplementary_S_60[] PROGMEM = "d\326\307\356\276p\210si\215";
+const char Supplementary_S_61[] PROGMEM = "d\326\307\237\227i\230";
+const char Supplementary_S_62[] PROGMEM = "\205di\306 haz\224d";
+const char Supplementary_S_63[] PROGMEM = "tox\202 \233ak";
+const char Supplementary_S_64[] PROGMEM = "fi\230m\236\347i\230\303\333";
+const char Supplementary_S_65[] PROGMEM = "pol\202\207s\250\232c\315\351\200\206 o\250\205\243";
+const char Supplementary_S_66[] PROGMEM = "m\216dat\212\231s\250\232\354mi\245\206\227\212ce";
+const char Supplementary_S_67[] PROGMEM = "s\250\232\354mi\245\206\227\212c\207f\241\315\314\231\311s";
+const char Supplementary_S_68[] PROGMEM = "\373\207yo\300 s\250\203";
+const char Supplementary_S_69[] PROGMEM = "ob\376v\207s\250\232\354m\253s";
+const char Supplementary_S_6A[] PROGMEM = "ob\376v\207\230comm\236d\232s\250\203";
+const char Supplementary_S_6B[] PROGMEM = "s\350w cha\206\200\230qui\365";
+const char Supplementary_S_6C[] PROGMEM = "s\350w cha\206\200\212\201y\230\200\230qi\365";
+const char Supplementary_S_6D[] PROGMEM = "h\251\202opt\307\230scu\207\206 p\226g\230\363";
+const char Supplementary_S_6E[] PROGMEM = "\260\246\205\274\357\236\310ha\246\201ak\236 pl\271e";
+const char Supplementary_S_6F[] PROGMEM = "d\337v\207\377\374\276t\230m\207cau\243";
+const char Supplementary_S_70[] PROGMEM = "app\226\271\374\377\374\370e";
+const char Supplementary_S_71[] PROGMEM = "\206c\230as\207n\212m\335\227ol\247\252di\327\216ce";
+const char Supplementary_S_72[] PROGMEM = "d\244\350\245\335\247 \341nece\363\224\231gaps";
+const char Supplementary_S_73[] PROGMEM = "fol\247\352\207\302l\207\206\227r\215t, smoothly";
+const char Supplementary_S_74[] PROGMEM = "d\244\350\245s\247\347own \341necce\363\224\254y";
+const char Supplementary_S_75[] PROGMEM = "ob\376v\207signs";
+const char Supplementary_S_76[] PROGMEM = "us\207haz\224d w\224n\252\354ghts";
+const char Supplementary_S_77[] PROGMEM = "n\244smok\221";
+const char Supplementary_S_78[] PROGMEM = "n\244nak\203\227la\336s";
+const char Supplementary_S_79[] PROGMEM = "s\377c\374\237f mob\254\207ph\215e\200\216d\201wo-wa\231\205dios";
+const char Supplementary_S_7A[] PROGMEM = "\335\247 em\222g\236c\231\311\200t\244pa\363";
+const char Supplementary_S_7B[] PROGMEM = "c\233\224 a \242\207f\241em\222g\236c\231\311s";
+const char Supplementary_S_7C[] PROGMEM = "pul\274\346\222\201o\352\207\203g\207\237\352\207\305w\261";
+const char Supplementary_S_7D[] PROGMEM = "wa\253\257esc\212\245\311";
+const char Supplementary_S_7E[] PROGMEM = "\206 em\222g\236cy, wa\253\257pol\202\207pat\226l";
+const char Supplementary_S_80[] PROGMEM = "\327op a\245n\276\245saf\207pl\271e";
+const char Supplementary_S_81[] PROGMEM = "c\233\224 a \242\207f\241s\350wp\210ugh\200\216d gr\253t\252\311s";
+const char Supplementary_S_83[] PROGMEM = "us\207\337gh\245\255";
+const char Supplementary_S_84[] PROGMEM = "us\207\233f\245\255";
+const char Supplementary_S_85[] PROGMEM = "\315\314\231\311\200us\207\337gh\245\255";
+const char Supplementary_S_86[] PROGMEM = "\315\314\231\311\200us\207\233f\245\255";
+const char Supplementary_S_88[] PROGMEM = "\327op a\245n\276\245\376v\202\207\224ea";
+const char Supplementary_S_8D[] PROGMEM = "\215\352\207\337ght";
+const char Supplementary_S_8E[] PROGMEM = "\206\352\207c\321\230";
+const char Supplementary_S_8F[] PROGMEM = "\215\352\207\233ft";
+const char Supplementary_S_90[] PROGMEM = "\206\352\207bu\200\255";
+const char Supplementary_S_91[] PROGMEM = "\206\352\207\370poo\274\255";
+const char Supplementary_S_92[] PROGMEM = "\215\352\207h\224d should\222";
+const char Supplementary_S_93[] PROGMEM = "\206\352\207em\222g\236c\231\255";
+const char Supplementary_S_94[] PROGMEM = "\215\352\207oppos\253\207\370\337\330ew\261";
+const char Supplementary_S_95[] PROGMEM = "\206\352\207\315\314\231\302l\207\255";
+const char Supplementary_S_96[] PROGMEM = "\206\352\207\210ca\274\255";
+const char Supplementary_S_97[] PROGMEM = "d\273\304\315at";
+const char Supplementary_S_98[] PROGMEM = "d\273\201o\227\226\327";
+const char Supplementary_S_99[] PROGMEM = "f\212\227\222r\231\376v\202e";
+const char Supplementary_S_9A[] PROGMEM = "f\241\305\200\206";
+const char Supplementary_S_9B[] PROGMEM = "\206\201\315\352\226ugh\223 \255";
+const char Supplementary_S_9C[] PROGMEM = "\206\352\207\276p\230s\200\255";
+const char Supplementary_S_9D[] PROGMEM = "\206\352\207\362ne\303\252\370\337\330ew\261";
+const char Supplementary_S_9E[] PROGMEM = "\206\352\207pa\205l\233\274\370\337\330ew\261";
+const char Supplementary_S_9F[] PROGMEM = "\206\352\207\337ght-h\216d pa\205l\233\274\370\337\330ew\261";
+const char Supplementary_S_A0[] PROGMEM = "\206\352\207\233ft-h\216d pa\205l\233\274\370\337\330ew\261";
+const char Supplementary_S_A1[] PROGMEM = "\206\201\341n\251s";
+const char Supplementary_S_A2[] PROGMEM = "\215 s\354p \305s";
+const char Supplementary_S_A3[] PROGMEM = "a\245hig\374\335\234tudes";
+const char Supplementary_S_A4[] PROGMEM = "\206 \247-ly\252\224eas";
+const char Supplementary_S_A5[] PROGMEM = "\224o\341d a b\236d \206\352\207\305";
+const char Supplementary_S_A6[] PROGMEM = "\346\222\352\207c\230s\245\356a h\254l";
+const char Supplementary_S_A7[] PROGMEM = "\206\352\207c\355c\321\230";
+const char Supplementary_S_A8[] PROGMEM = "\206\352\207\206n\307c\355\224ea";
+const char Supplementary_S_A9[] PROGMEM = "\206\352\207s\247 \302l\207\255";
+const char Supplementary_S_AA[] PROGMEM = "\206\201\315\201\300n\252\255";
+const char Supplementary_S_AB[] PROGMEM = "d\273\304\216 e\224\354\307\375";
+const char Supplementary_S_AC[] PROGMEM = "d\273\304s\315\224 weigh\245\237\223";
+const char Supplementary_S_AD[] PROGMEM = "d\273\304l\224g\207numb\222\200\356vis\253\212s";
+const char Supplementary_S_AE[] PROGMEM = "d\273\304hol\267\261\223";
+const char Supplementary_S_AF[] PROGMEM = "d\273\201o\201echn\202a\274p\226b\233ms";
+const char Supplementary_S_B0[] PROGMEM = "tow\224d\200town";
+const char Supplementary_S_B1[] PROGMEM = "f\226m\201own";
+const char Supplementary_S_B2[] PROGMEM = "\215 \321r\231\206to\352\207co\341try";
+const char Supplementary_S_B3[] PROGMEM = "\215 \233\314\221\352\207co\341try";
+const char Supplementary_S_B4[] PROGMEM = "d\244\350t\352\226w ou\245\216\231b\300n\252obje\303s";
+const char Supplementary_S_B5[] PROGMEM = "t\220 w\224d\236\200di\230\303\333";
+const char Supplementary_S_B9[] PROGMEM = "d\273\201o\227\335l\252\202e";
+const char Supplementary_S_BF[] PROGMEM = "s\350w\201y\230\200\230comm\236d\203";
+const char Supplementary_S_C0[] PROGMEM = "s\350w\201y\230\200m\216dat\212y";
+const char Supplementary_S_C3[] PROGMEM = "u\260\352\226ugh\223 \255s";
+const char Supplementary_S_C4[] PROGMEM = "us\207\210c\335\223 \255s";
+const char Supplementary_S_C5[] PROGMEM = "us\207\233ft-h\216d pa\205l\233\274\370\337\330ew\261";
+const char Supplementary_S_C6[] PROGMEM = "us\207\337ght-h\216d pa\205l\233\274\370\337\330ew\261";
+const char Supplementary_S_C7[] PROGMEM = "us\207\315\314\231\302l\207\255";
+const char Supplementary_S_C8[] PROGMEM = "d\273\304\216 e\224\354\307\206\345\321";
+const char Supplementary_S_C9[] PROGMEM = "wh\231\350\245r\267\207sh\224e?";
+const char Supplementary_S_CA[] PROGMEM = "i\200thi\200yo\300 \350-r\267\207d\261?";
+const char Supplementary_S_CB[] PROGMEM = "d\273\304\216 e\224\354\307ev\321";
+const char Supplementary_S_CC[] PROGMEM = "p\233as\207us\207\205\254 \376v\202e";
+const char Supplementary_S_CD[] PROGMEM = "p\233as\207us\207\341d\222g\226\341d \376v\202e";
+const char Supplementary_S_CE[] PROGMEM = "p\233as\207u\260\201\205m \376v\202e";
+const char Supplementary_S_CF[] PROGMEM = "p\233as\207us\207bu\200\376v\202e";
+const char Supplementary_S_D0[] PROGMEM = "f\241a \354m\253\203\201i\336";
+const char Supplementary_S_D1[] PROGMEM = "yo\300 p\224k\221\201\202ke\245c\346\222\200th\207\230t\300n r\267e";
+const char Supplementary_S_D2[] PROGMEM = "\314o\267\352\207rus\374ho\300";
+const char Supplementary_S_D3[] PROGMEM = "f\241hol\267\261\223";
+const char Supplementary_S_D4[] PROGMEM = "f\241\230s\267\321s";
+const char Supplementary_S_D5[] PROGMEM = "\260\246\205l\201i\336s";
+const char Supplementary_S_D6[] PROGMEM = "d\300\221\352\207d\261\201i\336";
+const char Supplementary_S_D7[] PROGMEM = "d\300\252\237f-\250ak p\222iods";
+const char Supplementary_S_D8[] PROGMEM = "d\300\221\352\207night";
+const char Supplementary_S_D9[] PROGMEM = "\341\234l\227\300th\307\350t\202e";
+const char Supplementary_S_DA[] PROGMEM = "f\241\224\337v\335s";
+const char Supplementary_S_DB[] PROGMEM = "f\241dep\224tu\230s";
+const char Supplementary_S_DC[] PROGMEM = "\271ces\200\215ly";
+const char Supplementary_S_DD[] PROGMEM = "\215ly";
+const char Supplementary_S_DE[] PROGMEM = "\276cept";
+const char Supplementary_S_DF[] PROGMEM = "f\241\210ng\347i\327\216ce\223";
+const char Supplementary_S_E0[] PROGMEM = "f\241\210c\335\223";
+const char Supplementary_S_E1[] PROGMEM = "f\241\230gi\215\335\223";
+const char Supplementary_S_E2[] PROGMEM = "\341\362firm\232\230p\212t";
+const char Supplementary_S_E3[] PROGMEM = "\215 m\216ua\274p\261m\236\245\255s";
+const char Supplementary_S_E7[] PROGMEM = "s\212ry\257\216\231d\312";
+const char Supplementary_S_E8[] PROGMEM = "f\241\305\200\233\235\221\201ow\224ds";
+const char Supplementary_S_E9[] PROGMEM = "f\241\305\200f\226m";
+const char Supplementary_S_EA[] PROGMEM = "w\207\224\207g\205teful\257yo\300 coo\250\205\243";
+const char Supplementary_S_EB[] PROGMEM = "T\220 q\332\207\233ngth\347ec\230as\252a\245\216 a\246\205g\207\205t\207\35610\264/hr";
+const char Supplementary_S_EC[] PROGMEM = "T\220 q\332\207\233ngth\347ec\230as\252a\245\216 a\246\205g\207\205t\207\35620\264/hr";
+const char Supplementary_S_ED[] PROGMEM = "T\220 q\332\207\233ngth\347ec\230as\252a\245\216 a\246\205g\207\205t\207\35630\264/hr";
+const char Supplementary_S_EE[] PROGMEM = "T\220 q\332\207\233ngth\347ec\230as\252a\245\216 a\246\205g\207\205t\207\35640\264/hr";
+const char Supplementary_S_EF[] PROGMEM = "\233\314\207yo\300 \311\211P\226ce\203\304n\276\245s\314\207pl\271e";
+const char Supplementary_S_F0[] PROGMEM = "f\241vis\253\212s";
+const char Supplementary_S_F1[] PROGMEM = "\206\352\207\305\265\200\224ea";
+const char Supplementary_S_F2[] PROGMEM = "f\226m";
+const char Supplementary_S_F3[] PROGMEM = "to";
+const char Supplementary_S_F4[] PROGMEM = "\206";
+const char Supplementary_S_F5[] PROGMEM = "T\220 q\332\207\233ngt\374\206c\230as\221";
+const char Supplementary_S_F6[] PROGMEM = "T\220 q\332\207\233ngt\374\206c\230as\252a\245\216 a\246\205g\207\205t\207\35610\264/hr";
+const char Supplementary_S_F7[] PROGMEM = "T\220 q\332\207\233ngt\374\206c\230as\252a\245\216 a\246\205g\207\205t\207\35620\264/hr";
+const char Supplementary_S_F8[] PROGMEM = "T\220 q\332\207\233ngt\374\206c\230as\252a\245\216 a\246\205g\207\205t\207\35630\264/hr";
+const char Supplementary_S_F9[] PROGMEM = "T\220 q\332\207\233ngt\374\206c\230as\252a\245\216 a\246\205g\207\205t\207\35640\264/hr";
+const char Supplementary_S_FA[] PROGMEM = "v\222y\227\230qu\236\245\376v\202e";
+const char Supplementary_S_FB[] PROGMEM = "f\230qu\236\245\376v\202e";
+const char Supplementary_S_FC[] PROGMEM = "fairly\227\230qu\236\245\376v\202e";
+const char Supplementary_S_FD[] PROGMEM = "\230gul\224 \376v\202e";
+const char Supplementary_S_FF[] PROGMEM = "T\220 q\332\207\233ngth\347ec\230as\221";
+#endif
+
+const TRDSTMCSupplementaryEntry ISO14819_2_Supplementary[233] PROGMEM = {
+	{0x01
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_01
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0000
+#endif
+},
+	{0x02
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_02
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x001C
+#endif
+},
+	{0x03
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_03
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0027
+#endif
+},
+	{0x04
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_04
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0039
+#endif
+},
+	{0x05
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_05
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0048
+#endif
+},
+	{0x06
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_06
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x005E
+#endif
+},
+	{0x07
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_07
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0077
+#endif
+},
+	{0x08
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_08
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0087
+#endif
+},
+	{0x09
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_09
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0092
+#endif
+},
+	{0x0A
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_0A
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x00A3
+#endif
+},
+	{0x0B
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_0B
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x00B1
+#endif
+},
+	{0x0C
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_0C
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x00BD
+#endif
+},
+	{0x0D
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_0D
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x00C9
+#endif
+},
+	{0x0E
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_0E
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x00D8
+#endif
+},
+	{0x0F
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_0F
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x00E4
+#endif
+},
+	{0x10
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_10
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x00EF
+#endif
+},
+	{0x11
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_11
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x00FD
+#endif
+},
+	{0x12
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_12
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0106
+#endif
+},
+	{0x13
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_13
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0111
+#endif
+},
+	{0x14
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_14
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x011E
+#endif
+},
+	{0x15
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_15
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x012B
+#endif
+},
+	{0x16
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_16
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0137
+#endif
+},
+	{0x17
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_17
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0154
+#endif
+},
+	{0x18
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_18
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0162
+#endif
+},
+	{0x19
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_19
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0177
+#endif
+},
+	{0x1A
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_1A
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0189
+#endif
+},
+	{0x1B
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_1B
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x019A
+#endif
+},
+	{0x1C
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_1C
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x01A6
+#endif
+},
+	{0x1D
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_1D
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x01B3
+#endif
+},
+	{0x1E
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_1E
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x01C5
+#endif
+},
+	{0x1F
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_1F
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x01DC
+#endif
+},
+	{0x20
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_20
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x01EC
+#endif
+},
+	{0x21
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_21
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x01F8
+#endif
+},
+	{0x22
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_22
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0203
+#endif
+},
+	{0x23
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_23
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x020D
+#endif
+},
+	{0x24
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_24
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0216
+#endif
+},
+	{0x25
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_25
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0220
+#endif
+},
+	{0x26
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_26
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0228
+#endif
+},
+	{0x27
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_27
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x022F
+#endif
+},
+	{0x28
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_28
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x023A
+#endif
+},
+	{0x29
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_29
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x024A
+#endif
+},
+	{0x2A
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_2A
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0260
+#endif
+},
+	{0x2B
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_2B
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0277
+#endif
+},
+	{0x2C
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_2C
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0286
+#endif
+},
+	{0x2D
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_2D
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0297
+#endif
+},
+	{0x2E
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_2E
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x02AD
+#endif
+},
+	{0x2F
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_2F
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x02C7
+#endif
+},
+	{0x30
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_30
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x02D4
+#endif
+},
+	{0x31
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_31
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x02DD
+#endif
+},
+	{0x32
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_32
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x02E8
+#endif
+},
+	{0x33
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_33
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x02F5
+#endif
+},
+	{0x34
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_34
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x02FD
+#endif
+},
+	{0x35
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_35
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x030E
+#endif
+},
+	{0x36
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_36
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0316
+#endif
+},
+	{0x37
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_37
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0322
+#endif
+},
+	{0x38
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_38
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0329
+#endif
+},
+	{0x39
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_39
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0336
+#endif
+},
+	{0x3A
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_3A
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x033F
+#endif
+},
+	{0x3B
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_3B
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x034C
+#endif
+},
+	{0x3C
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_3C
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0353
+#endif
+},
+	{0x3D
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_3D
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x035F
+#endif
+},
+	{0x3E
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_3E
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0378
+#endif
+},
+	{0x3F
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_3F
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x038E
+#endif
+},
+	{0x40
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_40
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x039F
+#endif
+},
+	{0x41
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_41
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x03B7
+#endif
+},
+	{0x42
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_42
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x03C8
+#endif
+},
+	{0x43
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_43
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x03DA
+#endif
+},
+	{0x44
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_44
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x03E6
+#endif
+},
+	{0x45
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_45
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0403
+#endif
+},
+	{0x46
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_46
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0422
+#endif
+},
+	{0x47
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_47
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x042A
+#endif
+},
+	{0x48
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_48
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0432
+#endif
+},
+	{0x49
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_49
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x043E
+#endif
+},
+	{0x4A
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_4A
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0453
+#endif
+},
+	{0x4B
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_4B
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x046B
+#endif
+},
+	{0x4C
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_4C
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x047A
+#endif
+},
+	{0x4D
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_4D
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x048A
+#endif
+},
+	{0x4E
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_4E
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0499
+#endif
+},
+	{0x4F
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_4F
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x04A7
+#endif
+},
+	{0x50
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_50
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x04B1
+#endif
+},
+	{0x51
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_51
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x04C1
+#endif
+},
+	{0x52
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_52
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x04D1
+#endif
+},
+	{0x53
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_53
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x04E2
+#endif
+},
+	{0x54
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_54
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x04F0
+#endif
+},
+	{0x55
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_55
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x050A
+#endif
+},
+	{0x56
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_56
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0524
+#endif
+},
+	{0x58
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_58
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x052B
+#endif
+},
+	{0x59
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_59
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0534
+#endif
+},
+	{0x5A
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_5A
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x053F
+#endif
+},
+	{0x5B
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_5B
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x054A
+#endif
+},
+	{0x5C
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_5C
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x054E
+#endif
+},
+	{0x5D
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_5D
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x055C
+#endif
+},
+	{0x5E
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_5E
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0569
+#endif
+},
+	{0x5F
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_5F
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0579
+#endif
+},
+	{0x60
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_60
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0590
+#endif
+},
+	{0x61
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_61
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x059B
+#endif
+},
+	{0x62
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_62
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x05A3
+#endif
+},
+	{0x63
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_63
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x05AE
+#endif
+},
+	{0x64
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_64
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x05B7
+#endif
+},
+	{0x65
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_65
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x05C2
+#endif
+},
+	{0x66
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_66
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x05D5
+#endif
+},
+	{0x67
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_67
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x05E9
+#endif
+},
+	{0x68
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_68
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x05FD
+#endif
+},
+	{0x69
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_69
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0607
+#endif
+},
+	{0x6A
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_6A
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0614
+#endif
+},
+	{0x6B
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_6B
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0625
+#endif
+},
+	{0x6C
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_6C
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0634
+#endif
+},
+	{0x6D
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_6D
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0647
+#endif
+},
+	{0x6E
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_6E
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x065B
+#endif
+},
+	{0x6F
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_6F
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x066F
+#endif
+},
+	{0x70
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_70
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x067F
+#endif
+},
+	{0x71
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_71
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x068A
+#endif
+},
+	{0x72
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_72
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x06A0
+#endif
+},
+	{0x73
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_73
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x06B4
+#endif
+},
+	{0x74
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_74
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x06CD
+#endif
+},
+	{0x75
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_75
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x06E3
+#endif
+},
+	{0x76
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_76
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x06EE
+#endif
+},
+	{0x77
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_77
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0701
+#endif
+},
+	{0x78
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_78
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0709
+#endif
+},
+	{0x79
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_79
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0715
+#endif
+},
+	{0x7A
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_7A
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0735
+#endif
+},
+	{0x7B
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_7B
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0747
+#endif
+},
+	{0x7C
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_7C
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x075B
+#endif
+},
+	{0x7D
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_7D
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x076F
+#endif
+},
+	{0x7E
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_7E
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x077A
+#endif
+},
+	{0x80
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_80
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0794
+#endif
+},
+	{0x81
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_81
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x07A6
+#endif
+},
+	{0x83
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_83
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x07C4
+#endif
+},
+	{0x84
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_84
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x07CD
+#endif
+},
+	{0x85
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_85
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x07D5
+#endif
+},
+	{0x86
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_86
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x07E3
+#endif
+},
+	{0x88
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_88
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x07F0
+#endif
+},
+	{0x8D
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_8D
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0801
+#endif
+},
+	{0x8E
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_8E
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0809
+#endif
+},
+	{0x8F
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_8F
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0810
+#endif
+},
+	{0x90
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_90
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0817
+#endif
+},
+	{0x91
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_91
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x081F
+#endif
+},
+	{0x92
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_92
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0829
+#endif
+},
+	{0x93
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_93
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0838
+#endif
+},
+	{0x94
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_94
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0844
+#endif
+},
+	{0x95
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_95
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0855
+#endif
+},
+	{0x96
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_96
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0860
+#endif
+},
+	{0x97
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_97
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0869
+#endif
+},
+	{0x98
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_98
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0870
+#endif
+},
+	{0x99
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_99
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0878
+#endif
+},
+	{0x9A
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_9A
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0883
+#endif
+},
+	{0x9B
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_9B
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0889
+#endif
+},
+	{0x9C
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_9C
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0895
+#endif
+},
+	{0x9D
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_9D
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x089F
+#endif
+},
+	{0x9E
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_9E
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x08AE
+#endif
+},
+	{0x9F
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_9F
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x08BE
+#endif
+},
+	{0xA0
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_A0
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x08D7
+#endif
+},
+	{0xA1
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_A1
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x08EF
+#endif
+},
+	{0xA2
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_A2
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x08F6
+#endif
+},
+	{0xA3
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_A3
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x08FF
+#endif
+},
+	{0xA4
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_A4
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x090D
+#endif
+},
+	{0xA5
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_A5
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0919
+#endif
+},
+	{0xA6
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_A6
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0929
+#endif
+},
+	{0xA7
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_A7
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0938
+#endif
+},
+	{0xA8
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_A8
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0941
+#endif
+},
+	{0xA9
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_A9
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x094D
+#endif
+},
+	{0xAA
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_AA
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0958
+#endif
+},
+	{0xAB
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_AB
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0961
+#endif
+},
+	{0xAC
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_AC
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x096C
+#endif
+},
+	{0xAD
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_AD
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x097C
+#endif
+},
+	{0xAE
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_AE
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0991
+#endif
+},
+	{0xAF
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_AF
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x099B
+#endif
+},
+	{0xB0
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_B0
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x09AE
+#endif
+},
+	{0xB1
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_B1
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x09B9
+#endif
+},
+	{0xB2
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_B2
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x09C1
+#endif
+},
+	{0xB3
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_B3
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x09D2
+#endif
+},
+	{0xB4
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_B4
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x09E0
+#endif
+},
+	{0xB5
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_B5
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x09F8
+#endif
+},
+	{0xB9
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_B9
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0A06
+#endif
+},
+	{0xBF
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_BF
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0A11
+#endif
+},
+	{0xC0
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_C0
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0A21
+#endif
+},
+	{0xC3
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_C3
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0A30
+#endif
+},
+	{0xC4
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_C4
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0A3C
+#endif
+},
+	{0xC5
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_C5
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0A47
+#endif
+},
+	{0xC6
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_C6
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0A5F
+#endif
+},
+	{0xC7
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_C7
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0A78
+#endif
+},
+	{0xC8
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_C8
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0A83
+#endif
+},
+	{0xC9
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_C9
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0A90
+#endif
+},
+	{0xCA
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_CA
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0A9E
+#endif
+},
+	{0xCB
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_CB
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0AB1
+#endif
+},
+	{0xCC
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_CC
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0ABE
+#endif
+},
+	{0xCD
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_CD
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0ACE
+#endif
+},
+	{0xCE
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_CE
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0AE3
+#endif
+},
+	{0xCF
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_CF
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0AF3
+#endif
+},
+	{0xD0
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_D0
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0B03
+#endif
+},
+	{0xD1
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_D1
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0B0F
+#endif
+},
+	{0xD2
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_D2
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0B2C
+#endif
+},
+	{0xD3
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_D3
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0B39
+#endif
+},
+	{0xD4
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_D4
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0B42
+#endif
+},
+	{0xD5
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_D5
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0B4A
+#endif
+},
+	{0xD6
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_D6
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0B53
+#endif
+},
+	{0xD7
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_D7
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0B5E
+#endif
+},
+	{0xD8
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_D8
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0B6F
+#endif
+},
+	{0xD9
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_D9
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0B7A
+#endif
+},
+	{0xDA
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_DA
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0B87
+#endif
+},
+	{0xDB
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_DB
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0B8F
+#endif
+},
+	{0xDC
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_DC
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0B9A
+#endif
+},
+	{0xDD
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_DD
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0BA3
+#endif
+},
+	{0xDE
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_DE
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0BA7
+#endif
+},
+	{0xDF
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_DF
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0BAD
+#endif
+},
+	{0xE0
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_E0
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0BBA
+#endif
+},
+	{0xE1
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_E1
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0BC1
+#endif
+},
+	{0xE2
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_E2
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0BCA
+#endif
+},
+	{0xE3
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_E3
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0BD6
+#endif
+},
+	{0xE7
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_E7
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0BE5
+#endif
+},
+	{0xE8
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_E8
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0BEF
+#endif
+},
+	{0xE9
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_E9
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0BFD
+#endif
+},
+	{0xEA
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_EA
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0C05
+#endif
+},
+	{0xEB
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_EB
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0C1C
+#endif
+},
+	{0xEC
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_EC
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0C42
+#endif
+},
+	{0xED
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_ED
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0C68
+#endif
+},
+	{0xEE
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_EE
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0C8E
+#endif
+},
+	{0xEF
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_EF
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0CB4
+#endif
+},
+	{0xF0
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_F0
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0CCE
+#endif
+},
+	{0xF1
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_F1
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0CD7
+#endif
+},
+	{0xF2
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_F2
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0CE1
+#endif
+},
+	{0xF3
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_F3
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0CE5
+#endif
+},
+	{0xF4
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_F4
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0CE8
+#endif
+},
+	{0xF5
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_F5
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0CEA
+#endif
+},
+	{0xF6
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_F6
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0CFC
+#endif
+},
+	{0xF7
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_F7
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0D21
+#endif
+},
+	{0xF8
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_F8
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0D46
+#endif
+},
+	{0xF9
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_F9
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0D6B
+#endif
+},
+	{0xFA
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_FA
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0D90
+#endif
+},
+	{0xFB
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_FB
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0D9E
+#endif
+},
+	{0xFC
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_FC
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0DA9
+#endif
+},
+	{0xFD
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_FD
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0DBA
+#endif
+},
+	{0xFF
+#if defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH)
+, Supplementary_S_FF
+#elif defined(WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_EEPROM)
+, (const char * const) 0x0DC5
+#endif
+},
+};
+
+#endif
+#endif
\ No newline at end of file
@@ -88,6 +88,14 @@
 # define WITH_RDS_TMC_SUPPLEMENTARY_STRINGS_FLASH
 #endif
 
+/* WITH_RDS_TMC_COMPRESSED_STRINGS selects the string tables compressed with a
+ * shared byte pair encoding dictionary (see gentables.py), for both the event
+ * and supplementary information strings and for both FLASH and EEPROM storage.
+ * They take less than half the space of the plain ones; the dictionary itself
+ * is 256 bytes of FLASH. When using EEPROM storage, program the
+ * *-compressed.eeprom images instead of the plain ones.
+ */
+
 #define RDS_TMC_QUANTIFIER_SMALL_NUMBER 0x0
 #define RDS_TMC_QUANTIFIER_NUMBER 0x1
 #define RDS_TMC_QUANTIFIER_LESSTHAN_METERS 0x2
@@ -123,6 +131,16 @@ typedef struct __attribute__ ((__packed__)) {
   byte updateClass;
 # if defined(WITH_RDS_TMC_EVENT_STRING_POINTERS)
   const char * const description;
+  /* Pre-parsed optional quantifier group "(... %s ...)" in description, as
+   * byte offsets of its opening parenthesis, of the %s and of the character
+   * past its closing parenthesis. substitution is RDS_TMC_EVENT_NO_GROUP for
+   * events without one. elideSpace tells that the space before the group (or
+   * after it, if it starts the text) is to be left out with the group.
+   */
+  uint8_t groupStart;
+  uint8_t substitution;
+  uint8_t groupEnd:7;
+  uint8_t elideSpace:1;
 # endif
 } TRDSTMCEventListEntry;
 #endif
@@ -134,7 +152,13 @@ typedef struct {
 } TRDSTMCSupplementaryEntry;
 #endif
 
-#include "iso14819-2-events.h"
-#include "iso14819-2-supplementary.h"
+#if defined(WITH_RDS_TMC_COMPRESSED_STRINGS)
+# include "iso14819-2-dictionary.h"
+# include "iso14819-2-events-compressed.h"
+# include "iso14819-2-supplementary-compressed.h"
+#else
+# include "iso14819-2-events.h"
+# include "iso14819-2-supplementary.h"
+#endif
 
 #endif